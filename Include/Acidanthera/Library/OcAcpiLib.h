@@ -53,6 +53,11 @@ typedef struct {
   CHAR8     Name[OC_ACPI_NAME_SIZE+1];
 } OC_ACPI_REGION;
 
+//
+// Namespace index of an ACPI table used to speed up repeated lookups.
+//
+typedef struct OC_ACPI_NAMESPACE_INDEX_ OC_ACPI_NAMESPACE_INDEX;
+
 //
 // Main ACPI context describing current tableset worked on.
 //
@@ -101,6 +106,18 @@ typedef struct {
   // Number of allocated region slots.
   //
   UINT32                                           AllocatedRegions;
+  //
+  // Namespace indices of tables looked up for patch base.
+  //
+  OC_ACPI_NAMESPACE_INDEX                          **Indices;
+  //
+  // Number of indices.
+  //
+  UINT32                                           NumberOfIndices;
+  //
+  // Number of allocated index slots.
+  //
+  UINT32                                           AllocatedIndices;
 } OC_ACPI_CONTEXT;
 
 //
@@ -247,6 +264,27 @@ AcpiApplyPatch (
   IN     OC_ACPI_PATCH    *Patch
   );
 
+/**
+  Patch ACPI tables with multiple patches in order.
+  Consecutive patches without Base are applied to every table in a single pass
+  with one checksum refresh. The result is identical to calling AcpiApplyPatch
+  for every patch.
+
+  @param[in,out] Context     ACPI library context.
+  @param[in]     Patches     ACPI patches.
+  @param[in]     PatchCount  Number of patches.
+  @param[out]    Results     Per-patch status as AcpiApplyPatch would return.
+
+  @return EFI_SUCCESS on success.
+**/
+EFI_STATUS
+AcpiApplyPatches (
+  IN OUT OC_ACPI_CONTEXT  *Context,
+  IN     OC_ACPI_PATCH    *Patches,
+  IN     UINT32           PatchCount,
+  OUT    EFI_STATUS       *Results
+  );
+
 /**
   Try to load ACPI regions.
 
@@ -346,4 +384,55 @@ AcpiFindEntryInMemory (
   IN     UINT32       TableLength OPTIONAL
   );
 
+/**
+  Finds offset of required entry in ACPI table in case it exists
+  by using namespace index. The index is built on first use and is
+  reused for the following lookups in the same table. Results are
+  identical to AcpiFindEntryInMemory.
+
+  @param[in,out] Index       Namespace index, NULL on first call.
+  @param[in]     Table       Pointer to start of ACPI table.
+  @param[in]     PathString  Path to entry which must be found.
+  @param[in]     Entry       Number of entry which must be found.
+  @param[out]    Offset      Offset of the entry if it was found.
+  @param[in]     TableLength Length of ACPI table.
+
+  @retval EFI_SUCCESS           Required entry was found.
+  @retval EFI_NOT_FOUND         Required entry was not found.
+  @retval EFI_DEVICE_ERROR      Error occured during parsing ACPI table.
+  @retval EFI_OUT_OF_RESOURCES  Nesting limit has been reached.
+  @retval EFI_INVALID_PARAMETER Got wrong path to the entry.
+**/
+EFI_STATUS
+AcpiFindEntryInIndex (
+  IN OUT OC_ACPI_NAMESPACE_INDEX  **Index,
+  IN     UINT8                    *Table,
+  IN     CONST CHAR8              *PathString,
+  IN     UINT8                    Entry,
+  OUT UINT32                      *Offset,
+  IN     UINT32                   TableLength OPTIONAL
+  );
+
+/**
+  Mark namespace index outdated after its table contents were changed.
+  Changes limited to object names are picked up without reparsing,
+  any other change or a different table length rebuilds the index.
+
+  @param[in,out] Index  Namespace index.
+**/
+VOID
+AcpiInvalidateNamespaceIndex (
+  IN OUT OC_ACPI_NAMESPACE_INDEX  *Index
+  );
+
+/**
+  Free namespace index.
+
+  @param[in] Index  Namespace index.
+**/
+VOID
+AcpiFreeNamespaceIndex (
+  IN OC_ACPI_NAMESPACE_INDEX  *Index
+  );
+
 #endif // OC_ACPI_LIB_H
@@ -26,6 +26,12 @@ typedef struct OC_APPLE_CHUNKLIST_CONTEXT_ {
   CONST APPLE_CHUNKLIST_CHUNK    *Chunks;
   APPLE_CHUNKLIST_SIG            *Signature;
   UINT8                          Hash[SHA256_DIGEST_SIZE];
+  //
+  // Incremental data verification state.
+  //
+  UINTN                          VerifiedChunkCount;
+  UINT32                         ChunkDataSize;
+  SHA256_CONTEXT                 ChunkHashContext;
 } OC_APPLE_CHUNKLIST_CONTEXT;
 
 //
@@ -74,4 +80,47 @@ OcAppleChunklistVerifyData (
   IN     CONST APPLE_RAM_DISK_EXTENT_TABLE  *ExtentTable
   );
 
+/**
+  Start incremental verification of data against a chunklist context,
+  which must have its signature verified.
+
+  @param[in,out] Context  The Context to verify against.
+**/
+VOID
+OcAppleChunklistVerifyDataStart (
+  IN OUT OC_APPLE_CHUNKLIST_CONTEXT  *Context
+  );
+
+/**
+  Verify the next part of the data against a chunklist context.
+  Every chunk is verified as soon as its last byte is passed.
+  Data past the last chunk is ignored.
+
+  @param[in,out] Context   The Context to verify against.
+  @param[in]     Data      Next part of the data.
+  @param[in]     DataSize  Size of Data.
+
+  @retval TRUE   All chunks completed so far are valid.
+  @retval FALSE  The data failed verification.
+**/
+BOOLEAN
+OcAppleChunklistVerifyDataUpdate (
+  IN OUT OC_APPLE_CHUNKLIST_CONTEXT  *Context,
+  IN     CONST VOID                  *Data,
+  IN     UINTN                       DataSize
+  );
+
+/**
+  Finish incremental verification of data against a chunklist context.
+
+  @param[in,out] Context  The Context to verify against.
+
+  @retval TRUE   The data covered every chunk and was verified successfully.
+  @retval FALSE  The data was too short or failed verification.
+**/
+BOOLEAN
+OcAppleChunklistVerifyDataFinal (
+  IN OUT OC_APPLE_CHUNKLIST_CONTEXT  *Context
+  );
+
 #endif // APPLE_CHUNKLIST_LIB_H
@@ -20,6 +20,43 @@
 #include <Library/OcAppleChunklistLib.h>
 #include <Library/OcAppleRamDiskLib.h>
 
+//
+// Number of decompressed chunks cached by disk image context.
+//
+#define OC_APPLE_DISK_IMAGE_CACHE_SIZE  8U
+
+//
+// Maximum decompressed chunk size kept in the cache.
+// UDIF images normally use 1 MB chunks.
+//
+#define OC_APPLE_DISK_IMAGE_CACHE_MAX_CHUNK_SIZE  SIZE_8MB
+
+//
+// Disk image chunk lookup entry.
+//
+typedef struct {
+  //
+  // Absolute sector range of the chunk.
+  //
+  UINT64                         SectorStart;
+  UINT64                         SectorTop;
+  APPLE_DISK_IMAGE_BLOCK_DATA    *Block;
+  APPLE_DISK_IMAGE_CHUNK         *Chunk;
+} OC_APPLE_DISK_IMAGE_CHUNK_ENTRY;
+
+//
+// Decompressed disk image chunk.
+//
+typedef struct {
+  //
+  // Chunk in Data or NULL for unused entry.
+  //
+  CONST APPLE_DISK_IMAGE_CHUNK    *Chunk;
+  UINT8                           *Data;
+  UINTN                           DataSize;
+  UINT64                          LastUse;
+} OC_APPLE_DISK_IMAGE_CACHE_ENTRY;
+
 //
 // Disk image context.
 //
@@ -30,6 +67,23 @@ typedef struct {
 
   UINT32                               BlockCount;
   APPLE_DISK_IMAGE_BLOCK_DATA          **Blocks;
+  //
+  // Chunks sorted by sector or NULL for linear lookup.
+  //
+  UINT32                               ChunkCount;
+  OC_APPLE_DISK_IMAGE_CHUNK_ENTRY      *Chunks;
+  //
+  // Recently decompressed chunks.
+  //
+  OC_APPLE_DISK_IMAGE_CACHE_ENTRY      Cache[OC_APPLE_DISK_IMAGE_CACHE_SIZE];
+  UINT64                               CacheTick;
+  UINT64                               CacheHits;
+  UINT64                               CacheMisses;
+  //
+  // Compressed chunk scratch buffer.
+  //
+  UINT8                                *CompressedData;
+  UINTN                                CompressedDataSize;
 } OC_APPLE_DISK_IMAGE_CONTEXT;
 
 BOOLEAN
@@ -39,10 +93,22 @@ OcAppleDiskImageInitializeContext (
   IN  UINTN                              FileSize
   );
 
+/**
+  Load disk image file into RAM disk and initialise disk image context.
+
+  @param[out]    Context           Disk image context.
+  @param[in]     File              Disk image file open for reading.
+  @param[in,out] ChunklistContext  Chunklist with verified signature to verify
+                                   the file against while it is loaded, so it is
+                                   never read back. Optional.
+
+  @retval TRUE on success.
+**/
 BOOLEAN
 OcAppleDiskImageInitializeFromFile (
-  OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
-  IN  EFI_FILE_PROTOCOL            *File
+  OUT    OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
+  IN     EFI_FILE_PROTOCOL            *File,
+  IN OUT OC_APPLE_CHUNKLIST_CONTEXT   *ChunklistContext OPTIONAL
   );
 
 VOID
@@ -63,10 +129,10 @@ OcAppleDiskImageVerifyData (
 
 BOOLEAN
 OcAppleDiskImageRead (
-  IN  OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
-  IN  UINTN                        Lba,
-  IN  UINTN                        BufferSize,
-  OUT VOID                         *Buffer
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
+  IN     UINTN                        Lba,
+  IN     UINTN                        BufferSize,
+  OUT    VOID                         *Buffer
   );
 
 EFI_HANDLE
@@ -61,6 +61,13 @@
 #define PRELINK_INFO_INTEGER_ATTRIBUTES  "size=\"64\""
 #define MKEXT_INFO_INTEGER_ATTRIBUTES    "size=\"32\""
 
+//
+// Nest level of kext dictionaries in prelinked info, which are parsed on first access.
+// Legacy prelinked info starts with <dict>, while kernel collection has <plist> root.
+//
+#define PRELINK_INFO_KEXT_LEVEL     2U
+#define PRELINK_INFO_KEXT_LEVEL_KC  3U
+
 #define KC_REGION_SEGMENT_PREFIX  "__REGION"
 #define KC_REGION0_SEGMENT        "__REGION0"
 #define KC_TEXT_SEGMENT           "__TEXT"
@@ -315,6 +322,20 @@ typedef struct {
   //
   LIST_ENTRY                             InjectedKexts;
   //
+  // Open addressing hash index of kexts by bundle identifier, referencing
+  // both KextList entries and PrelinkedKexts. NULL when unavailable,
+  // in which case lookups walk the lists.
+  //
+  VOID                                   *KextIndex;
+  //
+  // Number of slots in KextIndex, power of two.
+  //
+  UINT32                                 KextIndexSlots;
+  //
+  // Number of used slots in KextIndex.
+  //
+  UINT32                                 KextIndexCount;
+  //
   // Whether this kernel is a kernel collection (used by macOS 11.0+).
   //
   BOOLEAN                                IsKernelCollection;
@@ -338,6 +359,14 @@ typedef struct {
   // Prelinked is 32-bit.
   //
   BOOLEAN                                Is32Bit;
+  //
+  // Number of dependency symbol lookups by name, used for profiling.
+  //
+  UINT32                                 SymbolNameLookups;
+  //
+  // Number of dependency symbol lookups by value, used for profiling.
+  //
+  UINT32                                 SymbolValueLookups;
 } PRELINKED_CONTEXT;
 
 //
@@ -1163,6 +1192,25 @@ PatcherApplyGenericPatch (
   IN     PATCHER_GENERIC_PATCH  *Patch
   );
 
+/**
+  Apply multiple generic patches in order.
+  Consecutive patches without symbol base are applied in a single pass.
+
+  @param[in,out] Context         Patcher context.
+  @param[in]     Patches         Patch descriptions.
+  @param[in]     PatchCount      Number of patches.
+  @param[out]    Results         Per-patch status as PatcherApplyGenericPatch would return.
+
+  @return  EFI_SUCCESS on success.
+**/
+EFI_STATUS
+PatcherApplyGenericPatches (
+  IN OUT PATCHER_CONTEXT        *Context,
+  IN     PATCHER_GENERIC_PATCH  *Patches,
+  IN     UINT32                 PatchCount,
+  OUT    EFI_STATUS             *Results
+  );
+
 /**
   Exclude kext from prelinked.
 
@@ -68,12 +68,32 @@ OcAppleRamDiskWrite (
   IN CONST VOID                         *Buffer
   );
 
+/**
+  Inspect file data while it is loaded into RAM disk.
+
+  @param[in]  Context     Callback context.
+  @param[in]  Buffer      Next part of file data.
+  @param[in]  BufferSize  Size of Buffer.
+
+  @retval TRUE to continue loading.
+**/
+typedef
+BOOLEAN
+(*OC_APPLE_RAM_DISK_LOAD_CALLBACK) (
+  IN VOID        *Context,
+  IN CONST VOID  *Buffer,
+  IN UINTN       BufferSize
+  );
+
 /**
   Load file into RAM disk as it is.
 
-  @param[in]  ExtentTable Allocated extent table.
-  @param[in]  File        File protocol open for reading.
-  @param[in]  FileSize    Amount of data to write.
+  @param[in]  ExtentTable     Allocated extent table.
+  @param[in]  File            File protocol open for reading.
+  @param[in]  FileSize        Amount of data to write.
+  @param[in]  Callback        Called for every part of file data in order,
+                              while it is still in the read buffer. Optional.
+  @param[in]  CallbackContext Callback context. Optional.
 
   @retval TRUE on success.
 **/
@@ -81,7 +101,9 @@ BOOLEAN
 OcAppleRamDiskLoadFile (
   IN OUT CONST APPLE_RAM_DISK_EXTENT_TABLE  *ExtentTable,
   IN     EFI_FILE_PROTOCOL                  *File,
-  IN     UINTN                              FileSize
+  IN     UINTN                              FileSize,
+  IN     OC_APPLE_RAM_DISK_LOAD_CALLBACK    Callback         OPTIONAL,
+  IN     VOID                               *CallbackContext OPTIONAL
   );
 
 /**
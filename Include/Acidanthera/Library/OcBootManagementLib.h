@@ -114,12 +114,14 @@ typedef struct OC_HOTKEY_CONTEXT_ OC_HOTKEY_CONTEXT;
 #define OC_ATTR_USE_FLAVOUR_ICON         BIT7
 #define OC_ATTR_USE_REVERSED_UI          BIT8
 #define OC_ATTR_REDUCE_MOTION            BIT9
+#define OC_ATTR_USE_IMAGE_CACHE          BIT10
 #define OC_ATTR_ALL_BITS                 (\
   OC_ATTR_USE_VOLUME_ICON         | OC_ATTR_USE_DISK_LABEL_FILE | \
   OC_ATTR_USE_GENERIC_LABEL_IMAGE | OC_ATTR_HIDE_THEMED_ICONS   | \
   OC_ATTR_USE_POINTER_CONTROL     | OC_ATTR_SHOW_DEBUG_DISPLAY  | \
   OC_ATTR_USE_MINIMAL_UI          | OC_ATTR_USE_FLAVOUR_ICON    | \
-  OC_ATTR_USE_REVERSED_UI         | OC_ATTR_REDUCE_MOTION )
+  OC_ATTR_USE_REVERSED_UI         | OC_ATTR_REDUCE_MOTION       | \
+  OC_ATTR_USE_IMAGE_CACHE )
 
 /**
   Default timeout for IDLE timeout during menu picker navigation
@@ -1003,6 +1005,10 @@ struct OC_PICKER_CONTEXT_ {
   //
   BOOLEAN                     PollAppleHotKeys;
   //
+  // Cache boot entry discovery results on the OpenCore volume.
+  //
+  BOOLEAN                     UseScanCache;
+  //
   // Allow setting default boot option from boot menu.
   //
   BOOLEAN                     AllowSetDefault;
@@ -63,6 +63,52 @@ DecompressLZSS (
   IN  UINT32  SrcLen
   );
 
+/**
+  Start streaming decompression with LZSS algorithm.
+
+  @param[out]  Dst         Destination buffer.
+  @param[in]   DstLen      Destination buffer size.
+
+  @return  Decompression context or NULL.
+**/
+VOID *
+DecompressLZSSStart (
+  OUT UINT8   *Dst,
+  IN  UINT32  DstLen
+  );
+
+/**
+  Decompress next part of LZSS stream. Bytes not consumed by this call
+  must be passed again at the beginning of the source buffer of the next call.
+  Source buffer must fit at least one flag byte group (17 bytes).
+
+  @param[in,out]  Context     Decompression context.
+  @param[in]      Src         Source buffer.
+  @param[in]      SrcLen      Source buffer size.
+  @param[in]      Last        Source buffer ends the stream.
+
+  @return  Number of source bytes consumed.
+**/
+UINT32
+DecompressLZSSUpdate (
+  IN OUT VOID         *Context,
+  IN     CONST UINT8  *Src,
+  IN     UINT32       SrcLen,
+  IN     BOOLEAN      Last
+  );
+
+/**
+  Finish streaming decompression with LZSS algorithm and free the context.
+
+  @param[in]  Context     Decompression context.
+
+  @return  DecompressedLen.
+**/
+UINT32
+DecompressLZSSEnd (
+  IN VOID  *Context
+  );
+
 /**
   Decompress buffer with LZVN algorithm.
 
@@ -81,6 +127,50 @@ DecompressLZVN (
   IN  UINTN        SrcLen
   );
 
+/**
+  Start streaming decompression with LZVN algorithm.
+
+  @param[out]  Dst         Destination buffer.
+  @param[in]   DstLen      Destination buffer size.
+
+  @return  Decompression context or NULL.
+**/
+VOID *
+DecompressLZVNStart (
+  OUT UINT8  *Dst,
+  IN  UINTN  DstLen
+  );
+
+/**
+  Decompress next part of LZVN stream. Bytes not consumed by this call
+  must be passed again at the beginning of the source buffer of the next call.
+  Source buffer must fit at least one instruction (274 bytes).
+
+  @param[in,out]  Context     Decompression context.
+  @param[in]      Src         Source buffer.
+  @param[in]      SrcLen      Source buffer size.
+
+  @return  Number of source bytes consumed.
+**/
+UINTN
+DecompressLZVNUpdate (
+  IN OUT VOID         *Context,
+  IN     CONST UINT8  *Src,
+  IN     UINTN        SrcLen
+  );
+
+/**
+  Finish streaming decompression with LZVN algorithm and free the context.
+
+  @param[in]  Context     Decompression context.
+
+  @return  DecompressedLen.
+**/
+UINTN
+DecompressLZVNEnd (
+  IN VOID  *Context
+  );
+
 /**
   Compress buffer with ZLIB algorithm.
 
@@ -117,6 +207,62 @@ DecompressZLIB (
   IN  UINTN        SrcLen
   );
 
+/**
+  Decompress buffer with LZFSE algorithm.
+  LZVN and uncompressed blocks within LZFSE stream are supported.
+
+  @param[out]  Dst         Destination buffer.
+  @param[in]   DstLen      Destination buffer size.
+  @param[in]   Src         Source buffer.
+  @param[in]   SrcLen      Source buffer size.
+
+  @return  DecompressedLen on success otherwise 0.
+**/
+UINTN
+DecompressLZFSE (
+  OUT UINT8        *Dst,
+  IN  UINTN        DstLen,
+  IN  CONST UINT8  *Src,
+  IN  UINTN        SrcLen
+  );
+
+/**
+  Decompress buffer with ADC (Apple Data Compression) algorithm.
+
+  @param[out]  Dst         Destination buffer.
+  @param[in]   DstLen      Destination buffer size.
+  @param[in]   Src         Source buffer.
+  @param[in]   SrcLen      Source buffer size.
+
+  @return  DecompressedLen on success otherwise 0.
+**/
+UINTN
+DecompressADC (
+  OUT UINT8        *Dst,
+  IN  UINTN        DstLen,
+  IN  CONST UINT8  *Src,
+  IN  UINTN        SrcLen
+  );
+
+/**
+  Decompress buffer with BZIP2 algorithm.
+  Concatenated streams are supported, CRC is not verified.
+
+  @param[out]  Dst         Destination buffer.
+  @param[in]   DstLen      Destination buffer size.
+  @param[in]   Src         Source buffer.
+  @param[in]   SrcLen      Source buffer size.
+
+  @return  DecompressedLen on success otherwise 0.
+**/
+UINTN
+DecompressBZIP2 (
+  OUT UINT8        *Dst,
+  IN  UINTN        DstLen,
+  IN  CONST UINT8  *Src,
+  IN  UINTN        SrcLen
+  );
+
 /**
   Decompress buffer with RLE24 algorithm and 8-bit alpha.
   This algorithm is used for encoding IT32/T8MK images in ICNS.
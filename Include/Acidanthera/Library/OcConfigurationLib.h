@@ -312,7 +312,8 @@ OC_DECLARE (OC_KERNEL_QUIRKS)
   _(OC_STRING                   , KernelArch       ,     , OC_STRING_CONSTR ("Auto", _, __), OC_DESTR (OC_STRING)) \
   _(OC_STRING                   , KernelCache      ,     , OC_STRING_CONSTR ("Auto", _, __), OC_DESTR (OC_STRING)) \
   _(BOOLEAN                     , CustomKernel     ,     , FALSE  , ()) \
-  _(BOOLEAN                     , FuzzyMatch       ,     , FALSE  , ())
+  _(BOOLEAN                     , FuzzyMatch       ,     , FALSE  , ()) \
+  _(BOOLEAN                     , PersistentCache  ,     , FALSE  , ())
 OC_DECLARE (OC_KERNEL_SCHEME)
 
 #define OC_KERNEL_CONFIG_FIELDS(_, __) \
@@ -348,6 +349,7 @@ OC_DECLARE (OC_MISC_BLESS_ARRAY)
   _(BOOLEAN                     , HibernateSkipsPicker        ,     , FALSE                               , ())                   \
   _(BOOLEAN                     , HideAuxiliary               ,     , FALSE                               , ())                   \
   _(BOOLEAN                     , PollAppleHotKeys            ,     , FALSE                               , ())                   \
+  _(BOOLEAN                     , ScanCache                   ,     , FALSE                               , ())                   \
   _(BOOLEAN                     , ShowPicker                  ,     , FALSE                               , ())
 OC_DECLARE (OC_MISC_BOOT)
 
@@ -826,6 +828,48 @@ OcConfigurationInit (
   IN  OUT  UINT32        *ErrorCount  OPTIONAL
   );
 
+/**
+  Initialize configuration with binary data produced by OcConfigurationSerialize.
+  No plist parsing is performed, Source is only used to verify that the binary
+  data is up to date.
+
+  @param[out]     Config      Configuration structure.
+  @param[in]      Buffer      Configuration buffer in binary format.
+  @param[in]      Size        Configuration buffer size.
+  @param[in]      Source      Configuration buffer in plist format.
+  @param[in]      SourceSize  Configuration buffer in plist format size.
+
+  @retval  EFI_SUCCESS on success
+**/
+EFI_STATUS
+OcConfigurationInitBinary (
+  OUT  OC_GLOBAL_CONFIG  *Config,
+  IN   CONST VOID        *Buffer,
+  IN   UINT32            Size,
+  IN   CONST VOID        *Source,
+  IN   UINT32            SourceSize
+  );
+
+/**
+  Serialize configuration into binary format.
+
+  @param[in]   Config      Configuration structure.
+  @param[in]   Source      Configuration buffer in plist format Config was parsed from.
+  @param[in]   SourceSize  Configuration buffer in plist format size.
+  @param[out]  Buffer      Configuration buffer in binary format, allocated from pool.
+  @param[out]  Size        Configuration buffer in binary format size.
+
+  @retval  EFI_SUCCESS on success
+**/
+EFI_STATUS
+OcConfigurationSerialize (
+  IN   OC_GLOBAL_CONFIG  *Config,
+  IN   CONST VOID        *Source,
+  IN   UINT32            SourceSize,
+  OUT  VOID              **Buffer,
+  OUT  UINT32            *Size
+  );
+
 /**
   Free configuration structure.
 
@@ -136,6 +136,15 @@ typedef struct SHA256_CONTEXT_ {
   UINT32    State[8];
 } SHA256_CONTEXT;
 
+//
+// Independent buffer hashed by Sha256Batch.
+//
+typedef struct OC_SHA256_BATCH_ENTRY_ {
+  CONST UINT8    *Data;
+  UINTN          Len;
+  UINT8          Hash[SHA256_DIGEST_SIZE];
+} OC_SHA256_BATCH_ENTRY;
+
 typedef struct SHA512_CONTEXT_ {
   UINT64    TotalLength;
   UINTN     Length;
@@ -344,6 +353,43 @@ Sha256 (
   UINTN        Len
   );
 
+/**
+  Get the number of buffers Sha256Batch hashes simultaneously,
+  which callers may use to size their batches.
+
+  @return  Number of buffers hashed in parallel, 1 without parallelism.
+**/
+UINTN
+Sha256BatchParallelism (
+  VOID
+  );
+
+/**
+  Compute SHA-256 digests of independent buffers, in parallel when supported.
+
+  @param[in,out] Entries  Buffers to hash, digests are returned in Hash fields.
+  @param[in]     Count    Number of entries.
+**/
+VOID
+Sha256Batch (
+  IN OUT OC_SHA256_BATCH_ENTRY  *Entries,
+  IN     UINTN                  Count
+  );
+
+#ifdef EFIUSER
+
+/**
+  Set the number of threads used by Sha256Batch.
+
+  @param[in] Parallelism  Number of threads, 0 for every online CPU.
+**/
+VOID
+Sha256BatchSetParallelism (
+  IN UINTN  Parallelism
+  );
+
+#endif
+
 VOID
 Sha512Init (
   SHA512_CONTEXT  *Context
@@ -27,6 +27,11 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 ///
 #define MACHO_ALIGN(x)  ALIGN_VALUE((x), MACHO_PAGE_SIZE)
 
+///
+/// Lookup index of a Mach-O, see MachoInitializeIndex.
+///
+typedef struct OC_MACHO_INDEX_ OC_MACHO_INDEX;
+
 ///
 /// Context used to refer to a Mach-O.  This struct is exposed for reference
 /// only.  Members are not guaranteed to be sane.
@@ -44,6 +49,7 @@ typedef struct {
   MACH_NLIST_ANY           *IndirectSymbolTable;
   MACH_RELOCATION_INFO     *LocalRelocations;
   MACH_RELOCATION_INFO     *ExternRelocations;
+  OC_MACHO_INDEX           *Index;
 
   BOOLEAN                  Is32Bit;
 } OC_MACHO_CONTEXT;
@@ -116,6 +122,53 @@ MachoInitializeContext (
   IN  BOOLEAN           Is32Bit
   );
 
+/**
+  Enables the lookup index of a Mach-O Context.  Relocation, symbol name and
+  symbol value lookups transparently use the index, which is built lazily on
+  first use of each kind of lookup.
+
+  While the index is enabled, relocations and symbol names must not be
+  changed, and symbol values may only be changed via MachoRelocateSymbol or
+  when followed by MachoUpdateSymbolValueIndex.  The index must be freed with
+  MachoFreeIndex before Context is initialized again or discarded.  Copies of
+  Context share the index and must not free it.
+
+  @param[in,out] Context  Context of the Mach-O.
+
+  @return  Whether the index has been enabled.  Lookups fall back to linear
+           scans otherwise.
+
+**/
+BOOLEAN
+MachoInitializeIndex (
+  IN OUT OC_MACHO_CONTEXT  *Context
+  );
+
+/**
+  Frees the lookup index of a Mach-O Context, if any.
+
+  @param[in,out] Context  Context of the Mach-O.
+
+**/
+VOID
+MachoFreeIndex (
+  IN OUT OC_MACHO_CONTEXT  *Context
+  );
+
+/**
+  Updates the lookup index of a Mach-O Context after the value of Symbol
+  has been changed.  Does nothing if the index is not enabled.
+
+  @param[in,out] Context  Context of the Mach-O.
+  @param[in]     Symbol   Symbol from the symbol table of Context.
+
+**/
+VOID
+MachoUpdateSymbolValueIndex (
+  IN OUT OC_MACHO_CONTEXT      *Context,
+  IN     CONST MACH_NLIST_ANY  *Symbol
+  );
+
 /**
   Returns the universal Mach-O Header structure.
 
@@ -690,6 +743,22 @@ MachoGetLocalDefinedSymbolByName64 (
   IN     CONST CHAR8       *Name
   );
 
+/**
+  Retrieves the first symbol of the symbol table with the given name,
+  defined or not.  Symbols past the first malformed one are not considered.
+
+  @param[in] Context  Context of the Mach-O.
+  @param[in] Name     Name of the symbol to locate.
+
+  @retval NULL  NULL is returned on failure.
+
+**/
+MACH_NLIST_ANY *
+MachoGetSymbolByName (
+  IN OUT OC_MACHO_CONTEXT  *Context,
+  IN     CONST CHAR8       *Name
+  );
+
 /**
   Retrieves a symbol by its index.
 
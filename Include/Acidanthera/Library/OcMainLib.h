@@ -51,6 +51,8 @@
 
 #define OPEN_CORE_CONFIG_PATH  L"config.plist"
 
+#define OPEN_CORE_CONFIG_BINARY_PATH  L"config.bin"
+
 #define OPEN_CORE_LOG_PREFIX_PATH  L"opencore"
 
 #define OPEN_CORE_ACPI_PATH  L"ACPI\\"
@@ -59,6 +59,70 @@ ApplyPatch (
   IN UINT32        Skip
   );
 
+/**
+  Patch description for ApplyPatches.
+**/
+typedef struct {
+  //
+  // Find pattern.
+  //
+  CONST UINT8    *Pattern;
+  //
+  // Find pattern mask or NULL.
+  //
+  CONST UINT8    *PatternMask;
+  //
+  // Replace pattern.
+  //
+  CONST UINT8    *Replace;
+  //
+  // Replace pattern mask or NULL.
+  //
+  CONST UINT8    *ReplaceMask;
+  //
+  // Pattern size.
+  //
+  UINT32         PatternSize;
+  //
+  // Replace count or 0 for all.
+  //
+  UINT32         Count;
+  //
+  // Skip count or 0 to start from 1 match.
+  //
+  UINT32         Skip;
+  //
+  // Limit patched data size to this value or 0 for whole data.
+  //
+  UINT32         Limit;
+  //
+  // Number of performed replacements, set on return.
+  //
+  UINT32         ReplaceCount;
+} OC_DATA_PATCH;
+
+/**
+  Apply multiple patches to data in a single pass.
+  The result is identical to calling ApplyPatch for every patch in order.
+  When matches of different patches may interfere with each other,
+  the patches are applied one after another instead.
+
+  @param[in,out] Patches     Patches to apply, ReplaceCount is updated.
+  @param[in]     PatchCount  Number of patches.
+  @param[in,out] Data        Data to patch.
+  @param[in]     DataSize    Data size.
+
+  @retval TRUE when all patches were applied in a single pass.
+  @retval FALSE when patches were applied one after another.
+**/
+BOOLEAN
+ApplyPatches (
+  IN OUT OC_DATA_PATCH  *Patches,
+  IN     UINT32         PatchCount,
+  IN OUT UINT8          *Data,
+  IN     UINT32         DataSize
+  );
+
 /**
   Obtain application arguments.
 
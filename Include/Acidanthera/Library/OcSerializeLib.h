@@ -22,8 +22,9 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #include <Library/OcXmlLib.h>
 #include <Library/OcTemplateLib.h>
 
-typedef struct OC_SCHEMA_      OC_SCHEMA;
-typedef union OC_SCHEMA_INFO_  OC_SCHEMA_INFO;
+typedef struct OC_SCHEMA_       OC_SCHEMA;
+typedef union OC_SCHEMA_INFO_   OC_SCHEMA_INFO;
+typedef struct OC_SCHEMA_HASH_  OC_SCHEMA_HASH;
 
 //
 // Generic applier interface that knows how to provide Info with data from Node.
@@ -45,11 +46,15 @@ typedef struct {
   //
   // Nested schema list.
   //
-  OC_SCHEMA    *Schema;
+  OC_SCHEMA         *Schema;
   //
   // Nested schema list size.
   //
-  UINT32       SchemaSize;
+  UINT32            SchemaSize;
+  //
+  // Perfect hash table for nested schema list, built on first lookup.
+  //
+  OC_SCHEMA_HASH    *Hash;
 } OC_SCHEMA_DICT;
 
 //
@@ -161,6 +166,16 @@ LookupConfigSchema (
   IN CONST CHAR8  *Name
   );
 
+//
+// Find schema in a dictionary schema by its perfect hash table,
+// falling back to LookupConfigSchema when the table cannot be built.
+//
+OC_SCHEMA *
+LookupConfigSchemaHash (
+  IN OC_SCHEMA_INFO  *Info,
+  IN CONST CHAR8     *Name
+  );
+
 //
 // Apply interface to parse serialized dictionaries
 //
@@ -235,6 +250,73 @@ ParseSerialized (
   IN  OUT  UINT32          *ErrorCount  OPTIONAL
   );
 
+//
+// Binary serialized data signature and version.
+//
+#define OC_SERIALIZED_BINARY_SIGNATURE  SIGNATURE_32 ('O', 'C', 'S', 'B')
+#define OC_SERIALIZED_BINARY_VERSION    1U
+
+//
+// Size of source data digest stored in binary serialized data.
+//
+#define OC_SERIALIZED_DIGEST_SIZE  32U
+
+//
+// Binary serialized data header, followed by DataSize bytes of values
+// in schema order.
+//
+typedef struct {
+  //
+  // OC_SERIALIZED_BINARY_SIGNATURE.
+  //
+  UINT32    Signature;
+  //
+  // OC_SERIALIZED_BINARY_VERSION.
+  //
+  UINT32    Version;
+  //
+  // Hash of the schema used for serialization.
+  //
+  UINT32    SchemaHash;
+  //
+  // Size of serialized values.
+  //
+  UINT32    DataSize;
+  //
+  // Digest of the data the values were originally parsed from.
+  //
+  UINT8     SourceDigest[OC_SERIALIZED_DIGEST_SIZE];
+} OC_SERIALIZED_BINARY_HEADER;
+
+//
+// Serialize data described by RootSchema into binary form.
+// Buffer may be NULL to obtain the required size in BufferSize.
+// Only builtin appliers are supported.
+//
+BOOLEAN
+SerializeBinary (
+  IN      CONST VOID      *Serialized,
+  IN      OC_SCHEMA_INFO  *RootSchema,
+  IN      CONST UINT8     *SourceDigest,
+  OUT     VOID            *Buffer      OPTIONAL,
+  IN OUT  UINT32          *BufferSize
+  );
+
+//
+// Main interface for parsing binary serialized data.
+// Fails if the data is malformed, was serialized with another schema
+// or from the source with another digest.
+// Serialized may be partially filled on failure.
+//
+BOOLEAN
+ParseSerializedBinary (
+  OUT  VOID            *Serialized,
+  IN   OC_SCHEMA_INFO  *RootSchema,
+  IN   CONST VOID      *Buffer,
+  IN   UINT32          BufferSize,
+  IN   CONST UINT8     *SourceDigest
+  );
+
 //
 // Retrieve typed field pointer from offset
 //
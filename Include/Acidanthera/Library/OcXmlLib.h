@@ -108,6 +108,59 @@ struct XML_NODE_;
 typedef struct XML_DOCUMENT_  XML_DOCUMENT;
 typedef struct XML_NODE_      XML_NODE;
 
+/**
+  XML pull parser events.
+**/
+typedef enum XML_PULL_EVENT_ {
+  XML_PULL_EVENT_END,
+  XML_PULL_EVENT_ERROR,
+  XML_PULL_EVENT_OPEN,
+  XML_PULL_EVENT_CLOSE,
+  XML_PULL_EVENT_CONTENT
+} XML_PULL_EVENT;
+
+/**
+  XML pull parser token. Strings point to the parsed buffer
+  and are not null terminated.
+**/
+typedef struct XML_PULL_TOKEN_ {
+  //
+  // Token event.
+  //
+  XML_PULL_EVENT    Event;
+  //
+  // Offset of the token in the buffer.
+  //
+  UINT32            Offset;
+  //
+  // Tag name for open and close events.
+  //
+  CONST CHAR8       *Name;
+  UINT32            NameLength;
+  //
+  // Attributes for open events, trimmed text for content events.
+  //
+  CONST CHAR8       *Value;
+  UINT32            ValueLength;
+  //
+  // TRUE for self closing open events, which have no close events.
+  //
+  BOOLEAN           SelfClosing;
+} XML_PULL_TOKEN;
+
+/**
+  XML pull parser context. Unlike XmlDocumentParse the buffer is not modified.
+**/
+typedef struct XML_PULL_PARSER_ {
+  CONST CHAR8    *Buffer;
+  UINT32         Length;
+  UINT32         Position;
+  //
+  // Number of currently open tags.
+  //
+  UINT32         Level;
+} XML_PULL_PARSER;
+
 /**
   Parse the XML fragment in buffer.
   References in the document to allow deduplicated node reading:
@@ -132,6 +185,37 @@ XmlDocumentParse (
   IN      BOOLEAN  WithRefs
   );
 
+/**
+  Parse the XML fragment in buffer like XmlDocumentParse, but only skim
+  through the children of the nodes at LazyLevel nest level (0 is root).
+  Their children are parsed on first access, and export reproduces
+  the original text of the nodes never accessed.
+
+  This is designed for large documents, where only a few nodes are
+  accessed, e.g. the kexts in prelinked info.
+
+  @param[in,out]  Buffer     Chunk to be parsed.
+  @param[in]      Length     Size of the buffer.
+  @param[in]      WithRef    TRUE to enable reference lookup support.
+  @param[in]      LazyLevel  Nest level of lazily parsed nodes, must not be 0.
+
+  @warning `Buffer` will be referenced by the document, it may not be freed
+           until XML_DOCUMENT is freed.
+  @warning XmlDocumentFree should be called after completion.
+  @warning `Buffer` contents are permanently modified during parsing
+  @warning Errors in lazily parsed nodes are only discovered on access,
+           such nodes are then treated as having no children.
+
+  @return The parsed xml fragment or NULL.
+**/
+XML_DOCUMENT *
+XmlDocumentParseLazy (
+  IN OUT  CHAR8    *Buffer,
+  IN      UINT32   Length,
+  IN      BOOLEAN  WithRefs,
+  IN      UINT32   LazyLevel
+  );
+
 /**
   Export parsed document into the buffer.
 
@@ -298,6 +382,7 @@ XmlNodePrepend (
 
 /**
   Remove the Index-th child node inside an XML node.
+  Node memory is released with the document.
 
   @param[in,out]  Node        Current node.
   @param[in]      Index       Index-th child node to be removed.
@@ -333,6 +418,36 @@ XmlUnescapeString (
   IN      CONST CHAR8  *String
   );
 
+/**
+  Initialise XML pull parser.
+
+  @param[out]  Parser  XML pull parser context.
+  @param[in]   Buffer  Buffer to be parsed.
+  @param[in]   Length  Size of the buffer.
+**/
+VOID
+XmlPullInit (
+  OUT XML_PULL_PARSER  *Parser,
+  IN  CONST CHAR8      *Buffer,
+  IN  UINT32           Length
+  );
+
+/**
+  Read next XML token. Control sequences and comments are skipped.
+  Unmatched close tags are reported with Level left at 0, so that
+  a fragment of a document can be parsed.
+
+  @param[in,out]  Parser  XML pull parser context.
+  @param[out]     Token   Parsed token.
+
+  @return Token event, XML_PULL_EVENT_END at the end of the buffer.
+**/
+XML_PULL_EVENT
+XmlPullNext (
+  IN OUT XML_PULL_PARSER  *Parser,
+  OUT    XML_PULL_TOKEN   *Token
+  );
+
 /**
   Get the root node of the plist document.
 
@@ -396,6 +511,26 @@ PlistDictChild (
   OUT  XML_NODE        **Value OPTIONAL
   );
 
+/**
+  Find the string value of the first dictionary key with the given name.
+  Unlike other dictionary accessors this does not parse the children
+  of lazy nodes, see XmlDocumentParseLazy.
+
+  @param[in]   Node         A pointer to the plist dictionary.
+  @param[in]   Key          Key name.
+  @param[out]  Value        String value, not null terminated.
+  @param[out]  ValueLength  String value length.
+
+  @return TRUE if the key is found and its value is a non-empty string.
+**/
+BOOLEAN
+PlistDictPeekString (
+  IN   CONST XML_NODE  *Node,
+  IN   CONST CHAR8     *Key,
+  OUT  CONST CHAR8     **Value,
+  OUT  UINT32          *ValueLength
+  );
+
 /**
   Get the value of a plist key.
 
@@ -52,6 +52,7 @@
 #define APPLE_DISK_IMAGE_CHUNK_TYPE_ADC      0x80000004
 #define APPLE_DISK_IMAGE_CHUNK_TYPE_ZLIB     0x80000005
 #define APPLE_DISK_IMAGE_CHUNK_TYPE_BZ2      0x80000006
+#define APPLE_DISK_IMAGE_CHUNK_TYPE_LZFSE    0x80000007
 #define APPLE_DISK_IMAGE_CHUNK_TYPE_COMMENT  0x7FFFFFFE
 #define APPLE_DISK_IMAGE_CHUNK_TYPE_LAST     0xFFFFFFFF
 
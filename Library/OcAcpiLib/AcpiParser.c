@@ -7,6 +7,7 @@
 #include <Uefi.h>
 #include <IndustryStandard/Acpi62.h>
 #include <Library/OcAcpiLib.h>
+#include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
@@ -17,6 +18,191 @@
 
 #include "AcpiParser.h"
 
+//
+// Initial amount of namespace index nodes.
+//
+#define ACPI_NAMESPACE_MIN_NODES  64U
+
+//
+// Minimum amount of namespace index key slots.
+//
+#define ACPI_NAMESPACE_MIN_SLOTS  16U
+
+/**
+  Extends the range of table bytes read while building namespace index.
+
+  @param[in, out] Context Structure containing the parser context.
+**/
+STATIC
+VOID
+IndexAdvance (
+  IN OUT ACPI_PARSER_CONTEXT  *Context
+  )
+{
+  UINT32  Position;
+
+  if (Context->Index != NULL) {
+    Position = (UINT32)(Context->CurrentOpcode - Context->TableStart);
+    if (Position > Context->Index->HighWater) {
+      Context->Index->HighWater = Position;
+    }
+  }
+}
+
+/**
+  Handles parsing table bytes that were already read while building
+  namespace index. This happens when the parser steps back, e.g. to the end
+  of an overrun If or IndexField. Name segments read before are no longer
+  treated as names, as they may be read as opcodes now.
+
+  @param[in, out] Context Structure containing the parser context.
+
+  @retval TRUE   Current opcode was never read before.
+  @retval FALSE  Current opcode is read once again.
+**/
+STATIC
+BOOLEAN
+IndexRevisit (
+  IN OUT ACPI_PARSER_CONTEXT  *Context
+  )
+{
+  OC_ACPI_NAMESPACE_INDEX  *Index;
+  UINT32                   Position;
+
+  Index = Context->Index;
+  if (Index == NULL) {
+    return FALSE;
+  }
+
+  Position = (UINT32)(Context->CurrentOpcode - Context->TableStart);
+  if (Position >= Index->HighWater) {
+    return TRUE;
+  }
+
+  while (Position < Index->HighWater) {
+    Index->NameMap[Position / 8] &= (UINT8) ~(1U << (Position % 8));
+    ++Position;
+  }
+
+  return FALSE;
+}
+
+/**
+  Marks name segments parsed while building namespace index.
+  Their contents are not used for parsing and may change without
+  invalidating the index, e.g. on renaming.
+
+  @param[in, out] Context      Structure containing the parser context.
+  @param[in]      Fresh        Name bytes were never read before.
+  @param[in]      Name         First name segment.
+  @param[in]      NameLength   Amount of name segments.
+**/
+STATIC
+VOID
+IndexAddName (
+  IN OUT ACPI_PARSER_CONTEXT  *Context,
+  IN     BOOLEAN              Fresh,
+  IN     UINT8                *Name,
+  IN     UINT32               NameLength
+  )
+{
+  OC_ACPI_NAMESPACE_INDEX  *Index;
+  UINT32                   Position;
+  UINT32                   End;
+
+  Index = Context->Index;
+  if (Index == NULL) {
+    return;
+  }
+
+  if (Fresh && !Index->Probing) {
+    Position = (UINT32)(Name - Context->TableStart);
+    End      = Position + NameLength * IDENT_LEN;
+    while (Position < End) {
+      Index->NameMap[Position / 8] |= (UINT8)(1U << (Position % 8));
+      ++Position;
+    }
+  }
+
+  IndexAdvance (Context);
+}
+
+/**
+  Records namespace object while building namespace index.
+  Current opcode must be where the parser stops when the object matches.
+
+  @param[in, out] Context     Structure containing the parser context.
+  @param[in]      Kind        Object kind.
+  @param[in]      Result      Pointer to object opcode returned on match.
+  @param[in]      Name        First name segment of object name.
+  @param[in]      NameLength  Amount of name segments.
+  @param[in]      Name2       Second name of field objects, optional.
+  @param[in]      Flags       Node flags.
+
+  @return Recorded node or ACPI_NAMESPACE_NO_NODE.
+**/
+STATIC
+UINT32
+IndexAddNode (
+  IN OUT ACPI_PARSER_CONTEXT  *Context,
+  IN     ACPI_NAMESPACE_KIND  Kind,
+  IN     UINT8                *Result,
+  IN     UINT8                *Name,
+  IN     UINT8                NameLength,
+  IN     UINT8                *Name2  OPTIONAL,
+  IN     UINT8                Flags
+  )
+{
+  OC_ACPI_NAMESPACE_INDEX  *Index;
+  ACPI_NAMESPACE_NODE      *Nodes;
+  ACPI_NAMESPACE_NODE      *Node;
+
+  Index = Context->Index;
+  ASSERT (Index != NULL);
+
+  if (Index->Failed) {
+    return ACPI_NAMESPACE_NO_NODE;
+  }
+
+  if (Index->NumberOfNodes == Index->AllocatedNodes) {
+    Nodes = AllocatePool (
+              MAX (Index->AllocatedNodes * 2, ACPI_NAMESPACE_MIN_NODES) * sizeof (*Nodes)
+              );
+    if (Nodes == NULL) {
+      Index->Failed = TRUE;
+      return ACPI_NAMESPACE_NO_NODE;
+    }
+
+    if (Index->Nodes != NULL) {
+      CopyMem (Nodes, Index->Nodes, Index->NumberOfNodes * sizeof (*Nodes));
+      FreePool (Index->Nodes);
+    }
+
+    Index->Nodes          = Nodes;
+    Index->AllocatedNodes = MAX (Index->AllocatedNodes * 2, ACPI_NAMESPACE_MIN_NODES);
+  }
+
+  if ((UINT32)(Context->CurrentOpcode - Context->TableStart) > Index->ElseEnd) {
+    Flags |= ACPI_NAMESPACE_OVERRUN;
+  }
+
+  Node             = &Index->Nodes[Index->NumberOfNodes];
+  Node->Offset     = (UINT32)(Result - Context->TableStart);
+  Node->Name       = NameLength > 0 ? (UINT32)(Name - Context->TableStart) : 0;
+  Node->Name2      = Name2 != NULL ? (UINT32)(Name2 - Context->TableStart) : 0;
+  Node->Parent     = Index->Parent;
+  Node->Depth      = Index->Parent != ACPI_NAMESPACE_NO_NODE ? Index->Nodes[Index->Parent].Depth + 1 : 0;
+  Node->Kind       = (UINT8)Kind;
+  Node->NameLength = NameLength;
+  Node->Flags      = Flags;
+
+  if (Node->Depth > Index->MaxDepth) {
+    Index->MaxDepth = Node->Depth;
+  }
+
+  return Index->NumberOfNodes++;
+}
+
 /**
   Parses identifier or path (several identifiers). Returns info about
   the identifier / path if necessary.
@@ -39,10 +225,17 @@ ParseNameString (
   IN OUT UINT8                *IsRootPath      OPTIONAL
   )
 {
+  UINT8    *Name;
+  UINT8    NameLength;
+  BOOLEAN  Fresh;
+
   CONTEXT_ENTER (Context, "NameString");
   CONTEXT_HAS_WORK (Context);
   CONTEXT_INCREASE_NESTING (Context);
 
+  Fresh = IndexRevisit (Context);
+  Name  = NULL;
+
   if (IsRootPath != NULL) {
     *IsRootPath = 0;
   }
@@ -62,6 +255,7 @@ ParseNameString (
         *NamePathStart = NULL;
       }
 
+      NameLength              = 0;
       Context->CurrentOpcode += 1;
       break;
 
@@ -74,6 +268,8 @@ ParseNameString (
         *NamePathStart = Context->CurrentOpcode;
       }
 
+      Name                    = Context->CurrentOpcode;
+      NameLength              = 2;
       Context->CurrentOpcode += 2 * IDENT_LEN;
       break;
 
@@ -86,6 +282,8 @@ ParseNameString (
         *NamePathStart = Context->CurrentOpcode + 1;
       }
 
+      Name                    = Context->CurrentOpcode + 1;
+      NameLength              = Context->CurrentOpcode[0];
       Context->CurrentOpcode += 1 + Context->CurrentOpcode[0] * IDENT_LEN;
       break;
 
@@ -97,9 +295,13 @@ ParseNameString (
         *NamePathStart = Context->CurrentOpcode;
       }
 
+      Name                    = Context->CurrentOpcode;
+      NameLength              = 1;
       Context->CurrentOpcode += IDENT_LEN;
   }
 
+  IndexAddName (Context, Fresh, Name, NameLength);
+
   if (NamePathStart != NULL) {
     PRINT_ACPI_NAME ("Read name", *NamePathStart, *PathLength);
   }
@@ -134,6 +336,8 @@ ParsePkgLength (
   CONTEXT_HAS_WORK (Context);
   CONTEXT_INCREASE_NESTING (Context);
 
+  IndexRevisit (Context);
+
   LeadByte  = Context->CurrentOpcode[0];
   TotalSize = 0;
   ByteCount = (LeadByte & 0xC0) >> 6;
@@ -154,6 +358,7 @@ ParsePkgLength (
     *PkgLength = (UINT32)LeadByte;
   }
 
+  IndexAdvance (Context);
   CONTEXT_DECREASE_NESTING (Context);
   return EFI_SUCCESS;
 }
@@ -235,6 +440,7 @@ ParseScopeOrDevice (
   UINT8       Index;
   UINT8       Index2;
   BOOLEAN     Breakout;
+  UINT32      CurrentNode;
 
   CONTEXT_ENTER (Context, "Scope / Device");
   CONTEXT_HAS_WORK (Context);
@@ -242,6 +448,7 @@ ParseScopeOrDevice (
 
   ScopeStart  = Context->CurrentOpcode;
   CurrentPath = Context->CurrentIdentifier;
+  CurrentNode = Context->Index != NULL ? Context->Index->Parent : ACPI_NAMESPACE_NO_NODE;
 
   if (ParsePkgLength (
         Context,
@@ -279,6 +486,23 @@ ParseScopeOrDevice (
     Context->CurrentIdentifier = Context->PathStart;
   }
 
+  if (Context->Index != NULL) {
+    //
+    // Skip matching, lookup state within the scope is evaluated
+    // from the recorded scope names.
+    //
+    Context->Index->Parent = IndexAddNode (
+                               Context,
+                               AcpiNamespaceScope,
+                               ScopeStart - 1,
+                               ScopeName,
+                               ScopeNameLength,
+                               NULL,
+                               IsRootPath ? ACPI_NAMESPACE_ROOT : 0
+                               );
+    ScopeNameLength = 0;
+  }
+
   //
   // Both exit conditions in these loops are for cases when there can be
   // root-relative scopes within the current scope that does not match ours at all.
@@ -336,6 +560,10 @@ ParseScopeOrDevice (
   PRINT_ACPI_NAME ("Left scope", ScopeNameStart, ScopeNameLength);
 
   Context->CurrentIdentifier = CurrentPath;
+  if (Context->Index != NULL) {
+    Context->Index->Parent = CurrentNode;
+  }
+
   CONTEXT_DECREASE_NESTING (Context);
   return EFI_NOT_FOUND;
 }
@@ -458,12 +686,16 @@ ParseBankField (
   OUT UINT8                   **Result
   )
 {
-  UINT32  PkgLength;
-  UINT8   *BankStart;
-  UINT8   *BankEnd;
-  UINT8   *Name;
-  UINT8   NameLength;
-  UINT8   Index;
+  UINT32      PkgLength;
+  UINT8       *BankStart;
+  UINT8       *BankEnd;
+  UINT8       *Name;
+  UINT8       *RegionName;
+  UINT8       NameLength;
+  UINT8       Index;
+  UINT32      Nesting;
+  UINT8       Flags;
+  EFI_STATUS  Status;
 
   CONTEXT_ENTER (Context, "BankField");
   CONTEXT_HAS_WORK (Context);
@@ -505,8 +737,44 @@ ParseBankField (
     return EFI_DEVICE_ERROR;
   }
 
+  if (Context->Index != NULL) {
+    //
+    // Bank name is only parsed when region name matches.
+    // Probe it to know whether such lookups fail.
+    //
+    RegionName              = Name;
+    Nesting                 = Context->Nesting;
+    Context->Index->Probing = TRUE;
+    Status                  = ParseNameString (Context, &Name, &NameLength, NULL);
+    Context->Index->Probing = FALSE;
+    Context->Nesting        = Nesting;
+
+    Flags = 0;
+    if ((Status != EFI_SUCCESS) || (Context->CurrentOpcode > BankEnd) || (NameLength != 1)) {
+      Flags = ACPI_NAMESPACE_UNSAFE;
+    }
+
+    IndexAddNode (
+      Context,
+      AcpiNamespaceBankField,
+      BankStart - 1,
+      RegionName,
+      1,
+      Flags == 0 ? Name : NULL,
+      Flags
+      );
+
+    IndexAdvance (Context);
+    Context->CurrentOpcode = BankEnd;
+    IndexRevisit (Context);
+    CONTEXT_DECREASE_NESTING (Context);
+    return EFI_NOT_FOUND;
+  }
+
   for (Index = 0; Index < IDENT_LEN; ++Index) {
-    if (*(Name + Index) != *((UINT8 *)Context->CurrentIdentifier + (IDENT_LEN - Index - 1))) {
+    if (  (Context->CurrentIdentifier == Context->PathEnd)
+       || (*(Name + Index) != *((UINT8 *)Context->CurrentIdentifier + (IDENT_LEN - Index - 1))))
+    {
       Context->CurrentOpcode = BankEnd;
       CONTEXT_DECREASE_NESTING (Context);
       return EFI_NOT_FOUND;
@@ -608,6 +876,7 @@ ParseCreateField (
   UINT8    *FieldStart;
   UINT8    *FieldOpcode;
   UINT8    *Name;
+  UINT8    *SourceName;
   UINT8    NameLength;
   UINT8    Index;
   BOOLEAN  Matched;
@@ -664,9 +933,12 @@ ParseCreateField (
         return EFI_DEVICE_ERROR;
       }
 
-      Matched = TRUE;
+      SourceName = Name;
+      Matched    = TRUE;
       for (Index = 0; Index < IDENT_LEN; Index++) {
-        if (*(Name + Index) != *((UINT8 *)Context->CurrentIdentifier + (IDENT_LEN - Index - 1))) {
+        if (  (Context->CurrentIdentifier == Context->PathEnd)
+           || (*(Name + Index) != *((UINT8 *)Context->CurrentIdentifier + (IDENT_LEN - Index - 1))))
+        {
           Matched = FALSE;
           break;
         }
@@ -717,6 +989,20 @@ ParseCreateField (
         return EFI_DEVICE_ERROR;
       }
 
+      if (Context->Index != NULL) {
+        IndexAddNode (
+          Context,
+          AcpiNamespaceCreateField,
+          FieldStart - 1,
+          SourceName,
+          1,
+          Name,
+          0
+          );
+        CONTEXT_DECREASE_NESTING (Context);
+        return EFI_NOT_FOUND;
+      }
+
       if (!Matched) {
         CONTEXT_DECREASE_NESTING (Context);
         return EFI_NOT_FOUND;
@@ -724,6 +1010,15 @@ ParseCreateField (
 
       Context->CurrentIdentifier += 1;
 
+      //
+      // Field name is the last one in the path, nothing to compare it to.
+      //
+      if (Context->CurrentIdentifier == Context->PathEnd) {
+        CONTEXT_DECREASE_NESTING (Context);
+        Context->CurrentIdentifier--;
+        return EFI_NOT_FOUND;
+      }
+
       for (Index = 0; Index < IDENT_LEN; Index++) {
         if (*(Name + Index) != *((UINT8 *)Context->CurrentIdentifier + (IDENT_LEN - Index - 1))) {
           CONTEXT_DECREASE_NESTING (Context);
@@ -1240,6 +1535,21 @@ ParseMethod (
     return EFI_DEVICE_ERROR;
   }
 
+  if (Context->Index != NULL) {
+    IndexAddNode (
+      Context,
+      AcpiNamespaceMethod,
+      MethodStart - 1,
+      MethodName,
+      MethodNameLength,
+      NULL,
+      0
+      );
+    Context->CurrentOpcode = MethodEnd;
+    CONTEXT_DECREASE_NESTING (Context);
+    return EFI_NOT_FOUND;
+  }
+
   for (Index = 0; Index < MethodNameLength; ++Index) {
     //
     // If the method is within our lookup path but not at it, this is not a match.
@@ -1307,6 +1617,8 @@ ParseIfElse (
   UINT32      *CurrentPath;
   UINT8       *IfEnd;
   EFI_STATUS  Status;
+  UINT32      CurrentNode;
+  UINT32      ElseEnd;
 
   CONTEXT_ENTER (Context, "IfElse");
   CONTEXT_HAS_WORK (Context);
@@ -1314,6 +1626,7 @@ ParseIfElse (
 
   IfStart     = Context->CurrentOpcode;
   CurrentPath = Context->CurrentIdentifier;
+  CurrentNode = Context->Index != NULL ? Context->Index->Parent : ACPI_NAMESPACE_NO_NODE;
 
   if (ParsePkgLength (
         Context,
@@ -1350,10 +1663,15 @@ ParseIfElse (
   }
 
   if (Context->CurrentOpcode > IfEnd) {
+    IndexAdvance (Context);
     Context->CurrentOpcode = IfEnd;
+    IndexRevisit (Context);
   }
 
   Context->CurrentIdentifier = CurrentPath;
+  if (Context->Index != NULL) {
+    Context->Index->Parent = CurrentNode;
+  }
 
   CONTEXT_PEEK_BYTES (Context, 1);
 
@@ -1375,6 +1693,15 @@ ParseIfElse (
 
     IfEnd = IfStart + PkgLength;
 
+    //
+    // Matches stopping past Else end are reported as errors below.
+    //
+    ElseEnd = MAX_UINT32;
+    if (Context->Index != NULL) {
+      ElseEnd                 = Context->Index->ElseEnd;
+      Context->Index->ElseEnd = MIN (ElseEnd, (UINT32)(IfEnd - Context->TableStart));
+    }
+
     //
     // FIXME: This is broken like hell.
     //
@@ -1386,6 +1713,10 @@ ParseIfElse (
       }
     }
 
+    if (Context->Index != NULL) {
+      Context->Index->ElseEnd = ElseEnd;
+    }
+
     if ((Context->CurrentOpcode > IfEnd) || (Status == EFI_DEVICE_ERROR)) {
       return EFI_DEVICE_ERROR;
     }
@@ -1396,6 +1727,9 @@ ParseIfElse (
     }
 
     Context->CurrentIdentifier = CurrentPath;
+    if (Context->Index != NULL) {
+      Context->Index->Parent = CurrentNode;
+    }
   }
 
   CONTEXT_DECREASE_NESTING (Context);
@@ -1502,6 +1836,21 @@ ParseField (
     return EFI_DEVICE_ERROR;
   }
 
+  if (Context->Index != NULL) {
+    IndexAddNode (
+      Context,
+      AcpiNamespaceField,
+      FieldStart - 1,
+      FieldName,
+      FieldNameLength,
+      NULL,
+      0
+      );
+    Context->CurrentOpcode = FieldEnd;
+    CONTEXT_DECREASE_NESTING (Context);
+    return EFI_NOT_FOUND;
+  }
+
   CurrentPath = Context->CurrentIdentifier;
 
   for (Index = 0; Index < FieldNameLength; Index++) {
@@ -1603,6 +1952,7 @@ ParseIndexField (
   UINT32  PkgLength;
   UINT8   *FieldEnd;
   UINT8   *FieldName;
+  UINT8   *IndexName;
   UINT8   FieldNameLength;
   UINT8   Index;
 
@@ -1648,8 +1998,43 @@ ParseIndexField (
     return EFI_DEVICE_ERROR;
   }
 
+  if (Context->Index != NULL) {
+    IndexName = FieldName;
+
+    if (ParseNameString (
+          Context,
+          &FieldName,
+          &FieldNameLength,
+          NULL
+          ) != EFI_SUCCESS)
+    {
+      return EFI_DEVICE_ERROR;
+    }
+
+    //
+    // Data register name is only checked when index register name matches.
+    //
+    IndexAddNode (
+      Context,
+      AcpiNamespaceIndexField,
+      FieldStart - 1,
+      IndexName,
+      1,
+      FieldNameLength == 1 ? FieldName : NULL,
+      (Context->CurrentOpcode >= FieldEnd || FieldNameLength != 1) ? ACPI_NAMESPACE_UNSAFE : 0
+      );
+
+    IndexAdvance (Context);
+    Context->CurrentOpcode = FieldEnd;
+    IndexRevisit (Context);
+    CONTEXT_DECREASE_NESTING (Context);
+    return EFI_NOT_FOUND;
+  }
+
   for (Index = 0; Index < IDENT_LEN; ++Index) {
-    if (*(FieldName + Index) != *((UINT8 *)Context->CurrentIdentifier + (IDENT_LEN - Index - 1))) {
+    if (  (Context->CurrentIdentifier == Context->PathEnd)
+       || (*(FieldName + Index) != *((UINT8 *)Context->CurrentIdentifier + (IDENT_LEN - Index - 1))))
+    {
       if (ParseNameString (
             Context,
             &FieldName,
@@ -1737,6 +2122,8 @@ InternalAcpiParseTerm (
   ASSERT (Result != NULL);
   CONTEXT_INCREASE_NESTING (Context);
 
+  IndexRevisit (Context);
+
   DEBUG ((DEBUG_VERBOSE, "Opcode: %x\n", Context->CurrentOpcode[0]));
 
   switch (Context->CurrentOpcode[0]) {
@@ -2017,6 +2404,44 @@ ClearContext (
   ZeroMem (Context, sizeof (*Context));
 }
 
+/**
+  Validates ACPI table length for lookup.
+
+  @param[in]     Table       Pointer to start of ACPI table.
+  @param[in,out] TableLength Length of ACPI table, 0 to read it from the header.
+
+  @retval EFI_SUCCESS      Table length is suitable for lookup.
+  @retval EFI_LOAD_ERROR   Table length is too small to have length field.
+  @retval EFI_DEVICE_ERROR Table has no contents.
+**/
+STATIC
+EFI_STATUS
+GetTableLength (
+  IN     UINT8   *Table,
+  IN OUT UINT32  *TableLength
+  )
+{
+  if (*TableLength > 0) {
+    if (*TableLength < sizeof (EFI_ACPI_COMMON_HEADER)) {
+      DEBUG ((DEBUG_VERBOSE, "OCA: Got bad table format which does not specify its length!\n"));
+      return EFI_LOAD_ERROR;
+    }
+
+    //
+    // We do not check length here, mainly because TableLength > 0 is for fuzzing.
+    //
+  } else {
+    *TableLength = ((EFI_ACPI_COMMON_HEADER *)Table)->Length;
+  }
+
+  if (*TableLength <= sizeof (EFI_ACPI_DESCRIPTION_HEADER)) {
+    DEBUG ((DEBUG_VERBOSE, "OCA: Bad or unsupported table header!\n"));
+    return EFI_DEVICE_ERROR;
+  }
+
+  return EFI_SUCCESS;
+}
+
 EFI_STATUS
 AcpiFindEntryInMemory (
   IN     UINT8        *Table,
@@ -2034,22 +2459,9 @@ AcpiFindEntryInMemory (
   ASSERT (PathString != NULL);
   ASSERT (Offset != NULL);
 
-  if (TableLength > 0) {
-    if (TableLength < sizeof (EFI_ACPI_COMMON_HEADER)) {
-      DEBUG ((DEBUG_VERBOSE, "OCA: Got bad table format which does not specify its length!\n"));
-      return EFI_LOAD_ERROR;
-    }
-
-    //
-    // We do not check length here, mainly because TableLength > 0 is for fuzzing.
-    //
-  } else {
-    TableLength = ((EFI_ACPI_COMMON_HEADER *)Table)->Length;
-  }
-
-  if (TableLength <= sizeof (EFI_ACPI_DESCRIPTION_HEADER)) {
-    DEBUG ((DEBUG_VERBOSE, "OCA: Bad or unsupported table header!\n"));
-    return EFI_DEVICE_ERROR;
+  Status = GetTableLength (Table, &TableLength);
+  if (EFI_ERROR (Status)) {
+    return Status;
   }
 
   InitContext (&Context);
@@ -2088,3 +2500,737 @@ AcpiFindEntryInMemory (
   ClearContext (&Context);
   return EFI_NOT_FOUND;
 }
+
+/**
+  Reads name segment from the table in lookup path encoding.
+
+  @param[in] Table   Pointer to start of ACPI table.
+  @param[in] Offset  Offset of the name segment.
+
+  @return Name segment suitable for comparison with GetOpcodeArray output.
+**/
+STATIC
+UINT32
+IndexReadName (
+  IN CONST UINT8  *Table,
+  IN UINT32       Offset
+  )
+{
+  return ((UINT32)Table[Offset] << 24U)
+         | ((UINT32)Table[Offset + 1] << 16U)
+         | ((UINT32)Table[Offset + 2] << 8U)
+         | Table[Offset + 3];
+}
+
+/**
+  Returns key slot for name segment.
+
+  @param[in] Index  Namespace index.
+  @param[in] Name   Name segment.
+
+  @return Slot number.
+**/
+STATIC
+UINT32
+IndexNameSlot (
+  IN CONST OC_ACPI_NAMESPACE_INDEX  *Index,
+  IN UINT32                         Name
+  )
+{
+  UINT32  Hash;
+
+  Hash  = Name * 0x9E3779B1U;
+  Hash ^= Hash >> 16U;
+  return Hash & Index->SlotMask;
+}
+
+/**
+  Calculates digest of the table bytes the namespace index depends on.
+  Name segments only contribute characters the parser could read as
+  name prefixes or create field arguments, so renaming objects keeps
+  the digest.
+
+  @param[in] Index  Namespace index.
+  @param[in] Table  Pointer to start of ACPI table.
+
+  @return Table digest.
+**/
+STATIC
+UINT64
+IndexDigest (
+  IN CONST OC_ACPI_NAMESPACE_INDEX  *Index,
+  IN CONST UINT8                    *Table
+  )
+{
+  UINT64  Digest;
+  UINT32  Position;
+  UINT8   Byte;
+
+  //
+  // FNV-1a. Header contents are never parsed.
+  //
+  Digest = 0xCBF29CE484222325ULL;
+  for (Position = sizeof (EFI_ACPI_DESCRIPTION_HEADER); Position < Index->TableLength; ++Position) {
+    Byte = Table[Position];
+    if ((Index->NameMap[Position / 8] & (1U << (Position % 8))) != 0) {
+      switch (Byte) {
+        case AML_ZERO_OP:
+        case AML_DUAL_NAME_PREFIX:
+        case AML_MULTI_NAME_PREFIX:
+        case AML_ROOT_CHAR:
+        case AML_PARENT_PREFIX_CHAR:
+        case AML_ARG0:
+        case AML_ARG1:
+        case AML_ARG2:
+        case AML_ARG3:
+        case AML_ARG4:
+        case AML_ARG5:
+        case AML_ARG6:
+          break;
+
+        default:
+          Byte = AML_NAME_CHAR__;
+          break;
+      }
+    }
+
+    Digest = MultU64x64 (Digest ^ Byte, 0x100000001B3ULL);
+  }
+
+  return Digest;
+}
+
+/**
+  Builds name keys of namespace index from current object names.
+
+  @param[in,out] Index  Namespace index.
+**/
+STATIC
+VOID
+IndexRekey (
+  IN OUT OC_ACPI_NAMESPACE_INDEX  *Index
+  )
+{
+  ACPI_NAMESPACE_NODE  *Node;
+  ACPI_NAMESPACE_KEY   *Key;
+  UINT32               NodeIndex;
+  UINT32               KeyIndex;
+  UINT32               Slot;
+  UINT32               Name;
+
+  Index->NumberOfKeys = 0;
+
+  for (NodeIndex = 0; NodeIndex < Index->NumberOfNodes; ++NodeIndex) {
+    Node = &Index->Nodes[NodeIndex];
+    Key  = &Index->Keys[Index->NumberOfKeys];
+
+    switch (Node->Kind) {
+      case AcpiNamespaceScope:
+      case AcpiNamespaceMethod:
+      case AcpiNamespaceField:
+        //
+        // Objects match by their last name segment.
+        //
+        if (Node->NameLength > 0) {
+          Key->Name = IndexReadName (Index->Table, Node->Name + (Node->NameLength - 1) * IDENT_LEN);
+          Key->Node = NodeIndex;
+          ++Index->NumberOfKeys;
+        }
+
+        break;
+
+      case AcpiNamespaceIndexField:
+        //
+        // Index fields match by data register name, but fail when
+        // index register name is the last one in the path.
+        //
+        Name = IndexReadName (Index->Table, Node->Name);
+        if (Node->Name2 != 0) {
+          Key->Name = IndexReadName (Index->Table, Node->Name2);
+          Key->Node = NodeIndex;
+          ++Index->NumberOfKeys;
+          ++Key;
+        }
+
+        if ((Node->Name2 == 0) || (Name != Key[-1].Name)) {
+          Key->Name = Name;
+          Key->Node = NodeIndex;
+          ++Index->NumberOfKeys;
+        }
+
+        break;
+
+      case AcpiNamespaceBankField:
+        //
+        // Bank fields match by bank name, unsafe ones are found by region name.
+        //
+        if (Node->Name2 != 0) {
+          Key->Name = IndexReadName (Index->Table, Node->Name2);
+          Key->Node = NodeIndex;
+          ++Index->NumberOfKeys;
+        } else {
+          Key->Name = IndexReadName (Index->Table, Node->Name);
+          Key->Node = NodeIndex;
+          ++Index->NumberOfKeys;
+        }
+
+        break;
+
+      case AcpiNamespaceCreateField:
+        Key->Name = IndexReadName (Index->Table, Node->Name2);
+        Key->Node = NodeIndex;
+        ++Index->NumberOfKeys;
+        break;
+
+      default:
+        ASSERT (FALSE);
+        break;
+    }
+  }
+
+  for (Slot = 0; Slot <= Index->SlotMask; ++Slot) {
+    Index->Slots[Slot] = ACPI_NAMESPACE_NO_NODE;
+  }
+
+  //
+  // Insert in reverse to keep every chain in parsing order.
+  //
+  for (KeyIndex = Index->NumberOfKeys; KeyIndex > 0; --KeyIndex) {
+    Key                = &Index->Keys[KeyIndex - 1];
+    Slot               = IndexNameSlot (Index, Key->Name);
+    Key->Next          = Index->Slots[Slot];
+    Index->Slots[Slot] = KeyIndex - 1;
+  }
+}
+
+/**
+  Frees namespace index contents.
+
+  @param[in,out] Index  Namespace index.
+**/
+STATIC
+VOID
+IndexReset (
+  IN OUT OC_ACPI_NAMESPACE_INDEX  *Index
+  )
+{
+  if (Index->NameMap != NULL) {
+    FreePool (Index->NameMap);
+  }
+
+  if (Index->Nodes != NULL) {
+    FreePool (Index->Nodes);
+  }
+
+  if (Index->Keys != NULL) {
+    FreePool (Index->Keys);
+  }
+
+  if (Index->Slots != NULL) {
+    FreePool (Index->Slots);
+  }
+
+  if (Index->Chain != NULL) {
+    FreePool (Index->Chain);
+  }
+
+  ZeroMem (Index, sizeof (*Index));
+}
+
+/**
+  Builds namespace index by parsing the whole table once.
+
+  @param[in,out] Index       Namespace index.
+  @param[in]     Table       Pointer to start of ACPI table.
+  @param[in]     TableLength Length of ACPI table.
+
+  @retval TRUE on success.
+**/
+STATIC
+BOOLEAN
+IndexBuild (
+  IN OUT OC_ACPI_NAMESPACE_INDEX  *Index,
+  IN     UINT8                    *Table,
+  IN     UINT32                   TableLength
+  )
+{
+  ACPI_PARSER_CONTEXT  Context;
+  EFI_STATUS           Status;
+  UINT8                *Result;
+  UINT32               Path;
+  UINT32               NumberOfSlots;
+
+  IndexReset (Index);
+
+  Index->Table       = Table;
+  Index->TableLength = TableLength;
+  Index->Parent      = ACPI_NAMESPACE_NO_NODE;
+  Index->ElseEnd     = MAX_UINT32;
+  Index->NameMap     = AllocateZeroPool ((TableLength + 7) / 8);
+  if (Index->NameMap == NULL) {
+    Index->Failed = TRUE;
+    return FALSE;
+  }
+
+  //
+  // Path contents are irrelevant, no matching happens while indexing.
+  //
+  Path = 0;
+
+  InitContext (&Context);
+
+  Context.CurrentOpcode     = Table + sizeof (EFI_ACPI_DESCRIPTION_HEADER);
+  Context.TableStart        = Table;
+  Context.TableEnd          = Table + TableLength;
+  Context.PathStart         = &Path;
+  Context.CurrentIdentifier = &Path;
+  Context.PathEnd           = &Path + 1;
+  Context.RequiredEntry     = 1;
+  Context.Index             = Index;
+
+  Status = EFI_NOT_FOUND;
+  while (Status == EFI_NOT_FOUND && Context.CurrentOpcode < Context.TableEnd) {
+    Status = InternalAcpiParseTerm (&Context, &Result);
+  }
+
+  ASSERT (Status != EFI_SUCCESS);
+
+  //
+  // Context path is not allocated and must not be freed.
+  //
+  Index->Status = Status;
+
+  if (!Index->Failed) {
+    NumberOfSlots = ACPI_NAMESPACE_MIN_SLOTS;
+    while (NumberOfSlots < Index->NumberOfNodes * 4) {
+      NumberOfSlots *= 2;
+    }
+
+    Index->SlotMask = NumberOfSlots - 1;
+    Index->Keys     = AllocatePool (MAX (Index->NumberOfNodes * 2, 1) * sizeof (*Index->Keys));
+    Index->Slots    = AllocatePool (NumberOfSlots * sizeof (*Index->Slots));
+    Index->Chain    = AllocatePool ((Index->MaxDepth + 1) * sizeof (*Index->Chain));
+    Index->Failed   = Index->Keys == NULL || Index->Slots == NULL || Index->Chain == NULL;
+  }
+
+  if (Index->Failed) {
+    DEBUG ((DEBUG_INFO, "OCA: Failed to allocate namespace index\n"));
+    return FALSE;
+  }
+
+  Index->Digest = IndexDigest (Index, Table);
+  IndexRekey (Index);
+  Index->Valid = TRUE;
+
+  DEBUG ((
+    DEBUG_VERBOSE,
+    "OCA: Indexed %u objects in %u byte table - %r\n",
+    Index->NumberOfNodes,
+    TableLength,
+    Index->Status
+    ));
+
+  return TRUE;
+}
+
+/**
+  Ensures namespace index describes the table.
+
+  @param[in,out] Index       Namespace index.
+  @param[in]     Table       Pointer to start of ACPI table.
+  @param[in]     TableLength Length of ACPI table.
+
+  @retval TRUE when the index can be used.
+**/
+STATIC
+BOOLEAN
+IndexRefresh (
+  IN OUT OC_ACPI_NAMESPACE_INDEX  *Index,
+  IN     UINT8                    *Table,
+  IN     UINT32                   TableLength
+  )
+{
+  if (Index->Valid && (Index->TableLength == TableLength)) {
+    if ((Index->Table == Table) && !Index->Dirty) {
+      return TRUE;
+    }
+
+    //
+    // Renamed objects keep the table structure, only names need rehashing.
+    //
+    if (IndexDigest (Index, Table) == Index->Digest) {
+      Index->Table = Table;
+      Index->Dirty = FALSE;
+      IndexRekey (Index);
+      return TRUE;
+    }
+  }
+
+  //
+  // Do not retry after running out of memory, the parser works regardless.
+  //
+  if (Index->Failed) {
+    return FALSE;
+  }
+
+  return IndexBuild (Index, Table, TableLength);
+}
+
+/**
+  Evaluates lookup state after entering scope node names.
+
+  @param[in] Index       Namespace index.
+  @param[in] Path        Lookup path.
+  @param[in] PathLength  Amount of lookup path segments.
+  @param[in] State       Lookup state (matched path segments) of the scope.
+  @param[in] NodeIndex   Scope node.
+
+  @return Matched path segments, PathLength when the scope matches.
+**/
+STATIC
+UINT32
+IndexEnterScope (
+  IN CONST OC_ACPI_NAMESPACE_INDEX  *Index,
+  IN CONST UINT32                   *Path,
+  IN UINT32                         PathLength,
+  IN UINT32                         State,
+  IN UINT32                         NodeIndex
+  )
+{
+  CONST ACPI_NAMESPACE_NODE  *Node;
+  UINT32                     Segment;
+
+  Node = &Index->Nodes[NodeIndex];
+
+  if ((Node->Flags & ACPI_NAMESPACE_ROOT) != 0) {
+    State = 0;
+  }
+
+  for (Segment = 0; Segment < Node->NameLength; ++Segment) {
+    if (  (State == PathLength)
+       || (IndexReadName (Index->Table, Node->Name + Segment * IDENT_LEN) != Path[State]))
+    {
+      return 0;
+    }
+
+    ++State;
+  }
+
+  return State;
+}
+
+/**
+  Evaluates lookup state of the objects parsed right within node parent.
+
+  @param[in] Index       Namespace index.
+  @param[in] Path        Lookup path.
+  @param[in] PathLength  Amount of lookup path segments.
+  @param[in] NodeIndex   Node to get the state for.
+
+  @return Matched path segments.
+**/
+STATIC
+UINT32
+IndexNodeState (
+  IN CONST OC_ACPI_NAMESPACE_INDEX  *Index,
+  IN CONST UINT32                   *Path,
+  IN UINT32                         PathLength,
+  IN UINT32                         NodeIndex
+  )
+{
+  UINT32  Depth;
+  UINT32  State;
+
+  Depth     = 0;
+  NodeIndex = Index->Nodes[NodeIndex].Parent;
+  while (NodeIndex != ACPI_NAMESPACE_NO_NODE) {
+    ASSERT (Depth <= Index->MaxDepth);
+    Index->Chain[Depth++] = NodeIndex;
+    NodeIndex             = Index->Nodes[NodeIndex].Parent;
+  }
+
+  State = 0;
+  while (Depth > 0) {
+    State = IndexEnterScope (Index, Path, PathLength, State, Index->Chain[--Depth]);
+    if (State == PathLength) {
+      //
+      // Matching scope restarts the search within it.
+      //
+      State = 0;
+    }
+  }
+
+  return State;
+}
+
+/**
+  Checks whether namespace index node is matched by lookup path,
+  replicating the parser decisions for the node.
+
+  @param[in] Index       Namespace index.
+  @param[in] Path        Lookup path.
+  @param[in] PathLength  Amount of lookup path segments.
+  @param[in] NodeIndex   Node to check.
+
+  @retval EFI_SUCCESS      Node matches.
+  @retval EFI_NOT_FOUND    Node does not match.
+  @retval EFI_UNSUPPORTED  Parser would fail on this node.
+**/
+STATIC
+EFI_STATUS
+IndexMatchNode (
+  IN CONST OC_ACPI_NAMESPACE_INDEX  *Index,
+  IN CONST UINT32                   *Path,
+  IN UINT32                         PathLength,
+  IN UINT32                         NodeIndex
+  )
+{
+  CONST ACPI_NAMESPACE_NODE  *Node;
+  UINT32                     State;
+  UINT32                     Segment;
+
+  Node  = &Index->Nodes[NodeIndex];
+  State = IndexNodeState (Index, Path, PathLength, NodeIndex);
+
+  switch (Node->Kind) {
+    case AcpiNamespaceScope:
+      State = IndexEnterScope (Index, Path, PathLength, State, NodeIndex);
+      return State == PathLength ? EFI_SUCCESS : EFI_NOT_FOUND;
+
+    case AcpiNamespaceMethod:
+    case AcpiNamespaceField:
+      for (Segment = 0; Segment < Node->NameLength; ++Segment) {
+        if (  (State == PathLength)
+           || (IndexReadName (Index->Table, Node->Name + Segment * IDENT_LEN) != Path[State]))
+        {
+          return EFI_NOT_FOUND;
+        }
+
+        ++State;
+      }
+
+      return State == PathLength ? EFI_SUCCESS : EFI_NOT_FOUND;
+
+    case AcpiNamespaceIndexField:
+      if (  (State == PathLength)
+         || (IndexReadName (Index->Table, Node->Name) != Path[State]))
+      {
+        return EFI_NOT_FOUND;
+      }
+
+      if ((State + 1 == PathLength) || ((Node->Flags & ACPI_NAMESPACE_UNSAFE) != 0)) {
+        return EFI_UNSUPPORTED;
+      }
+
+      break;
+
+    case AcpiNamespaceBankField:
+      if (  (State == PathLength)
+         || (IndexReadName (Index->Table, Node->Name) != Path[State]))
+      {
+        return EFI_NOT_FOUND;
+      }
+
+      if ((Node->Flags & ACPI_NAMESPACE_UNSAFE) != 0) {
+        return EFI_UNSUPPORTED;
+      }
+
+      if (State + 1 == PathLength) {
+        return EFI_NOT_FOUND;
+      }
+
+      break;
+
+    case AcpiNamespaceCreateField:
+      if (  (State == PathLength)
+         || (IndexReadName (Index->Table, Node->Name) != Path[State])
+         || (State + 1 == PathLength))
+      {
+        return EFI_NOT_FOUND;
+      }
+
+      break;
+
+    default:
+      ASSERT (FALSE);
+      return EFI_UNSUPPORTED;
+  }
+
+  //
+  // Field objects match by two names.
+  //
+  if (IndexReadName (Index->Table, Node->Name2) != Path[State + 1]) {
+    return EFI_NOT_FOUND;
+  }
+
+  return State + 2 == PathLength ? EFI_SUCCESS : EFI_NOT_FOUND;
+}
+
+/**
+  Finds required entry in namespace index.
+
+  @param[in]  Index       Namespace index.
+  @param[in]  Path        Lookup path.
+  @param[in]  PathLength  Amount of lookup path segments.
+  @param[in]  Entry       Number of entry which must be found.
+  @param[out] Offset      Offset of the entry if it was found.
+
+  @retval EFI_SUCCESS      Required entry was found.
+  @retval EFI_UNSUPPORTED  Lookup must be done by the parser.
+  @retval other            Status the parser would return.
+**/
+STATIC
+EFI_STATUS
+IndexLookup (
+  IN  CONST OC_ACPI_NAMESPACE_INDEX  *Index,
+  IN  CONST UINT32                   *Path,
+  IN  UINT32                         PathLength,
+  IN  UINT8                          Entry,
+  OUT UINT32                         *Offset
+  )
+{
+  EFI_STATUS                 Status;
+  CONST ACPI_NAMESPACE_NODE  *Node;
+  CONST ACPI_NAMESPACE_KEY   *Key;
+  UINT32                     KeyIndex;
+  UINT32                     LastNode;
+  UINT32                     Segment;
+  UINT32                     Found;
+
+  //
+  // Objects failing to parse on a match change parser state in ways
+  // not worth replicating. Leave such lookups to the parser.
+  //
+  for (Segment = 0; Segment < PathLength; ++Segment) {
+    KeyIndex = Index->Slots[IndexNameSlot (Index, Path[Segment])];
+    while (KeyIndex != ACPI_NAMESPACE_NO_NODE) {
+      Key  = &Index->Keys[KeyIndex];
+      Node = &Index->Nodes[Key->Node];
+      if (  ((Node->Flags & ACPI_NAMESPACE_UNSAFE) != 0)
+         && (IndexReadName (Index->Table, Node->Name) == Path[Segment]))
+      {
+        return EFI_UNSUPPORTED;
+      }
+
+      KeyIndex = Key->Next;
+    }
+  }
+
+  Found    = 0;
+  LastNode = ACPI_NAMESPACE_NO_NODE;
+  KeyIndex = Index->Slots[IndexNameSlot (Index, Path[PathLength - 1])];
+  while (KeyIndex != ACPI_NAMESPACE_NO_NODE) {
+    Key      = &Index->Keys[KeyIndex];
+    KeyIndex = Key->Next;
+
+    if ((Key->Name != Path[PathLength - 1]) || (Key->Node == LastNode)) {
+      continue;
+    }
+
+    LastNode = Key->Node;
+    Status   = IndexMatchNode (Index, Path, PathLength, Key->Node);
+    if (Status == EFI_UNSUPPORTED) {
+      return Status;
+    }
+
+    if (!EFI_ERROR (Status)) {
+      ++Found;
+      if (Found == Entry) {
+        Node = &Index->Nodes[Key->Node];
+        if ((Node->Flags & ACPI_NAMESPACE_OVERRUN) != 0) {
+          return EFI_UNSUPPORTED;
+        }
+
+        *Offset = Node->Offset;
+        return EFI_SUCCESS;
+      }
+    }
+  }
+
+  //
+  // Fewer matches than required, parser would walk the whole table.
+  //
+  return Index->Status;
+}
+
+EFI_STATUS
+AcpiFindEntryInIndex (
+  IN OUT OC_ACPI_NAMESPACE_INDEX  **Index,
+  IN     UINT8                    *Table,
+  IN     CONST CHAR8              *PathString,
+  IN     UINT8                    Entry,
+  OUT UINT32                      *Offset,
+  IN     UINT32                   TableLength OPTIONAL
+  )
+{
+  EFI_STATUS           Status;
+  ACPI_PARSER_CONTEXT  Context;
+
+  ASSERT (Index != NULL);
+  ASSERT (Table != NULL);
+  ASSERT (PathString != NULL);
+  ASSERT (Offset != NULL);
+
+  Status = GetTableLength (Table, &TableLength);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if (*Index == NULL) {
+    *Index = AllocateZeroPool (sizeof (**Index));
+  }
+
+  //
+  // Entry 0 is never found and requires reporting the parsing status,
+  // leave it to the parser like any other lookup the index cannot serve.
+  //
+  if ((*Index == NULL) || (Entry == 0) || !IndexRefresh (*Index, Table, TableLength)) {
+    return AcpiFindEntryInMemory (Table, PathString, Entry, Offset, TableLength);
+  }
+
+  InitContext (&Context);
+
+  Status = GetOpcodeArray (
+             &Context,
+             PathString
+             );
+
+  if (!EFI_ERROR (Status)) {
+    Status = IndexLookup (
+               *Index,
+               Context.PathStart,
+               (UINT32)(Context.PathEnd - Context.PathStart),
+               Entry,
+               Offset
+               );
+  }
+
+  ClearContext (&Context);
+
+  if (Status == EFI_UNSUPPORTED) {
+    return AcpiFindEntryInMemory (Table, PathString, Entry, Offset, TableLength);
+  }
+
+  return Status;
+}
+
+VOID
+AcpiInvalidateNamespaceIndex (
+  IN OUT OC_ACPI_NAMESPACE_INDEX  *Index
+  )
+{
+  ASSERT (Index != NULL);
+
+  Index->Dirty = TRUE;
+}
+
+VOID
+AcpiFreeNamespaceIndex (
+  IN OC_ACPI_NAMESPACE_INDEX  *Index
+  )
+{
+  ASSERT (Index != NULL);
+
+  IndexReset (Index);
+  FreePool (Index);
+}
@@ -6,46 +6,201 @@
 #ifndef ACPI_PARSER_H
 #define ACPI_PARSER_H
 
+///
+/// Namespace object kinds recorded in the namespace index.
+///
+typedef enum {
+  AcpiNamespaceScope,
+  AcpiNamespaceMethod,
+  AcpiNamespaceField,
+  AcpiNamespaceIndexField,
+  AcpiNamespaceBankField,
+  AcpiNamespaceCreateField
+} ACPI_NAMESPACE_KIND;
+
+///
+/// Object name had a root prefix, lookup restarts from the path start.
+///
+#define ACPI_NAMESPACE_ROOT  BIT0
+///
+/// Object would fail parsing had its first name matched the lookup path.
+/// Lookups that may reach this object fall back to the parser.
+///
+#define ACPI_NAMESPACE_UNSAFE  BIT1
+///
+/// Object name ends past an enclosing Else, the parser reports its match as an error.
+///
+#define ACPI_NAMESPACE_OVERRUN  BIT2
+
+///
+/// No node, i.e. the top level of the table.
+///
+#define ACPI_NAMESPACE_NO_NODE  MAX_UINT32
+
+typedef struct {
+  ///
+  /// Offset of the object returned when it matches.
+  ///
+  UINT32    Offset;
+  ///
+  /// Offset of the first name segment of the object name.
+  ///
+  UINT32    Name;
+  ///
+  /// Offset of the second name for field objects.
+  ///
+  UINT32    Name2;
+  ///
+  /// Scope node providing the lookup state for this object.
+  ///
+  UINT32    Parent;
+  ///
+  /// Amount of scope nodes above this one.
+  ///
+  UINT32    Depth;
+  ///
+  /// Object kind, ACPI_NAMESPACE_KIND.
+  ///
+  UINT8     Kind;
+  ///
+  /// Amount of name segments in the object name.
+  ///
+  UINT8     NameLength;
+  ///
+  /// Node flags, ACPI_NAMESPACE_ROOT, ACPI_NAMESPACE_UNSAFE or ACPI_NAMESPACE_OVERRUN.
+  ///
+  UINT8     Flags;
+} ACPI_NAMESPACE_NODE;
+
+typedef struct {
+  ///
+  /// Name segment in lookup path encoding.
+  ///
+  UINT32    Name;
+  ///
+  /// Node with this name segment.
+  ///
+  UINT32    Node;
+  ///
+  /// Next key in the same slot or ACPI_NAMESPACE_NO_NODE.
+  ///
+  UINT32    Next;
+} ACPI_NAMESPACE_KEY;
+
+struct OC_ACPI_NAMESPACE_INDEX_ {
+  ///
+  /// Table this index was built for.
+  ///
+  UINT8                  *Table;
+  ///
+  /// Length of the table this index was built for.
+  ///
+  UINT32                 TableLength;
+  ///
+  /// Index was built and describes Table.
+  ///
+  BOOLEAN                Valid;
+  ///
+  /// Table contents were modified since the last lookup.
+  ///
+  BOOLEAN                Dirty;
+  ///
+  /// Status the parser would return after walking the whole table.
+  ///
+  EFI_STATUS             Status;
+  ///
+  /// FNV-1a digest of all table bytes but name segments.
+  ///
+  UINT64                 Digest;
+  ///
+  /// Bitmap of table bytes belonging to name segments.
+  ///
+  UINT8                  *NameMap;
+  ///
+  /// Recorded namespace objects in parsing order.
+  ///
+  ACPI_NAMESPACE_NODE    *Nodes;
+  UINT32                 NumberOfNodes;
+  UINT32                 AllocatedNodes;
+  ///
+  /// Object name keys chained by slot in parsing order.
+  ///
+  ACPI_NAMESPACE_KEY     *Keys;
+  UINT32                 NumberOfKeys;
+  UINT32                 *Slots;
+  UINT32                 SlotMask;
+  ///
+  /// Scope chain buffer for lookup state evaluation.
+  ///
+  UINT32                 *Chain;
+  UINT32                 MaxDepth;
+  ///
+  /// Build state: scope node of the objects being parsed.
+  ///
+  UINT32                 Parent;
+  ///
+  /// Build state: end of the innermost Else being parsed or MAX_UINT32.
+  ///
+  UINT32                 ElseEnd;
+  ///
+  /// Build state: end of the furthest table byte read.
+  ///
+  UINT32                 HighWater;
+  ///
+  /// Build state: parsing only to learn whether a match would fail.
+  ///
+  BOOLEAN                Probing;
+  ///
+  /// Build state: out of memory while recording.
+  ///
+  BOOLEAN                Failed;
+};
+
 typedef struct {
   ///
   /// Currently processed opcode in ACPI table.
   ///
-  UINT8     *CurrentOpcode;
+  UINT8                      *CurrentOpcode;
   ///
   /// Pointer to the end of ACPI table.
   ///
-  UINT8     *TableStart;
+  UINT8                      *TableStart;
   ///
   /// Pointer to the end of ACPI table.
   ///
-  UINT8     *TableEnd;
+  UINT8                      *TableEnd;
   ///
   /// Decoded lookup path allocated from pool.
   /// Contains a sequence of parsed identifiers.
   ///
-  UINT32    *PathStart;
+  UINT32                     *PathStart;
   ///
   /// Identifier we need to match next.
   /// Once it reaches PathEnd, matching is successful.
   /// Requested number of matches is required to finish lookup.
   ///
-  UINT32    *CurrentIdentifier;
+  UINT32                     *CurrentIdentifier;
   ///
   /// Pointer to the end of lookup path.
   ///
-  UINT32    *PathEnd;
+  UINT32                     *PathEnd;
   ///
   /// Nesting level. Once it reaches MAX_NESTING the table is discarded.
   ///
-  UINT32    Nesting;
+  UINT32                     Nesting;
   ///
   /// Number of entries to find. Generally 1 for first match success.
   ///
-  UINT32    RequiredEntry;
+  UINT32                     RequiredEntry;
   ///
   /// Number of entries already found.
   ///
-  UINT32    EntriesFound;
+  UINT32                     EntriesFound;
+  ///
+  /// Namespace index being built, NULL for regular lookups.
+  /// Objects are recorded instead of matched while it is set.
+  ///
+  OC_ACPI_NAMESPACE_INDEX    *Index;
 } ACPI_PARSER_CONTEXT;
 
 #define IDENT_LEN    4
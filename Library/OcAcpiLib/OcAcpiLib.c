@@ -30,6 +30,8 @@
 
 #include <Library/OcAcpiLib.h>
 
+#include "AcpiParser.h"
+
 #define PCI_VENDOR_NVIDIA  0x10DE
 
 /**
@@ -433,6 +435,153 @@ AcpiAllocateCopyDsdt (
   return EFI_SUCCESS;
 }
 
+/**
+  Find namespace index of ACPI table.
+
+  @param Context      ACPI library context.
+  @param Table        ACPI table.
+  @param Create       Create new index when missing.
+
+  @return Namespace index or NULL.
+**/
+STATIC
+OC_ACPI_NAMESPACE_INDEX *
+AcpiGetNamespaceIndex (
+  IN OUT OC_ACPI_CONTEXT  *Context,
+  IN     VOID             *Table,
+  IN     BOOLEAN          Create
+  )
+{
+  UINT32                   Index;
+  OC_ACPI_NAMESPACE_INDEX  **NewIndices;
+  OC_ACPI_NAMESPACE_INDEX  *NamespaceIndex;
+
+  for (Index = 0; Index < Context->NumberOfIndices; ++Index) {
+    if (Context->Indices[Index]->Table == Table) {
+      return Context->Indices[Index];
+    }
+  }
+
+  if (!Create) {
+    return NULL;
+  }
+
+  if (Context->AllocatedIndices == Context->NumberOfIndices) {
+    NewIndices = AllocatePool ((Context->AllocatedIndices + 4) * sizeof (Context->Indices[0]));
+    if (NewIndices == NULL) {
+      return NULL;
+    }
+
+    if (Context->Indices != NULL) {
+      CopyMem (NewIndices, Context->Indices, Context->NumberOfIndices * sizeof (Context->Indices[0]));
+      FreePool (Context->Indices);
+    }
+
+    Context->Indices           = NewIndices;
+    Context->AllocatedIndices += 4;
+  }
+
+  NamespaceIndex = AllocateZeroPool (sizeof (*NamespaceIndex));
+  if (NamespaceIndex == NULL) {
+    return NULL;
+  }
+
+  NamespaceIndex->Table = Table;
+
+  Context->Indices[Context->NumberOfIndices] = NamespaceIndex;
+  ++Context->NumberOfIndices;
+
+  return NamespaceIndex;
+}
+
+/**
+  Mark namespace index of ACPI table outdated after modifying the table.
+
+  @param Context      ACPI library context.
+  @param Table        ACPI table.
+**/
+STATIC
+VOID
+AcpiInvalidateTableIndex (
+  IN OUT OC_ACPI_CONTEXT  *Context,
+  IN     VOID             *Table
+  )
+{
+  OC_ACPI_NAMESPACE_INDEX  *NamespaceIndex;
+
+  NamespaceIndex = AcpiGetNamespaceIndex (Context, Table, FALSE);
+  if (NamespaceIndex != NULL) {
+    AcpiInvalidateNamespaceIndex (NamespaceIndex);
+  }
+}
+
+/**
+  Move namespace index of ACPI table to its identical copy.
+
+  @param Context      ACPI library context.
+  @param Table        ACPI table.
+  @param NewTable     ACPI table copy.
+**/
+STATIC
+VOID
+AcpiMoveTableIndex (
+  IN OUT OC_ACPI_CONTEXT  *Context,
+  IN     VOID             *Table,
+  IN     VOID             *NewTable
+  )
+{
+  OC_ACPI_NAMESPACE_INDEX  *NamespaceIndex;
+
+  NamespaceIndex = AcpiGetNamespaceIndex (Context, Table, FALSE);
+  if (NamespaceIndex != NULL) {
+    NamespaceIndex->Table = NewTable;
+  }
+}
+
+/**
+  Find entry in ACPI table reusing its namespace index.
+
+  @param Context      ACPI library context.
+  @param Table        ACPI table.
+  @param PathString   Path to entry which must be found.
+  @param Entry        Number of entry which must be found.
+  @param Offset       Offset of the entry if it was found.
+
+  @return EFI_SUCCESS when the entry was found.
+**/
+STATIC
+EFI_STATUS
+AcpiFindEntryInTable (
+  IN OUT OC_ACPI_CONTEXT         *Context,
+  IN     EFI_ACPI_COMMON_HEADER  *Table,
+  IN     CONST CHAR8             *PathString,
+  IN     UINT8                   Entry,
+  OUT UINT32                     *Offset
+  )
+{
+  OC_ACPI_NAMESPACE_INDEX  *NamespaceIndex;
+
+  NamespaceIndex = AcpiGetNamespaceIndex (Context, Table, TRUE);
+  if (NamespaceIndex == NULL) {
+    return AcpiFindEntryInMemory (
+             (VOID *)Table,
+             PathString,
+             Entry,
+             Offset,
+             Table->Length
+             );
+  }
+
+  return AcpiFindEntryInIndex (
+           &NamespaceIndex,
+           (VOID *)Table,
+           PathString,
+           Entry,
+           Offset,
+           Table->Length
+           );
+}
+
 /**
   Load ACPI table regions.
 
@@ -610,6 +759,7 @@ AcpiRelocateTableRegions (
   // Update checksum
   //
   if (Modified) {
+    AcpiInvalidateTableIndex (Context, Table);
     ((EFI_ACPI_DESCRIPTION_HEADER *)Table)->Checksum = 0;
     ((EFI_ACPI_DESCRIPTION_HEADER *)Table)->Checksum = CalculateCheckSum8 (
                                                          (UINT8 *)Table,
@@ -894,6 +1044,17 @@ AcpiFreeContext (
     FreePool (Context->Regions);
     Context->Regions = NULL;
   }
+
+  if (Context->Indices != NULL) {
+    while (Context->NumberOfIndices > 0) {
+      --Context->NumberOfIndices;
+      AcpiFreeNamespaceIndex (Context->Indices[Context->NumberOfIndices]);
+    }
+
+    FreePool (Context->Indices);
+    Context->Indices          = NULL;
+    Context->AllocatedIndices = 0;
+  }
 }
 
 EFI_STATUS
@@ -1271,12 +1432,12 @@ AcpiApplyPatch (
     BaseOffset = 0;
 
     if ((Patch->Base != NULL) && (Patch->Base[0] != '\0')) {
-      Status = AcpiFindEntryInMemory (
-                 (VOID *)Context->Dsdt,
+      Status = AcpiFindEntryInTable (
+                 Context,
+                 (EFI_ACPI_COMMON_HEADER *)Context->Dsdt,
                  Patch->Base,
                  (UINT8)(Patch->BaseSkip + 1),
-                 &BaseOffset,
-                 Context->Dsdt->Length
+                 &BaseOffset
                  );
       if (!EFI_ERROR (Status)) {
         ReplaceLimit = MIN (ReplaceLimit, Context->Dsdt->Length - BaseOffset);
@@ -1294,10 +1455,13 @@ AcpiApplyPatch (
 
     if (!EFI_ERROR (Status)) {
       if (!AcpiIsTableWritable ((EFI_ACPI_COMMON_HEADER *)Context->Dsdt)) {
-        Status = AcpiAllocateCopyDsdt (Context, NULL);
+        NewTable = (EFI_ACPI_COMMON_HEADER *)Context->Dsdt;
+        Status   = AcpiAllocateCopyDsdt (Context, NULL);
         if (EFI_ERROR (Status)) {
           return Status;
         }
+
+        AcpiMoveTableIndex (Context, NewTable, Context->Dsdt);
       }
 
       ReplaceCount = ApplyPatch (
@@ -1323,6 +1487,7 @@ AcpiApplyPatch (
 
       if (ReplaceCount > 0) {
         AcpiRefreshTableChecksum (Context->Dsdt);
+        AcpiInvalidateTableIndex (Context, Context->Dsdt);
       }
     }
   }
@@ -1350,12 +1515,12 @@ AcpiApplyPatch (
 
       BaseOffset = 0;
       if ((Patch->Base != NULL) && (Patch->Base[0] != '\0')) {
-        Status = AcpiFindEntryInMemory (
-                   (VOID *)Context->Tables[Index],
+        Status = AcpiFindEntryInTable (
+                   Context,
+                   Context->Tables[Index],
                    Patch->Base,
                    (UINT8)(Patch->BaseSkip + 1),
-                   &BaseOffset,
-                   Context->Tables[Index]->Length
+                   &BaseOffset
                    );
         if (EFI_ERROR (Status)) {
           DEBUG ((
@@ -1380,6 +1545,7 @@ AcpiApplyPatch (
           return Status;
         }
 
+        AcpiMoveTableIndex (Context, Context->Tables[Index], NewTable);
         Context->Tables[Index] = NewTable;
       }
 
@@ -1408,6 +1574,10 @@ AcpiApplyPatch (
         Patch->Count
         ));
 
+      if (ReplaceCount > 0) {
+        AcpiInvalidateTableIndex (Context, Context->Tables[Index]);
+      }
+
       if ((ReplaceCount > 0) && (Context->Tables[Index]->Length >= sizeof (EFI_ACPI_DESCRIPTION_HEADER))) {
         AcpiRefreshTableChecksum ((EFI_ACPI_DESCRIPTION_HEADER *)Context->Tables[Index]);
       }
@@ -1417,6 +1587,419 @@ AcpiApplyPatch (
   return EFI_SUCCESS;
 }
 
+/**
+  Check whether patches may match within the table header region of the data.
+  Header fields, including the checksum refreshed after every patch,
+  may only affect patching results in this case.
+
+  @param[in] Table       ACPI table.
+  @param[in] Patches     Data patches for the table.
+  @param[in] PatchCount  Number of data patches.
+
+  @return TRUE when the patches must be applied one after another.
+**/
+STATIC
+BOOLEAN
+AcpiPatchesMayMatchHeader (
+  IN CONST EFI_ACPI_COMMON_HEADER  *Table,
+  IN CONST OC_DATA_PATCH           *Patches,
+  IN UINT32                        PatchCount
+  )
+{
+  CONST UINT8  *Data;
+  UINT32       Index;
+  UINT32       Offset;
+  UINT32       Byte;
+  UINT32       Size;
+  UINT32       MaxSize;
+  UINT64       Region;
+  UINT8        Value;
+
+  Data    = (CONST UINT8 *)Table;
+  MaxSize = 0;
+  for (Index = 0; Index < PatchCount; ++Index) {
+    MaxSize = MAX (MaxSize, Patches[Index].PatternSize);
+  }
+
+  //
+  // Replacements may only create new matches overlapping them. Every patch
+  // not matching here can therefore neither modify the header by itself,
+  // nor let any of the following patches do so.
+  //
+  Region = MultU64x32 (MaxSize, PatchCount) + sizeof (EFI_ACPI_DESCRIPTION_HEADER);
+
+  for (Index = 0; Index < PatchCount; ++Index) {
+    Size = Table->Length;
+    if ((Patches[Index].Limit > 0) && (Patches[Index].Limit < Size)) {
+      Size = Patches[Index].Limit;
+    }
+
+    if ((Patches[Index].PatternSize == 0) || (Patches[Index].PatternSize > Size)) {
+      continue;
+    }
+
+    for (Offset = 0; Offset < Region && Offset <= Size - Patches[Index].PatternSize; ++Offset) {
+      for (Byte = 0; Byte < Patches[Index].PatternSize; ++Byte) {
+        //
+        // Checksum may differ at the time the patch is applied.
+        //
+        if (Offset + Byte == OFFSET_OF (EFI_ACPI_DESCRIPTION_HEADER, Checksum)) {
+          continue;
+        }
+
+        Value = Data[Offset + Byte];
+        if (Patches[Index].PatternMask != NULL) {
+          Value &= Patches[Index].PatternMask[Byte];
+        }
+
+        if (Value != Patches[Index].Pattern[Byte]) {
+          break;
+        }
+      }
+
+      if (Byte == Patches[Index].PatternSize) {
+        return TRUE;
+      }
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Check whether patch targets the table.
+
+  @param[in] Table   ACPI table.
+  @param[in] IsDsdt  Table is DSDT.
+  @param[in] Patch   ACPI patch.
+
+  @return TRUE when the table must be patched.
+**/
+STATIC
+BOOLEAN
+AcpiIsPatchTarget (
+  IN CONST EFI_ACPI_COMMON_HEADER  *Table,
+  IN BOOLEAN                       IsDsdt,
+  IN CONST OC_ACPI_PATCH           *Patch
+  )
+{
+  UINT64  CurrOemTableId;
+
+  if (IsDsdt) {
+    CurrOemTableId = ((EFI_ACPI_DESCRIPTION_HEADER *)Table)->OemTableId;
+
+    if (  (Patch->TableSignature != 0)
+       && (Patch->TableSignature != EFI_ACPI_6_2_DIFFERENTIATED_SYSTEM_DESCRIPTION_TABLE_SIGNATURE))
+    {
+      return FALSE;
+    }
+  } else {
+    if (Table->Length >= sizeof (EFI_ACPI_DESCRIPTION_HEADER)) {
+      CurrOemTableId = ((EFI_ACPI_DESCRIPTION_HEADER *)Table)->OemTableId;
+    } else {
+      CurrOemTableId = 0;
+    }
+
+    if ((Patch->TableSignature != 0) && (Table->Signature != Patch->TableSignature)) {
+      return FALSE;
+    }
+  }
+
+  return ((Patch->TableLength == 0) || (Table->Length == Patch->TableLength))
+         && ((Patch->OemTableId == 0) || (CurrOemTableId == Patch->OemTableId));
+}
+
+/**
+  Fill data patch from ACPI patch without Base.
+
+  @param[out] DataPatch  Data patch.
+  @param[in]  Patch      ACPI patch.
+**/
+STATIC
+VOID
+AcpiInitDataPatch (
+  OUT OC_DATA_PATCH        *DataPatch,
+  IN  CONST OC_ACPI_PATCH  *Patch
+  )
+{
+  DataPatch->Pattern      = Patch->Find;
+  DataPatch->PatternMask  = Patch->Mask;
+  DataPatch->Replace      = Patch->Replace;
+  DataPatch->ReplaceMask  = Patch->ReplaceMask;
+  DataPatch->PatternSize  = Patch->Size;
+  DataPatch->Count        = Patch->Count;
+  DataPatch->Skip         = Patch->Skip;
+  DataPatch->Limit        = Patch->Limit;
+  DataPatch->ReplaceCount = 0;
+}
+
+/**
+  Apply patches without Base to one table.
+
+  @param[in,out] Context       ACPI library context.
+  @param[in]     TableIndex    Table index or MAX_UINT32 for DSDT.
+  @param[in]     Patches       ACPI patches.
+  @param[in]     PatchCount    Number of patches.
+  @param[in,out] DataPatches   Scratch data patches of PatchCount entries.
+  @param[in,out] PatchIndices  Scratch patch indices of PatchCount entries.
+  @param[in,out] Results       Per-patch status, updated on failure.
+
+  @return EFI_SUCCESS on success.
+**/
+STATIC
+EFI_STATUS
+AcpiApplyTablePatches (
+  IN OUT OC_ACPI_CONTEXT  *Context,
+  IN     UINT32           TableIndex,
+  IN     OC_ACPI_PATCH    *Patches,
+  IN     UINT32           PatchCount,
+  IN OUT OC_DATA_PATCH    *DataPatches,
+  IN OUT UINT32           *PatchIndices,
+  IN OUT EFI_STATUS       *Results
+  )
+{
+  EFI_STATUS              Status;
+  EFI_ACPI_COMMON_HEADER  *Table;
+  EFI_ACPI_COMMON_HEADER  *NewTable;
+  OC_ACPI_PATCH           *Patch;
+  UINT64                  CurrOemTableId;
+  UINT32                  TablePrintSignature;
+  UINT32                  Index;
+  UINT32                  Count;
+  BOOLEAN                 Sequential;
+  BOOLEAN                 Replaced;
+
+  if (TableIndex == MAX_UINT32) {
+    Table = (EFI_ACPI_COMMON_HEADER *)Context->Dsdt;
+  } else {
+    Table = Context->Tables[TableIndex];
+  }
+
+  Count = 0;
+  for (Index = 0; Index < PatchCount; ++Index) {
+    if (AcpiIsPatchTarget (Table, TableIndex == MAX_UINT32, &Patches[Index])) {
+      AcpiInitDataPatch (&DataPatches[Count], &Patches[Index]);
+      PatchIndices[Count] = Index;
+      ++Count;
+    }
+  }
+
+  if (Count == 0) {
+    return EFI_SUCCESS;
+  }
+
+  if (!AcpiIsTableWritable (Table)) {
+    if (TableIndex == MAX_UINT32) {
+      Status = AcpiAllocateCopyDsdt (Context, NULL);
+      if (!EFI_ERROR (Status)) {
+        NewTable = (EFI_ACPI_COMMON_HEADER *)Context->Dsdt;
+      }
+    } else {
+      Status = AcpiAllocateCopyTable (Table, 0, &NewTable);
+      if (!EFI_ERROR (Status)) {
+        Context->Tables[TableIndex] = NewTable;
+      }
+    }
+
+    if (EFI_ERROR (Status)) {
+      for (Index = 0; Index < Count; ++Index) {
+        Results[PatchIndices[Index]] = Status;
+      }
+
+      return Status;
+    }
+
+    AcpiMoveTableIndex (Context, Table, NewTable);
+    Table = NewTable;
+  }
+
+  Sequential = AcpiPatchesMayMatchHeader (Table, DataPatches, Count);
+
+  if (Sequential) {
+    DEBUG ((DEBUG_VERBOSE, "OCA: Patches may match table header, applying %u patches one by one\n", Count));
+
+    //
+    // Header fields may change, so patch targets are checked again every time.
+    //
+    Count = 0;
+    for (Index = 0; Index < PatchCount; ++Index) {
+      if (!AcpiIsPatchTarget (Table, TableIndex == MAX_UINT32, &Patches[Index])) {
+        continue;
+      }
+
+      AcpiInitDataPatch (&DataPatches[Count], &Patches[Index]);
+      PatchIndices[Count] = Index;
+
+      DataPatches[Count].ReplaceCount = ApplyPatch (
+                                          DataPatches[Count].Pattern,
+                                          DataPatches[Count].PatternMask,
+                                          DataPatches[Count].PatternSize,
+                                          DataPatches[Count].Replace,
+                                          DataPatches[Count].ReplaceMask,
+                                          (UINT8 *)Table,
+                                          (DataPatches[Count].Limit > 0) && (DataPatches[Count].Limit < Table->Length)
+                                            ? DataPatches[Count].Limit : Table->Length,
+                                          DataPatches[Count].Count,
+                                          DataPatches[Count].Skip
+                                          );
+
+      if (  (DataPatches[Count].ReplaceCount > 0)
+         && ((TableIndex == MAX_UINT32) || (Table->Length >= sizeof (EFI_ACPI_DESCRIPTION_HEADER))))
+      {
+        AcpiRefreshTableChecksum ((EFI_ACPI_DESCRIPTION_HEADER *)Table);
+      }
+
+      ++Count;
+    }
+  } else {
+    ApplyPatches (DataPatches, Count, (UINT8 *)Table, Table->Length);
+  }
+
+  if (Table->Length >= sizeof (EFI_ACPI_DESCRIPTION_HEADER)) {
+    CurrOemTableId = ((EFI_ACPI_DESCRIPTION_HEADER *)Table)->OemTableId;
+  } else {
+    CurrOemTableId = 0;
+  }
+
+  TablePrintSignature = AcpiReadSignature (Table);
+  Replaced            = FALSE;
+
+  for (Index = 0; Index < Count; ++Index) {
+    Patch = &Patches[PatchIndices[Index]];
+
+    if (TableIndex == MAX_UINT32) {
+      DEBUG ((
+        DataPatches[Index].ReplaceCount > 0 ? DEBUG_INFO : DEBUG_BULK_INFO,
+        "OCA: Patching DSDT of %u bytes with %016Lx ID replaced %u of %u\n",
+        (Patch->Limit > 0) && (Patch->Limit < Table->Length) ? Patch->Limit : Table->Length,
+        Patch->OemTableId,
+        DataPatches[Index].ReplaceCount,
+        Patch->Count
+        ));
+    } else {
+      DEBUG ((
+        DataPatches[Index].ReplaceCount > 0 ? DEBUG_INFO : DEBUG_BULK_INFO,
+        "OCA: Patching %.4a (%08x) (OEM %016Lx) of %u bytes with %016Lx ID at %u replaced %u of %u\n",
+        (CHAR8 *)&TablePrintSignature,
+        Table->Signature,
+        AcpiReadOemTableId (Table),
+        Table->Length,
+        CurrOemTableId,
+        TableIndex,
+        DataPatches[Index].ReplaceCount,
+        Patch->Count
+        ));
+    }
+
+    if (DataPatches[Index].ReplaceCount > 0) {
+      Replaced = TRUE;
+    }
+  }
+
+  if (Replaced) {
+    AcpiInvalidateTableIndex (Context, Table);
+
+    if (  !Sequential
+       && ((TableIndex == MAX_UINT32) || (Table->Length >= sizeof (EFI_ACPI_DESCRIPTION_HEADER))))
+    {
+      AcpiRefreshTableChecksum ((EFI_ACPI_DESCRIPTION_HEADER *)Table);
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+AcpiApplyPatches (
+  IN OUT OC_ACPI_CONTEXT  *Context,
+  IN     OC_ACPI_PATCH    *Patches,
+  IN     UINT32           PatchCount,
+  OUT    EFI_STATUS       *Results
+  )
+{
+  EFI_STATUS     Status;
+  OC_DATA_PATCH  *DataPatches;
+  UINT32         *PatchIndices;
+  UINT32         Index;
+  UINT32         First;
+  UINT32         TableIndex;
+
+  if (PatchCount == 0) {
+    return EFI_SUCCESS;
+  }
+
+  DataPatches  = AllocatePool (PatchCount * sizeof (*DataPatches));
+  PatchIndices = AllocatePool (PatchCount * sizeof (*PatchIndices));
+  if ((DataPatches == NULL) || (PatchIndices == NULL)) {
+    if (DataPatches != NULL) {
+      FreePool (DataPatches);
+    }
+
+    if (PatchIndices != NULL) {
+      FreePool (PatchIndices);
+    }
+
+    for (Index = 0; Index < PatchCount; ++Index) {
+      Results[Index] = AcpiApplyPatch (Context, &Patches[Index]);
+    }
+
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Index = 0;
+  while (Index < PatchCount) {
+    //
+    // Base lookup needs the table with all preceding patches applied,
+    // so these patches are applied on their own preserving the order.
+    //
+    if ((Patches[Index].Base != NULL) && (Patches[Index].Base[0] != '\0')) {
+      Results[Index] = AcpiApplyPatch (Context, &Patches[Index]);
+      ++Index;
+      continue;
+    }
+
+    First = Index;
+    while (Index < PatchCount && (Patches[Index].Base == NULL || Patches[Index].Base[0] == '\0')) {
+      Results[Index] = EFI_SUCCESS;
+      ++Index;
+    }
+
+    if (Context->Dsdt != NULL) {
+      Status = AcpiApplyTablePatches (
+                 Context,
+                 MAX_UINT32,
+                 &Patches[First],
+                 Index - First,
+                 DataPatches,
+                 PatchIndices,
+                 &Results[First]
+                 );
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_INFO, "OCA: Failed to patch DSDT - %r\n", Status));
+      }
+    }
+
+    for (TableIndex = 0; TableIndex < Context->NumberOfTables; ++TableIndex) {
+      Status = AcpiApplyTablePatches (
+                 Context,
+                 TableIndex,
+                 &Patches[First],
+                 Index - First,
+                 DataPatches,
+                 PatchIndices,
+                 &Results[First]
+                 );
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_INFO, "OCA: Failed to patch table at %u - %r\n", TableIndex, Status));
+      }
+    }
+  }
+
+  FreePool (DataPatches);
+  FreePool (PatchIndices);
+  return EFI_SUCCESS;
+}
+
 EFI_STATUS
 AcpiLoadRegions (
   IN OUT OC_ACPI_CONTEXT  *Context
@@ -1588,6 +2171,7 @@ AcpiFadtEnableReset (
   }
 
   AcpiRefreshTableChecksum ((EFI_ACPI_DESCRIPTION_HEADER *)Context->Fadt);
+  AcpiInvalidateTableIndex (Context, Context->Fadt);
 
   return EFI_SUCCESS;
 }
@@ -1623,6 +2207,8 @@ AcpiResetLogoStatus (
           Bgrt                   = BgrtNew;
         }
 
+        AcpiInvalidateTableIndex (Context, Bgrt);
+
         Bgrt->Status         &= ~EFI_ACPI_6_2_BGRT_STATUS_DISPLAYED;
         Bgrt->Header.Checksum = 0;
         Bgrt->Header.Checksum = CalculateCheckSum8 (
@@ -1756,6 +2342,7 @@ AcpiHandleHardwareSignature (
         }
 
         AcpiRefreshTableChecksum ((EFI_ACPI_DESCRIPTION_HEADER *)Context->Fadt);
+        AcpiInvalidateTableIndex (Context, Context->Fadt);
 
         Facs = FacsNew;
       }
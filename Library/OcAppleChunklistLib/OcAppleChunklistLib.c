@@ -138,12 +138,16 @@ OcAppleChunklistVerifyData (
   BOOLEAN  Result;
 
   UINTN                        Index;
-  UINT8                        ChunkHash[SHA256_DIGEST_SIZE];
+  UINTN                        BatchIndex;
+  UINTN                        BatchCount;
+  UINTN                        BatchSize;
   CONST APPLE_CHUNKLIST_CHUNK  *CurrentChunk;
   UINTN                        CurrentOffset;
+  OC_SHA256_BATCH_ENTRY        *Batch;
 
   UINT32  ChunkDataSize;
-  VOID    *ChunkData;
+  UINTN   ChunkDataTotalSize;
+  UINT8   *ChunkData;
 
   ASSERT (Context != NULL);
   ASSERT (Context->Chunks != NULL);
@@ -161,44 +165,162 @@ OcAppleChunklistVerifyData (
     }
   }
 
-  ChunkData = AllocatePool (ChunkDataSize);
+  //
+  // Chunks are read and hashed in batches, which are hashed in parallel
+  // where supported, and consist of a single chunk otherwise.
+  //
+  BatchSize = MAX (MIN (Sha256BatchParallelism (), Context->ChunkCount), 1);
+  if (BaseOverflowMulUN (ChunkDataSize, BatchSize, &ChunkDataTotalSize)) {
+    return FALSE;
+  }
+
+  Batch = AllocatePool (BatchSize * sizeof (*Batch));
+  if (Batch == NULL) {
+    return FALSE;
+  }
+
+  ChunkData = AllocatePool (ChunkDataTotalSize);
   if (ChunkData == NULL) {
+    FreePool (Batch);
     return FALSE;
   }
 
+  Result        = TRUE;
   CurrentOffset = 0;
-  for (Index = 0; Index < Context->ChunkCount; Index++) {
-    CurrentChunk = &Context->Chunks[Index];
+  for (Index = 0; Result && Index < Context->ChunkCount; Index += BatchCount) {
+    BatchCount = MIN (BatchSize, Context->ChunkCount - Index);
+
+    for (BatchIndex = 0; Result && BatchIndex < BatchCount; ++BatchIndex) {
+      CurrentChunk           = &Context->Chunks[Index + BatchIndex];
+      Batch[BatchIndex].Data = &ChunkData[BatchIndex * ChunkDataSize];
+      Batch[BatchIndex].Len  = CurrentChunk->Length;
+
+      Result = OcAppleRamDiskRead (
+                 ExtentTable,
+                 CurrentOffset,
+                 CurrentChunk->Length,
+                 &ChunkData[BatchIndex * ChunkDataSize]
+                 );
+
+      CurrentOffset += CurrentChunk->Length;
+    }
 
-    Result = OcAppleRamDiskRead (
-               ExtentTable,
-               CurrentOffset,
-               CurrentChunk->Length,
-               ChunkData
-               );
     if (!Result) {
-      FreePool (ChunkData);
-      return FALSE;
+      break;
     }
 
+    Sha256Batch (Batch, BatchCount);
+
     //
-    // Calculate checksum of data and ensure they match.
+    // Ensure checksums of data match.
     //
+    for (BatchIndex = 0; Result && BatchIndex < BatchCount; ++BatchIndex) {
+      DEBUG ((
+        DEBUG_VERBOSE,
+        "OCCL: Validating chunk %lu of %lu\n",
+        (UINT64)(Index + BatchIndex) + 1,
+        (UINT64)Context->ChunkCount
+        ));
+      Result = CompareMem (
+                 Batch[BatchIndex].Hash,
+                 Context->Chunks[Index + BatchIndex].Checksum,
+                 SHA256_DIGEST_SIZE
+                 ) == 0;
+    }
+  }
+
+  FreePool (ChunkData);
+  FreePool (Batch);
+  return Result;
+}
+
+VOID
+OcAppleChunklistVerifyDataStart (
+  IN OUT OC_APPLE_CHUNKLIST_CONTEXT  *Context
+  )
+{
+  ASSERT (Context != NULL);
+  ASSERT (Context->Chunks != NULL);
+
+  DEBUG_CODE (
+    ASSERT (Context->Signature == NULL);
+    );
+
+  Context->VerifiedChunkCount = 0;
+  Context->ChunkDataSize      = 0;
+  Sha256Init (&Context->ChunkHashContext);
+}
+
+BOOLEAN
+OcAppleChunklistVerifyDataUpdate (
+  IN OUT OC_APPLE_CHUNKLIST_CONTEXT  *Context,
+  IN     CONST VOID                  *Data,
+  IN     UINTN                       DataSize
+  )
+{
+  CONST UINT8                  *DataWalker;
+  CONST APPLE_CHUNKLIST_CHUNK  *CurrentChunk;
+  UINT8                        ChunkHash[SHA256_DIGEST_SIZE];
+  UINT32                       UpdateSize;
+
+  ASSERT (Context != NULL);
+  ASSERT (Data != NULL || DataSize == 0);
+
+  DataWalker = Data;
+
+  while (Context->VerifiedChunkCount < Context->ChunkCount) {
+    CurrentChunk = &Context->Chunks[Context->VerifiedChunkCount];
+
+    UpdateSize = (UINT32)MIN (DataSize, CurrentChunk->Length - Context->ChunkDataSize);
+    if (UpdateSize > 0) {
+      Sha256Update (&Context->ChunkHashContext, DataWalker, UpdateSize);
+      Context->ChunkDataSize += UpdateSize;
+      DataWalker             += UpdateSize;
+      DataSize               -= UpdateSize;
+    }
+
+    if (Context->ChunkDataSize < CurrentChunk->Length) {
+      break;
+    }
+
     DEBUG ((
       DEBUG_VERBOSE,
       "OCCL: Validating chunk %lu of %lu\n",
-      (UINT64)Index + 1,
+      (UINT64)Context->VerifiedChunkCount + 1,
       (UINT64)Context->ChunkCount
       ));
-    Sha256 (ChunkHash, ChunkData, CurrentChunk->Length);
+    Sha256Final (&Context->ChunkHashContext, ChunkHash);
     if (CompareMem (ChunkHash, CurrentChunk->Checksum, SHA256_DIGEST_SIZE) != 0) {
-      FreePool (ChunkData);
+      DEBUG ((
+        DEBUG_INFO,
+        "OCCL: Chunk %lu of %lu is invalid\n",
+        (UINT64)Context->VerifiedChunkCount + 1,
+        (UINT64)Context->ChunkCount
+        ));
       return FALSE;
     }
 
-    CurrentOffset += CurrentChunk->Length;
+    ++Context->VerifiedChunkCount;
+    Context->ChunkDataSize = 0;
+    Sha256Init (&Context->ChunkHashContext);
   }
 
-  FreePool (ChunkData);
   return TRUE;
 }
+
+BOOLEAN
+OcAppleChunklistVerifyDataFinal (
+  IN OUT OC_APPLE_CHUNKLIST_CONTEXT  *Context
+  )
+{
+  ASSERT (Context != NULL);
+
+  //
+  // Complete trailing empty chunks if any.
+  //
+  if (!OcAppleChunklistVerifyDataUpdate (Context, NULL, 0)) {
+    return FALSE;
+  }
+
+  return Context->VerifiedChunkCount == Context->ChunkCount;
+}
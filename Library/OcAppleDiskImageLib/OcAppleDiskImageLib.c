@@ -185,18 +185,34 @@ OcAppleDiskImageInitializeContext (
     return FALSE;
   }
 
+  ZeroMem (Context, sizeof (*Context));
+
   Context->ExtentTable = ExtentTable;
   Context->BlockCount  = DmgBlockCount;
   Context->Blocks      = DmgBlocks;
   Context->SectorCount = (UINTN)SectorCount;
 
+  InternalBuildChunkIndex (Context);
+
   return TRUE;
 }
 
+STATIC
+BOOLEAN
+InternalVerifyChunklistData (
+  IN VOID        *Context,
+  IN CONST VOID  *Buffer,
+  IN UINTN       BufferSize
+  )
+{
+  return OcAppleChunklistVerifyDataUpdate (Context, Buffer, BufferSize);
+}
+
 BOOLEAN
 OcAppleDiskImageInitializeFromFile (
-  OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
-  IN  EFI_FILE_PROTOCOL            *File
+  OUT    OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
+  IN     EFI_FILE_PROTOCOL            *File,
+  IN OUT OC_APPLE_CHUNKLIST_CONTEXT   *ChunklistContext OPTIONAL
   )
 {
   EFI_STATUS  Status;
@@ -220,7 +236,17 @@ OcAppleDiskImageInitializeFromFile (
     return FALSE;
   }
 
-  Result = OcAppleRamDiskLoadFile (ExtentTable, File, FileSize);
+  if (ChunklistContext != NULL) {
+    OcAppleChunklistVerifyDataStart (ChunklistContext);
+  }
+
+  Result = OcAppleRamDiskLoadFile (
+             ExtentTable,
+             File,
+             FileSize,
+             ChunklistContext != NULL ? InternalVerifyChunklistData : NULL,
+             ChunklistContext
+             );
   if (!Result) {
     DEBUG ((DEBUG_INFO, "OCDI: Failed to load DMG file\n"));
 
@@ -228,6 +254,13 @@ OcAppleDiskImageInitializeFromFile (
     return FALSE;
   }
 
+  if ((ChunklistContext != NULL) && !OcAppleChunklistVerifyDataFinal (ChunklistContext)) {
+    DEBUG ((DEBUG_INFO, "OCDI: DMG file is shorter than chunklist\n"));
+
+    OcAppleRamDiskFree (ExtentTable);
+    return FALSE;
+  }
+
   Result = OcAppleDiskImageInitializeContext (Context, ExtentTable, FileSize);
   if (!Result) {
     DEBUG ((DEBUG_INFO, "OCDI: Failed to initialise DMG context\n"));
@@ -263,6 +296,8 @@ OcAppleDiskImageFreeContext (
 
   ASSERT (Context != NULL);
 
+  InternalFreeChunkCache (Context);
+
   for (Index = 0; Index < Context->BlockCount; ++Index) {
     FreePool (Context->Blocks[Index]);
   }
@@ -281,10 +316,10 @@ OcAppleDiskImageFreeFile (
 
 BOOLEAN
 OcAppleDiskImageRead (
-  IN  OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
-  IN  UINTN                        Lba,
-  IN  UINTN                        BufferSize,
-  OUT VOID                         *Buffer
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
+  IN     UINTN                        Lba,
+  IN     UINTN                        BufferSize,
+  OUT    VOID                         *Buffer
   )
 {
   BOOLEAN  Result;
@@ -294,8 +329,6 @@ OcAppleDiskImageRead (
   UINT64                       ChunkTotalLength;
   UINT64                       ChunkLength;
   UINT64                       ChunkOffset;
-  UINT8                        *ChunkData;
-  UINT8                        *ChunkDataCompressed;
 
   UINTN  LbaCurrent;
   UINTN  LbaOffset;
@@ -304,8 +337,6 @@ OcAppleDiskImageRead (
   UINTN  BufferChunkSize;
   UINT8  *BufferCurrent;
 
-  UINTN  OutSize;
-
   ASSERT (Context != NULL);
   ASSERT (Buffer != NULL);
   ASSERT (Lba < Context->SectorCount);
@@ -368,38 +399,23 @@ OcAppleDiskImageRead (
         break;
       }
 
+      case APPLE_DISK_IMAGE_CHUNK_TYPE_ADC:
       case APPLE_DISK_IMAGE_CHUNK_TYPE_ZLIB:
+      case APPLE_DISK_IMAGE_CHUNK_TYPE_BZ2:
+      case APPLE_DISK_IMAGE_CHUNK_TYPE_LZFSE:
       {
-        ChunkData = AllocatePool ((UINTN)(ChunkTotalLength + Chunk->CompressedLength));
-        if (ChunkData == NULL) {
-          return FALSE;
-        }
-
-        ChunkDataCompressed = (ChunkData + (UINTN)ChunkTotalLength);
-        Result              = OcAppleRamDiskRead (
-                                Context->ExtentTable,
-                                (UINTN)Chunk->CompressedOffset,
-                                (UINTN)Chunk->CompressedLength,
-                                ChunkDataCompressed
-                                );
+        Result = InternalReadCompressedChunk (
+                   Context,
+                   Chunk,
+                   (UINTN)ChunkTotalLength,
+                   (UINTN)ChunkOffset,
+                   BufferChunkSize,
+                   BufferCurrent
+                   );
         if (!Result) {
-          FreePool (ChunkData);
-          return FALSE;
-        }
-
-        OutSize = DecompressZLIB (
-                    ChunkData,
-                    (UINTN)ChunkTotalLength,
-                    ChunkDataCompressed,
-                    (UINTN)Chunk->CompressedLength
-                    );
-        if (OutSize != (UINTN)ChunkTotalLength) {
-          FreePool (ChunkData);
           return FALSE;
         }
 
-        CopyMem (BufferCurrent, (ChunkData + ChunkOffset), BufferChunkSize);
-        FreePool (ChunkData);
         break;
       }
 
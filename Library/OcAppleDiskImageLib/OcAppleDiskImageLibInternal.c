@@ -13,10 +13,13 @@
 #include <Uefi.h>
 
 #include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/BaseOverflowLib.h>
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/OcAppleDiskImageLib.h>
+#include <Library/OcAppleRamDiskLib.h>
+#include <Library/OcCompressionLib.h>
 #include <Library/OcXmlLib.h>
 
 #include "OcAppleDiskImageLibInternal.h"
@@ -322,6 +325,303 @@ DONE_ERROR:
   return Result;
 }
 
+VOID
+InternalBuildChunkIndex (
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context
+  )
+{
+  UINT32                           BlockIndex;
+  UINT32                           ChunkIndex;
+  UINT32                           ChunkCount;
+  UINT32                           Index;
+  UINT32                           Index2;
+  UINT32                           ChunksSize;
+  UINT64                           BlockTop;
+  APPLE_DISK_IMAGE_BLOCK_DATA      *BlockData;
+  APPLE_DISK_IMAGE_CHUNK           *BlockChunk;
+  OC_APPLE_DISK_IMAGE_CHUNK_ENTRY  *Chunks;
+  OC_APPLE_DISK_IMAGE_CHUNK_ENTRY  Entry;
+
+  ASSERT (Context->Chunks == NULL);
+
+  ChunkCount = 0;
+  for (BlockIndex = 0; BlockIndex < Context->BlockCount; ++BlockIndex) {
+    if (BaseOverflowAddU32 (ChunkCount, Context->Blocks[BlockIndex]->ChunkCount, &ChunkCount)) {
+      return;
+    }
+  }
+
+  if (  (ChunkCount == 0)
+     || BaseOverflowMulU32 (ChunkCount, sizeof (*Chunks), &ChunksSize))
+  {
+    return;
+  }
+
+  Chunks = AllocatePool (ChunksSize);
+  if (Chunks == NULL) {
+    return;
+  }
+
+  //
+  // Only the sectors of a chunk within its block are reachable.
+  // Sector ranges are validated by InternalSwapBlockData.
+  //
+  Index = 0;
+  for (BlockIndex = 0; BlockIndex < Context->BlockCount; ++BlockIndex) {
+    BlockData = Context->Blocks[BlockIndex];
+    BlockTop  = BlockData->SectorNumber + BlockData->SectorCount;
+
+    for (ChunkIndex = 0; ChunkIndex < BlockData->ChunkCount; ++ChunkIndex) {
+      BlockChunk = &BlockData->Chunks[ChunkIndex];
+
+      Chunks[Index].SectorStart = DMG_SECTOR_START_ABS (BlockData, BlockChunk);
+      Chunks[Index].SectorTop   = MIN (Chunks[Index].SectorStart + BlockChunk->SectorCount, BlockTop);
+      Chunks[Index].Block       = BlockData;
+      Chunks[Index].Chunk       = BlockChunk;
+
+      if (Chunks[Index].SectorStart < Chunks[Index].SectorTop) {
+        ++Index;
+      }
+    }
+  }
+
+  ChunkCount = Index;
+
+  //
+  // Chunks are normally stored in order, so insertion sort is linear.
+  //
+  for (Index = 1; Index < ChunkCount; ++Index) {
+    CopyMem (&Entry, &Chunks[Index], sizeof (Entry));
+    for (Index2 = Index; Index2 > 0 && Chunks[Index2 - 1].SectorStart > Entry.SectorStart; --Index2) {
+      CopyMem (&Chunks[Index2], &Chunks[Index2 - 1], sizeof (Entry));
+    }
+
+    CopyMem (&Chunks[Index2], &Entry, sizeof (Entry));
+  }
+
+  //
+  // Overlapping chunks rely on the lookup order of the linear search.
+  //
+  for (Index = 1; Index < ChunkCount; ++Index) {
+    if (Chunks[Index].SectorStart < Chunks[Index - 1].SectorTop) {
+      DEBUG ((DEBUG_INFO, "OCDI: Overlapping chunks at sector %Lu\n", Chunks[Index].SectorStart));
+      FreePool (Chunks);
+      return;
+    }
+  }
+
+  Context->ChunkCount = ChunkCount;
+  Context->Chunks     = Chunks;
+}
+
+VOID
+InternalFreeChunkCache (
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context
+  )
+{
+  UINT32  Index;
+
+  if (Context->Chunks != NULL) {
+    FreePool (Context->Chunks);
+    Context->Chunks     = NULL;
+    Context->ChunkCount = 0;
+  }
+
+  for (Index = 0; Index < OC_APPLE_DISK_IMAGE_CACHE_SIZE; ++Index) {
+    if (Context->Cache[Index].Data != NULL) {
+      FreePool (Context->Cache[Index].Data);
+    }
+  }
+
+  ZeroMem (Context->Cache, sizeof (Context->Cache));
+
+  if (Context->CompressedData != NULL) {
+    FreePool (Context->CompressedData);
+    Context->CompressedData     = NULL;
+    Context->CompressedDataSize = 0;
+  }
+}
+
+/**
+  Decompress chunk data.
+
+  @param[in,out] Context    Disk image context.
+  @param[in]     Chunk      Compressed chunk.
+  @param[in]     ChunkSize  Decompressed chunk size.
+  @param[out]    Buffer     Buffer of ChunkSize bytes.
+
+  @retval TRUE on success.
+**/
+STATIC
+BOOLEAN
+InternalDecompressChunk (
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
+  IN     APPLE_DISK_IMAGE_CHUNK       *Chunk,
+  IN     UINTN                        ChunkSize,
+  OUT    UINT8                        *Buffer
+  )
+{
+  BOOLEAN  Result;
+  UINTN    OutSize;
+
+  if (Context->CompressedDataSize < Chunk->CompressedLength) {
+    if (Context->CompressedData != NULL) {
+      FreePool (Context->CompressedData);
+    }
+
+    Context->CompressedData = AllocatePool ((UINTN)Chunk->CompressedLength);
+    if (Context->CompressedData == NULL) {
+      Context->CompressedDataSize = 0;
+      return FALSE;
+    }
+
+    Context->CompressedDataSize = (UINTN)Chunk->CompressedLength;
+  }
+
+  Result = OcAppleRamDiskRead (
+             Context->ExtentTable,
+             (UINTN)Chunk->CompressedOffset,
+             (UINTN)Chunk->CompressedLength,
+             Context->CompressedData
+             );
+  if (!Result) {
+    return FALSE;
+  }
+
+  switch (Chunk->Type) {
+    case APPLE_DISK_IMAGE_CHUNK_TYPE_ADC:
+    {
+      OutSize = DecompressADC (
+                  Buffer,
+                  ChunkSize,
+                  Context->CompressedData,
+                  (UINTN)Chunk->CompressedLength
+                  );
+      break;
+    }
+
+    case APPLE_DISK_IMAGE_CHUNK_TYPE_ZLIB:
+    {
+      OutSize = DecompressZLIB (
+                  Buffer,
+                  ChunkSize,
+                  Context->CompressedData,
+                  (UINTN)Chunk->CompressedLength
+                  );
+      break;
+    }
+
+    case APPLE_DISK_IMAGE_CHUNK_TYPE_BZ2:
+    {
+      OutSize = DecompressBZIP2 (
+                  Buffer,
+                  ChunkSize,
+                  Context->CompressedData,
+                  (UINTN)Chunk->CompressedLength
+                  );
+      break;
+    }
+
+    case APPLE_DISK_IMAGE_CHUNK_TYPE_LZFSE:
+    {
+      OutSize = DecompressLZFSE (
+                  Buffer,
+                  ChunkSize,
+                  Context->CompressedData,
+                  (UINTN)Chunk->CompressedLength
+                  );
+      break;
+    }
+
+    default:
+    {
+      return FALSE;
+    }
+  }
+
+  return OutSize == ChunkSize;
+}
+
+BOOLEAN
+InternalReadCompressedChunk (
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
+  IN     APPLE_DISK_IMAGE_CHUNK       *Chunk,
+  IN     UINTN                        ChunkSize,
+  IN     UINTN                        Offset,
+  IN     UINTN                        Length,
+  OUT    UINT8                        *Buffer
+  )
+{
+  BOOLEAN                          Result;
+  UINT32                           Index;
+  UINT8                            *ChunkData;
+  OC_APPLE_DISK_IMAGE_CACHE_ENTRY  *Entry;
+
+  ASSERT (Offset <= ChunkSize);
+  ASSERT (Length <= ChunkSize - Offset);
+
+  Entry = &Context->Cache[0];
+  for (Index = 0; Index < OC_APPLE_DISK_IMAGE_CACHE_SIZE; ++Index) {
+    if (Context->Cache[Index].Chunk == Chunk) {
+      ++Context->CacheHits;
+      Context->Cache[Index].LastUse = ++Context->CacheTick;
+      CopyMem (Buffer, Context->Cache[Index].Data + Offset, Length);
+      return TRUE;
+    }
+
+    //
+    // Evict unused or least recently used entry.
+    //
+    if (  (Entry->Chunk != NULL)
+       && ((Context->Cache[Index].Chunk == NULL) || (Context->Cache[Index].LastUse < Entry->LastUse)))
+    {
+      Entry = &Context->Cache[Index];
+    }
+  }
+
+  ++Context->CacheMisses;
+
+  if (ChunkSize > OC_APPLE_DISK_IMAGE_CACHE_MAX_CHUNK_SIZE) {
+    ChunkData = AllocatePool (ChunkSize);
+    if (ChunkData == NULL) {
+      return FALSE;
+    }
+
+    Result = InternalDecompressChunk (Context, Chunk, ChunkSize, ChunkData);
+    if (Result) {
+      CopyMem (Buffer, ChunkData + Offset, Length);
+    }
+
+    FreePool (ChunkData);
+    return Result;
+  }
+
+  Entry->Chunk = NULL;
+
+  if (Entry->DataSize < ChunkSize) {
+    if (Entry->Data != NULL) {
+      FreePool (Entry->Data);
+    }
+
+    Entry->Data = AllocatePool (ChunkSize);
+    if (Entry->Data == NULL) {
+      Entry->DataSize = 0;
+      return FALSE;
+    }
+
+    Entry->DataSize = ChunkSize;
+  }
+
+  if (!InternalDecompressChunk (Context, Chunk, ChunkSize, Entry->Data)) {
+    return FALSE;
+  }
+
+  Entry->Chunk   = Chunk;
+  Entry->LastUse = ++Context->CacheTick;
+  CopyMem (Buffer, Entry->Data + Offset, Length);
+  return TRUE;
+}
+
 BOOLEAN
 InternalGetBlockChunk (
   IN  OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
@@ -332,9 +632,31 @@ InternalGetBlockChunk (
 {
   UINT32                       BlockIndex;
   UINT32                       ChunkIndex;
+  UINT32                       Low;
+  UINT32                       High;
+  UINT32                       Middle;
   APPLE_DISK_IMAGE_BLOCK_DATA  *BlockData;
   APPLE_DISK_IMAGE_CHUNK       *BlockChunk;
 
+  if (Context->Chunks != NULL) {
+    Low  = 0;
+    High = Context->ChunkCount;
+    while (Low < High) {
+      Middle = Low + (High - Low) / 2;
+      if (Lba < Context->Chunks[Middle].SectorStart) {
+        High = Middle;
+      } else if (Lba >= Context->Chunks[Middle].SectorTop) {
+        Low = Middle + 1;
+      } else {
+        *Data  = Context->Chunks[Middle].Block;
+        *Chunk = Context->Chunks[Middle].Chunk;
+        return TRUE;
+      }
+    }
+
+    return FALSE;
+  }
+
   for (BlockIndex = 0; BlockIndex < Context->BlockCount; ++BlockIndex) {
     BlockData = Context->Blocks[BlockIndex];
 
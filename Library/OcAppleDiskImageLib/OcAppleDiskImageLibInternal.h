@@ -37,6 +37,26 @@ InternalParsePlist (
   OUT APPLE_DISK_IMAGE_BLOCK_DATA  ***Blocks
   );
 
+VOID
+InternalBuildChunkIndex (
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context
+  );
+
+VOID
+InternalFreeChunkCache (
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context
+  );
+
+BOOLEAN
+InternalReadCompressedChunk (
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
+  IN     APPLE_DISK_IMAGE_CHUNK       *Chunk,
+  IN     UINTN                        ChunkSize,
+  IN     UINTN                        Offset,
+  IN     UINTN                        Length,
+  OUT    UINT8                        *Buffer
+  );
+
 BOOLEAN
 InternalGetBlockChunk (
   IN  OC_APPLE_DISK_IMAGE_CONTEXT  *Context,
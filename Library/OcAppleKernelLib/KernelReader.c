@@ -31,6 +31,11 @@
 //
 #define KERNEL_HEADER_SIZE  (EFI_PAGE_SIZE * 2)
 
+//
+// Compressed kernel is read and decompressed in chunks of this size.
+//
+#define KERNEL_COMPRESSED_CHUNK_SIZE  BASE_1MB
+
 STATIC SHA384_CONTEXT  mKernelDigestContext;
 STATIC UINT32          mKernelDigestPosition;
 STATIC BOOLEAN         mNeedKernelDigest;
@@ -202,7 +207,14 @@ ParseCompressedHeader (
 
   UINT32            KernelSize;
   MACH_COMP_HEADER  *CompHeader;
-  UINT8             *CompressedBuffer;
+  UINT8             *Chunk;
+  VOID              *Context;
+  UINT32            ChunkSize;
+  UINT32            Position;
+  UINT32            Remaining;
+  UINT32            Pending;
+  UINT32            ReadSize;
+  UINT32            Consumed;
   UINT32            CompressionType;
   UINT32            CompressedSize;
   UINT32            DecompressedSize;
@@ -231,26 +243,75 @@ ParseCompressedHeader (
     return KernelSize;
   }
 
-  CompressedBuffer = AllocatePool (CompressedSize);
-  if (CompressedBuffer == NULL) {
-    DEBUG ((DEBUG_INFO, "OCAK: Comp kernel (%u bytes) cannot be allocated at %08X\n", CompressedSize, Offset));
+  //
+  // Decompress while reading, so that the compressed kernel is never fully
+  // kept in memory. Unconsumed bytes are moved to the start of the chunk.
+  //
+  ChunkSize = MIN (CompressedSize, KERNEL_COMPRESSED_CHUNK_SIZE);
+  Chunk     = AllocatePool (ChunkSize);
+  if (Chunk == NULL) {
+    DEBUG ((DEBUG_INFO, "OCAK: Comp kernel chunk (%u bytes) cannot be allocated at %08X\n", ChunkSize, Offset));
     return KernelSize;
   }
 
-  Status = KernelGetFileData (File, Offset + sizeof (MACH_COMP_HEADER), CompressedSize, CompressedBuffer);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_INFO, "OCAK: Comp kernel (%u bytes) cannot be read at %08X\n", CompressedSize, Offset));
-    FreePool (CompressedBuffer);
+  if (CompressionType == MACH_COMPRESSED_BINARY_INVERT_LZVN) {
+    Context = DecompressLZVNStart (*Buffer, DecompressedSize);
+  } else if (CompressionType == MACH_COMPRESSED_BINARY_INVERT_LZSS) {
+    Context = DecompressLZSSStart (*Buffer, DecompressedSize);
+  } else {
+    Context = NULL;
+  }
+
+  if (Context == NULL) {
+    DEBUG ((DEBUG_INFO, "OCAK: Comp kernel type %08X cannot be decompressed at %08X\n", CompressionType, Offset));
+    FreePool (Chunk);
     return KernelSize;
   }
 
+  Position  = Offset + sizeof (MACH_COMP_HEADER);
+  Remaining = CompressedSize;
+  Pending   = 0;
+
+  while (Remaining > 0 || Pending > 0) {
+    ReadSize = MIN (Remaining, ChunkSize - Pending);
+    if (ReadSize > 0) {
+      Status = KernelGetFileData (File, Position, ReadSize, Chunk + Pending);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_INFO, "OCAK: Comp kernel (%u bytes) cannot be read at %08X\n", CompressedSize, Offset));
+        break;
+      }
+
+      Position  += ReadSize;
+      Remaining -= ReadSize;
+      Pending   += ReadSize;
+    }
+
+    if (CompressionType == MACH_COMPRESSED_BINARY_INVERT_LZVN) {
+      Consumed = (UINT32)DecompressLZVNUpdate (Context, Chunk, Pending);
+    } else {
+      Consumed = DecompressLZSSUpdate (Context, Chunk, Pending, Remaining == 0);
+    }
+
+    //
+    // No progress can be made when no more data fits or is left to read.
+    //
+    if ((Consumed == 0) && ((Remaining == 0) || (Pending == ChunkSize))) {
+      break;
+    }
+
+    Pending -= Consumed;
+    CopyMem (Chunk, Chunk + Consumed, Pending);
+  }
+
   if (CompressionType == MACH_COMPRESSED_BINARY_INVERT_LZVN) {
-    KernelSize = (UINT32)DecompressLZVN (*Buffer, DecompressedSize, CompressedBuffer, CompressedSize);
-  } else if (CompressionType == MACH_COMPRESSED_BINARY_INVERT_LZSS) {
-    KernelSize = (UINT32)DecompressLZSS (*Buffer, DecompressedSize, CompressedBuffer, CompressedSize);
+    KernelSize = (UINT32)DecompressLZVNEnd (Context);
+  } else {
+    KernelSize = DecompressLZSSEnd (Context);
   }
 
-  if (KernelSize != DecompressedSize) {
+  FreePool (Chunk);
+
+  if (EFI_ERROR (Status) || (KernelSize != DecompressedSize)) {
     KernelSize = 0;
   }
 
@@ -259,8 +320,6 @@ ParseCompressedHeader (
   //
   (VOID)DecompressedHash;
 
-  FreePool (CompressedBuffer);
-
   return KernelSize;
 }
 
@@ -19,6 +19,7 @@
 #include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/OcAppleKernelLib.h>
 #include <Library/OcMachoLib.h>
 #include <Library/OcMiscLib.h>
@@ -239,60 +240,44 @@ PatcherGetSymbolAddressValue (
   )
 {
   MACH_NLIST_ANY  *Symbol;
-  CONST CHAR8     *SymbolName;
   UINT64          SymbolAddress;
   UINT32          Offset;
-  UINT32          Index;
 
-  Index  = 0;
   Offset = 0;
-  while (TRUE) {
+
+  //
+  // Try the usual way first via SYMTAB.
+  //
+  Symbol = MachoGetSymbolByName (&Context->MachContext, Name);
+  if (Symbol != NULL) {
     //
-    // Try the usual way first via SYMTAB.
+    // Once we have a symbol, get its ondisk offset.
     //
-    Symbol = MachoGetSymbolByIndex (&Context->MachContext, Index);
-    if (Symbol == NULL) {
-      //
-      // If we have KxldState, use it.
-      //
-      if ((Index == 0) && (Context->KxldState != NULL)) {
-        SymbolAddress = InternalKxldSolveSymbol (
-                          Context->Is32Bit,
-                          Context->KxldState,
-                          Context->KxldStateSize,
-                          Name
-                          );
-        //
-        // If we have a symbol, get its ondisk offset.
-        //
-        if ((SymbolAddress != 0) && MachoSymbolGetDirectFileOffset (&Context->MachContext, SymbolAddress, &Offset, NULL)) {
-          //
-          // Proceed to success.
-          //
-          break;
-        }
-      }
+    if (!MachoSymbolGetFileOffset (&Context->MachContext, Symbol, &Offset, NULL)) {
+      return EFI_INVALID_PARAMETER;
+    }
 
+    SymbolAddress = Context->Is32Bit ? Symbol->Symbol32.Value : Symbol->Symbol64.Value;
+  } else {
+    //
+    // If there is no SYMTAB and we have KxldState, use it.
+    //
+    if ((MachoGetSymbolByIndex (&Context->MachContext, 0) != NULL) || (Context->KxldState == NULL)) {
       return EFI_NOT_FOUND;
     }
 
-    SymbolName = MachoGetSymbolName (&Context->MachContext, Symbol);
-    if ((SymbolName != NULL) && (AsciiStrCmp (Name, SymbolName) == 0)) {
-      //
-      // Once we have a symbol, get its ondisk offset.
-      //
-      if (MachoSymbolGetFileOffset (&Context->MachContext, Symbol, &Offset, NULL)) {
-        //
-        // Proceed to success.
-        //
-        SymbolAddress = Context->Is32Bit ? Symbol->Symbol32.Value : Symbol->Symbol64.Value;
-        break;
-      }
-
-      return EFI_INVALID_PARAMETER;
+    SymbolAddress = InternalKxldSolveSymbol (
+                      Context->Is32Bit,
+                      Context->KxldState,
+                      Context->KxldStateSize,
+                      Name
+                      );
+    //
+    // If we have a symbol, get its ondisk offset.
+    //
+    if ((SymbolAddress == 0) || !MachoSymbolGetDirectFileOffset (&Context->MachContext, SymbolAddress, &Offset, NULL)) {
+      return EFI_NOT_FOUND;
     }
-
-    Index++;
   }
 
   if (Address != NULL) {
@@ -306,6 +291,40 @@ PatcherGetSymbolAddressValue (
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+InternalReportGenericPatch (
+  IN PATCHER_CONTEXT        *Context,
+  IN PATCHER_GENERIC_PATCH  *Patch,
+  IN UINT32                 ReplaceCount
+  )
+{
+  DEBUG ((
+    DEBUG_INFO,
+    "OCAK: %a-bit %a replace count - %u\n",
+    Context->Is32Bit ? "32" : "64",
+    Patch->Comment != NULL ? Patch->Comment : "Patch",
+    ReplaceCount
+    ));
+
+  if ((ReplaceCount > 0) && (Patch->Count > 0) && (ReplaceCount != Patch->Count)) {
+    DEBUG ((
+      DEBUG_INFO,
+      "OCAK: %a-bit %a performed only %u replacements out of %u\n",
+      Context->Is32Bit ? "32" : "64",
+      Patch->Comment != NULL ? Patch->Comment : "Patch",
+      ReplaceCount,
+      Patch->Count
+      ));
+  }
+
+  if (ReplaceCount > 0) {
+    return EFI_SUCCESS;
+  }
+
+  return EFI_NOT_FOUND;
+}
+
 EFI_STATUS
 PatcherApplyGenericPatch (
   IN OUT PATCHER_CONTEXT        *Context,
@@ -366,30 +385,76 @@ PatcherApplyGenericPatch (
                    Patch->Skip
                    );
 
-  DEBUG ((
-    DEBUG_INFO,
-    "OCAK: %a-bit %a replace count - %u\n",
-    Context->Is32Bit ? "32" : "64",
-    Patch->Comment != NULL ? Patch->Comment : "Patch",
-    ReplaceCount
-    ));
+  return InternalReportGenericPatch (Context, Patch, ReplaceCount);
+}
 
-  if ((ReplaceCount > 0) && (Patch->Count > 0) && (ReplaceCount != Patch->Count)) {
-    DEBUG ((
-      DEBUG_INFO,
-      "OCAK: %a-bit %a performed only %u replacements out of %u\n",
-      Context->Is32Bit ? "32" : "64",
-      Patch->Comment != NULL ? Patch->Comment : "Patch",
-      ReplaceCount,
-      Patch->Count
-      ));
+EFI_STATUS
+PatcherApplyGenericPatches (
+  IN OUT PATCHER_CONTEXT        *Context,
+  IN     PATCHER_GENERIC_PATCH  *Patches,
+  IN     UINT32                 PatchCount,
+  OUT    EFI_STATUS             *Results
+  )
+{
+  OC_DATA_PATCH  *DataPatches;
+  UINT8          *Base;
+  UINT32         Size;
+  UINT32         Index;
+  UINT32         First;
+  UINT32         Count;
+
+  if (PatchCount == 0) {
+    return EFI_SUCCESS;
   }
 
-  if (ReplaceCount > 0) {
-    return EFI_SUCCESS;
+  Base = (UINT8 *)MachoGetMachHeader (&Context->MachContext);
+  Size = MachoGetInnerSize (&Context->MachContext);
+
+  DataPatches = AllocatePool (PatchCount * sizeof (*DataPatches));
+  if (DataPatches == NULL) {
+    for (Index = 0; Index < PatchCount; ++Index) {
+      Results[Index] = PatcherApplyGenericPatch (Context, &Patches[Index]);
+    }
+
+    return EFI_OUT_OF_RESOURCES;
   }
 
-  return EFI_NOT_FOUND;
+  Index = 0;
+  while (Index < PatchCount) {
+    //
+    // Symbol-based and direct write patches are applied on their own,
+    // preserving the order relative to the batched ones.
+    //
+    if ((Patches[Index].Base != NULL) || (Patches[Index].Find == NULL)) {
+      Results[Index] = PatcherApplyGenericPatch (Context, &Patches[Index]);
+      ++Index;
+      continue;
+    }
+
+    First = Index;
+    Count = 0;
+    while (Index < PatchCount && Patches[Index].Base == NULL && Patches[Index].Find != NULL) {
+      DataPatches[Count].Pattern     = Patches[Index].Find;
+      DataPatches[Count].PatternMask = Patches[Index].Mask;
+      DataPatches[Count].Replace     = Patches[Index].Replace;
+      DataPatches[Count].ReplaceMask = Patches[Index].ReplaceMask;
+      DataPatches[Count].PatternSize = Patches[Index].Size;
+      DataPatches[Count].Count       = Patches[Index].Count;
+      DataPatches[Count].Skip        = Patches[Index].Skip;
+      DataPatches[Count].Limit       = Patches[Index].Limit;
+      ++Count;
+      ++Index;
+    }
+
+    ApplyPatches (DataPatches, Count, Base, Size);
+
+    for (Count = 0; First < Index; ++First, ++Count) {
+      Results[First] = InternalReportGenericPatch (Context, &Patches[First], DataPatches[Count].ReplaceCount);
+    }
+  }
+
+  FreePool (DataPatches);
+  return EFI_SUCCESS;
 }
 
 EFI_STATUS
@@ -415,6 +480,8 @@ PatcherExcludePrelinkedKext (
   CONST CHAR8  *KextPlistKey;
   XML_NODE     *KextPlistValue;
   CONST CHAR8  *KextIdentifier;
+  UINT32       KextIdentifierLength;
+  UINT32       IdentifierLength;
   EFI_STATUS   Status;
 
   ASSERT (Identifier       != NULL);
@@ -475,10 +542,11 @@ PatcherExcludePrelinkedKext (
   //
   // Find kext info to be removed in prelinked context.
   //
-  KextCount      = XmlNodeChildren (PrelinkedContext->KextList);
-  KextPlist      = NULL;
-  KextPlistKey   = NULL;
-  KextIdentifier = NULL;
+  KextCount        = XmlNodeChildren (PrelinkedContext->KextList);
+  KextPlist        = NULL;
+  KextPlistKey     = NULL;
+  KextIdentifier   = NULL;
+  IdentifierLength = (UINT32)AsciiStrLen (Identifier);
 
   for (Index = 0; Index < KextCount; ++Index) {
     KextPlist = PlistNodeCast (XmlNodeChild (PrelinkedContext->KextList, Index), PLIST_NODE_TYPE_DICT);
@@ -486,6 +554,15 @@ PatcherExcludePrelinkedKext (
       continue;
     }
 
+    //
+    // Skip other kexts without parsing their dictionaries.
+    //
+    if (  PlistDictPeekString (KextPlist, INFO_BUNDLE_IDENTIFIER_KEY, &KextIdentifier, &KextIdentifierLength)
+       && ((KextIdentifierLength != IdentifierLength) || (CompareMem (KextIdentifier, Identifier, IdentifierLength) != 0)))
+    {
+      continue;
+    }
+
     KextPlistCount = PlistDictChildren (KextPlist);
     for (Index2 = 0; Index2 < KextPlistCount; ++Index2) {
       KextPlistKey = PlistKeyValue (PlistDictChild (KextPlist, Index2, &KextPlistValue));
@@ -532,6 +609,7 @@ PatcherExcludePrelinkedKext (
             KextPlist,
             Index
             ));
+          InternalUnindexPrelinkedKextPlist (PrelinkedContext, KextPlist);
           XmlNodeRemoveByIndex (PrelinkedContext->KextList, Index);
           return EFI_SUCCESS;
         }
@@ -285,6 +285,8 @@ InternalKxldStateBuildLinkedSymbolTable (
   Kext->NumberOfCxxSymbols = NumCxxSymbols;
   Kext->LinkedSymbolTable  = SymbolTable;
 
+  InternalBuildLinkedSymbolIndex (Kext);
+
   return EFI_SUCCESS;
 }
 
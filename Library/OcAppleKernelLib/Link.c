@@ -21,6 +21,7 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #include <Library/BaseMemoryLib.h>
 #include <Library/BaseOverflowLib.h>
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/OcAppleKernelLib.h>
 #include <Library/OcMachoLib.h>
 
@@ -31,6 +32,239 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #define TEXT_SEG_PROT  (MACH_SEGMENT_VM_PROT_READ | MACH_SEGMENT_VM_PROT_EXECUTE)
 #define DATA_SEG_PROT  (MACH_SEGMENT_VM_PROT_READ | MACH_SEGMENT_VM_PROT_WRITE)
 
+//
+// Minimum amount of slots in symbol name index.
+//
+#define SYMBOL_NAME_INDEX_MIN_SLOTS  16U
+
+//
+// Symbol index
+//
+
+STATIC
+UINT32
+InternalSymbolNameHash (
+  IN CONST CHAR8  *Name,
+  IN UINT32       Length
+  )
+{
+  UINT32  Hash;
+  UINT32  Index;
+
+  //
+  // FNV-1a. Mangled C++ names share long prefixes, so every byte is hashed.
+  //
+  Hash = 0x811C9DC5U;
+  for (Index = 0; Index < Length; ++Index) {
+    Hash ^= (UINT8)Name[Index];
+    Hash *= 0x01000193U;
+  }
+
+  return Hash;
+}
+
+STATIC
+BOOLEAN
+InternalSymbolValueIndexLess (
+  IN CONST PRELINKED_KEXT_SYMBOL  *Symbols,
+  IN UINT32                       First,
+  IN UINT32                       Second
+  )
+{
+  if (Symbols[First].Value != Symbols[Second].Value) {
+    return Symbols[First].Value < Symbols[Second].Value;
+  }
+
+  return First < Second;
+}
+
+STATIC
+VOID
+InternalSymbolValueIndexSift (
+  IN     CONST PRELINKED_KEXT_SYMBOL  *Symbols,
+  IN OUT UINT32                       *ValueIndex,
+  IN     UINT32                       Root,
+  IN     UINT32                       Count
+  )
+{
+  UINT32  Child;
+  UINT32  Swap;
+
+  while (TRUE) {
+    Child = Root * 2 + 1;
+    if (Child >= Count) {
+      return;
+    }
+
+    if (  (Child + 1 < Count)
+       && InternalSymbolValueIndexLess (Symbols, ValueIndex[Child], ValueIndex[Child + 1]))
+    {
+      ++Child;
+    }
+
+    if (!InternalSymbolValueIndexLess (Symbols, ValueIndex[Root], ValueIndex[Child])) {
+      return;
+    }
+
+    Swap              = ValueIndex[Root];
+    ValueIndex[Root]  = ValueIndex[Child];
+    ValueIndex[Child] = Swap;
+    Root              = Child;
+  }
+}
+
+VOID
+InternalBuildLinkedSymbolIndex (
+  IN OUT PRELINKED_KEXT  *Kext
+  )
+{
+  CONST PRELINKED_KEXT_SYMBOL  *Symbols;
+  UINT32                       *NameIndex;
+  UINT32                       *ValueIndex;
+  UINT32                       NumSymbols;
+  UINT32                       NumSlots;
+  UINT32                       Mask;
+  UINT32                       Slot;
+  UINT32                       Index;
+  UINT32                       Swap;
+
+  ASSERT (Kext->LinkedSymbolTable != NULL);
+  ASSERT (Kext->LinkedSymbolNameIndex == NULL);
+
+  Symbols    = Kext->LinkedSymbolTable;
+  NumSymbols = Kext->NumberOfSymbols;
+
+  if (NumSymbols > MAX_UINT32 / 8) {
+    return;
+  }
+
+  //
+  // Keep the load factor at or below 50% to have short probe sequences.
+  //
+  NumSlots = SYMBOL_NAME_INDEX_MIN_SLOTS;
+  while (NumSlots < NumSymbols * 2) {
+    NumSlots *= 2;
+  }
+
+  NameIndex = AllocateZeroPool ((NumSlots + NumSymbols) * sizeof (*NameIndex));
+  if (NameIndex == NULL) {
+    DEBUG ((DEBUG_INFO, "OCAK: No memory for %a symbol index, using linear lookup\n", Kext->Identifier));
+    return;
+  }
+
+  ValueIndex = &NameIndex[NumSlots];
+  Mask       = NumSlots - 1;
+
+  //
+  // Symbols are inserted in table order, so that for duplicate names the probe
+  // sequence visits them in the same order the linear scan would.
+  //
+  for (Index = 0; Index < NumSymbols; ++Index) {
+    Slot = InternalSymbolNameHash (Symbols[Index].Name, Symbols[Index].Length) & Mask;
+    while (NameIndex[Slot] != 0) {
+      Slot = (Slot + 1) & Mask;
+    }
+
+    NameIndex[Slot]   = Index + 1;
+    ValueIndex[Index] = Index;
+  }
+
+  //
+  // Heap sort by (Value, Index), the table may be large for the kernel.
+  //
+  if (NumSymbols > 1) {
+    for (Index = NumSymbols / 2; Index > 0; --Index) {
+      InternalSymbolValueIndexSift (Symbols, ValueIndex, Index - 1, NumSymbols);
+    }
+
+    for (Index = NumSymbols - 1; Index > 0; --Index) {
+      Swap              = ValueIndex[0];
+      ValueIndex[0]     = ValueIndex[Index];
+      ValueIndex[Index] = Swap;
+      InternalSymbolValueIndexSift (Symbols, ValueIndex, 0, Index);
+    }
+  }
+
+  Kext->LinkedSymbolNameIndex     = NameIndex;
+  Kext->LinkedSymbolNameIndexMask = Mask;
+  Kext->LinkedSymbolValueIndex    = ValueIndex;
+}
+
+STATIC
+CONST PRELINKED_KEXT_SYMBOL *
+InternalLookupSymbolNameIndex (
+  IN PRELINKED_KEXT  *Kext,
+  IN CONST CHAR8     *LookupValue,
+  IN UINT32          LookupValueLength,
+  IN UINT32          FirstIndex
+  )
+{
+  CONST PRELINKED_KEXT_SYMBOL  *Symbol;
+  UINT32                       Slot;
+  UINT32                       Entry;
+
+  Slot = InternalSymbolNameHash (LookupValue, LookupValueLength) & Kext->LinkedSymbolNameIndexMask;
+
+  while ((Entry = Kext->LinkedSymbolNameIndex[Slot]) != 0) {
+    Symbol = &Kext->LinkedSymbolTable[Entry - 1];
+    if (  (Entry - 1 >= FirstIndex)
+       && (Symbol->Length == LookupValueLength)
+       && (CompareMem (Symbol->Name, LookupValue, LookupValueLength) == 0))
+    {
+      return Symbol;
+    }
+
+    Slot = (Slot + 1) & Kext->LinkedSymbolNameIndexMask;
+  }
+
+  return NULL;
+}
+
+STATIC
+CONST PRELINKED_KEXT_SYMBOL *
+InternalLookupSymbolValueIndex (
+  IN PRELINKED_KEXT  *Kext,
+  IN UINT64          LookupValue,
+  IN UINT32          FirstIndex
+  )
+{
+  CONST PRELINKED_KEXT_SYMBOL  *Symbols;
+  CONST UINT32                 *ValueIndex;
+  UINT32                       Low;
+  UINT32                       High;
+  UINT32                       Middle;
+
+  Symbols    = Kext->LinkedSymbolTable;
+  ValueIndex = Kext->LinkedSymbolValueIndex;
+
+  //
+  // Find the first entry with Value >= LookupValue.
+  //
+  Low  = 0;
+  High = Kext->NumberOfSymbols;
+  while (Low < High) {
+    Middle = Low + (High - Low) / 2;
+    if (Symbols[ValueIndex[Middle]].Value < LookupValue) {
+      Low = Middle + 1;
+    } else {
+      High = Middle;
+    }
+  }
+
+  //
+  // Entries with equal values are ordered by index, return the first one in range.
+  //
+  while (Low < Kext->NumberOfSymbols && Symbols[ValueIndex[Low]].Value == LookupValue) {
+    if (ValueIndex[Low] >= FirstIndex) {
+      return &Symbols[ValueIndex[Low]];
+    }
+
+    ++Low;
+  }
+
+  return NULL;
+}
+
 //
 // Symbols
 //
@@ -55,7 +289,17 @@ InternalOcGetSymbolWorkerName (
   //
   Kext->Processed = TRUE;
 
-  if (Kext->LinkedSymbolTable != NULL) {
+  if (Kext->LinkedSymbolNameIndex != NULL) {
+    Symbols = InternalLookupSymbolNameIndex (
+                Kext,
+                LookupValue,
+                LookupValueLength,
+                SymbolLevel == OcGetSymbolOnlyCxx ? Kext->NumberOfSymbols - Kext->NumberOfCxxSymbols : 0
+                );
+    if (Symbols != NULL) {
+      return Symbols;
+    }
+  } else if (Kext->LinkedSymbolTable != NULL) {
     NumSymbols = Kext->NumberOfSymbols;
     Symbols    = Kext->LinkedSymbolTable;
 
@@ -136,7 +380,16 @@ InternalOcGetSymbolWorkerValue (
   //
   Kext->Processed = TRUE;
 
-  if (Kext->LinkedSymbolTable != NULL) {
+  if (Kext->LinkedSymbolValueIndex != NULL) {
+    Symbols = InternalLookupSymbolValueIndex (
+                Kext,
+                LookupValue,
+                SymbolLevel == OcGetSymbolOnlyCxx ? Kext->NumberOfSymbols - Kext->NumberOfCxxSymbols : 0
+                );
+    if (Symbols != NULL) {
+      return Symbols;
+    }
+  } else if (Kext->LinkedSymbolTable != NULL) {
     NumSymbols = Kext->NumberOfSymbols;
     Symbols    = Kext->LinkedSymbolTable;
 
@@ -204,6 +457,8 @@ InternalOcGetSymbolName (
   Symbol            = NULL;
   LookupValueLength = (UINT32)AsciiStrLen (LookupValue);
 
+  ++Context->SymbolNameLookups;
+
   //
   // Such symbols are illegit, but InternalOcGetSymbolWorkerName assumes Length > 0.
   //
@@ -257,6 +512,8 @@ InternalOcGetSymbolValue (
 
   Symbol = NULL;
 
+  ++Context->SymbolValueLookups;
+
   if ((SymbolLevel == OcGetSymbolOnlyCxx) && (Kext->LinkedSymbolTable != NULL)) {
     Symbol = InternalOcGetSymbolWorkerValue (Kext, LookupValue, SymbolLevel);
   } else {
@@ -1773,9 +2030,13 @@ InternalPrelinkKext (
   }
 
   //
-  // Create and patch the KEXT's VTables.
+  // Create and patch the KEXT's VTables.  Vtable patching looks up symbols and
+  // relocations in a loop, index them until the relocations are rewritten.
+  // Symbols solved meanwhile update the index.
   //
+  MachoInitializeIndex (MachoContext);
   Result = InternalPatchByVtables (Context, Kext);
+  MachoFreeIndex (MachoContext);
   if (!Result) {
     DEBUG ((DEBUG_INFO, "OCAK: Vtable patching failed for kext %a\n", Kext->Identifier));
     return EFI_LOAD_ERROR;
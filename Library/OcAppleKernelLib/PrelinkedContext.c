@@ -353,11 +353,12 @@ PrelinkedContextInit (
     return EFI_OUT_OF_RESOURCES;
   }
 
-  Context->PrelinkedInfoDocument = XmlDocumentParse (
+  Context->PrelinkedInfoDocument = XmlDocumentParseLazy (
                                      Context->PrelinkedInfo,
                                      (UINT32)(Context->Is32Bit ?
                                               Context->PrelinkedInfoSection->Section32.Size : Context->PrelinkedInfoSection->Section64.Size),
-                                     TRUE
+                                     TRUE,
+                                     Context->IsKernelCollection ? PRELINK_INFO_KEXT_LEVEL_KC : PRELINK_INFO_KEXT_LEVEL
                                      );
   if (Context->PrelinkedInfoDocument == NULL) {
     PrelinkedContextFree (Context);
@@ -411,6 +412,12 @@ PrelinkedContextInit (
         }
 
         if (Context->PrelinkedLastLoadAddress != 0) {
+          Status = InternalBuildPrelinkedKextIndex (Context);
+          if (EFI_ERROR (Status)) {
+            DEBUG ((DEBUG_INFO, "OCAK: Using linear kext lookup - %r\n", Status));
+            InternalFreePrelinkedKextIndex (Context);
+          }
+
           return EFI_SUCCESS;
         }
       }
@@ -472,6 +479,8 @@ PrelinkedContextFree (
     Context->PrelinkedStateKexts = NULL;
   }
 
+  InternalFreePrelinkedKextIndex (Context);
+
   while (!IsListEmpty (&Context->PrelinkedKexts)) {
     Link = GetFirstNode (&Context->PrelinkedKexts);
     Kext = GET_PRELINKED_KEXT_FROM_LINK (Link);
@@ -963,8 +972,11 @@ PrelinkedInjectKext (
   XML_DOCUMENT      *InfoPlistDocument;
   XML_NODE          *InfoPlistRoot;
   XML_NODE          *KextPlistValue;
+  XML_NODE          *KextPlist;
   CHAR8             *TmpInfoPlist;
   CHAR8             *NewInfoPlist;
+  CHAR8             *KextIdentifier;
+  UINT32            KextIdentifierLength;
   OC_MACHO_CONTEXT  ExecutableContext;
   CONST CHAR8       *TmpKeyValue;
   UINT32            FieldCount;
@@ -1207,6 +1219,20 @@ PrelinkedInjectKext (
     }
   }
 
+  //
+  // Appended dictionary is not parsed, so kext index needs an identifier copy.
+  //
+  KextIdentifier       = NULL;
+  KextIdentifierLength = 0;
+  if (  (Context->KextIndex != NULL)
+     && PlistDictPeekString (InfoPlistRoot, INFO_BUNDLE_IDENTIFIER_KEY, &TmpKeyValue, &KextIdentifierLength))
+  {
+    KextIdentifier = AllocateZeroPool (KextIdentifierLength + 1);
+    if (KextIdentifier != NULL) {
+      CopyMem (KextIdentifier, TmpKeyValue, KextIdentifierLength);
+    }
+  }
+
   //
   // Strip outer plist & dict.
   //
@@ -1215,7 +1241,15 @@ PrelinkedInjectKext (
   XmlDocumentFree (InfoPlistDocument);
   FreePool (TmpInfoPlist);
 
-  if (NewInfoPlist == NULL) {
+  if ((NewInfoPlist == NULL) || ((KextIdentifierLength > 0) && (KextIdentifier == NULL))) {
+    if (NewInfoPlist != NULL) {
+      FreePool (NewInfoPlist);
+    }
+
+    if (KextIdentifier != NULL) {
+      FreePool (KextIdentifier);
+    }
+
     if (PrelinkedKext != NULL) {
       InternalFreePrelinkedKext (PrelinkedKext);
     }
@@ -1226,6 +1260,10 @@ PrelinkedInjectKext (
   Status = PrelinkedDependencyInsert (Context, NewInfoPlist);
   if (EFI_ERROR (Status)) {
     FreePool (NewInfoPlist);
+    if (KextIdentifier != NULL) {
+      FreePool (KextIdentifier);
+    }
+
     if (PrelinkedKext != NULL) {
       InternalFreePrelinkedKext (PrelinkedKext);
     }
@@ -1233,7 +1271,20 @@ PrelinkedInjectKext (
     return Status;
   }
 
-  if (XmlNodeAppend (Context->KextList, "dict", NULL, NewInfoPlist) == NULL) {
+  if (KextIdentifier != NULL) {
+    Status = PrelinkedDependencyInsert (Context, KextIdentifier);
+    if (EFI_ERROR (Status)) {
+      FreePool (KextIdentifier);
+      if (PrelinkedKext != NULL) {
+        InternalFreePrelinkedKext (PrelinkedKext);
+      }
+
+      return Status;
+    }
+  }
+
+  KextPlist = XmlNodeAppend (Context->KextList, "dict", NULL, NewInfoPlist);
+  if (KextPlist == NULL) {
     if (PrelinkedKext != NULL) {
       InternalFreePrelinkedKext (PrelinkedKext);
     }
@@ -1241,6 +1292,21 @@ PrelinkedInjectKext (
     return EFI_OUT_OF_RESOURCES;
   }
 
+  //
+  // Keep kext index in sync with KextList, plist-only kexts are never cached.
+  //
+  if (KextIdentifier != NULL) {
+    Status = InternalIndexPrelinkedKextPlist (Context, KextPlist, KextIdentifier, KextIdentifierLength);
+    if (EFI_ERROR (Status)) {
+      XmlNodeRemoveByIndex (Context->KextList, XmlNodeChildren (Context->KextList) - 1);
+      if (PrelinkedKext != NULL) {
+        InternalFreePrelinkedKext (PrelinkedKext);
+      }
+
+      return Status;
+    }
+  }
+
   //
   // Let other kexts depend on this one.
   //
@@ -1251,6 +1317,7 @@ PrelinkedInjectKext (
     // for KernelCollection support.
     //
     InsertTailList (&Context->InjectedKexts, &PrelinkedKext->InjectedLink);
+    InternalIndexCachedPrelinkedKext (Context, PrelinkedKext);
   }
 
   return EFI_SUCCESS;
@@ -127,6 +127,21 @@ struct PRELINKED_KEXT_ {
   //
   PRELINKED_KEXT_SYMBOL       *LinkedSymbolTable;
   //
+  // Open addressing hash index of LinkedSymbolTable by symbol name.
+  // Every slot holds symbol index + 1, with 0 marking an empty slot.
+  // NULL when the index could not be built, in which case lookups are linear.
+  //
+  UINT32                      *LinkedSymbolNameIndex;
+  //
+  // LinkedSymbolNameIndex slot count minus one (slot count is a power of two).
+  //
+  UINT32                      LinkedSymbolNameIndexMask;
+  //
+  // LinkedSymbolTable indices sorted by symbol value and then by index.
+  // Shares the allocation with LinkedSymbolNameIndex.
+  //
+  UINT32                      *LinkedSymbolValueIndex;
+  //
   // A flag set during dependency walk BFS to avoid going through the same path.
   //
   BOOLEAN                     Processed;
@@ -140,6 +155,28 @@ struct PRELINKED_KEXT_ {
   PRELINKED_VTABLE            *LinkedVtables;
 };
 
+//
+// Kext identifier index entry (PRELINKED_CONTEXT -> KextIndex).
+//
+typedef struct {
+  //
+  // Kext CFBundleIdentifier or NULL for empty slot.
+  //
+  CONST CHAR8       *Identifier;
+  //
+  // Identifier length, which is not necessarily null-terminated.
+  //
+  UINT32            IdentifierLength;
+  //
+  // Kext dictionary in KextList or NULL.
+  //
+  XML_NODE          *KextPlist;
+  //
+  // Cached kext in PrelinkedKexts or NULL.
+  //
+  PRELINKED_KEXT    *Kext;
+} PRELINKED_KEXT_INDEX_ENTRY;
+
 //
 // PRELINKED_KEXT signature for list identification.
 //
@@ -206,6 +243,89 @@ InternalDropCachedPrelinkedKext (
   IN     CONST CHAR8        *Identifier
   );
 
+/**
+  Build kext identifier index for PRELINKED_CONTEXT.
+  On failure lookups fall back to walking the lists.
+
+  @param[in,out] Prelinked  Prelinked context with KextList.
+
+  @retval EFI_SUCCESS on success.
+**/
+EFI_STATUS
+InternalBuildPrelinkedKextIndex (
+  IN OUT PRELINKED_CONTEXT  *Prelinked
+  );
+
+/**
+  Free kext identifier index of PRELINKED_CONTEXT.
+
+  @param[in,out] Prelinked  Prelinked context.
+**/
+VOID
+InternalFreePrelinkedKextIndex (
+  IN OUT PRELINKED_CONTEXT  *Prelinked
+  );
+
+/**
+  Find kext identifier index entry.
+
+  @param[in] Prelinked   Prelinked context with KextIndex.
+  @param[in] Identifier  Kext bundle identifier.
+
+  @return  entry or NULL when the identifier was never indexed.
+**/
+PRELINKED_KEXT_INDEX_ENTRY *
+InternalLookupPrelinkedKextIndex (
+  IN PRELINKED_CONTEXT  *Prelinked,
+  IN CONST CHAR8        *Identifier
+  );
+
+/**
+  Add a cached kext to kext identifier index.
+  Does nothing when the index is unavailable.
+
+  @param[in,out] Prelinked  Prelinked context.
+  @param[in]     Kext       Kext inserted into PrelinkedKexts.
+**/
+VOID
+InternalIndexCachedPrelinkedKext (
+  IN OUT PRELINKED_CONTEXT  *Prelinked,
+  IN     PRELINKED_KEXT     *Kext
+  );
+
+/**
+  Add a kext dictionary appended to KextList to kext identifier index.
+  Does nothing when the index is unavailable.
+
+  @param[in,out] Prelinked         Prelinked context.
+  @param[in]     KextPlist         Kext dictionary appended to KextList.
+  @param[in]     Identifier        Kext bundle identifier, which must live
+                                   as long as Prelinked.
+  @param[in]     IdentifierLength  Kext bundle identifier length.
+
+  @retval EFI_SUCCESS on success.
+**/
+EFI_STATUS
+InternalIndexPrelinkedKextPlist (
+  IN OUT PRELINKED_CONTEXT  *Prelinked,
+  IN     XML_NODE           *KextPlist,
+  IN     CONST CHAR8        *Identifier,
+  IN     UINT32             IdentifierLength
+  );
+
+/**
+  Drop kext dictionary from kext identifier index prior to its removal
+  from KextList. Does nothing when the index is unavailable.
+
+  @param[in,out] Prelinked  Prelinked context.
+  @param[in]     KextPlist  Kext dictionary to be removed.
+**/
+VOID
+InternalUnindexPrelinkedKextPlist (
+  IN OUT PRELINKED_CONTEXT  *Prelinked,
+  IN     XML_NODE           *KextPlist
+  );
+
 /**
   Gets cached kernel PRELINKED_KEXT from PRELINKED_CONTEXT.
 **/
@@ -422,6 +542,17 @@ InternalOcGetSymbolValue (
   IN OC_GET_SYMBOL_LEVEL  SymbolLevel
   );
 
+/**
+  Build name and value lookup indices for LinkedSymbolTable.
+  Failure to build the indices is not fatal, lookups fall back to linear scan.
+
+  @param[in,out] Kext   Kext dependency with LinkedSymbolTable constructed.
+**/
+VOID
+InternalBuildLinkedSymbolIndex (
+  IN OUT PRELINKED_KEXT  *Kext
+  );
+
 VOID
 InternalSolveSymbolValue (
   IN  BOOLEAN         Is32Bit,
@@ -246,6 +246,14 @@ InternalCreatePrelinkedKext (
     return NULL;
   }
 
+  //
+  // Prelinked kexts are already linked, their symbols and relocations do not
+  // change anymore, so lookups by kext patches and quirks may be indexed.
+  //
+  if ((Prelinked != NULL) && HasExe) {
+    MachoInitializeIndex (&NewKext->Context.MachContext);
+  }
+
   NewKext->Signature                  = PRELINKED_KEXT_SIGNATURE;
   NewKext->Identifier                 = KextIdentifier;
   NewKext->BundleLibraries            = BundleLibraries;
@@ -472,6 +480,8 @@ InternalScanBuildLinkedSymbolTable (
   Kext->NumberOfCxxSymbols = NumCxxSymbols;
   Kext->LinkedSymbolTable  = SymbolTable;
 
+  InternalBuildLinkedSymbolIndex (Kext);
+
   return EFI_SUCCESS;
 }
 
@@ -683,11 +693,19 @@ InternalFreePrelinkedKext (
   IN PRELINKED_KEXT  *Kext
   )
 {
+  MachoFreeIndex (&Kext->Context.MachContext);
+
   if (Kext->LinkedSymbolTable != NULL) {
     FreePool (Kext->LinkedSymbolTable);
     Kext->LinkedSymbolTable = NULL;
   }
 
+  if (Kext->LinkedSymbolNameIndex != NULL) {
+    FreePool (Kext->LinkedSymbolNameIndex);
+    Kext->LinkedSymbolNameIndex  = NULL;
+    Kext->LinkedSymbolValueIndex = NULL;
+  }
+
   if (Kext->LinkedVtables != NULL) {
     FreePool (Kext->LinkedVtables);
     Kext->LinkedVtables = NULL;
@@ -696,17 +714,503 @@ InternalFreePrelinkedKext (
   FreePool (Kext);
 }
 
+//
+// Minimal number of kext identifier index slots.
+//
+#define PRELINKED_KEXT_INDEX_MIN_SLOTS  64U
+
+//
+// Identifier of removed kext identifier index entries, which keeps the probe
+// sequences of other entries intact.
+//
+STATIC CONST CHAR8  mPrelinkedKextIndexTombstone[] = "";
+
+STATIC
+UINT32
+InternalKextIdentifierHash (
+  IN CONST CHAR8  *Identifier,
+  IN UINT32       IdentifierLength
+  )
+{
+  UINT32  Hash;
+  UINT32  Index;
+
+  //
+  // FNV-1a.
+  //
+  Hash = 0x811C9DC5U;
+  for (Index = 0; Index < IdentifierLength; ++Index) {
+    Hash ^= (UINT8)Identifier[Index];
+    Hash *= 0x01000193U;
+  }
+
+  return Hash;
+}
+
+/**
+  Get bundle identifier of kext dictionary the way InternalCreatePrelinkedKext
+  matches it, i.e. the first CFBundleIdentifier key, which must be a string.
+  Lazily parsed dictionaries are not parsed unless the identifier is a reference.
+
+  @param[in]  KextPlist         Kext dictionary.
+  @param[out] IdentifierLength  Identifier length.
+
+  @return  identifier, not necessarily null-terminated, or NULL.
+**/
+STATIC
+CONST CHAR8 *
+InternalGetKextPlistIdentifier (
+  IN  XML_NODE  *KextPlist,
+  OUT UINT32    *IdentifierLength
+  )
+{
+  CONST CHAR8  *Identifier;
+
+  if (!PlistDictPeekString (KextPlist, INFO_BUNDLE_IDENTIFIER_KEY, &Identifier, IdentifierLength)) {
+    return NULL;
+  }
+
+  return Identifier;
+}
+
+/**
+  Find kext identifier index slot for insertion.
+
+  @param[in] Entries     Index entries.
+  @param[in] Slots       Number of index entries, power of two.
+  @param[in] Identifier  Kext bundle identifier.
+  @param[in] Length      Kext bundle identifier length.
+
+  @return  existing entry for Identifier, first free entry in its
+           probe sequence, or NULL when the index is full.
+**/
+STATIC
+PRELINKED_KEXT_INDEX_ENTRY *
+InternalFindPrelinkedKextIndexSlot (
+  IN PRELINKED_KEXT_INDEX_ENTRY  *Entries,
+  IN UINT32                      Slots,
+  IN CONST CHAR8                 *Identifier,
+  IN UINT32                      Length
+  )
+{
+  PRELINKED_KEXT_INDEX_ENTRY  *Free;
+  UINT32                      Mask;
+  UINT32                      Slot;
+  UINT32                      Probe;
+
+  Free = NULL;
+  Mask = Slots - 1;
+  Slot = InternalKextIdentifierHash (Identifier, Length) & Mask;
+
+  for (Probe = 0; Probe < Slots; ++Probe) {
+    if (Entries[Slot].Identifier == NULL) {
+      return Free != NULL ? Free : &Entries[Slot];
+    }
+
+    if (Entries[Slot].Identifier == mPrelinkedKextIndexTombstone) {
+      if (Free == NULL) {
+        Free = &Entries[Slot];
+      }
+    } else if (  (Entries[Slot].IdentifierLength == Length)
+              && (CompareMem (Entries[Slot].Identifier, Identifier, Length) == 0))
+    {
+      return &Entries[Slot];
+    }
+
+    Slot = (Slot + 1) & Mask;
+  }
+
+  return Free;
+}
+
+/**
+  Grow kext identifier index to fit at least one more entry.
+  Frees the index on allocation failure.
+
+  @param[in,out] Prelinked  Prelinked context with KextIndex.
+
+  @retval EFI_SUCCESS on success.
+**/
+STATIC
+EFI_STATUS
+InternalReservePrelinkedKextIndex (
+  IN OUT PRELINKED_CONTEXT  *Prelinked
+  )
+{
+  PRELINKED_KEXT_INDEX_ENTRY  *Entries;
+  PRELINKED_KEXT_INDEX_ENTRY  *OldEntries;
+  PRELINKED_KEXT_INDEX_ENTRY  *Entry;
+  UINT32                      Slots;
+  UINT32                      Count;
+  UINT32                      Index;
+
+  //
+  // Keep load factor under 50%, tombstones included.
+  //
+  if ((Prelinked->KextIndexCount + 1) * 2 <= Prelinked->KextIndexSlots) {
+    return EFI_SUCCESS;
+  }
+
+  if (Prelinked->KextIndexSlots >= MAX_UINT32 / 2 / sizeof (*Entries)) {
+    InternalFreePrelinkedKextIndex (Prelinked);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Slots   = Prelinked->KextIndexSlots * 2;
+  Entries = AllocateZeroPool (Slots * sizeof (*Entries));
+  if (Entries == NULL) {
+    InternalFreePrelinkedKextIndex (Prelinked);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  OldEntries = Prelinked->KextIndex;
+  Count      = 0;
+  for (Index = 0; Index < Prelinked->KextIndexSlots; ++Index) {
+    if (  (OldEntries[Index].Identifier == NULL)
+       || (OldEntries[Index].Identifier == mPrelinkedKextIndexTombstone))
+    {
+      continue;
+    }
+
+    Entry = InternalFindPrelinkedKextIndexSlot (
+              Entries,
+              Slots,
+              OldEntries[Index].Identifier,
+              OldEntries[Index].IdentifierLength
+              );
+    ASSERT (Entry != NULL && Entry->Identifier == NULL);
+    CopyMem (Entry, &OldEntries[Index], sizeof (*Entry));
+    ++Count;
+  }
+
+  FreePool (OldEntries);
+  Prelinked->KextIndex      = Entries;
+  Prelinked->KextIndexSlots = Slots;
+  Prelinked->KextIndexCount = Count;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Insert or find kext identifier index entry.
+
+  @param[in,out] Prelinked   Prelinked context with KextIndex.
+  @param[in]     Identifier  Kext bundle identifier.
+  @param[in]     Length      Kext bundle identifier length.
+
+  @return  entry or NULL, in which case the index is no longer available.
+**/
+STATIC
+PRELINKED_KEXT_INDEX_ENTRY *
+InternalInsertPrelinkedKextIndex (
+  IN OUT PRELINKED_CONTEXT  *Prelinked,
+  IN     CONST CHAR8        *Identifier,
+  IN     UINT32             Length
+  )
+{
+  EFI_STATUS                  Status;
+  PRELINKED_KEXT_INDEX_ENTRY  *Entry;
+
+  Status = InternalReservePrelinkedKextIndex (Prelinked);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "OCAK: Dropping kext index for %.*a - %r\n", Length, Identifier, Status));
+    return NULL;
+  }
+
+  Entry = InternalFindPrelinkedKextIndexSlot (Prelinked->KextIndex, Prelinked->KextIndexSlots, Identifier, Length);
+  ASSERT (Entry != NULL);
+
+  if (Entry->Identifier == NULL) {
+    ++Prelinked->KextIndexCount;
+  }
+
+  if ((Entry->Identifier == NULL) || (Entry->Identifier == mPrelinkedKextIndexTombstone)) {
+    Entry->Identifier       = Identifier;
+    Entry->IdentifierLength = Length;
+    Entry->KextPlist        = NULL;
+    Entry->Kext             = NULL;
+  }
+
+  return Entry;
+}
+
+EFI_STATUS
+InternalBuildPrelinkedKextIndex (
+  IN OUT PRELINKED_CONTEXT  *Prelinked
+  )
+{
+  PRELINKED_KEXT_INDEX_ENTRY  *Entry;
+  LIST_ENTRY                  *Link;
+  XML_NODE                    *KextPlist;
+  CONST CHAR8                 *Identifier;
+  UINT32                      IdentifierLength;
+  UINT32                      Index;
+  UINT32                      KextCount;
+  UINT32                      Slots;
+
+  ASSERT (Prelinked->KextIndex == NULL);
+
+  KextCount = XmlNodeChildren (Prelinked->KextList);
+  Link      = GetFirstNode (&Prelinked->PrelinkedKexts);
+  while (!IsNull (&Prelinked->PrelinkedKexts, Link)) {
+    ++KextCount;
+    Link = GetNextNode (&Prelinked->PrelinkedKexts, Link);
+  }
+
+  //
+  // Leave room for injected kexts to avoid early rehashing.
+  //
+  if (KextCount > MAX_UINT32 / 4 / sizeof (*Entry)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Slots = MAX (GetPowerOfTwo32 (KextCount) * 4, PRELINKED_KEXT_INDEX_MIN_SLOTS);
+
+  Prelinked->KextIndex = AllocateZeroPool (Slots * sizeof (*Entry));
+  if (Prelinked->KextIndex == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Prelinked->KextIndexSlots = Slots;
+  Prelinked->KextIndexCount = 0;
+
+  //
+  // Cached kexts take precedence over KextList, like in linear lookup.
+  //
+  Link = GetFirstNode (&Prelinked->PrelinkedKexts);
+  while (!IsNull (&Prelinked->PrelinkedKexts, Link)) {
+    InternalIndexCachedPrelinkedKext (Prelinked, GET_PRELINKED_KEXT_FROM_LINK (Link));
+    Link = GetNextNode (&Prelinked->PrelinkedKexts, Link);
+  }
+
+  KextCount = XmlNodeChildren (Prelinked->KextList);
+  for (Index = 0; Index < KextCount; ++Index) {
+    KextPlist = PlistNodeCast (XmlNodeChild (Prelinked->KextList, Index), PLIST_NODE_TYPE_DICT);
+    if (KextPlist == NULL) {
+      continue;
+    }
+
+    Identifier = InternalGetKextPlistIdentifier (KextPlist, &IdentifierLength);
+    if (Identifier == NULL) {
+      continue;
+    }
+
+    Entry = InternalInsertPrelinkedKextIndex (Prelinked, Identifier, IdentifierLength);
+    if (Entry == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    //
+    // First dictionary wins for duplicate identifiers.
+    //
+    if (Entry->KextPlist == NULL) {
+      Entry->KextPlist = KextPlist;
+      //
+      // Prefer identifier storage of the dictionary, which lives longer.
+      //
+      Entry->Identifier = Identifier;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+VOID
+InternalFreePrelinkedKextIndex (
+  IN OUT PRELINKED_CONTEXT  *Prelinked
+  )
+{
+  if (Prelinked->KextIndex != NULL) {
+    FreePool (Prelinked->KextIndex);
+    Prelinked->KextIndex = NULL;
+  }
+
+  Prelinked->KextIndexSlots = 0;
+  Prelinked->KextIndexCount = 0;
+}
+
+PRELINKED_KEXT_INDEX_ENTRY *
+InternalLookupPrelinkedKextIndex (
+  IN PRELINKED_CONTEXT  *Prelinked,
+  IN CONST CHAR8        *Identifier
+  )
+{
+  PRELINKED_KEXT_INDEX_ENTRY  *Entry;
+
+  ASSERT (Prelinked->KextIndex != NULL);
+
+  Entry = InternalFindPrelinkedKextIndexSlot (
+            Prelinked->KextIndex,
+            Prelinked->KextIndexSlots,
+            Identifier,
+            (UINT32)AsciiStrLen (Identifier)
+            );
+  if (  (Entry == NULL)
+     || (Entry->Identifier == NULL)
+     || (Entry->Identifier == mPrelinkedKextIndexTombstone))
+  {
+    return NULL;
+  }
+
+  return Entry;
+}
+
+VOID
+InternalIndexCachedPrelinkedKext (
+  IN OUT PRELINKED_CONTEXT  *Prelinked,
+  IN     PRELINKED_KEXT     *Kext
+  )
+{
+  PRELINKED_KEXT_INDEX_ENTRY  *Entry;
+
+  if (Prelinked->KextIndex == NULL) {
+    return;
+  }
+
+  Entry = InternalInsertPrelinkedKextIndex (Prelinked, Kext->Identifier, (UINT32)AsciiStrLen (Kext->Identifier));
+  if (Entry == NULL) {
+    return;
+  }
+
+  //
+  // Earlier cached kexts win for duplicate identifiers.
+  //
+  if (Entry->Kext == NULL) {
+    Entry->Kext = Kext;
+  }
+}
+
+EFI_STATUS
+InternalIndexPrelinkedKextPlist (
+  IN OUT PRELINKED_CONTEXT  *Prelinked,
+  IN     XML_NODE           *KextPlist,
+  IN     CONST CHAR8        *Identifier,
+  IN     UINT32             IdentifierLength
+  )
+{
+  PRELINKED_KEXT_INDEX_ENTRY  *Entry;
+
+  if (Prelinked->KextIndex == NULL) {
+    return EFI_SUCCESS;
+  }
+
+  Entry = InternalInsertPrelinkedKextIndex (Prelinked, Identifier, IdentifierLength);
+  if (Entry == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // First dictionary wins for duplicate identifiers.
+  //
+  if (Entry->KextPlist == NULL) {
+    Entry->KextPlist  = KextPlist;
+    Entry->Identifier = Identifier;
+  }
+
+  return EFI_SUCCESS;
+}
+
+VOID
+InternalUnindexPrelinkedKextPlist (
+  IN OUT PRELINKED_CONTEXT  *Prelinked,
+  IN     XML_NODE           *KextPlist
+  )
+{
+  PRELINKED_KEXT_INDEX_ENTRY  *Entry;
+  CONST CHAR8                 *Identifier;
+  UINT32                      IdentifierLength;
+  XML_NODE                    *OtherPlist;
+  UINT32                      Index;
+  UINT32                      KextCount;
+
+  if (Prelinked->KextIndex == NULL) {
+    return;
+  }
+
+  Identifier = InternalGetKextPlistIdentifier (KextPlist, &IdentifierLength);
+  if (Identifier == NULL) {
+    return;
+  }
+
+  Entry = InternalFindPrelinkedKextIndexSlot (
+            Prelinked->KextIndex,
+            Prelinked->KextIndexSlots,
+            Identifier,
+            IdentifierLength
+            );
+  if ((Entry == NULL) || (Entry->Identifier == NULL) || (Entry->KextPlist != KextPlist)) {
+    return;
+  }
+
+  //
+  // Fall back to the next dictionary with the same identifier if any.
+  //
+  Entry->KextPlist = NULL;
+  KextCount        = XmlNodeChildren (Prelinked->KextList);
+  for (Index = 0; Index < KextCount; ++Index) {
+    OtherPlist = PlistNodeCast (XmlNodeChild (Prelinked->KextList, Index), PLIST_NODE_TYPE_DICT);
+    if ((OtherPlist == NULL) || (OtherPlist == KextPlist)) {
+      continue;
+    }
+
+    Identifier = InternalGetKextPlistIdentifier (OtherPlist, &IdentifierLength);
+    if (  (Identifier != NULL)
+       && (IdentifierLength == Entry->IdentifierLength)
+       && (CompareMem (Identifier, Entry->Identifier, IdentifierLength) == 0))
+    {
+      Entry->KextPlist  = OtherPlist;
+      Entry->Identifier = Identifier;
+      return;
+    }
+  }
+
+  //
+  // Removed dictionary owns identifier storage.
+  //
+  if (Entry->Kext != NULL) {
+    Entry->Identifier = Entry->Kext->Identifier;
+  } else {
+    Entry->Identifier = mPrelinkedKextIndexTombstone;
+  }
+}
+
 PRELINKED_KEXT *
 InternalCachedPrelinkedKext (
   IN OUT PRELINKED_CONTEXT  *Prelinked,
   IN     CONST CHAR8        *Identifier
   )
 {
-  PRELINKED_KEXT  *NewKext;
-  LIST_ENTRY      *Kext;
-  UINT32          Index;
-  UINT32          KextCount;
-  XML_NODE        *KextPlist;
+  PRELINKED_KEXT              *NewKext;
+  LIST_ENTRY                  *Kext;
+  UINT32                      Index;
+  UINT32                      KextCount;
+  XML_NODE                    *KextPlist;
+  PRELINKED_KEXT_INDEX_ENTRY  *Entry;
+
+  if (Prelinked->KextIndex != NULL) {
+    Entry = InternalLookupPrelinkedKextIndex (Prelinked, Identifier);
+    if (Entry == NULL) {
+      return NULL;
+    }
+
+    if (Entry->Kext != NULL) {
+      return Entry->Kext;
+    }
+
+    if (Entry->KextPlist != NULL) {
+      NewKext = InternalCreatePrelinkedKext (Prelinked, Entry->KextPlist, Identifier, Prelinked->Is32Bit);
+      if (NewKext != NULL) {
+        InsertTailList (&Prelinked->PrelinkedKexts, &NewKext->Link);
+        Entry->Kext = NewKext;
+        return NewKext;
+      }
+    }
+
+    //
+    // Malformed dictionary may have a well-formed duplicate, which only
+    // the slow path below is able to find.
+    //
+  }
 
   //
   // Find cached entry if any.
@@ -743,6 +1247,7 @@ InternalCachedPrelinkedKext (
   }
 
   InsertTailList (&Prelinked->PrelinkedKexts, &NewKext->Link);
+  InternalIndexCachedPrelinkedKext (Prelinked, NewKext);
 
   return NewKext;
 }
@@ -753,25 +1258,41 @@ InternalDropCachedPrelinkedKext (
   IN     CONST CHAR8        *Identifier
   )
 {
-  LIST_ENTRY      *Link;
-  BOOLEAN         Found;
-  PRELINKED_KEXT  *Kext;
+  LIST_ENTRY                  *Link;
+  BOOLEAN                     Found;
+  PRELINKED_KEXT              *Kext;
+  PRELINKED_KEXT_INDEX_ENTRY  *Entry;
 
   //
   // Find kext identifier.
   //
   Found = FALSE;
-  Link  = GetFirstNode (&Prelinked->PrelinkedKexts);
+  Link  = NULL;
   Kext  = NULL;
-  while (!IsNull (&Prelinked->PrelinkedKexts, Link)) {
-    Kext = GET_PRELINKED_KEXT_FROM_LINK (Link);
+  Entry = NULL;
 
-    if (AsciiStrCmp (Identifier, Kext->Identifier) == 0) {
+  if (Prelinked->KextIndex != NULL) {
+    //
+    // Index references the first cached kext with this identifier.
+    //
+    Entry = InternalLookupPrelinkedKextIndex (Prelinked, Identifier);
+    if ((Entry != NULL) && (Entry->Kext != NULL)) {
+      Kext  = Entry->Kext;
+      Link  = &Kext->Link;
       Found = TRUE;
-      break;
     }
+  } else {
+    Link = GetFirstNode (&Prelinked->PrelinkedKexts);
+    while (!IsNull (&Prelinked->PrelinkedKexts, Link)) {
+      Kext = GET_PRELINKED_KEXT_FROM_LINK (Link);
 
-    Link = GetNextNode (&Prelinked->PrelinkedKexts, Link);
+      if (AsciiStrCmp (Identifier, Kext->Identifier) == 0) {
+        Found = TRUE;
+        break;
+      }
+
+      Link = GetNextNode (&Prelinked->PrelinkedKexts, Link);
+    }
   }
 
   if (!Found) {
@@ -788,6 +1309,34 @@ InternalDropCachedPrelinkedKext (
     ));
 
   RemoveEntryList (Link);
+
+  if (Entry != NULL) {
+    //
+    // Fall back to the next cached kext with the same identifier if any.
+    //
+    Entry->Kext = NULL;
+    Link        = GetFirstNode (&Prelinked->PrelinkedKexts);
+    while (!IsNull (&Prelinked->PrelinkedKexts, Link)) {
+      if (AsciiStrCmp (Identifier, GET_PRELINKED_KEXT_FROM_LINK (Link)->Identifier) == 0) {
+        Entry->Kext = GET_PRELINKED_KEXT_FROM_LINK (Link);
+        break;
+      }
+
+      Link = GetNextNode (&Prelinked->PrelinkedKexts, Link);
+    }
+
+    //
+    // Dropped kext may own identifier storage.
+    //
+    if (Entry->KextPlist == NULL) {
+      if (Entry->Kext != NULL) {
+        Entry->Identifier = Entry->Kext->Identifier;
+      } else {
+        Entry->Identifier = mPrelinkedKextIndexTombstone;
+      }
+    }
+  }
+
   InternalFreePrelinkedKext (Kext);
 
   return EFI_SUCCESS;
@@ -371,6 +371,7 @@ InternalPatchVtableSymbol (
   //       VTable Relocation should reference it.
   //
   InternalSolveSymbolValue (MachoContext->Is32Bit, ParentEntry->Address, Symbol);
+  MachoUpdateSymbolValueIndex (MachoContext, Symbol);
   //
   // The C++ ABI requires that functions be aligned on a 2-byte boundary:
   // http://www.codesourcery.com/public/cxx-abi/abi.html#member-pointers
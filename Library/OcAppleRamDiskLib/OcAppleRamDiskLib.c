@@ -472,7 +472,9 @@ BOOLEAN
 OcAppleRamDiskLoadFile (
   IN CONST APPLE_RAM_DISK_EXTENT_TABLE  *ExtentTable,
   IN EFI_FILE_PROTOCOL                  *File,
-  IN UINTN                              FileSize
+  IN UINTN                              FileSize,
+  IN OC_APPLE_RAM_DISK_LOAD_CALLBACK    Callback         OPTIONAL,
+  IN VOID                               *CallbackContext OPTIONAL
   )
 {
   EFI_STATUS      Status;
@@ -538,6 +540,14 @@ OcAppleRamDiskLoadFile (
       Sha256Update (&Ctx, TmpBuffer, ReadSize);
       DEBUG_CODE_END ();
 
+      //
+      // Inspect the data while it is still hot in cache.
+      //
+      if ((Callback != NULL) && !Callback (CallbackContext, TmpBuffer, ReadSize)) {
+        FreePool (TmpBuffer);
+        return FALSE;
+      }
+
       CopyMem (ExtentBuffer, TmpBuffer, ReadSize);
 
       FilePosition += ReadSize;
@@ -0,0 +1,572 @@
+/** @file
+  Persistent cache of boot entry discovery results.
+
+  Copyright (C) 2026, Acidanthera. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#include "BootManagementInternal.h"
+
+#include <Guid/AppleBless.h>
+#include <Guid/FileSystemInfo.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/DevicePathLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/OcCryptoLib.h>
+#include <Library/OcDebugLogLib.h>
+#include <Library/OcFileLib.h>
+#include <Library/OcStorageLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+#define OC_SCAN_CACHE_PATH         L"ScanCache.bin"
+#define OC_SCAN_CACHE_SIGNATURE    SIGNATURE_32 ('O', 'C', 'S', 'C')
+#define OC_SCAN_CACHE_VERSION      2U
+#define OC_SCAN_CACHE_MAX_SIZE     BASE_256KB
+#define OC_SCAN_CACHE_MAX_RECORDS  64U
+
+#pragma pack(1)
+
+typedef PACKED struct {
+  UINT32    Signature;
+  UINT32    Version;
+  UINT32    Size;
+  UINT8     Digest[SHA256_DIGEST_SIZE];
+} OC_SCAN_CACHE_HEADER;
+
+//
+// Each record is followed by Size bytes of device path, zero Size records
+// a lookup, which found nothing. Records with zero key are discarded.
+//
+typedef PACKED struct {
+  UINT8     Key[OC_SCAN_CACHE_KEY_SIZE];
+  UINT32    Size;
+} OC_SCAN_CACHE_RECORD;
+
+#pragma pack()
+
+STATIC_ASSERT (
+  OC_SCAN_CACHE_KEY_SIZE == SHA256_DIGEST_SIZE,
+  "Scan cache key must be SHA-256"
+  );
+
+STATIC BOOLEAN  mScanCacheEnabled;
+STATIC BOOLEAN  mScanCacheDirty;
+STATIC UINT8    mScanCacheConfigDigest[SHA256_DIGEST_SIZE];
+
+//
+// Records loaded from the file and records used or added during this scan.
+//
+STATIC UINT8   *mScanCacheOld;
+STATIC UINT32  mScanCacheOldSize;
+STATIC UINT8   *mScanCacheNew;
+STATIC UINT32  mScanCacheNewSize;
+STATIC UINT32  mScanCacheNewCount;
+
+STATIC
+BOOLEAN
+ScanCacheValidateRecords (
+  IN CONST UINT8  *Records,
+  IN UINT32       Size
+  )
+{
+  CONST OC_SCAN_CACHE_RECORD  *Record;
+  UINT32                      Offset;
+
+  Offset = 0;
+  while (Offset < Size) {
+    if (Size - Offset < sizeof (*Record)) {
+      return FALSE;
+    }
+
+    Record  = (CONST OC_SCAN_CACHE_RECORD *)&Records[Offset];
+    Offset += sizeof (*Record);
+
+    if (Size - Offset < Record->Size) {
+      return FALSE;
+    }
+
+    if (  (Record->Size > 0)
+       && !IsDevicePathValid ((CONST EFI_DEVICE_PATH_PROTOCOL *)&Records[Offset], Record->Size))
+    {
+      return FALSE;
+    }
+
+    Offset += Record->Size;
+  }
+
+  return TRUE;
+}
+
+STATIC
+OC_SCAN_CACHE_RECORD *
+ScanCacheFindRecord (
+  IN UINT8        *Records,
+  IN UINT32       Size,
+  IN CONST UINT8  *Key
+  )
+{
+  OC_SCAN_CACHE_RECORD  *Record;
+  UINT32                Offset;
+
+  for (Offset = 0; Offset < Size; Offset += sizeof (*Record) + Record->Size) {
+    Record = (OC_SCAN_CACHE_RECORD *)&Records[Offset];
+    if (CompareMem (Record->Key, Key, sizeof (Record->Key)) == 0) {
+      return Record;
+    }
+  }
+
+  return NULL;
+}
+
+STATIC
+BOOLEAN
+ScanCacheAppendRecord (
+  IN CONST UINT8                     *Key,
+  IN CONST EFI_DEVICE_PATH_PROTOCOL  *DevicePath  OPTIONAL,
+  IN UINT32                          DevicePathSize
+  )
+{
+  UINT8                 *NewRecords;
+  OC_SCAN_CACHE_RECORD  *Record;
+  UINT32                RecordSize;
+
+  RecordSize = sizeof (*Record) + DevicePathSize;
+  if (mScanCacheNewSize + RecordSize > OC_SCAN_CACHE_MAX_SIZE - sizeof (OC_SCAN_CACHE_HEADER)) {
+    return FALSE;
+  }
+
+  NewRecords = ReallocatePool (mScanCacheNewSize, mScanCacheNewSize + RecordSize, mScanCacheNew);
+  if (NewRecords == NULL) {
+    return FALSE;
+  }
+
+  Record = (OC_SCAN_CACHE_RECORD *)&NewRecords[mScanCacheNewSize];
+  CopyMem (Record->Key, Key, sizeof (Record->Key));
+  Record->Size = DevicePathSize;
+  if (DevicePathSize > 0) {
+    CopyMem (Record + 1, DevicePath, DevicePathSize);
+  }
+
+  mScanCacheNew      = NewRecords;
+  mScanCacheNewSize += RecordSize;
+  ++mScanCacheNewCount;
+  return TRUE;
+}
+
+STATIC
+BOOLEAN
+ScanCacheRevalidate (
+  IN CONST EFI_DEVICE_PATH_PROTOCOL  *DevicePath
+  )
+{
+  EFI_STATUS                Status;
+  EFI_DEVICE_PATH_PROTOCOL  *DevicePathWalker;
+  EFI_DEVICE_PATH_PROTOCOL  *Instance;
+  EFI_DEVICE_PATH_PROTOCOL  *RemainingDevicePath;
+  EFI_FILE_PROTOCOL         *File;
+  UINTN                     InstanceSize;
+
+  //
+  // Opening every cached path is much cheaper than the discovery, which
+  // probes predefined paths and enumerates APFS containers.
+  //
+  DevicePathWalker = (EFI_DEVICE_PATH_PROTOCOL *)DevicePath;
+  while (TRUE) {
+    Instance = GetNextDevicePathInstance (&DevicePathWalker, &InstanceSize);
+    if (Instance == NULL) {
+      return TRUE;
+    }
+
+    RemainingDevicePath = Instance;
+    Status              = OcOpenFileByDevicePath (
+                            &RemainingDevicePath,
+                            &File,
+                            EFI_FILE_MODE_READ,
+                            0
+                            );
+    FreePool (Instance);
+    if (EFI_ERROR (Status)) {
+      DebugPrintDevicePath (DEBUG_INFO, "OCB: Scan cache entry is gone", (EFI_DEVICE_PATH_PROTOCOL *)DevicePath);
+      return FALSE;
+    }
+
+    File->Close (File);
+  }
+}
+
+VOID
+InternalScanCacheInit (
+  IN OC_PICKER_CONTEXT  *Context
+  )
+{
+  EFI_STATUS                  Status;
+  EFI_FILE_PROTOCOL           *Root;
+  UINT8                       *FileData;
+  UINT32                      FileSize;
+  CONST OC_SCAN_CACHE_HEADER  *Header;
+  UINT8                       Digest[SHA256_DIGEST_SIZE];
+  SHA256_CONTEXT              HashContext;
+  UINTN                       Index;
+
+  InternalScanCacheFlush ();
+
+  if (!Context->UseScanCache) {
+    return;
+  }
+
+  //
+  // Cached results cannot be authenticated.
+  //
+  if ((Context->StorageContext != NULL) && Context->StorageContext->HasVault) {
+    DEBUG ((DEBUG_INFO, "OCB: Scan cache is not supported with vault\n"));
+    return;
+  }
+
+  //
+  // Custom bless paths affect every lookup, hence they are part of every key.
+  //
+  Sha256Init (&HashContext);
+  for (Index = 0; Index < Context->NumCustomBootPaths; ++Index) {
+    Sha256Update (&HashContext, (UINT8 *)Context->CustomBootPaths[Index], StrSize (Context->CustomBootPaths[Index]));
+  }
+
+  Sha256Final (&HashContext, mScanCacheConfigDigest);
+
+  mScanCacheEnabled = TRUE;
+
+  Status = OcFindWritableOcFileSystem (&Root);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "OCB: Unable to find root writable filesystem for scan cache - %r\n", Status));
+    return;
+  }
+
+  FileData = OcReadFileFromDirectory (Root, OC_SCAN_CACHE_PATH, &FileSize, OC_SCAN_CACHE_MAX_SIZE);
+  Root->Close (Root);
+  if (FileData == NULL) {
+    DEBUG ((DEBUG_INFO, "OCB: Scan cache is missing\n"));
+    return;
+  }
+
+  Header = (CONST OC_SCAN_CACHE_HEADER *)FileData;
+
+  if (  (FileSize < sizeof (*Header))
+     || (Header->Signature != OC_SCAN_CACHE_SIGNATURE)
+     || (Header->Version != OC_SCAN_CACHE_VERSION)
+     || (Header->Size != FileSize - sizeof (*Header)))
+  {
+    DEBUG ((DEBUG_INFO, "OCB: Scan cache has incompatible layout\n"));
+    FreePool (FileData);
+    return;
+  }
+
+  Sha256 (Digest, (UINT8 *)(Header + 1), Header->Size);
+  if (  (CompareMem (Digest, Header->Digest, sizeof (Digest)) != 0)
+     || !ScanCacheValidateRecords ((UINT8 *)(Header + 1), Header->Size))
+  {
+    DEBUG ((DEBUG_INFO, "OCB: Scan cache is corrupted\n"));
+    FreePool (FileData);
+    return;
+  }
+
+  mScanCacheOldSize = Header->Size;
+  mScanCacheOld     = AllocateCopyPool (mScanCacheOldSize, Header + 1);
+  FreePool (FileData);
+  if (mScanCacheOld == NULL) {
+    mScanCacheOldSize = 0;
+  }
+
+  DEBUG ((DEBUG_INFO, "OCB: Scan cache loaded with %u bytes of records\n", mScanCacheOldSize));
+}
+
+VOID
+InternalScanCacheFlush (
+  VOID
+  )
+{
+  EFI_STATUS            Status;
+  EFI_FILE_PROTOCOL     *Root;
+  UINT8                 *FileData;
+  UINT32                FileSize;
+  OC_SCAN_CACHE_HEADER  *Header;
+  OC_SCAN_CACHE_RECORD  *Record;
+  UINT32                Offset;
+
+  if (mScanCacheEnabled && mScanCacheDirty) {
+    //
+    // Keep records used during this scan, and carry over the rest while
+    // there is space, as the scan does not necessarily visit every volume.
+    //
+    for (
+         Offset = 0;
+         Offset < mScanCacheOldSize && mScanCacheNewCount < OC_SCAN_CACHE_MAX_RECORDS;
+         Offset += sizeof (*Record) + Record->Size
+         )
+    {
+      Record = (OC_SCAN_CACHE_RECORD *)&mScanCacheOld[Offset];
+      if (!IsZeroBuffer (Record->Key, sizeof (Record->Key))) {
+        ScanCacheAppendRecord (
+          Record->Key,
+          Record->Size > 0 ? (EFI_DEVICE_PATH_PROTOCOL *)(Record + 1) : NULL,
+          Record->Size
+          );
+      }
+    }
+
+    FileSize = sizeof (*Header) + mScanCacheNewSize;
+    FileData = AllocatePool (FileSize);
+    if (FileData != NULL) {
+      Header            = (OC_SCAN_CACHE_HEADER *)FileData;
+      Header->Signature = OC_SCAN_CACHE_SIGNATURE;
+      Header->Version   = OC_SCAN_CACHE_VERSION;
+      Header->Size      = mScanCacheNewSize;
+      CopyMem (Header + 1, mScanCacheNew, mScanCacheNewSize);
+      Sha256 (Header->Digest, (UINT8 *)(Header + 1), Header->Size);
+
+      Status = OcFindWritableOcFileSystem (&Root);
+      if (!EFI_ERROR (Status)) {
+        //
+        // Creating a file does not truncate the existing one.
+        //
+        OcDeleteFile (Root, OC_SCAN_CACHE_PATH);
+        Status = OcSetFileData (Root, OC_SCAN_CACHE_PATH, FileData, FileSize);
+        Root->Close (Root);
+      }
+
+      DEBUG ((DEBUG_INFO, "OCB: Scan cache saved with %u records - %r\n", mScanCacheNewCount, Status));
+      FreePool (FileData);
+    }
+  }
+
+  if (mScanCacheOld != NULL) {
+    FreePool (mScanCacheOld);
+  }
+
+  if (mScanCacheNew != NULL) {
+    FreePool (mScanCacheNew);
+  }
+
+  mScanCacheEnabled  = FALSE;
+  mScanCacheDirty    = FALSE;
+  mScanCacheOld      = NULL;
+  mScanCacheOldSize  = 0;
+  mScanCacheNew      = NULL;
+  mScanCacheNewSize  = 0;
+  mScanCacheNewCount = 0;
+}
+
+BOOLEAN
+InternalScanCacheGetKey (
+  OUT UINT8                           *Key,
+  OUT BOOLEAN                         *CacheMissing,
+  IN  EFI_HANDLE                      Device,
+  IN  CONST CHAR16                    **PredefinedPaths,
+  IN  UINTN                           NumPredefinedPaths,
+  IN  CONST EFI_DEVICE_PATH_PROTOCOL  *DevicePath  OPTIONAL
+  )
+{
+  EFI_STATUS                       Status;
+  SHA256_CONTEXT                   HashContext;
+  EFI_DEVICE_PATH_PROTOCOL         *DeviceDevicePath;
+  EFI_SIMPLE_FILE_SYSTEM_PROTOCOL  *SimpleFs;
+  EFI_FILE_PROTOCOL                *Root;
+  EFI_FILE_SYSTEM_INFO             *FileSystemInfo;
+  VOID                             *BlessInfo;
+  UINTN                            BlessInfoSize;
+  BOOLEAN                          HasBlessInfo;
+  UINTN                            Index;
+
+  if (!mScanCacheEnabled) {
+    return FALSE;
+  }
+
+  Status = gBS->HandleProtocol (
+                  Device,
+                  &gEfiDevicePathProtocolGuid,
+                  (VOID **)&DeviceDevicePath
+                  );
+  if (EFI_ERROR (Status)) {
+    return FALSE;
+  }
+
+  Status = gBS->HandleProtocol (
+                  Device,
+                  &gEfiSimpleFileSystemProtocolGuid,
+                  (VOID **)&SimpleFs
+                  );
+  if (EFI_ERROR (Status)) {
+    return FALSE;
+  }
+
+  Status = SimpleFs->OpenVolume (SimpleFs, &Root);
+  if (EFI_ERROR (Status)) {
+    return FALSE;
+  }
+
+  FileSystemInfo = OcGetFileInfo (Root, &gEfiFileSystemInfoGuid, sizeof (*FileSystemInfo), NULL);
+  if (FileSystemInfo == NULL) {
+    Root->Close (Root);
+    return FALSE;
+  }
+
+  //
+  // Key on volume identity, which is stable across boots. The device path
+  // carries partition GUID, and for APFS container and volume UUIDs.
+  //
+  Sha256Init (&HashContext);
+  Sha256Update (&HashContext, mScanCacheConfigDigest, sizeof (mScanCacheConfigDigest));
+  Sha256Update (&HashContext, (UINT8 *)DeviceDevicePath, GetDevicePathSize (DeviceDevicePath));
+  Sha256Update (&HashContext, (UINT8 *)&FileSystemInfo->ReadOnly, sizeof (FileSystemInfo->ReadOnly));
+  Sha256Update (&HashContext, (UINT8 *)&FileSystemInfo->VolumeSize, sizeof (FileSystemInfo->VolumeSize));
+  Sha256Update (&HashContext, (UINT8 *)&FileSystemInfo->BlockSize, sizeof (FileSystemInfo->BlockSize));
+
+  HasBlessInfo = FALSE;
+
+  BlessInfoSize = 0;
+  BlessInfo     = OcGetFileInfo (Root, &gAppleBlessedSystemFileInfoGuid, sizeof (EFI_DEVICE_PATH_PROTOCOL), &BlessInfoSize);
+  Sha256Update (&HashContext, (UINT8 *)&BlessInfoSize, sizeof (BlessInfoSize));
+  if (BlessInfo != NULL) {
+    Sha256Update (&HashContext, BlessInfo, BlessInfoSize);
+    FreePool (BlessInfo);
+    HasBlessInfo = TRUE;
+  }
+
+  BlessInfoSize = 0;
+  BlessInfo     = OcGetFileInfo (Root, &gAppleBlessedSystemFolderInfoGuid, sizeof (EFI_DEVICE_PATH_PROTOCOL), &BlessInfoSize);
+  Sha256Update (&HashContext, (UINT8 *)&BlessInfoSize, sizeof (BlessInfoSize));
+  if (BlessInfo != NULL) {
+    Sha256Update (&HashContext, BlessInfo, BlessInfoSize);
+    FreePool (BlessInfo);
+    HasBlessInfo = TRUE;
+  }
+
+  Root->Close (Root);
+
+  //
+  // Without bless info, changes to the volume are only noticeable through
+  // its usage. Found paths are revalidated on lookup, but nothing found is
+  // only cached with this fallback, as a stable key would keep it forever.
+  //
+  if (!HasBlessInfo) {
+    Sha256Update (&HashContext, (UINT8 *)&FileSystemInfo->FreeSpace, sizeof (FileSystemInfo->FreeSpace));
+  }
+
+  *CacheMissing = !HasBlessInfo;
+  FreePool (FileSystemInfo);
+
+  for (Index = 0; Index < NumPredefinedPaths; ++Index) {
+    Sha256Update (&HashContext, (UINT8 *)PredefinedPaths[Index], StrSize (PredefinedPaths[Index]));
+  }
+
+  //
+  // Lookups for a blessed path (e.g. its recovery) are distinguished from
+  // bless lookups by the path itself.
+  //
+  if (DevicePath != NULL) {
+    Sha256Update (&HashContext, (UINT8 *)DevicePath, GetDevicePathSize (DevicePath));
+  }
+
+  Sha256Final (&HashContext, Key);
+
+  //
+  // Zero keys mark discarded records.
+  //
+  if (IsZeroBuffer (Key, OC_SCAN_CACHE_KEY_SIZE)) {
+    Key[0] = 1;
+  }
+
+  return TRUE;
+}
+
+BOOLEAN
+InternalScanCacheLookup (
+  IN  CONST UINT8               *Key,
+  OUT EFI_DEVICE_PATH_PROTOCOL  **DevicePath
+  )
+{
+  OC_SCAN_CACHE_RECORD      *Record;
+  BOOLEAN                   IsNew;
+  EFI_DEVICE_PATH_PROTOCOL  *CachedDevicePath;
+
+  ASSERT (Key != NULL);
+  ASSERT (DevicePath != NULL);
+
+  *DevicePath = NULL;
+
+  if (!mScanCacheEnabled) {
+    return FALSE;
+  }
+
+  IsNew  = TRUE;
+  Record = ScanCacheFindRecord (mScanCacheNew, mScanCacheNewSize, Key);
+  if (Record == NULL) {
+    IsNew  = FALSE;
+    Record = ScanCacheFindRecord (mScanCacheOld, mScanCacheOldSize, Key);
+    if (Record == NULL) {
+      return FALSE;
+    }
+  }
+
+  CachedDevicePath = Record->Size > 0 ? (EFI_DEVICE_PATH_PROTOCOL *)(Record + 1) : NULL;
+
+  if ((CachedDevicePath != NULL) && !ScanCacheRevalidate (CachedDevicePath)) {
+    //
+    // The record will be replaced by the discovery result.
+    //
+    ZeroMem (Record->Key, sizeof (Record->Key));
+    mScanCacheDirty = TRUE;
+    return FALSE;
+  }
+
+  if (CachedDevicePath != NULL) {
+    *DevicePath = AllocateCopyPool (Record->Size, CachedDevicePath);
+    if (*DevicePath == NULL) {
+      return FALSE;
+    }
+  }
+
+  //
+  // Move used records to the front to keep them on save.
+  //
+  if (!IsNew) {
+    if (ScanCacheAppendRecord (Key, CachedDevicePath, Record->Size)) {
+      //
+      // Appending may not move old records, they are separate.
+      //
+      ZeroMem (Record->Key, sizeof (Record->Key));
+    }
+  }
+
+  return TRUE;
+}
+
+VOID
+InternalScanCacheStore (
+  IN CONST UINT8                     *Key,
+  IN CONST EFI_DEVICE_PATH_PROTOCOL  *DevicePath  OPTIONAL
+  )
+{
+  OC_SCAN_CACHE_RECORD  *Record;
+
+  ASSERT (Key != NULL);
+
+  if (!mScanCacheEnabled) {
+    return;
+  }
+
+  Record = ScanCacheFindRecord (mScanCacheNew, mScanCacheNewSize, Key);
+  if (Record != NULL) {
+    ZeroMem (Record->Key, sizeof (Record->Key));
+  }
+
+  Record = ScanCacheFindRecord (mScanCacheOld, mScanCacheOldSize, Key);
+  if (Record != NULL) {
+    ZeroMem (Record->Key, sizeof (Record->Key));
+  }
+
+  if (ScanCacheAppendRecord (Key, DevicePath, DevicePath != NULL ? (UINT32)GetDevicePathSize (DevicePath) : 0)) {
+    mScanCacheDirty = TRUE;
+  }
+}
@@ -880,62 +880,47 @@ InternalAddBootEntryFromCustomEntry (
 }
 
 /**
-  Create bootable entries from bless policy.
-  This function may create more than one entry, and for APFS
-  it will likely produce a sequence of 'OS, RECOVERY' entry pairs.
+  Obtain blessed device paths of the filesystem, custom bless paths first.
+  Results are cached in the scan cache when it is enabled.
 
-  @param[in,out] BootContext         Context of filesystems.
-  @param[in,out] FileSystem          Filesystem to scan for bless.
-  @param[in]     PredefinedPaths     The predefined boot file locations to scan.
-  @param[in]     NumPredefinedPaths  The number of elements in PredefinedPaths.
-  @param[in]     LazyScan            Lazy filesystem scanning.
-  @param[in]     Deduplicate         Ensure that duplicated entries are not added.
+  @param[in]  BootContext         Context of filesystems.
+  @param[in]  FileSystem          Filesystem to scan for bless.
+  @param[in]  PredefinedPaths     The predefined boot file locations to scan.
+  @param[in]  NumPredefinedPaths  The number of elements in PredefinedPaths.
+  @param[out] DevicePath          Allocated multi-instance blessed device path.
 
-  @retval EFI_STATUS for last created option.
+  @retval EFI_SUCCESS on success.
 **/
 STATIC
 EFI_STATUS
-AddBootEntryFromBless (
-  IN OUT OC_BOOT_CONTEXT     *BootContext,
-  IN OUT OC_BOOT_FILESYSTEM  *FileSystem,
-  IN     CONST CHAR16        **PredefinedPaths,
-  IN     UINTN               NumPredefinedPaths,
-  IN     BOOLEAN             LazyScan,
-  IN     BOOLEAN             Deduplicate
+GetBlessedDevicePath (
+  IN  OC_BOOT_CONTEXT           *BootContext,
+  IN  OC_BOOT_FILESYSTEM        *FileSystem,
+  IN  CONST CHAR16              **PredefinedPaths,
+  IN  UINTN                     NumPredefinedPaths,
+  OUT EFI_DEVICE_PATH_PROTOCOL  **DevicePath
   )
 {
   EFI_STATUS                       Status;
-  EFI_STATUS                       PrimaryStatus;
   EFI_SIMPLE_FILE_SYSTEM_PROTOCOL  *SimpleFs;
-  EFI_DEVICE_PATH_PROTOCOL         *DevicePath;
-  EFI_DEVICE_PATH_PROTOCOL         *DevicePathWalker;
-  EFI_DEVICE_PATH_PROTOCOL         *NewDevicePath;
-  UINTN                            NewDevicePathSize;
-  EFI_DEVICE_PATH_PROTOCOL         *HdDevicePath;
-  UINTN                            HdPrefixSize;
-  INTN                             CmpResult;
   EFI_FILE_PROTOCOL                *Root;
-  CHAR16                           *RecoveryPath;
-  EFI_FILE_PROTOCOL                *RecoveryRoot;
-  EFI_HANDLE                       RecoveryDeviceHandle;
+  BOOLEAN                          HasCacheKey;
+  BOOLEAN                          CacheMissing;
+  UINT8                            CacheKey[OC_SCAN_CACHE_KEY_SIZE];
 
-  //
-  // We need to ensure that blessed device paths are on the same filesystem.
-  // Read the prefix path.
-  //
-  Status = gBS->HandleProtocol (
+  HasCacheKey = InternalScanCacheGetKey (
+                  CacheKey,
+                  &CacheMissing,
                   FileSystem->Handle,
-                  &gEfiDevicePathProtocolGuid,
-                  (VOID **)&HdDevicePath
+                  PredefinedPaths,
+                  NumPredefinedPaths,
+                  NULL
                   );
-  if (EFI_ERROR (Status)) {
-    return EFI_UNSUPPORTED;
+  if (HasCacheKey && InternalScanCacheLookup (CacheKey, DevicePath)) {
+    DEBUG ((DEBUG_INFO, "OCB: Using cached bless for handle %p\n", FileSystem->Handle));
+    return *DevicePath != NULL ? EFI_SUCCESS : EFI_NOT_FOUND;
   }
 
-  DebugPrintDevicePath (DEBUG_INFO, "OCB: Adding bless entry on disk", HdDevicePath);
-
-  HdPrefixSize = GetDevicePathSize (HdDevicePath) - END_DEVICE_PATH_LENGTH;
-
   //
   // Custom bless paths have the priority, try to look them up first.
   //
@@ -954,7 +939,7 @@ AddBootEntryFromBless (
                    Root,
                    (CONST CHAR16 **)BootContext->PickerContext->CustomBootPaths,
                    BootContext->PickerContext->NumCustomBootPaths,
-                   &DevicePath,
+                   DevicePath,
                    NULL
                    );
 
@@ -973,10 +958,177 @@ AddBootEntryFromBless (
                FileSystem->Handle,
                PredefinedPaths,
                NumPredefinedPaths,
-               &DevicePath
+               DevicePath
                );
   }
 
+  //
+  // Do not remember transient failures.
+  //
+  if (HasCacheKey) {
+    if (!EFI_ERROR (Status)) {
+      InternalScanCacheStore (CacheKey, *DevicePath);
+    } else if ((Status == EFI_NOT_FOUND) && CacheMissing) {
+      InternalScanCacheStore (CacheKey, NULL);
+    }
+  }
+
+  return Status;
+}
+
+/**
+  Obtain APFS recovery device path for a blessed device path.
+  Results are cached in the scan cache when it is enabled.
+
+  @param[in]  FileSystem            Filesystem the blessed path belongs to.
+  @param[in]  DevicePath            Blessed device path instance.
+  @param[in]  PredefinedPaths       The predefined boot file locations to scan.
+  @param[in]  NumPredefinedPaths    The number of elements in PredefinedPaths.
+  @param[out] RecoveryDevicePath    Allocated recovery device path.
+  @param[out] RecoveryDeviceHandle  Recovery filesystem handle.
+
+  @retval EFI_SUCCESS on success.
+**/
+STATIC
+EFI_STATUS
+GetApfsRecoveryDevicePath (
+  IN  OC_BOOT_FILESYSTEM        *FileSystem,
+  IN  EFI_DEVICE_PATH_PROTOCOL  *DevicePath,
+  IN  CONST CHAR16              **PredefinedPaths,
+  IN  UINTN                     NumPredefinedPaths,
+  OUT EFI_DEVICE_PATH_PROTOCOL  **RecoveryDevicePath,
+  OUT EFI_HANDLE                *RecoveryDeviceHandle
+  )
+{
+  EFI_STATUS                Status;
+  EFI_DEVICE_PATH_PROTOCOL  *RemainingDevicePath;
+  CHAR16                    *RecoveryPath;
+  EFI_FILE_PROTOCOL         *RecoveryRoot;
+  BOOLEAN                   HasCacheKey;
+  BOOLEAN                   CacheMissing;
+  UINT8                     CacheKey[OC_SCAN_CACHE_KEY_SIZE];
+
+  HasCacheKey = InternalScanCacheGetKey (
+                  CacheKey,
+                  &CacheMissing,
+                  FileSystem->Handle,
+                  PredefinedPaths,
+                  NumPredefinedPaths,
+                  DevicePath
+                  );
+  if (HasCacheKey && InternalScanCacheLookup (CacheKey, RecoveryDevicePath)) {
+    if (*RecoveryDevicePath == NULL) {
+      return EFI_NOT_FOUND;
+    }
+
+    RemainingDevicePath = *RecoveryDevicePath;
+    Status              = gBS->LocateDevicePath (
+                                 &gEfiSimpleFileSystemProtocolGuid,
+                                 &RemainingDevicePath,
+                                 RecoveryDeviceHandle
+                                 );
+    if (!EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_INFO, "OCB: Using cached APFS recovery for handle %p\n", FileSystem->Handle));
+      return EFI_SUCCESS;
+    }
+
+    FreePool (*RecoveryDevicePath);
+  }
+
+  Status = OcBootPolicyGetApfsRecoveryFilePath (
+             DevicePath,
+             L"\\",
+             PredefinedPaths,
+             NumPredefinedPaths,
+             &RecoveryPath,
+             &RecoveryRoot,
+             RecoveryDeviceHandle
+             );
+  if (EFI_ERROR (Status)) {
+    if (HasCacheKey && CacheMissing && (Status == EFI_NOT_FOUND)) {
+      InternalScanCacheStore (CacheKey, NULL);
+    }
+
+    return Status;
+  }
+
+  RecoveryRoot->Close (RecoveryRoot);
+
+  *RecoveryDevicePath = FileDevicePath (*RecoveryDeviceHandle, RecoveryPath);
+  FreePool (RecoveryPath);
+  if (*RecoveryDevicePath == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  if (HasCacheKey) {
+    InternalScanCacheStore (CacheKey, *RecoveryDevicePath);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Create bootable entries from bless policy.
+  This function may create more than one entry, and for APFS
+  it will likely produce a sequence of 'OS, RECOVERY' entry pairs.
+
+  @param[in,out] BootContext         Context of filesystems.
+  @param[in,out] FileSystem          Filesystem to scan for bless.
+  @param[in]     PredefinedPaths     The predefined boot file locations to scan.
+  @param[in]     NumPredefinedPaths  The number of elements in PredefinedPaths.
+  @param[in]     LazyScan            Lazy filesystem scanning.
+  @param[in]     Deduplicate         Ensure that duplicated entries are not added.
+
+  @retval EFI_STATUS for last created option.
+**/
+STATIC
+EFI_STATUS
+AddBootEntryFromBless (
+  IN OUT OC_BOOT_CONTEXT     *BootContext,
+  IN OUT OC_BOOT_FILESYSTEM  *FileSystem,
+  IN     CONST CHAR16        **PredefinedPaths,
+  IN     UINTN               NumPredefinedPaths,
+  IN     BOOLEAN             LazyScan,
+  IN     BOOLEAN             Deduplicate
+  )
+{
+  EFI_STATUS                Status;
+  EFI_STATUS                PrimaryStatus;
+  EFI_DEVICE_PATH_PROTOCOL  *DevicePath;
+  EFI_DEVICE_PATH_PROTOCOL  *DevicePathWalker;
+  EFI_DEVICE_PATH_PROTOCOL  *NewDevicePath;
+  UINTN                     NewDevicePathSize;
+  EFI_DEVICE_PATH_PROTOCOL  *HdDevicePath;
+  UINTN                     HdPrefixSize;
+  INTN                      CmpResult;
+  EFI_DEVICE_PATH_PROTOCOL  *RecoveryDevicePath;
+  EFI_HANDLE                RecoveryDeviceHandle;
+
+  //
+  // We need to ensure that blessed device paths are on the same filesystem.
+  // Read the prefix path.
+  //
+  Status = gBS->HandleProtocol (
+                  FileSystem->Handle,
+                  &gEfiDevicePathProtocolGuid,
+                  (VOID **)&HdDevicePath
+                  );
+  if (EFI_ERROR (Status)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  DebugPrintDevicePath (DEBUG_INFO, "OCB: Adding bless entry on disk", HdDevicePath);
+
+  HdPrefixSize = GetDevicePathSize (HdDevicePath) - END_DEVICE_PATH_LENGTH;
+
+  Status = GetBlessedDevicePath (
+             BootContext,
+             FileSystem,
+             PredefinedPaths,
+             NumPredefinedPaths,
+             &DevicePath
+             );
+
   //
   // If both custom and normal found nothing, then nothing is blessed.
   //
@@ -1068,13 +1220,12 @@ AddBootEntryFromBless (
     //
     // Now add APFS recovery (from Recovery partition) right afterwards if present.
     //
-    Status = OcBootPolicyGetApfsRecoveryFilePath (
+    Status = GetApfsRecoveryDevicePath (
+               FileSystem,
                NewDevicePath,
-               L"\\",
                PredefinedPaths,
                NumPredefinedPaths,
-               &RecoveryPath,
-               &RecoveryRoot,
+               &RecoveryDevicePath,
                &RecoveryDeviceHandle
                );
 
@@ -1090,8 +1241,6 @@ AddBootEntryFromBless (
       continue;
     }
 
-    RecoveryRoot->Close (RecoveryRoot);
-
     //
     // Obtain recovery file system and ensure scan policy if it was not done before.
     //
@@ -1104,13 +1253,7 @@ AddBootEntryFromBless (
     // This is technically also a performance optimisation allowing us not to lookup recovery fs every time.
     //
     if ((FileSystem->RecoveryFs == NULL) || (FileSystem->RecoveryFs->Handle != RecoveryDeviceHandle)) {
-      FreePool (RecoveryPath);
-      continue;
-    }
-
-    NewDevicePath = FileDevicePath (RecoveryDeviceHandle, RecoveryPath);
-    FreePool (RecoveryPath);
-    if (NewDevicePath == NULL) {
+      FreePool (RecoveryDevicePath);
       continue;
     }
 
@@ -1120,12 +1263,12 @@ AddBootEntryFromBless (
     Status = AddBootEntryOnFileSystem (
                BootContext,
                FileSystem,
-               NewDevicePath,
+               RecoveryDevicePath,
                TRUE,
                Deduplicate
                );
     if (EFI_ERROR (Status)) {
-      FreePool (NewDevicePath);
+      FreePool (RecoveryDevicePath);
     }
   }
 
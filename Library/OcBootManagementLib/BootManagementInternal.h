@@ -286,4 +286,74 @@ InternalRunRequestPrivilege (
   IN OC_PRIVILEGE_LEVEL  Level
   );
 
+#define OC_SCAN_CACHE_KEY_SIZE  32U
+
+/**
+  Load boot entry discovery cache for the upcoming scan.
+  Cache is not used unless requested by the picker context.
+
+  @param[in] Context  Picker context.
+**/
+VOID
+InternalScanCacheInit (
+  IN OC_PICKER_CONTEXT  *Context
+  );
+
+/**
+  Save boot entry discovery cache when changed and release its resources.
+**/
+VOID
+InternalScanCacheFlush (
+  VOID
+  );
+
+/**
+  Compute discovery cache key from the filesystem identity and bless info.
+
+  @param[out] Key                 Cache key of OC_SCAN_CACHE_KEY_SIZE bytes.
+  @param[out] CacheMissing        Whether lookups finding nothing may be stored.
+  @param[in]  Device              Device handle with Simple File System.
+  @param[in]  PredefinedPaths     Custom bless paths used for the lookup.
+  @param[in]  NumPredefinedPaths  Number of custom bless paths.
+  @param[in]  DevicePath          Blessed path the lookup is done for, optional.
+
+  @retval TRUE when the key can be used for cache lookups.
+**/
+BOOLEAN
+InternalScanCacheGetKey (
+  OUT UINT8                           *Key,
+  OUT BOOLEAN                         *CacheMissing,
+  IN  EFI_HANDLE                      Device,
+  IN  CONST CHAR16                    **PredefinedPaths,
+  IN  UINTN                           NumPredefinedPaths,
+  IN  CONST EFI_DEVICE_PATH_PROTOCOL  *DevicePath  OPTIONAL
+  );
+
+/**
+  Lookup discovery result in the cache. Found paths are checked to still exist.
+
+  @param[in]  Key         Cache key.
+  @param[out] DevicePath  Allocated discovered device path, or NULL if
+                          nothing was discovered.
+
+  @retval TRUE when the result was found in the cache.
+**/
+BOOLEAN
+InternalScanCacheLookup (
+  IN  CONST UINT8               *Key,
+  OUT EFI_DEVICE_PATH_PROTOCOL  **DevicePath
+  );
+
+/**
+  Store discovery result in the cache.
+
+  @param[in] Key         Cache key.
+  @param[in] DevicePath  Discovered device path, or NULL if nothing was found.
+**/
+VOID
+InternalScanCacheStore (
+  IN CONST UINT8                     *Key,
+  IN CONST EFI_DEVICE_PATH_PROTOCOL  *DevicePath  OPTIONAL
+  );
+
 #endif // BOOT_MANAGEMENET_INTERNAL_H
@@ -108,76 +108,72 @@ InternalGetFirstDeviceBootFilePath (
 }
 
 STATIC
-EFI_DEVICE_PATH_PROTOCOL *
-InternalGetDiskImageBootFile (
-  OUT INTERNAL_DMG_LOAD_CONTEXT  *Context,
-  IN  OC_DMG_LOADING_SUPPORT     DmgLoading,
-  IN  UINTN                      DmgFileSize,
-  IN  VOID                       *ChunklistBuffer OPTIONAL,
-  IN  UINT32                     ChunklistBufferSize OPTIONAL
+BOOLEAN
+InternalVerifyDmgChunklist (
+  OUT OC_APPLE_CHUNKLIST_CONTEXT  *ChunklistContext,
+  IN  VOID                        *ChunklistBuffer OPTIONAL,
+  IN  UINT32                      ChunklistBufferSize OPTIONAL
   )
 {
-  EFI_DEVICE_PATH_PROTOCOL  *DevPath;
-
-  BOOLEAN                     Result;
-  OC_APPLE_CHUNKLIST_CONTEXT  ChunklistContext;
-
-  CONST EFI_DEVICE_PATH_PROTOCOL  *DmgDevicePath;
-  UINTN                           DmgDevicePathSize;
+  BOOLEAN  Result;
 
-  ASSERT (Context != NULL);
-  ASSERT (DmgFileSize > 0);
+  if (ChunklistBuffer == NULL) {
+    DEBUG ((DEBUG_WARN, "OCB: Missing DMG signature, aborting\n"));
+    return FALSE;
+  }
 
-  if (DmgLoading == OcDmgLoadingAppleSigned) {
-    if (ChunklistBuffer == NULL) {
-      DEBUG ((DEBUG_WARN, "OCB: Missing DMG signature, aborting\n"));
-      return NULL;
-    }
+  ASSERT (ChunklistBufferSize > 0);
 
-    ASSERT (ChunklistBufferSize > 0);
+  Result = OcAppleChunklistInitializeContext (
+             ChunklistContext,
+             ChunklistBuffer,
+             ChunklistBufferSize
+             );
+  if (!Result) {
+    DEBUG ((
+      DEBUG_INFO,
+      "OCB: Failed to initialise DMG Chunklist context\n"
+      ));
+    return FALSE;
+  }
 
-    Result = OcAppleChunklistInitializeContext (
-               &ChunklistContext,
-               ChunklistBuffer,
-               ChunklistBufferSize
-               );
-    if (!Result) {
-      DEBUG ((
-        DEBUG_INFO,
-        "OCB: Failed to initialise DMG Chunklist context\n"
-        ));
-      return NULL;
-    }
+  //
+  // FIXME: Properly abstract OcAppleKeysLib.
+  //
+  Result = OcAppleChunklistVerifySignature (
+             ChunklistContext,
+             PkDataBase[0].PublicKey
+             );
 
-    //
-    // FIXME: Properly abstract OcAppleKeysLib.
-    //
+  if (!Result) {
     Result = OcAppleChunklistVerifySignature (
-               &ChunklistContext,
-               PkDataBase[0].PublicKey
+               ChunklistContext,
+               PkDataBase[1].PublicKey
                );
+  }
 
-    if (!Result) {
-      Result = OcAppleChunklistVerifySignature (
-                 &ChunklistContext,
-                 PkDataBase[1].PublicKey
-                 );
-    }
+  if (!Result) {
+    DEBUG ((DEBUG_WARN, "OCB: DMG is not trusted, aborting\n"));
+    return FALSE;
+  }
 
-    if (!Result) {
-      DEBUG ((DEBUG_WARN, "OCB: DMG is not trusted, aborting\n"));
-      return NULL;
-    }
+  return TRUE;
+}
 
-    Result = OcAppleDiskImageVerifyData (
-               Context->DmgContext,
-               &ChunklistContext
-               );
-    if (!Result) {
-      DEBUG ((DEBUG_WARN, "OCB: DMG has been altered\n"));
-      return NULL;
-    }
-  }
+STATIC
+EFI_DEVICE_PATH_PROTOCOL *
+InternalGetDiskImageBootFile (
+  OUT INTERNAL_DMG_LOAD_CONTEXT  *Context,
+  IN  UINTN                      DmgFileSize
+  )
+{
+  EFI_DEVICE_PATH_PROTOCOL  *DevPath;
+
+  CONST EFI_DEVICE_PATH_PROTOCOL  *DmgDevicePath;
+  UINTN                           DmgDevicePathSize;
+
+  ASSERT (Context != NULL);
+  ASSERT (DmgFileSize > 0);
 
   Context->BlockIoHandle = OcAppleDiskImageInstallBlockIo (
                              Context->DmgContext,
@@ -338,6 +334,8 @@ InternalLoadDmg (
   UINT32             ChunklistFileSize;
   VOID               *ChunklistBuffer;
 
+  OC_APPLE_CHUNKLIST_CONTEXT  ChunklistContext;
+
   CHAR16  *DevPathText;
 
   ASSERT (Context != NULL);
@@ -405,25 +403,6 @@ InternalLoadDmg (
     return NULL;
   }
 
-  Context->DmgContext = AllocatePool (sizeof (*Context->DmgContext));
-  if (Context->DmgContext == NULL) {
-    DEBUG ((DEBUG_INFO, "OCB: Failed to allocate DMG context\n"));
-    return NULL;
-  }
-
-  Result = OcAppleDiskImageInitializeFromFile (Context->DmgContext, DmgFile);
-
-  DmgFile->Close (DmgFile);
-
-  if (!Result) {
-    DEBUG ((DEBUG_INFO, "OCB: Failed to initialise DMG from file\n"));
-
-    FreePool (DmgFileInfo);
-    FreePool (Context->DmgContext);
-    DmgDir->Close (DmgDir);
-    return NULL;
-  }
-
   ChunklistBuffer   = NULL;
   ChunklistFileSize = 0;
 
@@ -467,12 +446,53 @@ InternalLoadDmg (
 
   DmgDir->Close (DmgDir);
 
+  //
+  // Verify the signature before loading the DMG, and verify its data
+  // while loading to avoid reading it back.
+  //
+  if (DmgLoading == OcDmgLoadingAppleSigned) {
+    Result = InternalVerifyDmgChunklist (
+               &ChunklistContext,
+               ChunklistBuffer,
+               ChunklistFileSize
+               );
+  } else {
+    Result = TRUE;
+  }
+
+  if (Result) {
+    Context->DmgContext = AllocatePool (sizeof (*Context->DmgContext));
+    if (Context->DmgContext == NULL) {
+      DEBUG ((DEBUG_INFO, "OCB: Failed to allocate DMG context\n"));
+      Result = FALSE;
+    }
+  }
+
+  if (Result) {
+    Result = OcAppleDiskImageInitializeFromFile (
+               Context->DmgContext,
+               DmgFile,
+               DmgLoading == OcDmgLoadingAppleSigned ? &ChunklistContext : NULL
+               );
+    if (!Result) {
+      DEBUG ((DEBUG_WARN, "OCB: Failed to initialise DMG from file or DMG has been altered\n"));
+      FreePool (Context->DmgContext);
+    }
+  }
+
+  DmgFile->Close (DmgFile);
+
+  if (ChunklistBuffer != NULL) {
+    FreePool (ChunklistBuffer);
+  }
+
+  if (!Result) {
+    return NULL;
+  }
+
   DevPath = InternalGetDiskImageBootFile (
               Context,
-              DmgLoading,
-              DmgFileSize,
-              ChunklistBuffer,
-              ChunklistFileSize
+              DmgFileSize
               );
   Context->DevicePath = DevPath;
 
@@ -489,10 +509,6 @@ InternalLoadDmg (
     FreePool (Context->DmgContext);
   }
 
-  if (ChunklistBuffer != NULL) {
-    FreePool (ChunklistBuffer);
-  }
-
   return DevPath;
 }
 
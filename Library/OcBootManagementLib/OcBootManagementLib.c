@@ -334,6 +334,8 @@ OcRunBootPicker (
       Context->BootOrderCount = 0;
     }
 
+    InternalScanCacheInit (Context);
+
     //
     // Turbo-boost scanning when bypassing picker.
     //
@@ -353,6 +355,8 @@ OcRunBootPicker (
       BootContext = OcScanForBootEntries (Context);
     }
 
+    InternalScanCacheFlush ();
+
     //
     // We have no entries at all or have auxiliary entries.
     // Fallback to showing menu in the latter case.
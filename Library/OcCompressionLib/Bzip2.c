@@ -0,0 +1,622 @@
+/** @file
+  Copyright (C) 2026, Acidanthera. All rights reserved.
+
+  All rights reserved.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+**/
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/OcCompressionLib.h>
+
+#define BZIP2_BLOCK_SIZE_UNIT  100000U
+
+#define BZIP2_BLOCK_MAGIC_HI  0x314159U
+#define BZIP2_BLOCK_MAGIC_LO  0x265359U
+#define BZIP2_EOS_MAGIC_HI    0x177245U
+#define BZIP2_EOS_MAGIC_LO    0x385090U
+
+#define BZIP2_RUNA  0U
+#define BZIP2_RUNB  1U
+
+#define BZIP2_MIN_GROUPS       2U
+#define BZIP2_MAX_GROUPS       6U
+#define BZIP2_GROUP_SIZE       50U
+#define BZIP2_MAX_ALPHA_SIZE   258U
+#define BZIP2_MAX_CODE_LENGTH  20U
+#define BZIP2_MAX_SELECTORS    (2U + (9U * BZIP2_BLOCK_SIZE_UNIT) / BZIP2_GROUP_SIZE)
+
+//
+// Canonical Huffman decoding table, indexed by code length.
+//
+typedef struct {
+  INT32     Limit[BZIP2_MAX_CODE_LENGTH + 2];
+  INT32     Base[BZIP2_MAX_CODE_LENGTH + 2];
+  UINT16    Perm[BZIP2_MAX_ALPHA_SIZE];
+  UINT32    MinLength;
+  UINT32    MaxLength;
+} BZIP2_HUFFMAN_TABLE;
+
+typedef struct {
+  CONST UINT8    *Current;
+  CONST UINT8    *End;
+  UINT32         Buffer;
+  UINT32         BufferBits;
+  BOOLEAN        Overrun;
+} BZIP2_BIT_READER;
+
+typedef struct {
+  BZIP2_BIT_READER       Reader;
+  UINT32                 MaxBlockSize;
+  UINT32                 *Tt;
+  UINT32                 Counts[256];
+  UINT8                  SeqToUnseq[256];
+  UINT8                  Mtf[256];
+  UINT8                  Selectors[BZIP2_MAX_SELECTORS];
+  UINT8                  Lengths[BZIP2_MAX_ALPHA_SIZE];
+  BZIP2_HUFFMAN_TABLE    Tables[BZIP2_MAX_GROUPS];
+} BZIP2_DECODER;
+
+/**
+  Read up to 24 bits most significant bit first.
+  Reading past the end sets Overrun and returns 0.
+**/
+STATIC
+UINT32
+InternalBzip2ReadBits (
+  IN OUT BZIP2_BIT_READER  *Reader,
+  IN     UINT32            NumBits
+  )
+{
+  while (Reader->BufferBits < NumBits) {
+    if (Reader->Current == Reader->End) {
+      Reader->Overrun = TRUE;
+      return 0;
+    }
+
+    Reader->Buffer      = (Reader->Buffer << 8U) | *Reader->Current++;
+    Reader->BufferBits += 8;
+  }
+
+  Reader->BufferBits -= NumBits;
+  return (Reader->Buffer >> Reader->BufferBits) & ((1U << NumBits) - 1);
+}
+
+STATIC
+VOID
+InternalBzip2BuildTable (
+  IN  CONST UINT8          *Lengths,
+  IN  UINT32               AlphaSize,
+  OUT BZIP2_HUFFMAN_TABLE  *Table
+  )
+{
+  UINT32  Index;
+  UINT32  Length;
+  UINT32  PermIndex;
+  INT32   Code;
+
+  Table->MinLength = BZIP2_MAX_CODE_LENGTH;
+  Table->MaxLength = 0;
+  for (Index = 0; Index < AlphaSize; ++Index) {
+    Table->MinLength = MIN (Table->MinLength, Lengths[Index]);
+    Table->MaxLength = MAX (Table->MaxLength, Lengths[Index]);
+  }
+
+  //
+  // Symbols sorted by code length, then by value.
+  //
+  PermIndex = 0;
+  for (Length = Table->MinLength; Length <= Table->MaxLength; ++Length) {
+    for (Index = 0; Index < AlphaSize; ++Index) {
+      if (Lengths[Index] == Length) {
+        Table->Perm[PermIndex++] = (UINT16)Index;
+      }
+    }
+  }
+
+  //
+  // Base[L + 1] - Base[L] is the number of codes of length L.
+  //
+  ZeroMem (Table->Base, sizeof (Table->Base));
+  for (Index = 0; Index < AlphaSize; ++Index) {
+    ++Table->Base[Lengths[Index] + 1];
+  }
+
+  for (Length = 1; Length < ARRAY_SIZE (Table->Base); ++Length) {
+    Table->Base[Length] += Table->Base[Length - 1];
+  }
+
+  //
+  // Limit[L] is the largest code of length L.
+  //
+  ZeroMem (Table->Limit, sizeof (Table->Limit));
+  Code = 0;
+  for (Length = Table->MinLength; Length <= Table->MaxLength; ++Length) {
+    Code                += Table->Base[Length + 1] - Table->Base[Length];
+    Table->Limit[Length] = Code - 1;
+    Code               <<= 1U;
+  }
+
+  for (Length = Table->MinLength + 1; Length <= Table->MaxLength; ++Length) {
+    Table->Base[Length] = ((Table->Limit[Length - 1] + 1) << 1U) - Table->Base[Length];
+  }
+}
+
+STATIC
+BOOLEAN
+InternalBzip2DecodeSymbol (
+  IN OUT BZIP2_BIT_READER           *Reader,
+  IN     CONST BZIP2_HUFFMAN_TABLE  *Table,
+  IN     UINT32                     AlphaSize,
+  OUT    UINT32                     *Symbol
+  )
+{
+  UINT32  Length;
+  INT32   Code;
+  INT32   Index;
+
+  Length = Table->MinLength;
+  Code   = (INT32)InternalBzip2ReadBits (Reader, Length);
+
+  while (Code > Table->Limit[Length]) {
+    ++Length;
+    if (Length > Table->MaxLength) {
+      return FALSE;
+    }
+
+    Code = (Code << 1U) | (INT32)InternalBzip2ReadBits (Reader, 1);
+  }
+
+  Index = Code - Table->Base[Length];
+  if (Reader->Overrun || (Index < 0) || ((UINT32)Index >= AlphaSize)) {
+    return FALSE;
+  }
+
+  *Symbol = Table->Perm[Index];
+  return TRUE;
+}
+
+/**
+  Read block Huffman tables and decode MTF/RLE2 symbols into Tt.
+
+  @param[in,out] Decoder    Decoder state.
+  @param[out]    BlockSize  Number of decoded bytes.
+
+  @retval TRUE on success.
+**/
+STATIC
+BOOLEAN
+InternalBzip2ReadBlock (
+  IN OUT BZIP2_DECODER  *Decoder,
+  OUT    UINT32         *BlockSize
+  )
+{
+  BZIP2_BIT_READER  *Reader;
+  UINT32            Index;
+  UINT32            Bit;
+  UINT32            NumInUse;
+  UINT32            AlphaSize;
+  UINT32            NumGroups;
+  UINT32            NumSelectors;
+  UINT32            Group;
+  UINT32            Length;
+  UINT8             GroupMtf[BZIP2_MAX_GROUPS];
+  UINT8             Value;
+  UINT32            Symbol;
+  UINT32            EndOfBlock;
+  UINT32            SelectorIndex;
+  UINT32            GroupLeft;
+  UINT32            RunLength;
+  UINT32            RunWeight;
+  UINT32            Size;
+  UINT8             Byte;
+  UINT16            InUse16;
+
+  Reader = &Decoder->Reader;
+
+  //
+  // Used bytes are stored as a 16-bit map of 16-bit maps.
+  //
+  NumInUse = 0;
+  InUse16  = (UINT16)InternalBzip2ReadBits (Reader, 16);
+  for (Index = 0; Index < 16; ++Index) {
+    if ((InUse16 & (0x8000U >> Index)) != 0) {
+      Size = InternalBzip2ReadBits (Reader, 16);
+      for (Bit = 0; Bit < 16; ++Bit) {
+        if ((Size & (0x8000U >> Bit)) != 0) {
+          Decoder->SeqToUnseq[NumInUse++] = (UINT8)(Index * 16 + Bit);
+        }
+      }
+    }
+  }
+
+  if (NumInUse == 0) {
+    return FALSE;
+  }
+
+  AlphaSize = NumInUse + 2;
+
+  NumGroups = InternalBzip2ReadBits (Reader, 3);
+  if ((NumGroups < BZIP2_MIN_GROUPS) || (NumGroups > BZIP2_MAX_GROUPS)) {
+    return FALSE;
+  }
+
+  //
+  // Selectors are MTF encoded unary numbers. Newer encoders may write
+  // more selectors than could be used, the excess is ignored.
+  //
+  NumSelectors = InternalBzip2ReadBits (Reader, 15);
+  if (NumSelectors == 0) {
+    return FALSE;
+  }
+
+  for (Index = 0; Index < NumGroups; ++Index) {
+    GroupMtf[Index] = (UINT8)Index;
+  }
+
+  for (Index = 0; Index < NumSelectors; ++Index) {
+    Group = 0;
+    while (InternalBzip2ReadBits (Reader, 1) != 0) {
+      ++Group;
+      if (Group >= NumGroups) {
+        return FALSE;
+      }
+    }
+
+    if (Reader->Overrun) {
+      return FALSE;
+    }
+
+    Value = GroupMtf[Group];
+    while (Group > 0) {
+      GroupMtf[Group] = GroupMtf[Group - 1];
+      --Group;
+    }
+
+    GroupMtf[0] = Value;
+    if (Index < BZIP2_MAX_SELECTORS) {
+      Decoder->Selectors[Index] = Value;
+    }
+  }
+
+  NumSelectors = MIN (NumSelectors, BZIP2_MAX_SELECTORS);
+
+  //
+  // Code lengths are delta encoded.
+  //
+  for (Group = 0; Group < NumGroups; ++Group) {
+    Length = InternalBzip2ReadBits (Reader, 5);
+    for (Index = 0; Index < AlphaSize; ++Index) {
+      while (TRUE) {
+        if ((Length < 1) || (Length > BZIP2_MAX_CODE_LENGTH) || Reader->Overrun) {
+          return FALSE;
+        }
+
+        if (InternalBzip2ReadBits (Reader, 1) == 0) {
+          break;
+        }
+
+        if (InternalBzip2ReadBits (Reader, 1) == 0) {
+          ++Length;
+        } else {
+          --Length;
+        }
+      }
+
+      Decoder->Lengths[Index] = (UINT8)Length;
+    }
+
+    InternalBzip2BuildTable (Decoder->Lengths, AlphaSize, &Decoder->Tables[Group]);
+  }
+
+  //
+  // Decode symbols switching tables every 50 symbols.
+  // RUNA and RUNB encode repeats of the front MTF byte in bijective base 2.
+  //
+  for (Index = 0; Index < ARRAY_SIZE (Decoder->Mtf); ++Index) {
+    Decoder->Mtf[Index] = (UINT8)Index;
+  }
+
+  ZeroMem (Decoder->Counts, sizeof (Decoder->Counts));
+
+  EndOfBlock    = NumInUse + 1;
+  SelectorIndex = 0;
+  GroupLeft     = 0;
+  Group         = 0;
+  Size          = 0;
+  RunLength     = 0;
+  RunWeight     = 1;
+
+  while (TRUE) {
+    if (GroupLeft == 0) {
+      if (SelectorIndex >= NumSelectors) {
+        return FALSE;
+      }
+
+      Group     = Decoder->Selectors[SelectorIndex++];
+      GroupLeft = BZIP2_GROUP_SIZE;
+    }
+
+    --GroupLeft;
+
+    if (!InternalBzip2DecodeSymbol (Reader, &Decoder->Tables[Group], AlphaSize, &Symbol)) {
+      return FALSE;
+    }
+
+    if (Symbol <= BZIP2_RUNB) {
+      if (RunWeight > Decoder->MaxBlockSize) {
+        return FALSE;
+      }
+
+      RunLength += RunWeight << Symbol;
+      RunWeight <<= 1U;
+      continue;
+    }
+
+    if (RunLength > 0) {
+      if (RunLength > Decoder->MaxBlockSize - Size) {
+        return FALSE;
+      }
+
+      Byte                    = Decoder->SeqToUnseq[Decoder->Mtf[0]];
+      Decoder->Counts[Byte] += RunLength;
+      while (RunLength > 0) {
+        Decoder->Tt[Size++] = Byte;
+        --RunLength;
+      }
+
+      RunWeight = 1;
+    }
+
+    if (Symbol == EndOfBlock) {
+      break;
+    }
+
+    if (Size >= Decoder->MaxBlockSize) {
+      return FALSE;
+    }
+
+    Index = Symbol - 1;
+    Value = Decoder->Mtf[Index];
+    CopyMem (&Decoder->Mtf[1], &Decoder->Mtf[0], Index);
+    Decoder->Mtf[0] = Value;
+
+    Byte = Decoder->SeqToUnseq[Value];
+    ++Decoder->Counts[Byte];
+    Decoder->Tt[Size++] = Byte;
+  }
+
+  *BlockSize = Size;
+  return TRUE;
+}
+
+/**
+  Undo BWT and initial RLE for a decoded block.
+
+  @param[in,out] Decoder    Decoder state with Tt filled.
+  @param[in]     BlockSize  Number of bytes in Tt.
+  @param[in]     OrigPtr    BWT original pointer.
+  @param[in,out] DstCur     Current destination pointer.
+  @param[in]     DstEnd     Destination buffer end.
+
+  @retval TRUE on success.
+**/
+STATIC
+BOOLEAN
+InternalBzip2WriteBlock (
+  IN OUT BZIP2_DECODER  *Decoder,
+  IN     UINT32         BlockSize,
+  IN     UINT32         OrigPtr,
+  IN OUT UINT8          **DstCur,
+  IN     UINT8          *DstEnd
+  )
+{
+  UINT32  Index;
+  UINT32  Sum;
+  UINT32  Count;
+  UINT32  Position;
+  UINT8   *Dst;
+  UINT8   Byte;
+  UINT8   LastByte;
+  UINT32  RunCount;
+
+  if (OrigPtr >= BlockSize) {
+    return FALSE;
+  }
+
+  //
+  // Turn symbol counts into starting positions and link
+  // the inverse BWT vector into upper 24 bits of Tt.
+  //
+  Sum = 0;
+  for (Index = 0; Index < ARRAY_SIZE (Decoder->Counts); ++Index) {
+    Count                  = Decoder->Counts[Index];
+    Decoder->Counts[Index] = Sum;
+    Sum                   += Count;
+  }
+
+  for (Index = 0; Index < BlockSize; ++Index) {
+    Byte                                        = (UINT8)Decoder->Tt[Index];
+    Decoder->Tt[Decoder->Counts[Byte]++] |= Index << 8U;
+  }
+
+  //
+  // Four equal bytes are followed by an extra repeat count.
+  //
+  Dst      = *DstCur;
+  Position = Decoder->Tt[OrigPtr] >> 8U;
+  LastByte = 0;
+  RunCount = 0;
+
+  for (Index = 0; Index < BlockSize; ++Index) {
+    Position = Decoder->Tt[Position];
+    Byte     = (UINT8)Position;
+    Position >>= 8U;
+
+    if (RunCount == 4) {
+      if ((UINTN)(DstEnd - Dst) < Byte) {
+        return FALSE;
+      }
+
+      SetMem (Dst, Byte, LastByte);
+      Dst     += Byte;
+      RunCount = 0;
+      continue;
+    }
+
+    if ((RunCount > 0) && (Byte == LastByte)) {
+      ++RunCount;
+    } else {
+      RunCount = 1;
+      LastByte = Byte;
+    }
+
+    if (Dst == DstEnd) {
+      return FALSE;
+    }
+
+    *Dst++ = Byte;
+  }
+
+  *DstCur = Dst;
+  return TRUE;
+}
+
+UINTN
+DecompressBZIP2 (
+  OUT UINT8        *Dst,
+  IN  UINTN        DstLen,
+  IN  CONST UINT8  *Src,
+  IN  UINTN        SrcLen
+  )
+{
+  BZIP2_DECODER     *Decoder;
+  BZIP2_BIT_READER  *Reader;
+  UINT8             *DstCur;
+  UINT8             *DstEnd;
+  UINT32            Level;
+  UINT32            MagicHi;
+  UINT32            MagicLo;
+  UINT32            OrigPtr;
+  UINT32            BlockSize;
+  UINT32            NumStreams;
+  BOOLEAN           Result;
+
+  if ((SrcLen > OC_COMPRESSION_MAX_LENGTH) || (DstLen > OC_COMPRESSION_MAX_LENGTH)) {
+    return 0;
+  }
+
+  Decoder = AllocateZeroPool (sizeof (*Decoder));
+  if (Decoder == NULL) {
+    return 0;
+  }
+
+  Reader          = &Decoder->Reader;
+  Reader->Current = Src;
+  Reader->End     = Src + SrcLen;
+  DstCur          = Dst;
+  DstEnd          = Dst + DstLen;
+  NumStreams      = 0;
+  Result          = FALSE;
+
+  //
+  // Concatenated streams are decoded one by one, trailing garbage is ignored.
+  //
+  while (Reader->Current != Reader->End) {
+    if (  (InternalBzip2ReadBits (Reader, 8) != 'B')
+       || (InternalBzip2ReadBits (Reader, 8) != 'Z')
+       || (InternalBzip2ReadBits (Reader, 8) != 'h'))
+    {
+      Result = NumStreams > 0;
+      break;
+    }
+
+    Level = InternalBzip2ReadBits (Reader, 8);
+    if ((Level < '1') || (Level > '9')) {
+      Result = FALSE;
+      break;
+    }
+
+    Level -= '0';
+    if (Decoder->MaxBlockSize < Level * BZIP2_BLOCK_SIZE_UNIT) {
+      if (Decoder->Tt != NULL) {
+        FreePool (Decoder->Tt);
+      }
+
+      Decoder->MaxBlockSize = Level * BZIP2_BLOCK_SIZE_UNIT;
+      Decoder->Tt           = AllocatePool (Decoder->MaxBlockSize * sizeof (UINT32));
+      if (Decoder->Tt == NULL) {
+        Result = FALSE;
+        break;
+      }
+    }
+
+    Result = TRUE;
+    while (Result) {
+      MagicHi = InternalBzip2ReadBits (Reader, 24);
+      MagicLo = InternalBzip2ReadBits (Reader, 24);
+      //
+      // Stream and block CRCs are skipped.
+      //
+      InternalBzip2ReadBits (Reader, 16);
+      InternalBzip2ReadBits (Reader, 16);
+
+      if (Reader->Overrun) {
+        Result = FALSE;
+        break;
+      }
+
+      if ((MagicHi == BZIP2_EOS_MAGIC_HI) && (MagicLo == BZIP2_EOS_MAGIC_LO)) {
+        break;
+      }
+
+      if ((MagicHi != BZIP2_BLOCK_MAGIC_HI) || (MagicLo != BZIP2_BLOCK_MAGIC_LO)) {
+        Result = FALSE;
+        break;
+      }
+
+      //
+      // Randomised blocks are not produced since bzip2 0.9.5.
+      //
+      if (InternalBzip2ReadBits (Reader, 1) != 0) {
+        Result = FALSE;
+        break;
+      }
+
+      OrigPtr = InternalBzip2ReadBits (Reader, 24);
+
+      Result = InternalBzip2ReadBlock (Decoder, &BlockSize)
+               && InternalBzip2WriteBlock (Decoder, BlockSize, OrigPtr, &DstCur, DstEnd);
+    }
+
+    if (!Result) {
+      break;
+    }
+
+    //
+    // Streams are padded to byte boundary.
+    //
+    Reader->BufferBits = 0;
+    ++NumStreams;
+  }
+
+  if (Decoder->Tt != NULL) {
+    FreePool (Decoder->Tt);
+  }
+
+  FreePool (Decoder);
+
+  if (!Result) {
+    return 0;
+  }
+
+  return (UINTN)(DstCur - Dst);
+}
@@ -0,0 +1,845 @@
+/** @file
+  Copyright (C) 2026, Acidanthera. All rights reserved.
+
+  All rights reserved.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+**/
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/OcCompressionLib.h>
+
+//
+// LZFSE stream is a sequence of blocks terminated by end of stream block.
+// Every block starts with a little endian magic.
+//
+#define LZFSE_ENDOFSTREAM_BLOCK_MAGIC     0x24787662U ///< bvx$
+#define LZFSE_UNCOMPRESSED_BLOCK_MAGIC    0x2D787662U ///< bvx-
+#define LZFSE_COMPRESSEDV1_BLOCK_MAGIC    0x31787662U ///< bvx1
+#define LZFSE_COMPRESSEDV2_BLOCK_MAGIC    0x32787662U ///< bvx2
+#define LZFSE_COMPRESSEDLZVN_BLOCK_MAGIC  0x6E787662U ///< bvxn
+
+#define LZFSE_UNCOMPRESSED_HEADER_SIZE  8U
+#define LZFSE_LZVN_HEADER_SIZE          12U
+#define LZFSE_V1_HEADER_SIZE            772U
+#define LZFSE_V2_HEADER_SIZE            32U
+
+#define LZFSE_L_SYMBOLS        20U
+#define LZFSE_M_SYMBOLS        20U
+#define LZFSE_D_SYMBOLS        64U
+#define LZFSE_LITERAL_SYMBOLS  256U
+#define LZFSE_FREQ_COUNT       (LZFSE_L_SYMBOLS + LZFSE_M_SYMBOLS + LZFSE_D_SYMBOLS + LZFSE_LITERAL_SYMBOLS)
+
+#define LZFSE_L_STATES        64U
+#define LZFSE_M_STATES        64U
+#define LZFSE_D_STATES        256U
+#define LZFSE_LITERAL_STATES  1024U
+
+#define LZFSE_MATCHES_PER_BLOCK   10000U
+#define LZFSE_LITERALS_PER_BLOCK  (4U * LZFSE_MATCHES_PER_BLOCK)
+
+//
+// Decoded compressed block header, common for v1 and v2 blocks.
+//
+typedef struct {
+  UINT32    NumLiterals;
+  UINT32    NumMatches;
+  UINT32    NumLiteralPayloadBytes;
+  UINT32    NumLmdPayloadBytes;
+  INT32     LiteralBits;
+  UINT16    LiteralState[4];
+  INT32     LmdBits;
+  UINT16    LState;
+  UINT16    MState;
+  UINT16    DState;
+  //
+  // L, M, D and literal frequencies in this order.
+  //
+  UINT16    Freq[LZFSE_FREQ_COUNT];
+} LZFSE_BLOCK_HEADER;
+
+typedef struct {
+  UINT8     NumBits;
+  UINT8     Symbol;
+  UINT16    Delta;
+} LZFSE_LITERAL_DECODER_ENTRY;
+
+typedef struct {
+  UINT8     TotalBits;
+  UINT8     ValueBits;
+  UINT16    Delta;
+  UINT32    ValueBase;
+} LZFSE_VALUE_DECODER_ENTRY;
+
+//
+// Backward FSE bit stream. Bits are read from the most significant end.
+//
+typedef struct {
+  UINT64         Accum;
+  UINT32         AccumBits;
+  CONST UINT8    *Start;
+  CONST UINT8    *Current;
+} LZFSE_BIT_STREAM;
+
+typedef struct {
+  LZFSE_LITERAL_DECODER_ENTRY    LiteralDecoder[LZFSE_LITERAL_STATES];
+  LZFSE_VALUE_DECODER_ENTRY      LDecoder[LZFSE_L_STATES];
+  LZFSE_VALUE_DECODER_ENTRY      MDecoder[LZFSE_M_STATES];
+  LZFSE_VALUE_DECODER_ENTRY      DDecoder[LZFSE_D_STATES];
+  //
+  // Literals are decoded in groups of four.
+  //
+  UINT8                          Literals[LZFSE_LITERALS_PER_BLOCK + 4];
+} LZFSE_DECODER;
+
+STATIC CONST UINT8  mLzfseLExtraBits[LZFSE_L_SYMBOLS] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 5, 8
+};
+
+STATIC CONST UINT32  mLzfseLBaseValue[LZFSE_L_SYMBOLS] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 20, 28, 60
+};
+
+STATIC CONST UINT8  mLzfseMExtraBits[LZFSE_M_SYMBOLS] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 5, 8, 11
+};
+
+STATIC CONST UINT32  mLzfseMBaseValue[LZFSE_M_SYMBOLS] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 24, 56, 312
+};
+
+STATIC CONST UINT8  mLzfseDExtraBits[LZFSE_D_SYMBOLS] = {
+  0,  0,  0,  0,  1,  1,  1,  1,  2,  2,  2,  2,  3,  3,  3,  3,
+  4,  4,  4,  4,  5,  5,  5,  5,  6,  6,  6,  6,  7,  7,  7,  7,
+  8,  8,  8,  8,  9,  9,  9,  9,  10, 10, 10, 10, 11, 11, 11, 11,
+  12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15
+};
+
+STATIC CONST UINT32  mLzfseDBaseValue[LZFSE_D_SYMBOLS] = {
+  0,      1,      2,      3,      4,      6,      8,      10,
+  12,     16,     20,     24,     28,     36,     44,     52,
+  60,     76,     92,     108,    124,    156,    188,    220,
+  252,    316,    380,    444,    508,    636,    764,    892,
+  1020,   1276,   1532,   1788,   2044,   2556,   3068,   3580,
+  4092,   5116,   6140,   7164,   8188,   10236,  12284,  14332,
+  16380,  20476,  24572,  28668,  32764,  40956,  49148,  57340,
+  65532,  81916,  98300,  114684, 131068, 163836, 196604, 229372
+};
+
+//
+// V2 header frequencies are stored with variable length codes indexed
+// by the lowest 5 bits.
+//
+STATIC CONST UINT8  mLzfseFreqCodeBits[32] = {
+  2, 3, 2, 5, 2, 3, 2, 8, 2, 3, 2, 5, 2, 3, 2, 14,
+  2, 3, 2, 5, 2, 3, 2, 8, 2, 3, 2, 5, 2, 3, 2, 14
+};
+
+STATIC CONST UINT8  mLzfseFreqCodeValue[32] = {
+  0, 2, 1, 4, 0, 3, 1, 0, 0, 2, 1, 5, 0, 3, 1, 0,
+  0, 2, 1, 6, 0, 3, 1, 0, 0, 2, 1, 7, 0, 3, 1, 0
+};
+
+STATIC
+UINT32
+InternalLzfseGetField (
+  IN UINT64  Value,
+  IN UINT32  Offset,
+  IN UINT32  NumBits
+  )
+{
+  return (UINT32)((Value >> Offset) & ((1ULL << NumBits) - 1));
+}
+
+STATIC
+UINT32
+InternalLzfseHighBit (
+  IN UINT32  Value
+  )
+{
+  UINT32  Index;
+
+  Index = 0;
+  while (Value > 1) {
+    Value >>= 1U;
+    ++Index;
+  }
+
+  return Index;
+}
+
+STATIC
+BOOLEAN
+InternalLzfseReadHeaderV1 (
+  IN  CONST UINT8         *Src,
+  IN  UINTN               SrcLen,
+  OUT LZFSE_BLOCK_HEADER  *Header,
+  OUT UINTN               *HeaderSize
+  )
+{
+  UINT32  Index;
+
+  if (SrcLen < LZFSE_V1_HEADER_SIZE) {
+    return FALSE;
+  }
+
+  //
+  // Magic, raw and total payload byte counts are skipped.
+  //
+  Header->NumLiterals            = ReadUnaligned32 ((CONST UINT32 *)(Src + 12));
+  Header->NumMatches             = ReadUnaligned32 ((CONST UINT32 *)(Src + 16));
+  Header->NumLiteralPayloadBytes = ReadUnaligned32 ((CONST UINT32 *)(Src + 20));
+  Header->NumLmdPayloadBytes     = ReadUnaligned32 ((CONST UINT32 *)(Src + 24));
+  Header->LiteralBits            = (INT32)ReadUnaligned32 ((CONST UINT32 *)(Src + 28));
+  for (Index = 0; Index < ARRAY_SIZE (Header->LiteralState); ++Index) {
+    Header->LiteralState[Index] = ReadUnaligned16 ((CONST UINT16 *)(Src + 32 + Index * sizeof (UINT16)));
+  }
+
+  Header->LmdBits = (INT32)ReadUnaligned32 ((CONST UINT32 *)(Src + 40));
+  Header->LState  = ReadUnaligned16 ((CONST UINT16 *)(Src + 44));
+  Header->MState  = ReadUnaligned16 ((CONST UINT16 *)(Src + 46));
+  Header->DState  = ReadUnaligned16 ((CONST UINT16 *)(Src + 48));
+  for (Index = 0; Index < LZFSE_FREQ_COUNT; ++Index) {
+    Header->Freq[Index] = ReadUnaligned16 ((CONST UINT16 *)(Src + 50 + Index * sizeof (UINT16)));
+  }
+
+  *HeaderSize = LZFSE_V1_HEADER_SIZE;
+  return TRUE;
+}
+
+STATIC
+BOOLEAN
+InternalLzfseReadHeaderV2 (
+  IN  CONST UINT8         *Src,
+  IN  UINTN               SrcLen,
+  OUT LZFSE_BLOCK_HEADER  *Header,
+  OUT UINTN               *HeaderSize
+  )
+{
+  UINT64       Fields[3];
+  UINT32       Index;
+  UINT32       Size;
+  CONST UINT8  *FreqCur;
+  CONST UINT8  *FreqEnd;
+  UINT32       Accum;
+  UINT32       AccumBits;
+  UINT32       Code;
+  UINT32       CodeBits;
+
+  if (SrcLen < LZFSE_V2_HEADER_SIZE) {
+    return FALSE;
+  }
+
+  //
+  // Magic and raw byte count are skipped.
+  //
+  for (Index = 0; Index < ARRAY_SIZE (Fields); ++Index) {
+    Fields[Index] = ReadUnaligned64 ((CONST UINT64 *)(Src + 8 + Index * sizeof (UINT64)));
+  }
+
+  Header->NumLiterals            = InternalLzfseGetField (Fields[0], 0, 20);
+  Header->NumLiteralPayloadBytes = InternalLzfseGetField (Fields[0], 20, 20);
+  Header->NumMatches             = InternalLzfseGetField (Fields[0], 40, 20);
+  Header->LiteralBits            = (INT32)InternalLzfseGetField (Fields[0], 60, 3) - 7;
+  Header->LiteralState[0]        = (UINT16)InternalLzfseGetField (Fields[1], 0, 10);
+  Header->LiteralState[1]        = (UINT16)InternalLzfseGetField (Fields[1], 10, 10);
+  Header->LiteralState[2]        = (UINT16)InternalLzfseGetField (Fields[1], 20, 10);
+  Header->LiteralState[3]        = (UINT16)InternalLzfseGetField (Fields[1], 30, 10);
+  Header->NumLmdPayloadBytes     = InternalLzfseGetField (Fields[1], 40, 20);
+  Header->LmdBits                = (INT32)InternalLzfseGetField (Fields[1], 60, 3) - 7;
+  Size                           = InternalLzfseGetField (Fields[2], 0, 32);
+  Header->LState                 = (UINT16)InternalLzfseGetField (Fields[2], 32, 10);
+  Header->MState                 = (UINT16)InternalLzfseGetField (Fields[2], 42, 10);
+  Header->DState                 = (UINT16)InternalLzfseGetField (Fields[2], 52, 10);
+
+  if ((Size < LZFSE_V2_HEADER_SIZE) || (Size > SrcLen)) {
+    return FALSE;
+  }
+
+  //
+  // Frequencies are packed little endian right after the fields.
+  // Missing frequency table means all frequencies are zero.
+  //
+  FreqCur   = Src + LZFSE_V2_HEADER_SIZE;
+  FreqEnd   = Src + Size;
+  Accum     = 0;
+  AccumBits = 0;
+
+  for (Index = 0; Index < LZFSE_FREQ_COUNT; ++Index) {
+    while (FreqCur < FreqEnd && AccumBits + 8 <= 32) {
+      Accum     |= (UINT32)*FreqCur << AccumBits;
+      AccumBits += 8;
+      ++FreqCur;
+    }
+
+    Code     = Accum & 0x1FU;
+    CodeBits = mLzfseFreqCodeBits[Code];
+    if (CodeBits > AccumBits) {
+      if (Size == LZFSE_V2_HEADER_SIZE) {
+        ZeroMem (Header->Freq, sizeof (Header->Freq));
+        break;
+      }
+
+      return FALSE;
+    }
+
+    if (CodeBits == 8) {
+      Header->Freq[Index] = (UINT16)(8 + ((Accum >> 4U) & 0x0FU));
+    } else if (CodeBits == 14) {
+      Header->Freq[Index] = (UINT16)(24 + ((Accum >> 4U) & 0x3FFU));
+    } else {
+      Header->Freq[Index] = mLzfseFreqCodeValue[Code];
+    }
+
+    Accum    >>= CodeBits;
+    AccumBits -= CodeBits;
+  }
+
+  if ((AccumBits >= 8) || (FreqCur != FreqEnd)) {
+    return FALSE;
+  }
+
+  *HeaderSize = Size;
+  return TRUE;
+}
+
+STATIC
+BOOLEAN
+InternalLzfseCheckFreq (
+  IN CONST UINT16  *Freq,
+  IN UINT32        NumSymbols,
+  IN UINT32        NumStates
+  )
+{
+  UINT32  Index;
+  UINT32  Sum;
+
+  Sum = 0;
+  for (Index = 0; Index < NumSymbols; ++Index) {
+    Sum += Freq[Index];
+  }
+
+  return Sum <= NumStates;
+}
+
+STATIC
+BOOLEAN
+InternalLzfseCheckHeader (
+  IN CONST LZFSE_BLOCK_HEADER  *Header
+  )
+{
+  CONST UINT16  *Freq;
+
+  if (  (Header->NumLiterals > LZFSE_LITERALS_PER_BLOCK)
+     || (Header->NumMatches > LZFSE_MATCHES_PER_BLOCK)
+     || (Header->LiteralState[0] >= LZFSE_LITERAL_STATES)
+     || (Header->LiteralState[1] >= LZFSE_LITERAL_STATES)
+     || (Header->LiteralState[2] >= LZFSE_LITERAL_STATES)
+     || (Header->LiteralState[3] >= LZFSE_LITERAL_STATES)
+     || (Header->LState >= LZFSE_L_STATES)
+     || (Header->MState >= LZFSE_M_STATES)
+     || (Header->DState >= LZFSE_D_STATES))
+  {
+    return FALSE;
+  }
+
+  Freq = Header->Freq;
+  if (!InternalLzfseCheckFreq (Freq, LZFSE_L_SYMBOLS, LZFSE_L_STATES)) {
+    return FALSE;
+  }
+
+  Freq += LZFSE_L_SYMBOLS;
+  if (!InternalLzfseCheckFreq (Freq, LZFSE_M_SYMBOLS, LZFSE_M_STATES)) {
+    return FALSE;
+  }
+
+  Freq += LZFSE_M_SYMBOLS;
+  if (!InternalLzfseCheckFreq (Freq, LZFSE_D_SYMBOLS, LZFSE_D_STATES)) {
+    return FALSE;
+  }
+
+  Freq += LZFSE_D_SYMBOLS;
+  return InternalLzfseCheckFreq (Freq, LZFSE_LITERAL_SYMBOLS, LZFSE_LITERAL_STATES);
+}
+
+/**
+  Build FSE literal decoding table. Frequencies must be checked.
+  States not covered by frequencies decode to symbol 0 and state 0.
+**/
+STATIC
+VOID
+InternalLzfseInitLiteralDecoder (
+  IN  CONST UINT16                 *Freq,
+  OUT LZFSE_LITERAL_DECODER_ENTRY  *Table
+  )
+{
+  UINT32  Symbol;
+  UINT32  SymbolFreq;
+  UINT32  Shift;
+  UINT32  Threshold;
+  UINT32  Index;
+  UINT32  StateBits;
+
+  ZeroMem (Table, sizeof (*Table) * LZFSE_LITERAL_STATES);
+
+  StateBits = InternalLzfseHighBit (LZFSE_LITERAL_STATES);
+
+  for (Symbol = 0; Symbol < LZFSE_LITERAL_SYMBOLS; ++Symbol) {
+    SymbolFreq = Freq[Symbol];
+    if (SymbolFreq == 0) {
+      continue;
+    }
+
+    //
+    // Shift ensures N <= (F << Shift) < 2 * N.
+    //
+    Shift     = StateBits - InternalLzfseHighBit (SymbolFreq);
+    Threshold = ((2 * LZFSE_LITERAL_STATES) >> Shift) - SymbolFreq;
+
+    for (Index = 0; Index < SymbolFreq; ++Index, ++Table) {
+      Table->Symbol = (UINT8)Symbol;
+      if (Index < Threshold) {
+        Table->NumBits = (UINT8)Shift;
+        Table->Delta   = (UINT16)(((SymbolFreq + Index) << Shift) - LZFSE_LITERAL_STATES);
+      } else {
+        Table->NumBits = (UINT8)(Shift - 1);
+        Table->Delta   = (UINT16)((Index - Threshold) << (Shift - 1));
+      }
+    }
+  }
+}
+
+/**
+  Build FSE value decoding table. Frequencies must be checked.
+  States not covered by frequencies decode to value 0 and state 0.
+**/
+STATIC
+VOID
+InternalLzfseInitValueDecoder (
+  IN  UINT32                     NumStates,
+  IN  UINT32                     NumSymbols,
+  IN  CONST UINT16               *Freq,
+  IN  CONST UINT8                *ExtraBits,
+  IN  CONST UINT32               *BaseValue,
+  OUT LZFSE_VALUE_DECODER_ENTRY  *Table
+  )
+{
+  UINT32  Symbol;
+  UINT32  SymbolFreq;
+  UINT32  Shift;
+  UINT32  Threshold;
+  UINT32  Index;
+  UINT32  StateBits;
+
+  ZeroMem (Table, sizeof (*Table) * NumStates);
+
+  StateBits = InternalLzfseHighBit (NumStates);
+
+  for (Symbol = 0; Symbol < NumSymbols; ++Symbol) {
+    SymbolFreq = Freq[Symbol];
+    if (SymbolFreq == 0) {
+      continue;
+    }
+
+    Shift     = StateBits - InternalLzfseHighBit (SymbolFreq);
+    Threshold = ((2 * NumStates) >> Shift) - SymbolFreq;
+
+    for (Index = 0; Index < SymbolFreq; ++Index, ++Table) {
+      Table->ValueBits = ExtraBits[Symbol];
+      Table->ValueBase = BaseValue[Symbol];
+      if (Index < Threshold) {
+        Table->TotalBits = (UINT8)(Shift + ExtraBits[Symbol]);
+        Table->Delta     = (UINT16)(((SymbolFreq + Index) << Shift) - NumStates);
+      } else {
+        Table->TotalBits = (UINT8)(Shift - 1 + ExtraBits[Symbol]);
+        Table->Delta     = (UINT16)((Index - Threshold) << (Shift - 1));
+      }
+    }
+  }
+}
+
+/**
+  Initialise backward bit stream ending at End.
+  Bytes before Start are read as zeroes.
+**/
+STATIC
+BOOLEAN
+InternalLzfseBitStreamInit (
+  OUT LZFSE_BIT_STREAM  *Stream,
+  IN  CONST UINT8       *Start,
+  IN  CONST UINT8       *End,
+  IN  INT32             ExtraBits
+  )
+{
+  UINT32  NumBytes;
+  UINT32  Index;
+
+  if ((ExtraBits < -7) || (ExtraBits > 0)) {
+    return FALSE;
+  }
+
+  //
+  // Non-zero ExtraBits means the last byte is partially filled.
+  //
+  NumBytes          = ExtraBits != 0 ? 8 : 7;
+  Stream->Start     = Start;
+  Stream->Current   = End;
+  Stream->Accum     = 0;
+  Stream->AccumBits = (UINT32)((INT32)NumBytes * 8 + ExtraBits);
+
+  for (Index = 0; Index < NumBytes; ++Index) {
+    Stream->Accum <<= 8U;
+    if (Stream->Current > Start) {
+      --Stream->Current;
+      Stream->Accum |= *Stream->Current;
+    }
+  }
+
+  return (Stream->Accum >> Stream->AccumBits) == 0;
+}
+
+/**
+  Refill bit stream to contain 56 to 63 bits.
+**/
+STATIC
+VOID
+InternalLzfseBitStreamFlush (
+  IN OUT LZFSE_BIT_STREAM  *Stream
+  )
+{
+  while (Stream->AccumBits < 56) {
+    Stream->Accum    <<= 8U;
+    Stream->AccumBits += 8;
+    if (Stream->Current > Stream->Start) {
+      --Stream->Current;
+      Stream->Accum |= *Stream->Current;
+    }
+  }
+}
+
+STATIC
+UINT32
+InternalLzfseBitStreamPull (
+  IN OUT LZFSE_BIT_STREAM  *Stream,
+  IN     UINT32            NumBits
+  )
+{
+  UINT32  Result;
+
+  Stream->AccumBits -= NumBits;
+  Result             = (UINT32)(Stream->Accum >> Stream->AccumBits);
+  Stream->Accum     &= (1ULL << Stream->AccumBits) - 1;
+  return Result;
+}
+
+STATIC
+UINT8
+InternalLzfseDecodeLiteral (
+  IN OUT UINT16                             *State,
+  IN     CONST LZFSE_LITERAL_DECODER_ENTRY  *Table,
+  IN OUT LZFSE_BIT_STREAM                   *Stream
+  )
+{
+  CONST LZFSE_LITERAL_DECODER_ENTRY  *Entry;
+
+  Entry  = &Table[*State];
+  *State = (UINT16)(Entry->Delta + InternalLzfseBitStreamPull (Stream, Entry->NumBits));
+  return Entry->Symbol;
+}
+
+STATIC
+UINT32
+InternalLzfseDecodeValue (
+  IN OUT UINT16                           *State,
+  IN     CONST LZFSE_VALUE_DECODER_ENTRY  *Table,
+  IN OUT LZFSE_BIT_STREAM                 *Stream
+  )
+{
+  CONST LZFSE_VALUE_DECODER_ENTRY  *Entry;
+  UINT32                           Bits;
+
+  Entry  = &Table[*State];
+  Bits   = InternalLzfseBitStreamPull (Stream, Entry->TotalBits);
+  *State = (UINT16)(Entry->Delta + (Bits >> Entry->ValueBits));
+  return Entry->ValueBase + (Bits & ((1U << Entry->ValueBits) - 1));
+}
+
+/**
+  Decode compressed block payload.
+
+  @param[in,out] Decoder   Decoder tables.
+  @param[in]     Header    Checked block header.
+  @param[in]     Payload   Block payload right after the header.
+  @param[in]     DstStart  Destination buffer start, matches may refer to previous blocks.
+  @param[in,out] DstCur    Current destination pointer.
+  @param[in]     DstEnd    Destination buffer end.
+
+  @retval TRUE on success.
+**/
+STATIC
+BOOLEAN
+InternalLzfseDecodeCompressedBlock (
+  IN OUT LZFSE_DECODER             *Decoder,
+  IN     CONST LZFSE_BLOCK_HEADER  *Header,
+  IN     CONST UINT8               *Payload,
+  IN     UINT8                     *DstStart,
+  IN OUT UINT8                     **DstCur,
+  IN     UINT8                     *DstEnd
+  )
+{
+  LZFSE_BIT_STREAM  Stream;
+  CONST UINT8       *LmdStart;
+  UINT16            LiteralState[4];
+  UINT16            LState;
+  UINT16            MState;
+  UINT16            DState;
+  UINT32            Index;
+  UINT8             *Dst;
+  CONST UINT8       *Literal;
+  CONST UINT8       *LiteralEnd;
+  UINT32            L;
+  UINT32            M;
+  UINT32            D;
+  UINT32            NewD;
+
+  InternalLzfseInitLiteralDecoder (
+    &Header->Freq[LZFSE_L_SYMBOLS + LZFSE_M_SYMBOLS + LZFSE_D_SYMBOLS],
+    Decoder->LiteralDecoder
+    );
+  InternalLzfseInitValueDecoder (
+    LZFSE_L_STATES,
+    LZFSE_L_SYMBOLS,
+    &Header->Freq[0],
+    mLzfseLExtraBits,
+    mLzfseLBaseValue,
+    Decoder->LDecoder
+    );
+  InternalLzfseInitValueDecoder (
+    LZFSE_M_STATES,
+    LZFSE_M_SYMBOLS,
+    &Header->Freq[LZFSE_L_SYMBOLS],
+    mLzfseMExtraBits,
+    mLzfseMBaseValue,
+    Decoder->MDecoder
+    );
+  InternalLzfseInitValueDecoder (
+    LZFSE_D_STATES,
+    LZFSE_D_SYMBOLS,
+    &Header->Freq[LZFSE_L_SYMBOLS + LZFSE_M_SYMBOLS],
+    mLzfseDExtraBits,
+    mLzfseDBaseValue,
+    Decoder->DDecoder
+    );
+
+  //
+  // Literals are encoded with four interleaved FSE states.
+  // Each iteration consumes at most 4 * 10 bits.
+  //
+  LmdStart = Payload + Header->NumLiteralPayloadBytes;
+  if (!InternalLzfseBitStreamInit (&Stream, Payload, LmdStart, Header->LiteralBits)) {
+    return FALSE;
+  }
+
+  CopyMem (LiteralState, Header->LiteralState, sizeof (LiteralState));
+
+  for (Index = 0; Index < Header->NumLiterals; Index += 4) {
+    InternalLzfseBitStreamFlush (&Stream);
+    Decoder->Literals[Index + 0] = InternalLzfseDecodeLiteral (&LiteralState[0], Decoder->LiteralDecoder, &Stream);
+    Decoder->Literals[Index + 1] = InternalLzfseDecodeLiteral (&LiteralState[1], Decoder->LiteralDecoder, &Stream);
+    Decoder->Literals[Index + 2] = InternalLzfseDecodeLiteral (&LiteralState[2], Decoder->LiteralDecoder, &Stream);
+    Decoder->Literals[Index + 3] = InternalLzfseDecodeLiteral (&LiteralState[3], Decoder->LiteralDecoder, &Stream);
+  }
+
+  //
+  // Each match is a triple of literal count, match length and distance.
+  // Zero distance repeats the previous one. Each iteration consumes
+  // at most 14 + 17 + 23 bits.
+  //
+  if (!InternalLzfseBitStreamInit (&Stream, LmdStart, LmdStart + Header->NumLmdPayloadBytes, Header->LmdBits)) {
+    return FALSE;
+  }
+
+  LState     = Header->LState;
+  MState     = Header->MState;
+  DState     = Header->DState;
+  Dst        = *DstCur;
+  Literal    = Decoder->Literals;
+  LiteralEnd = Decoder->Literals + Header->NumLiterals;
+  D          = 0;
+
+  for (Index = 0; Index < Header->NumMatches; ++Index) {
+    InternalLzfseBitStreamFlush (&Stream);
+    L    = InternalLzfseDecodeValue (&LState, Decoder->LDecoder, &Stream);
+    M    = InternalLzfseDecodeValue (&MState, Decoder->MDecoder, &Stream);
+    NewD = InternalLzfseDecodeValue (&DState, Decoder->DDecoder, &Stream);
+    if (NewD != 0) {
+      D = NewD;
+    }
+
+    if (  ((UINTN)(LiteralEnd - Literal) < L)
+       || ((UINTN)(DstEnd - Dst) < (UINTN)L + M))
+    {
+      return FALSE;
+    }
+
+    CopyMem (Dst, Literal, L);
+    Dst     += L;
+    Literal += L;
+
+    if (M == 0) {
+      continue;
+    }
+
+    if ((D == 0) || ((UINTN)(Dst - DstStart) < D)) {
+      return FALSE;
+    }
+
+    if (D >= M) {
+      CopyMem (Dst, Dst - D, M);
+      Dst += M;
+    } else {
+      //
+      // Overlapping match repeats the last D bytes.
+      //
+      while (M > 0) {
+        *Dst = *(Dst - D);
+        ++Dst;
+        --M;
+      }
+    }
+  }
+
+  *DstCur = Dst;
+  return TRUE;
+}
+
+UINTN
+DecompressLZFSE (
+  OUT UINT8        *Dst,
+  IN  UINTN        DstLen,
+  IN  CONST UINT8  *Src,
+  IN  UINTN        SrcLen
+  )
+{
+  LZFSE_DECODER       *Decoder;
+  LZFSE_BLOCK_HEADER  Header;
+  CONST UINT8         *SrcEnd;
+  UINT8               *DstCur;
+  UINT8               *DstEnd;
+  UINT32              Magic;
+  UINT32              RawSize;
+  UINT32              PayloadSize;
+  UINTN               HeaderSize;
+  BOOLEAN             Result;
+
+  if ((SrcLen > OC_COMPRESSION_MAX_LENGTH) || (DstLen > OC_COMPRESSION_MAX_LENGTH)) {
+    return 0;
+  }
+
+  Decoder = NULL;
+  SrcEnd  = Src + SrcLen;
+  DstCur  = Dst;
+  DstEnd  = Dst + DstLen;
+  Result  = FALSE;
+
+  while ((UINTN)(SrcEnd - Src) >= sizeof (UINT32)) {
+    Magic = ReadUnaligned32 ((CONST UINT32 *)Src);
+
+    if (Magic == LZFSE_ENDOFSTREAM_BLOCK_MAGIC) {
+      Result = TRUE;
+      break;
+    }
+
+    if (Magic == LZFSE_UNCOMPRESSED_BLOCK_MAGIC) {
+      if ((UINTN)(SrcEnd - Src) < LZFSE_UNCOMPRESSED_HEADER_SIZE) {
+        break;
+      }
+
+      RawSize = ReadUnaligned32 ((CONST UINT32 *)(Src + 4));
+      Src    += LZFSE_UNCOMPRESSED_HEADER_SIZE;
+      if (((UINTN)(SrcEnd - Src) < RawSize) || ((UINTN)(DstEnd - DstCur) < RawSize)) {
+        break;
+      }
+
+      CopyMem (DstCur, Src, RawSize);
+      DstCur += RawSize;
+      Src    += RawSize;
+      continue;
+    }
+
+    if (Magic == LZFSE_COMPRESSEDLZVN_BLOCK_MAGIC) {
+      if ((UINTN)(SrcEnd - Src) < LZFSE_LZVN_HEADER_SIZE) {
+        break;
+      }
+
+      RawSize     = ReadUnaligned32 ((CONST UINT32 *)(Src + 4));
+      PayloadSize = ReadUnaligned32 ((CONST UINT32 *)(Src + 8));
+      Src        += LZFSE_LZVN_HEADER_SIZE;
+      if (((UINTN)(SrcEnd - Src) < PayloadSize) || ((UINTN)(DstEnd - DstCur) < RawSize)) {
+        break;
+      }
+
+      //
+      // LZVN blocks are only emitted for small inputs as the only block,
+      // so they never refer to the previous output.
+      //
+      if (DecompressLZVN (DstCur, RawSize, Src, PayloadSize) != RawSize) {
+        break;
+      }
+
+      DstCur += RawSize;
+      Src    += PayloadSize;
+      continue;
+    }
+
+    if (Magic == LZFSE_COMPRESSEDV1_BLOCK_MAGIC) {
+      Result = InternalLzfseReadHeaderV1 (Src, (UINTN)(SrcEnd - Src), &Header, &HeaderSize);
+    } else if (Magic == LZFSE_COMPRESSEDV2_BLOCK_MAGIC) {
+      Result = InternalLzfseReadHeaderV2 (Src, (UINTN)(SrcEnd - Src), &Header, &HeaderSize);
+    } else {
+      Result = FALSE;
+    }
+
+    if (!Result || !InternalLzfseCheckHeader (&Header)) {
+      Result = FALSE;
+      break;
+    }
+
+    Result = FALSE;
+    Src   += HeaderSize;
+    if ((UINTN)(SrcEnd - Src) < (UINTN)Header.NumLiteralPayloadBytes + Header.NumLmdPayloadBytes) {
+      break;
+    }
+
+    if (Decoder == NULL) {
+      Decoder = AllocatePool (sizeof (*Decoder));
+      if (Decoder == NULL) {
+        break;
+      }
+    }
+
+    if (!InternalLzfseDecodeCompressedBlock (Decoder, &Header, Src, Dst, &DstCur, DstEnd)) {
+      break;
+    }
+
+    Src += Header.NumLiteralPayloadBytes + Header.NumLmdPayloadBytes;
+  }
+
+  if (Decoder != NULL) {
+    FreePool (Decoder);
+  }
+
+  if (!Result) {
+    return 0;
+  }
+
+  return (UINTN)(DstCur - Dst);
+}
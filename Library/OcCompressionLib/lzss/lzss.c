@@ -137,6 +137,122 @@ u_int32_t decompress_lzss(
     return (u_int32_t)(dst - dststart);
 }
 
+struct decode_state {
+    /* ring buffer of size N, with extra F-1 bytes to aid string comparison */
+    u_int8_t text_buf[N + F - 1];
+    u_int8_t * dststart;
+    u_int8_t * dst;
+    const u_int8_t * dstend;
+    int r;
+};
+
+/*******************************************************************************
+*******************************************************************************/
+void * decompress_lzss_start(
+    u_int8_t       * dst,
+    u_int32_t        dstlen)
+{
+    struct decode_state * sp;
+
+    if (dstlen > OC_COMPRESSION_MAX_LENGTH) {
+        return NULL;
+    }
+
+    sp = malloc(sizeof(*sp));
+    if (sp == NULL) {
+        return NULL;
+    }
+
+    bzero(sp, sizeof(*sp));
+    memset(sp->text_buf, ' ', N - F);
+    sp->r = N - F;
+    sp->dststart = dst;
+    sp->dst = dst;
+    sp->dstend = dst + dstlen;
+
+    return sp;
+}
+
+/*******************************************************************************
+ * Decode complete groups of a flag byte followed by eight items, so that
+ * the state only needs to be kept between groups. Unless this is the last
+ * part of the stream, a trailing incomplete group is left unconsumed.
+*******************************************************************************/
+u_int32_t decompress_lzss_update(
+    void           * context,
+    const u_int8_t * src,
+    u_int32_t        srclen,
+    BOOLEAN          last)
+{
+    struct decode_state * sp = context;
+    const u_int8_t * srcstart = src;
+    const u_int8_t * srcend = src + srclen;
+    u_int8_t * text_buf = sp->text_buf;
+    u_int8_t * dst = sp->dst;
+    const u_int8_t * dstend = sp->dstend;
+    int  i, j, k, r;
+    u_int8_t c;
+    unsigned int flags;
+    u_int32_t need;
+
+    r = sp->r;
+    while (src < srcend && dst < dstend) {
+        if (!last) {
+            need = 1;
+            for (k = 0; k < 8; k++) {
+                need += ((src[0] >> k) & 1) ? 1 : 2;
+            }
+            if ((u_int32_t)(srcend - src) < need) {
+                break;
+            }
+        }
+
+        flags = *src++;
+        for (k = 0; k < 8; k++, flags >>= 1) {
+            if (flags & 1) {
+                if (src < srcend) c = *src++; else break;
+                if (dst < dstend) *dst++ = c; else break;
+                text_buf[r++] = c;
+                r &= (N - 1);
+            } else {
+                if (src < srcend) i = *src++; else break;
+                if (src < srcend) j = *src++; else break;
+                i |= ((j & 0xF0) << 4);
+                j  =  (j & 0x0F) + THRESHOLD;
+                for (; j >= 0 && dst < dstend; j--, i++) {
+                    c = text_buf[i & (N - 1)];
+                    *dst++ = c;
+                    text_buf[r++] = c;
+                    r &= (N - 1);
+                }
+            }
+        }
+    }
+
+    sp->r = r;
+    sp->dst = dst;
+
+    /* Once destination is full the rest of the stream is not needed. */
+    if (dst == dstend) {
+        return srclen;
+    }
+
+    return (u_int32_t)(src - srcstart);
+}
+
+/*******************************************************************************
+*******************************************************************************/
+u_int32_t decompress_lzss_end(
+    void           * context)
+{
+    struct decode_state * sp = context;
+    u_int32_t length;
+
+    length = (u_int32_t)(sp->dst - sp->dststart);
+    free(sp);
+    return length;
+}
+
 /*
  * initialize state, mostly the trees
  *
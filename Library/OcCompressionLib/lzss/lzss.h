@@ -21,6 +21,9 @@
 
 #define compress_lzss CompressLZSS
 #define decompress_lzss DecompressLZSS
+#define decompress_lzss_start DecompressLZSSStart
+#define decompress_lzss_update DecompressLZSSUpdate
+#define decompress_lzss_end DecompressLZSSEnd
 
 #ifdef EFIUSER
 #include <stdint.h>
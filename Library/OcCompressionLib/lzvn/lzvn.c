@@ -843,3 +843,52 @@ size_t lzvn_decode_buffer(unsigned char *dst, size_t dst_size,
   // This is how much we decompressed
   return dstate.dst - dst;
 }
+
+void *lzvn_decode_stream_start(unsigned char *dst, size_t dst_size) {
+  lzvn_decoder_state *dstate;
+
+  if (dst_size > OC_COMPRESSION_MAX_LENGTH) {
+    return NULL;
+  }
+
+  dstate = malloc(sizeof(*dstate));
+  if (dstate == NULL) {
+    return NULL;
+  }
+
+  memset(dstate, 0x00, sizeof(*dstate));
+  dstate->dst_begin = dst;
+  dstate->dst = dst;
+  dstate->dst_end = dst + dst_size;
+
+  return dstate;
+}
+
+size_t lzvn_decode_stream_update(void *context, const unsigned char *src,
+                                 size_t src_size) {
+  lzvn_decoder_state *dstate = context;
+
+  // Nothing is left to decode, the rest of the stream is not needed
+  if (dstate->end_of_stream || dstate->dst == dstate->dst_end) {
+    return src_size;
+  }
+
+  // The decoder stops at the beginning of an instruction truncated by
+  // the end of the source buffer, which is to be passed again with more data
+  dstate->src = src;
+  dstate->src_end = src + src_size;
+
+  lzvn_decode(dstate);
+
+  return dstate->src - src;
+}
+
+size_t lzvn_decode_stream_end(void *context) {
+  lzvn_decoder_state *dstate = context;
+  size_t dst_size;
+
+  dst_size = dstate->dst - dstate->dst_begin;
+  free(dstate);
+
+  return dst_size;
+}
@@ -16,14 +16,19 @@
 #define LZVN_H
 
 #include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/OcCompressionLib.h>
 
 #define lzvn_decode_buffer DecompressLZVN
+#define lzvn_decode_stream_start DecompressLZVNStart
+#define lzvn_decode_stream_update DecompressLZVNUpdate
+#define lzvn_decode_stream_end DecompressLZVNEnd
 
 #ifdef EFIUSER
 #include <stdint.h>
 #include <stddef.h>
 #include <string.h>
+#include <stdlib.h>
 
 //
 // Ugly workaround for size_t incompatibility with UINTN.
@@ -54,7 +59,17 @@ typedef UINTN uintmax_t;
 #endif
 
 #define memset(Dst, Value, Size) SetMem ((Dst), (Size), (UINT8)(Value))
+#ifdef malloc
+#undef malloc
+#endif
+
+#ifdef free
+#undef free
+#endif
+
 #define memcpy(Dst, Src, Size) CopyMem ((Dst), (Src), (Size))
+#define malloc(Size) AllocatePool (Size)
+#define free(Ptr) FreePool (Ptr)
 
 #endif
 
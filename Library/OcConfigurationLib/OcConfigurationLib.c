@@ -13,6 +13,9 @@
 **/
 
 #include <Library/OcConfigurationLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/OcCryptoLib.h>
 
 OC_STRUCTORS (OC_ACPI_ADD_ENTRY, ())
 OC_ARRAY_STRUCTORS (OC_ACPI_ADD_ARRAY)
@@ -379,10 +382,11 @@ OC_SCHEMA
 STATIC
 OC_SCHEMA
   mKernelSchemeSchema[] = {
-  OC_SCHEMA_BOOLEAN_IN ("CustomKernel", OC_GLOBAL_CONFIG, Kernel.Scheme.CustomKernel),
-  OC_SCHEMA_BOOLEAN_IN ("FuzzyMatch",   OC_GLOBAL_CONFIG, Kernel.Scheme.FuzzyMatch),
-  OC_SCHEMA_STRING_IN ("KernelArch",    OC_GLOBAL_CONFIG, Kernel.Scheme.KernelArch),
-  OC_SCHEMA_STRING_IN ("KernelCache",   OC_GLOBAL_CONFIG, Kernel.Scheme.KernelCache),
+  OC_SCHEMA_BOOLEAN_IN ("CustomKernel",    OC_GLOBAL_CONFIG, Kernel.Scheme.CustomKernel),
+  OC_SCHEMA_BOOLEAN_IN ("FuzzyMatch",      OC_GLOBAL_CONFIG, Kernel.Scheme.FuzzyMatch),
+  OC_SCHEMA_STRING_IN ("KernelArch",       OC_GLOBAL_CONFIG, Kernel.Scheme.KernelArch),
+  OC_SCHEMA_STRING_IN ("KernelCache",      OC_GLOBAL_CONFIG, Kernel.Scheme.KernelCache),
+  OC_SCHEMA_BOOLEAN_IN ("PersistentCache", OC_GLOBAL_CONFIG, Kernel.Scheme.PersistentCache),
 };
 
 STATIC
@@ -420,6 +424,7 @@ OC_SCHEMA
   OC_SCHEMA_STRING_IN ("PickerMode",            OC_GLOBAL_CONFIG, Misc.Boot.PickerMode),
   OC_SCHEMA_STRING_IN ("PickerVariant",         OC_GLOBAL_CONFIG, Misc.Boot.PickerVariant),
   OC_SCHEMA_BOOLEAN_IN ("PollAppleHotKeys",     OC_GLOBAL_CONFIG, Misc.Boot.PollAppleHotKeys),
+  OC_SCHEMA_BOOLEAN_IN ("ScanCache",            OC_GLOBAL_CONFIG, Misc.Boot.ScanCache),
   OC_SCHEMA_BOOLEAN_IN ("ShowPicker",           OC_GLOBAL_CONFIG, Misc.Boot.ShowPicker),
   OC_SCHEMA_INTEGER_IN ("TakeoffDelay",         OC_GLOBAL_CONFIG, Misc.Boot.TakeoffDelay),
   OC_SCHEMA_INTEGER_IN ("Timeout",              OC_GLOBAL_CONFIG, Misc.Boot.Timeout),
@@ -917,6 +922,61 @@ OcConfigurationInit (
   return EFI_SUCCESS;
 }
 
+STATIC_ASSERT (SHA256_DIGEST_SIZE == OC_SERIALIZED_DIGEST_SIZE, "Source digest must be SHA-256");
+
+EFI_STATUS
+OcConfigurationInitBinary (
+  OUT  OC_GLOBAL_CONFIG  *Config,
+  IN   CONST VOID        *Buffer,
+  IN   UINT32            Size,
+  IN   CONST VOID        *Source,
+  IN   UINT32            SourceSize
+  )
+{
+  UINT8  SourceDigest[SHA256_DIGEST_SIZE];
+
+  Sha256 (SourceDigest, Source, SourceSize);
+
+  OC_GLOBAL_CONFIG_CONSTRUCT (Config, sizeof (*Config));
+  if (!ParseSerializedBinary (Config, &mRootConfigurationInfo, Buffer, Size, SourceDigest)) {
+    OC_GLOBAL_CONFIG_DESTRUCT (Config, sizeof (*Config));
+    return EFI_UNSUPPORTED;
+  }
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+OcConfigurationSerialize (
+  IN   OC_GLOBAL_CONFIG  *Config,
+  IN   CONST VOID        *Source,
+  IN   UINT32            SourceSize,
+  OUT  VOID              **Buffer,
+  OUT  UINT32            *Size
+  )
+{
+  UINT8  SourceDigest[SHA256_DIGEST_SIZE];
+
+  Sha256 (SourceDigest, Source, SourceSize);
+
+  if (!SerializeBinary (Config, &mRootConfigurationInfo, SourceDigest, NULL, Size)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  *Buffer = AllocatePool (*Size);
+  if (*Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  if (!SerializeBinary (Config, &mRootConfigurationInfo, SourceDigest, *Buffer, Size)) {
+    FreePool (*Buffer);
+    *Buffer = NULL;
+    return EFI_UNSUPPORTED;
+  }
+
+  return EFI_SUCCESS;
+}
+
 VOID
 OcConfigurationFree (
   IN OUT OC_GLOBAL_CONFIG  *Config
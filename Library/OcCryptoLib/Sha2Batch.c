@@ -0,0 +1,38 @@
+/** @file
+  Copyright (C) 2026, Acidanthera. All rights reserved.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+**/
+
+#include "Sha2Internal.h"
+
+#ifdef OC_CRYPTO_SUPPORTS_SHA256
+
+UINTN
+Sha256BatchParallelism (
+  VOID
+  )
+{
+  return 1;
+}
+
+VOID
+Sha256Batch (
+  IN OUT OC_SHA256_BATCH_ENTRY  *Entries,
+  IN     UINTN                  Count
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Count; ++Index) {
+    Sha256 (Entries[Index].Hash, Entries[Index].Data, Entries[Index].Len);
+  }
+}
+
+#endif
@@ -0,0 +1,118 @@
+/** @file
+  Multithreaded Sha256Batch implementation for userspace builds,
+  used by User/Makefile in place of Sha2Batch.c.
+
+  Copyright (C) 2026, Acidanthera. All rights reserved.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+**/
+
+#include "Sha2Internal.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+#ifdef OC_CRYPTO_SUPPORTS_SHA256
+
+#define SHA256_BATCH_MAX_THREADS  64
+
+typedef struct {
+  OC_SHA256_BATCH_ENTRY    *Entries;
+  UINTN                    Count;
+  UINTN                    NextIndex;
+} SHA256_BATCH_WORK;
+
+STATIC UINTN  mSha256BatchParallelism;
+
+STATIC
+VOID *
+InternalSha256BatchWorker (
+  IN VOID  *Context
+  )
+{
+  SHA256_BATCH_WORK  *Work;
+  UINTN              Index;
+
+  Work = Context;
+
+  //
+  // Entries are taken one at a time, so that workers stay busy
+  // when entry sizes differ.
+  //
+  while ((Index = __atomic_fetch_add (&Work->NextIndex, 1, __ATOMIC_RELAXED)) < Work->Count) {
+    Sha256 (Work->Entries[Index].Hash, Work->Entries[Index].Data, Work->Entries[Index].Len);
+  }
+
+  return NULL;
+}
+
+VOID
+Sha256BatchSetParallelism (
+  IN UINTN  Parallelism
+  )
+{
+  mSha256BatchParallelism = MIN (Parallelism, SHA256_BATCH_MAX_THREADS);
+}
+
+UINTN
+Sha256BatchParallelism (
+  VOID
+  )
+{
+  INTN  CpuCount;
+
+  if (mSha256BatchParallelism == 0) {
+ #ifdef _SC_NPROCESSORS_ONLN
+    CpuCount = sysconf (_SC_NPROCESSORS_ONLN);
+ #else
+    CpuCount = 1;
+ #endif
+    mSha256BatchParallelism = (UINTN)MAX (MIN (CpuCount, SHA256_BATCH_MAX_THREADS), 1);
+  }
+
+  return mSha256BatchParallelism;
+}
+
+VOID
+Sha256Batch (
+  IN OUT OC_SHA256_BATCH_ENTRY  *Entries,
+  IN     UINTN                  Count
+  )
+{
+  SHA256_BATCH_WORK  Work;
+  pthread_t          Threads[SHA256_BATCH_MAX_THREADS];
+  UINTN              ThreadCount;
+  UINTN              Index;
+
+  Work.Entries   = Entries;
+  Work.Count     = Count;
+  Work.NextIndex = 0;
+
+  ThreadCount = MIN (Sha256BatchParallelism (), Count);
+
+  //
+  // The calling thread is a worker too, failing to start other threads
+  // only reduces parallelism.
+  //
+  for (Index = 1; Index < ThreadCount; ++Index) {
+    if (pthread_create (&Threads[Index], NULL, InternalSha256BatchWorker, &Work) != 0) {
+      break;
+    }
+  }
+
+  ThreadCount = Index;
+
+  InternalSha256BatchWorker (&Work);
+
+  for (Index = 1; Index < ThreadCount; ++Index) {
+    pthread_join (Threads[Index], NULL);
+  }
+}
+
+#endif
@@ -0,0 +1,747 @@
+/** @file
+  Provides lookup indices for relocations and symbols.
+
+Copyright (C) 2026, Acidanthera. All rights reserved.<BR>
+This program and the accompanying materials are licensed and made available
+under the terms and conditions of the BSD License which accompanies this
+distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php.
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include <Uefi.h>
+
+#include <IndustryStandard/AppleMachoImage.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/OcMachoLib.h>
+
+#include "OcMachoLibInternal.h"
+
+//
+// Minimum amount of slots in symbol index tables.
+//
+#define MACHO_INDEX_MIN_SLOTS  16U
+
+STATIC
+UINT32
+InternalIndexNameHash (
+  IN CONST CHAR8  *Name
+  )
+{
+  UINT32  Hash;
+
+  //
+  // FNV-1a. Mangled C++ names share long prefixes, so every byte is hashed.
+  //
+  Hash = 0x811C9DC5U;
+  while (*Name != '\0') {
+    Hash ^= (UINT8)*Name;
+    Hash *= 0x01000193U;
+    ++Name;
+  }
+
+  return Hash;
+}
+
+STATIC
+UINT32
+InternalIndexValueHash (
+  IN UINT64  Value
+  )
+{
+  UINT32  Hash;
+
+  //
+  // Symbol values are mostly aligned, mix the low bits with the high ones.
+  //
+  Hash  = (UINT32)Value ^ (UINT32)RShiftU64 (Value, 32);
+  Hash *= 0x9E3779B1U;
+  return Hash ^ (Hash >> 15);
+}
+
+STATIC
+MACH_NLIST_ANY *
+InternalIndexSymbol (
+  IN OC_MACHO_CONTEXT  *Context,
+  IN UINT32            Index
+  )
+{
+  if (Context->Is32Bit) {
+    return (MACH_NLIST_ANY *)&(&Context->SymbolTable->Symbol32)[Index];
+  }
+
+  return (MACH_NLIST_ANY *)&(&Context->SymbolTable->Symbol64)[Index];
+}
+
+STATIC
+UINT64
+InternalIndexSymbolValue (
+  IN OC_MACHO_CONTEXT  *Context,
+  IN UINT32            Index
+  )
+{
+  if (Context->Is32Bit) {
+    return (&Context->SymbolTable->Symbol32)[Index].Value;
+  }
+
+  return (&Context->SymbolTable->Symbol64)[Index].Value;
+}
+
+STATIC
+BOOLEAN
+InternalIndexSymbolIsSane (
+  IN OC_MACHO_CONTEXT  *Context,
+  IN UINT32            Index
+  )
+{
+  if (Context->Is32Bit) {
+    return InternalSymbolIsSane32 (Context, &(&Context->SymbolTable->Symbol32)[Index]);
+  }
+
+  return InternalSymbolIsSane64 (Context, &(&Context->SymbolTable->Symbol64)[Index]);
+}
+
+STATIC
+BOOLEAN
+InternalRelocationIndexLess (
+  IN CONST OC_MACHO_RELOCATION_INDEX_ENTRY  *First,
+  IN CONST OC_MACHO_RELOCATION_INDEX_ENTRY  *Second
+  )
+{
+  if (First->Address != Second->Address) {
+    return First->Address < Second->Address;
+  }
+
+  return First->Order < Second->Order;
+}
+
+STATIC
+VOID
+InternalRelocationIndexSift (
+  IN OUT OC_MACHO_RELOCATION_INDEX_ENTRY  *Entries,
+  IN     UINT32                           Root,
+  IN     UINT32                           Count
+  )
+{
+  OC_MACHO_RELOCATION_INDEX_ENTRY  Swap;
+  UINT32                           Child;
+
+  while (TRUE) {
+    Child = Root * 2 + 1;
+    if (Child >= Count) {
+      return;
+    }
+
+    if (  (Child + 1 < Count)
+       && InternalRelocationIndexLess (&Entries[Child], &Entries[Child + 1]))
+    {
+      ++Child;
+    }
+
+    if (!InternalRelocationIndexLess (&Entries[Root], &Entries[Child])) {
+      return;
+    }
+
+    CopyMem (&Swap, &Entries[Root], sizeof (Swap));
+    CopyMem (&Entries[Root], &Entries[Child], sizeof (Swap));
+    CopyMem (&Entries[Child], &Swap, sizeof (Swap));
+    Root = Child;
+  }
+}
+
+/**
+  Collects the relocations a linear lookup would consider, in the order it
+  would visit them.  With Entries set to NULL only counts them.
+
+  @param[in,out] Context   Context of the Mach-O.
+  @param[in]     External  Whether to collect extern or local Relocations.
+  @param[out]    Entries   Buffer to collect the relocations into, optional.
+
+  @returns  Number of relocations.
+
+**/
+STATIC
+UINT32
+InternalCollectRelocations (
+  IN OUT OC_MACHO_CONTEXT                 *Context,
+  IN     BOOLEAN                          External,
+  OUT    OC_MACHO_RELOCATION_INDEX_ENTRY  *Entries  OPTIONAL
+  )
+{
+  MACH_SECTION_ANY      *Section;
+  UINT32                SectionIndex;
+  MACH_RELOCATION_INFO  *Relocations;
+  MACH_RELOCATION_INFO  *Relocation;
+  UINT32                RelocationCount;
+  UINT32                Index;
+  UINT32                Count;
+  UINT64                Address;
+
+  Count = 0;
+
+  //
+  // MH_OBJECT does not have a DYSYMTAB, each section has its own relocations.
+  //
+  if (Context->DySymtab == NULL) {
+    SectionIndex = 0;
+    while ((Section = MachoGetSectionByIndex (Context, SectionIndex)) != NULL) {
+      RelocationCount = Context->Is32Bit ? Section->Section32.NumRelocations : Section->Section64.NumRelocations;
+      Relocations     = (MACH_RELOCATION_INFO *)(((UINTN)(Context->FileData))
+                                                 + (Context->Is32Bit ? Section->Section32.RelocationsOffset : Section->Section64.RelocationsOffset));
+
+      for (Index = 0; Index < RelocationCount; ++Index) {
+        Relocation = &Relocations[Index];
+        if (  (  (Relocation->Extern == 0)
+              && (Relocation->SymbolNumber == MACH_RELOC_ABSOLUTE))
+           || (Relocation->Extern != (UINT32)(External ? 1 : 0)))
+        {
+          continue;
+        }
+
+        if (Entries != NULL) {
+          if (Context->Is32Bit) {
+            Address = (UINT32)Relocation->Address + Section->Section32.Address;
+          } else {
+            Address = (UINT64)Relocation->Address + Section->Section64.Address;
+          }
+
+          Entries[Count].Address    = Address;
+          Entries[Count].Relocation = Relocation;
+          Entries[Count].Order      = Count;
+        }
+
+        ++Count;
+      }
+
+      ++SectionIndex;
+    }
+
+    return Count;
+  }
+
+  if (External) {
+    RelocationCount = Context->DySymtab->NumExternalRelocations;
+    Relocations     = Context->ExternRelocations;
+  } else {
+    RelocationCount = Context->DySymtab->NumOfLocalRelocations;
+    Relocations     = Context->LocalRelocations;
+  }
+
+  for (Index = 0; Index < RelocationCount; ++Index) {
+    Relocation = &Relocations[Index];
+    if (  (Relocation->Extern == 0)
+       && (Relocation->SymbolNumber == MACH_RELOC_ABSOLUTE))
+    {
+      continue;
+    }
+
+    if (Entries != NULL) {
+      Entries[Count].Address    = (UINT64)Relocation->Address;
+      Entries[Count].Relocation = Relocation;
+      Entries[Count].Order      = Count;
+    }
+
+    ++Count;
+
+    //
+    // Relocation Pairs can be skipped, see InternalLookupRelocationByOffset.
+    //
+    if (MachoRelocationIsPairIntel64 ((UINT8)Relocation->Type)) {
+      if (Index == (MAX_UINT32 - 1)) {
+        break;
+      }
+
+      ++Index;
+    }
+  }
+
+  return Count;
+}
+
+STATIC
+VOID
+InternalBuildRelocationIndex (
+  IN OUT OC_MACHO_CONTEXT           *Context,
+  IN     BOOLEAN                    External,
+  OUT    OC_MACHO_RELOCATION_INDEX  *RelocationIndex
+  )
+{
+  OC_MACHO_RELOCATION_INDEX_ENTRY  *Entries;
+  OC_MACHO_RELOCATION_INDEX_ENTRY  Swap;
+  UINT32                           NumEntries;
+  UINT32                           Index;
+
+  RelocationIndex->State = OcMachoIndexStateUnavailable;
+
+  NumEntries = InternalCollectRelocations (Context, External, NULL);
+  if (NumEntries > MAX_UINT32 / sizeof (*Entries)) {
+    return;
+  }
+
+  Entries = NULL;
+  if (NumEntries > 0) {
+    Entries = AllocatePool (NumEntries * sizeof (*Entries));
+    if (Entries == NULL) {
+      DEBUG ((DEBUG_INFO, "OCMCO: No memory for relocation index, using linear lookup\n"));
+      return;
+    }
+
+    InternalCollectRelocations (Context, External, Entries);
+  }
+
+  //
+  // Heap sort by (Address, Order).
+  //
+  if (NumEntries > 1) {
+    for (Index = NumEntries / 2; Index > 0; --Index) {
+      InternalRelocationIndexSift (Entries, Index - 1, NumEntries);
+    }
+
+    for (Index = NumEntries - 1; Index > 0; --Index) {
+      CopyMem (&Swap, &Entries[0], sizeof (Swap));
+      CopyMem (&Entries[0], &Entries[Index], sizeof (Swap));
+      CopyMem (&Entries[Index], &Swap, sizeof (Swap));
+      InternalRelocationIndexSift (Entries, 0, Index);
+    }
+  }
+
+  RelocationIndex->Entries    = Entries;
+  RelocationIndex->NumEntries = NumEntries;
+  RelocationIndex->State      = OcMachoIndexStateReady;
+}
+
+STATIC
+VOID
+InternalBuildNameIndex (
+  IN OUT OC_MACHO_CONTEXT  *Context,
+  IN OUT OC_MACHO_INDEX    *MachoIndex
+  )
+{
+  UINT32  *NameSlots;
+  UINT32  NumSymbols;
+  UINT32  NumMalformed;
+  UINT32  NumSlots;
+  UINT32  Mask;
+  UINT32  Slot;
+  UINT32  Index;
+
+  MachoIndex->NameState = OcMachoIndexStateUnavailable;
+
+  if (!InternalRetrieveSymtabs (Context)) {
+    return;
+  }
+
+  NumSymbols = Context->Symtab->NumSymbols;
+  if (NumSymbols > MAX_UINT32 / 8) {
+    return;
+  }
+
+  NumMalformed = 0;
+  for (Index = 0; Index < NumSymbols; ++Index) {
+    if (!InternalIndexSymbolIsSane (Context, Index)) {
+      ++NumMalformed;
+    }
+  }
+
+  //
+  // Keep the load factor at or below 50% to have short probe sequences.
+  //
+  NumSlots = MACHO_INDEX_MIN_SLOTS;
+  while (NumSlots < (NumSymbols - NumMalformed) * 2) {
+    NumSlots *= 2;
+  }
+
+  NameSlots = AllocateZeroPool ((NumSlots + NumMalformed) * sizeof (*NameSlots));
+  if (NameSlots == NULL) {
+    DEBUG ((DEBUG_INFO, "OCMCO: No memory for symbol name index, using linear lookup\n"));
+    return;
+  }
+
+  MachoIndex->NameSlots           = NameSlots;
+  MachoIndex->NameMask            = NumSlots - 1;
+  MachoIndex->MalformedSymbols    = &NameSlots[NumSlots];
+  MachoIndex->NumMalformedSymbols = 0;
+
+  Mask = NumSlots - 1;
+  for (Index = 0; Index < NumSymbols; ++Index) {
+    //
+    // Malformed symbols have no name, remember them to terminate the ranges.
+    //
+    if (!InternalIndexSymbolIsSane (Context, Index)) {
+      MachoIndex->MalformedSymbols[MachoIndex->NumMalformedSymbols] = Index;
+      ++MachoIndex->NumMalformedSymbols;
+      continue;
+    }
+
+    Slot = InternalIndexNameHash (
+             MachoGetSymbolName (Context, InternalIndexSymbol (Context, Index))
+             ) & Mask;
+    while (NameSlots[Slot] != 0) {
+      Slot = (Slot + 1) & Mask;
+    }
+
+    NameSlots[Slot] = Index + 1;
+  }
+
+  MachoIndex->NameState = OcMachoIndexStateReady;
+}
+
+STATIC
+VOID
+InternalInsertValueIndex (
+  IN OUT OC_MACHO_INDEX  *MachoIndex,
+  IN     UINT64          Value,
+  IN     UINT32          Index
+  )
+{
+  UINT32  Slot;
+
+  Slot = InternalIndexValueHash (Value) & MachoIndex->ValueMask;
+  while (MachoIndex->ValueSlots[Slot] != 0) {
+    Slot = (Slot + 1) & MachoIndex->ValueMask;
+  }
+
+  MachoIndex->ValueSlots[Slot] = Index + 1;
+  ++MachoIndex->NumValueEntries;
+}
+
+STATIC
+VOID
+InternalFillValueIndex (
+  IN OUT OC_MACHO_CONTEXT  *Context,
+  IN OUT OC_MACHO_INDEX    *MachoIndex
+  )
+{
+  UINT32  Index;
+
+  ZeroMem (MachoIndex->ValueSlots, (MachoIndex->ValueMask + 1) * sizeof (*MachoIndex->ValueSlots));
+  MachoIndex->NumValueEntries = 0;
+
+  for (Index = 0; Index < Context->Symtab->NumSymbols; ++Index) {
+    InternalInsertValueIndex (MachoIndex, InternalIndexSymbolValue (Context, Index), Index);
+  }
+}
+
+STATIC
+VOID
+InternalBuildValueIndex (
+  IN OUT OC_MACHO_CONTEXT  *Context,
+  IN OUT OC_MACHO_INDEX    *MachoIndex
+  )
+{
+  UINT32  NumSymbols;
+  UINT32  NumSlots;
+
+  MachoIndex->ValueState = OcMachoIndexStateUnavailable;
+
+  if (!InternalRetrieveSymtabs (Context)) {
+    return;
+  }
+
+  NumSymbols = Context->Symtab->NumSymbols;
+  if (NumSymbols > MAX_UINT32 / 16) {
+    return;
+  }
+
+  //
+  // Changed values are inserted again and stale entries are skipped on lookup,
+  // hence reserve room for symbols to change before the table is refilled.
+  //
+  NumSlots = MACHO_INDEX_MIN_SLOTS;
+  while (NumSlots < NumSymbols * 4) {
+    NumSlots *= 2;
+  }
+
+  MachoIndex->ValueSlots = AllocatePool (NumSlots * sizeof (*MachoIndex->ValueSlots));
+  if (MachoIndex->ValueSlots == NULL) {
+    DEBUG ((DEBUG_INFO, "OCMCO: No memory for symbol value index, using linear lookup\n"));
+    return;
+  }
+
+  MachoIndex->ValueMask = NumSlots - 1;
+  InternalFillValueIndex (Context, MachoIndex);
+
+  MachoIndex->ValueState = OcMachoIndexStateReady;
+}
+
+BOOLEAN
+MachoInitializeIndex (
+  IN OUT OC_MACHO_CONTEXT  *Context
+  )
+{
+  ASSERT (Context != NULL);
+
+  if (Context->Index != NULL) {
+    return TRUE;
+  }
+
+  Context->Index = AllocateZeroPool (sizeof (*Context->Index));
+  return Context->Index != NULL;
+}
+
+VOID
+MachoFreeIndex (
+  IN OUT OC_MACHO_CONTEXT  *Context
+  )
+{
+  OC_MACHO_INDEX  *MachoIndex;
+
+  ASSERT (Context != NULL);
+
+  MachoIndex = Context->Index;
+  if (MachoIndex == NULL) {
+    return;
+  }
+
+  if (MachoIndex->ExternRelocations.Entries != NULL) {
+    FreePool (MachoIndex->ExternRelocations.Entries);
+  }
+
+  if (MachoIndex->LocalRelocations.Entries != NULL) {
+    FreePool (MachoIndex->LocalRelocations.Entries);
+  }
+
+  if (MachoIndex->NameSlots != NULL) {
+    FreePool (MachoIndex->NameSlots);
+  }
+
+  if (MachoIndex->ValueSlots != NULL) {
+    FreePool (MachoIndex->ValueSlots);
+  }
+
+  FreePool (MachoIndex);
+  Context->Index = NULL;
+}
+
+VOID
+MachoUpdateSymbolValueIndex (
+  IN OUT OC_MACHO_CONTEXT      *Context,
+  IN     CONST MACH_NLIST_ANY  *Symbol
+  )
+{
+  OC_MACHO_INDEX  *MachoIndex;
+  UINTN           Offset;
+  UINTN           SymbolSize;
+  UINT32          Index;
+
+  ASSERT (Context != NULL);
+  ASSERT (Symbol != NULL);
+
+  MachoIndex = Context->Index;
+  if ((MachoIndex == NULL) || (MachoIndex->ValueState != OcMachoIndexStateReady)) {
+    return;
+  }
+
+  //
+  // Symbols outside of the symbol table, e.g. copies, are not indexed.
+  //
+  SymbolSize = Context->Is32Bit ? sizeof (MACH_NLIST) : sizeof (MACH_NLIST_64);
+  if ((UINTN)Symbol < (UINTN)Context->SymbolTable) {
+    return;
+  }
+
+  Offset = (UINTN)Symbol - (UINTN)Context->SymbolTable;
+  if (  (Offset % SymbolSize != 0)
+     || (Offset / SymbolSize >= Context->Symtab->NumSymbols))
+  {
+    return;
+  }
+
+  Index = (UINT32)(Offset / SymbolSize);
+
+  if (MachoIndex->NumValueEntries >= (MachoIndex->ValueMask + 1) / 2) {
+    InternalFillValueIndex (Context, MachoIndex);
+  } else {
+    InternalInsertValueIndex (MachoIndex, InternalIndexSymbolValue (Context, Index), Index);
+  }
+}
+
+BOOLEAN
+InternalIndexGetRelocationByOffset (
+  IN OUT OC_MACHO_CONTEXT      *Context,
+  IN     UINT64                Address,
+  IN     BOOLEAN               External,
+  OUT    MACH_RELOCATION_INFO  **Relocation
+  )
+{
+  OC_MACHO_RELOCATION_INDEX              *RelocationIndex;
+  CONST OC_MACHO_RELOCATION_INDEX_ENTRY  *Entries;
+  UINT32                                 Low;
+  UINT32                                 High;
+  UINT32                                 Middle;
+
+  ASSERT (Context != NULL);
+  ASSERT (Relocation != NULL);
+
+  if (Context->Index == NULL) {
+    return FALSE;
+  }
+
+  RelocationIndex = External ? &Context->Index->ExternRelocations : &Context->Index->LocalRelocations;
+  if (RelocationIndex->State == OcMachoIndexStateNone) {
+    InternalBuildRelocationIndex (Context, External, RelocationIndex);
+  }
+
+  if (RelocationIndex->State != OcMachoIndexStateReady) {
+    return FALSE;
+  }
+
+  Entries = RelocationIndex->Entries;
+
+  //
+  // Find the first entry with Address >= the requested one.
+  //
+  Low  = 0;
+  High = RelocationIndex->NumEntries;
+  while (Low < High) {
+    Middle = Low + (High - Low) / 2;
+    if (Entries[Middle].Address < Address) {
+      Low = Middle + 1;
+    } else {
+      High = Middle;
+    }
+  }
+
+  if ((Low < RelocationIndex->NumEntries) && (Entries[Low].Address == Address)) {
+    *Relocation = Entries[Low].Relocation;
+  } else {
+    *Relocation = NULL;
+  }
+
+  return TRUE;
+}
+
+BOOLEAN
+InternalIndexGetSymbolByName (
+  IN OUT OC_MACHO_CONTEXT  *Context,
+  IN     CONST CHAR8       *Name,
+  IN     UINT32            FirstIndex,
+  IN     UINT32            NumberOfSymbols,
+  IN     BOOLEAN           Defined,
+  OUT    MACH_NLIST_ANY    **Symbol
+  )
+{
+  OC_MACHO_INDEX  *MachoIndex;
+  MACH_NLIST_ANY  *Candidate;
+  UINT32          LastIndex;
+  UINT32          Low;
+  UINT32          High;
+  UINT32          Middle;
+  UINT32          Slot;
+  UINT32          Entry;
+
+  ASSERT (Context != NULL);
+  ASSERT (Name != NULL);
+  ASSERT (Symbol != NULL);
+
+  MachoIndex = Context->Index;
+  if (MachoIndex == NULL) {
+    return FALSE;
+  }
+
+  if (MachoIndex->NameState == OcMachoIndexStateNone) {
+    InternalBuildNameIndex (Context, MachoIndex);
+  }
+
+  if (MachoIndex->NameState != OcMachoIndexStateReady) {
+    return FALSE;
+  }
+
+  *Symbol = NULL;
+
+  if (FirstIndex >= Context->Symtab->NumSymbols) {
+    return TRUE;
+  }
+
+  LastIndex = FirstIndex + MIN (NumberOfSymbols, Context->Symtab->NumSymbols - FirstIndex);
+
+  //
+  // A linear scan stops at the first malformed symbol of the range.
+  //
+  Low  = 0;
+  High = MachoIndex->NumMalformedSymbols;
+  while (Low < High) {
+    Middle = Low + (High - Low) / 2;
+    if (MachoIndex->MalformedSymbols[Middle] < FirstIndex) {
+      Low = Middle + 1;
+    } else {
+      High = Middle;
+    }
+  }
+
+  if ((Low < MachoIndex->NumMalformedSymbols) && (MachoIndex->MalformedSymbols[Low] < LastIndex)) {
+    LastIndex = MachoIndex->MalformedSymbols[Low];
+  }
+
+  Slot = InternalIndexNameHash (Name) & MachoIndex->NameMask;
+  while ((Entry = MachoIndex->NameSlots[Slot]) != 0) {
+    if ((Entry - 1 >= FirstIndex) && (Entry - 1 < LastIndex)) {
+      Candidate = InternalIndexSymbol (Context, Entry - 1);
+      if (  (!Defined || MachoSymbolIsDefined (Context, Candidate))
+         && (AsciiStrCmp (Name, MachoGetSymbolName (Context, Candidate)) == 0))
+      {
+        *Symbol = Candidate;
+        break;
+      }
+    }
+
+    Slot = (Slot + 1) & MachoIndex->NameMask;
+  }
+
+  return TRUE;
+}
+
+BOOLEAN
+InternalIndexGetSymbolByValue (
+  IN OUT OC_MACHO_CONTEXT  *Context,
+  IN     UINT64            Value,
+  OUT    MACH_NLIST_ANY    **Symbol
+  )
+{
+  OC_MACHO_INDEX  *MachoIndex;
+  UINT32          Slot;
+  UINT32          Entry;
+  UINT32          Found;
+
+  ASSERT (Context != NULL);
+  ASSERT (Symbol != NULL);
+
+  MachoIndex = Context->Index;
+  if (MachoIndex == NULL) {
+    return FALSE;
+  }
+
+  if (MachoIndex->ValueState == OcMachoIndexStateNone) {
+    InternalBuildValueIndex (Context, MachoIndex);
+  }
+
+  if (MachoIndex->ValueState != OcMachoIndexStateReady) {
+    return FALSE;
+  }
+
+  //
+  // Entries of changed symbols are not removed, so the whole probe sequence is
+  // checked against current values for the first symbol in table order.
+  //
+  Found = MAX_UINT32;
+  Slot  = InternalIndexValueHash (Value) & MachoIndex->ValueMask;
+  while ((Entry = MachoIndex->ValueSlots[Slot]) != 0) {
+    if (  (Entry - 1 < Found)
+       && (InternalIndexSymbolValue (Context, Entry - 1) == Value))
+    {
+      Found = Entry - 1;
+    }
+
+    Slot = (Slot + 1) & MachoIndex->ValueMask;
+  }
+
+  *Symbol = Found != MAX_UINT32 ? InternalIndexSymbol (Context, Found) : NULL;
+  return TRUE;
+}
@@ -21,6 +21,51 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 
 #define SYM_MAX_NAME_LEN  256U
 
+///
+/// Build state of a lookup index table.
+///
+typedef enum {
+  OcMachoIndexStateNone,
+  OcMachoIndexStateReady,
+  OcMachoIndexStateUnavailable
+} OC_MACHO_INDEX_STATE;
+
+///
+/// Relocation index entry.  Entries are sorted by address and then by the
+/// order a linear scan would visit them in.
+///
+typedef struct {
+  UINT64                  Address;
+  MACH_RELOCATION_INFO    *Relocation;
+  UINT32                  Order;
+} OC_MACHO_RELOCATION_INDEX_ENTRY;
+
+typedef struct {
+  OC_MACHO_RELOCATION_INDEX_ENTRY    *Entries;
+  UINT32                             NumEntries;
+  OC_MACHO_INDEX_STATE               State;
+} OC_MACHO_RELOCATION_INDEX;
+
+struct OC_MACHO_INDEX_ {
+  OC_MACHO_RELOCATION_INDEX    ExternRelocations;
+  OC_MACHO_RELOCATION_INDEX    LocalRelocations;
+  //
+  // Symbol name and value tables use open addressing and store symbol indices
+  // plus one, zero marks a free slot.  Symbols are inserted in table order, so
+  // that for equal keys the probe sequence visits them in the order a linear
+  // scan would.
+  //
+  UINT32                       *NameSlots;
+  UINT32                       NameMask;
+  UINT32                       *MalformedSymbols;
+  UINT32                       NumMalformedSymbols;
+  OC_MACHO_INDEX_STATE         NameState;
+  UINT32                       *ValueSlots;
+  UINT32                       ValueMask;
+  UINT32                       NumValueEntries;
+  OC_MACHO_INDEX_STATE         ValueState;
+};
+
 /**
   Retrieves the SYMTAB command.
 
@@ -62,6 +107,65 @@ InternalGetLocalRelocationByOffset (
   IN     UINT64            Address
   );
 
+/**
+  Retrieves a Relocation by the address it targets via the lookup index.
+
+  @param[in,out] Context     Context of the Mach-O.
+  @param[in]     Address     The address to search for.
+  @param[in]     External    Whether to search extern or local Relocations.
+  @param[out]    Relocation  The Relocation found, or NULL.
+
+  @retval FALSE  The index is not available, a linear scan is required.
+**/
+BOOLEAN
+InternalIndexGetRelocationByOffset (
+  IN OUT OC_MACHO_CONTEXT      *Context,
+  IN     UINT64                Address,
+  IN     BOOLEAN               External,
+  OUT    MACH_RELOCATION_INFO  **Relocation
+  );
+
+/**
+  Retrieves the first symbol with the given name within a range of the symbol
+  table via the lookup index.  Like a linear scan, symbols past the first
+  malformed symbol of the range are not considered.
+
+  @param[in,out] Context          Context of the Mach-O.
+  @param[in]     Name             Name of the symbol to locate.
+  @param[in]     FirstIndex       Index of the first symbol of the range.
+  @param[in]     NumberOfSymbols  Number of symbols in the range.
+  @param[in]     Defined          Whether to only consider defined symbols.
+  @param[out]    Symbol           The symbol found, or NULL.
+
+  @retval FALSE  The index is not available, a linear scan is required.
+**/
+BOOLEAN
+InternalIndexGetSymbolByName (
+  IN OUT OC_MACHO_CONTEXT  *Context,
+  IN     CONST CHAR8       *Name,
+  IN     UINT32            FirstIndex,
+  IN     UINT32            NumberOfSymbols,
+  IN     BOOLEAN           Defined,
+  OUT    MACH_NLIST_ANY    **Symbol
+  );
+
+/**
+  Retrieves the first symbol of the symbol table with the given value via the
+  lookup index.
+
+  @param[in,out] Context  Context of the Mach-O.
+  @param[in]     Value    Value of the symbol to locate.
+  @param[out]    Symbol   The symbol found, or NULL.
+
+  @retval FALSE  The index is not available, a linear scan is required.
+**/
+BOOLEAN
+InternalIndexGetSymbolByValue (
+  IN OUT OC_MACHO_CONTEXT  *Context,
+  IN     UINT64            Value,
+  OUT    MACH_NLIST_ANY    **Symbol
+  );
+
 /**
   Check 32-bit symbol validity.
 
@@ -213,6 +213,12 @@ InternalGetExternRelocationByOffset (
   IN     UINT64            Address
   )
 {
+  MACH_RELOCATION_INFO  *Relocation;
+
+  if (InternalIndexGetRelocationByOffset (Context, Address, TRUE, &Relocation)) {
+    return Relocation;
+  }
+
   //
   // MH_OBJECT does not have a DYSYMTAB.
   //
@@ -246,6 +252,12 @@ InternalGetLocalRelocationByOffset (
   IN     UINT64            Address
   )
 {
+  MACH_RELOCATION_INFO  *Relocation;
+
+  if (InternalIndexGetRelocationByOffset (Context, Address, FALSE, &Relocation)) {
+    return Relocation;
+  }
+
   //
   // MH_OBJECT does not have a DYSYMTAB.
   //
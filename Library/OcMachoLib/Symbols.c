@@ -63,6 +63,35 @@ MachoGetLocalDefinedSymbolByName (
          (MACH_NLIST_ANY *)MachoGetLocalDefinedSymbolByName64 (Context, Name);
 }
 
+MACH_NLIST_ANY *
+MachoGetSymbolByName (
+  IN OUT OC_MACHO_CONTEXT  *Context,
+  IN     CONST CHAR8       *Name
+  )
+{
+  MACH_NLIST_ANY  *Symbol;
+  UINT32          Index;
+
+  ASSERT (Context != NULL);
+  ASSERT (Name != NULL);
+
+  if (!InternalRetrieveSymtabs (Context)) {
+    return NULL;
+  }
+
+  if (InternalIndexGetSymbolByName (Context, Name, 0, Context->Symtab->NumSymbols, FALSE, &Symbol)) {
+    return Symbol;
+  }
+
+  for (Index = 0; (Symbol = MachoGetSymbolByIndex (Context, Index)) != NULL; ++Index) {
+    if (AsciiStrCmp (Name, MachoGetSymbolName (Context, Symbol)) == 0) {
+      return Symbol;
+    }
+  }
+
+  return NULL;
+}
+
 MACH_NLIST_ANY *
 MachoGetSymbolByIndex (
   IN OUT OC_MACHO_CONTEXT  *Context,
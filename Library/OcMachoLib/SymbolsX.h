@@ -84,11 +84,16 @@ MACH_X (
     IN OUT OC_MACHO_CONTEXT   *Context,
     IN     MACH_UINT_X        Value
     ) {
-  UINT32  Index;
+  UINT32          Index;
+  MACH_NLIST_ANY  *Symbol;
 
   ASSERT (Context->SymbolTable != NULL);
   ASSERT (Context->Symtab != NULL);
 
+  if (InternalIndexGetSymbolByValue (Context, Value, &Symbol)) {
+    return (MACH_NLIST_X *)Symbol;
+  }
+
   for (Index = 0; Index < Context->Symtab->NumSymbols; ++Index) {
     if ((MACH_X (&Context->SymbolTable->Symbol))[Index].Value == Value) {
       return &(MACH_X (&Context->SymbolTable->Symbol))[Index];
@@ -521,6 +526,29 @@ MACH_X (
   DySymtab = Context->DySymtab;
 
   if (DySymtab != NULL) {
+    if (InternalIndexGetSymbolByName (
+          Context,
+          Name,
+          DySymtab->LocalSymbolsIndex,
+          DySymtab->NumLocalSymbols,
+          TRUE,
+          (MACH_NLIST_ANY **)&Symbol
+          ))
+    {
+      if (Symbol == NULL) {
+        InternalIndexGetSymbolByName (
+          Context,
+          Name,
+          DySymtab->ExternalSymbolsIndex,
+          DySymtab->NumExternalSymbols,
+          TRUE,
+          (MACH_NLIST_ANY **)&Symbol
+          );
+      }
+
+      return Symbol;
+    }
+
     Symbol = InternalGetLocalDefinedSymbolByNameWorker (
                Context,
                &SymbolTable[DySymtab->LocalSymbolsIndex],
@@ -537,6 +565,18 @@ MACH_X (
     }
   } else {
     ASSERT (Context->Symtab != NULL);
+    if (InternalIndexGetSymbolByName (
+          Context,
+          Name,
+          0,
+          Context->Symtab->NumSymbols,
+          TRUE,
+          (MACH_NLIST_ANY **)&Symbol
+          ))
+    {
+      return Symbol;
+    }
+
     Symbol = InternalGetLocalDefinedSymbolByNameWorker (
                Context,
                SymbolTable,
@@ -595,6 +635,7 @@ MACH_X (
     }
 
     Symbol->Value = Value;
+    MachoUpdateSymbolValueIndex (Context, (MACH_NLIST_ANY *)Symbol);
   }
 
   return TRUE;
@@ -142,6 +142,39 @@ OcAcpiPatchTables (
   OC_ACPI_PATCH_ENTRY  *UserPatch;
   CONST CHAR8          *Comment;
   OC_ACPI_PATCH        Patch;
+  OC_ACPI_PATCH        *Patches;
+  UINT32               *PatchIndices;
+  EFI_STATUS           *PatchResults;
+  UINT32               PatchCount;
+
+  //
+  // Patches are collected to be applied in a single pass when possible.
+  //
+  Patches      = NULL;
+  PatchIndices = NULL;
+  PatchResults = NULL;
+  PatchCount   = 0;
+  if (Config->Acpi.Patch.Count > 0) {
+    Patches      = AllocatePool (Config->Acpi.Patch.Count * sizeof (*Patches));
+    PatchIndices = AllocatePool (Config->Acpi.Patch.Count * sizeof (*PatchIndices));
+    PatchResults = AllocatePool (Config->Acpi.Patch.Count * sizeof (*PatchResults));
+    if ((Patches == NULL) || (PatchIndices == NULL) || (PatchResults == NULL)) {
+      if (Patches != NULL) {
+        FreePool (Patches);
+        Patches = NULL;
+      }
+
+      if (PatchIndices != NULL) {
+        FreePool (PatchIndices);
+        PatchIndices = NULL;
+      }
+
+      if (PatchResults != NULL) {
+        FreePool (PatchResults);
+        PatchResults = NULL;
+      }
+    }
+  }
 
   for (Index = 0; Index < Config->Acpi.Patch.Count; ++Index) {
     UserPatch = Config->Acpi.Patch.Values[Index];
@@ -201,11 +234,39 @@ OcAcpiPatchTables (
       Patch.Count
       ));
 
+    if (Patches != NULL) {
+      CopyMem (&Patches[PatchCount], &Patch, sizeof (Patch));
+      PatchIndices[PatchCount] = Index;
+      ++PatchCount;
+      continue;
+    }
+
     Status = AcpiApplyPatch (Context, &Patch);
     if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_WARN, "OC: ACPI patcher failed (%a) at %u - %r\n", Comment, Index, Status));
     }
   }
+
+  if (Patches != NULL) {
+    AcpiApplyPatches (Context, Patches, PatchCount, PatchResults);
+
+    for (Index = 0; Index < PatchCount; ++Index) {
+      if (EFI_ERROR (PatchResults[Index])) {
+        UserPatch = Config->Acpi.Patch.Values[PatchIndices[Index]];
+        DEBUG ((
+          DEBUG_WARN,
+          "OC: ACPI patcher failed (%a) at %u - %r\n",
+          OC_BLOB_GET (&UserPatch->Comment),
+          PatchIndices[Index],
+          PatchResults[Index]
+          ));
+      }
+    }
+
+    FreePool (Patches);
+    FreePool (PatchIndices);
+    FreePool (PatchResults);
+  }
 }
 
 VOID
@@ -43,6 +43,32 @@ STATIC BOOLEAN            mOcCachelessInProgress;
 STATIC EFI_FILE_PROTOCOL  *mCustomKernelDirectory;
 STATIC BOOLEAN            mCustomKernelDirectoryInProgress;
 
+//
+// Persistent cache of the processed kernel, stored at the root of OC volume.
+//
+#define OC_KERNEL_CACHE_PATH       L"PersistentKernelCache.bin"
+#define OC_KERNEL_CACHE_SIGNATURE  SIGNATURE_32 ('O', 'C', 'K', 'C')
+#define OC_KERNEL_CACHE_VERSION    1U
+
+//
+// Manifest prefixing the processed kernel in the cache file.
+// Followed by NumKexts kext digests and KernelSize bytes of kernel.
+//
+typedef struct {
+  UINT32    Signature;
+  UINT32    Version;
+  UINT32    KernelSize;
+  UINT32    NumKexts;
+  UINT8     KernelDigest[SHA384_DIGEST_SIZE];
+  UINT8     ConfigDigest[SHA384_DIGEST_SIZE];
+  UINT8     DataDigest[SHA384_DIGEST_SIZE];
+} OC_KERNEL_CACHE_HEADER;
+
+STATIC EFI_FILE_PROTOCOL       *mKernelCacheRoot;
+STATIC BOOLEAN                 mKernelCacheInProgress;
+STATIC OC_KERNEL_CACHE_HEADER  *mKernelCacheManifest;
+STATIC UINT32                  mKernelCacheManifestSize;
+
 STATIC
 VOID
 OcKernelConfigureCapabilities (
@@ -862,6 +888,369 @@ OcKernelInitCacheless (
   return CachelessContextOverlayExtensionsDir (Context, File);
 }
 
+STATIC
+EFI_STATUS
+OcKernelCacheHashFile (
+  IN  EFI_FILE_PROTOCOL  *File,
+  OUT UINT8              *Digest
+  )
+{
+  EFI_STATUS      Status;
+  SHA384_CONTEXT  Context;
+  UINT8           *Buffer;
+  UINT32          FileSize;
+  UINT32          Position;
+  UINT32          ChunkSize;
+
+  Status = OcGetFileSize (File, &FileSize);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Buffer = AllocatePool (MIN (FileSize, BASE_1MB));
+  if (Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Sha384Init (&Context);
+
+  for (Position = 0; Position < FileSize; Position += ChunkSize) {
+    ChunkSize = MIN (FileSize - Position, BASE_1MB);
+    Status    = OcGetFileData (File, Position, ChunkSize, Buffer);
+    if (EFI_ERROR (Status)) {
+      FreePool (Buffer);
+      return Status;
+    }
+
+    Sha384Update (&Context, Buffer, ChunkSize);
+  }
+
+  Sha384Final (&Context, Digest);
+  FreePool (Buffer);
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+VOID
+OcKernelCacheHashKext (
+  IN  OC_KERNEL_ADD_ENTRY  *Kext,
+  OUT UINT8                *Digest
+  )
+{
+  SHA384_CONTEXT  Context;
+
+  //
+  // Kexts failing to load are disabled or left without data, record both.
+  //
+  Sha384Init (&Context);
+  Sha384Update (&Context, (UINT8 *)&Kext->Enabled, sizeof (Kext->Enabled));
+  Sha384Update (&Context, (UINT8 *)&Kext->PlistDataSize, sizeof (Kext->PlistDataSize));
+  if (Kext->PlistData != NULL) {
+    Sha384Update (&Context, Kext->PlistData, Kext->PlistDataSize);
+  }
+
+  Sha384Update (&Context, (UINT8 *)&Kext->ImageDataSize, sizeof (Kext->ImageDataSize));
+  if (Kext->ImageData != NULL) {
+    Sha384Update (&Context, Kext->ImageData, Kext->ImageDataSize);
+  }
+
+  Sha384Final (&Context, Digest);
+}
+
+STATIC
+EFI_STATUS
+OcKernelCacheHashConfig (
+  IN  BOOLEAN  Is32Bit,
+  OUT UINT8    *Digest
+  )
+{
+  SHA384_CONTEXT  Context;
+  CHAR8           *ConfigData;
+  UINT32          ConfigDataSize;
+  CONST CHAR8     *Version;
+
+  ConfigData = OcStorageReadFileUnicode (
+                 mOcStorage,
+                 OPEN_CORE_CONFIG_PATH,
+                 &ConfigDataSize
+                 );
+  if (ConfigData == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  Version = OcMiscGetVersionString ();
+
+  Sha384Init (&Context);
+  Sha384Update (&Context, (UINT8 *)ConfigData, ConfigDataSize);
+  Sha384Update (&Context, (CONST UINT8 *)Version, AsciiStrLen (Version));
+  Sha384Update (&Context, (UINT8 *)&Is32Bit, sizeof (Is32Bit));
+  //
+  // Only CPU identification is stable between boots, measured frequencies are not.
+  //
+  Sha384Update (&Context, (UINT8 *)mOcCpuInfo, OFFSET_OF (OC_CPU_INFO, ExternalClock));
+  Sha384Final (&Context, Digest);
+
+  FreePool (ConfigData);
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+VOID
+OcKernelCacheFreeManifest (
+  VOID
+  )
+{
+  if (mKernelCacheManifest != NULL) {
+    FreePool (mKernelCacheManifest);
+    mKernelCacheManifest     = NULL;
+    mKernelCacheManifestSize = 0;
+  }
+}
+
+STATIC
+EFI_STATUS
+OcKernelCacheBuildManifest (
+  IN  EFI_FILE_PROTOCOL  *KernelFile,
+  IN  BOOLEAN            Is32Bit
+  )
+{
+  EFI_STATUS  Status;
+  UINT32      NumKexts;
+  UINT32      Index;
+  UINT8       *KextDigests;
+
+  OcKernelCacheFreeManifest ();
+
+  NumKexts                 = mOcConfiguration->Kernel.Force.Count + mOcConfiguration->Kernel.Add.Count;
+  mKernelCacheManifestSize = sizeof (OC_KERNEL_CACHE_HEADER) + NumKexts * SHA384_DIGEST_SIZE;
+  mKernelCacheManifest     = AllocateZeroPool (mKernelCacheManifestSize);
+  if (mKernelCacheManifest == NULL) {
+    mKernelCacheManifestSize = 0;
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  mKernelCacheManifest->Signature = OC_KERNEL_CACHE_SIGNATURE;
+  mKernelCacheManifest->Version   = OC_KERNEL_CACHE_VERSION;
+  mKernelCacheManifest->NumKexts  = NumKexts;
+
+  Status = OcKernelCacheHashFile (KernelFile, mKernelCacheManifest->KernelDigest);
+  if (!EFI_ERROR (Status)) {
+    Status = OcKernelCacheHashConfig (Is32Bit, mKernelCacheManifest->ConfigDigest);
+  }
+
+  if (EFI_ERROR (Status)) {
+    OcKernelCacheFreeManifest ();
+    return Status;
+  }
+
+  KextDigests = (UINT8 *)(mKernelCacheManifest + 1);
+  for (Index = 0; Index < mOcConfiguration->Kernel.Force.Count; Index++) {
+    OcKernelCacheHashKext (mOcConfiguration->Kernel.Force.Values[Index], KextDigests);
+    KextDigests += SHA384_DIGEST_SIZE;
+  }
+
+  for (Index = 0; Index < mOcConfiguration->Kernel.Add.Count; Index++) {
+    OcKernelCacheHashKext (mOcConfiguration->Kernel.Add.Values[Index], KextDigests);
+    KextDigests += SHA384_DIGEST_SIZE;
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+OcKernelCacheOpen (
+  IN  UINT64             OpenMode,
+  OUT EFI_FILE_PROTOCOL  **File
+  )
+{
+  EFI_STATUS  Status;
+
+  mKernelCacheInProgress = TRUE;
+  Status                 = OcSafeFileOpen (mKernelCacheRoot, File, OC_KERNEL_CACHE_PATH, OpenMode, 0);
+  mKernelCacheInProgress = FALSE;
+
+  return Status;
+}
+
+STATIC
+EFI_STATUS
+OcKernelCacheLoad (
+  IN     EFI_FILE_PROTOCOL  *KernelFile,
+  IN     BOOLEAN            Is32Bit,
+  OUT UINT8                 **Kernel,
+  OUT UINT32                *KernelSize,
+  OUT UINT8                 *Digest  OPTIONAL
+  )
+{
+  EFI_STATUS              Status;
+  EFI_FILE_PROTOCOL       *File;
+  OC_KERNEL_CACHE_HEADER  *Header;
+  UINT32                  FileSize;
+  UINT32                  Index;
+  UINT8                   DataDigest[SHA384_DIGEST_SIZE];
+
+  Status = OcKernelCacheBuildManifest (KernelFile, Is32Bit);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "OC: Kernel cache manifest cannot be built - %r\n", Status));
+    return Status;
+  }
+
+  //
+  // Cache digest matches the one calculated by the kernel reader for secure boot.
+  //
+  if (Digest != NULL) {
+    CopyMem (Digest, mKernelCacheManifest->KernelDigest, SHA384_DIGEST_SIZE);
+  }
+
+  Status = OcKernelCacheOpen (EFI_FILE_MODE_READ, &File);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "OC: Kernel cache is missing - %r\n", Status));
+    return Status;
+  }
+
+  Header = AllocatePool (mKernelCacheManifestSize);
+  if (Header == NULL) {
+    File->Close (File);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = OcGetFileSize (File, &FileSize);
+  if (!EFI_ERROR (Status) && (FileSize < mKernelCacheManifestSize)) {
+    Status = EFI_END_OF_FILE;
+  }
+
+  if (!EFI_ERROR (Status)) {
+    Status = OcGetFileData (File, 0, mKernelCacheManifestSize, (UINT8 *)Header);
+  }
+
+  if (!EFI_ERROR (Status)) {
+    if (  (Header->Signature != OC_KERNEL_CACHE_SIGNATURE)
+       || (Header->Version != OC_KERNEL_CACHE_VERSION)
+       || (Header->NumKexts != mKernelCacheManifest->NumKexts)
+       || (Header->KernelSize != FileSize - mKernelCacheManifestSize))
+    {
+      DEBUG ((DEBUG_INFO, "OC: Kernel cache has incompatible layout\n"));
+      Status = EFI_INCOMPATIBLE_VERSION;
+    } else if (CompareMem (Header->KernelDigest, mKernelCacheManifest->KernelDigest, SHA384_DIGEST_SIZE) != 0) {
+      DEBUG ((DEBUG_INFO, "OC: Kernel cache kernel digest mismatch\n"));
+      Status = EFI_NOT_FOUND;
+    } else if (CompareMem (Header->ConfigDigest, mKernelCacheManifest->ConfigDigest, SHA384_DIGEST_SIZE) != 0) {
+      DEBUG ((DEBUG_INFO, "OC: Kernel cache config digest mismatch\n"));
+      Status = EFI_NOT_FOUND;
+    } else {
+      for (Index = 0; Index < Header->NumKexts; Index++) {
+        if (CompareMem (
+              (UINT8 *)(Header + 1) + Index * SHA384_DIGEST_SIZE,
+              (UINT8 *)(mKernelCacheManifest + 1) + Index * SHA384_DIGEST_SIZE,
+              SHA384_DIGEST_SIZE
+              ) != 0)
+        {
+          DEBUG ((DEBUG_INFO, "OC: Kernel cache kext %u digest mismatch\n", Index));
+          Status = EFI_NOT_FOUND;
+          break;
+        }
+      }
+    }
+  }
+
+  if (EFI_ERROR (Status)) {
+    FreePool (Header);
+    File->Close (File);
+    return Status;
+  }
+
+  *KernelSize = Header->KernelSize;
+  *Kernel     = AllocatePool (*KernelSize);
+  if (*Kernel == NULL) {
+    FreePool (Header);
+    File->Close (File);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = OcGetFileData (File, mKernelCacheManifestSize, *KernelSize, *Kernel);
+  File->Close (File);
+
+  if (!EFI_ERROR (Status)) {
+    Sha384 (DataDigest, *Kernel, *KernelSize);
+    if (CompareMem (DataDigest, Header->DataDigest, SHA384_DIGEST_SIZE) != 0) {
+      DEBUG ((DEBUG_INFO, "OC: Kernel cache data is corrupted\n"));
+      Status = EFI_CRC_ERROR;
+    }
+  }
+
+  FreePool (Header);
+
+  if (EFI_ERROR (Status)) {
+    FreePool (*Kernel);
+    *Kernel = NULL;
+    return Status;
+  }
+
+  //
+  // Nothing to store, the cache is up to date.
+  //
+  OcKernelCacheFreeManifest ();
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+VOID
+OcKernelCacheStore (
+  IN UINT8   *Kernel,
+  IN UINT32  KernelSize
+  )
+{
+  EFI_STATUS         Status;
+  EFI_FILE_PROTOCOL  *File;
+  UINTN              WrittenSize;
+
+  if (mKernelCacheManifest == NULL) {
+    return;
+  }
+
+  mKernelCacheManifest->KernelSize = KernelSize;
+  Sha384 (mKernelCacheManifest->DataDigest, Kernel, KernelSize);
+
+  //
+  // Remove the previous cache, as writing does not truncate the file.
+  //
+  Status = OcKernelCacheOpen (EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE, &File);
+  if (!EFI_ERROR (Status)) {
+    File->Delete (File);
+  }
+
+  Status = OcKernelCacheOpen (EFI_FILE_MODE_CREATE | EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE, &File);
+  if (!EFI_ERROR (Status)) {
+    WrittenSize = mKernelCacheManifestSize;
+    Status      = File->Write (File, &WrittenSize, mKernelCacheManifest);
+    if (!EFI_ERROR (Status) && (WrittenSize != mKernelCacheManifestSize)) {
+      Status = EFI_VOLUME_FULL;
+    }
+
+    if (!EFI_ERROR (Status)) {
+      WrittenSize = KernelSize;
+      Status      = File->Write (File, &WrittenSize, Kernel);
+      if (!EFI_ERROR (Status) && (WrittenSize != KernelSize)) {
+        Status = EFI_VOLUME_FULL;
+      }
+    }
+
+    if (EFI_ERROR (Status)) {
+      File->Delete (File);
+    } else {
+      File->Close (File);
+    }
+  }
+
+  DEBUG ((DEBUG_INFO, "OC: Storing %u byte kernel cache - %r\n", KernelSize, Status));
+
+  OcKernelCacheFreeManifest ();
+}
+
 STATIC
 EFI_STATUS
 OcKernelReadAppleKernel (
@@ -875,6 +1264,7 @@ OcKernelReadAppleKernel (
   OUT UINT32                *AllocatedSize,
   OUT UINT32                *ReservedExeSize,
   OUT UINT32                *LinkedExpansion,
+  OUT BOOLEAN               *Cached,
   OUT UINT8                 *Digest  OPTIONAL
   )
 {
@@ -913,20 +1303,38 @@ OcKernelReadAppleKernel (
     return EFI_UNSUPPORTED;
   }
 
+  //
+  // Try the processed kernel from the previous boot, when inputs did not change.
+  //
+  *Cached = FALSE;
+  if (mKernelCacheRoot != NULL) {
+    Status = OcKernelCacheLoad (KernelFile, Is32Bit, Kernel, KernelSize, Digest);
+    if (!EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_INFO, "OC: Using %u byte kernel cache for %s\n", *KernelSize, FileName));
+      *AllocatedSize = *KernelSize;
+      *Cached        = TRUE;
+    }
+  }
+
   //
   // Read last requested architecture for kernel.
   //
-  DEBUG ((DEBUG_INFO, "OC: Trying %a XNU hook on %s\n", Is32Bit ? "32-bit" : "64-bit", FileName));
-  Status = ReadAppleKernel (
-             KernelFile,
-             Is32Bit,
-             &IsKernel32Bit,
-             Kernel,
-             KernelSize,
-             AllocatedSize,
-             ReservedFullSize,
-             Digest
-             );
+  if (*Cached) {
+    IsKernel32Bit = Is32Bit;
+  } else {
+    DEBUG ((DEBUG_INFO, "OC: Trying %a XNU hook on %s\n", Is32Bit ? "32-bit" : "64-bit", FileName));
+    Status = ReadAppleKernel (
+               KernelFile,
+               Is32Bit,
+               &IsKernel32Bit,
+               Kernel,
+               KernelSize,
+               AllocatedSize,
+               ReservedFullSize,
+               Digest
+               );
+  }
+
   DEBUG ((
     DEBUG_INFO,
     "OC: Result of %a XNU hook on %s (%02X%02X%02X%02X) is %r\n",
@@ -947,6 +1355,7 @@ OcKernelReadAppleKernel (
     if (DarwinVersionNew < *DarwinVersion) {
       FreePool (*Kernel);
       *Kernel = NULL;
+      OcKernelCacheFreeManifest ();
 
       return EFI_INVALID_PARAMETER;
     }
@@ -958,10 +1367,13 @@ OcKernelReadAppleKernel (
       DEBUG ((DEBUG_WARN, "OC: %a kernel architecture is not available, aborting.\n", Is32Bit ? "32-bit" : "64-bit"));
       FreePool (*Kernel);
       *Kernel = NULL;
+      OcKernelCacheFreeManifest ();
       return EFI_NOT_FOUND;
     }
 
     *DarwinVersion = DarwinVersionNew;
+  } else {
+    OcKernelCacheFreeManifest ();
   }
 
   return Status;
@@ -982,6 +1394,7 @@ OcKernelFuzzyMatch (
   OUT UINT32                *AllocatedSize,
   OUT UINT32                *ReservedExeSize,
   OUT UINT32                *LinkedExpansion,
+  OUT BOOLEAN               *Cached,
   OUT UINT8                 *Digest  OPTIONAL
   )
 {
@@ -1073,6 +1486,7 @@ OcKernelFuzzyMatch (
                AllocatedSize,
                ReservedExeSize,
                LinkedExpansion,
+               Cached,
                Digest
                );
   } while (EFI_ERROR (Status));
@@ -1121,12 +1535,18 @@ OcKernelFileOpen (
   UINT32             ReservedFullSize;
   CHAR16             *NewFileName;
   EFI_FILE_PROTOCOL  *EspNewHandle;
+  BOOLEAN            Cached;
 
   if (mCustomKernelDirectoryInProgress) {
     DEBUG ((DEBUG_INFO, "OC: Skipping OpenFile hooking on ESP Kernels directory\n"));
     return OcSafeFileOpen (This, NewHandle, FileName, OpenMode, Attributes);
   }
 
+  if (mKernelCacheInProgress) {
+    DEBUG ((DEBUG_VERBOSE, "OC: Skipping OpenFile hooking on persistent kernel cache\n"));
+    return OcSafeFileOpen (This, NewHandle, FileName, OpenMode, Attributes);
+  }
+
   //
   // Prevent access to cache files depending on maximum cache type allowed.
   //
@@ -1181,6 +1601,7 @@ OcKernelFileOpen (
   // Only hook if the desired kernelcache file does not exist.
   //
   Kernel = NULL;
+  Cached = FALSE;
   if (  mOcConfiguration->Kernel.Scheme.FuzzyMatch
      && (Status == EFI_NOT_FOUND)
      && (OpenMode == EFI_FILE_MODE_READ)
@@ -1217,6 +1638,7 @@ OcKernelFileOpen (
                &AllocatedSize,
                &ReservedExeSize,
                &LinkedExpansion,
+               &Cached,
                UseSecureBoot ? mKernelDigest : NULL
                );
   }
@@ -1276,6 +1698,7 @@ OcKernelFileOpen (
                  &AllocatedSize,
                  &ReservedExeSize,
                  &LinkedExpansion,
+                 &Cached,
                  UseSecureBoot ? mKernelDigest : NULL
                  );
 
@@ -1300,6 +1723,7 @@ OcKernelFileOpen (
         DEBUG ((DEBUG_INFO, "OC: Blocking prelinked due to ForceKernelCache=%a: %s\n", ForceCacheType, FileName));
 
         FreePool (Kernel);
+        OcKernelCacheFreeManifest ();
         (*NewHandle)->Close (*NewHandle);
         *NewHandle = NULL;
 
@@ -1308,30 +1732,42 @@ OcKernelFileOpen (
 
       //
       // Apply patches to kernel itself, and then process prelinked.
+      // Cached kernel was already processed during one of the previous boots.
       //
-      OcKernelApplyPatches (
-        mOcConfiguration,
-        mOcCpuInfo,
-        mOcDarwinVersion,
-        mUse32BitKernel,
-        CacheTypeNone,
-        NULL,
-        Kernel,
-        KernelSize
-        );
-
-      PrelinkedStatus = OcKernelProcessPrelinked (
-                          mOcConfiguration,
-                          mOcDarwinVersion,
-                          mUse32BitKernel,
-                          Kernel,
-                          &KernelSize,
-                          AllocatedSize,
-                          LinkedExpansion,
-                          ReservedExeSize
-                          );
+      if (!Cached) {
+        OcKernelApplyPatches (
+          mOcConfiguration,
+          mOcCpuInfo,
+          mOcDarwinVersion,
+          mUse32BitKernel,
+          CacheTypeNone,
+          NULL,
+          Kernel,
+          KernelSize
+          );
+
+        PrelinkedStatus = OcKernelProcessPrelinked (
+                            mOcConfiguration,
+                            mOcDarwinVersion,
+                            mUse32BitKernel,
+                            Kernel,
+                            &KernelSize,
+                            AllocatedSize,
+                            LinkedExpansion,
+                            ReservedExeSize
+                            );
+
+        DEBUG ((DEBUG_INFO, "OC: Prelinked status - %r\n", PrelinkedStatus));
 
-      DEBUG ((DEBUG_INFO, "OC: Prelinked status - %r\n", PrelinkedStatus));
+        //
+        // Only prelinked kernels are worth storing, and a single one is kept.
+        //
+        if (!EFI_ERROR (PrelinkedStatus)) {
+          OcKernelCacheStore (Kernel, KernelSize);
+        } else {
+          OcKernelCacheFreeManifest ();
+        }
+      }
 
       Status = OcGetFileModificationTime (*NewHandle, &ModificationTime);
       if (EFI_ERROR (Status)) {
@@ -1571,6 +2007,26 @@ OcLoadKernelSupport (
       }
     }
 
+    //
+    // Open root for persistent kernel cache if needed.
+    // Without vault the cache cannot be trusted, and current CPU info varies between boots.
+    //
+    mKernelCacheRoot       = NULL;
+    mKernelCacheInProgress = FALSE;
+    if (mOcConfiguration->Kernel.Scheme.PersistentCache) {
+      if (mOcStorage->HasVault) {
+        DEBUG ((DEBUG_INFO, "OC: Persistent kernel cache is not supported with vault\n"));
+      } else if (mOcConfiguration->Kernel.Quirks.ProvideCurrentCpuInfo) {
+        DEBUG ((DEBUG_INFO, "OC: Persistent kernel cache is not supported with ProvideCurrentCpuInfo\n"));
+      } else {
+        Status = OcFindWritableOcFileSystem (&mKernelCacheRoot);
+        if (EFI_ERROR (Status)) {
+          DEBUG ((DEBUG_INFO, "OC: Unable to find root writable filesystem for kernel cache - %r\n", Status));
+          mKernelCacheRoot = NULL;
+        }
+      }
+    }
+
     OcImageLoaderRegisterConfigure (OcKernelConfigureCapabilities);
   } else {
     DEBUG ((DEBUG_ERROR, "OC: Failed to enable vfs - %r\n", Status));
@@ -1591,6 +2047,12 @@ OcUnloadKernelSupport (
       DEBUG ((DEBUG_ERROR, "OC: Failed to disable vfs - %r\n", Status));
     }
 
+    OcKernelCacheFreeManifest ();
+    if (mKernelCacheRoot != NULL) {
+      mKernelCacheRoot->Close (mKernelCacheRoot);
+      mKernelCacheRoot = NULL;
+    }
+
     mOcStorage       = NULL;
     mOcConfiguration = NULL;
   }
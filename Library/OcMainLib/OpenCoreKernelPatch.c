@@ -88,6 +88,10 @@ OcKernelApplyPatches (
   PATCHER_CONTEXT        KernelPatcher;
   UINT32                 Index;
   PATCHER_GENERIC_PATCH  Patch;
+  PATCHER_GENERIC_PATCH  *KernelPatches;
+  UINT32                 *KernelPatchIndices;
+  EFI_STATUS             *KernelPatchResults;
+  UINT32                 KernelPatchCount;
   OC_KERNEL_PATCH_ENTRY  *UserPatch;
   CONST CHAR8            *Target;
   CONST CHAR8            *Comment;
@@ -114,6 +118,11 @@ OcKernelApplyPatches (
       DEBUG ((DEBUG_ERROR, "OC: Kernel patcher kernel init failure - %r\n", Status));
       return;
     }
+
+    //
+    // Quirks look up kernel symbols one by one, index them once.
+    //
+    MachoInitializeIndex (&KernelPatcher.MachContext);
   }
 
   //
@@ -276,6 +285,35 @@ OcKernelApplyPatches (
     }
   }
 
+  //
+  // Kernel patches are collected to be applied in a single pass when possible.
+  //
+  KernelPatches      = NULL;
+  KernelPatchIndices = NULL;
+  KernelPatchResults = NULL;
+  KernelPatchCount   = 0;
+  if (IsKernelPatch && (Config->Kernel.Patch.Count > 0)) {
+    KernelPatches      = AllocatePool (Config->Kernel.Patch.Count * sizeof (*KernelPatches));
+    KernelPatchIndices = AllocatePool (Config->Kernel.Patch.Count * sizeof (*KernelPatchIndices));
+    KernelPatchResults = AllocatePool (Config->Kernel.Patch.Count * sizeof (*KernelPatchResults));
+    if ((KernelPatches == NULL) || (KernelPatchIndices == NULL) || (KernelPatchResults == NULL)) {
+      if (KernelPatches != NULL) {
+        FreePool (KernelPatches);
+        KernelPatches = NULL;
+      }
+
+      if (KernelPatchIndices != NULL) {
+        FreePool (KernelPatchIndices);
+        KernelPatchIndices = NULL;
+      }
+
+      if (KernelPatchResults != NULL) {
+        FreePool (KernelPatchResults);
+        KernelPatchResults = NULL;
+      }
+    }
+  }
+
   for (Index = 0; Index < Config->Kernel.Patch.Count; ++Index) {
     UserPatch = Config->Kernel.Patch.Values[Index];
     Target    = OC_BLOB_GET (&UserPatch->Identifier);
@@ -364,6 +402,13 @@ OcKernelApplyPatches (
     Patch.Limit = UserPatch->Limit;
 
     if (IsKernelPatch) {
+      if (KernelPatches != NULL) {
+        CopyMem (&KernelPatches[KernelPatchCount], &Patch, sizeof (Patch));
+        KernelPatchIndices[KernelPatchCount] = Index;
+        ++KernelPatchCount;
+        continue;
+      }
+
       Status = PatcherApplyGenericPatch (&KernelPatcher, &Patch);
     } else {
       if (CacheType == CacheTypeCacheless) {
@@ -387,6 +432,31 @@ OcKernelApplyPatches (
       Status
       ));
   }
+
+  if (KernelPatches != NULL) {
+    PatcherApplyGenericPatches (&KernelPatcher, KernelPatches, KernelPatchCount, KernelPatchResults);
+
+    for (Index = 0; Index < KernelPatchCount; ++Index) {
+      UserPatch = Config->Kernel.Patch.Values[KernelPatchIndices[Index]];
+      DEBUG ((
+        EFI_ERROR (KernelPatchResults[Index]) ? DEBUG_WARN : DEBUG_INFO,
+        "OC: %a patcher result %u for %a (%a) - %r\n",
+        PRINT_KERNEL_CACHE_TYPE (CacheType),
+        KernelPatchIndices[Index],
+        OC_BLOB_GET (&UserPatch->Identifier),
+        OC_BLOB_GET (&UserPatch->Comment),
+        KernelPatchResults[Index]
+        ));
+    }
+
+    FreePool (KernelPatches);
+    FreePool (KernelPatchIndices);
+    FreePool (KernelPatchResults);
+  }
+
+  if (IsKernelPatch) {
+    MachoFreeIndex (&KernelPatcher.MachContext);
+  }
 }
 
 VOID
@@ -426,6 +426,8 @@ OcMiscEarlyInit (
   EFI_STATUS      Status;
   CHAR8           *ConfigData;
   UINT32          ConfigDataSize;
+  VOID            *BinaryData;
+  UINT32          BinaryDataSize;
   EFI_TIME        BootTime;
   CONST CHAR8     *AsciiVault;
   OCS_VAULT_MODE  Vault;
@@ -440,11 +442,30 @@ OcMiscEarlyInit (
   if (ConfigData != NULL) {
     DEBUG ((DEBUG_INFO, "OC: Loaded configuration of %u bytes\n", ConfigDataSize));
 
-    Status = OcConfigurationInit (Config, ConfigData, ConfigDataSize, NULL);
+    //
+    // Prefer compiled configuration when it matches config.plist.
+    //
+    Status = EFI_NOT_FOUND;
+    if (OcStorageExistsFileUnicode (Storage, OPEN_CORE_CONFIG_BINARY_PATH)) {
+      BinaryData = OcStorageReadFileUnicode (
+                     Storage,
+                     OPEN_CORE_CONFIG_BINARY_PATH,
+                     &BinaryDataSize
+                     );
+      if (BinaryData != NULL) {
+        Status = OcConfigurationInitBinary (Config, BinaryData, BinaryDataSize, ConfigData, ConfigDataSize);
+        DEBUG ((DEBUG_INFO, "OC: Loaded compiled configuration of %u bytes - %r\n", BinaryDataSize, Status));
+        FreePool (BinaryData);
+      }
+    }
+
     if (EFI_ERROR (Status)) {
-      DEBUG ((DEBUG_ERROR, "OC: Failed to parse configuration!\n"));
-      CpuDeadLoop ();
-      return EFI_UNSUPPORTED; ///< Should be unreachable.
+      Status = OcConfigurationInit (Config, ConfigData, ConfigDataSize, NULL);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "OC: Failed to parse configuration!\n"));
+        CpuDeadLoop ();
+        return EFI_UNSUPPORTED; ///< Should be unreachable.
+      }
     }
 
     FreePool (ConfigData);
@@ -1007,6 +1028,7 @@ OcMiscBoot (
   Context->PollAppleHotKeys    = Config->Misc.Boot.PollAppleHotKeys;
   Context->HideAuxiliary       = Config->Misc.Boot.HideAuxiliary;
   Context->PickerAudioAssist   = Config->Misc.Boot.PickerAudioAssist;
+  Context->UseScanCache        = Config->Misc.Boot.ScanCache;
 
   OcPreLocateAudioProtocol (Context);
 
@@ -16,8 +16,55 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/BaseOverflowLib.h>
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/OcMiscLib.h>
 
+//
+// Terminator for patch lists in ApplyPatches dispatch table.
+//
+#define DATA_PATCH_LIST_END  MAX_UINT32
+
+//
+// Set in DATA_PATCH_MATCH Patch field for skipped matches.
+//
+#define DATA_PATCH_MATCH_SKIPPED  BIT31
+
+typedef struct {
+  //
+  // Next patch in the same dispatch list.
+  //
+  UINT32     Next;
+  //
+  // Pattern offset of the byte used for dispatch.
+  //
+  UINT32     Anchor;
+  //
+  // Lowest data offset for the next match.
+  //
+  UINT32     Start;
+  //
+  // Highest data offset for a match plus one.
+  //
+  UINT32     End;
+  //
+  // Matches left to skip.
+  //
+  UINT32     Skip;
+  //
+  // Replacements left or 0 for all.
+  //
+  UINT32     Count;
+  //
+  // Patch still looks for matches.
+  //
+  BOOLEAN    Active;
+} DATA_PATCH_STATE;
+
+typedef struct {
+  UINT32    Offset;
+  UINT32    Patch;
+} DATA_PATCH_MATCH;
+
 STATIC
 BOOLEAN
 InternalFindPattern (
@@ -182,3 +229,437 @@ ApplyPatch (
 
   return ReplaceCount;
 }
+
+STATIC
+BOOLEAN
+InternalMatchPatternAt (
+  IN CONST OC_DATA_PATCH  *Patch,
+  IN CONST UINT8          *Data
+  )
+{
+  UINT32  Index;
+
+  if (Patch->PatternMask == NULL) {
+    return CompareMem (Data, Patch->Pattern, Patch->PatternSize) == 0;
+  }
+
+  for (Index = 0; Index < Patch->PatternSize; ++Index) {
+    if ((Data[Index] & Patch->PatternMask[Index]) != Patch->Pattern[Index]) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+  Check whether patch matches at Offset once replacements of all patches
+  preceding it are performed. Matches must be sorted and not overlap.
+**/
+STATIC
+BOOLEAN
+InternalMatchPatternAfterReplace (
+  IN CONST OC_DATA_PATCH     *Patches,
+  IN UINT32                  Patch,
+  IN UINT32                  Offset,
+  IN CONST DATA_PATCH_MATCH  *Matches,
+  IN UINT32                  MatchCount,
+  IN CONST UINT8             *Data
+  )
+{
+  UINT32  Index;
+  UINT32  Position;
+  UINT32  Low;
+  UINT32  High;
+  UINT32  Middle;
+  UINT32  Other;
+  UINT8   Byte;
+
+  for (Index = 0; Index < Patches[Patch].PatternSize; ++Index) {
+    Position = Offset + Index;
+    Byte     = Data[Position];
+
+    //
+    // Find the last match starting at or before Position.
+    //
+    Low  = 0;
+    High = MatchCount;
+    while (Low < High) {
+      Middle = Low + (High - Low) / 2;
+      if (Matches[Middle].Offset <= Position) {
+        Low = Middle + 1;
+      } else {
+        High = Middle;
+      }
+    }
+
+    if (Low > 0) {
+      Other = Matches[Low - 1].Patch;
+      if (  ((Other & DATA_PATCH_MATCH_SKIPPED) == 0)
+         && (Other < Patch)
+         && (Position - Matches[Low - 1].Offset < Patches[Other].PatternSize))
+      {
+        Position -= Matches[Low - 1].Offset;
+        if (Patches[Other].ReplaceMask == NULL) {
+          Byte = Patches[Other].Replace[Position];
+        } else {
+          Byte = (Byte & ~Patches[Other].ReplaceMask[Position])
+                 | (Patches[Other].Replace[Position] & Patches[Other].ReplaceMask[Position]);
+        }
+      }
+    }
+
+    if (Patches[Patch].PatternMask != NULL) {
+      Byte &= Patches[Patch].PatternMask[Index];
+    }
+
+    if (Byte != Patches[Patch].Pattern[Index]) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+  Choose pattern byte used for dispatch, MAX_UINT32 when there is none.
+  Fully masked bytes are required, and frequent byte values are avoided.
+**/
+STATIC
+UINT32
+InternalChoosePatternAnchor (
+  IN CONST OC_DATA_PATCH  *Patch
+  )
+{
+  UINT32  Index;
+  UINT32  Anchor;
+
+  Anchor = MAX_UINT32;
+
+  for (Index = 0; Index < Patch->PatternSize; ++Index) {
+    if ((Patch->PatternMask != NULL) && (Patch->PatternMask[Index] != 0xFF)) {
+      continue;
+    }
+
+    if ((Patch->Pattern[Index] != 0x00) && (Patch->Pattern[Index] != 0xFF)) {
+      return Index;
+    }
+
+    if (Anchor == MAX_UINT32) {
+      Anchor = Index;
+    }
+  }
+
+  return Anchor;
+}
+
+STATIC
+BOOLEAN
+InternalAddPatchMatch (
+  IN OUT DATA_PATCH_MATCH  **Matches,
+  IN OUT UINT32            *MatchCount,
+  IN OUT UINT32            *MatchCapacity,
+  IN     UINT32            Offset,
+  IN     UINT32            Patch
+  )
+{
+  DATA_PATCH_MATCH  *NewMatches;
+
+  if (*MatchCount == *MatchCapacity) {
+    if (*MatchCapacity > MAX_UINT32 / 2 / sizeof (**Matches)) {
+      return FALSE;
+    }
+
+    NewMatches = AllocatePool (*MatchCapacity * 2 * sizeof (**Matches));
+    if (NewMatches == NULL) {
+      return FALSE;
+    }
+
+    CopyMem (NewMatches, *Matches, *MatchCount * sizeof (**Matches));
+    FreePool (*Matches);
+    *Matches        = NewMatches;
+    *MatchCapacity *= 2;
+  }
+
+  (*Matches)[*MatchCount].Offset = Offset;
+  (*Matches)[*MatchCount].Patch  = Patch;
+  ++(*MatchCount);
+  return TRUE;
+}
+
+/**
+  Verify that matches found on original data are the ones ApplyPatch would find
+  when patches are applied one after another.
+
+  @retval TRUE when no match interferes with another patch.
+**/
+STATIC
+BOOLEAN
+InternalPatchMatchesIndependent (
+  IN     CONST OC_DATA_PATCH     *Patches,
+  IN     UINT32                  PatchCount,
+  IN     CONST DATA_PATCH_STATE  *States,
+  IN OUT DATA_PATCH_MATCH        *Matches,
+  IN     UINT32                  MatchCount,
+  IN     CONST UINT8             *Data
+  )
+{
+  DATA_PATCH_MATCH  Match;
+  UINT32            Index;
+  UINT32            Index2;
+  UINT32            Patch;
+  UINT32            Other;
+  UINT32            OtherOffset;
+  UINT32            Offset;
+  UINT32            LastOffset;
+  UINT32            MaxEnd;
+  UINT32            MaxEndPatch;
+
+  //
+  // Matches are found in anchor order, which is almost offset order.
+  //
+  for (Index = 1; Index < MatchCount; ++Index) {
+    Match  = Matches[Index];
+    Index2 = Index;
+    while (Index2 > 0 && Matches[Index2 - 1].Offset > Match.Offset) {
+      Matches[Index2] = Matches[Index2 - 1];
+      --Index2;
+    }
+
+    Matches[Index2] = Match;
+  }
+
+  //
+  // Matches of different patches must not overlap.
+  //
+  MaxEnd      = 0;
+  MaxEndPatch = DATA_PATCH_LIST_END;
+  for (Index = 0; Index < MatchCount; ++Index) {
+    Patch = Matches[Index].Patch & ~DATA_PATCH_MATCH_SKIPPED;
+    if ((Matches[Index].Offset < MaxEnd) && (Patch != MaxEndPatch)) {
+      return FALSE;
+    }
+
+    if (Matches[Index].Offset + Patches[Patch].PatternSize > MaxEnd) {
+      MaxEnd      = Matches[Index].Offset + Patches[Patch].PatternSize;
+      MaxEndPatch = Patch;
+    }
+  }
+
+  //
+  // Replacements must not create new matches for the patches applied after them.
+  // Windows overlapping a replacement are checked with all preceding replacements
+  // performed, as they may only match together.
+  //
+  for (Index = 0; Index < MatchCount; ++Index) {
+    if ((Matches[Index].Patch & DATA_PATCH_MATCH_SKIPPED) != 0) {
+      continue;
+    }
+
+    Other       = Matches[Index].Patch;
+    OtherOffset = Matches[Index].Offset;
+
+    for (Patch = Other + 1; Patch < PatchCount; ++Patch) {
+      if (States[Patch].End == 0) {
+        continue;
+      }
+
+      Offset = OtherOffset >= Patches[Patch].PatternSize - 1
+               ? OtherOffset - (Patches[Patch].PatternSize - 1) : 0;
+      LastOffset = MIN (OtherOffset + Patches[Other].PatternSize, States[Patch].End);
+
+      for ( ; Offset < LastOffset; ++Offset) {
+        if (InternalMatchPatternAfterReplace (Patches, Patch, Offset, Matches, MatchCount, Data)) {
+          return FALSE;
+        }
+      }
+    }
+  }
+
+  return TRUE;
+}
+
+STATIC
+VOID
+InternalApplyPatchesSequentially (
+  IN OUT OC_DATA_PATCH  *Patches,
+  IN     UINT32         PatchCount,
+  IN OUT UINT8          *Data,
+  IN     UINT32         DataSize
+  )
+{
+  UINT32  Index;
+
+  for (Index = 0; Index < PatchCount; ++Index) {
+    Patches[Index].ReplaceCount = ApplyPatch (
+                                    Patches[Index].Pattern,
+                                    Patches[Index].PatternMask,
+                                    Patches[Index].PatternSize,
+                                    Patches[Index].Replace,
+                                    Patches[Index].ReplaceMask,
+                                    Data,
+                                    (Patches[Index].Limit > 0) && (Patches[Index].Limit < DataSize)
+                                      ? Patches[Index].Limit : DataSize,
+                                    Patches[Index].Count,
+                                    Patches[Index].Skip
+                                    );
+  }
+}
+
+BOOLEAN
+ApplyPatches (
+  IN OUT OC_DATA_PATCH  *Patches,
+  IN     UINT32         PatchCount,
+  IN OUT UINT8          *Data,
+  IN     UINT32         DataSize
+  )
+{
+  DATA_PATCH_STATE  *States;
+  DATA_PATCH_MATCH  *Matches;
+  UINT32            MatchCount;
+  UINT32            MatchCapacity;
+  UINT32            Buckets[256];
+  UINT32            Fallback;
+  UINT32            ActiveCount;
+  UINT32            List;
+  UINT32            Index;
+  UINT32            Patch;
+  UINT32            Offset;
+  UINT32            Size;
+  BOOLEAN           Success;
+
+  for (Index = 0; Index < PatchCount; ++Index) {
+    Patches[Index].ReplaceCount = 0;
+  }
+
+  if (PatchCount == 0) {
+    return TRUE;
+  }
+
+  States        = AllocateZeroPool (PatchCount * sizeof (*States));
+  MatchCapacity = 64;
+  Matches       = AllocatePool (MatchCapacity * sizeof (*Matches));
+  if ((States == NULL) || (Matches == NULL)) {
+    if (States != NULL) {
+      FreePool (States);
+    }
+
+    if (Matches != NULL) {
+      FreePool (Matches);
+    }
+
+    InternalApplyPatchesSequentially (Patches, PatchCount, Data, DataSize);
+    return FALSE;
+  }
+
+  SetMem32 (Buckets, sizeof (Buckets), DATA_PATCH_LIST_END);
+  Fallback    = DATA_PATCH_LIST_END;
+  ActiveCount = 0;
+
+  //
+  // Build the dispatch table. Every patch is keyed by its anchor byte value,
+  // patches without fully masked bytes are tried at every offset.
+  //
+  for (Index = PatchCount; Index > 0; --Index) {
+    Patch = Index - 1;
+    Size  = (Patches[Patch].Limit > 0) && (Patches[Patch].Limit < DataSize) ? Patches[Patch].Limit : DataSize;
+    if ((Patches[Patch].PatternSize == 0) || (Patches[Patch].PatternSize > Size)) {
+      continue;
+    }
+
+    States[Patch].End    = Size - Patches[Patch].PatternSize + 1;
+    States[Patch].Skip   = Patches[Patch].Skip;
+    States[Patch].Count  = Patches[Patch].Count;
+    States[Patch].Active = TRUE;
+    States[Patch].Anchor = InternalChoosePatternAnchor (&Patches[Patch]);
+    ++ActiveCount;
+
+    if (States[Patch].Anchor == MAX_UINT32) {
+      States[Patch].Anchor = 0;
+      States[Patch].Next   = Fallback;
+      Fallback             = Patch;
+    } else {
+      States[Patch].Next                                    = Buckets[Patches[Patch].Pattern[States[Patch].Anchor]];
+      Buckets[Patches[Patch].Pattern[States[Patch].Anchor]] = Patch;
+    }
+  }
+
+  MatchCount = 0;
+  Success    = TRUE;
+
+  for (Index = 0; Index < DataSize && ActiveCount > 0 && Success; ++Index) {
+    for (List = 0; List < 2 && Success; ++List) {
+      Patch = List == 0 ? Buckets[Data[Index]] : Fallback;
+
+      while (Patch != DATA_PATCH_LIST_END) {
+        if (!States[Patch].Active || (Index < States[Patch].Anchor)) {
+          Patch = States[Patch].Next;
+          continue;
+        }
+
+        Offset = Index - States[Patch].Anchor;
+        if (Offset >= States[Patch].End) {
+          States[Patch].Active = FALSE;
+          --ActiveCount;
+        } else if (  (Offset >= States[Patch].Start)
+                  && InternalMatchPatternAt (&Patches[Patch], &Data[Offset]))
+        {
+          States[Patch].Start = Offset + Patches[Patch].PatternSize;
+
+          if (States[Patch].Skip > 0) {
+            --States[Patch].Skip;
+            Success = InternalAddPatchMatch (&Matches, &MatchCount, &MatchCapacity, Offset, Patch | DATA_PATCH_MATCH_SKIPPED);
+          } else {
+            Success = InternalAddPatchMatch (&Matches, &MatchCount, &MatchCapacity, Offset, Patch);
+            if ((States[Patch].Count > 0) && (--States[Patch].Count == 0)) {
+              States[Patch].Active = FALSE;
+              --ActiveCount;
+            }
+          }
+
+          if (!Success) {
+            break;
+          }
+        }
+
+        Patch = States[Patch].Next;
+      }
+    }
+  }
+
+  if (Success) {
+    Success = InternalPatchMatchesIndependent (Patches, PatchCount, States, Matches, MatchCount, Data);
+  }
+
+  if (Success) {
+    for (Index = 0; Index < MatchCount; ++Index) {
+      if ((Matches[Index].Patch & DATA_PATCH_MATCH_SKIPPED) != 0) {
+        continue;
+      }
+
+      Patch  = Matches[Index].Patch;
+      Offset = Matches[Index].Offset;
+
+      if (Patches[Patch].ReplaceMask == NULL) {
+        CopyMem (&Data[Offset], Patches[Patch].Replace, Patches[Patch].PatternSize);
+      } else {
+        for (Size = 0; Size < Patches[Patch].PatternSize; ++Size) {
+          Data[Offset + Size] = (Data[Offset + Size] & ~Patches[Patch].ReplaceMask[Size])
+                                | (Patches[Patch].Replace[Size] & Patches[Patch].ReplaceMask[Size]);
+        }
+      }
+
+      ++Patches[Patch].ReplaceCount;
+    }
+  }
+
+  FreePool (Matches);
+  FreePool (States);
+
+  if (!Success) {
+    DEBUG ((DEBUG_VERBOSE, "OCM: Patch matches interfere, applying %u patches one by one\n", PatchCount));
+    InternalApplyPatchesSequentially (Patches, PatchCount, Data, DataSize);
+  }
+
+  return Success;
+}
@@ -18,7 +18,44 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 
 #include <Library/OcSerializeLib.h>
 #include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/BaseOverflowLib.h>
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+
+//
+// FNV-1a parameters used for schema hashing.
+//
+#define OC_SERIALIZED_HASH_BASIS  0x811C9DC5U
+#define OC_SERIALIZED_HASH_PRIME  0x01000193U
+
+//
+// Perfect hash table sizes are tried from twice the schema size up to
+// OC_SCHEMA_HASH_SCALE times the schema size, with OC_SCHEMA_HASH_SEEDS
+// seeds per size.
+//
+#define OC_SCHEMA_HASH_SCALE      16U
+#define OC_SCHEMA_HASH_SEEDS      256U
+#define OC_SCHEMA_HASH_MAX_SLOTS  BASE_16KB
+
+//
+// Schema entries, which presence is tracked without rescanning the dictionary.
+//
+#define OC_SCHEMA_SEEN_MAX  256U
+
+//
+// Perfect hash table, slots contain schema index + 1 or 0 when unused.
+//
+struct OC_SCHEMA_HASH_ {
+  UINT32    Seed;
+  UINT32    Mask;
+  UINT16    Slots[];
+};
+
+//
+// Marks schema lists, for which no perfect hash table could be built.
+//
+STATIC OC_SCHEMA_HASH  mSchemaHashUnavailable;
 
 STATIC
 CONST CHAR8 *
@@ -86,6 +123,119 @@ LookupConfigSchema (
   return NULL;
 }
 
+STATIC
+UINT32
+HashSchemaName (
+  IN UINT32       Seed,
+  IN CONST CHAR8  *Name
+  )
+{
+  UINT32  Length;
+  UINT32  Hash;
+
+  //
+  // Hashing full names costs more than the binary search it replaces,
+  // length and a few characters tell schema names apart just as well.
+  //
+  Length = (UINT32)AsciiStrLen (Name);
+  if (Length == 0) {
+    return Seed;
+  }
+
+  Hash = (OC_SERIALIZED_HASH_BASIS ^ Seed ^ Length) * OC_SERIALIZED_HASH_PRIME;
+  Hash = (Hash ^ (UINT8)Name[0]) * OC_SERIALIZED_HASH_PRIME;
+  Hash = (Hash ^ (UINT8)Name[Length / 2]) * OC_SERIALIZED_HASH_PRIME;
+  Hash = (Hash ^ (UINT8)Name[Length - 1]) * OC_SERIALIZED_HASH_PRIME;
+  return Hash ^ (Hash >> 16U);
+}
+
+STATIC
+OC_SCHEMA_HASH *
+BuildSchemaHash (
+  IN OC_SCHEMA_INFO  *Info
+  )
+{
+  OC_SCHEMA_HASH  *Hash;
+  UINT32          NumSlots;
+  UINT32          Seed;
+  UINT32          Index;
+  UINT32          Slot;
+
+  if ((Info->Dict.SchemaSize == 0) || (Info->Dict.SchemaSize > OC_SCHEMA_HASH_MAX_SLOTS / 2)) {
+    return &mSchemaHashUnavailable;
+  }
+
+  for (NumSlots = 4; NumSlots <= OC_SCHEMA_HASH_MAX_SLOTS; NumSlots *= 2) {
+    if (NumSlots < Info->Dict.SchemaSize * 2) {
+      continue;
+    }
+
+    if (NumSlots > Info->Dict.SchemaSize * OC_SCHEMA_HASH_SCALE) {
+      break;
+    }
+
+    Hash = AllocatePool (sizeof (*Hash) + NumSlots * sizeof (Hash->Slots[0]));
+    if (Hash == NULL) {
+      return &mSchemaHashUnavailable;
+    }
+
+    for (Seed = 0; Seed < OC_SCHEMA_HASH_SEEDS; ++Seed) {
+      ZeroMem (Hash->Slots, NumSlots * sizeof (Hash->Slots[0]));
+
+      for (Index = 0; Index < Info->Dict.SchemaSize; ++Index) {
+        Slot = HashSchemaName (Seed, Info->Dict.Schema[Index].Name) & (NumSlots - 1);
+        if (Hash->Slots[Slot] != 0) {
+          break;
+        }
+
+        Hash->Slots[Slot] = (UINT16)(Index + 1);
+      }
+
+      if (Index == Info->Dict.SchemaSize) {
+        Hash->Seed = Seed;
+        Hash->Mask = NumSlots - 1;
+        return Hash;
+      }
+    }
+
+    FreePool (Hash);
+  }
+
+  //
+  // Duplicate or indistinguishable names, binary search will do.
+  //
+  return &mSchemaHashUnavailable;
+}
+
+OC_SCHEMA *
+LookupConfigSchemaHash (
+  IN OC_SCHEMA_INFO  *Info,
+  IN CONST CHAR8     *Name
+  )
+{
+  OC_SCHEMA_HASH  *Hash;
+  UINT32          Slot;
+
+  if (Info->Dict.Hash == NULL) {
+    Info->Dict.Hash = BuildSchemaHash (Info);
+  }
+
+  Hash = Info->Dict.Hash;
+  if (Hash == &mSchemaHashUnavailable) {
+    return LookupConfigSchema (Info->Dict.Schema, Info->Dict.SchemaSize, Name);
+  }
+
+  //
+  // Every schema name has its own slot, so a single compare is enough.
+  //
+  Slot = Hash->Slots[HashSchemaName (Hash->Seed, Name) & Hash->Mask];
+  if ((Slot != 0) && (AsciiStrCmp (Info->Dict.Schema[Slot - 1].Name, Name) == 0)) {
+    return &Info->Dict.Schema[Slot - 1];
+  }
+
+  return NULL;
+}
+
 VOID
 ParseSerializedDict (
   OUT  VOID                *Serialized,
@@ -98,12 +248,16 @@ ParseSerializedDict (
   UINT32       DictSize;
   UINT32       Index;
   UINT32       Index2;
+  UINT32       SchemaIndex;
   CONST CHAR8  *CurrentKey;
   XML_NODE     *CurrentValue;
   XML_NODE     *OldValue;
   OC_SCHEMA    *NewSchema;
+  BOOLEAN      Found;
+  UINT8        Seen[OC_SCHEMA_SEEN_MAX / 8];
 
   DictSize = PlistDictChildren (Node);
+  ZeroMem (Seen, sizeof (Seen));
 
   for (Index = 0; Index < DictSize; Index++) {
     CurrentKey = PlistKeyValue (PlistDictChild (Node, Index, &CurrentValue));
@@ -129,7 +283,7 @@ ParseSerializedDict (
     //
     // We do not protect from duplicating serialized entries.
     //
-    NewSchema = LookupConfigSchema (Info->Dict.Schema, Info->Dict.SchemaSize, CurrentKey);
+    NewSchema = LookupConfigSchemaHash (Info, CurrentKey);
 
     if (NewSchema == NULL) {
       DEBUG ((DEBUG_WARN, "OCS: No schema for %a at %u index, context <%a>!\n", CurrentKey, Index, Context));
@@ -140,6 +294,11 @@ ParseSerializedDict (
       continue;
     }
 
+    SchemaIndex = (UINT32)(NewSchema - Info->Dict.Schema);
+    if (SchemaIndex < OC_SCHEMA_SEEN_MAX) {
+      Seen[SchemaIndex / 8] |= (UINT8)(1U << (SchemaIndex % 8));
+    }
+
     OldValue     = CurrentValue;
     CurrentValue = PlistNodeCast (CurrentValue, NewSchema->Type);
     if (CurrentValue == NULL) {
@@ -169,19 +328,22 @@ ParseSerializedDict (
       continue;
     }
 
-    for (Index2 = 0; Index2 < DictSize; ++Index2) {
-      CurrentKey = PlistKeyValue (PlistDictChild (Node, Index2, NULL));
+    if (Index < OC_SCHEMA_SEEN_MAX) {
+      Found = (Seen[Index / 8] & (1U << (Index % 8))) != 0;
+    } else {
+      Found = FALSE;
 
-      if (CurrentKey == NULL) {
-        continue;
-      }
+      for (Index2 = 0; Index2 < DictSize; ++Index2) {
+        CurrentKey = PlistKeyValue (PlistDictChild (Node, Index2, NULL));
 
-      if (AsciiStrCmp (CurrentKey, Info->Dict.Schema[Index].Name) == 0) {
-        break;
+        if ((CurrentKey != NULL) && (AsciiStrCmp (CurrentKey, Info->Dict.Schema[Index].Name) == 0)) {
+          Found = TRUE;
+          break;
+        }
       }
     }
 
-    if (Index2 == DictSize) {
+    if (!Found) {
       DEBUG ((
         DEBUG_WARN,
         "OCS: Missing key %a, context <%a>!\n",
@@ -513,3 +675,533 @@ ParseSerialized (
   XmlDocumentFree (Document);
   return TRUE;
 }
+
+//
+// OC_BLOB and OC_MAP layouts used for binary serialization.
+// OC_ARRAY matches OC_MAP layout except for the keys.
+//
+#define OC_SERIALIZED_BLOB_FIELDS(_, __) \
+  OC_BLOB (UINT8, [], {0}, _, __)
+OC_DECLARE (OC_SERIALIZED_BLOB)
+
+#define OC_SERIALIZED_LIST_FIELDS(_, __) \
+  OC_MAP (OC_SERIALIZED_BLOB, OC_SERIALIZED_BLOB, _, __)
+OC_DECLARE (OC_SERIALIZED_LIST)
+
+typedef enum {
+  OcSerializedKindDict,
+  OcSerializedKindValue,
+  OcSerializedKindBlob,
+  OcSerializedKindArray,
+  OcSerializedKindMap,
+  OcSerializedKindUnsupported
+} OC_SERIALIZED_KIND;
+
+//
+// Binary serialized data stream. Buffer is NULL when only measuring size.
+//
+typedef struct {
+  UINT8     *Buffer;
+  UINT32    Size;
+  UINT32    Offset;
+} OC_SERIALIZED_STREAM;
+
+STATIC
+OC_SERIALIZED_KIND
+GetSchemaKind (
+  IN OC_SCHEMA  *Schema
+  )
+{
+  if (Schema->Apply == ParseSerializedDict) {
+    return OcSerializedKindDict;
+  }
+
+  if (Schema->Apply == ParseSerializedValue) {
+    return OcSerializedKindValue;
+  }
+
+  if (Schema->Apply == ParseSerializedBlob) {
+    return OcSerializedKindBlob;
+  }
+
+  if (Schema->Apply == ParseSerializedArray) {
+    return OcSerializedKindArray;
+  }
+
+  if (Schema->Apply == ParseSerializedMap) {
+    return OcSerializedKindMap;
+  }
+
+  return OcSerializedKindUnsupported;
+}
+
+STATIC
+UINT32
+HashSerializedData (
+  IN UINT32      Hash,
+  IN CONST VOID  *Data,
+  IN UINT32      Size
+  )
+{
+  CONST UINT8  *Bytes;
+  UINT32       Index;
+
+  Bytes = (CONST UINT8 *)Data;
+
+  for (Index = 0; Index < Size; ++Index) {
+    Hash = (Hash ^ Bytes[Index]) * OC_SERIALIZED_HASH_PRIME;
+  }
+
+  return Hash;
+}
+
+STATIC
+UINT32
+HashSchemaDict (
+  IN UINT32          Hash,
+  IN OC_SCHEMA_INFO  *Info
+  );
+
+STATIC
+UINT32
+HashSchema (
+  IN UINT32     Hash,
+  IN OC_SCHEMA  *Schema
+  )
+{
+  UINT32  Kind;
+
+  //
+  // Only names, kinds and value sizes define binary layout, field offsets
+  // do not, so the same data can be used by 32-bit and 64-bit builds.
+  //
+  if (Schema->Name != NULL) {
+    Hash = HashSerializedData (Hash, Schema->Name, (UINT32)AsciiStrSize (Schema->Name));
+  } else {
+    Hash = HashSerializedData (Hash, "", 1);
+  }
+
+  Kind = GetSchemaKind (Schema);
+  Hash = HashSerializedData (Hash, &Kind, sizeof (Kind));
+
+  switch (Kind) {
+    case OcSerializedKindDict:
+      return HashSchemaDict (Hash, &Schema->Info);
+    case OcSerializedKindValue:
+      Kind = Schema->Info.Value.Type;
+      Hash = HashSerializedData (Hash, &Kind, sizeof (Kind));
+      return HashSerializedData (Hash, &Schema->Info.Value.FieldSize, sizeof (Schema->Info.Value.FieldSize));
+    case OcSerializedKindBlob:
+      Kind = Schema->Info.Blob.Type;
+      return HashSerializedData (Hash, &Kind, sizeof (Kind));
+    case OcSerializedKindArray:
+    case OcSerializedKindMap:
+      return HashSchema (Hash, Schema->Info.List.Schema);
+    default:
+      return Hash;
+  }
+}
+
+STATIC
+UINT32
+HashSchemaDict (
+  IN UINT32          Hash,
+  IN OC_SCHEMA_INFO  *Info
+  )
+{
+  UINT32  Index;
+
+  Hash = HashSerializedData (Hash, &Info->Dict.SchemaSize, sizeof (Info->Dict.SchemaSize));
+
+  for (Index = 0; Index < Info->Dict.SchemaSize; ++Index) {
+    Hash = HashSchema (Hash, &Info->Dict.Schema[Index]);
+  }
+
+  return Hash;
+}
+
+STATIC
+BOOLEAN
+SerializeBinaryData (
+  IN OUT OC_SERIALIZED_STREAM  *Stream,
+  IN     CONST VOID            *Data,
+  IN     UINT32                Size
+  )
+{
+  UINT32  NewOffset;
+
+  if (BaseOverflowAddU32 (Stream->Offset, Size, &NewOffset)) {
+    return FALSE;
+  }
+
+  if (Stream->Buffer != NULL) {
+    if (NewOffset > Stream->Size) {
+      return FALSE;
+    }
+
+    CopyMem (Stream->Buffer + Stream->Offset, Data, Size);
+  }
+
+  Stream->Offset = NewOffset;
+  return TRUE;
+}
+
+STATIC
+BOOLEAN
+SerializeBinaryBlob (
+  IN OUT OC_SERIALIZED_STREAM      *Stream,
+  IN     CONST OC_SERIALIZED_BLOB  *Blob
+  )
+{
+  return SerializeBinaryData (Stream, &Blob->Size, sizeof (Blob->Size))
+         && SerializeBinaryData (Stream, OC_BLOB_GET (Blob), Blob->Size);
+}
+
+STATIC
+BOOLEAN
+SerializeBinaryDict (
+  IN OUT OC_SERIALIZED_STREAM  *Stream,
+  IN     CONST VOID            *Serialized,
+  IN     OC_SCHEMA_INFO        *Info
+  );
+
+STATIC
+BOOLEAN
+SerializeBinarySchema (
+  IN OUT OC_SERIALIZED_STREAM  *Stream,
+  IN     CONST VOID            *Serialized,
+  IN     OC_SCHEMA             *Schema
+  )
+{
+  OC_SERIALIZED_KIND        Kind;
+  CONST OC_SERIALIZED_LIST  *List;
+  UINT32                    Index;
+
+  Kind = GetSchemaKind (Schema);
+
+  switch (Kind) {
+    case OcSerializedKindDict:
+      return SerializeBinaryDict (Stream, Serialized, &Schema->Info);
+    case OcSerializedKindValue:
+      return SerializeBinaryData (
+               Stream,
+               OC_SCHEMA_FIELD (Serialized, CONST VOID, Schema->Info.Value.Field),
+               Schema->Info.Value.FieldSize
+               );
+    case OcSerializedKindBlob:
+      return SerializeBinaryBlob (
+               Stream,
+               OC_SCHEMA_FIELD (Serialized, CONST OC_SERIALIZED_BLOB, Schema->Info.Blob.Field)
+               );
+    case OcSerializedKindArray:
+    case OcSerializedKindMap:
+      List = OC_SCHEMA_FIELD (Serialized, CONST OC_SERIALIZED_LIST, Schema->Info.List.Field);
+      if (!SerializeBinaryData (Stream, &List->Count, sizeof (List->Count))) {
+        return FALSE;
+      }
+
+      for (Index = 0; Index < List->Count; ++Index) {
+        if ((Kind == OcSerializedKindMap) && !SerializeBinaryBlob (Stream, List->Keys[Index])) {
+          return FALSE;
+        }
+
+        if (!SerializeBinarySchema (Stream, List->Values[Index], Schema->Info.List.Schema)) {
+          return FALSE;
+        }
+      }
+
+      return TRUE;
+    default:
+      DEBUG ((DEBUG_WARN, "OCS: No binary serialization for %a\n", Schema->Name != NULL ? Schema->Name : "entry"));
+      return FALSE;
+  }
+}
+
+STATIC
+BOOLEAN
+SerializeBinaryDict (
+  IN OUT OC_SERIALIZED_STREAM  *Stream,
+  IN     CONST VOID            *Serialized,
+  IN     OC_SCHEMA_INFO        *Info
+  )
+{
+  UINT32  Index;
+
+  for (Index = 0; Index < Info->Dict.SchemaSize; ++Index) {
+    if (!SerializeBinarySchema (Stream, Serialized, &Info->Dict.Schema[Index])) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+BOOLEAN
+SerializeBinary (
+  IN      CONST VOID      *Serialized,
+  IN      OC_SCHEMA_INFO  *RootSchema,
+  IN      CONST UINT8     *SourceDigest,
+  OUT     VOID            *Buffer      OPTIONAL,
+  IN OUT  UINT32          *BufferSize
+  )
+{
+  OC_SERIALIZED_STREAM         Stream;
+  OC_SERIALIZED_BINARY_HEADER  Header;
+  UINT32                       TotalSize;
+
+  if (Buffer != NULL) {
+    if (*BufferSize < sizeof (Header)) {
+      return FALSE;
+    }
+
+    Stream.Buffer = (UINT8 *)Buffer + sizeof (Header);
+    Stream.Size   = *BufferSize - sizeof (Header);
+  } else {
+    Stream.Buffer = NULL;
+    Stream.Size   = 0;
+  }
+
+  Stream.Offset = 0;
+
+  if (!SerializeBinaryDict (&Stream, Serialized, RootSchema)) {
+    return FALSE;
+  }
+
+  if (BaseOverflowAddU32 (sizeof (Header), Stream.Offset, &TotalSize)) {
+    return FALSE;
+  }
+
+  if (Buffer != NULL) {
+    Header.Signature  = OC_SERIALIZED_BINARY_SIGNATURE;
+    Header.Version    = OC_SERIALIZED_BINARY_VERSION;
+    Header.SchemaHash = HashSchemaDict (OC_SERIALIZED_HASH_BASIS, RootSchema);
+    Header.DataSize   = Stream.Offset;
+    CopyMem (Header.SourceDigest, SourceDigest, sizeof (Header.SourceDigest));
+    CopyMem (Buffer, &Header, sizeof (Header));
+  }
+
+  *BufferSize = TotalSize;
+  return TRUE;
+}
+
+STATIC
+CONST UINT8 *
+ParseSerializedBinaryData (
+  IN OUT OC_SERIALIZED_STREAM  *Stream,
+  IN     UINT32                Size
+  )
+{
+  CONST UINT8  *Data;
+
+  if (Stream->Size - Stream->Offset < Size) {
+    return NULL;
+  }
+
+  Data            = Stream->Buffer + Stream->Offset;
+  Stream->Offset += Size;
+  return Data;
+}
+
+STATIC
+BOOLEAN
+ParseSerializedBinaryBlob (
+  IN OUT OC_SERIALIZED_STREAM  *Stream,
+  OUT    VOID                  *Blob,
+  IN     BOOLEAN               IsString
+  )
+{
+  CONST UINT8  *Data;
+  UINT32       Size;
+  VOID         *BlobMemory;
+
+  Data = ParseSerializedBinaryData (Stream, sizeof (Size));
+  if (Data == NULL) {
+    return FALSE;
+  }
+
+  CopyMem (&Size, Data, sizeof (Size));
+
+  Data = ParseSerializedBinaryData (Stream, Size);
+  if (Data == NULL) {
+    return FALSE;
+  }
+
+  //
+  // Empty strings keep the default value, which is terminated.
+  //
+  if (IsString && (Size > 0) && (Data[Size - 1] != '\0')) {
+    return FALSE;
+  }
+
+  BlobMemory = OcBlobAllocate (Blob, Size, NULL);
+  if (BlobMemory == NULL) {
+    return FALSE;
+  }
+
+  CopyMem (BlobMemory, Data, Size);
+  return TRUE;
+}
+
+STATIC
+BOOLEAN
+ParseSerializedBinaryDict (
+  IN OUT OC_SERIALIZED_STREAM  *Stream,
+  OUT    VOID                  *Serialized,
+  IN     OC_SCHEMA_INFO        *Info
+  );
+
+STATIC
+BOOLEAN
+ParseSerializedBinarySchema (
+  IN OUT OC_SERIALIZED_STREAM  *Stream,
+  OUT    VOID                  *Serialized,
+  IN     OC_SCHEMA             *Schema
+  )
+{
+  OC_SERIALIZED_KIND  Kind;
+  CONST UINT8         *Data;
+  UINT32              Size;
+  UINT32              Count;
+  UINT32              Index;
+  VOID                *NewValue;
+  VOID                *NewKey;
+
+  Kind = GetSchemaKind (Schema);
+
+  switch (Kind) {
+    case OcSerializedKindDict:
+      return ParseSerializedBinaryDict (Stream, Serialized, &Schema->Info);
+    case OcSerializedKindValue:
+      Size = Schema->Info.Value.FieldSize;
+      Data = ParseSerializedBinaryData (Stream, Size);
+      if (Data == NULL) {
+        return FALSE;
+      }
+
+      if (  (Schema->Info.Value.Type == OC_SCHEMA_VALUE_STRING)
+         && ((Size == 0) || (Data[Size - 1] != '\0')))
+      {
+        return FALSE;
+      }
+
+      CopyMem (OC_SCHEMA_FIELD (Serialized, VOID, Schema->Info.Value.Field), Data, Size);
+      return TRUE;
+    case OcSerializedKindBlob:
+      return ParseSerializedBinaryBlob (
+               Stream,
+               OC_SCHEMA_FIELD (Serialized, VOID, Schema->Info.Blob.Field),
+               Schema->Info.Blob.Type == OC_SCHEMA_BLOB_STRING
+               );
+    case OcSerializedKindArray:
+    case OcSerializedKindMap:
+      Data = ParseSerializedBinaryData (Stream, sizeof (Count));
+      if (Data == NULL) {
+        return FALSE;
+      }
+
+      CopyMem (&Count, Data, sizeof (Count));
+
+      //
+      // Every entry takes at least one byte, do not allocate past the data.
+      //
+      if (Count > Stream->Size - Stream->Offset) {
+        return FALSE;
+      }
+
+      for (Index = 0; Index < Count; ++Index) {
+        if (!OcListEntryAllocate (
+               OC_SCHEMA_FIELD (Serialized, VOID, Schema->Info.List.Field),
+               &NewValue,
+               Kind == OcSerializedKindMap ? &NewKey : NULL
+               ))
+        {
+          return FALSE;
+        }
+
+        if ((Kind == OcSerializedKindMap) && !ParseSerializedBinaryBlob (Stream, NewKey, TRUE)) {
+          return FALSE;
+        }
+
+        if (!ParseSerializedBinarySchema (Stream, NewValue, Schema->Info.List.Schema)) {
+          return FALSE;
+        }
+      }
+
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+STATIC
+BOOLEAN
+ParseSerializedBinaryDict (
+  IN OUT OC_SERIALIZED_STREAM  *Stream,
+  OUT    VOID                  *Serialized,
+  IN     OC_SCHEMA_INFO        *Info
+  )
+{
+  UINT32  Index;
+
+  for (Index = 0; Index < Info->Dict.SchemaSize; ++Index) {
+    if (!ParseSerializedBinarySchema (Stream, Serialized, &Info->Dict.Schema[Index])) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+BOOLEAN
+ParseSerializedBinary (
+  OUT  VOID            *Serialized,
+  IN   OC_SCHEMA_INFO  *RootSchema,
+  IN   CONST VOID      *Buffer,
+  IN   UINT32          BufferSize,
+  IN   CONST UINT8     *SourceDigest
+  )
+{
+  OC_SERIALIZED_BINARY_HEADER  Header;
+  OC_SERIALIZED_STREAM         Stream;
+
+  if (BufferSize < sizeof (Header)) {
+    DEBUG ((DEBUG_INFO, "OCS: Binary serialized data is too small - %u\n", BufferSize));
+    return FALSE;
+  }
+
+  CopyMem (&Header, Buffer, sizeof (Header));
+
+  if (  (Header.Signature != OC_SERIALIZED_BINARY_SIGNATURE)
+     || (Header.Version != OC_SERIALIZED_BINARY_VERSION)
+     || (Header.DataSize != BufferSize - sizeof (Header)))
+  {
+    DEBUG ((DEBUG_INFO, "OCS: Binary serialized data header is invalid\n"));
+    return FALSE;
+  }
+
+  if (Header.SchemaHash != HashSchemaDict (OC_SERIALIZED_HASH_BASIS, RootSchema)) {
+    DEBUG ((DEBUG_INFO, "OCS: Binary serialized data schema mismatch\n"));
+    return FALSE;
+  }
+
+  if (CompareMem (Header.SourceDigest, SourceDigest, sizeof (Header.SourceDigest)) != 0) {
+    DEBUG ((DEBUG_INFO, "OCS: Binary serialized data is stale\n"));
+    return FALSE;
+  }
+
+  Stream.Buffer = (UINT8 *)Buffer + sizeof (Header);
+  Stream.Size   = Header.DataSize;
+  Stream.Offset = 0;
+
+  if (!ParseSerializedBinaryDict (&Stream, Serialized, RootSchema)) {
+    DEBUG ((DEBUG_INFO, "OCS: Binary serialized data is malformed at %u offset\n", Stream.Offset));
+    return FALSE;
+  }
+
+  if (Stream.Offset != Stream.Size) {
+    DEBUG ((DEBUG_INFO, "OCS: Binary serialized data has %u trailing bytes\n", Stream.Size - Stream.Offset));
+    return FALSE;
+  }
+
+  return TRUE;
+}
@@ -544,3 +544,126 @@ SmbiosGetStructureCount (
 
   return Count;
 }
+
+EFI_STATUS
+SmbiosBuildStructureIndex (
+  IN  APPLE_SMBIOS_STRUCTURE_POINTER  SmbiosTable,
+  IN  UINT32                          SmbiosTableSize,
+  OUT OC_SMBIOS_STRUCTURE_INDEX       *Index
+  )
+{
+  APPLE_SMBIOS_STRUCTURE_POINTER  Walker;
+  UINT32                          WalkerSize;
+  UINT32                          Length;
+  UINT32                          Type;
+  UINT32                          Pass;
+
+  ZeroMem (Index, sizeof (*Index));
+
+  //
+  // Structures are walked twice, counting them first, and then saving their
+  // offsets grouped by type. The walk follows SmbiosGetStructureCount.
+  //
+  for (Pass = 0; Pass < 2; ++Pass) {
+    Walker     = SmbiosTable;
+    WalkerSize = SmbiosTableSize;
+
+    while (WalkerSize >= sizeof (SMBIOS_STRUCTURE)) {
+      Length = SmbiosGetStructureLength (Walker, WalkerSize);
+      if (Length == 0) {
+        break;
+      }
+
+      Type = Walker.Standard.Hdr->Type;
+      if (Pass == 0) {
+        ++Index->Start[Type + 1];
+      } else {
+        Index->Offsets[Index->Start[Type]++] = (UINT32)(Walker.Raw - SmbiosTable.Raw);
+      }
+
+      if (Type == SMBIOS_TYPE_END_OF_TABLE) {
+        break;
+      }
+
+      Walker.Raw += Length;
+      WalkerSize -= Length;
+    }
+
+    if (Pass == 0) {
+      for (Type = 1; Type < ARRAY_SIZE (Index->Start); ++Type) {
+        Index->Start[Type] += Index->Start[Type - 1];
+      }
+
+      if (Index->Start[ARRAY_SIZE (Index->Start) - 1] > 0) {
+        Index->Offsets = AllocatePool (Index->Start[ARRAY_SIZE (Index->Start) - 1] * sizeof (*Index->Offsets));
+        if (Index->Offsets == NULL) {
+          return EFI_OUT_OF_RESOURCES;
+        }
+      }
+    }
+  }
+
+  //
+  // Saving offsets moved every start to the start of the next type.
+  //
+  for (Type = ARRAY_SIZE (Index->Start) - 1; Type > 0; --Type) {
+    Index->Start[Type] = Index->Start[Type - 1];
+  }
+
+  Index->Start[0] = 0;
+  Index->Table    = SmbiosTable;
+
+  return EFI_SUCCESS;
+}
+
+VOID
+SmbiosFreeStructureIndex (
+  IN OUT OC_SMBIOS_STRUCTURE_INDEX  *Index
+  )
+{
+  if (Index->Offsets != NULL) {
+    FreePool (Index->Offsets);
+  }
+
+  ZeroMem (Index, sizeof (*Index));
+}
+
+APPLE_SMBIOS_STRUCTURE_POINTER
+SmbiosGetIndexedStructureOfType (
+  IN  CONST OC_SMBIOS_STRUCTURE_INDEX  *Index,
+  IN  SMBIOS_TYPE                      Type,
+  IN  UINT16                           TypeIndex
+  )
+{
+  APPLE_SMBIOS_STRUCTURE_POINTER  Structure;
+
+  if (  (TypeIndex == 0)
+     || (TypeIndex > Index->Start[Type + 1] - Index->Start[Type]))
+  {
+    Structure.Raw = NULL;
+    return Structure;
+  }
+
+  Structure.Raw = Index->Table.Raw + Index->Offsets[Index->Start[Type] + TypeIndex - 1];
+  return Structure;
+}
+
+UINT16
+SmbiosGetIndexedStructureCount (
+  IN  CONST OC_SMBIOS_STRUCTURE_INDEX  *Index,
+  IN  SMBIOS_TYPE                      Type
+  )
+{
+  UINT32  Count;
+
+  Count = Index->Start[Type + 1] - Index->Start[Type];
+
+  //
+  // SmbiosGetStructureCount returns 0 on wraparound.
+  //
+  if (Count > MAX_UINT16) {
+    return 0;
+  }
+
+  return (UINT16)Count;
+}
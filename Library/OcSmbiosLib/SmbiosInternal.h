@@ -108,6 +108,24 @@ typedef struct OC_SMBIOS_MAPPING_ {
   SMBIOS_HANDLE    New;
 } OC_SMBIOS_MAPPING;
 
+//
+// Index of SMBIOS structures by type.
+//
+typedef struct OC_SMBIOS_STRUCTURE_INDEX_ {
+  //
+  // Indexed table.
+  //
+  APPLE_SMBIOS_STRUCTURE_POINTER    Table;
+  //
+  // Offsets of structures of type T are Offsets[Start[T]] to Offsets[Start[T + 1] - 1].
+  //
+  UINT32                            Start[MAX_UINT8 + 2];
+  //
+  // Structure offsets from table start in table order within each type.
+  //
+  UINT32                            *Offsets;
+} OC_SMBIOS_STRUCTURE_INDEX;
+
 /**
   Allocate bytes in SMBIOS table if necessary
 
@@ -247,4 +265,62 @@ SmbiosGetStructureCount (
   IN  SMBIOS_TYPE                     Type
   );
 
+/**
+  Index structures of every type in one walk over the table.
+
+  @param[in]  SmbiosTable      Pointer to SMBIOS table.
+  @param[in]  SmbiosTableSize  SMBIOS table size
+  @param[out] Index            Structure index.
+
+  @retval EFI_SUCCESS on success
+**/
+EFI_STATUS
+SmbiosBuildStructureIndex (
+  IN  APPLE_SMBIOS_STRUCTURE_POINTER  SmbiosTable,
+  IN  UINT32                          SmbiosTableSize,
+  OUT OC_SMBIOS_STRUCTURE_INDEX       *Index
+  );
+
+/**
+  Free structure index.
+
+  @param[in,out] Index  Structure index.
+**/
+VOID
+SmbiosFreeStructureIndex (
+  IN OUT OC_SMBIOS_STRUCTURE_INDEX  *Index
+  );
+
+/**
+  Obtain Nth structure of specified type from structure index.
+  Matches SmbiosGetStructureOfType for the indexed table.
+
+  @param[in] Index            Structure index.
+  @param[in] Type             SMBIOS table type
+  @param[in] TypeIndex        SMBIOS table index starting from 1
+
+  @retval found table or NULL
+**/
+APPLE_SMBIOS_STRUCTURE_POINTER
+SmbiosGetIndexedStructureOfType (
+  IN  CONST OC_SMBIOS_STRUCTURE_INDEX  *Index,
+  IN  SMBIOS_TYPE                      Type,
+  IN  UINT16                           TypeIndex
+  );
+
+/**
+  Obtain structure count of specified type from structure index.
+  Matches SmbiosGetStructureCount for the indexed table.
+
+  @param[in] Index            Structure index.
+  @param[in] Type             SMBIOS table type
+
+  @retval structure count or 0
+**/
+UINT16
+SmbiosGetIndexedStructureCount (
+  IN  CONST OC_SMBIOS_STRUCTURE_INDEX  *Index,
+  IN  SMBIOS_TYPE                      Type
+  );
+
 #endif // SMBIOS_INTERNAL_H
@@ -47,6 +47,7 @@ STATIC SMBIOS_TABLE_ENTRY_POINT        *mOriginalSmbios;
 STATIC SMBIOS_TABLE_3_0_ENTRY_POINT    *mOriginalSmbios3;
 STATIC APPLE_SMBIOS_STRUCTURE_POINTER  mOriginalTable;
 STATIC UINT32                          mOriginalTableSize;
+STATIC OC_SMBIOS_STRUCTURE_INDEX       mOriginalIndex;
 
 #define SMBIOS_OVERRIDE_S(Table, Field, Original, Value, Index, Fallback) \
   do { \
@@ -90,6 +91,10 @@ SmbiosGetOriginalStructure (
     return mOriginalTable;
   }
 
+  if (mOriginalIndex.Table.Raw != NULL) {
+    return SmbiosGetIndexedStructureOfType (&mOriginalIndex, Type, Index);
+  }
+
   return SmbiosGetStructureOfType (mOriginalTable, mOriginalTableSize, Type, Index);
 }
 
@@ -103,6 +108,10 @@ SmbiosGetOriginalStructureCount (
     return 0;
   }
 
+  if (mOriginalIndex.Table.Raw != NULL) {
+    return SmbiosGetIndexedStructureCount (&mOriginalIndex, Type);
+  }
+
   return SmbiosGetStructureCount (mOriginalTable, mOriginalTableSize, Type);
 }
 
@@ -1459,6 +1468,7 @@ OcSmbiosTablePrepare (
   mOriginalSmbios3   = NULL;
   mOriginalTableSize = 0;
   mOriginalTable.Raw = NULL;
+  SmbiosFreeStructureIndex (&mOriginalIndex);
   ZeroMem (SmbiosTable, sizeof (*SmbiosTable));
   SmbiosTable->Handle = OcSmbiosAutomaticHandle;
 
@@ -1545,6 +1555,17 @@ OcSmbiosTablePrepare (
     mOriginalTable.Raw = (UINT8 *)(UINTN)mOriginalSmbios3->TableAddress;
   }
 
+  //
+  // Original structures are looked up per type and instance many times.
+  //
+  if (mOriginalTable.Raw != NULL) {
+    Status = SmbiosBuildStructureIndex (mOriginalTable, mOriginalTableSize, &mOriginalIndex);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_INFO, "OCSMB: Failed to index original table - %r\n", Status));
+      SmbiosFreeStructureIndex (&mOriginalIndex);
+    }
+  }
+
   if (mOriginalSmbios != NULL) {
     DEBUG ((
       DEBUG_INFO,
@@ -1586,6 +1607,7 @@ OcSmbiosTableFree (
     FreePool (Table->Table);
   }
 
+  SmbiosFreeStructureIndex (&mOriginalIndex);
   ZeroMem (Table, sizeof (*Table));
 }
 
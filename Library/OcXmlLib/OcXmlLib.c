@@ -52,17 +52,49 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 **/
 #define XML_EXPORT_MIN_ALLOCATION_SIZE  4096
 
+/**
+  Minimal size of arena blocks allocated after the initial one.
+  Larger requests get a block of their own.
+**/
+#define XML_ARENA_MIN_BLOCK_SIZE  (64U * 1024)
+
 #define XML_PLIST_HEADER  "<?xml version=\"1.0\" encoding=\"UTF-8\"?><!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">"
 
 struct XML_NODE_LIST_;
 struct XML_PARSER_;
+struct XML_ARENA_BLOCK_;
+
+typedef struct XML_NODE_LIST_    XML_NODE_LIST;
+typedef struct XML_PARSER_       XML_PARSER;
+typedef struct XML_ARENA_BLOCK_  XML_ARENA_BLOCK;
+
+/**
+  Bump allocator owning all nodes and child lists of a document.
+  Memory is only released when the document is freed.
+**/
+typedef struct {
+  XML_ARENA_BLOCK    *Blocks;
+} XML_ARENA;
+
+struct XML_ARENA_BLOCK_ {
+  XML_ARENA_BLOCK    *Next;
+  UINT32             Size;
+  UINT32             Used;
+  UINT64             Data[];
+};
 
-typedef struct XML_NODE_LIST_  XML_NODE_LIST;
-typedef struct XML_PARSER_     XML_PARSER;
+/**
+  Lazy node states.
+**/
+#define XML_NODE_LAZY_NONE     0U
+#define XML_NODE_LAZY_PENDING  1U
+#define XML_NODE_LAZY_LOADING  2U
+#define XML_NODE_LAZY_FAILED   3U
 
 /**
   An XML_NODE will always contain a tag name and possibly a list of
   children or text content.
+  Children of lazy nodes are kept as unparsed text in Content until accessed.
 **/
 struct XML_NODE_ {
   CONST CHAR8      *Name;
@@ -70,6 +102,9 @@ struct XML_NODE_ {
   CONST CHAR8      *Content;
   XML_NODE         *Real;
   XML_NODE_LIST    *Children;
+  XML_DOCUMENT     *Document;
+  UINT32           LazyLength;
+  UINT32           LazyState;
 };
 
 struct XML_NODE_LIST_ {
@@ -95,16 +130,27 @@ struct XML_DOCUMENT_ {
 
   XML_NODE       *Root;
   XML_REFLIST    References;
+  BOOLEAN        WithRefs;
+  UINT32         LazyLevel;
+  XML_ARENA      Arena;
 };
 
 /**
   Parser context.
 **/
 struct XML_PARSER_ {
-  CHAR8     *Buffer;
-  UINT32    Position;
-  UINT32    Length;
-  UINT32    Level;
+  CHAR8           *Buffer;
+  UINT32          Position;
+  UINT32          Length;
+  UINT32          Level;
+  XML_DOCUMENT    *Document;
+  //
+  // Children of the nodes being parsed, which get their exactly sized
+  // lists once the node is closed.
+  //
+  XML_NODE        **Stack;
+  UINT32          StackCount;
+  UINT32          StackAllocCount;
 };
 
 /**
@@ -186,32 +232,194 @@ XmlParseAttributeNumber (
   return TRUE;
 }
 
+/**
+  Allocate the first arena block.
+
+  @param[in,out]  Arena  A pointer to the arena.
+  @param[in]      Size   Size of the block.
+
+  @retval  TRUE on success.
+**/
+STATIC
+BOOLEAN
+XmlArenaReserve (
+  IN OUT  XML_ARENA  *Arena,
+  IN      UINT32     Size
+  )
+{
+  XML_ARENA_BLOCK  *Block;
+
+  ASSERT (Arena != NULL);
+  ASSERT (Arena->Blocks == NULL);
+
+  Block = AllocatePool (sizeof (XML_ARENA_BLOCK) + Size);
+  if (Block == NULL) {
+    return FALSE;
+  }
+
+  Block->Next   = NULL;
+  Block->Size   = Size;
+  Block->Used   = 0;
+  Arena->Blocks = Block;
+
+  return TRUE;
+}
+
+/**
+  Allocate memory from the arena.
+
+  @param[in,out]  Arena  A pointer to the arena.
+  @param[in]      Size   Size of the allocation.
+
+  @return  Allocated memory or NULL.
+**/
+STATIC
+VOID *
+XmlArenaAllocate (
+  IN OUT  XML_ARENA  *Arena,
+  IN      UINT32     Size
+  )
+{
+  XML_ARENA_BLOCK  *Block;
+  UINT32           BlockSize;
+
+  ASSERT (Arena != NULL);
+
+  if (BaseOverflowAddU32 (Size, sizeof (UINT64) - 1, &Size)) {
+    return NULL;
+  }
+
+  Size &= ~(UINT32)(sizeof (UINT64) - 1);
+
+  Block = Arena->Blocks;
+  if ((Block != NULL) && (Block->Size - Block->Used >= Size)) {
+    Block->Used += Size;
+    return (UINT8 *)Block->Data + Block->Used - Size;
+  }
+
+  BlockSize = MAX (Size, XML_ARENA_MIN_BLOCK_SIZE);
+  if (BaseOverflowAddU32 (BlockSize, sizeof (XML_ARENA_BLOCK), &BlockSize)) {
+    return NULL;
+  }
+
+  Block = AllocatePool (BlockSize);
+  if (Block == NULL) {
+    return NULL;
+  }
+
+  Block->Size = BlockSize - sizeof (XML_ARENA_BLOCK);
+  Block->Used = Size;
+
+  //
+  // Keep allocating from the current block when the new one is consumed
+  // by a single large allocation.
+  //
+  if ((Arena->Blocks != NULL) && (Size > XML_ARENA_MIN_BLOCK_SIZE / 4)) {
+    Block->Next         = Arena->Blocks->Next;
+    Arena->Blocks->Next = Block;
+  } else {
+    Block->Next   = Arena->Blocks;
+    Arena->Blocks = Block;
+  }
+
+  return Block->Data;
+}
+
+/**
+  Free the arena with all memory allocated from it.
+
+  @param[in,out]  Arena  A pointer to the arena.
+**/
+STATIC
+VOID
+XmlArenaFree (
+  IN OUT  XML_ARENA  *Arena
+  )
+{
+  XML_ARENA_BLOCK  *Block;
+
+  ASSERT (Arena != NULL);
+
+  while (Arena->Blocks != NULL) {
+    Block         = Arena->Blocks;
+    Arena->Blocks = Block->Next;
+    FreePool (Block);
+  }
+}
+
+/**
+  Estimate arena size needed for parsing the document from the number of
+  tags in it. This is much cheaper than growing the arena during parsing.
+
+  @param[in]  Buffer  XML buffer.
+  @param[in]  Length  XML buffer length.
+
+  @return  Estimated arena size.
+**/
+STATIC
+UINT32
+XmlArenaEstimateSize (
+  IN  CONST CHAR8  *Buffer,
+  IN  UINT32       Length
+  )
+{
+  UINT32  Index;
+  UINT32  TagCount;
+
+  TagCount = 0;
+  for (Index = 0; Index < Length; ++Index) {
+    if (Buffer[Index] == '<') {
+      ++TagCount;
+    }
+  }
+
+  //
+  // Most nodes have open and close tags, and nodes with children also
+  // need a list header. XML_PARSER_MAX_SIZE guarantees this does not overflow.
+  //
+  return (TagCount / 2 + 1) * (sizeof (XML_NODE) + sizeof (XML_NODE *) + sizeof (XML_NODE_LIST));
+}
+
+/**
+  Parse the children of a lazy node.
+
+  @param[in,out]  Node  A pointer to the XML node.
+**/
+STATIC
+VOID
+XmlNodeLoadLazy (
+  IN OUT  XML_NODE  *Node
+  );
+
 /**
   Create a new XML node.
 
-  @param[in]  Name        Name of the new node.
-  @param[in]  Attributes  Attributes of the new node. Optional.
-  @param[in]  Content     Content of the new node. Optional.
-  @param[in]  Real        Pointer to the acual content when a reference exists. Optional.
-  @param[in]  Children    Pointer to the children of the node. Optional.
+  @param[in,out]  Document    Document to allocate the node from.
+  @param[in]      Name        Name of the new node.
+  @param[in]      Attributes  Attributes of the new node. Optional.
+  @param[in]      Content     Content of the new node. Optional.
+  @param[in]      Real        Pointer to the acual content when a reference exists. Optional.
+  @param[in]      Children    Pointer to the children of the node. Optional.
 
   @return  The created XML node.
 **/
 STATIC
 XML_NODE *
 XmlNodeCreate (
-  IN  CONST CHAR8    *Name,
-  IN  CONST CHAR8    *Attributes  OPTIONAL,
-  IN  CONST CHAR8    *Content     OPTIONAL,
-  IN  XML_NODE       *Real        OPTIONAL,
-  IN  XML_NODE_LIST  *Children    OPTIONAL
+  IN OUT  XML_DOCUMENT   *Document,
+  IN      CONST CHAR8    *Name,
+  IN      CONST CHAR8    *Attributes  OPTIONAL,
+  IN      CONST CHAR8    *Content     OPTIONAL,
+  IN      XML_NODE       *Real        OPTIONAL,
+  IN      XML_NODE_LIST  *Children    OPTIONAL
   )
 {
   XML_NODE  *Node;
 
-  ASSERT (Name != NULL);
+  ASSERT (Document != NULL);
+  ASSERT (Name     != NULL);
 
-  Node = AllocatePool (sizeof (XML_NODE));
+  Node = XmlArenaAllocate (&Document->Arena, sizeof (XML_NODE));
 
   if (Node != NULL) {
     Node->Name       = Name;
@@ -219,6 +427,9 @@ XmlNodeCreate (
     Node->Content    = Content;
     Node->Real       = Real;
     Node->Children   = Children;
+    Node->Document   = Document;
+    Node->LazyLength = 0;
+    Node->LazyState  = XML_NODE_LAZY_NONE;
   }
 
   return Node;
@@ -246,6 +457,8 @@ XmlNodeChildPush (
   ASSERT (Node  != NULL);
   ASSERT (Child != NULL);
 
+  XmlNodeLoadLazy (Node);
+
   NodeCount  = 0;
   AllocCount = 1;
 
@@ -271,14 +484,16 @@ XmlNodeChildPush (
   }
 
   //
-  // Allocate three times more room.
-  // This balances performance and memory usage on large files like prelinked plist.
+  // Allocate three times more room. Parsed lists are exactly sized,
+  // so this only happens on modification. The old list remains in the
+  // arena until the document is freed.
   //
   AllocCount *= 3;
 
-  NewList = (XML_NODE_LIST *)AllocatePool (
-                               sizeof (XML_NODE_LIST) + sizeof (NewList->NodeList[0]) * AllocCount
-                               );
+  NewList = XmlArenaAllocate (
+              &Node->Document->Arena,
+              sizeof (XML_NODE_LIST) + sizeof (NewList->NodeList[0]) * AllocCount
+              );
 
   if (NewList == NULL) {
     return FALSE;
@@ -293,8 +508,6 @@ XmlNodeChildPush (
       &Node->Children->NodeList[0],
       sizeof (NewList->NodeList[0]) * NodeCount
       );
-
-    FreePool (Node->Children);
   }
 
   NewList->NodeList[NodeCount] = Child;
@@ -303,6 +516,100 @@ XmlNodeChildPush (
   return TRUE;
 }
 
+/**
+  Save a parsed child node until its parent is closed.
+
+  @param[in,out]  Parser  A pointer to the XML parser.
+  @param[in]      Child   Pointer to the child XML node.
+
+  @retval  TRUE on success.
+**/
+STATIC
+BOOLEAN
+XmlParserStackPush (
+  IN OUT  XML_PARSER  *Parser,
+  IN      XML_NODE    *Child
+  )
+{
+  XML_NODE  **NewStack;
+  UINT32    NewAllocCount;
+
+  ASSERT (Parser != NULL);
+  ASSERT (Child  != NULL);
+
+  if (Parser->StackCount == Parser->StackAllocCount) {
+    if (BaseOverflowAddMulU32 (Parser->StackAllocCount, 64, 2, &NewAllocCount)) {
+      return FALSE;
+    }
+
+    NewStack = AllocatePool (NewAllocCount * sizeof (Parser->Stack[0]));
+    if (NewStack == NULL) {
+      return FALSE;
+    }
+
+    if (Parser->Stack != NULL) {
+      CopyMem (NewStack, Parser->Stack, Parser->StackCount * sizeof (Parser->Stack[0]));
+      FreePool (Parser->Stack);
+    }
+
+    Parser->Stack           = NewStack;
+    Parser->StackAllocCount = NewAllocCount;
+  }
+
+  Parser->Stack[Parser->StackCount] = Child;
+  ++Parser->StackCount;
+
+  return TRUE;
+}
+
+/**
+  Move parsed child nodes from the parser stack to their parent.
+
+  @param[in,out]  Parser     A pointer to the XML parser.
+  @param[in,out]  Node       Parent XML node.
+  @param[in]      StackBase  Parser stack position before the first child.
+
+  @retval  TRUE on success.
+**/
+STATIC
+BOOLEAN
+XmlParserStackPop (
+  IN OUT  XML_PARSER  *Parser,
+  IN OUT  XML_NODE    *Node,
+  IN      UINT32      StackBase
+  )
+{
+  XML_NODE_LIST  *List;
+  UINT32         NodeCount;
+
+  ASSERT (Parser != NULL);
+  ASSERT (Node   != NULL);
+  ASSERT (Node->Children == NULL);
+  ASSERT (StackBase <= Parser->StackCount);
+
+  NodeCount = Parser->StackCount - StackBase;
+  if (NodeCount == 0) {
+    return TRUE;
+  }
+
+  List = XmlArenaAllocate (
+           &Parser->Document->Arena,
+           sizeof (XML_NODE_LIST) + sizeof (List->NodeList[0]) * NodeCount
+           );
+  if (List == NULL) {
+    return FALSE;
+  }
+
+  List->NodeCount  = NodeCount;
+  List->AllocCount = NodeCount;
+  CopyMem (&List->NodeList[0], &Parser->Stack[StackBase], sizeof (List->NodeList[0]) * NodeCount);
+
+  Node->Children     = List;
+  Parser->StackCount = StackBase;
+
+  return TRUE;
+}
+
 /**
   Store XML reference.
 
@@ -376,8 +683,9 @@ XmlNodeReal (
   IN  CONST CHAR8        *Attributes  OPTIONAL
   )
 {
-  BOOLEAN  HasArgument;
-  UINT32   Number;
+  BOOLEAN   HasArgument;
+  UINT32    Number;
+  XML_NODE  *Real;
 
   if ((References == NULL) || (Attributes == NULL)) {
     return NULL;
@@ -394,33 +702,23 @@ XmlNodeReal (
     return NULL;
   }
 
-  return References->RefList[Number];
-}
-
-/**
-  Free the resources allocated by the node.
-
-  @param[in,out]  Node  A pointer to the XML node to be freed.
-**/
-STATIC
-VOID
-XmlNodeFree (
-  IN OUT  XML_NODE  *Node
-  )
-{
-  UINT32  Index;
-
-  ASSERT (Node != NULL);
-
-  if (Node->Children != NULL) {
-    for (Index = 0; Index < Node->Children->NodeCount; ++Index) {
-      XmlNodeFree (Node->Children->NodeList[Index]);
-    }
+  //
+  // Lazy nodes hold the place of references defined inside them.
+  //
+  Real = References->RefList[Number];
+  if ((Real != NULL) && (Real->LazyState == XML_NODE_LAZY_PENDING)) {
+    XmlNodeLoadLazy (Real);
+    Real = References->RefList[Number];
+  }
 
-    FreePool (Node->Children);
+  //
+  // References never have children, placeholders always do.
+  //
+  if ((Real != NULL) && ((Real->Children != NULL) || (Real->LazyState != XML_NODE_LAZY_NONE))) {
+    return NULL;
   }
 
-  FreePool (Node);
+  return Real;
 }
 
 /**
@@ -1084,6 +1382,8 @@ XmlNodeExportRecursive (
   ASSERT (CurrentSize != NULL);
 
   if (Skip != 0) {
+    XmlNodeLoadLazy ((XML_NODE *)Node);
+
     if (Node->Children != NULL) {
       for (Index = 0; Index < Node->Children->NodeCount; ++Index) {
         XmlNodeExportRecursive (Node->Children->NodeList[Index], Buffer, AllocSize, CurrentSize, Skip - 1);
@@ -1106,11 +1406,18 @@ XmlNodeExportRecursive (
   if ((Node->Children != NULL) || (Node->Content != NULL)) {
     XmlBufferAppend (Buffer, AllocSize, CurrentSize, ">", L_STR_LEN (">"));
 
+    //
+    // Lazy nodes never accessed or failed to parse keep their original text.
+    //
+    if (Node->LazyState != XML_NODE_LAZY_NONE) {
+      XmlBufferAppend (Buffer, AllocSize, CurrentSize, Node->Content, Node->LazyLength);
+    }
+
     if (Node->Children != NULL) {
       for (Index = 0; Index < Node->Children->NodeCount; ++Index) {
         XmlNodeExportRecursive (Node->Children->NodeList[Index], Buffer, AllocSize, CurrentSize, 0);
       }
-    } else {
+    } else if (Node->LazyState == XML_NODE_LAZY_NONE) {
       XmlBufferAppend (Buffer, AllocSize, CurrentSize, Node->Content, (UINT32)AsciiStrLen (Node->Content));
     }
 
@@ -1122,6 +1429,138 @@ XmlNodeExportRecursive (
   }
 }
 
+/**
+  Parse the attribute number like XmlParseAttributeNumber
+  in attributes, which are not null terminated.
+
+  @param[in]   Attributes        XML attributes.
+  @param[in]   AttributesLength  Length of XML attributes.
+  @param[in]   Argument          Name of the XML argument.
+  @param[in]   ArgumentLength    Length of the XML argument.
+  @param[out]  ArgumentValue     The parsed XML argument value.
+
+  @retval  TRUE on successful parsing.
+**/
+STATIC
+BOOLEAN
+XmlPullAttributeNumber (
+  IN  CONST CHAR8  *Attributes,
+  IN  UINT32       AttributesLength,
+  IN  CONST CHAR8  *Argument,
+  IN  UINT32       ArgumentLength,
+  OUT UINT32       *ArgumentValue
+  )
+{
+  UINT32   Index;
+  UINT32   Start;
+  UINT64   Number;
+  BOOLEAN  IsNumber;
+
+  ASSERT (Attributes    != NULL);
+  ASSERT (Argument      != NULL);
+  ASSERT (ArgumentValue != NULL);
+
+  for (Index = 0; Index + ArgumentLength <= AttributesLength; ++Index) {
+    if (CompareMem (&Attributes[Index], Argument, ArgumentLength) == 0) {
+      break;
+    }
+  }
+
+  if (Index + ArgumentLength > AttributesLength) {
+    return FALSE;
+  }
+
+  //
+  // Leading digits are the number, like in AsciiStrDecimalToUint64.
+  //
+  Start    = Index + ArgumentLength;
+  Number   = 0;
+  IsNumber = TRUE;
+  for (Index = Start; Index < AttributesLength && Attributes[Index] != '"'; ++Index) {
+    if (Index - Start >= 15) {
+      return FALSE;
+    }
+
+    if (IsNumber && (Attributes[Index] >= '0') && (Attributes[Index] <= '9')) {
+      Number = Number * 10 + (UINT32)(Attributes[Index] - '0');
+    } else {
+      IsNumber = FALSE;
+    }
+  }
+
+  if (Index == AttributesLength) {
+    return FALSE;
+  }
+
+  *ArgumentValue = (UINT32)Number;
+  return TRUE;
+}
+
+/**
+  Skim through the children of a lazy node, registering the references
+  defined inside. The parser is left at the closing tag of the node.
+
+  @param[in,out]  Parser      A pointer to the XML parser.
+  @param[in,out]  Node        A pointer to the XML node.
+  @param[in,out]  References  A pointer to the XML references. Optional.
+
+  @retval  TRUE on success.
+**/
+STATIC
+BOOLEAN
+XmlParseLazyChildren (
+  IN OUT  XML_PARSER   *Parser,
+  IN OUT  XML_NODE     *Node,
+  IN OUT  XML_REFLIST  *References  OPTIONAL
+  )
+{
+  XML_PULL_PARSER  Pull;
+  XML_PULL_TOKEN   Token;
+  XML_PULL_EVENT   Event;
+  UINT32           Level;
+  UINT32           ReferenceNumber;
+
+  ASSERT (Parser != NULL);
+  ASSERT (Node   != NULL);
+
+  XML_PARSER_INFO (Parser, "lazy children");
+
+  XmlPullInit (&Pull, &Parser->Buffer[Parser->Position], Parser->Length - Parser->Position);
+
+  while (TRUE) {
+    Level = Pull.Level;
+    Event = XmlPullNext (&Pull, &Token);
+
+    if ((Event == XML_PULL_EVENT_END) || (Event == XML_PULL_EVENT_ERROR)) {
+      return FALSE;
+    }
+
+    if ((Event == XML_PULL_EVENT_CLOSE) && (Level == 0)) {
+      break;
+    }
+
+    if (Event == XML_PULL_EVENT_OPEN) {
+      if (Parser->Level + Pull.Level > XML_PARSER_NEST_LEVEL) {
+        return FALSE;
+      }
+
+      if (  (References != NULL)
+         && XmlPullAttributeNumber (Token.Value, Token.ValueLength, "ID=\"", L_STR_LEN ("ID=\""), &ReferenceNumber)
+         && !XmlPushReference (References, Node, ReferenceNumber))
+      {
+        return FALSE;
+      }
+    }
+  }
+
+  Node->Content    = &Parser->Buffer[Parser->Position];
+  Node->LazyLength = Token.Offset;
+  Node->LazyState  = XML_NODE_LAZY_PENDING;
+
+  XmlParserConsume (Parser, Token.Offset);
+  return TRUE;
+}
+
 /**
   Parse an XML fragment node.
 
@@ -1155,6 +1594,7 @@ XmlParseNode (
   XML_NODE     *Node;
   XML_NODE     *Child;
   UINT32       ReferenceNumber;
+  UINT32       StackBase;
   BOOLEAN      IsReference;
   BOOLEAN      SelfClosing;
   BOOLEAN      Unprefixed;
@@ -1184,7 +1624,7 @@ XmlParseNode (
 
   XmlSkipWhitespace (Parser);
 
-  Node = XmlNodeCreate (TagOpen, Attributes, NULL, XmlNodeReal (References, Attributes), NULL);
+  Node = XmlNodeCreate (Parser->Document, TagOpen, Attributes, NULL, XmlNodeReal (References, Attributes), NULL);
   if (Node == NULL) {
     XML_PARSER_ERROR (Parser, NO_CHARACTER, "XmlParseNode::node alloc fail");
     return NULL;
@@ -1205,7 +1645,6 @@ XmlParseNode (
 
     if (Node->Content == NULL) {
       XML_PARSER_ERROR (Parser, 0, "XmlParseNode::content");
-      XmlNodeFree (Node);
       return NULL;
     }
 
@@ -1223,6 +1662,18 @@ XmlParseNode (
 
     Unprefixed = TRUE;
 
+    //
+    // Children of lazy nodes are only skimmed through.
+    //
+  } else if (  (Parser->Document->LazyLevel != 0)
+            && (Parser->Level == Parser->Document->LazyLevel)
+            && ('/' != XmlParserPeek (Parser, NEXT_CHARACTER)))
+  {
+    if (!XmlParseLazyChildren (Parser, Node, References)) {
+      XML_PARSER_ERROR (Parser, NO_CHARACTER, "XmlParseNode::lazy children");
+      return NULL;
+    }
+
     //
     // Otherwise children are to be expected.
     //
@@ -1231,11 +1682,11 @@ XmlParseNode (
 
     if (Parser->Level > XML_PARSER_NEST_LEVEL) {
       XML_PARSER_ERROR (Parser, NO_CHARACTER, "XmlParseNode::level overflow");
-      XmlNodeFree (Node);
       return NULL;
     }
 
     HasChildren = FALSE;
+    StackBase   = Parser->StackCount;
 
     while ('/' != XmlParserPeek (Parser, NEXT_CHARACTER)) {
       //
@@ -1250,20 +1701,24 @@ XmlParseNode (
         }
 
         XML_PARSER_ERROR (Parser, NEXT_CHARACTER, "XmlParseNode::child");
-        XmlNodeFree (Node);
         return NULL;
       }
 
-      if (!XmlNodeChildPush (Node, Child)) {
+      if (  (Parser->StackCount - StackBase >= XML_PARSER_NODE_COUNT)
+         || !XmlParserStackPush (Parser, Child))
+      {
         XML_PARSER_ERROR (Parser, NO_CHARACTER, "XmlParseNode::node push fail");
-        XmlNodeFree (Node);
-        XmlNodeFree (Child);
         return NULL;
       }
 
       HasChildren = TRUE;
     }
 
+    if (!XmlParserStackPop (Parser, Node, StackBase)) {
+      XML_PARSER_ERROR (Parser, NO_CHARACTER, "XmlParseNode::node list alloc fail");
+      return NULL;
+    }
+
     --Parser->Level;
 
     if (!HasChildren && (References != NULL) && (Attributes != NULL)) {
@@ -1282,7 +1737,6 @@ XmlParseNode (
   TagClose = XmlParseTagClose (Parser, Unprefixed);
   if (TagClose == NULL) {
     XML_PARSER_ERROR (Parser, NO_CHARACTER, "XmlParseNode::tag close");
-    XmlNodeFree (Node);
     return NULL;
   }
 
@@ -1291,29 +1745,125 @@ XmlParseNode (
   //
   if (AsciiStrCmp (TagOpen, TagClose) != 0) {
     XML_PARSER_ERROR (Parser, NO_CHARACTER, "XmlParseNode::tag missmatch");
-    XmlNodeFree (Node);
     return NULL;
   }
 
   if (IsReference && !XmlPushReference (References, Node, ReferenceNumber)) {
     XML_PARSER_ERROR (Parser, 0, "XmlParseNode::reference");
-    XmlNodeFree (Node);
     return NULL;
   }
 
   return Node;
 }
 
+STATIC
+VOID
+XmlNodeLoadLazy (
+  IN OUT  XML_NODE  *Node
+  )
+{
+  XML_DOCUMENT  *Document;
+  XML_PARSER    Parser;
+  XML_NODE      *Child;
+  CHAR8         *Buffer;
+  BOOLEAN       Success;
+
+  ASSERT (Node != NULL);
+
+  if (Node->LazyState != XML_NODE_LAZY_PENDING) {
+    return;
+  }
+
+  Document = Node->Document;
+
+  //
+  // Parse a copy, as the parser modifies the buffer, and the original
+  // text is still needed for export if parsing fails.
+  //
+  Buffer = XmlArenaAllocate (&Document->Arena, Node->LazyLength + 1);
+  if (Buffer == NULL) {
+    Node->LazyState = XML_NODE_LAZY_FAILED;
+    return;
+  }
+
+  CopyMem (Buffer, Node->Content, Node->LazyLength);
+  Buffer[Node->LazyLength] = '\0';
+
+  ZeroMem (&Parser, sizeof (Parser));
+  Parser.Buffer   = Buffer;
+  Parser.Length   = Node->LazyLength;
+  Parser.Level    = Document->LazyLevel + 1;
+  Parser.Document = Document;
+
+  //
+  // Break reference cycles between lazy nodes.
+  //
+  Node->LazyState = XML_NODE_LAZY_LOADING;
+  Success         = TRUE;
+
+  while (TRUE) {
+    XmlSkipWhitespace (&Parser);
+    if (Parser.Position >= Parser.Length) {
+      break;
+    }
+
+    Child = XmlParseNode (&Parser, Document->WithRefs ? &Document->References : NULL);
+    if (Child == NULL) {
+      //
+      // Trailing comments.
+      //
+      Success = Parser.Position >= Parser.Length;
+      break;
+    }
+
+    if (  (Parser.StackCount >= XML_PARSER_NODE_COUNT)
+       || !XmlParserStackPush (&Parser, Child))
+    {
+      Success = FALSE;
+      break;
+    }
+  }
+
+  if (Success) {
+    Success = XmlParserStackPop (&Parser, Node, 0);
+  }
+
+  if (Parser.Stack != NULL) {
+    FreePool (Parser.Stack);
+  }
+
+  if (!Success) {
+    XML_PARSER_ERROR (&Parser, NO_CHARACTER, "XmlNodeLoadLazy::parsing children failed");
+    Node->LazyState = XML_NODE_LAZY_FAILED;
+    return;
+  }
+
+  Node->Content    = NULL;
+  Node->LazyLength = 0;
+  Node->LazyState  = XML_NODE_LAZY_NONE;
+}
+
+/**
+  Parse the XML fragment in buffer.
+
+  @param[in,out]  Buffer     Chunk to be parsed.
+  @param[in]      Length     Size of the buffer.
+  @param[in]      WithRef    TRUE to enable reference lookup support.
+  @param[in]      LazyLevel  Nest level of lazily parsed nodes, 0 to disable.
+
+  @return The parsed xml fragment or NULL.
+**/
+STATIC
 XML_DOCUMENT *
-XmlDocumentParse (
+XmlDocumentParseInternal (
   IN OUT  CHAR8    *Buffer,
   IN      UINT32   Length,
-  IN      BOOLEAN  WithRefs
+  IN      BOOLEAN  WithRefs,
+  IN      UINT32   LazyLevel
   )
 {
   XML_NODE      *Root;
   XML_DOCUMENT  *Document;
-  XML_REFLIST   References;
   XML_PARSER    Parser;
 
   ASSERT (Buffer != NULL);
@@ -1324,7 +1874,6 @@ XmlDocumentParse (
   ZeroMem (&Parser, sizeof (Parser));
   Parser.Buffer = Buffer;
   Parser.Length = Length;
-  ZeroMem (&References, sizeof (References));
 
   //
   // An empty buffer can never contain a valid document.
@@ -1334,33 +1883,76 @@ XmlDocumentParse (
     return NULL;
   }
 
+  //
+  // Document owns the arena all the nodes are allocated from.
+  //
+  Document = AllocateZeroPool (sizeof (XML_DOCUMENT));
+
+  if (Document == NULL) {
+    XML_PARSER_ERROR (&Parser, NO_CHARACTER, "XmlDocumentParse::document allocation failed");
+    return NULL;
+  }
+
+  Document->Buffer.Buffer = Buffer;
+  Document->Buffer.Length = Length;
+  Document->WithRefs      = WithRefs;
+  Document->LazyLevel     = LazyLevel;
+  Parser.Document         = Document;
+
+  //
+  // Arena will grow on demand if the estimate cannot be allocated.
+  // Most of the tags are never parsed in lazy mode.
+  //
+  if (LazyLevel == 0) {
+    XmlArenaReserve (&Document->Arena, XmlArenaEstimateSize (Buffer, Length));
+  }
+
   //
   // Parse the root node.
   //
-  Root = XmlParseNode (&Parser, WithRefs ? &References : NULL);
+  Root = XmlParseNode (&Parser, WithRefs ? &Document->References : NULL);
+
+  if (Parser.Stack != NULL) {
+    FreePool (Parser.Stack);
+  }
+
   if (Root == NULL) {
     XML_PARSER_ERROR (&Parser, NO_CHARACTER, "XmlDocumentParse::parsing document failed");
+    XmlArenaFree (&Document->Arena);
+    XmlFreeRefs (&Document->References);
+    FreePool (Document);
     return NULL;
   }
 
   //
   // Return parsed document.
   //
-  Document = AllocatePool (sizeof (XML_DOCUMENT));
+  Document->Root = Root;
 
-  if (Document == NULL) {
-    XML_PARSER_ERROR (&Parser, NO_CHARACTER, "XmlDocumentParse::document allocation failed");
-    XmlNodeFree (Root);
-    XmlFreeRefs (&References);
-    return NULL;
-  }
+  return Document;
+}
 
-  Document->Buffer.Buffer = Buffer;
-  Document->Buffer.Length = Length;
-  Document->Root          = Root;
-  CopyMem (&Document->References, &References, sizeof (References));
+XML_DOCUMENT *
+XmlDocumentParse (
+  IN OUT  CHAR8    *Buffer,
+  IN      UINT32   Length,
+  IN      BOOLEAN  WithRefs
+  )
+{
+  return XmlDocumentParseInternal (Buffer, Length, WithRefs, 0);
+}
 
-  return Document;
+XML_DOCUMENT *
+XmlDocumentParseLazy (
+  IN OUT  CHAR8    *Buffer,
+  IN      UINT32   Length,
+  IN      BOOLEAN  WithRefs,
+  IN      UINT32   LazyLevel
+  )
+{
+  ASSERT (LazyLevel != 0);
+
+  return XmlDocumentParseInternal (Buffer, Length, WithRefs, LazyLevel);
 }
 
 CHAR8 *
@@ -1438,7 +2030,7 @@ XmlDocumentFree (
 {
   ASSERT (Document != NULL);
 
-  XmlNodeFree (Document->Root);
+  XmlArenaFree (&Document->Arena);
   XmlFreeRefs (&Document->References);
   FreePool (Document);
 }
@@ -1470,6 +2062,10 @@ XmlNodeContent (
 {
   ASSERT (Node != NULL);
 
+  if (Node->LazyState != XML_NODE_LAZY_NONE) {
+    return NULL;
+  }
+
   return Node->Real != NULL ? Node->Real->Content : Node->Content;
 }
 
@@ -1496,6 +2092,8 @@ XmlNodeChildren (
 {
   ASSERT (Node != NULL);
 
+  XmlNodeLoadLazy ((XML_NODE *)Node);
+
   return Node->Children ? Node->Children->NodeCount : 0;
 }
 
@@ -1507,6 +2105,8 @@ XmlNodeChild (
 {
   ASSERT (Node != NULL);
 
+  XmlNodeLoadLazy ((XML_NODE *)Node);
+
   return Node->Children->NodeList[Child];
 }
 
@@ -1590,13 +2190,12 @@ XmlNodeAppend (
   ASSERT (Node != NULL);
   ASSERT (Name != NULL);
 
-  NewNode = XmlNodeCreate (Name, Attributes, Content, NULL, NULL);
+  NewNode = XmlNodeCreate (Node->Document, Name, Attributes, Content, NULL, NULL);
   if (NewNode == NULL) {
     return NULL;
   }
 
   if (!XmlNodeChildPush (Node, NewNode)) {
-    XmlNodeFree (NewNode);
     return NULL;
   }
 
@@ -1636,16 +2235,15 @@ XmlNodeRemoveByIndex (
   )
 {
   ASSERT (Node != NULL);
+
+  XmlNodeLoadLazy (Node);
+
   ASSERT (Node->Children != NULL);
   ASSERT (Index < Node->Children->NodeCount);
 
-  //
-  // Free the Index-th XML node.
-  //
-  XmlNodeFree (Node->Children->NodeList[Index]);
-
   //
   // Overwrite the Index-th node with remaining nodes.
+  // The node itself stays in the document arena.
   //
   CopyMem (
     &Node->Children->NodeList[Index],
@@ -1669,9 +2267,12 @@ XmlNodeRemove (
   UINT32  Index;
 
   ASSERT (Node != NULL);
-  ASSERT (Node->Children != NULL);
   ASSERT (ChildNode != NULL);
 
+  XmlNodeLoadLazy (Node);
+
+  ASSERT (Node->Children != NULL);
+
   for (Index = 0; CompareMem (Node->Children->NodeList[Index], ChildNode, sizeof (XML_NODE)) != 0; ++Index) {
     //
     // Locate ChildNode inside Node.
@@ -1732,6 +2333,210 @@ XmlUnescapeString (
   return (CONST CHAR8 *)Buffer;
 }
 
+VOID
+XmlPullInit (
+  OUT XML_PULL_PARSER  *Parser,
+  IN  CONST CHAR8      *Buffer,
+  IN  UINT32           Length
+  )
+{
+  ASSERT (Parser != NULL);
+  ASSERT (Buffer != NULL || Length == 0);
+
+  Parser->Buffer   = Buffer;
+  Parser->Length   = Length;
+  Parser->Position = 0;
+  Parser->Level    = 0;
+}
+
+XML_PULL_EVENT
+XmlPullNext (
+  IN OUT XML_PULL_PARSER  *Parser,
+  OUT    XML_PULL_TOKEN   *Token
+  )
+{
+  CONST CHAR8  *Buffer;
+  UINT32       Length;
+  UINT32       Position;
+  UINT32       Start;
+  UINT32       End;
+
+  ASSERT (Parser != NULL);
+  ASSERT (Token  != NULL);
+
+  Buffer   = Parser->Buffer;
+  Length   = Parser->Length;
+  Position = Parser->Position;
+
+  ZeroMem (Token, sizeof (*Token));
+
+  while (TRUE) {
+    while (Position < Length && IsAsciiSpace (Buffer[Position])) {
+      ++Position;
+    }
+
+    Token->Offset = Position;
+
+    if (Position >= Length) {
+      Parser->Position = Position;
+      Token->Event     = XML_PULL_EVENT_END;
+      return Token->Event;
+    }
+
+    //
+    // Text up to the next tag with trailing whitespace ignored like in XmlParseContent.
+    //
+    if (Buffer[Position] != '<') {
+      Start = Position;
+      while (Position < Length && Buffer[Position] != '<') {
+        ++Position;
+      }
+
+      if (Position >= Length) {
+        break;
+      }
+
+      End = Position;
+      while (End > Start && IsAsciiSpace (Buffer[End - 1])) {
+        --End;
+      }
+
+      Parser->Position   = Position;
+      Token->Event       = XML_PULL_EVENT_CONTENT;
+      Token->Value       = &Buffer[Start];
+      Token->ValueLength = End - Start;
+      return Token->Event;
+    }
+
+    ++Position;
+    if (Position >= Length) {
+      break;
+    }
+
+    //
+    // Skip control sequences and comments like in XmlParseTagOpen.
+    //
+    if ((Buffer[Position] == '?') || (Buffer[Position] == '!')) {
+      if (  (Length - Position > 2)
+         && (Buffer[Position] == '!')
+         && (Buffer[Position + 1] == '-')
+         && (Buffer[Position + 2] == '-'))
+      {
+        Position += 3;
+        while (  (Length - Position > 2)
+              && ((Buffer[Position] != '-') || (Buffer[Position + 1] != '-') || (Buffer[Position + 2] != '>')))
+        {
+          ++Position;
+        }
+
+        if (Length - Position <= 2) {
+          break;
+        }
+
+        Position += 3;
+      } else {
+        while (Position < Length && Buffer[Position] != '>') {
+          ++Position;
+        }
+
+        if (Position >= Length) {
+          break;
+        }
+
+        ++Position;
+      }
+
+      continue;
+    }
+
+    //
+    // Closing tag, anything after the name is ignored like in XmlParseTagEnd.
+    //
+    if (Buffer[Position] == '/') {
+      ++Position;
+      Start = Position;
+      while (  Position < Length && !IsAsciiSpace (Buffer[Position])
+            && Buffer[Position] != '/' && Buffer[Position] != '>')
+      {
+        ++Position;
+      }
+
+      End = Position;
+      while (Position < Length && Buffer[Position] != '/' && Buffer[Position] != '>') {
+        ++Position;
+      }
+
+      if ((Position >= Length) || (Buffer[Position] != '>') || (End == Start)) {
+        break;
+      }
+
+      if (Parser->Level > 0) {
+        --Parser->Level;
+      }
+
+      Parser->Position  = Position + 1;
+      Token->Event      = XML_PULL_EVENT_CLOSE;
+      Token->Name       = &Buffer[Start];
+      Token->NameLength = End - Start;
+      return Token->Event;
+    }
+
+    //
+    // Opening tag with optional attributes.
+    //
+    Start = Position;
+    while (  Position < Length && !IsAsciiSpace (Buffer[Position])
+          && Buffer[Position] != '/' && Buffer[Position] != '>')
+    {
+      ++Position;
+    }
+
+    if (Position == Start) {
+      break;
+    }
+
+    Token->Name       = &Buffer[Start];
+    Token->NameLength = Position - Start;
+
+    while (Position < Length && IsAsciiSpace (Buffer[Position])) {
+      ++Position;
+    }
+
+    Start = Position;
+    while (Position < Length && Buffer[Position] != '/' && Buffer[Position] != '>') {
+      ++Position;
+    }
+
+    if (Position >= Length) {
+      break;
+    }
+
+    if (Position > Start) {
+      Token->Value       = &Buffer[Start];
+      Token->ValueLength = Position - Start;
+    }
+
+    if (Buffer[Position] == '/') {
+      ++Position;
+      if ((Position >= Length) || (Buffer[Position] != '>')) {
+        break;
+      }
+
+      Token->SelfClosing = TRUE;
+    } else {
+      ++Parser->Level;
+    }
+
+    Parser->Position = Position + 1;
+    Token->Event     = XML_PULL_EVENT_OPEN;
+    return Token->Event;
+  }
+
+  Parser->Position = Position;
+  Token->Event     = XML_PULL_EVENT_ERROR;
+  return Token->Event;
+}
+
 XML_NODE *
 PlistDocumentRoot (
   IN  CONST XML_DOCUMENT  *Document
@@ -1773,7 +2578,18 @@ PlistNodeCast (
     return NULL;
   }
 
-  ChildrenNum = XmlNodeChildren (Node);
+  //
+  // Do not parse lazy nodes just for the checks. A lazy node always has
+  // children, and PlistDictChildren ignores unpaired keys.
+  //
+  if (Node->LazyState != XML_NODE_LAZY_NONE) {
+    ChildrenNum = 1;
+    if ((Type == PLIST_NODE_TYPE_DICT) || (Type == PLIST_NODE_TYPE_ARRAY)) {
+      return Node;
+    }
+  } else {
+    ChildrenNum = XmlNodeChildren (Node);
+  }
 
   switch (Type) {
     case PLIST_NODE_TYPE_DICT:
@@ -1837,6 +2653,109 @@ PlistDictChild (
   return XmlNodeChild (Node, Child);
 }
 
+BOOLEAN
+PlistDictPeekString (
+  IN   CONST XML_NODE  *Node,
+  IN   CONST CHAR8     *Key,
+  OUT  CONST CHAR8     **Value,
+  OUT  UINT32          *ValueLength
+  )
+{
+  XML_PULL_PARSER  Parser;
+  XML_PULL_TOKEN   Token;
+  XML_PULL_EVENT   Event;
+  UINT32           KeyLength;
+  UINT32           Index;
+  UINT32           Count;
+  BOOLEAN          KeyFound;
+  CONST CHAR8      *KeyName;
+  XML_NODE         *ValueNode;
+
+  ASSERT (Node        != NULL);
+  ASSERT (Key         != NULL);
+  ASSERT (Value       != NULL);
+  ASSERT (ValueLength != NULL);
+
+  if (Node->LazyState == XML_NODE_LAZY_PENDING) {
+    XmlPullInit (&Parser, Node->Content, Node->LazyLength);
+    KeyLength = (UINT32)AsciiStrLen (Key);
+    KeyFound  = FALSE;
+    Index     = 0;
+
+    while (TRUE) {
+      Event = XmlPullNext (&Parser, &Token);
+      if ((Event == XML_PULL_EVENT_END) || (Event == XML_PULL_EVENT_ERROR)) {
+        return FALSE;
+      }
+
+      //
+      // Only dictionary entries are of interest.
+      //
+      if (  (Event != XML_PULL_EVENT_OPEN)
+         || (Parser.Level != (Token.SelfClosing ? 0U : 1U)))
+      {
+        continue;
+      }
+
+      if (KeyFound) {
+        if ((Token.NameLength != L_STR_LEN ("string")) || (CompareMem (Token.Name, "string", L_STR_LEN ("string")) != 0)) {
+          return FALSE;
+        }
+
+        //
+        // Values may reference other nodes.
+        //
+        if (Token.SelfClosing) {
+          break;
+        }
+
+        if (XmlPullNext (&Parser, &Token) != XML_PULL_EVENT_CONTENT) {
+          return FALSE;
+        }
+
+        *Value       = Token.Value;
+        *ValueLength = Token.ValueLength;
+        return TRUE;
+      }
+
+      if (  (Index % 2 == 0)
+         && !Token.SelfClosing
+         && (Token.NameLength == L_STR_LEN ("key"))
+         && (CompareMem (Token.Name, "key", L_STR_LEN ("key")) == 0)
+         && (XmlPullNext (&Parser, &Token) == XML_PULL_EVENT_CONTENT)
+         && (Token.ValueLength == KeyLength)
+         && (CompareMem (Token.Value, Key, KeyLength) == 0))
+      {
+        KeyFound = TRUE;
+      }
+
+      ++Index;
+    }
+  }
+
+  Count = PlistDictChildren (Node);
+  for (Index = 0; Index < Count; ++Index) {
+    KeyName = PlistKeyValue (PlistDictChild (Node, Index, &ValueNode));
+    if ((KeyName == NULL) || (AsciiStrCmp (KeyName, Key) != 0)) {
+      continue;
+    }
+
+    if (PlistNodeCast (ValueNode, PLIST_NODE_TYPE_STRING) == NULL) {
+      return FALSE;
+    }
+
+    *Value = XmlNodeContent (ValueNode);
+    if (*Value == NULL) {
+      return FALSE;
+    }
+
+    *ValueLength = (UINT32)AsciiStrLen (*Value);
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
 CONST CHAR8 *
 PlistKeyValue (
   IN  XML_NODE  *Node  OPTIONAL
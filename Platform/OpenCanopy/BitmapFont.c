@@ -7,6 +7,7 @@
 
 #include <Base.h>
 
+#include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/BaseOverflowLib.h>
 #include <Library/DebugLib.h>
@@ -32,6 +33,24 @@ BmfGetChar (
 
   Chars = Context->Chars;
 
+  if ((Context->CharMap != NULL) && (Char <= MAX_UINT16)) {
+    //
+    // The map covers every character id within the BMP present in the font.
+    //
+    if ((Char < Context->CharMapSize) && (Context->CharMap[Char] != 0)) {
+      return &Chars[Context->CharMap[Char] - 1];
+    }
+
+    //
+    // Fallback to underscore on not found symbols.
+    //
+    if (('_' < Context->CharMapSize) && (Context->CharMap['_'] != 0)) {
+      return &Chars[Context->CharMap['_'] - 1];
+    }
+
+    return NULL;
+  }
+
   for (Index = 0; Index < 2; ++Index) {
     //
     // Binary Search for the character as the list is sorted.
@@ -67,6 +86,16 @@ BmfGetChar (
   return NULL;
 }
 
+STATIC
+UINT32
+BmfKerningHash (
+  IN UINT32  Char1,
+  IN UINT32  Char2
+  )
+{
+  return (((Char1 << 16U) | (Char2 & 0xFFFFU)) * 0x9E3779B1U) >> 16U;
+}
+
 CONST BMF_KERNING_PAIR *
 BmfGetKerningPair (
   IN CONST BMF_CONTEXT  *Context,
@@ -90,6 +119,22 @@ BmfGetKerningPair (
     return NULL;
   }
 
+  if (Context->KerningMap != NULL) {
+    for (
+         Index = BmfKerningHash (Char1, Char2) & Context->KerningMapMask;
+         Context->KerningMap[Index] != 0;
+         Index = (Index + 1) & Context->KerningMapMask
+         )
+    {
+      Median = Context->KerningMap[Index] - 1;
+      if ((Pairs[Median].first == Char1) && (Pairs[Median].second == Char2)) {
+        return &Pairs[Median];
+      }
+    }
+
+    return NULL;
+  }
+
   //
   // Binary Search for the first character as the list is sorted.
   //
@@ -143,6 +188,85 @@ BmfGetKerningPair (
   return NULL;
 }
 
+STATIC
+VOID
+BmfContextBuildIndex (
+  IN OUT BMF_CONTEXT  *Context
+  )
+{
+  CONST BMF_CHAR          *Chars;
+  CONST BMF_KERNING_PAIR  *Pairs;
+  UINT32                  MapSize;
+  UINT32                  Index;
+  UINT32                  Slot;
+
+  Chars   = Context->Chars;
+  MapSize = 0;
+
+  for (Index = 0; Index < Context->NumChars; ++Index) {
+    if (Chars[Index].id <= MAX_UINT16) {
+      MapSize = MAX (MapSize, Chars[Index].id + 1);
+    }
+  }
+
+  if (MapSize > 0) {
+    Context->CharMap = AllocateZeroPool (MapSize * sizeof (*Context->CharMap));
+    if (Context->CharMap == NULL) {
+      DEBUG ((DEBUG_INFO, "BMF: No memory for char map\n"));
+    } else {
+      Context->CharMapSize = MapSize;
+      //
+      // Keep the first of duplicate characters for consistency with the search.
+      //
+      for (Index = 0; Index < Context->NumChars; ++Index) {
+        if (  (Chars[Index].id < MapSize)
+           && (Context->CharMap[Chars[Index].id] == 0))
+        {
+          Context->CharMap[Chars[Index].id] = Index + 1;
+        }
+      }
+    }
+  }
+
+  Pairs = Context->KerningPairs;
+  if ((Pairs == NULL) || (Context->NumKerningPairs == 0)) {
+    return;
+  }
+
+  //
+  // Keep the load factor at or below one half. The pair count is bounded by
+  // the file size, so this cannot overflow.
+  //
+  MapSize = GetPowerOfTwo32 (Context->NumKerningPairs) * 2;
+  if (MapSize < 16) {
+    MapSize = 16;
+  }
+
+  Context->KerningMap = AllocateZeroPool (MapSize * sizeof (*Context->KerningMap));
+  if (Context->KerningMap == NULL) {
+    DEBUG ((DEBUG_INFO, "BMF: No memory for kerning map\n"));
+    return;
+  }
+
+  Context->KerningMapMask = MapSize - 1;
+
+  for (Index = 0; Index < Context->NumKerningPairs; ++Index) {
+    //
+    // Lookups are done for CHAR16 only, other pairs can never match.
+    //
+    if ((Pairs[Index].first > MAX_UINT16) || (Pairs[Index].second > MAX_UINT16)) {
+      continue;
+    }
+
+    Slot = BmfKerningHash (Pairs[Index].first, Pairs[Index].second) & Context->KerningMapMask;
+    while (Context->KerningMap[Slot] != 0) {
+      Slot = (Slot + 1) & Context->KerningMapMask;
+    }
+
+    Context->KerningMap[Slot] = Index + 1;
+  }
+}
+
 BOOLEAN
 BmfContextInitialize (
   OUT BMF_CONTEXT  *Context,
@@ -465,6 +589,8 @@ BmfContextInitialize (
     }
   }
 
+  BmfContextBuildIndex (Context);
+
   return TRUE;
 }
 
@@ -605,8 +731,9 @@ BlendMem (
   }
 }
 
+STATIC
 BOOLEAN
-GuiGetLabel (
+GuiRenderLabel (
   OUT GUI_IMAGE               *LabelImage,
   IN  CONST GUI_FONT_CONTEXT  *Context,
   IN  CONST CHAR16            *String,
@@ -714,6 +841,138 @@ GuiGetLabel (
   return TRUE;
 }
 
+STATIC
+VOID
+GuiFontFreeLabelCache (
+  IN OUT GUI_FONT_CONTEXT  *Context
+  )
+{
+  UINT32  Index;
+
+  for (Index = 0; Index < GUI_FONT_LABEL_CACHE_SIZE; ++Index) {
+    if (Context->LabelCache[Index].String != NULL) {
+      FreePool (Context->LabelCache[Index].String);
+      FreePool (Context->LabelCache[Index].Image.Buffer);
+    }
+  }
+
+  ZeroMem (Context->LabelCache, sizeof (Context->LabelCache));
+  Context->LabelCacheTick = 0;
+}
+
+STATIC
+VOID
+GuiFontStoreLabel (
+  IN OUT GUI_FONT_CONTEXT  *Context,
+  IN     CONST CHAR16      *String,
+  IN     UINTN             StringLen,
+  IN     BOOLEAN           Inverted,
+  IN     CONST GUI_IMAGE   *LabelImage
+  )
+{
+  GUI_FONT_LABEL_CACHE_ENTRY  *Entry;
+  CHAR16                      *CachedString;
+  VOID                        *CachedBuffer;
+  UINT32                      Index;
+
+  CachedString = AllocateCopyPool (StringLen * sizeof (*String), String);
+  CachedBuffer = AllocateCopyPool (
+                   LabelImage->Width * LabelImage->Height * sizeof (*LabelImage->Buffer),
+                   LabelImage->Buffer
+                   );
+  if ((CachedString == NULL) || (CachedBuffer == NULL)) {
+    if (CachedString != NULL) {
+      FreePool (CachedString);
+    }
+
+    if (CachedBuffer != NULL) {
+      FreePool (CachedBuffer);
+    }
+
+    return;
+  }
+
+  //
+  // Replace a free or otherwise the least recently used entry.
+  //
+  Entry = &Context->LabelCache[0];
+  for (Index = 0; Index < GUI_FONT_LABEL_CACHE_SIZE; ++Index) {
+    if (Context->LabelCache[Index].String == NULL) {
+      Entry = &Context->LabelCache[Index];
+      break;
+    }
+
+    if (Context->LabelCache[Index].LastUse < Entry->LastUse) {
+      Entry = &Context->LabelCache[Index];
+    }
+  }
+
+  if (Entry->String != NULL) {
+    FreePool (Entry->String);
+    FreePool (Entry->Image.Buffer);
+  }
+
+  Entry->String       = CachedString;
+  Entry->StringLen    = StringLen;
+  Entry->Inverted     = Inverted;
+  Entry->LastUse      = ++Context->LabelCacheTick;
+  Entry->Image.Width  = LabelImage->Width;
+  Entry->Image.Height = LabelImage->Height;
+  Entry->Image.Buffer = CachedBuffer;
+}
+
+BOOLEAN
+GuiGetLabel (
+  OUT    GUI_IMAGE         *LabelImage,
+  IN OUT GUI_FONT_CONTEXT  *Context,
+  IN     CONST CHAR16      *String,
+  IN     UINTN             StringLen,
+  IN     BOOLEAN           Inverted
+  )
+{
+  GUI_FONT_LABEL_CACHE_ENTRY  *Entry;
+  UINT32                      Index;
+  BOOLEAN                     Result;
+
+  ASSERT (LabelImage != NULL);
+  ASSERT (Context    != NULL);
+  ASSERT (String     != NULL);
+
+  //
+  // The font and its scale are fixed per context, so the rendered label only
+  // depends on the string and its colour. The caller owns the returned buffer.
+  //
+  for (Index = 0; Index < GUI_FONT_LABEL_CACHE_SIZE; ++Index) {
+    Entry = &Context->LabelCache[Index];
+    if (  (Entry->String != NULL)
+       && (Entry->StringLen == StringLen)
+       && (Entry->Inverted == Inverted)
+       && (CompareMem (Entry->String, String, StringLen * sizeof (*String)) == 0))
+    {
+      LabelImage->Buffer = AllocateCopyPool (
+                             Entry->Image.Width * Entry->Image.Height * sizeof (*Entry->Image.Buffer),
+                             Entry->Image.Buffer
+                             );
+      if (LabelImage->Buffer == NULL) {
+        DEBUG ((DEBUG_WARN, "BMF: out of res\n"));
+        return FALSE;
+      }
+
+      LabelImage->Width  = Entry->Image.Width;
+      LabelImage->Height = Entry->Image.Height;
+      Entry->LastUse     = ++Context->LabelCacheTick;
+      return TRUE;
+    }
+  }
+
+  Result = GuiRenderLabel (LabelImage, Context, String, StringLen, Inverted);
+  if (Result) {
+    GuiFontStoreLabel (Context, String, StringLen, Inverted, LabelImage);
+  }
+
+  return Result;
+}
+
 BOOLEAN
 GuiFontConstruct (
   OUT GUI_FONT_CONTEXT  *Context,
@@ -776,4 +1035,16 @@ GuiFontDestruct (
     FreePool (Context->KerningData);
     Context->KerningData = NULL;
   }
+
+  if (Context->BmfContext.CharMap != NULL) {
+    FreePool (Context->BmfContext.CharMap);
+    Context->BmfContext.CharMap = NULL;
+  }
+
+  if (Context->BmfContext.KerningMap != NULL) {
+    FreePool (Context->BmfContext.KerningMap);
+    Context->BmfContext.KerningMap = NULL;
+  }
+
+  GuiFontFreeLabelCache (Context);
 }
@@ -9,51 +9,85 @@
 
 #include <Protocol/GraphicsOutput.h>
 
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 
 #include "OpenCanopy.h"
 #include "Blending.h"
 
-#define PIXEL_TO_UINT32(Pixel)  \
-  ((UINT32) SIGNATURE_32 ((Pixel)->Blue, (Pixel)->Green, (Pixel)->Red, (Pixel)->Reserved))
+//
+// Blending works on pixels spread into the 16-bit lanes of a 64-bit integer
+// (Blue, Green, Red, Reserved from the lowest lane), so that a single
+// multiplication scales all channels of a pixel by the same factor without
+// carrying into the neighbouring lane (255 * 255 < 0x10000).
+//
+#define PIXEL_LANES_LOW_BYTES  0x00FF00FF00FF00FFULL
+#define PIXEL_LANES_ONE        0x0001000100010001ULL
 
-#define RGB_ALPHA_BLEND(Back, Front, InvFrontOpacity)  \
-  ((Front) + RGB_APPLY_OPACITY (InvFrontOpacity, Back))
+STATIC
+UINT64
+InternalPixelToLanes (
+  IN CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Pixel
+  )
+{
+  return (UINT64)Pixel->Blue
+         | LShiftU64 (Pixel->Green, 16)
+         | LShiftU64 (Pixel->Red, 32)
+         | LShiftU64 (Pixel->Reserved, 48);
+}
 
 STATIC
 VOID
-InternalBlendPixel (
-  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL        *BackPixel,
-  IN     CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *FrontPixel
+InternalLanesToPixel (
+  OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Pixel,
+  IN  UINT64                         Lanes
+  )
+{
+  //
+  // Channel overflow is truncated just like for UINT8 arithmetic.
+  //
+  Pixel->Blue     = (UINT8)Lanes;
+  Pixel->Green    = (UINT8)RShiftU64 (Lanes, 16);
+  Pixel->Red      = (UINT8)RShiftU64 (Lanes, 32);
+  Pixel->Reserved = (UINT8)RShiftU64 (Lanes, 48);
+}
+
+/**
+  RGB_APPLY_OPACITY for every lane. For the products V in [0, 255 * 255],
+  (V + 1 + (V >> 8)) >> 8 equals V / 255 exactly and fits the lane.
+**/
+STATIC
+UINT64
+InternalLanesApplyOpacity (
+  IN UINT64  Lanes,
+  IN UINT8   Opacity
+  )
+{
+  Lanes = MultU64x32 (Lanes, Opacity);
+  Lanes = Lanes + PIXEL_LANES_ONE + (RShiftU64 (Lanes, 8) & PIXEL_LANES_LOW_BYTES);
+  return RShiftU64 (Lanes, 8) & PIXEL_LANES_LOW_BYTES;
+}
+
+/**
+  Blend a premultiplied front pixel in lane format over BackPixel.
+  The resulting alpha of an opaque BackPixel stays 0xFF.
+**/
+STATIC
+VOID
+InternalBlendLanes (
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *BackPixel,
+  IN     UINT64                         FrontLanes
   )
 {
   UINT8  InvFrontOpacity;
 
-  InvFrontOpacity = (0xFF - FrontPixel->Reserved);
-
-  BackPixel->Blue = RGB_ALPHA_BLEND (
-                      BackPixel->Blue,
-                      FrontPixel->Blue,
-                      InvFrontOpacity
-                      );
-  BackPixel->Green = RGB_ALPHA_BLEND (
-                       BackPixel->Green,
-                       FrontPixel->Green,
-                       InvFrontOpacity
-                       );
-  BackPixel->Red = RGB_ALPHA_BLEND (
-                     BackPixel->Red,
-                     FrontPixel->Red,
-                     InvFrontOpacity
-                     );
-
-  if (BackPixel->Reserved != 0xFF) {
-    BackPixel->Reserved = RGB_ALPHA_BLEND (
-                            BackPixel->Reserved,
-                            FrontPixel->Reserved,
-                            InvFrontOpacity
-                            );
-  }
+  InvFrontOpacity = (UINT8)(0xFF - (UINT8)RShiftU64 (FrontLanes, 48));
+
+  InternalLanesToPixel (
+    BackPixel,
+    FrontLanes + InternalLanesApplyOpacity (InternalPixelToLanes (BackPixel), InvFrontOpacity)
+    );
 }
 
 VOID
@@ -63,35 +97,12 @@ GuiBlendPixelOpaque (
   IN     UINT8                                Opacity
   )
 {
-  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  OpacFrontPixel;
-
-  //
-  // FIXME: Optimise with SIMD or such.
-  // qt_blend_argb32_on_argb32 in QT
-  //
   ASSERT (BackPixel != NULL);
   ASSERT (FrontPixel != NULL);
   ASSERT (Opacity > 0);
   ASSERT (Opacity < 0xFF);
 
-  if (FrontPixel->Reserved == 0) {
-    return;
-  }
-
-  if (FrontPixel->Reserved == 0xFF) {
-    OpacFrontPixel.Reserved = Opacity;
-  } else {
-    OpacFrontPixel.Reserved = RGB_APPLY_OPACITY (FrontPixel->Reserved, Opacity);
-    if (OpacFrontPixel.Reserved == 0) {
-      return;
-    }
-  }
-
-  OpacFrontPixel.Blue  = RGB_APPLY_OPACITY (FrontPixel->Blue, Opacity);
-  OpacFrontPixel.Green = RGB_APPLY_OPACITY (FrontPixel->Green, Opacity);
-  OpacFrontPixel.Red   = RGB_APPLY_OPACITY (FrontPixel->Red, Opacity);
-
-  InternalBlendPixel (BackPixel, &OpacFrontPixel);
+  GuiBlendRowOpaque (BackPixel, FrontPixel, 1, Opacity);
 }
 
 VOID
@@ -100,10 +111,6 @@ GuiBlendPixelSolid (
   IN     CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *FrontPixel
   )
 {
-  //
-  // FIXME: Optimise with SIMD or such.
-  // qt_blend_argb32_on_argb32 in QT
-  //
   ASSERT (BackPixel != NULL);
   ASSERT (FrontPixel != NULL);
 
@@ -119,7 +126,7 @@ GuiBlendPixelSolid (
     return;
   }
 
-  InternalBlendPixel (BackPixel, FrontPixel);
+  InternalBlendLanes (BackPixel, InternalPixelToLanes (FrontPixel));
 }
 
 VOID
@@ -135,3 +142,88 @@ GuiBlendPixel (
     GuiBlendPixelOpaque (BackPixel, FrontPixel, Opacity);
   }
 }
+
+VOID
+GuiBlendRowSolid (
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL        *BackRow,
+  IN     CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *FrontRow,
+  IN     UINT32                               Length
+  )
+{
+  UINT32  Index;
+  UINT32  SpanStart;
+
+  ASSERT (BackRow != NULL);
+  ASSERT (FrontRow != NULL);
+
+  Index = 0;
+  while (Index < Length) {
+    //
+    // Fully transparent spans keep the background as-is.
+    //
+    while (Index < Length && FrontRow[Index].Reserved == 0) {
+      ++Index;
+    }
+
+    //
+    // Fully opaque spans replace the background.
+    //
+    SpanStart = Index;
+    while (Index < Length && FrontRow[Index].Reserved == 0xFF) {
+      ++Index;
+    }
+
+    if (Index > SpanStart) {
+      CopyMem (
+        &BackRow[SpanStart],
+        &FrontRow[SpanStart],
+        (Index - SpanStart) * sizeof (*BackRow)
+        );
+    }
+
+    //
+    // Translucent spans are blended.
+    //
+    while (  Index < Length
+          && FrontRow[Index].Reserved != 0
+          && FrontRow[Index].Reserved != 0xFF)
+    {
+      InternalBlendLanes (&BackRow[Index], InternalPixelToLanes (&FrontRow[Index]));
+      ++Index;
+    }
+  }
+}
+
+VOID
+GuiBlendRowOpaque (
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL        *BackRow,
+  IN     CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *FrontRow,
+  IN     UINT32                               Length,
+  IN     UINT8                                Opacity
+  )
+{
+  UINT32  Index;
+  UINT64  FrontLanes;
+
+  ASSERT (BackRow != NULL);
+  ASSERT (FrontRow != NULL);
+  ASSERT (Opacity > 0);
+  ASSERT (Opacity < 0xFF);
+
+  for (Index = 0; Index < Length; ++Index) {
+    if (FrontRow[Index].Reserved == 0) {
+      continue;
+    }
+
+    //
+    // The front pixel is premultiplied, so the global opacity applies to all
+    // channels including alpha.
+    //
+    FrontLanes = InternalLanesApplyOpacity (InternalPixelToLanes (&FrontRow[Index]), Opacity);
+    if (RShiftU64 (FrontLanes, 48) == 0) {
+      continue;
+    }
+
+    InternalBlendLanes (&BackRow[Index], FrontLanes);
+  }
+}
@@ -20,13 +20,37 @@ typedef struct {
   UINT32                           NumChars;
   UINT32                           NumKerningPairs;
   UINT16                           Height;
+  //
+  // Optional lookup indices, falling back to binary search when missing.
+  // CharMap stores Chars index + 1 for every character id below CharMapSize.
+  // KerningMap is an open addressing hash table of KerningPairs index + 1.
+  //
+  UINT32                           *CharMap;
+  UINT32                           CharMapSize;
+  UINT32                           *KerningMap;
+  UINT32                           KerningMapMask;
 } BMF_CONTEXT;
 
+//
+// Number of rendered labels kept for reuse.
+//
+#define GUI_FONT_LABEL_CACHE_SIZE  16U
+
+typedef struct {
+  CHAR16       *String;
+  UINTN        StringLen;
+  BOOLEAN      Inverted;
+  UINT32       LastUse;
+  GUI_IMAGE    Image;
+} GUI_FONT_LABEL_CACHE_ENTRY;
+
 typedef struct {
-  GUI_IMAGE      FontImage;
-  BMF_CONTEXT    BmfContext;
-  VOID           *KerningData;
-  UINT8          Scale;
+  GUI_IMAGE                     FontImage;
+  BMF_CONTEXT                   BmfContext;
+  VOID                          *KerningData;
+  UINT8                         Scale;
+  UINT32                        LabelCacheTick;
+  GUI_FONT_LABEL_CACHE_ENTRY    LabelCache[GUI_FONT_LABEL_CACHE_SIZE];
 } GUI_FONT_CONTEXT;
 
 BOOLEAN
@@ -46,11 +70,11 @@ GuiFontDestruct (
 
 BOOLEAN
 GuiGetLabel (
-  OUT GUI_IMAGE               *LabelImage,
-  IN  CONST GUI_FONT_CONTEXT  *Context,
-  IN  CONST CHAR16            *String,
-  IN  UINTN                   StringLen,
-  IN  BOOLEAN                 Inverted
+  OUT    GUI_IMAGE         *LabelImage,
+  IN OUT GUI_FONT_CONTEXT  *Context,
+  IN     CONST CHAR16      *String,
+  IN     UINTN             StringLen,
+  IN     BOOLEAN           Inverted
   );
 
 #endif // BMF_LIB_H
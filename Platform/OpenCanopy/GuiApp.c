@@ -108,7 +108,9 @@ InternalContextDestruct (
   }
 
   InternalSafeFreePool (Context->Background.Buffer);
-  InternalSafeFreePool (Context->FontContext.FontImage.Buffer);
+  GuiFontDestruct (&Context->FontContext);
+
+  GuiImageCacheDestruct ();
 
   /*
   InternalSafeFreePool (Context->Poof[0].Buffer);
@@ -119,18 +121,125 @@ InternalContextDestruct (
   */
 }
 
+STATIC
+EFI_STATUS
+InternalIcnsToImageCached (
+  OUT GUI_IMAGE            *Image,
+  OUT GUI_IMAGE_CACHE_KEY  *Key  OPTIONAL,
+  IN  CONST CHAR16         *Path,
+  IN  VOID                 *FileData,
+  IN  UINT32               FileSize,
+  IN  UINT8                Scale,
+  IN  UINT32               MatchWidth,
+  IN  UINT32               MatchHeight,
+  IN  BOOLEAN              AllowLessSize
+  )
+{
+  EFI_STATUS           Status;
+  GUI_IMAGE_CACHE_KEY  CacheKey;
+  BOOLEAN              UseCache;
+  UINT32               Params[4];
+
+  Params[0] = Scale;
+  Params[1] = MatchWidth;
+  Params[2] = MatchHeight;
+  Params[3] = AllowLessSize;
+
+  UseCache = GuiImageCacheGetKey (
+               &CacheKey,
+               Path,
+               StrSize (Path),
+               Params,
+               sizeof (Params),
+               FileData,
+               FileSize
+               );
+  if (UseCache) {
+    if (Key != NULL) {
+      CopyMem (Key, &CacheKey, sizeof (*Key));
+    }
+
+    Status = GuiImageCacheLoad (&CacheKey, Image);
+    if (!EFI_ERROR (Status)) {
+      return EFI_SUCCESS;
+    }
+  }
+
+  Status = GuiIcnsToImageIcon (
+             Image,
+             FileData,
+             FileSize,
+             Scale,
+             MatchWidth,
+             MatchHeight,
+             AllowLessSize
+             );
+  if (!EFI_ERROR (Status) && UseCache) {
+    GuiImageCacheStore (&CacheKey, Image);
+  }
+
+  return Status;
+}
+
+STATIC
+EFI_STATUS
+InternalCreateHighlightedImageCached (
+  OUT GUI_IMAGE                  *SelectedImage,
+  IN  CONST GUI_IMAGE            *SourceImage,
+  IN  CONST GUI_IMAGE_CACHE_KEY  *SourceKey
+  )
+{
+  EFI_STATUS           Status;
+  GUI_IMAGE_CACHE_KEY  CacheKey;
+  BOOLEAN              UseCache;
+  UINT32               Params[4];
+
+  Params[0] = mHighlightPixel.Blue;
+  Params[1] = mHighlightPixel.Green;
+  Params[2] = mHighlightPixel.Red;
+  Params[3] = mHighlightPixel.Reserved;
+
+  UseCache = GuiImageCacheGetKey (
+               &CacheKey,
+               SourceKey->FileName,
+               StrSize (SourceKey->FileName),
+               Params,
+               sizeof (Params),
+               SourceKey->Digest,
+               sizeof (SourceKey->Digest)
+               );
+  if (UseCache) {
+    Status = GuiImageCacheLoad (&CacheKey, SelectedImage);
+    if (!EFI_ERROR (Status)) {
+      return EFI_SUCCESS;
+    }
+  }
+
+  Status = GuiCreateHighlightedImage (
+             SelectedImage,
+             SourceImage,
+             &mHighlightPixel
+             );
+  if (!EFI_ERROR (Status) && UseCache) {
+    GuiImageCacheStore (&CacheKey, SelectedImage);
+  }
+
+  return Status;
+}
+
 STATIC
 EFI_STATUS
 LoadImageFileFromStorage (
-  OUT GUI_IMAGE           *Images,
-  IN  OC_STORAGE_CONTEXT  *Storage,
-  IN  CONST CHAR8         *ImageFilePath,
-  IN  UINT8               Scale,
-  IN  UINT32              MatchWidth,
-  IN  UINT32              MatchHeight,
-  IN  BOOLEAN             Icon,
-  IN  CONST CHAR8         *Prefix,
-  IN  BOOLEAN             AllowLessSize
+  OUT GUI_IMAGE            *Images,
+  IN  OC_STORAGE_CONTEXT   *Storage,
+  IN  CONST CHAR8          *ImageFilePath,
+  IN  UINT8                Scale,
+  IN  UINT32               MatchWidth,
+  IN  UINT32               MatchHeight,
+  IN  BOOLEAN              Icon,
+  IN  CONST CHAR8          *Prefix,
+  IN  BOOLEAN              AllowLessSize,
+  OUT GUI_IMAGE_CACHE_KEY  *BaseKey  OPTIONAL
   )
 {
   EFI_STATUS  Status;
@@ -145,6 +254,10 @@ LoadImageFileFromStorage (
 
   ImageCount = Icon ? ICON_TYPE_COUNT : 1; ///< Icons can be external.
 
+  if (BaseKey != NULL) {
+    ZeroMem (BaseKey, sizeof (*BaseKey));
+  }
+
   for (Index = 0; Index < ImageCount; ++Index) {
     Status = OcUnicodeSafeSPrint (
                Path,
@@ -164,8 +277,10 @@ LoadImageFileFromStorage (
     if (OcStorageExistsFileUnicode (Storage, Path)) {
       FileData = OcStorageReadFileUnicode (Storage, Path, &FileSize);
       if ((FileData != NULL) && (FileSize > 0)) {
-        Status = GuiIcnsToImageIcon (
+        Status = InternalIcnsToImageCached (
                    &Images[Index],
+                   Index == ICON_TYPE_BASE ? BaseKey : NULL,
+                   Path,
                    FileData,
                    FileSize,
                    Scale,
@@ -260,9 +375,12 @@ LoadLabelFromStorage (
   OUT GUI_IMAGE           *Image
   )
 {
-  VOID        *ImageData;
-  UINT32      ImageSize;
-  EFI_STATUS  Status;
+  VOID                 *ImageData;
+  UINT32               ImageSize;
+  EFI_STATUS           Status;
+  GUI_IMAGE_CACHE_KEY  CacheKey;
+  BOOLEAN              UseCache;
+  UINT32               Params[2];
 
   ASSERT (Scale == 1 || Scale == 2);
 
@@ -271,7 +389,30 @@ LoadLabelFromStorage (
     return Status;
   }
 
+  Params[0] = Scale;
+  Params[1] = Inverted;
+
+  UseCache = GuiImageCacheGetKey (
+               &CacheKey,
+               ImageFilePath,
+               AsciiStrSize (ImageFilePath),
+               Params,
+               sizeof (Params),
+               ImageData,
+               ImageSize
+               );
+  if (UseCache) {
+    Status = GuiImageCacheLoad (&CacheKey, Image);
+    if (!EFI_ERROR (Status)) {
+      FreePool (ImageData);
+      return EFI_SUCCESS;
+    }
+  }
+
   Status = GuiLabelToImage (Image, ImageData, ImageSize, Scale, Inverted);
+  if (!EFI_ERROR (Status) && UseCache) {
+    GuiImageCacheStore (&CacheKey, Image);
+  }
 
   FreePool (ImageData);
 
@@ -355,8 +496,10 @@ InternalGetFlavourIcon (
   if (OcStorageExistsFileUnicode (Storage, Path)) {
     FileData = OcStorageReadFileUnicode (Storage, Path, &FileSize);
     if ((FileData != NULL) && (FileSize > 0)) {
-      Status = GuiIcnsToImageIcon (
+      Status = InternalIcnsToImageCached (
                  EntryIcon,
+                 NULL,
+                 Path,
                  FileData,
                  FileSize,
                  GuiContext->Scale,
@@ -404,6 +547,7 @@ InternalContextConstruct (
   BOOLEAN                            Result;
   BOOLEAN                            AllowLessSize;
   BOOLEAN                            UseGenericLabel;
+  GUI_IMAGE_CACHE_KEY                BaseKey;
 
   ASSERT (Context != NULL);
 
@@ -449,6 +593,8 @@ InternalContextConstruct (
     Context->Prefix = Picker->PickerVariant;
   }
 
+  GuiImageCacheConstruct (Storage, Picker->PickerAttributes);
+
   LoadImageFileFromStorage (
     &Context->Background,
     Storage,
@@ -458,7 +604,8 @@ InternalContextConstruct (
     0,
     FALSE,
     Context->Prefix,
-    FALSE
+    FALSE,
+    NULL
     );
 
   if (Context->BackgroundColor.Raw == APPLE_COLOR_SYRAH_BLACK) {
@@ -533,14 +680,15 @@ InternalContextConstruct (
                ImageHeight,
                Index >= ICON_NUM_SYS,
                Context->Prefix,
-               AllowLessSize
+               AllowLessSize,
+               &BaseKey
                );
     if (!EFI_ERROR (Status)) {
       if ((Index == ICON_SELECTOR) || (Index == ICON_SET_DEFAULT) || (Index == ICON_LEFT) || (Index == ICON_RIGHT) || (Index == ICON_SHUT_DOWN) || (Index == ICON_RESTART) || (Index == ICON_ENTER)) {
-        Status = GuiCreateHighlightedImage (
+        Status = InternalCreateHighlightedImageCached (
                    &Context->Icons[Index][ICON_TYPE_HELD],
                    &Context->Icons[Index][ICON_TYPE_BASE],
-                   &mHighlightPixel
+                   &BaseKey
                    );
         if (Index == ICON_SET_DEFAULT) {
           if (Context->Icons[Index]->Width != Context->Icons[ICON_SELECTOR]->Width) {
@@ -12,6 +12,9 @@
 #include "BmfLib.h"
 
 #include <Library/OcBootManagementLib.h>
+#include <Library/OcCryptoLib.h>
+#include <Library/OcStorageLib.h>
+#include <Library/OcStringLib.h>
 
 #define BOOT_CURSOR_OFFSET  4U
 
@@ -193,4 +196,83 @@ InternalGetFlavourIcon (
   OUT BOOLEAN                  *CustomIcon
   );
 
+#define GUI_IMAGE_CACHE_NAME_LENGTH  24U
+
+typedef struct {
+  CHAR16    FileName[GUI_IMAGE_CACHE_NAME_LENGTH + L_STR_LEN (L".bin") + 1];
+  UINT8     Digest[SHA256_DIGEST_SIZE];
+} GUI_IMAGE_CACHE_KEY;
+
+/**
+  Open the decoded image cache when enabled by picker attributes.
+
+  @param[in] Storage           OpenCore storage.
+  @param[in] PickerAttributes  Picker attributes.
+**/
+VOID
+GuiImageCacheConstruct (
+  IN OC_STORAGE_CONTEXT  *Storage,
+  IN UINT32              PickerAttributes
+  );
+
+/**
+  Close the decoded image cache.
+**/
+VOID
+GuiImageCacheDestruct (
+  VOID
+  );
+
+/**
+  Calculate the image cache key of a decoded image.
+
+  @param[out] Key         Image cache key.
+  @param[in]  Name        Unique name of the source, e.g. its path.
+  @param[in]  NameSize    Size of Name in bytes.
+  @param[in]  Params      Decoding parameters.
+  @param[in]  ParamsSize  Size of Params in bytes.
+  @param[in]  Data        Source data.
+  @param[in]  DataSize    Size of Data in bytes.
+
+  @retval TRUE   Key was calculated.
+  @retval FALSE  Image cache is disabled.
+**/
+BOOLEAN
+GuiImageCacheGetKey (
+  OUT GUI_IMAGE_CACHE_KEY  *Key,
+  IN  CONST VOID           *Name,
+  IN  UINTN                NameSize,
+  IN  CONST UINT32         *Params,
+  IN  UINTN                ParamsSize,
+  IN  CONST VOID           *Data,
+  IN  UINTN                DataSize
+  );
+
+/**
+  Load a decoded image from the image cache with a single read.
+
+  @param[in]  Key    Image cache key.
+  @param[out] Image  Decoded image, its buffer must be freed by the caller.
+
+  @retval EFI_SUCCESS  Image was loaded.
+  @retval other        Image is missing or outdated.
+**/
+EFI_STATUS
+GuiImageCacheLoad (
+  IN  CONST GUI_IMAGE_CACHE_KEY  *Key,
+  OUT GUI_IMAGE                  *Image
+  );
+
+/**
+  Store a decoded image in the image cache.
+
+  @param[in] Key    Image cache key.
+  @param[in] Image  Decoded image.
+**/
+VOID
+GuiImageCacheStore (
+  IN CONST GUI_IMAGE_CACHE_KEY  *Key,
+  IN CONST GUI_IMAGE            *Image
+  );
+
 #endif // GUI_APP_H
@@ -0,0 +1,440 @@
+/** @file
+  This file is part of OpenCanopy, OpenCore GUI.
+
+  Decoded image cache stored on the OpenCore volume.
+
+  Copyright (C) 2026, Acidanthera. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#include <Uefi.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/BaseOverflowLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/OcCryptoLib.h>
+#include <Library/OcFileLib.h>
+#include <Library/OcFlexArrayLib.h>
+#include <Library/OcStorageLib.h>
+#include <Library/OcStringLib.h>
+
+#include "OpenCanopy.h"
+#include "GuiApp.h"
+
+#define GUI_IMAGE_CACHE_PATH       L"OpenCanopyCache"
+#define GUI_IMAGE_CACHE_SIGNATURE  SIGNATURE_32 ('O', 'C', 'I', 'C')
+#define GUI_IMAGE_CACHE_VERSION    1U
+
+//
+// Upper bound for the pixels of a single cached image. Icons and labels fit
+// well within it even at 2x scale, while full-screen images like the
+// background are larger and would quickly exhaust the OpenCore volume.
+//
+#define GUI_IMAGE_CACHE_MAX_PIXELS_SIZE  SIZE_1MB
+
+//
+// Cached images are stored as premultiplied BGRA pixels followed by this
+// trailer, so that the pixels are used in place after a single file read.
+//
+typedef struct {
+  UINT32    Signature;
+  UINT32    Version;
+  UINT32    Width;
+  UINT32    Height;
+  UINT8     Digest[SHA256_DIGEST_SIZE];
+} GUI_IMAGE_CACHE_TRAILER;
+
+typedef struct {
+  CHAR16    FileName[GUI_IMAGE_CACHE_NAME_LENGTH + L_STR_LEN (L".bin") + 1];
+} GUI_IMAGE_CACHE_FILE_NAME;
+
+STATIC EFI_FILE_PROTOCOL  *mImageCacheDirectory = NULL;
+
+//
+// Files loaded or stored during this boot. Everything else in the cache
+// directory is left over from other themes, variants, or scales.
+//
+STATIC OC_FLEX_ARRAY  *mImageCacheUsedFiles = NULL;
+STATIC BOOLEAN        mImageCacheUsedFilesValid = FALSE;
+
+STATIC
+BOOLEAN
+InternalImageCacheHasFile (
+  IN CONST OC_FLEX_ARRAY  *Files,
+  IN CONST CHAR16         *FileName
+  )
+{
+  UINTN                      Index;
+  GUI_IMAGE_CACHE_FILE_NAME  *Entry;
+
+  for (Index = 0; Index < Files->Count; ++Index) {
+    Entry = OcFlexArrayItemAt (Files, Index);
+    if (OcStriCmp (Entry->FileName, FileName) == 0) {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+STATIC
+BOOLEAN
+InternalImageCacheAddFile (
+  IN OUT OC_FLEX_ARRAY  *Files,
+  IN     CONST CHAR16   *FileName
+  )
+{
+  GUI_IMAGE_CACHE_FILE_NAME  *Entry;
+
+  if (StrSize (FileName) > sizeof (Entry->FileName)) {
+    return FALSE;
+  }
+
+  Entry = OcFlexArrayAddItem (Files);
+  if (Entry == NULL) {
+    return FALSE;
+  }
+
+  StrCpyS (Entry->FileName, ARRAY_SIZE (Entry->FileName), FileName);
+  return TRUE;
+}
+
+STATIC
+VOID
+InternalImageCacheMarkUsed (
+  IN CONST GUI_IMAGE_CACHE_KEY  *Key
+  )
+{
+  if (  !mImageCacheUsedFilesValid
+     || InternalImageCacheHasFile (mImageCacheUsedFiles, Key->FileName))
+  {
+    return;
+  }
+
+  //
+  // Without a complete list no file can be safely considered unused.
+  //
+  if (!InternalImageCacheAddFile (mImageCacheUsedFiles, Key->FileName)) {
+    mImageCacheUsedFilesValid = FALSE;
+  }
+}
+
+STATIC
+EFI_STATUS
+InternalImageCacheCollectUnused (
+  IN     EFI_FILE_HANDLE  Directory,
+  IN     EFI_FILE_INFO    *FileInfo,
+  IN     UINTN            FileInfoSize,
+  IN OUT VOID             *Context   OPTIONAL
+  )
+{
+  OC_FLEX_ARRAY  *UnusedFiles;
+
+  ASSERT (Context != NULL);
+
+  UnusedFiles = Context;
+
+  if (  ((FileInfo->Attribute & EFI_FILE_DIRECTORY) != 0)
+     || !OcUnicodeEndsWith (FileInfo->FileName, L".bin", TRUE)
+     || InternalImageCacheHasFile (mImageCacheUsedFiles, FileInfo->FileName))
+  {
+    return EFI_NOT_FOUND;
+  }
+
+  //
+  // Only record the file here, deleting it would disturb the directory read.
+  //
+  if (!InternalImageCacheAddFile (UnusedFiles, FileInfo->FileName)) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+VOID
+InternalImageCacheDeleteUnused (
+  VOID
+  )
+{
+  EFI_STATUS                 Status;
+  OC_FLEX_ARRAY              *UnusedFiles;
+  GUI_IMAGE_CACHE_FILE_NAME  *Entry;
+  UINTN                      Index;
+
+  //
+  // Nothing is known to be in use when the interface did not load any image.
+  //
+  if (!mImageCacheUsedFilesValid || (mImageCacheUsedFiles->Count == 0)) {
+    return;
+  }
+
+  UnusedFiles = OcFlexArrayInit (sizeof (GUI_IMAGE_CACHE_FILE_NAME), NULL);
+  if (UnusedFiles == NULL) {
+    return;
+  }
+
+  Status = OcScanDirectory (mImageCacheDirectory, InternalImageCacheCollectUnused, UnusedFiles);
+  if (!EFI_ERROR (Status)) {
+    for (Index = 0; Index < UnusedFiles->Count; ++Index) {
+      Entry  = OcFlexArrayItemAt (UnusedFiles, Index);
+      Status = OcDeleteFile (mImageCacheDirectory, Entry->FileName);
+      DEBUG ((DEBUG_INFO, "OCUI: Deleting unused image cache %s - %r\n", Entry->FileName, Status));
+    }
+  } else if (Status != EFI_NOT_FOUND) {
+    DEBUG ((DEBUG_INFO, "OCUI: Cannot scan image cache - %r\n", Status));
+  }
+
+  OcFlexArrayFree (&UnusedFiles);
+}
+
+VOID
+GuiImageCacheConstruct (
+  IN OC_STORAGE_CONTEXT  *Storage,
+  IN UINT32              PickerAttributes
+  )
+{
+  EFI_STATUS         Status;
+  EFI_FILE_PROTOCOL  *Root;
+
+  ASSERT (Storage != NULL);
+
+  GuiImageCacheDestruct ();
+
+  if ((PickerAttributes & OC_ATTR_USE_IMAGE_CACHE) == 0) {
+    return;
+  }
+
+  //
+  // Cached images cannot be authenticated.
+  //
+  if (Storage->HasVault) {
+    DEBUG ((DEBUG_INFO, "OCUI: Image cache is not supported with vault\n"));
+    return;
+  }
+
+  Status = OcFindWritableOcFileSystem (&Root);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "OCUI: Unable to find root writable filesystem for image cache - %r\n", Status));
+    return;
+  }
+
+  Status = OcSafeFileOpen (
+             Root,
+             &mImageCacheDirectory,
+             GUI_IMAGE_CACHE_PATH,
+             EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE | EFI_FILE_MODE_CREATE,
+             EFI_FILE_DIRECTORY
+             );
+  Root->Close (Root);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "OCUI: Cannot open image cache - %r\n", Status));
+    mImageCacheDirectory = NULL;
+    return;
+  }
+
+  mImageCacheUsedFiles      = OcFlexArrayInit (sizeof (GUI_IMAGE_CACHE_FILE_NAME), NULL);
+  mImageCacheUsedFilesValid = mImageCacheUsedFiles != NULL;
+}
+
+VOID
+GuiImageCacheDestruct (
+  VOID
+  )
+{
+  if (mImageCacheDirectory != NULL) {
+    InternalImageCacheDeleteUnused ();
+    mImageCacheDirectory->Close (mImageCacheDirectory);
+    mImageCacheDirectory = NULL;
+  }
+
+  if (mImageCacheUsedFiles != NULL) {
+    OcFlexArrayFree (&mImageCacheUsedFiles);
+  }
+
+  mImageCacheUsedFilesValid = FALSE;
+}
+
+BOOLEAN
+GuiImageCacheGetKey (
+  OUT GUI_IMAGE_CACHE_KEY  *Key,
+  IN  CONST VOID           *Name,
+  IN  UINTN                NameSize,
+  IN  CONST UINT32         *Params,
+  IN  UINTN                ParamsSize,
+  IN  CONST VOID           *Data,
+  IN  UINTN                DataSize
+  )
+{
+  STATIC CONST CHAR16  mHexDigits[] = L"0123456789abcdef";
+
+  SHA256_CONTEXT  Context;
+  UINT8           NameDigest[SHA256_DIGEST_SIZE];
+  UINT32          Index;
+
+  ASSERT (Key != NULL);
+  ASSERT (Name != NULL);
+  ASSERT (Params != NULL);
+  ASSERT (Data != NULL);
+
+  if (mImageCacheDirectory == NULL) {
+    return FALSE;
+  }
+
+  //
+  // The file name depends on the source and how it is decoded, such that
+  // every image has at most one file. The digest additionally covers the
+  // source data to invalidate the file when the source changes.
+  //
+  Sha256Init (&Context);
+  Sha256Update (&Context, Name, NameSize);
+  Sha256Update (&Context, (CONST UINT8 *)Params, ParamsSize);
+  Sha256Final (&Context, NameDigest);
+
+  STATIC_ASSERT (
+    GUI_IMAGE_CACHE_NAME_LENGTH / 2 <= SHA256_DIGEST_SIZE,
+    "Image cache file name is too long."
+    );
+  for (Index = 0; Index < GUI_IMAGE_CACHE_NAME_LENGTH / 2; ++Index) {
+    Key->FileName[Index * 2]     = mHexDigits[NameDigest[Index] >> 4U];
+    Key->FileName[Index * 2 + 1] = mHexDigits[NameDigest[Index] & 0x0FU];
+  }
+
+  CopyMem (&Key->FileName[GUI_IMAGE_CACHE_NAME_LENGTH], L".bin", sizeof (L".bin"));
+
+  Sha256Init (&Context);
+  Sha256Update (&Context, (CONST UINT8 *)Params, ParamsSize);
+  Sha256Update (&Context, Data, DataSize);
+  Sha256Final (&Context, Key->Digest);
+
+  return TRUE;
+}
+
+EFI_STATUS
+GuiImageCacheLoad (
+  IN  CONST GUI_IMAGE_CACHE_KEY  *Key,
+  OUT GUI_IMAGE                  *Image
+  )
+{
+  UINT8                    *FileData;
+  UINT32                   FileSize;
+  UINT32                   PixelCount;
+  UINT32                   PixelsSize;
+  GUI_IMAGE_CACHE_TRAILER  Trailer;
+
+  ASSERT (Key != NULL);
+  ASSERT (Image != NULL);
+
+  if (mImageCacheDirectory == NULL) {
+    return EFI_UNSUPPORTED;
+  }
+
+  FileData = OcReadFileFromDirectory (
+               mImageCacheDirectory,
+               Key->FileName,
+               &FileSize,
+               GUI_IMAGE_CACHE_MAX_PIXELS_SIZE + sizeof (Trailer)
+               );
+  if (FileData == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  if (FileSize < sizeof (Trailer)) {
+    FreePool (FileData);
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  CopyMem (&Trailer, &FileData[FileSize - sizeof (Trailer)], sizeof (Trailer));
+
+  if (  (Trailer.Signature != GUI_IMAGE_CACHE_SIGNATURE)
+     || (Trailer.Version != GUI_IMAGE_CACHE_VERSION)
+     || (Trailer.Width == 0)
+     || (Trailer.Height == 0)
+     || BaseOverflowMulU32 (Trailer.Width, Trailer.Height, &PixelCount)
+     || BaseOverflowMulU32 (PixelCount, sizeof (*Image->Buffer), &PixelsSize)
+     || (PixelsSize != FileSize - sizeof (Trailer)))
+  {
+    DEBUG ((DEBUG_INFO, "OCUI: Image cache %s has incompatible layout\n", Key->FileName));
+    FreePool (FileData);
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  if (CompareMem (Trailer.Digest, Key->Digest, sizeof (Trailer.Digest)) != 0) {
+    DEBUG ((DEBUG_INFO, "OCUI: Image cache %s is outdated\n", Key->FileName));
+    FreePool (FileData);
+    return EFI_NOT_FOUND;
+  }
+
+  //
+  // The trailer remains in the allocation after the pixels.
+  //
+  Image->Width  = Trailer.Width;
+  Image->Height = Trailer.Height;
+  Image->Buffer = (EFI_GRAPHICS_OUTPUT_BLT_PIXEL *)FileData;
+
+  InternalImageCacheMarkUsed (Key);
+
+  return EFI_SUCCESS;
+}
+
+VOID
+GuiImageCacheStore (
+  IN CONST GUI_IMAGE_CACHE_KEY  *Key,
+  IN CONST GUI_IMAGE            *Image
+  )
+{
+  EFI_STATUS               Status;
+  UINT8                    *FileData;
+  UINT32                   PixelsSize;
+  GUI_IMAGE_CACHE_TRAILER  *Trailer;
+
+  ASSERT (Key != NULL);
+  ASSERT (Image != NULL);
+  ASSERT (Image->Buffer != NULL);
+
+  if (mImageCacheDirectory == NULL) {
+    return;
+  }
+
+  //
+  // The multiplication cannot wrap around because the image was already allocated.
+  //
+  PixelsSize = Image->Width * Image->Height * sizeof (*Image->Buffer);
+  if (PixelsSize > GUI_IMAGE_CACHE_MAX_PIXELS_SIZE) {
+    DEBUG ((DEBUG_INFO, "OCUI: Image cache %s skipped for %ux%u image\n", Key->FileName, Image->Width, Image->Height));
+    return;
+  }
+
+  FileData   = AllocatePool (PixelsSize + sizeof (*Trailer));
+  if (FileData == NULL) {
+    return;
+  }
+
+  CopyMem (FileData, Image->Buffer, PixelsSize);
+  Trailer            = (GUI_IMAGE_CACHE_TRAILER *)&FileData[PixelsSize];
+  Trailer->Signature = GUI_IMAGE_CACHE_SIGNATURE;
+  Trailer->Version   = GUI_IMAGE_CACHE_VERSION;
+  Trailer->Width     = Image->Width;
+  Trailer->Height    = Image->Height;
+  CopyMem (Trailer->Digest, Key->Digest, sizeof (Trailer->Digest));
+
+  //
+  // Creating a file does not truncate the existing one.
+  //
+  OcDeleteFile (mImageCacheDirectory, Key->FileName);
+  Status = OcSetFileData (
+             mImageCacheDirectory,
+             Key->FileName,
+             FileData,
+             PixelsSize + sizeof (*Trailer)
+             );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "OCUI: Cannot store image cache %s - %r\n", Key->FileName, Status));
+  } else {
+    InternalImageCacheMarkUsed (Key);
+  }
+
+  FreePool (FileData);
+}
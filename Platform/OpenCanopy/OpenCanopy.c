@@ -54,12 +54,31 @@ STATIC UINT32                         mScreenBufferDelta = 0;
 STATIC UINT64  mDeltaTscTarget = 0;
 STATIC UINT64  mStartTsc       = 0;
 //
-// Drawing rectangles information
+// Screen damage information. Draw requests mark the GUI_DAMAGE_TILE_SIZE
+// square tiles they intersect, which are merged into rectangles on flush.
 //
-STATIC UINT8             mNumValidDrawReqs = 0;
-STATIC GUI_DRAW_REQUEST  mDrawRequests[6]  = {
-  { 0 }
-};
+#define GUI_DAMAGE_TILE_SHIFT  5U
+#define GUI_DAMAGE_TILE_SIZE   (1U << GUI_DAMAGE_TILE_SHIFT)
+
+typedef struct {
+  UINT64    Frames;
+  UINT64    RequestedPixels;
+  UINT64    DrawnPixels;
+  UINT64    BlitPixels;
+  UINT64    WorkTsc;
+} GUI_DAMAGE_STATS;
+
+STATIC UINT32            *mDamageTiles    = NULL;
+STATIC UINT32            *mFlushTiles     = NULL;
+STATIC UINT32            *mDamageOpen     = NULL;
+STATIC UINT32            mDamageWidth     = 0;
+STATIC UINT32            mDamageHeight    = 0;
+STATIC UINT32            mDamageCols      = 0;
+STATIC UINT32            mDamageRows      = 0;
+STATIC UINT32            mDamageRowWords  = 0;
+STATIC UINT32            mDamageMaxRuns   = 0;
+STATIC GUI_DRAW_REQUEST  *mDrawRequests   = NULL;
+STATIC GUI_DAMAGE_STATS  mDamageStats;
 
 STATIC UINT32  mPointerOldDrawBaseX  = 0;
 STATIC UINT32  mPointerOldDrawBaseY  = 0;
@@ -366,13 +385,9 @@ GuiDrawToBuffer (
   UINT32  PosX;
   UINT32  PosY;
 
-  UINT32                               RowIndex;
-  UINT32                               SourceRowOffset;
-  UINT32                               TargetRowOffset;
-  UINT32                               SourceColumnOffset;
-  UINT32                               TargetColumnOffset;
-  CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *SourcePixel;
-  EFI_GRAPHICS_OUTPUT_BLT_PIXEL        *TargetPixel;
+  UINT32  RowIndex;
+  UINT32  SourceRowOffset;
+  UINT32  TargetRowOffset;
 
   ASSERT (Image != NULL);
   ASSERT (DrawContext != NULL);
@@ -412,158 +427,213 @@ GuiDrawToBuffer (
 
   ASSERT (Image->Buffer != NULL);
 
-  if (Opacity == 0xFF) {
-    //
-    // Iterate over each row of the request.
-    //
-    for (
-         RowIndex = 0,
-         SourceRowOffset = OffsetY * Image->Width,
-         TargetRowOffset = PosY * DrawContext->Screen.Width;
-         RowIndex < Height;
-         ++RowIndex,
-         SourceRowOffset += Image->Width,
-         TargetRowOffset += DrawContext->Screen.Width
-         )
-    {
-      //
-      // Blend the row pixel-by-pixel.
-      //
-      for (
-           TargetColumnOffset = PosX, SourceColumnOffset = OffsetX;
-           TargetColumnOffset < PosX + Width;
-           ++TargetColumnOffset, ++SourceColumnOffset
-           )
-      {
-        TargetPixel = &mScreenBuffer[TargetRowOffset + TargetColumnOffset];
-        SourcePixel = &Image->Buffer[SourceRowOffset + SourceColumnOffset];
-        GuiBlendPixelSolid (TargetPixel, SourcePixel);
-      }
-    }
-  } else {
-    //
-    // Iterate over each row of the request.
-    //
-    for (
-         RowIndex = 0,
-         SourceRowOffset = OffsetY * Image->Width,
-         TargetRowOffset = PosY * DrawContext->Screen.Width;
-         RowIndex < Height;
-         ++RowIndex,
-         SourceRowOffset += Image->Width,
-         TargetRowOffset += DrawContext->Screen.Width
-         )
-    {
-      //
-      // Blend the row pixel-by-pixel.
-      //
-      for (
-           TargetColumnOffset = PosX, SourceColumnOffset = OffsetX;
-           TargetColumnOffset < PosX + Width;
-           ++TargetColumnOffset, ++SourceColumnOffset
-           )
-      {
-        TargetPixel = &mScreenBuffer[TargetRowOffset + TargetColumnOffset];
-        SourcePixel = &Image->Buffer[SourceRowOffset + SourceColumnOffset];
-        GuiBlendPixelOpaque (TargetPixel, SourcePixel, Opacity);
-      }
+  //
+  // Iterate over each row of the request.
+  //
+  for (
+       RowIndex = 0,
+       SourceRowOffset = OffsetY * Image->Width + OffsetX,
+       TargetRowOffset = PosY * DrawContext->Screen.Width + PosX;
+       RowIndex < Height;
+       ++RowIndex,
+       SourceRowOffset += Image->Width,
+       TargetRowOffset += DrawContext->Screen.Width
+       )
+  {
+    if (Opacity == 0xFF) {
+      GuiBlendRowSolid (
+        &mScreenBuffer[TargetRowOffset],
+        &Image->Buffer[SourceRowOffset],
+        Width
+        );
+    } else {
+      GuiBlendRowOpaque (
+        &mScreenBuffer[TargetRowOffset],
+        &Image->Buffer[SourceRowOffset],
+        Width,
+        Opacity
+        );
     }
   }
 }
 
-VOID
-GuiRequestDraw (
-  IN UINT32  PosX,
-  IN UINT32  PosY,
-  IN UINT32  Width,
-  IN UINT32  Height
+/**
+  Find the first tile column at or after Col with the requested damage state.
+
+  @param[in] Row  Damage bitmap row.
+  @param[in] Col  Tile column to start at.
+  @param[in] Set  Whether to look for a damaged or an undamaged tile.
+
+  @retval Tile column index, mDamageCols when none is found.
+**/
+STATIC
+UINT32
+GuiDamageFindTile (
+  IN CONST UINT32  *Row,
+  IN UINT32        Col,
+  IN BOOLEAN       Set
   )
 {
-  UINTN  Index;
+  UINT32  Word;
 
-  UINT32  ThisArea;
-  UINT32  ThisMaxXPlus1;
-  UINT32  ThisMaxYPlus1;
+  while (Col < mDamageCols) {
+    Word = Row[Col / 32];
+    if (!Set) {
+      Word = ~Word;
+    }
 
-  UINT32  ReqMaxXPlus1;
-  UINT32  ReqMaxYPlus1;
-  UINT32  ReqArea;
+    Word >>= Col % 32;
+    if (Word != 0) {
+      Col += (UINT32)LowBitSet32 (Word);
+      break;
+    }
 
-  UINT32  CombX;
-  UINT32  CombY;
-  UINT32  CombWidth;
-  UINT32  CombHeight;
-  UINT32  CombArea;
+    Col = (Col | 31U) + 1;
+  }
 
-  ThisMaxXPlus1 = PosX + Width;
-  ThisMaxYPlus1 = PosY + Height;
+  return MIN (Col, mDamageCols);
+}
 
-  ThisArea = Width * Height;
+/**
+  Merge the damaged tiles of Tiles into mDrawRequests and clear them.
+  Each tile row is split into spans of consecutive damaged tiles, and spans
+  matching a rectangle of the previous row exactly extend that rectangle.
 
-  for (Index = 0; Index < mNumValidDrawReqs; ++Index) {
-    //
-    // Calculate several dimensions to determine whether to merge the two
-    // draw requests for improved flushing performance.
-    //
-    ReqMaxXPlus1 = mDrawRequests[Index].X + mDrawRequests[Index].Width;
-    ReqMaxYPlus1 = mDrawRequests[Index].Y + mDrawRequests[Index].Height;
-    ReqArea      = mDrawRequests[Index].Width * mDrawRequests[Index].Height;
+  @param[in,out] Tiles  Damage bitmap to consume.
 
-    if (mDrawRequests[Index].X < PosX) {
-      CombX = mDrawRequests[Index].X;
-    } else {
-      CombX = PosX;
-    }
+  @retval Number of valid entries in mDrawRequests.
+**/
+STATIC
+UINT32
+GuiDamageCollect (
+  IN OUT UINT32  *Tiles
+  )
+{
+  UINT32            *Open;
+  UINT32            *NextOpen;
+  UINT32            *Temp;
+  UINT32            *Row;
+  UINT32            NumOpen;
+  UINT32            NumNextOpen;
+  UINT32            OpenIndex;
+  UINT32            NumRects;
+  UINT32            RectIndex;
+  UINT32            TileRow;
+  UINT32            Col;
+  UINT32            End;
+  GUI_DRAW_REQUEST  *Rect;
+
+  Open     = mDamageOpen;
+  NextOpen = mDamageOpen + mDamageMaxRuns;
+  NumOpen  = 0;
+  NumRects = 0;
+
+  for (TileRow = 0; TileRow < mDamageRows; ++TileRow) {
+    Row         = &Tiles[TileRow * mDamageRowWords];
+    NumNextOpen = 0;
+    OpenIndex   = 0;
+
+    Col = GuiDamageFindTile (Row, 0, TRUE);
+    while (Col < mDamageCols) {
+      End = GuiDamageFindTile (Row, Col, FALSE);
+      //
+      // Both the spans and the open rectangles are sorted by column.
+      //
+      while (OpenIndex < NumOpen && mDrawRequests[Open[OpenIndex]].X < Col) {
+        ++OpenIndex;
+      }
 
-    if (ReqMaxXPlus1 > ThisMaxXPlus1) {
-      CombWidth = ReqMaxXPlus1;
-    } else {
-      CombWidth = ThisMaxXPlus1;
-    }
+      if (  (OpenIndex < NumOpen)
+         && (mDrawRequests[Open[OpenIndex]].X == Col)
+         && (mDrawRequests[Open[OpenIndex]].Width == End - Col))
+      {
+        RectIndex = Open[OpenIndex];
+        ++mDrawRequests[RectIndex].Height;
+        ++OpenIndex;
+      } else {
+        ASSERT (NumRects < mDamageRows * mDamageMaxRuns);
+        RectIndex                       = NumRects++;
+        mDrawRequests[RectIndex].X      = Col;
+        mDrawRequests[RectIndex].Y      = TileRow;
+        mDrawRequests[RectIndex].Width  = End - Col;
+        mDrawRequests[RectIndex].Height = 1;
+      }
 
-    CombWidth -= CombX;
+      ASSERT (NumNextOpen < mDamageMaxRuns);
+      NextOpen[NumNextOpen++] = RectIndex;
 
-    if (mDrawRequests[Index].Y < PosY) {
-      CombY = mDrawRequests[Index].Y;
-    } else {
-      CombY = PosY;
+      Col = GuiDamageFindTile (Row, End, TRUE);
     }
 
-    if (ReqMaxYPlus1 > ThisMaxYPlus1) {
-      CombHeight = ReqMaxYPlus1;
-    } else {
-      CombHeight = ThisMaxYPlus1;
-    }
+    ZeroMem (Row, mDamageRowWords * sizeof (*Row));
 
-    CombHeight -= CombY;
+    Temp     = Open;
+    Open     = NextOpen;
+    NextOpen = Temp;
+    NumOpen  = NumNextOpen;
+  }
 
-    CombArea = CombWidth * CombHeight;
-    //
-    // Two requests are merged when the overarching rectangle is not bigger than
-    // the two separate rectangles (not accounting for the overlap, as it would
-    // be drawn twice).
-    //
-    // TODO: Profile a good constant factor?
-    //
-    if (ThisArea + ReqArea >= CombArea) {
-      mDrawRequests[Index].X      = CombX;
-      mDrawRequests[Index].Y      = CombY;
-      mDrawRequests[Index].Width  = CombWidth;
-      mDrawRequests[Index].Height = CombHeight;
-      return;
-    }
+  //
+  // Convert the tile rectangles to pixels, cropping the last row and column
+  // to the screen.
+  //
+  for (RectIndex = 0; RectIndex < NumRects; ++RectIndex) {
+    Rect         = &mDrawRequests[RectIndex];
+    End          = MIN ((Rect->X + Rect->Width) << GUI_DAMAGE_TILE_SHIFT, mDamageWidth);
+    Rect->X    <<= GUI_DAMAGE_TILE_SHIFT;
+    Rect->Width  = End - Rect->X;
+    End          = MIN ((Rect->Y + Rect->Height) << GUI_DAMAGE_TILE_SHIFT, mDamageHeight);
+    Rect->Y    <<= GUI_DAMAGE_TILE_SHIFT;
+    Rect->Height = End - Rect->Y;
+  }
+
+  return NumRects;
+}
+
+VOID
+GuiRequestDraw (
+  IN UINT32  PosX,
+  IN UINT32  PosY,
+  IN UINT32  Width,
+  IN UINT32  Height
+  )
+{
+  UINT32  *Row;
+  UINT32  TileX0;
+  UINT32  TileX1;
+  UINT32  TileY0;
+  UINT32  TileY1;
+  UINT32  TileRow;
+  UINT32  TileCol;
+
+  ASSERT (mDamageTiles != NULL);
+  ASSERT (PosX <= mDamageWidth && Width <= mDamageWidth - PosX);
+  ASSERT (PosY <= mDamageHeight && Height <= mDamageHeight - PosY);
+
+  if ((PosX >= mDamageWidth) || (PosY >= mDamageHeight)) {
+    return;
   }
 
-  if (mNumValidDrawReqs >= ARRAY_SIZE (mDrawRequests)) {
-    ASSERT (FALSE);
+  Width  = MIN (Width, mDamageWidth - PosX);
+  Height = MIN (Height, mDamageHeight - PosY);
+
+  if ((Width == 0) || (Height == 0)) {
     return;
   }
 
-  mDrawRequests[mNumValidDrawReqs].X      = PosX;
-  mDrawRequests[mNumValidDrawReqs].Y      = PosY;
-  mDrawRequests[mNumValidDrawReqs].Width  = Width;
-  mDrawRequests[mNumValidDrawReqs].Height = Height;
-  ++mNumValidDrawReqs;
+  mDamageStats.RequestedPixels += (UINT64)Width * Height;
+
+  TileX0 = PosX >> GUI_DAMAGE_TILE_SHIFT;
+  TileX1 = (PosX + Width - 1) >> GUI_DAMAGE_TILE_SHIFT;
+  TileY0 = PosY >> GUI_DAMAGE_TILE_SHIFT;
+  TileY1 = (PosY + Height - 1) >> GUI_DAMAGE_TILE_SHIFT;
+
+  for (TileRow = TileY0; TileRow <= TileY1; ++TileRow) {
+    Row = &mDamageTiles[TileRow * mDamageRowWords];
+    for (TileCol = TileX0; TileCol <= TileX1; ++TileCol) {
+      Row[TileCol / 32] |= 1U << (TileCol % 32);
+    }
+  }
 }
 
 VOID
@@ -751,9 +821,10 @@ GuiFlushScreen (
   IN OUT GUI_DRAWING_CONTEXT  *DrawContext
   )
 {
-  UINTN  Index;
-  UINTN  ReverseIndex;
+  UINTN   Index;
+  UINT32  NumRects;
 
+  UINT64  WorkStartTsc;
   UINT64  EndTsc;
   UINT64  DeltaTsc;
 
@@ -761,7 +832,15 @@ GuiFlushScreen (
   ASSERT (DrawContext->Screen.OffsetX == 0);
   ASSERT (DrawContext->Screen.OffsetY == 0);
   ASSERT (DrawContext->Screen.Draw != NULL);
-  for (Index = 0; Index < mNumValidDrawReqs; ++Index) {
+
+  WorkStartTsc = AsmReadTsc ();
+  //
+  // Remember the redrawn tiles for the transfer below, the objects are only
+  // asked to redraw the merged rectangles of damaged tiles.
+  //
+  CopyMem (mFlushTiles, mDamageTiles, mDamageRows * mDamageRowWords * sizeof (*mFlushTiles));
+  NumRects = GuiDamageCollect (mDamageTiles);
+  for (Index = 0; Index < NumRects; ++Index) {
     DrawContext->Screen.Draw (
                           &DrawContext->Screen,
                           DrawContext,
@@ -774,54 +853,74 @@ GuiFlushScreen (
                           mDrawRequests[Index].Height,
                           DrawContext->Screen.Opacity
                           );
+    mDamageStats.DrawnPixels += (UINT64)mDrawRequests[Index].Width * mDrawRequests[Index].Height;
   }
 
-  EndTsc   = AsmReadTsc ();
-  DeltaTsc = EndTsc - mStartTsc;
+  EndTsc                = AsmReadTsc ();
+  mDamageStats.WorkTsc += EndTsc - WorkStartTsc;
+  DeltaTsc              = EndTsc - mStartTsc;
   if (DeltaTsc < mDeltaTscTarget) {
     EndTsc = InternalCpuDelayTsc (mDeltaTscTarget - DeltaTsc);
   }
 
+  WorkStartTsc = AsmReadTsc ();
+
   if (mPointerContext != NULL) {
     GuiOverlayPointer (DrawContext);
   }
 
   //
-  // FIXME: Reversing the blit order here has several benefits, due to the implicit
-  // old-before-new ordering which has been used when making the draw requests. The whole
-  // screen is updated in the memory buffer (by redrawing just the changing parts), then
-  // these parts are transferred one by one to the video memory.
-  // Due to lack of vsync in UEFI, any point through this transfer can be visible on screen.
-  // Reversing the blit order means:
-  //  - Combined old+new mouse pointer area can no longer show part of moving text one frame
-  //    ahead of the rest (see REF); moving text may instead 'tear' mouse, but this is
-  //    much less visible
-  //  - If mouse pointer is moving fast (old+new area is not merged), new pointer
-  //    is always added before old pointer is removed, avoiding mouse disappearing
-  //  - (A similar logic to the preceding should apply e.g. to the moving OS selector too)
-  // So reversing here gives a 'free' small but visible improvement in the display, given the
-  // current draw order; but a better full fix would be to specify explicit ordering
-  // requirements with each draw request, which would allow the best blit order to get this
-  // same improvement to be calculated independently of the order in which requests are added.
+  // Transfer the tiles only touched by the new cursor before the redrawn
+  // tiles, which include the restored area of the old cursor. Due to lack of
+  // vsync in UEFI, any point through this transfer can be visible on screen.
+  // This order means:
+  //  - If mouse pointer is moving fast, new pointer is always added before
+  //    old pointer is removed, avoiding mouse disappearing
+  //  - Pointer tiles which were also redrawn (e.g. when the old and new
+  //    pointer areas overlap) are transferred together with the redrawn area,
+  //    so moving text cannot show one frame ahead of the rest (see REF)
   // REF: https://github.com/acidanthera/bugtracker/issues/1852
   //
-  for (Index = 0; Index < mNumValidDrawReqs; ++Index) {
-    ReverseIndex = mNumValidDrawReqs - Index - 1;
+  for (Index = 0; Index < (UINTN)mDamageRows * mDamageRowWords; ++Index) {
+    mDamageTiles[Index] &= ~mFlushTiles[Index];
+  }
+
+  NumRects = GuiDamageCollect (mDamageTiles);
+  for (Index = 0; Index < NumRects; ++Index) {
     GuiOutputBlt (
       mOutputContext,
       mScreenBuffer,
       EfiBltBufferToVideo,
-      mDrawRequests[ReverseIndex].X,
-      mDrawRequests[ReverseIndex].Y,
-      mDrawRequests[ReverseIndex].X,
-      mDrawRequests[ReverseIndex].Y,
-      mDrawRequests[ReverseIndex].Width,
-      mDrawRequests[ReverseIndex].Height,
+      mDrawRequests[Index].X,
+      mDrawRequests[Index].Y,
+      mDrawRequests[Index].X,
+      mDrawRequests[Index].Y,
+      mDrawRequests[Index].Width,
+      mDrawRequests[Index].Height,
       mScreenBufferDelta
       );
+    mDamageStats.BlitPixels += (UINT64)mDrawRequests[Index].Width * mDrawRequests[Index].Height;
   }
 
-  mNumValidDrawReqs = 0;
+  NumRects = GuiDamageCollect (mFlushTiles);
+  for (Index = 0; Index < NumRects; ++Index) {
+    GuiOutputBlt (
+      mOutputContext,
+      mScreenBuffer,
+      EfiBltBufferToVideo,
+      mDrawRequests[Index].X,
+      mDrawRequests[Index].Y,
+      mDrawRequests[Index].X,
+      mDrawRequests[Index].Y,
+      mDrawRequests[Index].Width,
+      mDrawRequests[Index].Height,
+      mScreenBufferDelta
+      );
+    mDamageStats.BlitPixels += (UINT64)mDrawRequests[Index].Width * mDrawRequests[Index].Height;
+  }
+
+  ++mDamageStats.Frames;
+  mDamageStats.WorkTsc += AsmReadTsc () - WorkStartTsc;
   //
   // Explicitly include BLT time in the timing calculation.
   // FIXME: GOP takes inconsistently long depending on dimensions.
@@ -907,6 +1006,30 @@ GuiLibConstruct (
     return EFI_OUT_OF_RESOURCES;
   }
 
+  mDamageWidth    = OutputInfo->HorizontalResolution;
+  mDamageHeight   = OutputInfo->VerticalResolution;
+  mDamageCols     = (mDamageWidth + GUI_DAMAGE_TILE_SIZE - 1) >> GUI_DAMAGE_TILE_SHIFT;
+  mDamageRows     = (mDamageHeight + GUI_DAMAGE_TILE_SIZE - 1) >> GUI_DAMAGE_TILE_SHIFT;
+  mDamageRowWords = (mDamageCols + 31) / 32;
+  //
+  // Every rectangle starts with a span, and a row holds at most every other
+  // tile as the first tile of a span.
+  //
+  mDamageMaxRuns = (mDamageCols + 1) / 2;
+  mDamageTiles   = AllocateZeroPool (mDamageRows * mDamageRowWords * sizeof (*mDamageTiles));
+  mFlushTiles    = AllocateZeroPool (mDamageRows * mDamageRowWords * sizeof (*mFlushTiles));
+  mDamageOpen    = AllocatePool (2 * mDamageMaxRuns * sizeof (*mDamageOpen));
+  mDrawRequests  = AllocatePool (mDamageRows * mDamageMaxRuns * sizeof (*mDrawRequests));
+  if (  (mDamageTiles == NULL)
+     || (mFlushTiles == NULL)
+     || (mDamageOpen == NULL)
+     || (mDrawRequests == NULL))
+  {
+    DEBUG ((DEBUG_WARN, "OCUI: GUI alloc failure\n"));
+    GuiLibDestruct ();
+    return EFI_OUT_OF_RESOURCES;
+  }
+
   MtrrSetMemoryAttribute (
     (EFI_PHYSICAL_ADDRESS)(UINTN)mScreenBuffer,
     mScreenBufferDelta * OutputInfo->VerticalResolution,
@@ -937,6 +1060,26 @@ GuiLibDestruct (
     GuiKeyDestruct (mKeyContext);
     mKeyContext = NULL;
   }
+
+  if (mDamageTiles != NULL) {
+    FreePool (mDamageTiles);
+    mDamageTiles = NULL;
+  }
+
+  if (mFlushTiles != NULL) {
+    FreePool (mFlushTiles);
+    mFlushTiles = NULL;
+  }
+
+  if (mDamageOpen != NULL) {
+    FreePool (mDamageOpen);
+    mDamageOpen = NULL;
+  }
+
+  if (mDrawRequests != NULL) {
+    FreePool (mDrawRequests);
+    mDrawRequests = NULL;
+  }
 }
 
 VOID
@@ -1072,7 +1215,8 @@ GuiDrawLoop (
 
   ASSERT (DrawContext != NULL);
 
-  mNumValidDrawReqs      = 0;
+  ZeroMem (mDamageTiles, mDamageRows * mDamageRowWords * sizeof (*mDamageTiles));
+  ZeroMem (&mDamageStats, sizeof (mDamageStats));
   DrawContext->FrameTime = 0;
   HoldObject             = NULL;
   //
@@ -1357,6 +1501,23 @@ GuiDrawLoop (
 
     LastTsc = NewLastTsc;
   } while (!DrawContext->ExitLoop (DrawContext, DrawContext->GuiContext));
+
+  //
+  // Report the damage tracking savings, frame time excludes the frame delay.
+  //
+  DEBUG ((
+    DEBUG_INFO,
+    "OCUI: %Lu frames, %Lu px requested, %Lu px drawn, %Lu px blitted, %Lu us/frame\n",
+    mDamageStats.Frames,
+    mDamageStats.RequestedPixels,
+    mDamageStats.DrawnPixels,
+    mDamageStats.BlitPixels,
+    DivU64x64Remainder (
+      GetTimeInNanoSecond (mDamageStats.WorkTsc),
+      MultU64x32 (MAX (mDamageStats.Frames, 1), 1000),
+      NULL
+      )
+    ));
 }
 
 VOID
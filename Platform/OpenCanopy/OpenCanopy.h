@@ -337,6 +337,38 @@ GuiBlendPixelOpaque (
   IN     UINT8                                Opacity
   );
 
+/**
+  Blend a row of premultiplied pixels over a row of the background.
+  Fully transparent spans are skipped and fully opaque spans are copied.
+
+  @param[in,out] BackRow   Background pixels.
+  @param[in]     FrontRow  Premultiplied front pixels.
+  @param[in]     Length    Number of pixels in both rows.
+**/
+VOID
+GuiBlendRowSolid (
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL        *BackRow,
+  IN     CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *FrontRow,
+  IN     UINT32                               Length
+  );
+
+/**
+  Blend a row of premultiplied pixels with a global opacity over a row of
+  the background. Fully transparent pixels are skipped.
+
+  @param[in,out] BackRow   Background pixels.
+  @param[in]     FrontRow  Premultiplied front pixels.
+  @param[in]     Length    Number of pixels in both rows.
+  @param[in]     Opacity   Global opacity, neither 0 nor 0xFF.
+**/
+VOID
+GuiBlendRowOpaque (
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL        *BackRow,
+  IN     CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *FrontRow,
+  IN     UINT32                               Length,
+  IN     UINT8                                Opacity
+  );
+
 EFI_STATUS
 GuiCreateHighlightedImage (
   OUT GUI_IMAGE                            *SelectedImage,
@@ -11,32 +11,6 @@
 
 UINT64  mUnitSize;
 
-STATIC
-UINT64
-GetLcn (
-  IN OUT RUNLIST  *Runlist,
-  IN     UINT64   Vcn
-  )
-{
-  EFI_STATUS  Status;
-  UINT64      Delta;
-
-  ASSERT (Runlist != NULL);
-
-  if (Vcn >= Runlist->NextVcn) {
-    Status = ReadRunListElement (Runlist);
-    if (EFI_ERROR (Status)) {
-      return (UINT64)(-1);
-    }
-
-    return Runlist->CurrentLcn;
-  }
-
-  Delta = Vcn - Runlist->CurrentVcn;
-
-  return Runlist->IsSparse ? 0 : (Runlist->CurrentLcn + Delta);
-}
-
 STATIC
 EFI_STATUS
 ReadClusters (
@@ -49,63 +23,73 @@ ReadClusters (
   EFI_STATUS  Status;
   UINT64      Index;
   UINT64      ClustersTotal;
-  UINT64      Cluster;
+  UINT64      RunEnd;
   UINT64      OffsetInsideCluster;
-  UINTN       Size;
+  UINT64      LastClusterSize;
+  UINT64      Size;
+  UINT64      Remaining;
   UINTN       ClusterSize;
 
   ASSERT (Runlist != NULL);
   ASSERT (Dest != NULL);
 
+  Remaining           = Length;
   ClusterSize         = Runlist->Unit.FileSystem->ClusterSize;
   OffsetInsideCluster = Offset & (ClusterSize - 1U);
-  Size                = ClusterSize;
   ClustersTotal       = DivU64x64Remainder (Length + Offset + ClusterSize - 1U, ClusterSize, NULL);
+  LastClusterSize     = (Length + Offset) & (ClusterSize - 1U);
+  if (LastClusterSize == 0) {
+    LastClusterSize = ClusterSize;
+  }
 
-  for (Index = Runlist->TargetVcn; Index < ClustersTotal; ++Index) {
-    Cluster = GetLcn (Runlist, Index);
-    if (Cluster == (UINT64)(-1)) {
-      return EFI_DEVICE_ERROR;
+  //
+  // Every Data Run is contiguous on disk, so the clusters it shares with
+  // the requested range are read at once.
+  //
+  Index = Runlist->TargetVcn;
+  while (Index < ClustersTotal) {
+    if (Index >= Runlist->NextVcn) {
+      Status = ReadRunListElement (Runlist);
+      if (EFI_ERROR (Status)) {
+        return EFI_DEVICE_ERROR;
+      }
     }
 
-    Cluster *= ClusterSize;
-
-    if (Index == (ClustersTotal - 1U)) {
-      Size = (UINTN)((Length + Offset) & (ClusterSize - 1U));
-
-      if (Size == 0) {
-        Size = ClusterSize;
-      }
+    RunEnd = MIN (Runlist->NextVcn, ClustersTotal);
+    Size   = (RunEnd - Index) * ClusterSize;
 
-      if (Index != Runlist->TargetVcn) {
-        OffsetInsideCluster = 0;
-      }
+    if (Index != Runlist->TargetVcn) {
+      OffsetInsideCluster = 0;
     }
 
-    if (Index == Runlist->TargetVcn) {
-      Size -= (UINTN)OffsetInsideCluster;
+    Size -= OffsetInsideCluster;
+
+    if (RunEnd == ClustersTotal) {
+      Size -= ClusterSize - LastClusterSize;
     }
 
-    if ((Index != Runlist->TargetVcn) && (Index != (ClustersTotal - 1U))) {
-      Size                = ClusterSize;
-      OffsetInsideCluster = 0;
+    if (Size > Remaining) {
+      DEBUG ((DEBUG_INFO, "NTFS: Read out of requested range\n"));
+      return EFI_VOLUME_CORRUPTED;
     }
 
-    if (Cluster != 0) {
+    if (!Runlist->IsSparse) {
       Status = DiskRead (
                  Runlist->Unit.FileSystem,
-                 Cluster + OffsetInsideCluster,
-                 Size,
+                 (Runlist->CurrentLcn + Index - Runlist->CurrentVcn) * ClusterSize + OffsetInsideCluster,
+                 (UINTN)Size,
                  Dest
                  );
       if (EFI_ERROR (Status)) {
         return Status;
       }
     } else {
-      SetMem (Dest, Size, 0);
+      SetMem (Dest, (UINTN)Size, 0);
     }
 
-    Dest += Size;
+    Dest      += Size;
+    Remaining -= Size;
+    Index      = RunEnd;
   }
 
   return EFI_SUCCESS;
@@ -143,6 +127,102 @@ DiskRead (
   return Status;
 }
 
+/**
+  Copy cached FILE Record.
+
+  @param[in]  FileSystem    File system the record belongs to.
+  @param[in]  RecordNumber  FILE Record number.
+  @param[out] Buffer        Buffer of FileRecordSize bytes.
+
+  @retval TRUE if the record was cached.
+**/
+STATIC
+BOOLEAN
+LookupMftCache (
+  IN  EFI_FS  *FileSystem,
+  IN  UINT64  RecordNumber,
+  OUT UINT8   *Buffer
+  )
+{
+  MFT_CACHE_ENTRY  *Entry;
+  UINTN            Index;
+
+  if (FileSystem->MftCache == NULL) {
+    return FALSE;
+  }
+
+  for (Index = 0; Index < NTFS_MFT_CACHE_SIZE; ++Index) {
+    Entry = &FileSystem->MftCache[Index];
+    if ((Entry->LastAccess != 0) && (Entry->RecordNumber == RecordNumber)) {
+      Entry->LastAccess = ++FileSystem->MftCacheAccess;
+      CopyMem (Buffer, Entry->Record, FileSystem->FileRecordSize);
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Save fixed up FILE Record in place of the least recently used one.
+  The cache is allocated on first use.
+
+  @param[in] FileSystem    File system the record belongs to.
+  @param[in] RecordNumber  FILE Record number.
+  @param[in] Buffer        Buffer of FileRecordSize bytes.
+**/
+STATIC
+VOID
+InsertMftCache (
+  IN EFI_FS       *FileSystem,
+  IN UINT64       RecordNumber,
+  IN CONST UINT8  *Buffer
+  )
+{
+  MFT_CACHE_ENTRY  *Entry;
+  MFT_CACHE_ENTRY  *Victim;
+  UINT8            *Records;
+  UINTN            Index;
+
+  if (FileSystem->MftCache == NULL) {
+    FileSystem->MftCache = AllocateZeroPool (NTFS_MFT_CACHE_SIZE * sizeof (MFT_CACHE_ENTRY));
+    if (FileSystem->MftCache == NULL) {
+      return;
+    }
+
+    Records = AllocatePool (NTFS_MFT_CACHE_SIZE * FileSystem->FileRecordSize);
+    if (Records == NULL) {
+      FreePool (FileSystem->MftCache);
+      FileSystem->MftCache = NULL;
+      return;
+    }
+
+    for (Index = 0; Index < NTFS_MFT_CACHE_SIZE; ++Index) {
+      FileSystem->MftCache[Index].Record = Records + Index * FileSystem->FileRecordSize;
+    }
+  }
+
+  //
+  // Reading a record with $ATTRIBUTE_LIST may have cached it already.
+  //
+  Victim = &FileSystem->MftCache[0];
+  for (Index = 0; Index < NTFS_MFT_CACHE_SIZE; ++Index) {
+    Entry = &FileSystem->MftCache[Index];
+    if ((Entry->LastAccess != 0) && (Entry->RecordNumber == RecordNumber)) {
+      Victim = Entry;
+      break;
+    }
+
+    if (Entry->LastAccess < Victim->LastAccess) {
+      Victim = Entry;
+    }
+  }
+
+  CopyMem (Victim->Record, Buffer, FileSystem->FileRecordSize);
+  Victim->RecordNumber = RecordNumber;
+  Victim->LastAccess   = ++FileSystem->MftCacheAccess;
+}
+
 EFI_STATUS
 EFIAPI
 ReadMftRecord (
@@ -152,12 +232,18 @@ ReadMftRecord (
   )
 {
   EFI_STATUS  Status;
+  EFI_FS      *FileSystem;
   UINTN       FileRecordSize;
 
   ASSERT (File != NULL);
   ASSERT (Buffer != NULL);
 
-  FileRecordSize = File->FileSystem->FileRecordSize;
+  FileSystem     = File->FileSystem;
+  FileRecordSize = FileSystem->FileRecordSize;
+
+  if (LookupMftCache (FileSystem, RecordNumber, Buffer)) {
+    return EFI_SUCCESS;
+  }
 
   Status = ReadAttr (
              &File->MftFile.Attr,
@@ -171,12 +257,33 @@ ReadMftRecord (
     return Status;
   }
 
-  return Fixup (
-           Buffer,
-           FileRecordSize,
-           SIGNATURE_32 ('F', 'I', 'L', 'E'),
-           File->FileSystem->SectorSize
-           );
+  Status = Fixup (
+             Buffer,
+             FileRecordSize,
+             SIGNATURE_32 ('F', 'I', 'L', 'E'),
+             FileSystem->SectorSize
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  InsertMftCache (FileSystem, RecordNumber, Buffer);
+
+  return EFI_SUCCESS;
+}
+
+VOID
+FreeMftCache (
+  IN EFI_FS  *FileSystem
+  )
+{
+  ASSERT (FileSystem != NULL);
+
+  if (FileSystem->MftCache != NULL) {
+    FreePool (FileSystem->MftCache[0].Record);
+    FreePool (FileSystem->MftCache);
+    FileSystem->MftCache = NULL;
+  }
 }
 
 EFI_STATUS
@@ -11,6 +11,7 @@
 
 #define NTFS_MAX_MFT            4096
 #define NTFS_MAX_IDX            16384
+#define NTFS_MFT_CACHE_SIZE     64
 #define COMPRESSION_BLOCK       4096
 #define NTFS_DRIVER_VERSION     0x00020000
 #define MAX_PATH                1024
@@ -636,6 +637,16 @@ typedef struct _EFI_NTFS_FILE {
   EFI_FS               *FileSystem;
 } EFI_NTFS_FILE;
 
+///
+/// Fixed up FILE Record kept in MFT Record cache.
+/// Unused entries have zero LastAccess.
+///
+typedef struct {
+  UINT64    RecordNumber;
+  UINT64    LastAccess;
+  UINT8     *Record;
+} MFT_CACHE_ENTRY;
+
 typedef struct _EFI_FS {
   EFI_SIMPLE_FILE_SYSTEM_PROTOCOL    FileIoInterface;
   EFI_FILE_PROTOCOL                  EfiFile;
@@ -649,6 +660,8 @@ typedef struct _EFI_FS {
   UINTN                              IndexRecordSize;
   UINTN                              SectorSize;
   UINTN                              ClusterSize;
+  MFT_CACHE_ENTRY                    *MftCache;
+  UINT64                             MftCacheAccess;
 } EFI_FS;
 
 typedef struct {
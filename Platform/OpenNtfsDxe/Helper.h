@@ -84,6 +84,11 @@ ReadMftRecord (
   IN  UINT64         RecordNumber
   );
 
+VOID
+FreeMftCache (
+  IN EFI_FS  *FileSystem
+  );
+
 EFI_STATUS
 EFIAPI
 ReadAttr (
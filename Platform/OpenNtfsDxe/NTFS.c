@@ -282,6 +282,7 @@ NTFSStart (
   Status = NtfsMount (Instance);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_INFO, "NTFS: Could not mount file system.\n"));
+    FreeMftCache (Instance);
     FreePool (Instance);
     return Status;
   }
@@ -306,6 +307,7 @@ NTFSStart (
     FreePool (Instance->RootIndex->FileRecord);
     FreePool (Instance->MftStart->FileRecord);
     FreePool (Instance->RootIndex->File);
+    FreeMftCache (Instance);
 
     FreePool (Instance);
     return EFI_UNSUPPORTED;
@@ -373,6 +375,7 @@ NTFSStop (
   FreePool (Instance->RootIndex->FileRecord);
   FreePool (Instance->MftStart->FileRecord);
   FreePool (Instance->RootIndex->File);
+  FreeMftCache (Instance);
 
   return EFI_SUCCESS;
 }
@@ -42,8 +42,6 @@
 
 static void fsw_blockcache_free(struct fsw_volume *vol);
 
-#define MAX_CACHE_LEVEL (5)
-
 
 /**
  * Mount a volume with a given file system driver. This function is called by the
@@ -80,6 +78,7 @@ fsw_status_t fsw_mount(void *host_data,
     vol->host_table     = host_table;
     vol->fstype_table   = fstype_table;
     vol->host_string_type = host_table->native_string_type;
+    fsw_blockcache_free(vol);
     
     // let the fs driver mount the file system
     status = vol->fstype_table->volume_mount(vol);
@@ -112,6 +111,8 @@ void fsw_unmount(struct fsw_volume *vol)
     
     vol->fstype_table->volume_free(vol);
     
+    FSW_MSG_DEBUG((FSW_MSGSTR("fsw_unmount: block cache %d hits, %d misses, %d blocks read ahead\n"),
+                   vol->bcache_hits, vol->bcache_misses, vol->bcache_readahead));
     fsw_blockcache_free(vol);
     fsw_strfree(&vol->label);
     fsw_free(vol);
@@ -159,6 +160,181 @@ void fsw_set_blocksize(struct fsw_volume *vol, fsw_u32 phys_blocksize, fsw_u32 l
     vol->log_blocksize = log_blocksize;
 }
 
+/**
+ * Find a block in the block cache. Returns the index of its entry or FSW_BCACHE_NONE.
+ */
+
+static fsw_u32 fsw_blockcache_lookup(struct fsw_volume *vol, fsw_u32 phys_bno)
+{
+    fsw_u32 i;
+    
+    for (i = vol->bcache_hash[phys_bno & (FSW_BCACHE_HASH_SIZE - 1)]; i != FSW_BCACHE_NONE; i = vol->bcache[i].hash_next) {
+        if (vol->bcache[i].phys_bno == phys_bno)
+            return i;
+    }
+    return FSW_BCACHE_NONE;
+}
+
+/**
+ * Insert an unreferenced block cache entry as the most recently used one of its cache level.
+ */
+
+static void fsw_blockcache_lru_insert(struct fsw_volume *vol, fsw_u32 i)
+{
+    struct fsw_blockcache *entry = &vol->bcache[i];
+    
+    entry->lru_prev = FSW_BCACHE_NONE;
+    entry->lru_next = vol->bcache_lru_head[entry->cache_level];
+    if (entry->lru_next != FSW_BCACHE_NONE)
+        vol->bcache[entry->lru_next].lru_prev = i;
+    else
+        vol->bcache_lru_tail[entry->cache_level] = i;
+    vol->bcache_lru_head[entry->cache_level] = i;
+}
+
+/**
+ * Remove a block cache entry from the LRU list of its cache level, e.g. when it gets referenced.
+ */
+
+static void fsw_blockcache_lru_remove(struct fsw_volume *vol, fsw_u32 i)
+{
+    struct fsw_blockcache *entry = &vol->bcache[i];
+    
+    if (entry->lru_prev != FSW_BCACHE_NONE)
+        vol->bcache[entry->lru_prev].lru_next = entry->lru_next;
+    else
+        vol->bcache_lru_head[entry->cache_level] = entry->lru_next;
+    if (entry->lru_next != FSW_BCACHE_NONE)
+        vol->bcache[entry->lru_next].lru_prev = entry->lru_prev;
+    else
+        vol->bcache_lru_tail[entry->cache_level] = entry->lru_prev;
+}
+
+/**
+ * Remove a block cache entry from its hash chain.
+ */
+
+static void fsw_blockcache_hash_remove(struct fsw_volume *vol, fsw_u32 i)
+{
+    fsw_u32 *link;
+    
+    link = &vol->bcache_hash[vol->bcache[i].phys_bno & (FSW_BCACHE_HASH_SIZE - 1)];
+    while (*link != i)
+        link = &vol->bcache[*link].hash_next;
+    *link = vol->bcache[i].hash_next;
+}
+
+/**
+ * Return an unused block cache entry to the free list.
+ */
+
+static void fsw_blockcache_release_entry(struct fsw_volume *vol, fsw_u32 i)
+{
+    vol->bcache[i].phys_bno = FSW_INVALID_BNO;
+    vol->bcache[i].refcount = 0;
+    vol->bcache[i].hash_next = vol->bcache_free;
+    vol->bcache_free = i;
+}
+
+/**
+ * Enlarge the block cache array. New entries are put on the free list.
+ */
+
+static fsw_status_t fsw_blockcache_grow(struct fsw_volume *vol)
+{
+    fsw_status_t    status;
+    fsw_u32         i, new_bcache_size;
+    struct fsw_blockcache *new_bcache;
+    
+    if (vol->bcache_size < 16)
+        new_bcache_size = 16;
+    else
+        new_bcache_size = vol->bcache_size << 1;
+    status = fsw_alloc(new_bcache_size * sizeof(struct fsw_blockcache), &new_bcache);
+    if (status)
+        return status;
+    if (vol->bcache_size > 0)
+        fsw_memcpy(new_bcache, vol->bcache, vol->bcache_size * sizeof(struct fsw_blockcache));
+    for (i = vol->bcache_size; i < new_bcache_size; i++) {
+        new_bcache[i].cache_level = 0;
+        new_bcache[i].lru_prev = FSW_BCACHE_NONE;
+        new_bcache[i].lru_next = FSW_BCACHE_NONE;
+        new_bcache[i].data = NULL;
+    }
+    
+    // switch caches
+    if (vol->bcache != NULL)
+        fsw_free(vol->bcache);
+    vol->bcache = new_bcache;
+    
+    for (i = new_bcache_size; i > vol->bcache_size; i--)
+        fsw_blockcache_release_entry(vol, i - 1);
+    vol->bcache_size = new_bcache_size;
+    return FSW_SUCCESS;
+}
+
+/**
+ * Get an unused block cache entry with a data buffer. The cache grows up to
+ * FSW_BCACHE_SIZE entries, then the least recently used unreferenced block of the
+ * lowest cache level is purged. If all blocks are referenced, the cache grows further.
+ */
+
+static fsw_status_t fsw_blockcache_alloc(struct fsw_volume *vol, fsw_u32 *index_out)
+{
+    fsw_status_t    status;
+    fsw_u32         i, discard_level;
+    
+    i = FSW_BCACHE_NONE;
+    if (vol->bcache_free == FSW_BCACHE_NONE && vol->bcache_size >= FSW_BCACHE_SIZE) {
+        for (discard_level = 0; discard_level <= FSW_MAX_CACHE_LEVEL; discard_level++) {
+            i = vol->bcache_lru_tail[discard_level];
+            if (i != FSW_BCACHE_NONE) {
+                fsw_blockcache_lru_remove(vol, i);
+                fsw_blockcache_hash_remove(vol, i);
+                vol->bcache[i].phys_bno = FSW_INVALID_BNO;
+                break;
+            }
+        }
+    }
+    if (i == FSW_BCACHE_NONE) {
+        if (vol->bcache_free == FSW_BCACHE_NONE) {
+            status = fsw_blockcache_grow(vol);
+            if (status)
+                return status;
+        }
+        i = vol->bcache_free;
+        vol->bcache_free = vol->bcache[i].hash_next;
+    }
+    
+    if (vol->bcache[i].data == NULL) {
+        status = fsw_alloc(vol->phys_blocksize, &vol->bcache[i].data);
+        if (status) {
+            fsw_blockcache_release_entry(vol, i);
+            return status;
+        }
+    }
+    
+    *index_out = i;
+    return FSW_SUCCESS;
+}
+
+/**
+ * Add a block read from the disk to the block cache.
+ */
+
+static void fsw_blockcache_insert(struct fsw_volume *vol, fsw_u32 i, fsw_u32 phys_bno, fsw_u32 cache_level, fsw_u32 refcount)
+{
+    fsw_u32 bucket = phys_bno & (FSW_BCACHE_HASH_SIZE - 1);
+    
+    vol->bcache[i].phys_bno = phys_bno;
+    vol->bcache[i].cache_level = cache_level;
+    vol->bcache[i].refcount = refcount;
+    vol->bcache[i].hash_next = vol->bcache_hash[bucket];
+    vol->bcache_hash[bucket] = i;
+    if (refcount == 0)
+        fsw_blockcache_lru_insert(vol, i);
+}
+
 /**
  * Get a block of data from the disk. This function is called by the file system driver
  * or by core functions. It calls through to the host driver's device access routine.
@@ -179,82 +355,42 @@ void fsw_set_blocksize(struct fsw_volume *vol, fsw_u32 phys_blocksize, fsw_u32 l
 fsw_status_t fsw_block_get(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, fsw_u32 cache_level, void **buffer_out)
 {
     fsw_status_t    status;
-    fsw_u32         i, discard_level, new_bcache_size;
-    struct fsw_blockcache *new_bcache;
+    fsw_u32         i;
     
     // TODO: allow the host driver to do its own caching; just call through if
     //  the appropriate function pointers are set
     
-    if (cache_level > MAX_CACHE_LEVEL)
-        cache_level = MAX_CACHE_LEVEL;
+    if (cache_level > FSW_MAX_CACHE_LEVEL)
+        cache_level = FSW_MAX_CACHE_LEVEL;
     
     // check block cache
-    for (i = 0; i < vol->bcache_size; i++) {
-        if (vol->bcache[i].phys_bno == phys_bno) {
-            // cache hit!
-            if (vol->bcache[i].cache_level < cache_level)
-                vol->bcache[i].cache_level = cache_level;  // promote the entry
-            vol->bcache[i].refcount++;
-            *buffer_out = vol->bcache[i].data;
-            return FSW_SUCCESS;
-        }
+    i = fsw_blockcache_lookup(vol, phys_bno);
+    if (i != FSW_BCACHE_NONE) {
+        // cache hit!
+        if (vol->bcache[i].refcount == 0)
+            fsw_blockcache_lru_remove(vol, i);
+        if (vol->bcache[i].cache_level < cache_level)
+            vol->bcache[i].cache_level = cache_level;  // promote the entry
+        vol->bcache[i].refcount++;
+        vol->bcache_hits++;
+        *buffer_out = vol->bcache[i].data;
+        return FSW_SUCCESS;
     }
     
-    // find a free entry in the cache table
-    for (i = 0; i < vol->bcache_size; i++) {
-        if (vol->bcache[i].phys_bno == FSW_INVALID_BNO)
-            break;
-    }
-    if (i >= vol->bcache_size) {
-        for (discard_level = 0; discard_level <= MAX_CACHE_LEVEL; discard_level++) {
-            for (i = 0; i < vol->bcache_size; i++) {
-                if (vol->bcache[i].refcount == 0 && vol->bcache[i].cache_level <= discard_level)
-                    break;
-            }
-            if (i < vol->bcache_size)
-                break;
-        }
-    }
-    if (i >= vol->bcache_size) {
-        // enlarge / create the cache
-        if (vol->bcache_size < 16)
-            new_bcache_size = 16;
-        else
-            new_bcache_size = vol->bcache_size << 1;
-        status = fsw_alloc(new_bcache_size * sizeof(struct fsw_blockcache), &new_bcache);
-        if (status)
-            return status;
-        if (vol->bcache_size > 0)
-            fsw_memcpy(new_bcache, vol->bcache, vol->bcache_size * sizeof(struct fsw_blockcache));
-        for (i = vol->bcache_size; i < new_bcache_size; i++) {
-            new_bcache[i].refcount = 0;
-            new_bcache[i].cache_level = 0;
-            new_bcache[i].phys_bno = FSW_INVALID_BNO;
-            new_bcache[i].data = NULL;
-        }
-        i = vol->bcache_size;
-        
-        // switch caches
-        if (vol->bcache != NULL)
-            fsw_free(vol->bcache);
-        vol->bcache = new_bcache;
-        vol->bcache_size = new_bcache_size;
-    }
-    vol->bcache[i].phys_bno = FSW_INVALID_BNO;
+    // get a free entry in the cache table
+    status = fsw_blockcache_alloc(vol, &i);
+    if (status)
+        return status;
     
     // read the data
-    if (vol->bcache[i].data == NULL) {
-        status = fsw_alloc(vol->phys_blocksize, &vol->bcache[i].data);
-        if (status)
-            return status;
-    }
     status = vol->host_table->read_block(vol, phys_bno, vol->bcache[i].data);
-    if (status)
+    if (status) {
+        fsw_blockcache_release_entry(vol, i);
         return status;
+    }
     
-    vol->bcache[i].phys_bno = phys_bno;
-    vol->bcache[i].cache_level = cache_level;
-    vol->bcache[i].refcount = 1;
+    fsw_blockcache_insert(vol, i, phys_bno, cache_level, 1);
+    vol->bcache_misses++;
     *buffer_out = vol->bcache[i].data;
     return FSW_SUCCESS;
 }
@@ -272,15 +408,72 @@ void fsw_block_release(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, void *buffer
     //  the appropriate function pointers are set
     
     // update block cache
-    for (i = 0; i < vol->bcache_size; i++) {
-        if (vol->bcache[i].phys_bno == phys_bno && vol->bcache[i].refcount > 0)
-            vol->bcache[i].refcount--;
+    i = fsw_blockcache_lookup(vol, phys_bno);
+    if (i != FSW_BCACHE_NONE && vol->bcache[i].refcount > 0) {
+        vol->bcache[i].refcount--;
+        if (vol->bcache[i].refcount == 0)
+            fsw_blockcache_lru_insert(vol, i);
+    }
+}
+
+/**
+ * Read consecutive disk blocks into the block cache ahead of fsw_block_get calls.
+ * The caller passes the number of blocks it is about to get in count, and the number
+ * of consecutive blocks that belong to the same extent in max_count. When phys_bno
+ * follows the previous read-ahead or cache miss, up to FSW_READAHEAD_BLOCKS more blocks
+ * of the extent are read as well. Nothing is done if phys_bno is cached already, and
+ * errors are ignored, leaving them to be reported by fsw_block_get.
+ */
+
+void fsw_block_readahead(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, fsw_u32 count, fsw_u32 max_count, fsw_u32 cache_level)
+{
+    fsw_status_t    status;
+    fsw_u32         i, run, index;
+    fsw_u8          *buffer;
+    
+    if (vol->host_table->read_blocks == NULL || fsw_blockcache_lookup(vol, phys_bno) != FSW_BCACHE_NONE)
+        return;
+    
+    if (cache_level > FSW_MAX_CACHE_LEVEL)
+        cache_level = FSW_MAX_CACHE_LEVEL;
+    
+    // extend sequential reads
+    if (phys_bno == vol->bcache_ra_next)
+        count += FSW_READAHEAD_BLOCKS;
+    if (count > max_count)
+        count = max_count;
+    if (count > FSW_READAHEAD_MAX)
+        count = FSW_READAHEAD_MAX;
+    
+    // stop at the first cached block
+    for (run = 1; run < count; run++) {
+        if (phys_bno + run < phys_bno || fsw_blockcache_lookup(vol, phys_bno + run) != FSW_BCACHE_NONE)
+            break;
+    }
+    if (run < 2) {
+        vol->bcache_ra_next = phys_bno + 1;
+        return;
+    }
+    
+    if (fsw_alloc(run * vol->phys_blocksize, &buffer))
+        return;
+    status = vol->host_table->read_blocks(vol, phys_bno, run, buffer);
+    if (status == FSW_SUCCESS) {
+        for (i = 0; i < run; i++) {
+            if (fsw_blockcache_alloc(vol, &index))
+                break;
+            fsw_memcpy(vol->bcache[index].data, buffer + i * vol->phys_blocksize, vol->phys_blocksize);
+            fsw_blockcache_insert(vol, index, phys_bno + i, cache_level, 0);
+        }
+        vol->bcache_readahead += i;
+        vol->bcache_ra_next = phys_bno + run;
     }
+    fsw_free(buffer);
 }
 
 /**
- * Release the block cache. Called internally when changing block sizes and when
- * unmounting the volume. It frees all data occupied by the generic block cache.
+ * Release the block cache. Called internally when mounting, when changing block sizes
+ * and when unmounting the volume. It frees all data occupied by the generic block cache.
  */
 
 static void fsw_blockcache_free(struct fsw_volume *vol)
@@ -296,6 +489,14 @@ static void fsw_blockcache_free(struct fsw_volume *vol)
         vol->bcache = NULL;
     }
     vol->bcache_size = 0;
+    for (i = 0; i < FSW_BCACHE_HASH_SIZE; i++)
+        vol->bcache_hash[i] = FSW_BCACHE_NONE;
+    for (i = 0; i <= FSW_MAX_CACHE_LEVEL; i++) {
+        vol->bcache_lru_head[i] = FSW_BCACHE_NONE;
+        vol->bcache_lru_tail[i] = FSW_BCACHE_NONE;
+    }
+    vol->bcache_free = FSW_BCACHE_NONE;
+    vol->bcache_ra_next = FSW_INVALID_BNO;
 }
 
 /**
@@ -865,7 +1066,7 @@ fsw_status_t fsw_shandle_read(struct fsw_shandle *shand, fsw_u32 *buffer_size_in
     fsw_u8          *buffer, *block_buffer;
     fsw_u32         buflen, copylen, pos;
     fsw_u32         log_bno, pos_in_extent, phys_bno, pos_in_physblock;
-    fsw_u32         cache_level;
+    fsw_u32         cache_level, ra_count, ra_max;
     
     if (shand->pos >= dno->size) {   // already at EOF
         *buffer_size_inout = 0;
@@ -911,6 +1112,16 @@ fsw_status_t fsw_shandle_read(struct fsw_shandle *shand, fsw_u32 *buffer_size_in
             if (copylen > buflen)
                 copylen = buflen;
             
+            // read the blocks of the request in this extent at once
+            ra_max = shand->extent.log_count - pos_in_extent / vol->log_blocksize;
+            if (ra_max > FSW_READAHEAD_MAX)
+                ra_max = FSW_READAHEAD_MAX;
+            ra_max = ra_max * (vol->log_blocksize / vol->phys_blocksize)
+                - (pos_in_extent & (vol->log_blocksize - 1)) / vol->phys_blocksize;
+            ra_count = 1 + (buflen - copylen) / vol->phys_blocksize
+                + (((buflen - copylen) & (vol->phys_blocksize - 1)) != 0);
+            fsw_block_readahead(vol, phys_bno, ra_count, ra_max, cache_level);
+            
             // get one physical block
             status = fsw_block_get(vol, phys_bno, cache_level, (void **)&block_buffer);
             if (status)
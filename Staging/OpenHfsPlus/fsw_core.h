@@ -55,6 +55,19 @@
 /** Indicates that the block cache entry is empty. */
 #define FSW_INVALID_BNO (~0U)
 
+/** Highest block cache level, blocks with lower levels are purged first. */
+#define FSW_MAX_CACHE_LEVEL (5)
+/** Number of block cache entries kept before least recently used blocks are purged. */
+#define FSW_BCACHE_SIZE (256)
+/** Number of block cache hash buckets, must be a power of 2. */
+#define FSW_BCACHE_HASH_SIZE (256)
+/** Indicates the end of a block cache hash chain or LRU list. */
+#define FSW_BCACHE_NONE (~0U)
+/** Maximum number of blocks read from the disk at once. */
+#define FSW_READAHEAD_MAX (32)
+/** Number of blocks read ahead past the request when reading sequentially. */
+#define FSW_READAHEAD_BLOCKS (16)
+
 
 //
 // Byte-swapping macros
@@ -211,6 +224,9 @@ struct fsw_blockcache {
     fsw_u32     refcount;           //!< Reference count
     fsw_u32     cache_level;        //!< Level of importance of this block
     fsw_u32     phys_bno;           //!< Physical block number
+    fsw_u32     hash_next;          //!< Next entry in the hash chain or in the free list
+    fsw_u32     lru_prev;           //!< More recently used entry of the same cache level
+    fsw_u32     lru_next;           //!< Less recently used entry of the same cache level
     void        *data;              //!< Block data buffer
 };
 
@@ -229,6 +245,14 @@ struct fsw_volume {
     
     struct fsw_blockcache *bcache;  //!< Array of block cache entries
     fsw_u32     bcache_size;        //!< Number of entries in the block cache array
+    fsw_u32     bcache_hash[FSW_BCACHE_HASH_SIZE];  //!< Block cache hash chain heads
+    fsw_u32     bcache_lru_head[FSW_MAX_CACHE_LEVEL + 1];  //!< Most recently used unreferenced entries per level
+    fsw_u32     bcache_lru_tail[FSW_MAX_CACHE_LEVEL + 1];  //!< Least recently used unreferenced entries per level
+    fsw_u32     bcache_free;        //!< First unused block cache entry
+    fsw_u32     bcache_ra_next;     //!< Block following the last read-ahead or cache miss
+    fsw_u32     bcache_hits;        //!< Number of blocks found in the block cache
+    fsw_u32     bcache_misses;      //!< Number of blocks read on demand
+    fsw_u32     bcache_readahead;   //!< Number of blocks read ahead
     
     void        *host_data;         //!< Hook for a host-specific data structure
     struct fsw_host_table *host_table;      //!< Dispatch table for host-specific functions
@@ -350,6 +374,7 @@ struct fsw_host_table
                                      fsw_u32 old_phys_blocksize, fsw_u32 old_log_blocksize,
                                      fsw_u32 new_phys_blocksize, fsw_u32 new_log_blocksize);
     fsw_status_t (*read_block)(struct fsw_volume *vol, fsw_u32 phys_bno, void *buffer);
+    fsw_status_t (*read_blocks)(struct fsw_volume *vol, fsw_u32 phys_bno, fsw_u32 count, void *buffer);  //!< Optional, enables read-ahead
 };
 
 /**
@@ -398,6 +423,7 @@ fsw_status_t fsw_volume_stat(struct fsw_volume *vol, struct fsw_volume_stat *sb)
 void         fsw_set_blocksize(struct VOLSTRUCTNAME *vol, fsw_u32 phys_blocksize, fsw_u32 log_blocksize);
 fsw_status_t fsw_block_get(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, fsw_u32 cache_level, void **buffer_out);
 void         fsw_block_release(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, void *buffer);
+void         fsw_block_readahead(struct VOLSTRUCTNAME *vol, fsw_u32 phys_bno, fsw_u32 count, fsw_u32 max_count, fsw_u32 cache_level);
 
 /*@}*/
 
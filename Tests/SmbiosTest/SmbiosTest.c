@@ -41,6 +41,10 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #include <Protocol/SimpleTextInEx.h>
 #include <Protocol/SimpleFileSystem.h>
 
+#include <Guid/SmbiosTable.h>
+
+#include "../../Library/OcSmbiosLib/SmbiosInternal.h"
+
 STATIC GUID            SystemUUID = {
   0x5BC82C38, 0x4DB6, 0x4883, { 0x85, 0x2E, 0xE7, 0x8D, 0x78, 0x0A, 0x6F, 0xE6 }
 };
@@ -78,6 +82,82 @@ STATIC OC_SMBIOS_DATA  Data             = {
   .PlatformFeature        = &PlatformFeature
 };
 
+/**
+  Check original structure index against scanning lookups on host SMBIOS.
+
+  @retval EFI_SUCCESS when index lookups match scanning lookups.
+**/
+STATIC
+EFI_STATUS
+CheckStructureIndex (
+  VOID
+  )
+{
+  EFI_STATUS                      Status;
+  SMBIOS_TABLE_ENTRY_POINT        *Smbios;
+  SMBIOS_TABLE_3_0_ENTRY_POINT    *Smbios3;
+  OC_SMBIOS_STRUCTURE_INDEX       Index;
+  APPLE_SMBIOS_STRUCTURE_POINTER  SmbiosTable;
+  UINT32                          SmbiosTableSize;
+  UINT32                          Type;
+  UINT32                          TypeIndex;
+  UINT32                          Structures;
+  UINT16                          Count;
+
+  //
+  // Prefer legacy table like SmbiosLookupHost does.
+  //
+  Status = EfiGetSystemConfigurationTable (&gEfiSmbiosTableGuid, (VOID **)&Smbios);
+  if (!EFI_ERROR (Status) && (Smbios->TableAddress != 0)) {
+    SmbiosTable.Raw = (UINT8 *)(UINTN)Smbios->TableAddress;
+    SmbiosTableSize = Smbios->TableLength;
+  } else {
+    Status = EfiGetSystemConfigurationTable (&gEfiSmbios3TableGuid, (VOID **)&Smbios3);
+    if (EFI_ERROR (Status) || (Smbios3->TableAddress == 0)) {
+      Print (L"No host SMBIOS table\n");
+      return EFI_NOT_FOUND;
+    }
+
+    SmbiosTable.Raw = (UINT8 *)(UINTN)Smbios3->TableAddress;
+    SmbiosTableSize = Smbios3->TableMaximumSize;
+  }
+
+  Status = SmbiosBuildStructureIndex (SmbiosTable, SmbiosTableSize, &Index);
+  if (EFI_ERROR (Status)) {
+    Print (L"Failed to index SMBIOS structures - %r\n", Status);
+    return Status;
+  }
+
+  Structures = 0;
+
+  for (Type = 0; Type <= MAX_UINT8 && !EFI_ERROR (Status); ++Type) {
+    Count = SmbiosGetStructureCount (SmbiosTable, SmbiosTableSize, (SMBIOS_TYPE)Type);
+    if (Count != SmbiosGetIndexedStructureCount (&Index, (SMBIOS_TYPE)Type)) {
+      Print (L"Structure index count mismatch for type %u\n", Type);
+      Status = EFI_VOLUME_CORRUPTED;
+      break;
+    }
+
+    Structures += Count;
+
+    for (TypeIndex = 0; TypeIndex <= (UINT32)Count + 1 && TypeIndex <= MAX_UINT16; ++TypeIndex) {
+      if (  SmbiosGetStructureOfType (SmbiosTable, SmbiosTableSize, (SMBIOS_TYPE)Type, (UINT16)TypeIndex).Raw
+         != SmbiosGetIndexedStructureOfType (&Index, (SMBIOS_TYPE)Type, (UINT16)TypeIndex).Raw)
+      {
+        Print (L"Structure index mismatch for type %u index %u\n", Type, TypeIndex);
+        Status = EFI_VOLUME_CORRUPTED;
+        break;
+      }
+    }
+  }
+
+  SmbiosFreeStructureIndex (&Index);
+
+  Print (L"Structure index of %u bytes with %u structures - %r\n", SmbiosTableSize, Structures, Status);
+
+  return Status;
+}
+
 EFI_STATUS
 EFIAPI
 TestSmbios (
@@ -89,6 +169,8 @@ TestSmbios (
   OC_CPU_INFO      CpuInfo;
   OC_SMBIOS_TABLE  SmbiosTable;
 
+  CheckStructureIndex ();
+
   OcCpuScanProcessor (&CpuInfo);
   Status = OcSmbiosTablePrepare (&SmbiosTable);
   if (!EFI_ERROR (Status)) {
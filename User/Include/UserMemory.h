@@ -7,6 +7,10 @@
 #define USER_MEMORY_H
 
 extern UINTN  mPoolAllocations;
+//
+// Number of pool allocations made, not decremented on free.
+//
+extern UINTN  mPoolAllocationsTotal;
 extern UINTN  mPageAllocations;
 
 VOID
@@ -30,6 +30,7 @@ GLOBAL_REMOVE_IF_UNREFERENCED CONST EFI_MEMORY_TYPE  gPhaseDefaultCodeType = Efi
 STATIC UINTN  mPoolAllocationSizeLimit = BASE_512MB;
 
 GLOBAL_REMOVE_IF_UNREFERENCED UINTN  mPoolAllocations;
+GLOBAL_REMOVE_IF_UNREFERENCED UINTN  mPoolAllocationsTotal;
 GLOBAL_REMOVE_IF_UNREFERENCED UINTN  mPageAllocations;
 
 STATIC UINT64  mPoolAllocationMask = MAX_UINT64;
@@ -228,6 +229,7 @@ PhaseAllocatePool (
 
   if (Buffer != NULL) {
     ++mPoolAllocations;
+    ++mPoolAllocationsTotal;
   }
 
   return Buffer;
@@ -16,6 +16,11 @@
 #include <IndustryStandard/AcpiAml.h>
 #include <UserFile.h>
 
+#include <sys/time.h>
+
+#define BENCHMARK_MAX_PATHS   512U
+#define BENCHMARK_ITERATIONS  100U
+
 /**
   Prints description of error occured in the perser.
 
@@ -99,16 +104,179 @@ AcpiFindEntryInFile (
   return Status;
 }
 
+STATIC
+UINT64
+UserGetTimestampUs (
+  VOID
+  )
+{
+  struct timeval  Time;
+
+  gettimeofday (&Time, NULL);
+  return Time.tv_sec * 1000000ULL + Time.tv_usec;
+}
+
+STATIC
+BOOLEAN
+IsNameChar (
+  IN UINT8    Char,
+  IN BOOLEAN  Lead
+  )
+{
+  return ((Char >= 'A') && (Char <= 'Z'))
+         || (Char == '_')
+         || (!Lead && (Char >= '0') && (Char <= '9'));
+}
+
+/**
+  Compares namespace index lookups against parser lookups for every name
+  segment found in the table, as done by ACPI patches with Base set.
+  Each iteration builds a new index, since it is built once per table.
+
+  @param[in]  FileName    Path to file containing ACPI table.
+  @param[in]  Iterations  Number of times to look up every name.
+
+  @retval 0 when index and parser results match.
+**/
+STATIC
+int
+AcpiBenchmarkFile (
+  IN CONST CHAR8  *FileName,
+  IN UINT32       Iterations
+  )
+{
+  UINT8                    *Table;
+  UINT32                   TableLength;
+  CHAR8                    (*Paths)[5];
+  UINT32                   PathCount;
+  EFI_STATUS               *Statuses;
+  UINT32                   *Offsets;
+  OC_ACPI_NAMESPACE_INDEX  *Index;
+  EFI_STATUS               Status;
+  UINT32                   Offset;
+  UINT32                   Mismatches;
+  UINT32                   Iteration;
+  UINT32                   Path;
+  UINT32                   Walker;
+  UINT64                   StartTime;
+  UINT64                   ParserTime;
+  UINT64                   IndexTime;
+
+  Mismatches = MAX_UINT32;
+  Table      = UserReadFile (FileName, &TableLength);
+  Paths      = AllocatePool (BENCHMARK_MAX_PATHS * sizeof (*Paths));
+  Statuses   = AllocatePool (BENCHMARK_MAX_PATHS * sizeof (*Statuses));
+  Offsets    = AllocatePool (BENCHMARK_MAX_PATHS * sizeof (*Offsets));
+  if ((Table == NULL) || (TableLength <= sizeof (EFI_ACPI_DESCRIPTION_HEADER))) {
+    DEBUG ((DEBUG_ERROR, "No table in %a\n", FileName));
+    goto Exit;
+  }
+
+  if ((Paths == NULL) || (Statuses == NULL) || (Offsets == NULL)) {
+    DEBUG ((DEBUG_ERROR, "Benchmark allocation failure\n"));
+    goto Exit;
+  }
+
+  //
+  // Collect unique strings, which look like name segments.
+  //
+  PathCount = 0;
+  for (Walker = sizeof (EFI_ACPI_DESCRIPTION_HEADER); Walker + 4 <= TableLength && PathCount < BENCHMARK_MAX_PATHS; ++Walker) {
+    if (  !IsNameChar (Table[Walker], TRUE)
+       || !IsNameChar (Table[Walker + 1], FALSE)
+       || !IsNameChar (Table[Walker + 2], FALSE)
+       || !IsNameChar (Table[Walker + 3], FALSE))
+    {
+      continue;
+    }
+
+    CopyMem (Paths[PathCount], &Table[Walker], 4);
+    Paths[PathCount][4] = '\0';
+
+    for (Path = 0; Path < PathCount; ++Path) {
+      if (CompareMem (Paths[Path], Paths[PathCount], 4) == 0) {
+        break;
+      }
+    }
+
+    if (Path == PathCount) {
+      ++PathCount;
+    }
+  }
+
+  StartTime = UserGetTimestampUs ();
+  for (Iteration = 0; Iteration < Iterations; ++Iteration) {
+    for (Path = 0; Path < PathCount; ++Path) {
+      Offsets[Path]  = 0;
+      Statuses[Path] = AcpiFindEntryInMemory (Table, Paths[Path], 1, &Offsets[Path], TableLength);
+    }
+  }
+
+  ParserTime = MAX (UserGetTimestampUs () - StartTime, 1);
+
+  Mismatches = 0;
+  StartTime  = UserGetTimestampUs ();
+  for (Iteration = 0; Iteration < Iterations; ++Iteration) {
+    Index = NULL;
+    for (Path = 0; Path < PathCount; ++Path) {
+      Offset = 0;
+      Status = AcpiFindEntryInIndex (&Index, Table, Paths[Path], 1, &Offset, TableLength);
+      if ((Status != Statuses[Path]) || (Offset != Offsets[Path])) {
+        ++Mismatches;
+      }
+    }
+
+    if (Index != NULL) {
+      AcpiFreeNamespaceIndex (Index);
+    }
+  }
+
+  IndexTime = MAX (UserGetTimestampUs () - StartTime, 1);
+
+  DEBUG ((
+    DEBUG_ERROR,
+    "BENCH: %u names x %u: parser %Lu us, index %Lu us (%Lu.%02Lu x), %u mismatches\n",
+    PathCount,
+    Iterations,
+    ParserTime,
+    IndexTime,
+    ParserTime / IndexTime,
+    (ParserTime * 100 / IndexTime) % 100,
+    Mismatches
+    ));
+
+Exit:
+  if (Table != NULL) {
+    FreePool (Table);
+  }
+
+  if (Paths != NULL) {
+    FreePool (Paths);
+  }
+
+  if (Statuses != NULL) {
+    FreePool (Statuses);
+  }
+
+  if (Offsets != NULL) {
+    FreePool (Offsets);
+  }
+
+  return Mismatches == 0 ? 0 : -1;
+}
+
 // -[f|a] , CHAR8 ** memory_location , CHAR8 ** path , UINT8 occurance
 
 /**
    Finds sought entry in ACPI table.
    Usage:
    ./ACPIe -f FileName Path [Entry]
+   ./ACPIe -b FileName [Iterations]
 
-   @param[in] FileName  Path to file with ACPI table.
-   @param[in] Path      Path to required entry.
-   @param[in] Entry     Number of required entry.
+   @param[in] FileName    Path to file with ACPI table.
+   @param[in] Path        Path to required entry.
+   @param[in] Entry       Number of required entry.
+   @param[in] Iterations  Number of namespace index benchmark iterations.
 
  **/
 int
@@ -125,6 +293,10 @@ ENTRY_POINT (
   PcdGet32 (PcdDebugPrintErrorLevel)      |= DEBUG_VERBOSE | DEBUG_INFO;
  #endif
 
+  if ((argc >= 3) && (argv[1][0] == '-') && (argv[1][1] == 'b')) {
+    return AcpiBenchmarkFile (argv[2], argc > 3 ? (UINT32)atoi (argv[3]) : BENCHMARK_ITERATIONS);
+  }
+
   switch (argc) {
     case 5:
       if (((argv[1][0] == '-') && (argv[1][1] == 'f')) || ((argv[1][0] == '-') && (argv[1][1] == 'a'))) {
@@ -222,12 +394,71 @@ ENTRY_POINT (
   return 0;
 }
 
+/**
+  Checks that namespace index lookup matches parser lookup.
+
+  @param[in,out] Index       Namespace index.
+  @param[in]     Table       Pointer to start of ACPI table.
+  @param[in]     TableLength Length of ACPI table.
+**/
+STATIC
+VOID
+FuzzNamespaceIndex (
+  IN OUT OC_ACPI_NAMESPACE_INDEX  **Index,
+  IN     UINT8                    *Table,
+  IN     UINT32                   TableLength
+  )
+{
+  STATIC CONST CHAR8  *Paths[] = {
+    "_SB.PCI0.GFX0",
+    "_SB.PCI0.LPCB",
+    "\\_SB.PCI0",
+    "PCI0",
+    "_SB",
+    "HPET._CRS",
+    "EC0",
+    "_OSI"
+  };
+
+  UINT32      Path;
+  UINT8       Entry;
+  EFI_STATUS  Status;
+  EFI_STATUS  IndexStatus;
+  UINT32      Offset;
+  UINT32      IndexOffset;
+
+  for (Path = 0; Path < ARRAY_SIZE (Paths); ++Path) {
+    for (Entry = 1; Entry <= 2; ++Entry) {
+      Offset      = 0;
+      IndexOffset = 0;
+      Status      = AcpiFindEntryInMemory (Table, Paths[Path], Entry, &Offset, TableLength);
+      IndexStatus = AcpiFindEntryInIndex (Index, Table, Paths[Path], Entry, &IndexOffset, TableLength);
+      if ((Status != IndexStatus) || (Offset != IndexOffset)) {
+        DEBUG ((
+          DEBUG_ERROR,
+          "Index mismatch for %a %u - %r/%r %u/%u\n",
+          Paths[Path],
+          Entry,
+          Status,
+          IndexStatus,
+          Offset,
+          IndexOffset
+          ));
+        abort ();
+      }
+    }
+  }
+}
+
 int
 LLVMFuzzerTestOneInput (
   const uint8_t  *Data,
   size_t         Size
   )
 {
+  OC_ACPI_NAMESPACE_INDEX  *Index;
+  UINT8                    *Table;
+
   if (Size > 0) {
     UINT32  offset = 0;
     AcpiFindEntryInMemory (
@@ -239,5 +470,31 @@ LLVMFuzzerTestOneInput (
       );
   }
 
+  if ((Size > sizeof (EFI_ACPI_DESCRIPTION_HEADER)) && (Size <= MAX_UINT32)) {
+    Table = AllocateCopyPool (Size, Data);
+    if (Table == NULL) {
+      return 0;
+    }
+
+    Index = NULL;
+    FuzzNamespaceIndex (&Index, Table, (UINT32)Size);
+
+    //
+    // Rename the objects or break the table and check the index follows.
+    //
+    Table[Size / 2] = Table[Size / 3];
+    if (Index != NULL) {
+      AcpiInvalidateNamespaceIndex (Index);
+    }
+
+    FuzzNamespaceIndex (&Index, Table, (UINT32)Size);
+
+    if (Index != NULL) {
+      AcpiFreeNamespaceIndex (Index);
+    }
+
+    FreePool (Table);
+  }
+
   return 0;
 }
@@ -0,0 +1,332 @@
+/** @file
+  Benchmark and verify OpenCanopy row blending against per-pixel blending.
+
+  Copyright (C) 2026, Acidanthera. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#include <Base.h>
+
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+
+#include "OpenCanopy.h"
+#include "Blending.h"
+
+#include <sys/time.h>
+#include <stdlib.h>
+
+#define BENCH_IMAGE_SIZE    256U
+#define BENCH_SCREEN_WIDTH  1920U
+#define BENCH_ITERATIONS    200U
+
+STATIC
+UINT64
+GetTimestampUs (
+  VOID
+  )
+{
+  struct timeval  Time;
+
+  gettimeofday (&Time, NULL);
+  return Time.tv_sec * 1000000ULL + Time.tv_usec;
+}
+
+//
+// Per-pixel blending as previously used by GuiDrawToBuffer, for reference.
+//
+STATIC
+VOID
+ReferenceBlendPixel (
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL        *BackPixel,
+  IN     CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *FrontPixel
+  )
+{
+  UINT8  InvFrontOpacity;
+
+  InvFrontOpacity = (0xFF - FrontPixel->Reserved);
+
+  BackPixel->Blue  = FrontPixel->Blue + RGB_APPLY_OPACITY (InvFrontOpacity, BackPixel->Blue);
+  BackPixel->Green = FrontPixel->Green + RGB_APPLY_OPACITY (InvFrontOpacity, BackPixel->Green);
+  BackPixel->Red   = FrontPixel->Red + RGB_APPLY_OPACITY (InvFrontOpacity, BackPixel->Red);
+
+  if (BackPixel->Reserved != 0xFF) {
+    BackPixel->Reserved = FrontPixel->Reserved + RGB_APPLY_OPACITY (InvFrontOpacity, BackPixel->Reserved);
+  }
+}
+
+STATIC
+VOID
+ReferenceBlend (
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL        *BackPixel,
+  IN     CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *FrontPixel,
+  IN     UINT8                                Opacity
+  )
+{
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  OpacFrontPixel;
+
+  if (FrontPixel->Reserved == 0) {
+    return;
+  }
+
+  if (Opacity == 0xFF) {
+    if (FrontPixel->Reserved == 0xFF) {
+      *BackPixel = *FrontPixel;
+    } else {
+      ReferenceBlendPixel (BackPixel, FrontPixel);
+    }
+
+    return;
+  }
+
+  if (FrontPixel->Reserved == 0xFF) {
+    OpacFrontPixel.Reserved = Opacity;
+  } else {
+    OpacFrontPixel.Reserved = RGB_APPLY_OPACITY (FrontPixel->Reserved, Opacity);
+    if (OpacFrontPixel.Reserved == 0) {
+      return;
+    }
+  }
+
+  OpacFrontPixel.Blue  = RGB_APPLY_OPACITY (FrontPixel->Blue, Opacity);
+  OpacFrontPixel.Green = RGB_APPLY_OPACITY (FrontPixel->Green, Opacity);
+  OpacFrontPixel.Red   = RGB_APPLY_OPACITY (FrontPixel->Red, Opacity);
+
+  ReferenceBlendPixel (BackPixel, &OpacFrontPixel);
+}
+
+STATIC
+VOID
+RandomPixel (
+  OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Pixel,
+  IN  BOOLEAN                        Premultiplied
+  )
+{
+  Pixel->Reserved = (UINT8)rand ();
+  Pixel->Blue     = (UINT8)rand ();
+  Pixel->Green    = (UINT8)rand ();
+  Pixel->Red      = (UINT8)rand ();
+
+  if (Premultiplied) {
+    Pixel->Blue  = (UINT8)RGB_APPLY_OPACITY (Pixel->Blue, Pixel->Reserved);
+    Pixel->Green = (UINT8)RGB_APPLY_OPACITY (Pixel->Green, Pixel->Reserved);
+    Pixel->Red   = (UINT8)RGB_APPLY_OPACITY (Pixel->Red, Pixel->Reserved);
+  }
+}
+
+STATIC
+BOOLEAN
+VerifyRows (
+  IN UINT32  Iterations
+  )
+{
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  Front[64];
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  Back[64];
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  Expected[64];
+  UINT32                         Iteration;
+  UINT32                         Index;
+  UINT32                         Length;
+  UINT8                          Opacity;
+
+  for (Iteration = 0; Iteration < Iterations; ++Iteration) {
+    Length  = 1 + rand () % ARRAY_SIZE (Front);
+    Opacity = (UINT8)(1 + rand () % 0xFF);
+
+    for (Index = 0; Index < Length; ++Index) {
+      RandomPixel (&Front[Index], (Iteration & 1U) == 0);
+      //
+      // Produce spans of fully transparent and fully opaque pixels.
+      //
+      if (rand () % 3 == 0) {
+        Front[Index].Reserved = (rand () % 2) == 0 ? 0 : 0xFF;
+      }
+
+      RandomPixel (&Back[Index], FALSE);
+      if (rand () % 2 == 0) {
+        Back[Index].Reserved = 0xFF;
+      }
+
+      Expected[Index] = Back[Index];
+      ReferenceBlend (&Expected[Index], &Front[Index], Opacity);
+    }
+
+    if (Opacity == 0xFF) {
+      GuiBlendRowSolid (Back, Front, Length);
+    } else {
+      GuiBlendRowOpaque (Back, Front, Length, Opacity);
+    }
+
+    if (CompareMem (Back, Expected, Length * sizeof (*Back)) != 0) {
+      DEBUG ((DEBUG_ERROR, "Row blending mismatch at iteration %u opacity %u\n", Iteration, Opacity));
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+  Create a premultiplied icon-like image: a disc with an opaque centre and a
+  translucent edge over a fully transparent background.
+**/
+STATIC
+EFI_GRAPHICS_OUTPUT_BLT_PIXEL *
+CreateIcon (
+  VOID
+  )
+{
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Image;
+  UINT32                         X;
+  UINT32                         Y;
+  INT32                          DeltaX;
+  INT32                          DeltaY;
+  UINT32                         Distance;
+  UINT32                         Radius;
+
+  Image = AllocateZeroPool (BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE * sizeof (*Image));
+  if (Image == NULL) {
+    return NULL;
+  }
+
+  Radius = BENCH_IMAGE_SIZE / 2;
+
+  for (Y = 0; Y < BENCH_IMAGE_SIZE; ++Y) {
+    for (X = 0; X < BENCH_IMAGE_SIZE; ++X) {
+      DeltaX   = (INT32)X - (INT32)Radius;
+      DeltaY   = (INT32)Y - (INT32)Radius;
+      Distance = (UINT32)(DeltaX * DeltaX + DeltaY * DeltaY);
+      if (Distance >= Radius * Radius) {
+        continue;
+      }
+
+      RandomPixel (&Image[Y * BENCH_IMAGE_SIZE + X], TRUE);
+      if (Distance < (Radius - 16) * (Radius - 16)) {
+        Image[Y * BENCH_IMAGE_SIZE + X].Reserved = 0xFF;
+      }
+    }
+  }
+
+  return Image;
+}
+
+STATIC
+BOOLEAN
+BenchmarkBlending (
+  IN CONST CHAR8                          *Name,
+  IN CONST EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Image,
+  IN UINT32                               Width,
+  IN UINT32                               Height,
+  IN UINT8                                Opacity
+  )
+{
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Screen;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Expected;
+  UINT64                         StartTime;
+  UINT64                         ReferenceTime;
+  UINT64                         RowTime;
+  UINT32                         Iteration;
+  UINT32                         Row;
+  UINT32                         Index;
+  BOOLEAN                        Matched;
+
+  Matched  = FALSE;
+  Screen   = AllocatePool (Width * Height * sizeof (*Screen));
+  Expected = AllocatePool (Width * Height * sizeof (*Expected));
+  if ((Screen == NULL) || (Expected == NULL)) {
+    DEBUG ((DEBUG_ERROR, "Benchmark allocation failure\n"));
+    goto Exit;
+  }
+
+  SetMem32 (Expected, Width * Height * sizeof (*Expected), 0xFF203040);
+
+  StartTime = GetTimestampUs ();
+  for (Iteration = 0; Iteration < BENCH_ITERATIONS; ++Iteration) {
+    for (Index = 0; Index < Width * Height; ++Index) {
+      ReferenceBlend (&Expected[Index], &Image[Index], Opacity);
+    }
+  }
+
+  ReferenceTime = MAX (GetTimestampUs () - StartTime, 1);
+
+  SetMem32 (Screen, Width * Height * sizeof (*Screen), 0xFF203040);
+
+  StartTime = GetTimestampUs ();
+  for (Iteration = 0; Iteration < BENCH_ITERATIONS; ++Iteration) {
+    for (Row = 0; Row < Height; ++Row) {
+      if (Opacity == 0xFF) {
+        GuiBlendRowSolid (&Screen[Row * Width], &Image[Row * Width], Width);
+      } else {
+        GuiBlendRowOpaque (&Screen[Row * Width], &Image[Row * Width], Width, Opacity);
+      }
+    }
+  }
+
+  RowTime = MAX (GetTimestampUs () - StartTime, 1);
+  Matched = CompareMem (Screen, Expected, Width * Height * sizeof (*Screen)) == 0;
+
+  DEBUG ((
+    DEBUG_ERROR,
+    "%a opacity %u: per-pixel %Lu us, row %Lu us (%Lu.%02Lu x), %a\n",
+    Name,
+    Opacity,
+    ReferenceTime,
+    RowTime,
+    ReferenceTime / RowTime,
+    (ReferenceTime * 100 / RowTime) % 100,
+    Matched ? "match" : "MISMATCH"
+    ));
+
+Exit:
+  if (Screen != NULL) {
+    FreePool (Screen);
+  }
+
+  if (Expected != NULL) {
+    FreePool (Expected);
+  }
+
+  return Matched;
+}
+
+int
+ENTRY_POINT (
+  int   argc,
+  char  *argv[]
+  )
+{
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Icon;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Background;
+  UINT32                         Index;
+  BOOLEAN                        Matched;
+
+  srand (1);
+
+  if (!VerifyRows (100000)) {
+    return -1;
+  }
+
+  Icon       = CreateIcon ();
+  Background = AllocatePool (BENCH_SCREEN_WIDTH * BENCH_IMAGE_SIZE * sizeof (*Background));
+  if ((Icon == NULL) || (Background == NULL)) {
+    DEBUG ((DEBUG_ERROR, "Image allocation failure\n"));
+    return -1;
+  }
+
+  for (Index = 0; Index < BENCH_SCREEN_WIDTH * BENCH_IMAGE_SIZE; ++Index) {
+    RandomPixel (&Background[Index], TRUE);
+    Background[Index].Reserved = 0xFF;
+  }
+
+  //
+  // Run every benchmark even after a mismatch to report all of them.
+  //
+  Matched  = BenchmarkBlending ("Icon", Icon, BENCH_IMAGE_SIZE, BENCH_IMAGE_SIZE, 0xFF);
+  Matched &= BenchmarkBlending ("Icon", Icon, BENCH_IMAGE_SIZE, BENCH_IMAGE_SIZE, 0x80);
+  Matched &= BenchmarkBlending ("Background", Background, BENCH_SCREEN_WIDTH, BENCH_IMAGE_SIZE, 0xFF);
+
+  FreePool (Icon);
+  FreePool (Background);
+
+  return Matched ? 0 : -1;
+}
@@ -8,6 +8,7 @@
 #include <UserFile.h>
 
 #include <Base.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/DebugLib.h>
 #include <Library/BmpSupportLib.h>
@@ -67,6 +68,7 @@ ENTRY_POINT (
   UINT8             *FontMetrics;
   UINT32            FontMetricsSize;
   GUI_IMAGE         Label;
+  GUI_IMAGE         CachedLabel;
   EFI_STATUS        Status;
   VOID              *BmpImage;
   UINT32            BmpImageSize;
@@ -92,6 +94,21 @@ ENTRY_POINT (
 
   DEBUG ((DEBUG_WARN, "Result: %u %u\n", Label.Height, Label.Width));
 
+  //
+  // Rendering the same label again must hit the label cache.
+  //
+  Result = GuiGetLabel (&CachedLabel, &Context, L"Time Machine HD", L_STR_LEN ("Time Machine HD"), FALSE);
+  if (  !Result
+     || (CachedLabel.Width != Label.Width)
+     || (CachedLabel.Height != Label.Height)
+     || (CompareMem (CachedLabel.Buffer, Label.Buffer, Label.Width * Label.Height * sizeof (*Label.Buffer)) != 0))
+  {
+    DEBUG ((DEBUG_WARN, "BMF: cached label mismatch\n"));
+    return -1;
+  }
+
+  FreePool (CachedLabel.Buffer);
+
   BmpImage     = NULL;
   BmpImageSize = 0;
   Status       = TranslateGopBltToBmp (
@@ -109,7 +126,7 @@ ENTRY_POINT (
 
   FreePool (BmpImage);
 
-  FreePool (Context.FontImage.Buffer);
+  GuiFontDestruct (&Context);
   FreePool (Label.Buffer);
 
   return 0;
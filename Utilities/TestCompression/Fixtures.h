@@ -0,0 +1,1613 @@
+/** @file
+  Compressed fixtures for TestCompression.
+  Generated by TestCompression/GenerateFixtures.py, do not edit.
+
+  Copyright (C) 2026, Acidanthera. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#ifndef TEST_COMPRESSION_FIXTURES_H
+#define TEST_COMPRESSION_FIXTURES_H
+
+// adc-one
+STATIC CONST UINT8  mFixture0[] = {
+  0x80, 0xC6,
+};
+
+// adc-text
+STATIC CONST UINT8  mFixture1[] = {
+  0x9A, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x04, 0x16, 0xA3, 0x6C,
+  0x6F, 0x63, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D,
+  0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x6B, 0x65, 0x72,
+  0x6E, 0x65, 0x6C, 0x0C, 0x0B, 0x10, 0x48, 0x86, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x10,
+  0x20, 0x10, 0x14, 0x08, 0x0B, 0x84, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x10, 0x05, 0x08, 0x69, 0x10,
+  0x1C, 0x10, 0x44, 0x0C, 0x18, 0x82, 0x61, 0x70, 0x70, 0x04, 0x5C, 0x0C, 0x7D, 0x0C, 0x0C, 0x87,
+  0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x18, 0x6D, 0x1C, 0xA5, 0x10, 0x11, 0x0C, 0xA5,
+  0x0C, 0x97, 0x82, 0x65, 0x66, 0x69, 0x3C, 0x7A, 0x18, 0x94, 0x0C, 0x36, 0x0C, 0x05, 0x0C, 0x5D,
+  0x08, 0xF8, 0x08, 0x04, 0x10, 0x30, 0x10, 0x81, 0x04, 0x36, 0x10, 0xF0, 0x14, 0x49, 0x0C, 0x94,
+  0x08, 0x7E, 0x10, 0x0B, 0x04, 0x6C, 0x0C, 0x76, 0x24, 0x6D, 0x15, 0x52, 0x08, 0x95, 0x0C, 0x05,
+  0x20, 0x54, 0x08, 0x3F, 0x08, 0x70, 0x28, 0xF8, 0x08, 0x16, 0x18, 0xEA, 0x39, 0x95, 0x28, 0x9C,
+  0x10, 0x97, 0x10, 0xC0, 0x08, 0x60, 0x08, 0x24, 0x10, 0x50, 0x2C, 0x1E, 0x04, 0x42, 0x20, 0x7E,
+  0x11, 0xCB, 0x25, 0x4B, 0x0C, 0x96, 0x25, 0x72, 0x0D, 0x20, 0x18, 0x8D, 0x29, 0xEB, 0x21, 0x05,
+  0x0C, 0x9E, 0x04, 0x1C, 0x05, 0x08, 0x0C, 0x88, 0x19, 0x6A, 0x08, 0x1C, 0x10, 0x6D, 0x2C, 0x49,
+  0x18, 0x22, 0x04, 0x35, 0x10, 0x56, 0x0D, 0x45, 0x10, 0xB9, 0x0D, 0x11, 0x0C, 0x12, 0x10, 0x41,
+  0x08, 0x38, 0x29, 0x6A, 0x25, 0x5E, 0x10, 0x24, 0x25, 0xD7, 0x0C, 0x43, 0x10, 0x50, 0x25, 0x42,
+  0x25, 0xEB, 0x24, 0x43, 0x0C, 0x05, 0x24, 0x30, 0x24, 0x35, 0x18, 0xC1, 0x1C, 0xDF, 0x28, 0x2F,
+  0x27, 0x2E, 0x0C, 0xA6, 0x0C, 0x80, 0x10, 0x99, 0x24, 0xC5, 0x26, 0x11, 0x0C, 0x05, 0x2D, 0xB7,
+  0x24, 0x2B, 0x37, 0x54, 0x1D, 0x48, 0x0C, 0x70, 0x2C, 0x7E, 0x27, 0x42, 0x29, 0x50, 0x0C, 0x0C,
+  0x13, 0xB8, 0x1E, 0xBA, 0x10, 0x0A, 0x18, 0x54, 0x1D, 0xCF, 0x1F, 0xC5, 0x19, 0x08, 0x10, 0x2C,
+  0x0D, 0x63, 0x0C, 0x4A, 0x18, 0x25, 0x2E, 0x1B, 0x4A, 0x04, 0x2E, 0x21, 0xE4, 0x2E, 0xE3, 0x10,
+  0x26, 0x1C, 0x6A, 0x12, 0x59, 0x1B, 0x24, 0x17, 0xDD, 0x25, 0xB0, 0x04, 0x0B, 0x2C, 0xF4, 0x0C,
+  0x8A, 0x0C, 0xF4, 0x2E, 0x7C, 0x10, 0x27, 0x08, 0x0B, 0x0D, 0x1A, 0x10, 0x51, 0x2D, 0x94, 0x10,
+  0x5A, 0x10, 0x0D, 0x28, 0x28, 0x10, 0x62, 0x10, 0x21, 0x50, 0x03, 0x83, 0x29, 0x15, 0x2B, 0xD0,
+  0x0C, 0x05, 0x23, 0x7E, 0x51, 0x03, 0x5A, 0x0E, 0x0C, 0x45, 0x04, 0xB4, 0x10, 0x55, 0x3E, 0x6D,
+  0x49, 0x04, 0xE9, 0x18, 0x15, 0x47, 0x04, 0x3A, 0x49, 0x05, 0xB6, 0x11, 0xE9, 0x22, 0xBF, 0x2A,
+  0x0E, 0x0C, 0x2B, 0x28, 0xE9, 0x30, 0x52, 0x3E, 0x70, 0x27, 0x5B, 0x2A, 0xED, 0x26, 0x1C, 0x47,
+  0x04, 0x67, 0x2B, 0x7F, 0x2B, 0xA5, 0x10, 0x71, 0x25, 0x0E, 0x22, 0x2A, 0x2C, 0x24, 0x26, 0xD1,
+  0x31, 0x33, 0x30, 0x0E, 0x26, 0x62, 0x4A, 0x06, 0x83, 0x09, 0x82, 0x21, 0x11, 0x21, 0x72, 0x25,
+  0x2D, 0x33, 0xD8, 0x10, 0x4F, 0x49, 0x04, 0x28, 0x49, 0x06, 0xA2, 0x18, 0x5A, 0x16, 0x09, 0x0A,
+  0xB7, 0x1F, 0xE0, 0x2E, 0x6B, 0x10, 0x24, 0x4B, 0x06, 0x88, 0x29, 0x36, 0x08, 0x4C, 0x18, 0xD5,
+  0x29, 0xB0, 0x29, 0x46, 0x48, 0x04, 0x18, 0x37, 0xC1, 0x10, 0x28, 0x55, 0x04, 0x36, 0x0C, 0x76,
+  0x14, 0x3C, 0x1E, 0x37, 0x10, 0x11, 0x46, 0x05, 0xC6, 0x27, 0x3B, 0x23, 0x40, 0x0C, 0xA9, 0x09,
+  0x3B, 0x23, 0xA1, 0x0C, 0xAB, 0x0C, 0x38, 0x48, 0x05, 0x02, 0x2F, 0x37, 0x10, 0x52, 0x22, 0xB3,
+  0x4F, 0x03, 0xCD, 0x4C, 0x04, 0x14, 0x2C, 0x34, 0x25, 0xAF, 0x29, 0x13, 0x0C, 0x1F, 0x0C, 0xCB,
+  0x23, 0x72, 0x24, 0x1C, 0x51, 0x07, 0x5B, 0x20, 0x2B, 0x10, 0x79, 0x0C, 0x32, 0x50, 0x00, 0xB2,
+  0x21, 0xA5, 0x20, 0x68, 0x20, 0x0F, 0x50, 0x00, 0x9E, 0x2C, 0xDD, 0x2B, 0x14, 0x48, 0x07, 0x76,
+  0x28, 0x18, 0x2E, 0xBE, 0x25, 0xEE, 0x4A, 0x04, 0xB8, 0x22, 0xD3, 0x0C, 0x3F, 0x05, 0x97, 0x18,
+  0x3C, 0x47, 0x05, 0x77, 0x24, 0xF1, 0x1D, 0xC1, 0x10, 0x15, 0x48, 0x04, 0x0C, 0x32, 0x9E, 0x0D,
+  0x0B, 0x0C, 0x0B, 0x4B, 0x06, 0x11, 0x1F, 0xE2, 0x25, 0xF0, 0x04, 0x56, 0x1A, 0x1C, 0x0C, 0x37,
+  0x44, 0x06, 0xCD, 0x45, 0x06, 0x47, 0x49, 0x05, 0x2A, 0x53, 0x02, 0x7D, 0x36, 0xD6, 0x4C, 0x06,
+  0x33, 0x46, 0x09, 0x77, 0x12, 0x7A, 0x1E, 0xA1, 0x10, 0x40, 0x4D, 0x05, 0x12, 0x36, 0x51, 0x08,
+  0xC1, 0x33, 0x17, 0x29, 0x85, 0x0C, 0x59, 0x49, 0x04, 0x87, 0x2B, 0x1A, 0x51, 0x06, 0xD3, 0x4A,
+  0x07, 0x3C, 0x26, 0x95, 0x2D, 0xD4, 0x27, 0x5E, 0x47, 0x04, 0x33, 0x24, 0x86, 0x4A, 0x06, 0x9D,
+  0x4B, 0x04, 0x9D, 0x81, 0x63, 0x68,
+};
+
+// adc-runs
+STATIC CONST UINT8  mFixture2[] = {
+  0x80, 0x03, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x01, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x20, 0x00, 0x80, 0x02, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7A, 0x00, 0x00, 0x4F, 0x00, 0xD7, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x54, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x4F, 0x00, 0x1A, 0x7F, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x77, 0x00, 0x00, 0x16, 0x6D, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x18, 0x00, 0x4F, 0x06, 0x2B, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x67, 0x00, 0x00, 0x4F, 0x01, 0x5C, 0x7F, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x4F, 0x04, 0xD7, 0x5A, 0x00, 0x00, 0x4F, 0x02, 0xA1, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x66, 0x00, 0x00, 0x4F, 0x09, 0x70, 0x7F, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x81, 0x02, 0x02, 0x4F, 0x00, 0xAD, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x38, 0x00, 0x4F, 0x03,
+  0x69, 0x7B, 0x00, 0x00, 0x4F, 0x03, 0xEC, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x51, 0x00, 0x00,
+  0x4F, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x6D, 0x00, 0x00,
+};
+
+// adc-random
+STATIC CONST UINT8  mFixture3[] = {
+  0xFF, 0x19, 0x66, 0xFB, 0x7F, 0x2F, 0x90, 0x82, 0x95, 0x42, 0x4B, 0x45, 0x79, 0x9D, 0x17, 0x67,
+  0xE5, 0xB5, 0x93, 0x80, 0x81, 0x29, 0xCA, 0xF3, 0x10, 0x7A, 0x43, 0x0F, 0x5D, 0x8A, 0xC7, 0xE8,
+  0xE3, 0xD6, 0xF0, 0xF3, 0x3F, 0x73, 0x76, 0x64, 0x56, 0xCA, 0x39, 0x48, 0x46, 0x13, 0x0E, 0x61,
+  0x0E, 0x92, 0x4A, 0xC5, 0xFC, 0x94, 0x0F, 0x35, 0xDA, 0x28, 0x59, 0x3E, 0xD7, 0x9E, 0xC7, 0x12,
+  0x37, 0xC1, 0x2A, 0x24, 0xBA, 0xD3, 0xCF, 0x85, 0xCD, 0x4D, 0x8C, 0x01, 0x73, 0x53, 0x8D, 0xF8,
+  0xF2, 0xF9, 0xDC, 0xFE, 0x3D, 0x38, 0xB1, 0x32, 0x25, 0xAE, 0x7F, 0x5F, 0x3E, 0x19, 0xBB, 0xD4,
+  0x92, 0x92, 0x6A, 0x03, 0x08, 0x89, 0x71, 0xDC, 0x92, 0x84, 0x9C, 0xE7, 0x1A, 0x97, 0x6C, 0x24,
+  0x2A, 0xA2, 0xA1, 0xA3, 0x5D, 0x4D, 0x8A, 0xE2, 0x89, 0xC4, 0x0F, 0xE9, 0xAA, 0x33, 0x7B, 0x27,
+  0x8D, 0xFF, 0x00, 0x0A, 0x0B, 0x41, 0xCB, 0x36, 0x62, 0x3D, 0x27, 0xC2, 0x73, 0x51, 0x15, 0x83,
+  0xDC, 0x4E, 0x45, 0xF1, 0x2A, 0x74, 0x0B, 0x71, 0x3B, 0xA0, 0x22, 0x60, 0x54, 0x32, 0x24, 0xDF,
+  0x02, 0xBF, 0xC5, 0x61, 0xB1, 0x7C, 0xD3, 0xF5, 0x0E, 0x65, 0xEE, 0x54, 0x1C, 0x30, 0x07, 0xAA,
+  0x18, 0xF5, 0x99, 0x25, 0x0E, 0x9A, 0xAA, 0x3E, 0x37, 0x00, 0x80, 0xCA, 0x19, 0xEF, 0x24, 0xBF,
+  0x5D, 0xC2, 0x98, 0xC7, 0x6F, 0xD2, 0xD7, 0x87, 0xD8, 0xA3, 0x91, 0xAC, 0x5B, 0xD1, 0xA3, 0xBA,
+  0xD1, 0xB8, 0x58, 0x93, 0xC4, 0xE6, 0x62, 0xCA, 0xCE, 0x42, 0x96, 0xA5, 0xB0, 0xF9, 0x6B, 0xF4,
+  0x31, 0x2C, 0x30, 0x94, 0xBD, 0x5A, 0x10, 0xC2, 0xB9, 0x8F, 0xC8, 0x21, 0xA7, 0x4A, 0x22, 0x89,
+  0xFE, 0x2F, 0x38, 0x95, 0xC7, 0x71, 0x6A, 0xEB, 0xF7, 0xFD, 0x1C, 0x4A, 0x8F, 0x67, 0x30, 0x55,
+  0x76, 0x95, 0xAB, 0x47, 0x21, 0x11, 0x2E, 0xB7, 0x80, 0xA8, 0xC0, 0x4A, 0x0B, 0x78, 0xB3, 0xBC,
+  0xF1, 0x98, 0xF1, 0xF3, 0x82, 0x8C, 0x53, 0xFC, 0x7B, 0xAB, 0xCA, 0xCA, 0x0F, 0x31, 0x52, 0xAD,
+  0xBA, 0x23, 0x97, 0x93, 0xC5, 0xE6, 0x64, 0x02, 0x97, 0x9E, 0xCF, 0xD1, 0xC2, 0x47, 0x26,
+};
+
+// adc-mixed
+STATIC CONST UINT8  mFixture4[] = {
+  0x9A, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0xD1, 0x6C, 0xB8, 0x73, 0x3C, 0x68, 0x70, 0x69,
+  0x63, 0x6B, 0x65, 0x72, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x10, 0x1A, 0x10, 0x06,
+  0x92, 0x6F, 0x3D, 0xEA, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x10, 0x0A, 0xB2, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20,
+  0x65, 0x66, 0x69, 0x20, 0x1C, 0xA6, 0x80, 0x4E, 0x86, 0x44, 0xA3, 0x5C, 0x83, 0xB6, 0x9E, 0x25,
+  0xB7, 0x89, 0xC8, 0xD7, 0xC8, 0x3F, 0x50, 0xB1, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x74, 0x61,
+  0x62, 0x6C, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x10, 0x39, 0x10, 0x0C, 0x0C, 0x1F,
+  0x87, 0x30, 0x73, 0x6F, 0x2A, 0x6B, 0xD0, 0x03, 0x7C, 0x10, 0x84, 0x0C, 0x21, 0x8B, 0x44, 0x13,
+  0xF6, 0x20, 0xFD, 0xA4, 0x66, 0x1E, 0xAF, 0x55, 0x29, 0xDF, 0x10, 0x18, 0xB2, 0x51, 0xB5, 0x39,
+  0x03, 0x9B, 0xE6, 0x3B, 0x33, 0x8E, 0xD4, 0xB0, 0x15, 0x46, 0xD8, 0xC8, 0x83, 0xA7, 0xFF, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0xB1, 0xC9, 0x3C, 0xAF, 0x9F, 0x59, 0x50, 0x5A, 0xA4, 0xBC, 0xC6,
+  0x06, 0x55, 0x57, 0x83, 0x92, 0x4D, 0x5C, 0x1A, 0x56, 0xED, 0xD7, 0x64, 0x69, 0x73, 0x6B, 0x20,
+  0x0C, 0x20, 0xBB, 0x1B, 0x1D, 0x6B, 0x40, 0x58, 0x26, 0x47, 0xFE, 0x50, 0x79, 0x1B, 0x68, 0x7B,
+  0x4F, 0x17, 0x53, 0x3A, 0xC5, 0x9F, 0x44, 0xD8, 0x23, 0xA2, 0x9A, 0x41, 0xEA, 0xBA, 0x7B, 0x08,
+  0x7F, 0x0A, 0x5A, 0xCD, 0x1F, 0x94, 0x0D, 0xC9, 0xDC, 0xF6, 0x95, 0x54, 0x2F, 0x95, 0x83, 0x3D,
+  0x33, 0xA1, 0xA7, 0x66, 0x14, 0x13, 0x60, 0x1C, 0x37, 0x66, 0xA6, 0x37, 0x27, 0x15, 0xD4, 0x08,
+  0x46, 0x0C, 0xA7, 0x10, 0xB4, 0x0C, 0x53, 0x09, 0x06, 0x0C, 0x0A, 0x24, 0xE5, 0x91, 0x43, 0x1C,
+  0x38, 0xEC, 0x80, 0xC6, 0x12, 0x63, 0xD5, 0x30, 0xBC, 0xED, 0xAB, 0x7E, 0x3B, 0x0A, 0x40, 0x74,
+  0x19, 0x24, 0x08, 0x31, 0x0C, 0x2B, 0x0C, 0x05, 0x18, 0x19, 0x0D, 0x5E, 0x05, 0x44, 0x11, 0x62,
+  0x84, 0x72, 0x69, 0x76, 0x65, 0x72, 0x10, 0x51, 0x18, 0x25, 0x8D, 0xB2, 0xC2, 0x21, 0xC8, 0xEC,
+  0x2C, 0x41, 0x1A, 0xF5, 0x70, 0xC4, 0xB6, 0xCE, 0x4A, 0x0C, 0x7A, 0x0C, 0x22, 0x87, 0x6F, 0x70,
+  0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x0C, 0x62, 0x0C, 0x04, 0x0C, 0x42, 0xA4, 0xE3, 0x42, 0x55,
+  0xB7, 0x30, 0x2B, 0x50, 0xBB, 0xA3, 0xF6, 0x11, 0x33, 0xB5, 0xF0, 0xD0, 0xBA, 0x74, 0xCC, 0xDE,
+  0x60, 0xFB, 0x72, 0x81, 0x5A, 0xB2, 0x8D, 0x4A, 0xD3, 0xDB, 0x0D, 0x77, 0x13, 0x27, 0x66, 0x6C,
+  0x00, 0x2E, 0x10, 0xD7, 0x29, 0xA0, 0x11, 0xFB, 0x85, 0x02, 0x42, 0x2B, 0xAB, 0x6F, 0x56, 0x18,
+  0x5F, 0x11, 0x88, 0x83, 0x07, 0x99, 0x52, 0x74, 0x2C, 0x73, 0x0C, 0xD0, 0x09, 0x2B, 0x9F, 0x1D,
+  0x74, 0x0E, 0xC9, 0xEB, 0x1A, 0x46, 0xE3, 0x3E, 0xEF, 0x1B, 0xCE, 0xD4, 0xF6, 0xA4, 0x5F, 0xBD,
+  0x3C, 0xC2, 0x19, 0x82, 0x90, 0x30, 0x48, 0x12, 0x01, 0x4F, 0xDE, 0x70, 0x1C, 0xAF, 0x0D, 0x2A,
+  0x00, 0x8B, 0xEF, 0x3A, 0xB1, 0xFD, 0x50, 0xE3, 0x5E, 0x0B, 0x4C, 0xF6, 0x04, 0x6E, 0x04, 0xFF,
+  0x04, 0x03, 0x0C, 0xD9, 0x18, 0xF6, 0x30, 0xE2, 0x18, 0x08, 0x10, 0x72, 0x0C, 0xE7, 0x0D, 0x41,
+  0x0C, 0x2A, 0x24, 0xFF, 0x82, 0x27, 0xF9, 0x2B, 0x10, 0xC9, 0x10, 0x10, 0x93, 0x2F, 0x70, 0x32,
+  0x6F, 0xEE, 0x12, 0xB7, 0xBB, 0xB0, 0xB1, 0xF6, 0xB0, 0x01, 0x84, 0x41, 0xD0, 0xE8, 0x1A, 0x5B,
+  0xB2, 0x28, 0x49, 0x2A, 0x99, 0x18, 0x84, 0x9A, 0xB8, 0xBF, 0x71, 0x09, 0xC7, 0x6B, 0xAA, 0xA8,
+  0x34, 0x72, 0x0C, 0x65, 0x6B, 0x92, 0xF6, 0xB9, 0x2F, 0x40, 0x1B, 0x90, 0x7D, 0x54, 0xB5, 0xD7,
+  0x20, 0x73, 0x8A, 0x04, 0xB2, 0x80, 0xFA, 0x0C, 0xD4, 0x0C, 0x85, 0x09, 0x05, 0x04, 0x15, 0x8E,
+  0x1E, 0xED, 0xF3, 0xB6, 0x87, 0x67, 0x0C, 0x26, 0x85, 0x55, 0xB3, 0xBD, 0x22, 0x5C, 0x35, 0x08,
+  0x97, 0x10, 0x5E, 0x84, 0xAB, 0x50, 0x11, 0x54, 0x8A, 0x08, 0x28, 0x10, 0x10, 0x9C, 0x65, 0x1E,
+  0x92, 0x88, 0xAC, 0x32, 0xF6, 0xE5, 0xD2, 0xDB, 0x5F, 0xD9, 0xB0, 0x74, 0x95, 0x56, 0x66, 0x62,
+  0x4F, 0x09, 0x17, 0x25, 0x4D, 0x46, 0x68, 0x21, 0x35, 0xB3, 0xB6, 0x08, 0x39, 0x14, 0xC7, 0x20,
+  0xDD, 0x13, 0xAE, 0x31, 0x12, 0x2F, 0xBD, 0x0C, 0x13, 0x81, 0x3C, 0x33, 0x10, 0x32, 0x0C, 0xA8,
+  0xD0, 0xDA, 0xE1, 0x72, 0x73, 0xE0, 0xF3, 0x7F, 0xD2, 0x4D, 0xF6, 0x87, 0xF2, 0x8E, 0x13, 0xBD,
+  0x18, 0x94, 0x66, 0xB4, 0xB5, 0x19, 0x2F, 0xD6, 0x05, 0x3C, 0xEB, 0x31, 0x99, 0x0D, 0x8B, 0xA8,
+  0xA9, 0x1F, 0xA5, 0xFF, 0xC2, 0xB1, 0xB5, 0x26, 0x3C, 0x5D, 0xCB, 0x56, 0x58, 0x9F, 0x62, 0x6F,
+  0x6F, 0x74, 0x20, 0xA3, 0x37, 0xC2, 0xBC, 0xAF, 0x2F, 0xCC, 0x5F, 0x4F, 0x50, 0xA7, 0x7D, 0xA4,
+  0x72, 0xF4, 0x6A, 0x4D, 0x77, 0x67, 0x61, 0x84, 0x38, 0x45, 0x54, 0xF8, 0x31, 0x9E, 0x73, 0x68,
+  0xED, 0x4B, 0x04, 0xEE, 0x86, 0xCB, 0x83, 0xE6, 0x0C, 0x16, 0x03, 0xCE, 0x12, 0x23, 0x0C, 0x77,
+  0x96, 0xE5, 0x95, 0x37, 0xE6, 0xBA, 0x9B, 0x49, 0x42, 0x71, 0xB9, 0x9E, 0x93, 0x49, 0x1F, 0xBE,
+  0xAD, 0xCF, 0x9A, 0x91, 0x5C, 0xF8, 0x7A, 0xE2, 0x0D, 0x28, 0x96, 0x13, 0x05, 0x1C, 0xA9, 0x7D,
+  0x62, 0xF1, 0xEC, 0x98, 0xCC, 0x66, 0x80, 0x01, 0x2F, 0x84, 0x10, 0x56, 0x46, 0x20, 0xD2, 0x81,
+  0xFD, 0x0D, 0x10, 0xD5, 0x0C, 0xA9, 0x8A, 0x3D, 0x4A, 0xE6, 0xE8, 0x3C, 0x2E, 0x82, 0xF5, 0xBE,
+  0x22, 0x3C, 0x0A, 0x1B, 0x04, 0x8B, 0x90, 0x2A, 0xAD, 0x14, 0xD6, 0x08, 0xC0, 0xD4, 0x85, 0x22,
+  0x60, 0x97, 0x34, 0xF6, 0xB2, 0x77, 0xBC, 0xE5, 0x2A, 0x52, 0x81, 0xE0, 0xE3, 0x11, 0xCF, 0x05,
+  0x28, 0x84, 0x2B, 0x26, 0x72, 0xEE, 0xBE, 0x08, 0x09, 0x04, 0x3D, 0x8F, 0x51, 0x1F, 0x4F, 0x58,
+  0x64, 0xD0, 0x61, 0x12, 0x41, 0x4D, 0xFD, 0xF1, 0x66, 0x91, 0x2D, 0xE5, 0x22, 0xB5, 0x42, 0x04,
+  0x2D, 0x04, 0x5D, 0x87, 0x54, 0x84, 0x92, 0xEF, 0x89, 0x7A, 0x6B, 0x27, 0x19, 0xFB, 0x80, 0x72,
+  0x11, 0x3A, 0x88, 0x05, 0x04, 0x1D, 0x89, 0xB9, 0xFE, 0x32, 0x34, 0xAD, 0x10, 0xE1, 0x10, 0x16,
+  0x10, 0x0D, 0x8A, 0xC8, 0x1E, 0x93, 0x92, 0x24, 0x15, 0xDE, 0x92, 0x37, 0xE5, 0xDE, 0x0E, 0x86,
+  0x08, 0x4C, 0x0C, 0xE8, 0x2A, 0x53, 0x2E, 0x8F, 0x46, 0x04, 0x1D, 0x2A, 0x7E, 0x0F, 0x03, 0x8B,
+  0x8A, 0x51, 0x1D, 0x9A, 0xB0, 0x40, 0x5A, 0x9D, 0x7E, 0x6A, 0x7A, 0x67, 0x25, 0xFE, 0x0C, 0x60,
+  0x0C, 0xF5, 0x3F, 0x18, 0xAF, 0x62, 0xCE, 0x40, 0x50, 0x33, 0x87, 0xA1, 0xCA, 0x34, 0x76, 0xEB,
+  0x29, 0x76, 0xC7, 0x5D, 0x08, 0x64, 0x12, 0x29, 0x47, 0xE7, 0x47, 0xF2, 0xDE, 0x3C, 0x57, 0x06,
+  0x65, 0x90, 0xA3, 0x5B, 0x5F, 0x4B, 0x4A, 0x93, 0x61, 0x0F, 0x67, 0xFD, 0x49, 0xB1, 0x73, 0x82,
+  0x20, 0xF5, 0xBB, 0xDD, 0xC3, 0x10, 0x72, 0x9F, 0xFD, 0xA0, 0xE8, 0xA1, 0x48, 0x79, 0x57, 0xC5,
+  0x82, 0x47, 0xD6, 0xDD, 0xCD, 0xEF, 0x0C, 0x00, 0x75, 0xED, 0x9D, 0xF8, 0x84, 0xBA, 0x23, 0x8A,
+  0x25, 0xFA, 0xED, 0x83, 0xB9, 0x69, 0x7A, 0x87, 0x05, 0x40, 0x10, 0x84, 0x97, 0xEC, 0x69, 0xBD,
+  0xC9, 0x99, 0x61, 0x59, 0x49, 0xD0, 0x6E, 0x8E, 0xB8, 0x82, 0x8F, 0x67, 0xB3, 0x79, 0x1E, 0xEA,
+  0x67, 0x11, 0xE1, 0x3A, 0x73, 0x0C, 0xED, 0x18, 0x88, 0x04, 0x31, 0x1B, 0x0C, 0x0C, 0xFC, 0x8F,
+  0xAD, 0x89, 0x93, 0x88, 0x97, 0x02, 0x66, 0x64, 0xD1, 0x78, 0xBC, 0xB5, 0x3F, 0x99, 0x01, 0x34,
+  0x21, 0x2A, 0x9F, 0xE8, 0x1A, 0x46, 0x45, 0xC0, 0xCD, 0x64, 0x54, 0xA6, 0x9D, 0x44, 0xC5, 0x8C,
+  0x26, 0x89, 0x65, 0xFF, 0xD1, 0x3A, 0x1F, 0x24, 0x26, 0x19, 0x29, 0x74, 0xD5, 0xC5, 0xF1, 0x37,
+  0x82, 0x8F, 0xC6, 0x04, 0x44, 0x87, 0x70, 0x3C, 0xBF, 0x8C, 0x61, 0x05, 0x93, 0x16, 0x0C, 0x68,
+  0x43, 0x05, 0x88, 0x48, 0x04, 0x01, 0x25, 0x25, 0x9A, 0xBE, 0x95, 0xEC, 0x9B, 0xEE, 0x09, 0x65,
+  0xA8, 0x25, 0x4F, 0x98, 0x49, 0x14, 0x85, 0x34, 0xBE, 0x14, 0x93, 0x05, 0x4E, 0x06, 0xD0, 0x34,
+  0xD0, 0xEB, 0x75, 0x44, 0x2A, 0x30, 0x12, 0x6F, 0x46, 0x05, 0x7E, 0x18, 0xC0, 0x9A, 0x75, 0x72,
+  0xCC, 0x5C, 0xD8, 0xD6, 0x20, 0x3F, 0x55, 0xF3, 0x89, 0x81, 0x0A, 0x3F, 0x12, 0x23, 0x54, 0x6B,
+  0x05, 0x80, 0xFB, 0x17, 0xF4, 0x71, 0x1F, 0x57, 0x86, 0x43, 0x05, 0xA8, 0x1A, 0x3A, 0xB3, 0x8E,
+  0x1D, 0x01, 0x84, 0x8B, 0x74, 0xF8, 0xA8, 0xC5, 0xBB, 0xE1, 0x4C, 0x3A, 0x75, 0x96, 0x4F, 0x25,
+  0xF2, 0xCB, 0x39, 0x1B, 0x35, 0x7D, 0x08, 0xE7, 0xA8, 0x3B, 0xB9, 0x26, 0x7F, 0xA3, 0xEC, 0x6B,
+  0x40, 0x70, 0x07, 0x4D, 0x83, 0xC9, 0x7B, 0xD0, 0xD4, 0xA8, 0xF2, 0xFF, 0xAB, 0x27, 0x3E, 0x9A,
+  0x84, 0x9A, 0x4C, 0x0C, 0x43, 0x89, 0x36, 0xEA, 0xAE, 0x91, 0x54, 0x8B, 0x92, 0xDC, 0xCE, 0xAE,
+  0x0C, 0xCF, 0x92, 0x85, 0xE4, 0xC5, 0x04, 0xE6, 0xE1, 0xDD, 0xF1, 0x81, 0x78, 0x3D, 0x2B, 0x67,
+  0x7C, 0xC2, 0x5C, 0x9E, 0xDE, 0x93, 0x10, 0xEE, 0x05, 0x25, 0x08, 0x6C, 0x24, 0xFE, 0x88, 0xCD,
+  0xF2, 0x8C, 0x6B, 0x5B, 0x68, 0xF9, 0x29, 0x38,
+};
+
+// bzip2-one-level9
+STATIC CONST UINT8  mFixture5[] = {
+  0x42, 0x5A, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0xF6, 0xFB, 0x9D, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x01, 0x00, 0x20, 0x00, 0x21, 0x18, 0x46, 0x82, 0xEE, 0x48, 0xA7, 0x0A, 0x12,
+  0x1E, 0xDF, 0x73, 0xAC, 0x00,
+};
+
+// bzip2-text-level9
+STATIC CONST UINT8  mFixture6[] = {
+  0x42, 0x5A, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0xCD, 0xA2, 0xD6, 0xB9, 0x00, 0x04,
+  0x9A, 0x11, 0x80, 0x40, 0x00, 0x3F, 0xEF, 0xDF, 0x20, 0x40, 0x03, 0x14, 0x4A, 0x72, 0x45, 0x0E,
+  0x83, 0x53, 0xC1, 0x15, 0x46, 0x4D, 0x18, 0x10, 0x6A, 0x7E, 0x48, 0x92, 0x88, 0xDA, 0x20, 0x30,
+  0xD3, 0xF5, 0x55, 0x18, 0x00, 0x00, 0x10, 0xA4, 0xA6, 0x83, 0x25, 0x36, 0x6A, 0x9E, 0x9A, 0x7F,
+  0x3F, 0x3E, 0x22, 0x7E, 0xC3, 0xD3, 0x6E, 0x16, 0x95, 0x79, 0x6A, 0xCB, 0x0E, 0x28, 0x41, 0x27,
+  0xAF, 0xFF, 0xB6, 0x64, 0xA6, 0xDD, 0xB6, 0x57, 0x12, 0x74, 0xBE, 0x12, 0xF4, 0xB7, 0xC6, 0xC2,
+  0xDD, 0x8C, 0x35, 0x36, 0x0C, 0x26, 0xC4, 0x31, 0x41, 0x84, 0x5E, 0x24, 0xED, 0xA1, 0xB9, 0x32,
+  0xB0, 0x6A, 0x06, 0xAC, 0x4A, 0xDB, 0xA6, 0x08, 0x6D, 0x8D, 0xD3, 0x72, 0x0C, 0x2C, 0x9C, 0x96,
+  0x71, 0x91, 0x4C, 0x4D, 0x8D, 0x51, 0x04, 0xF7, 0x36, 0x28, 0x11, 0x11, 0x8D, 0x61, 0x10, 0xAD,
+  0x62, 0x93, 0x26, 0x6B, 0xB9, 0x85, 0xC5, 0xEE, 0xA6, 0x64, 0xB4, 0x79, 0xC6, 0x0E, 0xF8, 0x63,
+  0x6E, 0x24, 0x89, 0xE3, 0x74, 0xD3, 0x48, 0x40, 0xB1, 0x17, 0x4F, 0x31, 0xCF, 0x18, 0xCB, 0x0E,
+  0xD4, 0xC5, 0xED, 0x2E, 0x9D, 0xD6, 0x01, 0x11, 0x46, 0x6A, 0xE6, 0xE5, 0x14, 0x0D, 0xD5, 0x8E,
+  0x60, 0xC1, 0x93, 0x73, 0x98, 0x0F, 0x26, 0xA6, 0x52, 0x69, 0xA2, 0x8C, 0xA8, 0x83, 0x6C, 0x48,
+  0xBD, 0x7B, 0x73, 0x62, 0xCD, 0x6C, 0xED, 0xB8, 0x6B, 0xE5, 0xE1, 0xD5, 0xB9, 0x63, 0x33, 0x82,
+  0xCE, 0x95, 0x2C, 0xD7, 0xB5, 0xA7, 0x36, 0x75, 0x44, 0x89, 0x85, 0x8D, 0x25, 0x8A, 0xBA, 0x6E,
+  0x74, 0x0D, 0x84, 0x5F, 0x42, 0x07, 0x84, 0x5F, 0x20, 0x06, 0xE2, 0x38, 0x20, 0x3C, 0x8A, 0x1C,
+  0x28, 0x1C, 0xA8, 0xF7, 0x05, 0x3A, 0x00, 0x0F, 0x63, 0xDF, 0x13, 0x11, 0x71, 0x99, 0xA2, 0xD6,
+  0x6B, 0x23, 0x5A, 0x8A, 0xAD, 0x72, 0x92, 0xB6, 0x42, 0x5A, 0x56, 0xA5, 0x65, 0x46, 0x2A, 0x9C,
+  0x62, 0xB2, 0x57, 0x8D, 0x96, 0xD8, 0xD4, 0x56, 0xA2, 0xD6, 0xB0, 0xE1, 0x62, 0x91, 0x84, 0xBC,
+  0x1A, 0xA3, 0x04, 0x11, 0x81, 0x94, 0x6B, 0x35, 0x99, 0xA2, 0x71, 0x13, 0xE2, 0xA6, 0xC2, 0x1D,
+  0x81, 0x7E, 0x28, 0xFD, 0x7D, 0x52, 0x54, 0x4B, 0x34, 0x4B, 0x24, 0x95, 0x55, 0x15, 0x49, 0x44,
+  0x2B, 0x22, 0x6E, 0x21, 0xFE, 0x10, 0x3F, 0xE2, 0xBF, 0x04, 0x3A, 0xA8, 0x1D, 0xC4, 0x0F, 0x62,
+  0x07, 0x02, 0xBB, 0x6F, 0x47, 0x18, 0x59, 0x62, 0xC6, 0x29, 0x12, 0x00, 0x08, 0x02, 0x45, 0xE0,
+  0x0C, 0x44, 0xE2, 0xC5, 0xE3, 0x18, 0x46, 0xC9, 0x89, 0xCC, 0xB3, 0x32, 0xB2, 0x0C, 0xCC, 0x28,
+  0xCB, 0x09, 0x40, 0xD8, 0x17, 0xC0, 0x2F, 0x63, 0xE1, 0x25, 0x04, 0xCD, 0x05, 0x45, 0x55, 0x50,
+  0x4C, 0xC4, 0x50, 0x89, 0xC8, 0xA1, 0xC8, 0x81, 0xF4, 0x50, 0xD9, 0x47, 0x70, 0x5C, 0x45, 0xF6,
+  0x28, 0x7A, 0x14, 0x3B, 0x0A, 0xF8, 0x51, 0xF8, 0xA9, 0xC2, 0x8E, 0xE2, 0xB2, 0x24, 0xA3, 0xA4,
+  0x3E, 0xC8, 0x3E, 0x51, 0x79, 0x45, 0xF2, 0x0E, 0xC9, 0x21, 0x50, 0x24, 0x44, 0xA0, 0x88, 0x21,
+  0x40, 0x42, 0x88, 0x05, 0x0D, 0x12, 0x2F, 0x44, 0x4F, 0x62, 0xBA, 0x40, 0x71, 0x53, 0xF0, 0x40,
+  0xE8, 0x2B, 0xB0, 0x01, 0xA1, 0x1E, 0xEA, 0x9E, 0x45, 0x0F, 0x08, 0xBD, 0x45, 0x7A, 0xA2, 0x6C,
+  0x28, 0x7E, 0x22, 0x7F, 0x0B, 0xB9, 0x22, 0x9C, 0x28, 0x48, 0x66, 0xD1, 0x6B, 0x5C, 0x80,
+};
+
+// bzip2-runs-level9
+STATIC CONST UINT8  mFixture7[] = {
+  0x42, 0x5A, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x2A, 0xE2, 0xEA, 0xF6, 0x00, 0x00,
+  0x25, 0xF7, 0x7E, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x81, 0x00, 0x04, 0x04, 0x00, 0x08,
+  0x00, 0x00, 0x80, 0x00, 0x10, 0x08, 0x00, 0x20, 0x04, 0x20, 0x00, 0x40, 0x08, 0x20, 0x00, 0x48,
+  0x49, 0x53, 0xD4, 0x68, 0x0F, 0x53, 0x13, 0xF4, 0xA0, 0xD0, 0xD4, 0x00, 0xD0, 0x07, 0x47, 0x73,
+  0x1E, 0x59, 0x08, 0x9C, 0xED, 0x96, 0xF5, 0xBC, 0x80, 0xAF, 0x58, 0x14, 0x05, 0x93, 0x6E, 0xAC,
+  0x20, 0xC1, 0xD4, 0x69, 0x0A, 0x28, 0xC5, 0x94, 0x82, 0x8A, 0x19, 0x3E, 0x2E, 0xE4, 0x8A, 0x70,
+  0xA1, 0x20, 0x55, 0xC5, 0xD5, 0xEC,
+};
+
+// bzip2-random-level9
+STATIC CONST UINT8  mFixture8[] = {
+  0x42, 0x5A, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x09, 0x83, 0x39, 0xD7, 0x00, 0x00,
+  0x0E, 0x7F, 0xFF, 0xF8, 0xD9, 0xFA, 0xF4, 0x3F, 0xF5, 0xFB, 0xEB, 0xBB, 0xDB, 0x3F, 0x7A, 0xF7,
+  0x9C, 0xAD, 0x7C, 0xFE, 0xB6, 0xFF, 0xF7, 0x7A, 0xDF, 0x6A, 0xFE, 0xF6, 0xDB, 0xBD, 0xD4, 0x9B,
+  0xE9, 0xFE, 0xEF, 0x30, 0x00, 0xF9, 0xAC, 0x8E, 0x41, 0xA0, 0x00, 0x00, 0x1A, 0x1A, 0x34, 0x03,
+  0x40, 0xC8, 0xD1, 0xA1, 0xA0, 0x34, 0x06, 0x83, 0x40, 0x19, 0x00, 0x0C, 0x87, 0xA8, 0xC0, 0x86,
+  0x20, 0x00, 0x00, 0x34, 0x06, 0x40, 0x06, 0x99, 0x1E, 0xD5, 0x0F, 0x53, 0x4F, 0x69, 0x4F, 0x44,
+  0x40, 0x1A, 0x0D, 0x00, 0xC9, 0x90, 0x03, 0x4D, 0x18, 0x83, 0x40, 0x18, 0x80, 0xD1, 0x90, 0xC8,
+  0x60, 0x20, 0x01, 0xA1, 0xA6, 0x81, 0xA0, 0xD0, 0x1A, 0x60, 0x99, 0x0C, 0x9A, 0x34, 0x30, 0x98,
+  0x46, 0x98, 0x23, 0x43, 0x26, 0x83, 0x13, 0x10, 0x34, 0x38, 0x80, 0x34, 0xC9, 0xA0, 0x64, 0x34,
+  0x06, 0x9A, 0x1E, 0xA0, 0xD1, 0xA0, 0x01, 0xA6, 0x83, 0x20, 0x34, 0x7A, 0x9A, 0x00, 0xC8, 0x1A,
+  0x34, 0xF5, 0x34, 0x68, 0x68, 0x30, 0x9E, 0xA0, 0x06, 0x4C, 0x80, 0x03, 0x47, 0xA8, 0xD0, 0x3D,
+  0x4F, 0x53, 0x41, 0x90, 0x69, 0x93, 0x10, 0xC0, 0xA6, 0x02, 0x41, 0xE4, 0x84, 0x02, 0x30, 0x44,
+  0xEF, 0x0E, 0x16, 0xFC, 0x04, 0xC8, 0x8A, 0x0E, 0x31, 0x70, 0x0C, 0xB8, 0x95, 0xB6, 0x3A, 0x4B,
+  0x4D, 0xD6, 0x13, 0x6A, 0x0F, 0xFD, 0x93, 0x2D, 0x88, 0xCE, 0x64, 0x95, 0x3F, 0x67, 0xB5, 0xC8,
+  0x41, 0xA7, 0xB4, 0xF5, 0xCD, 0x64, 0xE0, 0xF5, 0x9D, 0x43, 0xCC, 0xF3, 0xF9, 0x08, 0x1D, 0x55,
+  0xC7, 0x73, 0x98, 0x7D, 0x14, 0xC1, 0xF4, 0x25, 0x4C, 0xA8, 0x4F, 0x0F, 0x93, 0x08, 0x98, 0xDD,
+  0x82, 0xD1, 0x95, 0xA5, 0x0B, 0x19, 0xFC, 0x54, 0x82, 0xF2, 0xC8, 0xAF, 0x4D, 0x9C, 0x37, 0xB8,
+  0x60, 0x10, 0x33, 0x0B, 0x7C, 0xC6, 0x13, 0x8D, 0x17, 0x4D, 0x19, 0xD5, 0x78, 0xD8, 0x69, 0xE7,
+  0xF9, 0x1F, 0x81, 0x15, 0xC7, 0x1E, 0x79, 0x61, 0xEA, 0x1A, 0xEF, 0xD6, 0x38, 0x82, 0xE3, 0x16,
+  0x8A, 0xD4, 0x42, 0x56, 0x95, 0x34, 0x92, 0x43, 0xFC, 0x11, 0x08, 0xC4, 0xF0, 0x67, 0xE7, 0xB0,
+  0xB4, 0xEF, 0x48, 0x65, 0xDA, 0x36, 0xD3, 0x6E, 0x05, 0x33, 0x01, 0xCC, 0x76, 0xB7, 0x82, 0x69,
+  0x71, 0x42, 0x68, 0xA5, 0x53, 0x66, 0xBC, 0x73, 0x72, 0x47, 0x4A, 0x50, 0x6F, 0xD7, 0x30, 0xDC,
+  0x5F, 0x3C, 0x97, 0x5A, 0x23, 0xAC, 0x49, 0x38, 0x6E, 0x26, 0x74, 0x4C, 0xDB, 0xFD, 0x0D, 0xA9,
+  0x33, 0xC6, 0x16, 0x6B, 0x3D, 0x7A, 0xF7, 0x9A, 0x97, 0xE0, 0xF1, 0x1D, 0x8C, 0x01, 0x70, 0x1A,
+  0x5E, 0x8B, 0xEB, 0x95, 0xD0, 0xC8, 0x18, 0xBD, 0x50, 0x1E, 0xAE, 0xB4, 0xAB, 0x46, 0xE5, 0x46,
+  0x01, 0x44, 0x15, 0x1A, 0xD9, 0x2F, 0x3F, 0x95, 0xFE, 0x5E, 0x82, 0xBB, 0xB6, 0x7D, 0xF6, 0x60,
+  0x8B, 0xE1, 0xCC, 0x51, 0x87, 0xFD, 0xDD, 0x18, 0x03, 0x08, 0x24, 0xA4, 0x50, 0x58, 0x33, 0x56,
+  0xD9, 0x4E, 0x70, 0x06, 0x38, 0x15, 0x01, 0x96, 0x70, 0x60, 0x9B, 0xA2, 0x0C, 0x84, 0x92, 0x09,
+  0x6E, 0xDF, 0x2E, 0x1D, 0xC1, 0xEC, 0xA7, 0xA2, 0xEE, 0x48, 0xA7, 0x0A, 0x12, 0x01, 0x30, 0x67,
+  0x3A, 0xE0,
+};
+
+// bzip2-mixed-level9
+STATIC CONST UINT8  mFixture9[] = {
+  0x42, 0x5A, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0xA5, 0x60, 0xF2, 0x46, 0x00, 0x02,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xDF, 0xFF, 0x7B, 0xD0, 0x04, 0x13, 0x84, 0xD7, 0x80, 0x07, 0xBA, 0x4E, 0xB4, 0x74, 0x68, 0x26,
+  0xD3, 0x43, 0x40, 0x9E, 0x84, 0xD3, 0x03, 0x43, 0x46, 0xA6, 0x00, 0x43, 0x4C, 0x04, 0x1A, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x8C, 0x98, 0x4C, 0x00, 0xD1, 0xA4, 0xC8, 0x0C, 0x98, 0x68, 0x10, 0x18,
+  0xD0, 0x03, 0x43, 0x40, 0x00, 0x00, 0xF5, 0x1A, 0x00, 0x04, 0x7A, 0x98, 0x06, 0x88, 0xC9, 0xA7,
+  0xA9, 0x81, 0x91, 0x04, 0xCD, 0x4F, 0x6A, 0x99, 0x0C, 0x26, 0x69, 0x34, 0xDA, 0x9E, 0x9E, 0xA0,
+  0x13, 0x11, 0x91, 0xA6, 0x46, 0xD2, 0x30, 0x00, 0x00, 0x98, 0x27, 0xA9, 0x82, 0x7A, 0x4C, 0x8F,
+  0x41, 0xA9, 0xE0, 0xA3, 0x69, 0x91, 0xA0, 0x00, 0x3D, 0x46, 0x84, 0xC0, 0xD2, 0x1E, 0x80, 0x02,
+  0x69, 0x90, 0xD1, 0xBD, 0x40, 0x26, 0x23, 0x4D, 0x30, 0x13, 0x4D, 0x0C, 0x4D, 0x1A, 0x6D, 0x4C,
+  0x26, 0x9A, 0x64, 0xD3, 0x26, 0x1A, 0x8C, 0x72, 0x00, 0x34, 0x0C, 0x9A, 0x34, 0x68, 0x26, 0x00,
+  0x13, 0x26, 0x1A, 0x1A, 0x1A, 0x23, 0x13, 0xD0, 0x00, 0x9E, 0xA6, 0xD1, 0x34, 0x6D, 0x23, 0x00,
+  0x00, 0x00, 0x08, 0x69, 0x89, 0x84, 0xC0, 0x00, 0x00, 0x04, 0xDA, 0x09, 0x84, 0xD3, 0x4C, 0x98,
+  0x4C, 0x98, 0x01, 0x36, 0x81, 0xA0, 0x34, 0x00, 0x0D, 0x00, 0x98, 0x26, 0x82, 0x29, 0xE1, 0x0A,
+  0x88, 0x34, 0x0D, 0x00, 0x0D, 0x1A, 0x06, 0x80, 0x1B, 0x53, 0x4D, 0x32, 0x0C, 0x81, 0x90, 0x00,
+  0xC9, 0xA0, 0x00, 0x0D, 0x03, 0x43, 0x43, 0x20, 0x68, 0x62, 0x00, 0x0D, 0x1A, 0x00, 0x68, 0x01,
+  0xA3, 0x04, 0x0D, 0x00, 0x00, 0x1A, 0x00, 0x01, 0xA0, 0xC8, 0x00, 0x06, 0x83, 0x04, 0x60, 0x91,
+  0x49, 0x11, 0x4C, 0x27, 0xEA, 0x98, 0x7A, 0x4D, 0x04, 0x62, 0x7A, 0x9B, 0x29, 0x8D, 0x4C, 0x4C,
+  0x68, 0xD4, 0xD0, 0x31, 0x0D, 0x18, 0x43, 0x11, 0x89, 0x80, 0x8D, 0x30, 0x00, 0x86, 0x47, 0xA9,
+  0x84, 0xC8, 0x60, 0x99, 0x03, 0x00, 0x40, 0xD1, 0x84, 0x3D, 0x4C, 0x26, 0x98, 0x08, 0x06, 0x68,
+  0x4C, 0x06, 0x82, 0x69, 0xB4, 0x8C, 0xD4, 0x06, 0x98, 0x08, 0xD1, 0x88, 0x68, 0xF5, 0x08, 0xF1,
+  0x63, 0x4E, 0x0A, 0xB2, 0x51, 0x54, 0x39, 0x8C, 0xC6, 0x0A, 0x4F, 0xF6, 0xFC, 0x00, 0x7E, 0x34,
+  0x70, 0xC4, 0x70, 0x20, 0x5F, 0x22, 0x11, 0x21, 0x64, 0x91, 0x65, 0x1F, 0xF5, 0xA2, 0xC2, 0x75,
+  0x08, 0xB6, 0xBF, 0xE0, 0xD4, 0x80, 0x67, 0xF3, 0x95, 0x69, 0xE5, 0x93, 0xA7, 0x94, 0x0A, 0xF0,
+  0xC8, 0xC0, 0xC7, 0x00, 0xA1, 0xC7, 0x19, 0x32, 0xCC, 0x74, 0x8C, 0x91, 0x5C, 0x0B, 0x65, 0xD1,
+  0xCF, 0x23, 0x56, 0xD9, 0xF9, 0x47, 0xFD, 0xAF, 0x57, 0xB8, 0x7F, 0xAD, 0x79, 0x54, 0x28, 0x64,
+  0xD6, 0x2A, 0x22, 0xEB, 0x61, 0x19, 0x12, 0xCB, 0xD3, 0x4F, 0x7D, 0x10, 0xE5, 0x1C, 0x6F, 0xC1,
+  0x55, 0x70, 0x5C, 0x2A, 0xED, 0x1E, 0x5E, 0x75, 0x62, 0x80, 0xF0, 0x03, 0x6F, 0xD6, 0x08, 0x9D,
+  0x96, 0xC2, 0x4A, 0x50, 0x8D, 0xB0, 0x89, 0x68, 0xB3, 0x07, 0x02, 0x30, 0x31, 0x53, 0x16, 0x66,
+  0x48, 0x40, 0x17, 0x74, 0x24, 0x11, 0x51, 0xB4, 0x6A, 0x01, 0x68, 0xC5, 0x82, 0xD3, 0x10, 0x84,
+  0x56, 0x4A, 0x30, 0x22, 0x59, 0xAC, 0x51, 0x11, 0x0C, 0xD4, 0xA6, 0x0A, 0x2C, 0x94, 0x22, 0x24,
+  0x60, 0x24, 0xA2, 0x00, 0x26, 0x81, 0x48, 0x42, 0x84, 0x8B, 0x22, 0x40, 0x26, 0x88, 0x44, 0x80,
+  0x48, 0x96, 0x21, 0x2E, 0x66, 0x26, 0xA5, 0x18, 0x1A, 0x13, 0x40, 0xC6, 0x23, 0x4D, 0xCB, 0x51,
+  0xB0, 0x18, 0x8B, 0x45, 0x43, 0x92, 0x01, 0xB0, 0x4B, 0x6E, 0xB2, 0x79, 0xD6, 0xD5, 0xEC, 0x6E,
+  0x9B, 0x97, 0xEE, 0xDF, 0xAF, 0x83, 0x05, 0x8C, 0xE8, 0xF2, 0x1B, 0x47, 0xD9, 0x9B, 0x6B, 0xB3,
+  0x1D, 0xC6, 0x1B, 0x29, 0x5F, 0x5B, 0xF0, 0x3C, 0xCD, 0xE4, 0xC2, 0xEC, 0x67, 0x2A, 0x44, 0xA0,
+  0x49, 0xCD, 0x70, 0xA7, 0x36, 0x2D, 0x09, 0x77, 0x92, 0xD1, 0x0A, 0x78, 0x1F, 0xD2, 0x31, 0x83,
+  0x12, 0x79, 0x2B, 0x7B, 0xFC, 0xD7, 0x86, 0x8D, 0xD8, 0x85, 0x4C, 0x90, 0x58, 0xE3, 0x66, 0xCF,
+  0xAE, 0x43, 0x98, 0x1C, 0xE6, 0x10, 0xAC, 0x20, 0xB6, 0xF0, 0x46, 0xDE, 0x13, 0x9D, 0x13, 0xD0,
+  0xFA, 0x9E, 0xD6, 0xAC, 0x1F, 0x5F, 0x71, 0x12, 0x2C, 0x82, 0x56, 0xAC, 0x1D, 0x10, 0x79, 0xEA,
+  0xEE, 0x24, 0x2E, 0x2E, 0xD1, 0x58, 0x8B, 0x7E, 0xE7, 0xA1, 0x38, 0x29, 0xD5, 0x3A, 0x0D, 0x70,
+  0xFC, 0x00, 0x2A, 0x18, 0x04, 0x01, 0x3A, 0x6F, 0x02, 0x6E, 0x0A, 0xF7, 0x07, 0x28, 0x88, 0xF8,
+  0x1B, 0x71, 0xD6, 0xC3, 0x81, 0xC1, 0xA9, 0x14, 0x4A, 0x6E, 0xCD, 0xCB, 0x97, 0xCC, 0x9E, 0xBC,
+  0x45, 0xBB, 0x22, 0xC7, 0x81, 0xCA, 0xB0, 0x8B, 0x59, 0x67, 0xE1, 0xC4, 0xAD, 0x27, 0x34, 0xAD,
+  0x59, 0x88, 0x3B, 0x39, 0x1C, 0xCF, 0x10, 0x71, 0x39, 0xD4, 0xD1, 0xE6, 0x0E, 0x97, 0x18, 0x67,
+  0x9E, 0x81, 0x4E, 0x69, 0xE4, 0x31, 0x10, 0x05, 0xA9, 0x6B, 0x6F, 0x4B, 0x79, 0x48, 0x18, 0x49,
+  0xB4, 0x1E, 0x8C, 0xE8, 0xC0, 0x4A, 0x24, 0x13, 0x63, 0x05, 0xB2, 0x1B, 0x68, 0x10, 0x57, 0xC4,
+  0xE9, 0x04, 0xEB, 0x23, 0xBB, 0xBD, 0x46, 0xCB, 0x72, 0x6B, 0x1C, 0x99, 0x37, 0x1D, 0xCC, 0x7A,
+  0x2D, 0x4E, 0x4E, 0x99, 0x7F, 0xCA, 0xDB, 0x27, 0xB3, 0x82, 0x56, 0x06, 0x83, 0x78, 0x80, 0xFE,
+  0x76, 0x1D, 0x8C, 0xAF, 0x4A, 0x06, 0x19, 0xAB, 0x08, 0x97, 0xC5, 0xA3, 0xEB, 0x90, 0x46, 0x46,
+  0xEE, 0x8E, 0x14, 0x8D, 0x13, 0x4C, 0xB2, 0xE2, 0xE0, 0x52, 0x3B, 0xEB, 0x46, 0xAB, 0xFB, 0xD9,
+  0xC4, 0x58, 0xC4, 0x7B, 0x89, 0x7D, 0x62, 0x34, 0x62, 0x46, 0x22, 0x82, 0x7E, 0x55, 0x2D, 0x13,
+  0x37, 0xAF, 0xF5, 0x6A, 0x7D, 0xA3, 0x9F, 0x6E, 0x84, 0xFB, 0x0A, 0x16, 0x96, 0x93, 0xAC, 0x84,
+  0xCE, 0x9A, 0xB2, 0x31, 0x4A, 0xB2, 0x10, 0x84, 0x50, 0x64, 0x44, 0x50, 0x83, 0x70, 0x8A, 0x27,
+  0x13, 0x83, 0x88, 0x6D, 0xC5, 0x06, 0x31, 0xB7, 0x08, 0x42, 0x21, 0x8D, 0xB8, 0x80, 0x98, 0x12,
+  0x8E, 0x16, 0x36, 0xA4, 0xBF, 0x9B, 0xED, 0xC2, 0x48, 0xF7, 0xA5, 0x03, 0x2A, 0x22, 0x8A, 0xD0,
+  0xC6, 0xC6, 0xD8, 0xDB, 0x43, 0x6C, 0x18, 0x17, 0x0F, 0x93, 0x8B, 0xF9, 0x76, 0x96, 0xCF, 0x3A,
+  0x60, 0x4B, 0xD0, 0xB3, 0xE7, 0x74, 0xD4, 0x12, 0x67, 0x76, 0x53, 0xA8, 0x0F, 0xBA, 0xF9, 0xF7,
+  0xD0, 0xE4, 0xEB, 0x1C, 0x50, 0x0F, 0x6E, 0x62, 0xDD, 0x5B, 0x12, 0xAB, 0xA5, 0x5A, 0x3B, 0xD7,
+  0x3A, 0xF8, 0xED, 0x1C, 0x76, 0x1D, 0xCA, 0x45, 0x75, 0x0B, 0x55, 0xAB, 0xFF, 0xB4, 0x3A, 0xBA,
+  0x7D, 0x3A, 0x6D, 0x36, 0xC8, 0x42, 0x0D, 0xC2, 0x10, 0x50, 0x82, 0x70, 0x80, 0x41, 0xB2, 0x0C,
+  0x85, 0x4F, 0x7F, 0xD4, 0x5C, 0x23, 0xA5, 0x69, 0x90, 0xA6, 0x6E, 0x7F, 0x64, 0xBC, 0x41, 0x2F,
+  0x8B, 0x63, 0x6D, 0xB1, 0x8D, 0xB4, 0xD3, 0x11, 0xDD, 0x02, 0xD2, 0xDA, 0x90, 0x19, 0xC0, 0x52,
+  0x82, 0x28, 0x2A, 0x61, 0x10, 0x05, 0xD2, 0x5A, 0x44, 0xF5, 0x9C, 0x47, 0x64, 0x0B, 0xA9, 0x14,
+  0x62, 0xE8, 0xD1, 0x38, 0xE0, 0x25, 0x2C, 0x22, 0x9C, 0x26, 0x06, 0x9E, 0xFF, 0x77, 0xF6, 0x25,
+  0x65, 0x04, 0x3F, 0xEB, 0xF1, 0xDD, 0x7A, 0xBF, 0x4C, 0x7A, 0xAA, 0x44, 0xE2, 0x45, 0x27, 0xED,
+  0x5C, 0x9E, 0xA3, 0xAB, 0xA5, 0x20, 0x6C, 0x63, 0x06, 0xDA, 0x1B, 0x1B, 0x6D, 0x94, 0xA6, 0x21,
+  0xC9, 0x65, 0xA1, 0xAA, 0xFA, 0x14, 0x70, 0xCC, 0x30, 0x37, 0xB5, 0x9F, 0x5A, 0xD5, 0xCD, 0xDD,
+  0x52, 0x90, 0x51, 0xB5, 0xCF, 0xDB, 0x57, 0x52, 0x34, 0x36, 0x68, 0xF3, 0x73, 0x92, 0x45, 0x55,
+  0x12, 0x8D, 0x31, 0x2F, 0x01, 0x7E, 0x93, 0x42, 0x53, 0x3F, 0x06, 0xE3, 0x49, 0xC8, 0xD9, 0xD8,
+  0x01, 0x4D, 0x00, 0x52, 0xE5, 0xFE, 0xA9, 0x64, 0x2A, 0x78, 0x11, 0x8B, 0xD3, 0x62, 0x28, 0x02,
+  0x00, 0x79, 0x41, 0x90, 0x41, 0x51, 0x22, 0xFD, 0xE2, 0xA2, 0x89, 0x9F, 0x00, 0x00, 0x00, 0x8D,
+  0x2B, 0x60, 0x4C, 0x00, 0xE1, 0xAD, 0xC9, 0x1C, 0xBD, 0x61, 0xE5, 0x37, 0x8B, 0xB4, 0x80, 0x50,
+  0xFF, 0x31, 0xDF, 0xF9, 0xAA, 0x82, 0x86, 0x72, 0xAC, 0x66, 0xD6, 0x56, 0x74, 0xC9, 0x59, 0x9E,
+  0x25, 0x75, 0x8A, 0x3C, 0x55, 0x13, 0x62, 0xD8, 0xE0, 0x4F, 0x23, 0xD2, 0xE4, 0x75, 0x50, 0xFB,
+  0xA4, 0x8E, 0x5F, 0x05, 0xCA, 0x67, 0xCD, 0x59, 0x04, 0xC6, 0x12, 0xEE, 0xCB, 0x99, 0x54, 0x18,
+  0xF4, 0x45, 0xF0, 0x35, 0xE4, 0x97, 0x72, 0xDE, 0x22, 0xF3, 0x48, 0x53, 0xDB, 0xD0, 0x30, 0x63,
+  0x84, 0x4E, 0x20, 0x9D, 0xB5, 0x60, 0x6D, 0x0D, 0x0B, 0x1C, 0x88, 0x24, 0x74, 0xF9, 0x82, 0xB1,
+  0x87, 0xCF, 0x6A, 0x21, 0x1D, 0xD9, 0x3E, 0x61, 0xCF, 0x84, 0x90, 0xFF, 0x2D, 0x8E, 0xED, 0xE0,
+  0xC2, 0x67, 0x7C, 0x1F, 0xC4, 0xF6, 0xA6, 0x90, 0x4C, 0xA4, 0xC5, 0x8A, 0x34, 0x8E, 0x5E, 0x11,
+  0xF6, 0xA2, 0xB9, 0x20, 0xA3, 0x34, 0xB0, 0xA9, 0xEA, 0xA8, 0xDE, 0xE7, 0x46, 0x31, 0xAD, 0x0A,
+  0x94, 0x24, 0x8A, 0xDE, 0x43, 0xB2, 0xAA, 0xC7, 0x37, 0xEC, 0x50, 0xC1, 0x99, 0xE0, 0xBC, 0x76,
+  0x47, 0x50, 0x08, 0xA2, 0x26, 0x5F, 0xCB, 0x04, 0xFC, 0xA9, 0x01, 0x74, 0x79, 0x28, 0x7C, 0x07,
+  0x4C, 0x3C, 0xC8, 0xE8, 0x39, 0xF7, 0x21, 0x85, 0xC9, 0xFC, 0xC2, 0xA4, 0x99, 0x45, 0x45, 0x5F,
+  0x09, 0x29, 0x33, 0xBC, 0x1C, 0x52, 0xA4, 0x93, 0xD2, 0x6F, 0x28, 0x50, 0x08, 0x4C, 0x93, 0x3B,
+  0xD9, 0xEC, 0x84, 0x26, 0xE0, 0xCB, 0xF7, 0x12, 0x49, 0x1A, 0x0A, 0x91, 0x7C, 0x47, 0xE4, 0x6D,
+  0x70, 0xDC, 0x14, 0x1C, 0xDF, 0x72, 0xB0, 0x5F, 0xD9, 0xFF, 0x8C, 0x62, 0xA9, 0x1F, 0x58, 0x38,
+  0x8A, 0x65, 0xE9, 0x8E, 0x9A, 0x72, 0xA2, 0xDA, 0x95, 0xD8, 0x77, 0xD5, 0x35, 0x2D, 0x2B, 0xEE,
+  0x03, 0xDF, 0xF0, 0xA6, 0xEE, 0xAC, 0xA8, 0xEE, 0x0C, 0xE4, 0x72, 0x19, 0xC8, 0x6D, 0x43, 0x1B,
+  0xB6, 0x69, 0xC3, 0x70, 0x10, 0x03, 0x29, 0xDC, 0x3F, 0x2C, 0x6E, 0x03, 0xD5, 0x67, 0xD6, 0xFF,
+  0xE7, 0x9E, 0x1B, 0xCD, 0x47, 0x00, 0xA2, 0x14, 0xA4, 0xBE, 0x98, 0xA7, 0x0E, 0xA1, 0x0B, 0x31,
+  0x63, 0x26, 0x96, 0x77, 0x3F, 0x24, 0xE9, 0x86, 0xDF, 0xC6, 0xB7, 0x25, 0x9F, 0xAC, 0x3B, 0x32,
+  0x48, 0xA5, 0xDA, 0x90, 0x13, 0x88, 0x68, 0x54, 0x16, 0x87, 0x1F, 0x5D, 0xB3, 0x62, 0xAF, 0x54,
+  0xE1, 0xFB, 0x0F, 0x65, 0xB7, 0x58, 0xFA, 0x4C, 0xA0, 0x9B, 0x17, 0xF8, 0xC1, 0x80, 0xA0, 0x94,
+  0xE4, 0x68, 0xA0, 0x74, 0x57, 0x8E, 0x54, 0xAA, 0xBA, 0x43, 0x5B, 0xB0, 0x44, 0xE0, 0xBB, 0xD8,
+  0x16, 0xF6, 0xF7, 0x9A, 0xC3, 0xCF, 0x48, 0x03, 0x0F, 0x83, 0xE7, 0x25, 0x5A, 0x6A, 0x21, 0x5E,
+  0x12, 0x84, 0x68, 0xD2, 0xFA, 0x4F, 0x82, 0x1B, 0xA7, 0x86, 0x2D, 0x70, 0xD8, 0x9F, 0x00, 0x3B,
+  0x6D, 0x94, 0x08, 0x7B, 0xD1, 0xD3, 0x8E, 0xBE, 0x80, 0xF9, 0xD2, 0x8C, 0xBF, 0xA6, 0x84, 0x8C,
+  0xB0, 0x61, 0xE1, 0xC8, 0x00, 0x34, 0x31, 0x98, 0x23, 0xBA, 0xD4, 0x4C, 0x56, 0xA2, 0xD5, 0x3D,
+  0x62, 0xEE, 0x48, 0xA7, 0x0A, 0x12, 0x14, 0xAC, 0x1E, 0x48, 0xC0,
+};
+
+// bzip2-text-level1
+STATIC CONST UINT8  mFixture10[] = {
+  0x42, 0x5A, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0xCD, 0xA2, 0xD6, 0xB9, 0x00, 0x04,
+  0x9A, 0x11, 0x80, 0x40, 0x00, 0x3F, 0xEF, 0xDF, 0x20, 0x40, 0x03, 0x14, 0x4A, 0x72, 0x45, 0x0E,
+  0x83, 0x53, 0xC1, 0x15, 0x46, 0x4D, 0x18, 0x10, 0x6A, 0x7E, 0x48, 0x92, 0x88, 0xDA, 0x20, 0x30,
+  0xD3, 0xF5, 0x55, 0x18, 0x00, 0x00, 0x10, 0xA4, 0xA6, 0x83, 0x25, 0x36, 0x6A, 0x9E, 0x9A, 0x7F,
+  0x3F, 0x3E, 0x22, 0x7E, 0xC3, 0xD3, 0x6E, 0x16, 0x95, 0x79, 0x6A, 0xCB, 0x0E, 0x28, 0x41, 0x27,
+  0xAF, 0xFF, 0xB6, 0x64, 0xA6, 0xDD, 0xB6, 0x57, 0x12, 0x74, 0xBE, 0x12, 0xF4, 0xB7, 0xC6, 0xC2,
+  0xDD, 0x8C, 0x35, 0x36, 0x0C, 0x26, 0xC4, 0x31, 0x41, 0x84, 0x5E, 0x24, 0xED, 0xA1, 0xB9, 0x32,
+  0xB0, 0x6A, 0x06, 0xAC, 0x4A, 0xDB, 0xA6, 0x08, 0x6D, 0x8D, 0xD3, 0x72, 0x0C, 0x2C, 0x9C, 0x96,
+  0x71, 0x91, 0x4C, 0x4D, 0x8D, 0x51, 0x04, 0xF7, 0x36, 0x28, 0x11, 0x11, 0x8D, 0x61, 0x10, 0xAD,
+  0x62, 0x93, 0x26, 0x6B, 0xB9, 0x85, 0xC5, 0xEE, 0xA6, 0x64, 0xB4, 0x79, 0xC6, 0x0E, 0xF8, 0x63,
+  0x6E, 0x24, 0x89, 0xE3, 0x74, 0xD3, 0x48, 0x40, 0xB1, 0x17, 0x4F, 0x31, 0xCF, 0x18, 0xCB, 0x0E,
+  0xD4, 0xC5, 0xED, 0x2E, 0x9D, 0xD6, 0x01, 0x11, 0x46, 0x6A, 0xE6, 0xE5, 0x14, 0x0D, 0xD5, 0x8E,
+  0x60, 0xC1, 0x93, 0x73, 0x98, 0x0F, 0x26, 0xA6, 0x52, 0x69, 0xA2, 0x8C, 0xA8, 0x83, 0x6C, 0x48,
+  0xBD, 0x7B, 0x73, 0x62, 0xCD, 0x6C, 0xED, 0xB8, 0x6B, 0xE5, 0xE1, 0xD5, 0xB9, 0x63, 0x33, 0x82,
+  0xCE, 0x95, 0x2C, 0xD7, 0xB5, 0xA7, 0x36, 0x75, 0x44, 0x89, 0x85, 0x8D, 0x25, 0x8A, 0xBA, 0x6E,
+  0x74, 0x0D, 0x84, 0x5F, 0x42, 0x07, 0x84, 0x5F, 0x20, 0x06, 0xE2, 0x38, 0x20, 0x3C, 0x8A, 0x1C,
+  0x28, 0x1C, 0xA8, 0xF7, 0x05, 0x3A, 0x00, 0x0F, 0x63, 0xDF, 0x13, 0x11, 0x71, 0x99, 0xA2, 0xD6,
+  0x6B, 0x23, 0x5A, 0x8A, 0xAD, 0x72, 0x92, 0xB6, 0x42, 0x5A, 0x56, 0xA5, 0x65, 0x46, 0x2A, 0x9C,
+  0x62, 0xB2, 0x57, 0x8D, 0x96, 0xD8, 0xD4, 0x56, 0xA2, 0xD6, 0xB0, 0xE1, 0x62, 0x91, 0x84, 0xBC,
+  0x1A, 0xA3, 0x04, 0x11, 0x81, 0x94, 0x6B, 0x35, 0x99, 0xA2, 0x71, 0x13, 0xE2, 0xA6, 0xC2, 0x1D,
+  0x81, 0x7E, 0x28, 0xFD, 0x7D, 0x52, 0x54, 0x4B, 0x34, 0x4B, 0x24, 0x95, 0x55, 0x15, 0x49, 0x44,
+  0x2B, 0x22, 0x6E, 0x21, 0xFE, 0x10, 0x3F, 0xE2, 0xBF, 0x04, 0x3A, 0xA8, 0x1D, 0xC4, 0x0F, 0x62,
+  0x07, 0x02, 0xBB, 0x6F, 0x47, 0x18, 0x59, 0x62, 0xC6, 0x29, 0x12, 0x00, 0x08, 0x02, 0x45, 0xE0,
+  0x0C, 0x44, 0xE2, 0xC5, 0xE3, 0x18, 0x46, 0xC9, 0x89, 0xCC, 0xB3, 0x32, 0xB2, 0x0C, 0xCC, 0x28,
+  0xCB, 0x09, 0x40, 0xD8, 0x17, 0xC0, 0x2F, 0x63, 0xE1, 0x25, 0x04, 0xCD, 0x05, 0x45, 0x55, 0x50,
+  0x4C, 0xC4, 0x50, 0x89, 0xC8, 0xA1, 0xC8, 0x81, 0xF4, 0x50, 0xD9, 0x47, 0x70, 0x5C, 0x45, 0xF6,
+  0x28, 0x7A, 0x14, 0x3B, 0x0A, 0xF8, 0x51, 0xF8, 0xA9, 0xC2, 0x8E, 0xE2, 0xB2, 0x24, 0xA3, 0xA4,
+  0x3E, 0xC8, 0x3E, 0x51, 0x79, 0x45, 0xF2, 0x0E, 0xC9, 0x21, 0x50, 0x24, 0x44, 0xA0, 0x88, 0x21,
+  0x40, 0x42, 0x88, 0x05, 0x0D, 0x12, 0x2F, 0x44, 0x4F, 0x62, 0xBA, 0x40, 0x71, 0x53, 0xF0, 0x40,
+  0xE8, 0x2B, 0xB0, 0x01, 0xA1, 0x1E, 0xEA, 0x9E, 0x45, 0x0F, 0x08, 0xBD, 0x45, 0x7A, 0xA2, 0x6C,
+  0x28, 0x7E, 0x22, 0x7F, 0x0B, 0xB9, 0x22, 0x9C, 0x28, 0x48, 0x66, 0xD1, 0x6B, 0x5C, 0x80,
+};
+
+// bzip2-mixed-concatenated
+STATIC CONST UINT8  mFixture11[] = {
+  0x42, 0x5A, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x40, 0x5F, 0x02, 0x50, 0x00, 0x01,
+  0x9B, 0x7F, 0xFF, 0xFD, 0xFF, 0x3E, 0xBF, 0xFB, 0xBD, 0xDE, 0xFF, 0xFD, 0xD7, 0xFF, 0xFD, 0xFF,
+  0xEF, 0xFF, 0xAF, 0xFF, 0xF3, 0x56, 0x39, 0xBD, 0xDC, 0xFB, 0xFE, 0x97, 0xE7, 0x7E, 0xED, 0x8B,
+  0x5F, 0xCB, 0x3B, 0xC0, 0x02, 0x17, 0x24, 0x06, 0x68, 0xA9, 0x40, 0x6D, 0x27, 0xA4, 0xD0, 0xF5,
+  0x1A, 0x3D, 0x40, 0x03, 0x41, 0xA1, 0xA1, 0x90, 0x00, 0xD0, 0x00, 0x64, 0x01, 0xA0, 0x00, 0x1A,
+  0x00, 0x00, 0x01, 0xA0, 0x34, 0x06, 0x81, 0xA0, 0x00, 0x00, 0x68, 0x00, 0x00, 0xF4, 0x86, 0x8D,
+  0x34, 0x7A, 0x43, 0xA0, 0x0D, 0x00, 0xD0, 0x34, 0x06, 0x80, 0xC8, 0x00, 0x3D, 0x40, 0x68, 0x1A,
+  0x0F, 0x50, 0x03, 0x4C, 0x40, 0x34, 0x00, 0x0F, 0x48, 0xCD, 0x26, 0x43, 0x40, 0x00, 0x00, 0x03,
+  0x46, 0x40, 0x34, 0xD3, 0x6A, 0x31, 0x01, 0xA0, 0x68, 0x1A, 0x34, 0x1A, 0x1E, 0xA1, 0x03, 0x43,
+  0x21, 0xA1, 0x90, 0x68, 0xD0, 0x0D, 0x01, 0xA6, 0x8D, 0x01, 0xA6, 0x8C, 0x26, 0x43, 0x20, 0x01,
+  0x81, 0x32, 0x64, 0x00, 0x68, 0xD0, 0xC8, 0xD0, 0x01, 0x84, 0x34, 0x34, 0x68, 0x01, 0xA0, 0x00,
+  0x68, 0x00, 0xC8, 0x06, 0x9A, 0x64, 0x06, 0x80, 0x04, 0xA6, 0x92, 0x28, 0x8D, 0x1A, 0x64, 0xC8,
+  0xC4, 0x34, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x40, 0x00, 0x03, 0x40, 0x1A, 0x06, 0x8D,
+  0x00, 0x00, 0x00, 0x03, 0x46, 0x80, 0x34, 0x34, 0x00, 0x1A, 0x0D, 0x00, 0x68, 0x00, 0x68, 0xAC,
+  0x1D, 0xAC, 0x41, 0x48, 0x1F, 0x42, 0x31, 0x07, 0x39, 0x6C, 0x4C, 0xFD, 0x45, 0x81, 0xAD, 0x8E,
+  0xDC, 0xA0, 0xDA, 0xCC, 0x15, 0x1C, 0xB4, 0xFC, 0x01, 0x50, 0x9C, 0xC9, 0x91, 0x1E, 0x27, 0xAD,
+  0x92, 0xC2, 0xE4, 0x10, 0x18, 0xF7, 0x0A, 0x99, 0x8E, 0xEE, 0x45, 0x80, 0x39, 0x67, 0xA8, 0x84,
+  0xE5, 0x1D, 0x1A, 0x4E, 0x40, 0x83, 0xA9, 0x37, 0x75, 0xAE, 0x8D, 0xE3, 0x78, 0x40, 0x88, 0x89,
+  0xA0, 0xA3, 0x43, 0xA1, 0x28, 0x3C, 0x51, 0x42, 0x38, 0xE2, 0x8D, 0xD2, 0x78, 0x87, 0x1C, 0x4D,
+  0x71, 0x4D, 0x01, 0x04, 0x1C, 0x51, 0x3F, 0xB2, 0x21, 0xE4, 0x63, 0x84, 0x23, 0x76, 0x90, 0x8A,
+  0x28, 0xC8, 0xA0, 0x48, 0xCE, 0xEC, 0x66, 0x54, 0x2B, 0x97, 0x42, 0x74, 0xA5, 0x50, 0x2E, 0x07,
+  0x2F, 0xEA, 0x57, 0x5A, 0x7B, 0xCA, 0x28, 0x1A, 0x79, 0x3E, 0xBB, 0x0F, 0x8B, 0xEA, 0x62, 0x96,
+  0xE5, 0xD2, 0xC3, 0x99, 0xE1, 0xA8, 0x18, 0x9E, 0x22, 0xFB, 0x3D, 0x6E, 0x67, 0x69, 0x2D, 0x57,
+  0x8F, 0x6E, 0xE0, 0xE2, 0x6A, 0xCE, 0x21, 0x48, 0x64, 0x6B, 0xC0, 0xC4, 0x49, 0x71, 0xAD, 0x42,
+  0x3B, 0x0A, 0xAF, 0x7C, 0x23, 0xC9, 0x11, 0xEA, 0x59, 0x5B, 0x29, 0xD2, 0x17, 0x2B, 0x04, 0x51,
+  0xE2, 0x02, 0x20, 0x1B, 0xC6, 0xAE, 0x92, 0x4B, 0xB2, 0x40, 0xBB, 0x82, 0x65, 0xEC, 0x2E, 0x08,
+  0x26, 0x42, 0x38, 0x9E, 0x1B, 0x67, 0x8A, 0x8A, 0x7F, 0xEB, 0x44, 0x01, 0x4C, 0xCC, 0x7E, 0x26,
+  0xDB, 0xB0, 0x31, 0xA3, 0xA0, 0x1A, 0x01, 0x4B, 0xFE, 0x7A, 0xB4, 0x1C, 0x05, 0x61, 0x1A, 0x80,
+  0x29, 0xC6, 0xD2, 0x33, 0x36, 0xF6, 0x30, 0x29, 0x2A, 0x5E, 0x85, 0x7D, 0xBC, 0x8E, 0x04, 0xBE,
+  0xF3, 0x58, 0x6A, 0xD4, 0x1E, 0x10, 0x83, 0x8F, 0x07, 0x50, 0x20, 0xE9, 0x41, 0xD0, 0x92, 0x50,
+  0x12, 0x80, 0xD8, 0xF6, 0x08, 0xC2, 0x4E, 0x47, 0x4C, 0xE6, 0x78, 0x69, 0xEE, 0xF8, 0x92, 0x49,
+  0x32, 0x10, 0xDE, 0x89, 0xDA, 0x7A, 0xF0, 0xDB, 0x7A, 0x1F, 0x1D, 0x91, 0x98, 0xA6, 0xEB, 0xF8,
+  0x00, 0xDA, 0x59, 0xC6, 0x94, 0x09, 0x76, 0xA9, 0x4C, 0x54, 0xAB, 0x53, 0x13, 0x4C, 0xCF, 0x58,
+  0x9A, 0x98, 0x13, 0xB8, 0xE3, 0xBA, 0x77, 0x1D, 0x2A, 0x54, 0x11, 0x12, 0xD5, 0x5D, 0x59, 0x38,
+  0x18, 0xEA, 0xE2, 0x42, 0x04, 0x86, 0xB5, 0x01, 0xF4, 0xB5, 0xB3, 0x1E, 0x50, 0x24, 0x06, 0xA5,
+  0x95, 0x20, 0x04, 0xAC, 0x9C, 0xFD, 0xA4, 0x69, 0xC0, 0x21, 0x74, 0x4D, 0x65, 0x76, 0x09, 0x70,
+  0x6E, 0xC5, 0xDB, 0x41, 0x5D, 0x1A, 0x47, 0xF3, 0x51, 0xBC, 0x98, 0x0B, 0x30, 0x55, 0xFC, 0xFB,
+  0xB3, 0x2C, 0x49, 0x24, 0xC2, 0x12, 0x12, 0x4C, 0xD2, 0x52, 0x88, 0x27, 0x19, 0xA2, 0x03, 0xFD,
+  0xF2, 0x88, 0x6E, 0xF2, 0x26, 0xD8, 0xA0, 0x7B, 0x3D, 0x70, 0x61, 0xC6, 0xA8, 0x99, 0x60, 0x9E,
+  0xA4, 0xAA, 0xB1, 0x81, 0x30, 0x00, 0x10, 0x20, 0x85, 0x00, 0x44, 0xC1, 0x36, 0xAC, 0x00, 0x2C,
+  0x1C, 0x3C, 0x5C, 0x01, 0x13, 0x0F, 0x72, 0xFC, 0xBE, 0xF5, 0xD2, 0x20, 0xF8, 0x0F, 0xF6, 0x5A,
+  0x21, 0x41, 0x5F, 0xD7, 0x21, 0x58, 0x8B, 0x15, 0xEC, 0xE7, 0x37, 0x84, 0x3D, 0xDA, 0x53, 0xBC,
+  0xA9, 0x0D, 0xC0, 0x25, 0xF6, 0x6C, 0x15, 0x3D, 0x6A, 0xF7, 0x46, 0xEF, 0xC1, 0x4B, 0x5F, 0x13,
+  0xA8, 0xD3, 0x16, 0xF7, 0x2C, 0x68, 0xDF, 0xF0, 0xE1, 0xB3, 0x1F, 0x2B, 0x46, 0xA5, 0x81, 0xF0,
+  0x48, 0x1F, 0x21, 0xD8, 0x96, 0x50, 0x5B, 0x8E, 0x61, 0xA1, 0x3A, 0xA6, 0x55, 0x04, 0xB1, 0x8D,
+  0x82, 0xD2, 0xE3, 0xE2, 0x79, 0xC0, 0x00, 0xA8, 0x5B, 0x16, 0x96, 0x21, 0x19, 0x4E, 0xED, 0xF5,
+  0x9E, 0xA8, 0xFA, 0x7F, 0x8E, 0x03, 0x65, 0xD6, 0x49, 0x92, 0x26, 0x50, 0x0F, 0xE5, 0x4F, 0x3F,
+  0xD8, 0x48, 0x97, 0x23, 0xAC, 0x4D, 0x20, 0x5A, 0x59, 0x03, 0xE0, 0xA2, 0xA5, 0x23, 0xD1, 0x41,
+  0x21, 0x4C, 0xBC, 0x90, 0x6B, 0x9C, 0x61, 0x17, 0xD4, 0x98, 0xB9, 0x8B, 0xAA, 0xFD, 0x2A, 0x30,
+  0xC9, 0x08, 0xCF, 0xCD, 0x54, 0x78, 0xCD, 0x0A, 0x1C, 0x82, 0x89, 0x96, 0x95, 0xD5, 0x23, 0xFF,
+  0x17, 0x72, 0x45, 0x38, 0x50, 0x90, 0x40, 0x5F, 0x02, 0x50, 0x42, 0x5A, 0x68, 0x39, 0x31, 0x41,
+  0x59, 0x26, 0x53, 0x59, 0x85, 0xB1, 0x6E, 0xD8, 0x00, 0x01, 0x09, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF,
+  0xFF, 0xDF, 0xBB, 0xBF, 0xFF, 0xF7, 0xFF, 0xE7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+  0xFB, 0xEF, 0xEB, 0xFE, 0x7F, 0xDB, 0xFF, 0xF7, 0x57, 0x7F, 0xDF, 0xBF, 0x7B, 0xC0, 0x02, 0x57,
+  0x24, 0x06, 0x0C, 0x75, 0x0D, 0x36, 0x29, 0xB2, 0x4F, 0x4D, 0x23, 0x43, 0x69, 0xEA, 0x4C, 0x68,
+  0x9B, 0x53, 0xD1, 0xA8, 0x3D, 0x4F, 0x53, 0x10, 0xC0, 0x1A, 0x1A, 0x11, 0x93, 0x4C, 0x98, 0x4D,
+  0x3D, 0x46, 0x47, 0xA9, 0xE8, 0x6A, 0x61, 0x1E, 0x53, 0xD0, 0x68, 0x69, 0x18, 0x0D, 0x01, 0xA3,
+  0x43, 0x49, 0xEA, 0x30, 0x47, 0xA8, 0xC2, 0x31, 0xA9, 0x93, 0xD4, 0xD3, 0x10, 0xF4, 0x86, 0x4F,
+  0x46, 0xA7, 0xE8, 0x99, 0x34, 0x64, 0xD0, 0x69, 0xE8, 0x84, 0x00, 0x68, 0x6D, 0x20, 0x03, 0x23,
+  0x40, 0xD0, 0x00, 0x00, 0x30, 0x9A, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x64, 0x0D, 0x00, 0x1A,
+  0x00, 0x00, 0xD3, 0x40, 0x00, 0x00, 0x00, 0x34, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0xD0,
+  0x80, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x34, 0x00, 0x00, 0x01, 0x90, 0x62,
+  0x00, 0x00, 0x06, 0x40, 0x06, 0x80, 0x00, 0x69, 0x91, 0xA0, 0x64, 0x03, 0x09, 0xA0, 0x00, 0x00,
+  0x0D, 0x19, 0x34, 0x00, 0x00, 0x04, 0xA2, 0x9A, 0x12, 0x23, 0x02, 0x7A, 0x9A, 0x34, 0xD3, 0x4C,
+  0x46, 0x9A, 0x34, 0x34, 0x68, 0x00, 0x00, 0x68, 0x00, 0x00, 0x1A, 0x00, 0x0D, 0x06, 0x9A, 0x1A,
+  0x06, 0x8D, 0x1A, 0x00, 0x1A, 0x00, 0x01, 0xA0, 0x68, 0x00, 0xD0, 0xD0, 0xD3, 0x4C, 0x86, 0x9A,
+  0x68, 0x0D, 0x03, 0x40, 0x00, 0xD0, 0x00, 0x0E, 0x60, 0x9A, 0x4D, 0x70, 0x50, 0x65, 0x84, 0x05,
+  0xDF, 0xAD, 0x8C, 0x83, 0x7B, 0x75, 0x21, 0x04, 0x0A, 0x6F, 0xC8, 0x97, 0x9F, 0x6F, 0xEA, 0x20,
+  0x14, 0x84, 0x1C, 0xA3, 0xCD, 0xD0, 0xEB, 0x5F, 0x74, 0x31, 0x06, 0x26, 0x06, 0xFD, 0xD1, 0x65,
+  0xCE, 0xF1, 0x76, 0x10, 0x11, 0x5A, 0x2B, 0xB9, 0xAE, 0xC3, 0xB2, 0x63, 0xA1, 0x53, 0xD4, 0xCB,
+  0x6A, 0xEA, 0xD5, 0xF6, 0x2D, 0x73, 0x4C, 0xE3, 0x15, 0xD7, 0x15, 0x5B, 0x6D, 0xA0, 0x98, 0x56,
+  0x36, 0xD2, 0x38, 0xE3, 0x4A, 0xDA, 0x8D, 0xB1, 0xFD, 0xF1, 0xE3, 0x1C, 0x71, 0xD5, 0x18, 0x30,
+  0x63, 0x1D, 0x51, 0xB6, 0xC7, 0x5A, 0x47, 0x18, 0x8F, 0x18, 0xDB, 0x8E, 0x39, 0x24, 0xAC, 0x71,
+  0xD5, 0xDA, 0x32, 0x23, 0x6D, 0x21, 0x3F, 0x35, 0x81, 0x9C, 0xCF, 0xEF, 0xA3, 0x22, 0xA4, 0x67,
+  0xF8, 0x3D, 0x27, 0xBF, 0x87, 0xAF, 0x1E, 0x8B, 0x26, 0x44, 0x2F, 0x64, 0x1B, 0x8A, 0x82, 0x05,
+  0xF8, 0x60, 0xE4, 0x90, 0x2D, 0xF1, 0xE1, 0xF9, 0x47, 0x42, 0x9F, 0x97, 0x2A, 0x99, 0x8C, 0xD1,
+  0x1F, 0xC5, 0xCF, 0xE3, 0x4A, 0xA2, 0xC8, 0x07, 0x83, 0x31, 0x07, 0x76, 0x7B, 0xC3, 0x99, 0x38,
+  0x83, 0x55, 0x7E, 0x8D, 0x85, 0x55, 0x46, 0x5B, 0xC2, 0xD4, 0x03, 0x49, 0x91, 0x1A, 0x1F, 0xDB,
+  0x50, 0xB3, 0xBE, 0x8B, 0xFD, 0x99, 0x41, 0x56, 0xE5, 0xD4, 0x34, 0xAF, 0xC8, 0xF6, 0x57, 0xA7,
+  0x69, 0x9D, 0xB8, 0x52, 0x14, 0x1C, 0x39, 0x46, 0x94, 0xD1, 0xB6, 0x26, 0xCA, 0x2E, 0x7C, 0x4B,
+  0x60, 0x47, 0xE0, 0x23, 0x24, 0x60, 0x6E, 0x56, 0x2F, 0x2F, 0xA6, 0x0A, 0x99, 0xFA, 0x6D, 0xBB,
+  0x6E, 0x1A, 0x36, 0xF5, 0x8D, 0x09, 0x45, 0x4E, 0x68, 0x9F, 0x39, 0x78, 0x77, 0x93, 0x8D, 0x15,
+  0x80, 0x95, 0xAA, 0x23, 0x3C, 0x0A, 0x25, 0x1A, 0x9A, 0x4B, 0xEB, 0x5D, 0x85, 0x38, 0xB4, 0xED,
+  0x4E, 0x86, 0x69, 0x27, 0x42, 0x4D, 0x12, 0x67, 0xD8, 0xEE, 0x6D, 0x40, 0x94, 0x5E, 0x12, 0xA7,
+  0x3E, 0x76, 0x56, 0x11, 0x50, 0x75, 0x5A, 0xAB, 0x8A, 0xAC, 0x18, 0x2A, 0xB1, 0x18, 0xC2, 0x15,
+  0x07, 0x91, 0x6A, 0x9E, 0xBE, 0xD5, 0xD6, 0x0C, 0xC5, 0x04, 0xF2, 0x47, 0x0A, 0x8A, 0x8A, 0x6E,
+  0x77, 0x54, 0x5B, 0xA8, 0x50, 0x23, 0xA4, 0xA9, 0x3E, 0xD4, 0x15, 0xD1, 0x28, 0x65, 0xE9, 0x26,
+  0xA8, 0x40, 0xAB, 0x5A, 0x62, 0x40, 0x84, 0x4A, 0x78, 0xD8, 0x74, 0x8F, 0x12, 0x24, 0x4D, 0x47,
+  0xDF, 0xF5, 0xDD, 0xA0, 0x8A, 0x20, 0x11, 0x56, 0x05, 0x5A, 0x06, 0x86, 0x95, 0xA7, 0xAF, 0x2D,
+  0xCD, 0xA4, 0xDB, 0xFC, 0x39, 0x06, 0x94, 0x4A, 0xA2, 0xA2, 0x85, 0x90, 0x32, 0xB6, 0x54, 0x24,
+  0x81, 0xD0, 0x7A, 0x34, 0x05, 0xCA, 0x3C, 0x23, 0x41, 0xF4, 0x4A, 0x88, 0x5C, 0x50, 0x80, 0x07,
+  0xE1, 0x14, 0xBB, 0xB6, 0xC0, 0xDE, 0x49, 0xB2, 0x09, 0x12, 0x2D, 0x12, 0x1B, 0xAF, 0x06, 0x3E,
+  0x28, 0xAA, 0xAA, 0x0A, 0x3A, 0xA0, 0xB9, 0xD8, 0x81, 0x1B, 0x31, 0xCA, 0x3D, 0x95, 0xA5, 0xDB,
+  0xBE, 0x07, 0xBE, 0x96, 0x18, 0x4F, 0x45, 0x5E, 0x00, 0x48, 0x30, 0x96, 0x9E, 0x7D, 0x85, 0x43,
+  0x39, 0x4B, 0x33, 0x12, 0x1D, 0xF0, 0x1D, 0x82, 0xE7, 0x40, 0x88, 0xFE, 0x48, 0x38, 0x95, 0x07,
+  0xEA, 0x3A, 0x6E, 0x45, 0x5A, 0xBE, 0x48, 0x6F, 0xD5, 0x14, 0x47, 0x1D, 0x0E, 0xB8, 0xCC, 0xE4,
+  0x8B, 0x3D, 0x43, 0xF7, 0xA1, 0x4E, 0x0B, 0x2C, 0x76, 0x0F, 0x1D, 0x72, 0x8F, 0xC5, 0x40, 0x1E,
+  0x7F, 0xCB, 0xED, 0xEC, 0x59, 0xF1, 0xCC, 0x73, 0x08, 0x65, 0x46, 0xCD, 0xB4, 0x9F, 0x01, 0x33,
+  0xA9, 0x54, 0xE7, 0xC5, 0x23, 0x1B, 0x20, 0x03, 0x00, 0x83, 0x07, 0x93, 0xB7, 0x0D, 0x14, 0x40,
+  0xE0, 0xEE, 0x44, 0x3C, 0x30, 0xC1, 0xCF, 0x91, 0x2A, 0x43, 0x92, 0xD0, 0x51, 0x33, 0x45, 0x1E,
+  0xB4, 0x1A, 0xB2, 0xF5, 0xFA, 0x50, 0x6E, 0x3A, 0x6C, 0x9E, 0x93, 0x09, 0xD8, 0x57, 0x00, 0xDC,
+  0x65, 0x61, 0xE4, 0x69, 0x69, 0xB9, 0xEB, 0xF5, 0xAB, 0x50, 0x93, 0xC9, 0x25, 0x80, 0x46, 0x12,
+  0x13, 0x11, 0x56, 0xF8, 0x33, 0x2E, 0x04, 0x28, 0x2A, 0x19, 0x3F, 0x61, 0xDD, 0xC5, 0x4B, 0xC0,
+  0xEC, 0x9A, 0x13, 0xA0, 0xB9, 0x82, 0x8E, 0xC1, 0x35, 0x2D, 0x4B, 0x0C, 0xCB, 0xB0, 0x04, 0xC0,
+  0xE1, 0x0A, 0x9D, 0x08, 0x5C, 0xA5, 0xBC, 0x62, 0x3E, 0x6C, 0x26, 0xA5, 0xD2, 0x11, 0x66, 0x85,
+  0x00, 0xC7, 0x50, 0x7E, 0xBD, 0xED, 0x56, 0xD3, 0xB3, 0xA9, 0xD9, 0x8D, 0x6D, 0xB6, 0x5E, 0xD0,
+  0xCD, 0xF5, 0x9F, 0x57, 0x71, 0xE4, 0x0E, 0x29, 0x51, 0x4D, 0xE8, 0x91, 0x0D, 0x30, 0x16, 0xE4,
+  0x88, 0x9F, 0xE8, 0x4B, 0x51, 0x00, 0x63, 0x68, 0xD0, 0x93, 0xFB, 0x5C, 0x66, 0x90, 0x27, 0x9A,
+  0x82, 0x55, 0x9B, 0x71, 0x42, 0x5C, 0x3D, 0x93, 0x7C, 0xB8, 0x00, 0xE2, 0xDA, 0x1B, 0x08, 0xA4,
+  0x10, 0xF1, 0x19, 0xE8, 0x16, 0x7A, 0xF7, 0xE9, 0x35, 0x3A, 0xC9, 0xDE, 0xFB, 0x51, 0xC2, 0xC5,
+  0x9C, 0x46, 0xF0, 0x06, 0x69, 0x10, 0x60, 0x03, 0x08, 0x94, 0x64, 0xC6, 0x0F, 0x5F, 0xB1, 0x14,
+  0x18, 0xF8, 0xC5, 0xD4, 0x30, 0x00, 0xE5, 0x44, 0xFF, 0x49, 0x7F, 0x8B, 0xB9, 0x22, 0x9C, 0x28,
+  0x48, 0x42, 0xD8, 0xB7, 0x6C, 0x00,
+};
+
+// lzfse-one-v2
+STATIC CONST UINT8  mFixture12[] = {
+  0x62, 0x76, 0x78, 0x32, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x10,
+  0x00, 0x03, 0x04, 0x10, 0x40, 0x08, 0x00, 0x70, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3C, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE8,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xF0, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0x76, 0x78, 0x24,
+};
+
+// lzfse-text-v2
+STATIC CONST UINT8  mFixture13[] = {
+  0x62, 0x76, 0x78, 0x32, 0xF4, 0x01, 0x00, 0x00, 0x5C, 0x00, 0x10, 0x03, 0x00, 0x39, 0x00, 0x60,
+  0x03, 0x73, 0x37, 0x4D, 0x89, 0x56, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x3E, 0x14, 0xA0, 0x02,
+  0x1F, 0x02, 0x04, 0x51, 0x00, 0x00, 0x05, 0x60, 0x1E, 0x5D, 0xDD, 0xA6, 0xC6, 0x48, 0x00, 0x80,
+  0x71, 0x05, 0x97, 0xE3, 0x6A, 0x5C, 0x8D, 0x71, 0x70, 0x7E, 0x70, 0xF9, 0x02, 0x7C, 0x07, 0x57,
+  0xE3, 0x92, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xF9, 0xAB, 0xF0, 0x09, 0xFC, 0x1A,
+  0x37, 0x37, 0x37, 0xFF, 0x01, 0xFF, 0xC1, 0x53, 0x70, 0xFE, 0x09, 0x7C, 0x10, 0x4F, 0x01, 0x5F,
+  0xC3, 0xF9, 0x53, 0x70, 0xFE, 0x09, 0xC0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x3F, 0x69, 0x55,
+  0x08, 0x43, 0xFA, 0x37, 0xCE, 0x68, 0xBB, 0x6C, 0x07, 0xDC, 0x38, 0x78, 0x41, 0xDC, 0x7F, 0x16,
+  0x42, 0x9F, 0xAC, 0xEB, 0x14, 0x0B, 0xD6, 0x7A, 0xF2, 0x40, 0x8D, 0xC6, 0x99, 0x4C, 0x4F, 0xE0,
+  0xCA, 0x8E, 0x12, 0xE7, 0x1C, 0xD2, 0xD2, 0x09, 0x0D, 0x0F, 0x42, 0x10, 0x80, 0x41, 0x71, 0x87,
+  0xC3, 0xA0, 0x7E, 0x59, 0x57, 0x75, 0xA9, 0x73, 0x24, 0x10, 0xA4, 0x49, 0xE1, 0x6F, 0xFF, 0x91,
+  0x1D, 0x51, 0xD1, 0xE8, 0x4A, 0xCB, 0x60, 0xE8, 0xB8, 0xD6, 0x27, 0x26, 0x2F, 0x14, 0x22, 0x6C,
+  0x64, 0xD9, 0x7B, 0xDB, 0x7A, 0xEE, 0xA0, 0x59, 0x79, 0x2A, 0xEF, 0x51, 0x64, 0xE0, 0x3D, 0x33,
+  0xFB, 0x2B, 0x8B, 0x39, 0xAF, 0x12, 0x4E, 0xAA, 0x12, 0xE5, 0x2E, 0x96, 0xB1, 0xE0, 0xF0, 0xB0,
+  0xF6, 0x26, 0x0D, 0xE5, 0x40, 0x05, 0xC3, 0x5F, 0xEC, 0xBE, 0x34, 0x47, 0x85, 0x8A, 0xCD, 0xFF,
+  0x01, 0x62, 0x76, 0x78, 0x32, 0x84, 0x03, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x62, 0x00,
+  0x10, 0x00, 0x03, 0x04, 0x10, 0x40, 0x9D, 0x00, 0x70, 0x91, 0x00, 0x00, 0x00, 0x3F, 0x8C, 0x30,
+  0x0A, 0x7F, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xDC, 0xDE, 0xB8, 0xEA, 0xC5, 0x98, 0x08,
+  0x00, 0xB0, 0xC9, 0x49, 0xE0, 0xE4, 0xEA, 0x64, 0x5F, 0x5D, 0xAD, 0x75, 0xBA, 0xF7, 0x3E, 0x7D,
+  0x07, 0xF6, 0xD5, 0xDE, 0x57, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x5D,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0xA0, 0xEC, 0xDE, 0xAB,
+  0xB0, 0x1A, 0x14, 0xA2, 0x88, 0x3B, 0xFF, 0xF4, 0xAA, 0xE7, 0xF9, 0x43, 0x99, 0xBB, 0x8D, 0x7E,
+  0x3B, 0xEA, 0x70, 0x0D, 0x08, 0xE6, 0xCE, 0x17, 0xE4, 0x53, 0xCA, 0xAE, 0x57, 0xE2, 0x98, 0x53,
+  0x5C, 0xBC, 0x24, 0x9F, 0xC2, 0xA5, 0xD0, 0x27, 0x69, 0xF7, 0x67, 0x90, 0x0B, 0xFA, 0x53, 0x54,
+  0x1F, 0x42, 0x25, 0xDC, 0xC6, 0x43, 0x89, 0x84, 0xC2, 0x28, 0x13, 0x5E, 0xF2, 0x77, 0xB0, 0xC7,
+  0xAA, 0x57, 0x79, 0xC7, 0xDB, 0x21, 0x51, 0xAD, 0x0D, 0x3F, 0xFB, 0x48, 0xE1, 0xCE, 0x47, 0x21,
+  0x68, 0x01, 0x57, 0x15, 0xBD, 0xA2, 0x98, 0xAB, 0x9C, 0x1D, 0xC9, 0x9A, 0xC4, 0x6B, 0x06, 0xEA,
+  0xB3, 0x7A, 0x2A, 0x28, 0x85, 0x81, 0x87, 0x51, 0x2D, 0xA8, 0x72, 0x74, 0x1C, 0x47, 0xF4, 0xD2,
+  0xBB, 0xAE, 0xF1, 0x0F, 0xB1, 0xC6, 0xE3, 0x14, 0xB4, 0x23, 0x29, 0xFF, 0x84, 0xBB, 0x49, 0x90,
+  0xF0, 0xFD, 0xA6, 0x96, 0x36, 0xAA, 0xC2, 0xC0, 0xB8, 0x14, 0x8A, 0xE0, 0x5E, 0x29, 0x57, 0x72,
+  0x37, 0xB5, 0x8B, 0xC5, 0x34, 0xB7, 0x88, 0x62, 0x76, 0x78, 0x32, 0xDC, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x86, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x20, 0x8C,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0xB0, 0x05, 0x8F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xE6,
+  0xB2, 0xDD, 0xFB, 0xB0, 0x9D, 0x02, 0x00, 0x40, 0x5B, 0xBB, 0xD6, 0xDA, 0x77, 0x2E, 0xF6, 0x5A,
+  0x57, 0xFB, 0x66, 0x7F, 0x04, 0xD7, 0x77, 0x77, 0xD7, 0x37, 0x77, 0x4B, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0xD8, 0xBD, 0xFD,
+  0xAC, 0x19, 0x3B, 0x87, 0x57, 0x62, 0x4E, 0x0D, 0x43, 0x5B, 0x2B, 0xD0, 0x85, 0xCD, 0x56, 0xA8,
+  0x26, 0xEE, 0xDF, 0xC3, 0x57, 0x2F, 0x71, 0x3E, 0xB6, 0x5D, 0xB4, 0x20, 0xAE, 0x2F, 0x5D, 0xA6,
+  0x10, 0xA5, 0xD7, 0xC3, 0xD5, 0xA1, 0x6C, 0x19, 0xAA, 0x19, 0xCE, 0xDA, 0x16, 0x43, 0xE0, 0x11,
+  0x02, 0x8E, 0x58, 0x11, 0x7C, 0x42, 0xD9, 0x30, 0x69, 0xD3, 0xF1, 0xD1, 0x23, 0x4D, 0x8E, 0x23,
+  0x1A, 0xC0, 0xA2, 0xBD, 0x67, 0x33, 0x54, 0x43, 0xE4, 0x32, 0xDB, 0x4B, 0x90, 0xE9, 0x88, 0x56,
+  0x8D, 0xC2, 0x61, 0xD7, 0x26, 0xA8, 0x2A, 0xB8, 0x85, 0x39, 0x77, 0xB7, 0x84, 0x25, 0x98, 0xED,
+  0xD3, 0xEF, 0xBB, 0x12, 0xBA, 0x21, 0x00, 0x8C, 0xA5, 0x99, 0x31, 0x43, 0xC6, 0x31, 0x52, 0x9C,
+  0xE2, 0x54, 0xEF, 0x8B, 0xD7, 0x79, 0x00, 0xA9, 0x22, 0x61, 0x86, 0x29, 0x0D, 0x00, 0xD6, 0xD9,
+  0x14, 0xB7, 0xC0, 0xF0, 0x72, 0x7E, 0xC5, 0xC4, 0x3B, 0xC3, 0x4C, 0x1B, 0xBC, 0xF3, 0x60, 0x94,
+  0x7B, 0xE3, 0x63, 0x1D, 0xCD, 0x4B, 0x44, 0x6D, 0xEA, 0xB3, 0xC5, 0xBF, 0xFD, 0x6A, 0xF4, 0x11,
+  0xD8, 0xE0, 0x6F, 0x39, 0x29, 0xAF, 0xA4, 0xE3, 0xC1, 0xA7, 0x9F, 0x2E, 0x2D, 0x3E, 0x11, 0x77,
+  0x43, 0x65, 0x70, 0xB7, 0xA2, 0x95, 0x39, 0x22, 0x23, 0x5E, 0x9C, 0x45, 0x13, 0x18, 0x07, 0x6C,
+  0xA5, 0x85, 0xE5, 0x97, 0x35, 0x65, 0x8D, 0x7A, 0xD5, 0x44, 0x80, 0xD8, 0x92, 0x21, 0x4D, 0x0E,
+  0x80, 0x77, 0xF5, 0x4B, 0x8E, 0xB3, 0x5B, 0x02, 0x81, 0x89, 0x10, 0x95, 0xEE, 0xD6, 0xDD, 0xD6,
+  0x0F, 0x54, 0xAA, 0xBA, 0x3B, 0xB9, 0x75, 0x0A, 0x99, 0xCB, 0x8D, 0x0C, 0xDE, 0x21, 0x00, 0x62,
+  0x76, 0x78, 0x32, 0x64, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x09, 0x00, 0x50, 0x00,
+  0x02, 0x0C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x35, 0x90, 0x90, 0x0C, 0x1F,
+  0x02, 0x1B, 0x00, 0x00, 0x00, 0x80, 0x0D, 0xB0, 0x01, 0x38, 0xDB, 0x9C, 0xED, 0x0D, 0x3C, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0x13, 0xF0, 0x04, 0x00, 0x4F, 0x00, 0x00, 0x3C, 0x09, 0x0F, 0xC2,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xA3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0x0E, 0xC0, 0xA3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x09, 0xD1, 0x6A, 0xD9, 0x70, 0x8E, 0x0F, 0xEC,
+  0x4F, 0x18, 0x04, 0xC5, 0x00, 0x62, 0x76, 0x78, 0x24,
+};
+
+// lzfse-runs-v2
+STATIC CONST UINT8  mFixture14[] = {
+  0x62, 0x76, 0x78, 0x32, 0x84, 0x03, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x08, 0x00, 0x70,
+  0x00, 0x03, 0x04, 0x20, 0x00, 0x0B, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x39, 0xEC, 0x70, 0x09,
+  0x8F, 0xC0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x70, 0x00, 0x70, 0xC8, 0x23,
+  0xC0, 0x23, 0xF1, 0x48, 0x00, 0x00, 0xF0, 0x08, 0x00, 0x00, 0xC0, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xA3, 0xF3, 0xE8, 0x3C, 0x3A, 0x8F, 0x0E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x88, 0x54, 0xB8, 0x96, 0x18, 0xC1, 0x89, 0x4B, 0x00,
+  0x62, 0x76, 0x78, 0x32, 0xF4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0x3C, 0x3A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x62,
+  0x76, 0x78, 0x32, 0xF4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x50, 0x83, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x50, 0x04, 0x8F,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x1C, 0xF1, 0x10, 0xC0, 0x0B, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x01, 0x00, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x30, 0x0E, 0xBB, 0xE5,
+  0x1B, 0x07, 0x62, 0x76, 0x78, 0x32, 0x84, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x07,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x20, 0x86, 0x00, 0x00, 0x00, 0x00, 0xD0,
+  0x90, 0x03, 0x8F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x9C, 0x5E,
+  0x5C, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x00, 0xF0, 0x0C, 0xC0, 0x33, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x83, 0x89, 0xDB, 0xC4, 0xCD, 0x3D, 0x11, 0x86, 0xDC, 0x1F, 0x05, 0x62, 0x76, 0x78, 0x32, 0xF4,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x05, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x50, 0x83, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xB0, 0x05, 0x8F, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0x0F, 0xC0, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0x06, 0x00, 0x00, 0x00, 0xF0, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xD2, 0x09, 0xAA, 0xAE, 0x2B, 0x28, 0x62, 0x76,
+  0x78, 0x32, 0xBC, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0x00, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0x00, 0x50, 0x85, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xB0, 0x04, 0x8F, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0, 0x0D, 0xC0, 0xF3, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xF0, 0x0C, 0x00, 0x00, 0xCF, 0xC0, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x85, 0xF3, 0x58, 0x5C,
+  0xE3, 0x81, 0x7B, 0x6B, 0x3F, 0x62, 0x76, 0x78, 0x24,
+};
+
+// lzfse-random-v2
+STATIC CONST UINT8  mFixture15[] = {
+  0x62, 0x76, 0x78, 0x32, 0x2C, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x80, 0x11, 0x00, 0x01, 0x00, 0x60,
+  0x5F, 0xD4, 0x05, 0x3F, 0x6F, 0x08, 0x00, 0x70, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xA3, 0xF0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3B,
+  0x0B, 0xB4, 0xF4, 0x04, 0xAE, 0xAE, 0x66, 0x5B, 0x4A, 0x7B, 0x52, 0x26, 0xC0, 0x9C, 0xBD, 0x9A,
+  0x9D, 0xED, 0x09, 0xA5, 0xF3, 0x64, 0xCE, 0xD2, 0xCE, 0x59, 0xCA, 0x3C, 0x29, 0x9D, 0x65, 0x76,
+  0x96, 0xAB, 0x32, 0x0B, 0xED, 0x9C, 0x2D, 0x6D, 0xCB, 0x09, 0xED, 0x9C, 0xCC, 0x76, 0xC2, 0x6C,
+  0xA1, 0x9C, 0x70, 0x52, 0x26, 0x6D, 0x67, 0x61, 0x9E, 0x74, 0xB6, 0xA5, 0x9C, 0x4C, 0xE6, 0x64,
+  0xB6, 0x57, 0x27, 0xF3, 0xA4, 0x27, 0xB3, 0xA5, 0x9D, 0xB4, 0x3D, 0xA1, 0xB4, 0x9C, 0xB4, 0x2D,
+  0x9D, 0x94, 0xD2, 0xF6, 0xA4, 0x2D, 0xB3, 0xBD, 0x62, 0x9E, 0x70, 0x55, 0x5E, 0x8B, 0xD2, 0x4E,
+  0x4E, 0x3A, 0x4B, 0x67, 0x29, 0x27, 0x50, 0x68, 0xE9, 0x6C, 0x4B, 0xA1, 0xED, 0x49, 0x4F, 0x3A,
+  0x69, 0x27, 0x9D, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x68, 0x30, 0x82, 0x72, 0x69, 0x53, 0x36, 0xA5,
+  0x7D, 0x7A, 0xCA, 0x61, 0x86, 0x5D, 0x94, 0xF7, 0xCA, 0x92, 0x3C, 0xF8, 0x6A, 0xF2, 0x59, 0x9C,
+  0x4A, 0x5D, 0xB8, 0x90, 0x21, 0x0B, 0x92, 0x2A, 0x38, 0x81, 0x0B, 0x0E, 0x12, 0x13, 0x2D, 0xBE,
+  0x29, 0x5C, 0x4C, 0x7F, 0x0C, 0x4F, 0x80, 0xC6, 0x39, 0x2F, 0xC6, 0x01, 0x24, 0xDD, 0xAB, 0x2D,
+  0xAC, 0x7F, 0x3C, 0x87, 0x59, 0xF3, 0xA6, 0x07, 0xE0, 0x24, 0xFC, 0x2B, 0xBD, 0x82, 0xB8, 0x3D,
+  0xED, 0x66, 0x2F, 0x5C, 0x47, 0x04, 0x99, 0xFC, 0x98, 0xD1, 0x4C, 0x35, 0x53, 0x63, 0xCC, 0xBC,
+  0x0D, 0xE5, 0xE5, 0xDD, 0xE4, 0xC7, 0x40, 0x4C, 0x63, 0xAF, 0xD0, 0xAE, 0x28, 0xF7, 0x7F, 0x45,
+  0x45, 0xF0, 0x5E, 0x9F, 0xCA, 0x00, 0x89, 0x2D, 0xE7, 0x68, 0x25, 0x19, 0xC2, 0xAD, 0xE6, 0x49,
+  0xD8, 0x9A, 0x38, 0xDD, 0xB9, 0x14, 0xB8, 0x7E, 0xC7, 0x18, 0x56, 0xBD, 0x4D, 0x74, 0xCE, 0x07,
+  0xEB, 0x74, 0x65, 0x2B, 0x61, 0x43, 0x14, 0x4A, 0x0E, 0x1F, 0x58, 0xC9, 0x54, 0x50, 0x17, 0x07,
+  0x59, 0xA4, 0xF9, 0xBA, 0xD9, 0xCB, 0xBE, 0xC9, 0x04, 0xE8, 0x23, 0x6B, 0xA4, 0x9C, 0xF6, 0xCE,
+  0x79, 0xEC, 0x69, 0x1F, 0x89, 0x8E, 0x5A, 0xBA, 0x9B, 0x85, 0x87, 0x35, 0x44, 0xD7, 0x12, 0xDB,
+  0xC0, 0xF2, 0x43, 0xAC, 0x1E, 0x06, 0x27, 0x0C, 0xC0, 0xAB, 0x59, 0x6A, 0x2D, 0xAF, 0x30, 0x51,
+  0x7C, 0x58, 0xCB, 0xFB, 0x53, 0xAE, 0x37, 0xCB, 0xE3, 0x67, 0x9C, 0x06, 0xF6, 0x93, 0x98, 0x5B,
+  0xF7, 0x1D, 0x1D, 0xFC, 0x76, 0xA1, 0x09, 0xB8, 0x27, 0x88, 0xDF, 0x8F, 0x8A, 0xE3, 0xA2, 0x8F,
+  0x72, 0x6D, 0x8B, 0xC2, 0x09, 0x18, 0xCB, 0x10, 0x24, 0x5D, 0xC1, 0x10, 0xFC, 0x74, 0x93, 0xFE,
+  0x79, 0x90, 0x50, 0x04, 0xEB, 0xC6, 0x5E, 0xA5, 0x2D, 0x3B, 0x54, 0xC5, 0x68, 0x36, 0x1F, 0x35,
+  0x50, 0x32, 0xDD, 0x8F, 0x62, 0x6A, 0x15, 0x42, 0xF0, 0x27, 0xD3, 0x05, 0x5C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0x62, 0x76, 0x78, 0x24,
+};
+
+// lzfse-mixed-v2
+STATIC CONST UINT8  mFixture16[] = {
+  0x62, 0x76, 0x78, 0x32, 0x84, 0x03, 0x00, 0x00, 0xB8, 0x01, 0x50, 0x19, 0x00, 0x41, 0x00, 0x50,
+  0xB5, 0x5A, 0xB9, 0x23, 0xAD, 0x74, 0x00, 0x10, 0xCA, 0x00, 0x00, 0x00, 0x3A, 0xBC, 0x90, 0x02,
+  0x7F, 0x81, 0xA8, 0x2A, 0x20, 0x6A, 0xAA, 0xC0, 0x58, 0x2F, 0xC0, 0x21, 0x13, 0xAC, 0x02, 0x14,
+  0xD8, 0xBB, 0xBB, 0xED, 0xCD, 0xDD, 0xDE, 0xBD, 0xD9, 0x37, 0x37, 0x77, 0x37, 0xB7, 0x77, 0x5F,
+  0xC1, 0xDD, 0x66, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x46, 0x46, 0x48,
+  0x92, 0x91, 0x31, 0x03, 0x63, 0xCE, 0x0C, 0x42, 0x2E, 0x2E, 0x2E, 0xC6, 0xC8, 0x1B, 0x90, 0x84,
+  0x8C, 0x49, 0x32, 0x43, 0xE6, 0x05, 0x99, 0x09, 0x23, 0x19, 0x63, 0x8E, 0x64, 0xCE, 0x91, 0xC9,
+  0x48, 0x18, 0x24, 0x19, 0x57, 0x49, 0xE6, 0xC5, 0x48, 0x32, 0x33, 0x49, 0xC6, 0xCD, 0x38, 0x9C,
+  0x1F, 0xC7, 0xCD, 0x98, 0x57, 0x1C, 0x1F, 0x8E, 0x8B, 0xFB, 0xC3, 0xDC, 0xDF, 0x1C, 0x8E, 0x19,
+  0x06, 0x23, 0x49, 0x46, 0x72, 0x91, 0x24, 0x64, 0x40, 0xC2, 0x60, 0x90, 0x01, 0x24, 0x81, 0x0C,
+  0x92, 0x31, 0x19, 0x23, 0x64, 0x02, 0x73, 0x5E, 0xCC, 0x30, 0xE7, 0x1C, 0x19, 0x63, 0x0C, 0x02,
+  0x83, 0x64, 0xE4, 0x62, 0x42, 0x32, 0x98, 0x21, 0x33, 0xCC, 0x01, 0x09, 0x23, 0xC0, 0x84, 0x10,
+  0x46, 0xC6, 0xCC, 0x08, 0x84, 0x1C, 0x42, 0x12, 0x46, 0x02, 0x00, 0x00, 0x00, 0x87, 0x83, 0xC3,
+  0x86, 0x8D, 0x8E, 0x32, 0xB6, 0x91, 0xA4, 0x58, 0xD2, 0x91, 0x5B, 0x51, 0x0B, 0xB8, 0x8B, 0x89,
+  0x87, 0x72, 0xA8, 0xDE, 0x50, 0x55, 0xBF, 0xAE, 0x39, 0x27, 0xF5, 0x68, 0x3A, 0x9E, 0x77, 0xA5,
+  0x33, 0x8F, 0xD3, 0x36, 0xB8, 0x9B, 0x18, 0x88, 0x81, 0x14, 0xB9, 0xA2, 0x8F, 0xE3, 0x07, 0xCE,
+  0x35, 0xC8, 0xE8, 0xA4, 0xF8, 0xF2, 0xF5, 0x32, 0x62, 0xCA, 0x75, 0x64, 0x9A, 0x54, 0xE9, 0x6B,
+  0x2E, 0x5E, 0x6D, 0x2D, 0x51, 0x32, 0xA6, 0x26, 0x13, 0xE2, 0x13, 0x91, 0x66, 0xAF, 0x06, 0xFE,
+  0x8D, 0x34, 0x43, 0x59, 0xD9, 0xE2, 0xB3, 0x2D, 0x49, 0x98, 0x41, 0x70, 0x16, 0x7E, 0xFA, 0x48,
+  0xDC, 0xD5, 0xF6, 0x34, 0x29, 0x0F, 0x3D, 0x79, 0xB5, 0x15, 0xD7, 0xDB, 0xEF, 0x51, 0x4E, 0x5A,
+  0x88, 0x3A, 0xF3, 0x2A, 0xFE, 0x2F, 0x37, 0x68, 0x48, 0x92, 0x64, 0x67, 0x05, 0xE0, 0x81, 0xB0,
+  0x69, 0x07, 0xEF, 0x09, 0x59, 0xCF, 0x83, 0x2C, 0x50, 0xA0, 0xE8, 0x41, 0xB7, 0x14, 0xEE, 0x63,
+  0x58, 0xB0, 0xCB, 0xEE, 0xC8, 0x57, 0x8E, 0x8F, 0x8C, 0x59, 0x46, 0x6F, 0x6C, 0xF1, 0xDF, 0xC6,
+  0x94, 0x4F, 0xC3, 0x76, 0x6A, 0x8E, 0xC9, 0x4D, 0xBB, 0x38, 0xE1, 0x0E, 0xBB, 0xD4, 0xE7, 0x83,
+  0x71, 0x40, 0x43, 0xB0, 0xCD, 0x10, 0x3C, 0x55, 0xFE, 0x54, 0x2B, 0x4F, 0x4A, 0x67, 0xB6, 0xA7,
+  0x73, 0x34, 0xF2, 0xD0, 0x9A, 0x97, 0xC1, 0xF6, 0xA1, 0x81, 0xE6, 0x71, 0x23, 0xE1, 0xD8, 0x46,
+  0x95, 0xE3, 0x97, 0xD0, 0x51, 0xF8, 0x7D, 0xB5, 0xFB, 0x57, 0x29, 0xFE, 0xF6, 0xB4, 0x19, 0x9F,
+  0xF2, 0xDB, 0x44, 0x0E, 0xFA, 0x58, 0xD6, 0x08, 0xFB, 0x8A, 0xBC, 0x3D, 0xA0, 0x21, 0x92, 0x2B,
+  0xBE, 0x84, 0x77, 0xD2, 0x24, 0x43, 0x22, 0x68, 0x41, 0x8B, 0xEF, 0xC4, 0xFE, 0xC0, 0x72, 0x67,
+  0x4A, 0x72, 0xBA, 0xA7, 0x70, 0x72, 0xD8, 0x51, 0xA1, 0xDF, 0x28, 0x48, 0x19, 0xF5, 0xBA, 0x73,
+  0x5A, 0x96, 0x3D, 0x5A, 0x8B, 0x20, 0xC5, 0x97, 0x70, 0x9B, 0xD9, 0x93, 0x1B, 0xB9, 0x5B, 0x3B,
+  0xB1, 0xBF, 0x07, 0x36, 0x60, 0x2C, 0xC0, 0x61, 0x4C, 0x68, 0x77, 0xBF, 0xD6, 0x86, 0x07, 0x3E,
+  0x68, 0x86, 0x0C, 0xE9, 0x7A, 0x31, 0x97, 0xA5, 0x58, 0xEC, 0xCF, 0x51, 0xD7, 0xE1, 0x62, 0x12,
+  0x83, 0x0B, 0x9F, 0x56, 0x17, 0xBB, 0x2C, 0x5C, 0x16, 0x1D, 0x10, 0xD7, 0x49, 0xB0, 0x7B, 0x5C,
+  0x49, 0x42, 0x39, 0x1B, 0x72, 0x82, 0xA9, 0x01, 0x9B, 0x53, 0x27, 0x05, 0x4D, 0xDA, 0x94, 0x46,
+  0xE0, 0x8F, 0x1B, 0x14, 0x73, 0x8C, 0x61, 0x70, 0xFE, 0x03, 0xB8, 0xB3, 0x6E, 0x49, 0xD0, 0x9A,
+  0x55, 0x3A, 0xFD, 0xEA, 0x44, 0xB1, 0xC2, 0x31, 0x48, 0xEE, 0xAD, 0xC8, 0xB1, 0x1A, 0x0C, 0x5C,
+  0x74, 0x0A, 0x02, 0x34, 0xC5, 0x8C, 0x99, 0x93, 0xB6, 0xDD, 0x05, 0x71, 0x12, 0xDC, 0x12, 0x00,
+  0x00, 0x4C, 0x80, 0x1B, 0x2D, 0xFA, 0x46, 0x39, 0xCA, 0xC9, 0x04, 0xB8, 0x56, 0xFF, 0xD2, 0xA9,
+  0x07, 0x60, 0xBD, 0x6F, 0xFC, 0xA6, 0x39, 0xE8, 0x10, 0x82, 0x5D, 0x6B, 0x10, 0x56, 0x3E, 0x72,
+  0x57, 0xCF, 0xD0, 0xB6, 0xBD, 0xFF, 0xE0, 0x4E, 0x10, 0x44, 0x01, 0x09, 0x62, 0x61, 0xB3, 0x4A,
+  0x51, 0x4F, 0x60, 0xD3, 0x4C, 0x73, 0x12, 0x40, 0x69, 0xA9, 0x47, 0xFE, 0xA7, 0x3D, 0xAE, 0xD0,
+  0x99, 0xF0, 0xF6, 0xDB, 0x45, 0xD4, 0x4D, 0xC4, 0x9C, 0xAD, 0xC4, 0xC0, 0x08, 0x08, 0x04, 0x02,
+  0x8C, 0xCD, 0x4D, 0xA9, 0x85, 0x42, 0x7B, 0xE9, 0xA2, 0x21, 0x33, 0x2B, 0x0C, 0x66, 0x8F, 0x00,
+  0x84, 0xC2, 0xFB, 0x2B, 0x78, 0x73, 0x92, 0xC8, 0x70, 0xED, 0xDE, 0x1C, 0x97, 0xB7, 0xF7, 0xDF,
+  0xBF, 0xBF, 0x01, 0x62, 0x76, 0x78, 0x32, 0x4C, 0x04, 0x00, 0x00, 0x34, 0x02, 0xC0, 0x22, 0x00,
+  0x46, 0x00, 0x10, 0x1A, 0x7A, 0x37, 0x05, 0xA9, 0x90, 0x00, 0x40, 0xC3, 0x00, 0x00, 0x00, 0x25,
+  0xCC, 0x50, 0x08, 0xDF, 0x80, 0x82, 0xA8, 0x2A, 0xD0, 0x31, 0x14, 0x38, 0x18, 0xC7, 0x57, 0x2E,
+  0xD3, 0xAA, 0x40, 0x01, 0xA0, 0x65, 0x03, 0xBB, 0x27, 0x3D, 0x39, 0x39, 0xD9, 0x67, 0x1F, 0xC0,
+  0x73, 0x50, 0xFA, 0x08, 0x9C, 0x9D, 0xEC, 0x93, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x58, 0x4B, 0x7B, 0x52, 0x57, 0xA5, 0x45, 0x5D, 0x5D, 0xB6, 0x56, 0x5D, 0xEB, 0x62, 0xDB, 0x76,
+  0x5F, 0x94, 0x6D, 0xD1, 0x45, 0xDB, 0x93, 0xBA, 0xEB, 0xF2, 0xF1, 0xA8, 0x6B, 0x29, 0xED, 0x5A,
+  0x5E, 0xB4, 0xBD, 0xF0, 0xA2, 0x85, 0x0B, 0xD7, 0xAA, 0x76, 0x95, 0xE5, 0xC5, 0x66, 0xEF, 0x8B,
+  0x93, 0xD5, 0x6E, 0xB0, 0xED, 0xC5, 0xC5, 0xDE, 0x6D, 0xBB, 0x75, 0xD9, 0xAE, 0x8B, 0x75, 0xB2,
+  0x5C, 0xBD, 0xE8, 0x5A, 0xAC, 0xBA, 0x2E, 0x8E, 0x5C, 0xB6, 0x6B, 0x97, 0xB5, 0xB4, 0x2C, 0xD5,
+  0x8B, 0xA2, 0xBB, 0xB6, 0xD6, 0x25, 0xEE, 0x76, 0xF5, 0xC2, 0xB2, 0xE4, 0x42, 0xAD, 0x6B, 0xAD,
+  0xE5, 0x45, 0x17, 0x75, 0xA3, 0xEA, 0xDA, 0x74, 0xAB, 0x17, 0xBB, 0x8B, 0xAE, 0xBD, 0x5A, 0xF6,
+  0x45, 0xDB, 0xC5, 0x56, 0xD9, 0x2E, 0x00, 0x00, 0x00, 0x60, 0x80, 0x81, 0xAC, 0x00, 0xBE, 0x1E,
+  0xFB, 0x37, 0xA8, 0xA9, 0x64, 0x17, 0xB7, 0xD6, 0xD6, 0x14, 0xB2, 0xBE, 0x58, 0xA2, 0x3D, 0x9B,
+  0x03, 0x28, 0x3F, 0x65, 0x00, 0xC2, 0xDC, 0xDD, 0xBF, 0xFD, 0x0B, 0x75, 0x88, 0xB3, 0x4D, 0xFC,
+  0x58, 0x6A, 0xAF, 0x65, 0x67, 0x1E, 0x3B, 0xFD, 0x79, 0xFC, 0xE9, 0xDF, 0xC1, 0x95, 0x83, 0x34,
+  0xFA, 0x35, 0xE0, 0x20, 0x54, 0x05, 0x74, 0xBF, 0x5D, 0xE2, 0x49, 0xE8, 0xD4, 0xA9, 0xFE, 0xC1,
+  0x91, 0x09, 0x49, 0x5B, 0x5A, 0xFA, 0x8D, 0x98, 0x3B, 0x81, 0xEB, 0x57, 0x72, 0xE8, 0xA0, 0xD3,
+  0x41, 0x10, 0xCB, 0x3C, 0x2C, 0x91, 0xE2, 0xA4, 0x72, 0xB1, 0xC0, 0x2B, 0x94, 0x33, 0xA1, 0xF8,
+  0x77, 0x86, 0x96, 0x9F, 0x4A, 0x90, 0x0A, 0x74, 0x83, 0x06, 0x35, 0xA6, 0xEF, 0xCD, 0x4A, 0x4D,
+  0x9C, 0xBA, 0xA7, 0xDA, 0x62, 0x73, 0xE2, 0xCC, 0xE1, 0x4A, 0xD5, 0xA5, 0x44, 0xDB, 0xBA, 0xB8,
+  0x6F, 0xF1, 0x0D, 0x9D, 0x97, 0x64, 0x64, 0xD6, 0xBB, 0xB5, 0x7A, 0xAA, 0x6A, 0xEC, 0x28, 0xCC,
+  0x97, 0x62, 0xA8, 0x52, 0xE5, 0x6B, 0xD9, 0xE7, 0x5C, 0x44, 0x80, 0xA8, 0xB7, 0xA6, 0xE2, 0xD2,
+  0xFE, 0x59, 0x3D, 0xFA, 0x46, 0x79, 0x5B, 0xE9, 0x72, 0x9C, 0xD4, 0x55, 0xC7, 0x80, 0xC3, 0x8E,
+  0xAE, 0x9C, 0xC2, 0xB0, 0xA8, 0x07, 0x11, 0x8D, 0x6A, 0xA3, 0x49, 0x45, 0x97, 0x97, 0x0D, 0xEC,
+  0xAB, 0xB1, 0xAD, 0x74, 0x51, 0x97, 0x45, 0xE1, 0x12, 0x6E, 0xB7, 0xF4, 0x1A, 0x81, 0x94, 0x20,
+  0x16, 0xE7, 0x4A, 0x2C, 0x44, 0x32, 0xC9, 0xFF, 0xA5, 0xD3, 0xC9, 0x4F, 0xC2, 0x4B, 0xF0, 0xF8,
+  0xEE, 0x00, 0x9D, 0x91, 0x7E, 0x97, 0x26, 0x9C, 0x45, 0x60, 0x42, 0xAE, 0x0E, 0xEA, 0xD0, 0xB2,
+  0x04, 0x8A, 0x9A, 0xE3, 0x7A, 0x5B, 0x56, 0x6D, 0xF6, 0x73, 0x04, 0x9C, 0xF0, 0x9D, 0x96, 0x33,
+  0x30, 0x1D, 0xAF, 0xCE, 0x22, 0xAC, 0xEA, 0x2E, 0xAF, 0x1D, 0xAC, 0x37, 0xB8, 0xDB, 0xA9, 0x7F,
+  0x62, 0xB6, 0x99, 0x2A, 0x5A, 0xE0, 0x0B, 0xD1, 0x9D, 0x5C, 0xA2, 0x30, 0x41, 0x68, 0xBB, 0x78,
+  0x26, 0xDD, 0x9E, 0xD3, 0x44, 0xAA, 0x5A, 0x99, 0x4B, 0xEF, 0x51, 0x1F, 0xC9, 0xF3, 0x95, 0x0A,
+  0xE0, 0x52, 0xB1, 0x0C, 0x16, 0x43, 0x77, 0x15, 0x15, 0x78, 0x6C, 0x88, 0x54, 0x52, 0x45, 0xEF,
+  0x3F, 0x17, 0xFD, 0x18, 0xBD, 0x13, 0x63, 0x12, 0xF9, 0xF3, 0xEF, 0xFA, 0x49, 0x50, 0xC9, 0x34,
+  0x9F, 0x0C, 0x4D, 0x78, 0xCB, 0x75, 0x41, 0x36, 0xE6, 0x18, 0xA6, 0x66, 0x29, 0x66, 0x96, 0x94,
+  0xC7, 0x5B, 0xB8, 0x13, 0x97, 0x19, 0x0F, 0x1D, 0xC5, 0x30, 0xD8, 0x3C, 0x48, 0x17, 0x70, 0x19,
+  0x0E, 0x37, 0x03, 0x42, 0x72, 0xEA, 0x88, 0x1A, 0x33, 0x26, 0x5E, 0x6D, 0x84, 0x70, 0x7D, 0x6A,
+  0xD7, 0x94, 0x9A, 0x7F, 0x5A, 0xDB, 0x1B, 0x13, 0x6D, 0x49, 0x3B, 0x0A, 0x9A, 0xE2, 0x29, 0x5F,
+  0xDF, 0xCF, 0x2B, 0x89, 0xC0, 0x9B, 0x84, 0xD0, 0x2C, 0x77, 0xEA, 0xDB, 0x36, 0x4A, 0x6F, 0x7E,
+  0x05, 0x1B, 0x87, 0xAA, 0x75, 0x62, 0x03, 0x2D, 0x9C, 0x39, 0x53, 0xDA, 0x4A, 0x2D, 0xCF, 0x5B,
+  0x8B, 0x9E, 0x89, 0x28, 0x58, 0x33, 0x4F, 0xF8, 0x9C, 0x43, 0x6D, 0xB2, 0xAD, 0xF1, 0xCA, 0x9E,
+  0x87, 0xD1, 0x65, 0x81, 0xF1, 0x83, 0x1F, 0x61, 0x3C, 0x64, 0x1E, 0xC9, 0x18, 0x2F, 0x94, 0xE3,
+  0xFF, 0xC3, 0x86, 0xF5, 0x5B, 0x17, 0x44, 0x03, 0x05, 0xCB, 0xD9, 0x26, 0x52, 0xC2, 0x05, 0xDF,
+  0x1B, 0x2E, 0xE0, 0xF4, 0x93, 0x67, 0xC1, 0xB7, 0x3B, 0x34, 0x38, 0xA9, 0xAD, 0x91, 0xD8, 0x0D,
+  0x31, 0xC2, 0x61, 0x85, 0xDF, 0xB3, 0x03, 0x89, 0x2D, 0xA2, 0x4D, 0xE7, 0xBC, 0x60, 0x3B, 0xB9,
+  0xED, 0x38, 0x87, 0x3C, 0xDE, 0x37, 0xB3, 0x1D, 0x88, 0x83, 0x13, 0x99, 0x7E, 0xCC, 0xFF, 0x16,
+  0x48, 0x89, 0xCB, 0x73, 0xD2, 0x68, 0x49, 0x14, 0xE0, 0xF3, 0xFA, 0x6D, 0xDB, 0x33, 0xD9, 0x42,
+  0xBF, 0x03, 0x00, 0x00, 0x0C, 0x81, 0xF8, 0x48, 0x95, 0x73, 0xEE, 0x54, 0x80, 0xB1, 0x8A, 0xF7,
+  0xA7, 0x6E, 0x85, 0xBB, 0x95, 0x2C, 0x06, 0x1B, 0x8C, 0x6E, 0xD6, 0x26, 0x0E, 0xAA, 0x75, 0x83,
+  0x7B, 0x35, 0xB6, 0xF7, 0x16, 0x4C, 0x0E, 0xC9, 0xD7, 0xC1, 0x0D, 0x4E, 0x04, 0x18, 0x7B, 0x6F,
+  0xE0, 0x52, 0x52, 0x53, 0x6A, 0xC1, 0x87, 0xCC, 0x21, 0xA9, 0x75, 0x48, 0x25, 0x4D, 0xAF, 0xCF,
+  0xE0, 0x1F, 0x22, 0x22, 0x07, 0xFE, 0x8A, 0x34, 0x9E, 0x02, 0x69, 0x58, 0x77, 0xCD, 0x8C, 0xEE,
+  0x2E, 0x0C, 0x62, 0x54, 0x9B, 0x35, 0x6A, 0xF8, 0xA5, 0x0A, 0x78, 0x94, 0xF2, 0x51, 0x46, 0xD7,
+  0x51, 0x8E, 0x88, 0x6B, 0xDE, 0x49, 0x2D, 0x49, 0x01, 0x74, 0xAE, 0x22, 0x19, 0x28, 0x04, 0x74,
+  0x94, 0x1C, 0x4D, 0x6F, 0x8B, 0xD6, 0x27, 0x3C, 0x87, 0x5A, 0xD5, 0x9C, 0x57, 0xA0, 0x8D, 0x7F,
+  0xF4, 0xC5, 0x94, 0x50, 0x4D, 0x2E, 0xF7, 0xB3, 0xED, 0x22, 0x07, 0x7B, 0x9B, 0x27, 0x0F, 0xDD,
+  0xB4, 0x1A, 0x62, 0x76, 0x78, 0x24,
+};
+
+// lzfse-text-raw
+STATIC CONST UINT8  mFixture17[] = {
+  0x62, 0x76, 0x78, 0x2D, 0x84, 0x03, 0x00, 0x00, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62,
+  0x6F, 0x6F, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x64,
+  0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74,
+  0x6F, 0x72, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+  0x64, 0x69, 0x73, 0x6B, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x64, 0x69, 0x73, 0x6B,
+  0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65,
+  0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x64, 0x69, 0x73,
+  0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C,
+  0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x64, 0x72, 0x69,
+  0x76, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65,
+  0x72, 0x79, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x63,
+  0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+  0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x64, 0x69, 0x73, 0x6B,
+  0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x6F, 0x70, 0x65,
+  0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x63, 0x68, 0x75, 0x6E,
+  0x6B, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x62, 0x6F, 0x6F,
+  0x74, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x64,
+  0x69, 0x73, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65,
+  0x72, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x72,
+  0x69, 0x76, 0x65, 0x72, 0x20, 0x65, 0x66, 0x69, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70,
+  0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65,
+  0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x61, 0x70,
+  0x70, 0x6C, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6F,
+  0x6F, 0x74, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x70, 0x69,
+  0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x70,
+  0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75,
+  0x6D, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D,
+  0x65, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x61, 0x70, 0x70,
+  0x6C, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6B,
+  0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20,
+  0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x63, 0x68, 0x75,
+  0x6E, 0x6B, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x64, 0x69, 0x73, 0x6B,
+  0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x65, 0x66,
+  0x69, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65,
+  0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x63,
+  0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63,
+  0x6F, 0x72, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x74,
+  0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67,
+  0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x64,
+  0x69, 0x73, 0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72,
+  0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x73, 0x65, 0x63,
+  0x74, 0x6F, 0x72, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20,
+  0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x70, 0x69,
+  0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+  0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x72,
+  0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65,
+  0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x72,
+  0x69, 0x76, 0x65, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+  0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x73, 0x65,
+  0x63, 0x74, 0x6F, 0x72, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20,
+  0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x62, 0x76, 0x78, 0x32,
+  0xF4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x33, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x51, 0x00, 0x40, 0x8E, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xA0, 0x09, 0x8F, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xA0, 0x27, 0x97, 0xAE, 0x99, 0xAE, 0x1B, 0x02, 0x00, 0xB0, 0x58, 0xC7, 0xC0,
+  0x3A, 0x3E, 0x61, 0xDD, 0x9D, 0xAC, 0x13, 0x38, 0xB9, 0xBB, 0xBB, 0x3B, 0x39, 0xB9, 0x3B, 0xFE,
+  0x03, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0x30, 0x20, 0x76, 0xAB, 0xAA, 0x6A, 0x1D, 0x08, 0x13, 0xBA, 0xFD, 0xC0, 0x76,
+  0x48, 0x5F, 0xCD, 0x10, 0x5B, 0x3E, 0x10, 0x3E, 0xB0, 0x03, 0xB0, 0xDC, 0xF7, 0xA2, 0xB9, 0xC4,
+  0xEB, 0x35, 0x83, 0xF8, 0x6C, 0xEA, 0xDB, 0x2B, 0xFD, 0xA9, 0xE1, 0x68, 0x22, 0xE5, 0x7D, 0x06,
+  0x15, 0x88, 0x57, 0x64, 0xAF, 0x80, 0x16, 0x61, 0x35, 0x59, 0x25, 0x85, 0x62, 0x93, 0x3A, 0xA3,
+  0x7F, 0xA5, 0x9E, 0x8E, 0x58, 0x95, 0x8E, 0x19, 0x07, 0x5B, 0xA1, 0x6D, 0xDE, 0xD9, 0x46, 0x01,
+  0xFB, 0xFC, 0x0E, 0x62, 0x76, 0x78, 0x2D, 0xDC, 0x05, 0x00, 0x00, 0x63, 0x6F, 0x76, 0x65, 0x72,
+  0x79, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x65, 0x66, 0x69, 0x20, 0x64, 0x69, 0x73, 0x6B,
+  0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C,
+  0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20,
+  0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+  0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+  0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x69, 0x6D, 0x61,
+  0x67, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F,
+  0x72, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72,
+  0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+  0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x62, 0x6C,
+  0x6F, 0x63, 0x6B, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20,
+  0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65,
+  0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x73, 0x65,
+  0x63, 0x74, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x61, 0x70, 0x70, 0x6C,
+  0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x65,
+  0x66, 0x69, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C,
+  0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x63,
+  0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x72, 0x65, 0x63, 0x6F,
+  0x76, 0x65, 0x72, 0x79, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65,
+  0x6C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20,
+  0x64, 0x69, 0x73, 0x6B, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x65, 0x66, 0x69, 0x20, 0x64,
+  0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+  0x63, 0x6F, 0x72, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65,
+  0x6C, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69,
+  0x6D, 0x61, 0x67, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20,
+  0x62, 0x6F, 0x6F, 0x74, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B,
+  0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6B, 0x65, 0x72, 0x6E,
+  0x65, 0x6C, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65,
+  0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20,
+  0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x62, 0x6F, 0x6F,
+  0x74, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+  0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72,
+  0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x6F,
+  0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20,
+  0x65, 0x66, 0x69, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65,
+  0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65,
+  0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+  0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x6C, 0x6F,
+  0x63, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70,
+  0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x76, 0x6F, 0x6C,
+  0x75, 0x6D, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x62,
+  0x6F, 0x6F, 0x74, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65,
+  0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72,
+  0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64,
+  0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75,
+  0x6D, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x63,
+  0x68, 0x75, 0x6E, 0x6B, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20,
+  0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F,
+  0x76, 0x65, 0x72, 0x79, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6F, 0x6F, 0x74,
+  0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74,
+  0x6F, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20,
+  0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x61, 0x70, 0x70,
+  0x6C, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x62, 0x6F,
+  0x6F, 0x74, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x64, 0x72,
+  0x69, 0x76, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D,
+  0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20,
+  0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x69, 0x73,
+  0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x76,
+  0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x64,
+  0x69, 0x73, 0x6B, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20,
+  0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x74, 0x61,
+  0x62, 0x6C, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x65,
+  0x66, 0x69, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20,
+  0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6F,
+  0x6F, 0x74, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x70, 0x69, 0x63,
+  0x6B, 0x65, 0x72, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20,
+  0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63,
+  0x6F, 0x72, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x69, 0x6D,
+  0x61, 0x67, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+  0x65, 0x66, 0x69, 0x20, 0x65, 0x66, 0x69, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x63, 0x68, 0x75,
+  0x6E, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C,
+  0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x65, 0x66,
+  0x69, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x72,
+  0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x65, 0x66, 0x69, 0x20, 0x74, 0x61, 0x62, 0x6C,
+  0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x69, 0x6D, 0x61,
+  0x67, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x63, 0x68,
+  0x75, 0x6E, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63,
+  0x6F, 0x72, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20,
+  0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x69,
+  0x6D, 0x61, 0x67, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C,
+  0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E,
+  0x65, 0x6C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x6F, 0x62, 0x76, 0x78, 0x32, 0x64, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x80, 0x00, 0x00, 0x09, 0x00, 0x50, 0x00, 0x02, 0x0C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x8F,
+  0x00, 0x00, 0x00, 0x35, 0x94, 0x90, 0x0C, 0x1F, 0x02, 0x1B, 0x00, 0x00, 0x00, 0x80, 0x0D, 0xB0,
+  0x01, 0xB8, 0xDB, 0x9C, 0xED, 0x0D, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x13, 0xF0, 0x04,
+  0x00, 0x4F, 0x00, 0x00, 0x3C, 0x09, 0x0F, 0xC2, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC0, 0xA3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x0E, 0xC0, 0xA3, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+  0x09, 0xD1, 0x6E, 0x19, 0x71, 0x96, 0xEF, 0xEC, 0x4B, 0x18, 0x02, 0x05, 0x01, 0x62, 0x76, 0x78,
+  0x24,
+};
+
+// lzfse-mixed-raw
+STATIC CONST UINT8  mFixture18[] = {
+  0x62, 0x76, 0x78, 0x2D, 0x84, 0x03, 0x00, 0x00, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0xD1,
+  0x6C, 0xB8, 0x73, 0x3C, 0x68, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x6B, 0x65, 0x72, 0x6E,
+  0x65, 0x6C, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65,
+  0x20, 0x6F, 0x3D, 0xEA, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76,
+  0x65, 0x72, 0x79, 0x20, 0x65, 0x66, 0x69, 0x20, 0x1C, 0xA6, 0x80, 0x4E, 0x86, 0x44, 0xA3, 0x5C,
+  0x83, 0xB6, 0x9E, 0x25, 0xB7, 0x89, 0xC8, 0xD7, 0xC8, 0x3F, 0x50, 0xB1, 0x69, 0x6D, 0x61, 0x67,
+  0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x63,
+  0x68, 0x75, 0x6E, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x69, 0x6D, 0x61, 0x67,
+  0x65, 0x20, 0x30, 0x73, 0x6F, 0x2A, 0x6B, 0xD0, 0x03, 0x7C, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72,
+  0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x44, 0x13, 0xF6, 0x20, 0xFD, 0xA4, 0x66, 0x1E, 0xAF,
+  0x55, 0x29, 0xDF, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x51, 0xB5, 0x39, 0x03, 0x9B, 0xE6,
+  0x3B, 0x33, 0x8E, 0xD4, 0xB0, 0x15, 0x46, 0xD8, 0xC8, 0x83, 0xA7, 0xFF, 0x62, 0x6C, 0x6F, 0x63,
+  0x6B, 0x20, 0xB1, 0xC9, 0x3C, 0xAF, 0x9F, 0x59, 0x50, 0x5A, 0xA4, 0xBC, 0xC6, 0x06, 0x55, 0x57,
+  0x83, 0x92, 0x4D, 0x5C, 0x1A, 0x56, 0xED, 0xD7, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x62, 0x6C, 0x6F,
+  0x63, 0x6B, 0x20, 0x1B, 0x1D, 0x6B, 0x40, 0x58, 0x26, 0x47, 0xFE, 0x50, 0x79, 0x1B, 0x68, 0x7B,
+  0x4F, 0x17, 0x53, 0x3A, 0xC5, 0x9F, 0x44, 0xD8, 0x23, 0xA2, 0x9A, 0x41, 0xEA, 0xBA, 0x7B, 0x08,
+  0x7F, 0x0A, 0x5A, 0xCD, 0x1F, 0x94, 0x0D, 0xC9, 0xDC, 0xF6, 0x95, 0x54, 0x2F, 0x95, 0x83, 0x3D,
+  0x33, 0xA1, 0xA7, 0x66, 0x14, 0x13, 0x60, 0x1C, 0x37, 0x66, 0xA6, 0x37, 0x27, 0x15, 0xD4, 0x64,
+  0x69, 0x73, 0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72,
+  0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+  0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x43, 0x1C,
+  0x38, 0xEC, 0x80, 0xC6, 0x12, 0x63, 0xD5, 0x30, 0xBC, 0xED, 0xAB, 0x7E, 0x3B, 0x0A, 0x40, 0x74,
+  0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6D,
+  0x61, 0x67, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65,
+  0x72, 0x79, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x63, 0x68, 0x75,
+  0x6E, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+  0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0xB2, 0xC2, 0x21, 0xC8, 0xEC, 0x2C, 0x41,
+  0x1A, 0xF5, 0x70, 0xC4, 0xB6, 0xCE, 0x4A, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x61, 0x62,
+  0x6C, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0xE3, 0x42, 0x55,
+  0xB7, 0x30, 0x2B, 0x50, 0xBB, 0xA3, 0xF6, 0x11, 0x33, 0xB5, 0xF0, 0xD0, 0xBA, 0x74, 0xCC, 0xDE,
+  0x60, 0xFB, 0x72, 0x81, 0x5A, 0xB2, 0x8D, 0x4A, 0xD3, 0xDB, 0x0D, 0x77, 0x13, 0x27, 0x66, 0x6C,
+  0x00, 0x2E, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20,
+  0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x02, 0x42, 0x2B,
+  0xAB, 0x6F, 0x56, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x70, 0x69, 0x63, 0x6B,
+  0x65, 0x72, 0x20, 0x07, 0x99, 0x52, 0x74, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20,
+  0x1D, 0x74, 0x0E, 0xC9, 0xEB, 0x1A, 0x46, 0xE3, 0x3E, 0xEF, 0x1B, 0xCE, 0xD4, 0xF6, 0xA4, 0x5F,
+  0xBD, 0x3C, 0xC2, 0x19, 0x82, 0x90, 0x30, 0x48, 0x12, 0x01, 0x4F, 0xDE, 0x70, 0x1C, 0xAF, 0x0D,
+  0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0xEF, 0x3A, 0xB1,
+  0xFD, 0x50, 0xE3, 0x5E, 0x0B, 0x4C, 0xF6, 0x04, 0x6E, 0x65, 0x66, 0x69, 0x20, 0x65, 0x66, 0x69,
+  0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20,
+  0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x6F,
+  0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x72,
+  0x69, 0x76, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+  0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x27, 0xF9, 0x2B,
+  0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x2F, 0x70,
+  0x32, 0x6F, 0xEE, 0x12, 0xB7, 0xBB, 0xB0, 0xB1, 0xF6, 0xB0, 0x01, 0x84, 0x41, 0xD0, 0xE8, 0x1A,
+  0x5B, 0xB2, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x73,
+  0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F,
+  0x76, 0x65, 0x72, 0x79, 0x20, 0xB8, 0xBF, 0x71, 0x09, 0xC7, 0x6B, 0xAA, 0xA8, 0x34, 0x72, 0x0C,
+  0x65, 0x6B, 0x92, 0xF6, 0xB9, 0x2F, 0x40, 0x1B, 0x90, 0x7D, 0x54, 0xB5, 0xD7, 0x20, 0x73, 0x8A,
+  0x65, 0x66, 0x69, 0x20, 0xFA, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65,
+  0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x65, 0x66, 0x69, 0x20, 0x1E, 0xED, 0xF3, 0xB6, 0x87, 0x67,
+  0x0C, 0x26, 0x85, 0x55, 0xB3, 0xBD, 0x22, 0x5C, 0x35, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x65,
+  0x63, 0x74, 0x6F, 0x72, 0x20, 0xAB, 0x50, 0x11, 0x54, 0x8A, 0x64, 0x69, 0x62, 0x76, 0x78, 0x2D,
+  0x4C, 0x04, 0x00, 0x00, 0x73, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x65, 0x1E,
+  0x92, 0x88, 0xAC, 0x32, 0xF6, 0xE5, 0xD2, 0xDB, 0x5F, 0xD9, 0xB0, 0x74, 0x95, 0x56, 0x66, 0x62,
+  0x4F, 0x09, 0x17, 0x25, 0x4D, 0x46, 0x68, 0x21, 0x35, 0xB3, 0xB6, 0x64, 0x61, 0x74, 0x61, 0x20,
+  0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x72, 0x69, 0x76,
+  0x65, 0x72, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F,
+  0x72, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20,
+  0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x3C, 0x33, 0x64,
+  0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0xDA, 0xE1, 0x72, 0x73,
+  0xE0, 0xF3, 0x7F, 0xD2, 0x4D, 0xF6, 0x87, 0xF2, 0x8E, 0x13, 0xBD, 0x18, 0x94, 0x66, 0xB4, 0xB5,
+  0x19, 0x2F, 0xD6, 0x05, 0x3C, 0xEB, 0x31, 0x99, 0x0D, 0x8B, 0xA8, 0xA9, 0x1F, 0xA5, 0xFF, 0xC2,
+  0xB1, 0xB5, 0x26, 0x3C, 0x5D, 0xCB, 0x56, 0x58, 0x9F, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0xA3, 0x37,
+  0xC2, 0xBC, 0xAF, 0x2F, 0xCC, 0x5F, 0x4F, 0x50, 0xA7, 0x7D, 0xA4, 0x72, 0xF4, 0x6A, 0x4D, 0x77,
+  0x67, 0x61, 0x84, 0x38, 0x45, 0x54, 0xF8, 0x31, 0x9E, 0x73, 0x68, 0xED, 0x4B, 0x65, 0x66, 0x69,
+  0x20, 0xCB, 0x83, 0xE6, 0x0C, 0x16, 0x03, 0xCE, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x69,
+  0x6D, 0x61, 0x67, 0x65, 0x20, 0xE5, 0x95, 0x37, 0xE6, 0xBA, 0x9B, 0x49, 0x42, 0x71, 0xB9, 0x9E,
+  0x93, 0x49, 0x1F, 0xBE, 0xAD, 0xCF, 0x9A, 0x91, 0x5C, 0xF8, 0x7A, 0xE2, 0x61, 0x70, 0x70, 0x6C,
+  0x65, 0x20, 0x13, 0x05, 0x1C, 0xA9, 0x7D, 0x62, 0xF1, 0xEC, 0x98, 0xCC, 0x66, 0x80, 0x01, 0x2F,
+  0x84, 0x10, 0x56, 0x46, 0x20, 0xD2, 0x81, 0xFD, 0x0D, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20,
+  0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x3D, 0x4A, 0xE6, 0xE8, 0x3C, 0x2E, 0x82, 0xF5, 0xBE, 0x22,
+  0x3C, 0x65, 0x66, 0x69, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x2A, 0xAD, 0x14, 0xD6, 0x08, 0xC0,
+  0xD4, 0x85, 0x22, 0x60, 0x97, 0x34, 0xF6, 0xB2, 0x77, 0xBC, 0xE5, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+  0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0xE0, 0xE3, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x2B, 0x26, 0x72, 0xEE, 0xBE, 0x64, 0x61, 0x74, 0x61, 0x20, 0x65,
+  0x66, 0x69, 0x20, 0x51, 0x1F, 0x4F, 0x58, 0x64, 0xD0, 0x61, 0x12, 0x41, 0x4D, 0xFD, 0xF1, 0x66,
+  0x91, 0x2D, 0xE5, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x64, 0x69,
+  0x73, 0x6B, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x54, 0x84, 0x92, 0xEF, 0x89, 0x7A, 0x6B, 0x27,
+  0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x72, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72,
+  0x20, 0x05, 0x04, 0x1D, 0x89, 0xB9, 0xFE, 0x32, 0x34, 0xAD, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72,
+  0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0xC8,
+  0x1E, 0x93, 0x92, 0x24, 0x15, 0xDE, 0x92, 0x37, 0xE5, 0xDE, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+  0x62, 0x6F, 0x6F, 0x74, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F,
+  0x72, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64,
+  0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x64,
+  0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x62, 0x6C, 0x6F,
+  0x63, 0x6B, 0x20, 0x8A, 0x51, 0x1D, 0x9A, 0xB0, 0x40, 0x5A, 0x9D, 0x7E, 0x6A, 0x7A, 0x67, 0x76,
+  0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+  0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20,
+  0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x62, 0xCE, 0x40, 0x50, 0x33, 0x87, 0xA1,
+  0xCA, 0x34, 0x76, 0xEB, 0x29, 0x76, 0xC7, 0x5D, 0x08, 0x64, 0x12, 0x29, 0x47, 0xE7, 0x47, 0xF2,
+  0xDE, 0x3C, 0x57, 0x06, 0x65, 0x90, 0xA3, 0x5B, 0x5F, 0x4B, 0x4A, 0x93, 0x61, 0x0F, 0x67, 0xFD,
+  0x49, 0xB1, 0x73, 0x82, 0x20, 0xF5, 0xBB, 0xDD, 0xC3, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20,
+  0xFD, 0xA0, 0xE8, 0xA1, 0x48, 0x79, 0x57, 0xC5, 0x82, 0x47, 0xD6, 0xDD, 0xCD, 0xEF, 0x0C, 0x00,
+  0x75, 0xED, 0x9D, 0xF8, 0x84, 0xBA, 0x23, 0x8A, 0x25, 0xFA, 0xED, 0x83, 0xB9, 0x69, 0x7A, 0x87,
+  0x65, 0x66, 0x69, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0xEC, 0x69, 0xBD, 0xC9, 0x99,
+  0x61, 0x59, 0x49, 0xD0, 0x6E, 0x8E, 0xB8, 0x82, 0x8F, 0x67, 0xB3, 0x79, 0x1E, 0xEA, 0x67, 0x11,
+  0xE1, 0x3A, 0x73, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72,
+  0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x65, 0x66, 0x69, 0x20, 0x69,
+  0x6D, 0x61, 0x67, 0x65, 0x20, 0xAD, 0x89, 0x93, 0x88, 0x97, 0x02, 0x66, 0x64, 0xD1, 0x78, 0xBC,
+  0xB5, 0x3F, 0x99, 0x01, 0x34, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20,
+  0xE8, 0x1A, 0x46, 0x45, 0xC0, 0xCD, 0x64, 0x54, 0xA6, 0x9D, 0x44, 0xC5, 0x8C, 0x26, 0x89, 0x65,
+  0xFF, 0xD1, 0x3A, 0x1F, 0x24, 0x26, 0x19, 0x29, 0x74, 0xD5, 0xC5, 0xF1, 0x37, 0x82, 0x8F, 0xC6,
+  0x65, 0x66, 0x69, 0x20, 0x70, 0x3C, 0xBF, 0x8C, 0x61, 0x05, 0x93, 0x16, 0x61, 0x70, 0x70, 0x6C,
+  0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x61,
+  0x70, 0x70, 0x6C, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x20, 0xBE, 0x95, 0xEC, 0x9B, 0xEE, 0x09, 0x65, 0xA8, 0x25, 0x4F, 0x98, 0x49, 0x14, 0x85, 0x34,
+  0xBE, 0x14, 0x93, 0x05, 0x4E, 0x06, 0xD0, 0x34, 0xD0, 0xEB, 0x75, 0x44, 0x63, 0x68, 0x75, 0x6E,
+  0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20,
+  0x65, 0x66, 0x69, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F,
+  0x72, 0x65, 0x20, 0x75, 0x72, 0xCC, 0x5C, 0xD8, 0xD6, 0x20, 0x3F, 0x55, 0xF3, 0x89, 0x81, 0x0A,
+  0x3F, 0x12, 0x23, 0x54, 0x6B, 0x05, 0x80, 0xFB, 0x17, 0xF4, 0x71, 0x1F, 0x57, 0x86, 0x63, 0x68,
+  0x75, 0x6E, 0x6B, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x8E, 0x1D,
+  0x01, 0x84, 0x8B, 0x74, 0xF8, 0xA8, 0xC5, 0xBB, 0xE1, 0x4C, 0x3A, 0x75, 0x96, 0x4F, 0x25, 0xF2,
+  0xCB, 0x39, 0x1B, 0x35, 0x7D, 0x08, 0xE7, 0xA8, 0x3B, 0xB9, 0x26, 0x7F, 0xA3, 0xEC, 0x6B, 0x40,
+  0x70, 0x07, 0x4D, 0x83, 0xC9, 0x7B, 0xD0, 0xD4, 0xA8, 0xF2, 0xFF, 0xAB, 0x27, 0x3E, 0x9A, 0x84,
+  0x9A, 0x4C, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x36, 0xEA, 0xAE, 0x91, 0x54, 0x8B, 0x92, 0xDC,
+  0xCE, 0xAE, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x85, 0xE4, 0xC5, 0x04, 0xE6, 0xE1, 0xDD, 0xF1,
+  0x81, 0x78, 0x3D, 0x2B, 0x67, 0x7C, 0xC2, 0x5C, 0x9E, 0xDE, 0x93, 0x61, 0x70, 0x70, 0x6C, 0x65,
+  0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65,
+  0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0xCD, 0xF2, 0x8C, 0x6B, 0x5B, 0x68, 0xF9, 0x29, 0x38,
+  0x62, 0x76, 0x78, 0x24,
+};
+
+// lzfse-one-lzvn
+STATIC CONST UINT8  mFixture19[] = {
+  0x62, 0x76, 0x78, 0x6E, 0x01, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE1, 0xC6, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x76, 0x78, 0x24,
+};
+
+// lzfse-random-lzvn
+STATIC CONST UINT8  mFixture20[] = {
+  0x62, 0x76, 0x78, 0x6E, 0x2C, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0xE0, 0xFF, 0x19, 0x66,
+  0xFB, 0x7F, 0x2F, 0x90, 0x82, 0x95, 0x42, 0x4B, 0x45, 0x79, 0x9D, 0x17, 0x67, 0xE5, 0xB5, 0x93,
+  0x80, 0x81, 0x29, 0xCA, 0xF3, 0x10, 0x7A, 0x43, 0x0F, 0x5D, 0x8A, 0xC7, 0xE8, 0xE3, 0xD6, 0xF0,
+  0xF3, 0x3F, 0x73, 0x76, 0x64, 0x56, 0xCA, 0x39, 0x48, 0x46, 0x13, 0x0E, 0x61, 0x0E, 0x92, 0x4A,
+  0xC5, 0xFC, 0x94, 0x0F, 0x35, 0xDA, 0x28, 0x59, 0x3E, 0xD7, 0x9E, 0xC7, 0x12, 0x37, 0xC1, 0x2A,
+  0x24, 0xBA, 0xD3, 0xCF, 0x85, 0xCD, 0x4D, 0x8C, 0x01, 0x73, 0x53, 0x8D, 0xF8, 0xF2, 0xF9, 0xDC,
+  0xFE, 0x3D, 0x38, 0xB1, 0x32, 0x25, 0xAE, 0x7F, 0x5F, 0x3E, 0x19, 0xBB, 0xD4, 0x92, 0x92, 0x6A,
+  0x03, 0x08, 0x89, 0x71, 0xDC, 0x92, 0x84, 0x9C, 0xE7, 0x1A, 0x97, 0x6C, 0x24, 0x2A, 0xA2, 0xA1,
+  0xA3, 0x5D, 0x4D, 0x8A, 0xE2, 0x89, 0xC4, 0x0F, 0xE9, 0xAA, 0x33, 0x7B, 0x27, 0x8D, 0x00, 0x0A,
+  0x0B, 0x41, 0xCB, 0x36, 0x62, 0x3D, 0x27, 0xC2, 0x73, 0x51, 0x15, 0x83, 0xDC, 0x4E, 0x45, 0xF1,
+  0x2A, 0x74, 0x0B, 0x71, 0x3B, 0xA0, 0x22, 0x60, 0x54, 0x32, 0x24, 0xDF, 0x02, 0xBF, 0xC5, 0x61,
+  0xB1, 0x7C, 0xD3, 0xF5, 0x0E, 0x65, 0xEE, 0x54, 0x1C, 0x30, 0x07, 0xAA, 0x18, 0xF5, 0x99, 0x25,
+  0x0E, 0x9A, 0xAA, 0x3E, 0x37, 0x00, 0x80, 0xCA, 0x19, 0xEF, 0x24, 0xBF, 0x5D, 0xC2, 0x98, 0xC7,
+  0x6F, 0xD2, 0xD7, 0x87, 0xD8, 0xA3, 0x91, 0xAC, 0x5B, 0xD1, 0xA3, 0xBA, 0xD1, 0xB8, 0x58, 0x93,
+  0xC4, 0xE6, 0x62, 0xCA, 0xCE, 0x42, 0x96, 0xA5, 0xB0, 0xF9, 0x6B, 0xF4, 0x31, 0x2C, 0x30, 0x94,
+  0xBD, 0x5A, 0x10, 0xC2, 0xB9, 0x8F, 0xC8, 0x21, 0xA7, 0x4A, 0x22, 0x89, 0xFE, 0x2F, 0x38, 0x95,
+  0xC7, 0x71, 0x6A, 0xEB, 0xF7, 0xFD, 0x1C, 0x4A, 0x8F, 0x67, 0x30, 0x55, 0x76, 0x95, 0x47, 0x21,
+  0x11, 0x2E, 0xB7, 0x80, 0xA8, 0xC0, 0x4A, 0x0B, 0x78, 0xB3, 0xBC, 0xF1, 0x98, 0xE0, 0x0D, 0xF1,
+  0xF3, 0x82, 0x8C, 0x53, 0xFC, 0x7B, 0xAB, 0xCA, 0xCA, 0x0F, 0x31, 0x52, 0xAD, 0xBA, 0x23, 0x97,
+  0x93, 0xC5, 0xE6, 0x64, 0x02, 0x97, 0x9E, 0xCF, 0xD1, 0xC2, 0x47, 0x26, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x62, 0x76, 0x78, 0x24,
+};
+
+// lzfse-text-v1
+STATIC CONST UINT8  mFixture21[] = {
+  0x62, 0x76, 0x78, 0x31, 0xF4, 0x01, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x03, 0x03, 0xDC, 0x01, 0xD3, 0x00, 0x25, 0x02, 0xF9, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x05, 0x00,
+  0x2A, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x13, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00,
+  0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0D, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x0D, 0x00, 0x04, 0x00, 0x0D, 0x00, 0x04, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x16, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1A, 0x00, 0x35, 0x00, 0x0D, 0x00, 0x04, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x16, 0x00, 0x42, 0x00, 0x21, 0x00, 0x83, 0x00, 0x0B, 0x00,
+  0x0B, 0x00, 0x0B, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x2C, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x59, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x16, 0x00, 0x2C, 0x00, 0x16, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x3F, 0x69, 0x55, 0x08, 0x43, 0xFA, 0x37, 0xCE, 0x68,
+  0xBB, 0x6C, 0x07, 0xDC, 0x38, 0x78, 0x41, 0xDC, 0x7F, 0x16, 0x42, 0x9F, 0xAC, 0xEB, 0x14, 0x0B,
+  0xD6, 0x7A, 0xF2, 0x40, 0x8D, 0xC6, 0x99, 0x4C, 0x4F, 0xE0, 0xCA, 0x8E, 0x12, 0xE7, 0x1C, 0xD2,
+  0xD2, 0x09, 0x0D, 0x0F, 0x42, 0x10, 0x80, 0x41, 0x71, 0x87, 0xC3, 0xA0, 0x7E, 0x59, 0x57, 0x75,
+  0xA9, 0x73, 0x24, 0x10, 0xA4, 0x49, 0xE1, 0x6F, 0xFF, 0x91, 0x1D, 0x51, 0xD1, 0xE8, 0x4A, 0xCB,
+  0x60, 0xE8, 0xB8, 0xD6, 0x27, 0x26, 0x2F, 0x14, 0x22, 0x6C, 0x64, 0xD9, 0x7B, 0xDB, 0x7A, 0xEE,
+  0xA0, 0x59, 0x79, 0x2A, 0xEF, 0x51, 0x64, 0xE0, 0x3D, 0x33, 0xFB, 0x2B, 0x8B, 0x39, 0xAF, 0x12,
+  0x4E, 0xAA, 0x12, 0xE5, 0x2E, 0x96, 0xB1, 0xE0, 0xF0, 0xB0, 0xF6, 0x26, 0x0D, 0xE5, 0x40, 0x05,
+  0xC3, 0x5F, 0xEC, 0xBE, 0x34, 0x47, 0x85, 0x8A, 0xCD, 0xFF, 0x01, 0x62, 0x76, 0x78, 0x31, 0x84,
+  0x03, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x23, 0x00, 0xA3, 0x00, 0x3F, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02,
+  0x00, 0x13, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x01, 0x00, 0x09, 0x00, 0x04,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x0D,
+  0x00, 0x05, 0x00, 0x05, 0x00, 0x12, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x12, 0x00, 0x26,
+  0x00, 0x07, 0x00, 0x0D, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0xA0, 0xEC, 0xDE, 0xAB, 0xB0, 0x1A, 0x14,
+  0xA2, 0x88, 0x3B, 0xFF, 0xF4, 0xAA, 0xE7, 0xF9, 0x43, 0x99, 0xBB, 0x8D, 0x7E, 0x3B, 0xEA, 0x70,
+  0x0D, 0x08, 0xE6, 0xCE, 0x17, 0xE4, 0x53, 0xCA, 0xAE, 0x57, 0xE2, 0x98, 0x53, 0x5C, 0xBC, 0x24,
+  0x9F, 0xC2, 0xA5, 0xD0, 0x27, 0x69, 0xF7, 0x67, 0x90, 0x0B, 0xFA, 0x53, 0x54, 0x1F, 0x42, 0x25,
+  0xDC, 0xC6, 0x43, 0x89, 0x84, 0xC2, 0x28, 0x13, 0x5E, 0xF2, 0x77, 0xB0, 0xC7, 0xAA, 0x57, 0x79,
+  0xC7, 0xDB, 0x21, 0x51, 0xAD, 0x0D, 0x3F, 0xFB, 0x48, 0xE1, 0xCE, 0x47, 0x21, 0x68, 0x01, 0x57,
+  0x15, 0xBD, 0xA2, 0x98, 0xAB, 0x9C, 0x1D, 0xC9, 0x9A, 0xC4, 0x6B, 0x06, 0xEA, 0xB3, 0x7A, 0x2A,
+  0x28, 0x85, 0x81, 0x87, 0x51, 0x2D, 0xA8, 0x72, 0x74, 0x1C, 0x47, 0xF4, 0xD2, 0xBB, 0xAE, 0xF1,
+  0x0F, 0xB1, 0xC6, 0xE3, 0x14, 0xB4, 0x23, 0x29, 0xFF, 0x84, 0xBB, 0x49, 0x90, 0xF0, 0xFD, 0xA6,
+  0x96, 0x36, 0xAA, 0xC2, 0xC0, 0xB8, 0x14, 0x8A, 0xE0, 0x5E, 0x29, 0x57, 0x72, 0x37, 0xB5, 0x8B,
+  0xC5, 0x34, 0xB7, 0x88, 0x62, 0x76, 0x78, 0x31, 0x84, 0x03, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x0E, 0x00, 0x5D, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x06, 0x00, 0x02, 0x00,
+  0x03, 0x00, 0x02, 0x00, 0x07, 0x00, 0x08, 0x00, 0x11, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x09, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x12, 0x00, 0x0C, 0x00, 0x09, 0x00, 0x03, 0x00, 0x29, 0x00,
+  0x0F, 0x00, 0x0F, 0x00, 0x16, 0x00, 0x19, 0x00, 0x09, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0xC0, 0x20, 0xFE, 0xEE, 0x3A, 0xE8, 0x2A, 0xC5, 0xB0, 0x4A, 0x6B, 0x46, 0x81, 0x0C, 0xA0,
+  0xA4, 0x3D, 0xC7, 0x8D, 0xDF, 0x96, 0xC7, 0x7C, 0x00, 0xDD, 0x57, 0x20, 0xA7, 0xC9, 0x06, 0x9A,
+  0xB9, 0xAF, 0x22, 0x18, 0x28, 0x5E, 0xCE, 0xDE, 0xF7, 0x78, 0xB3, 0x60, 0xCC, 0x0D, 0xDE, 0x49,
+  0x38, 0x0A, 0xDE, 0x58, 0x64, 0x07, 0x6E, 0xA9, 0xD7, 0x7F, 0xAD, 0x5A, 0x1C, 0xEC, 0xA6, 0x71,
+  0xD1, 0x54, 0x84, 0x97, 0xE5, 0xB0, 0xBC, 0x27, 0x87, 0xC4, 0x87, 0x9F, 0xAA, 0x5A, 0x68, 0x42,
+  0xEE, 0x1E, 0xE5, 0xCD, 0x5D, 0xB3, 0x4C, 0xC7, 0x4B, 0x44, 0x25, 0x67, 0x7B, 0x85, 0xC0, 0x81,
+  0xAD, 0x89, 0x90, 0xF1, 0xBA, 0x26, 0xA8, 0x49, 0xAB, 0x14, 0xA1, 0x65, 0x13, 0x86, 0x3A, 0xB9,
+  0x0D, 0x3E, 0xD5, 0xA1, 0xB8, 0xE9, 0x4E, 0x05, 0x49, 0x4C, 0x8C, 0x28, 0x74, 0x51, 0xDA, 0x95,
+  0xFD, 0xB4, 0xBD, 0xAA, 0xBB, 0x95, 0x47, 0xA7, 0xD7, 0xB9, 0xCA, 0x88, 0xE3, 0x3E, 0x02, 0x62,
+  0x76, 0x78, 0x31, 0xBC, 0x02, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x00,
+  0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x0E, 0x00, 0x48,
+  0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x01, 0x00, 0x07, 0x00, 0x05, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06,
+  0x00, 0x0A, 0x00, 0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04,
+  0x00, 0x0C, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x24, 0x00, 0x10, 0x00, 0x04,
+  0x00, 0x14, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x02, 0x8A,
+  0x22, 0x2D, 0xF0, 0x38, 0x8F, 0xF1, 0x23, 0xA3, 0x6B, 0xB6, 0x20, 0x27, 0xD8, 0x58, 0x7F, 0xA6,
+  0x19, 0x2D, 0x7D, 0x40, 0x11, 0x71, 0x66, 0x8D, 0xB3, 0xAD, 0x8D, 0x5D, 0x80, 0xA0, 0xE0, 0x9B,
+  0xD4, 0x7F, 0x42, 0x7C, 0xF1, 0xC5, 0x69, 0x70, 0x3B, 0x48, 0xC0, 0xFF, 0x65, 0x3E, 0x13, 0x24,
+  0xE9, 0x88, 0x28, 0x22, 0xF4, 0xB7, 0x5D, 0xD6, 0xDF, 0x59, 0x25, 0x8B, 0x34, 0xBE, 0x82, 0x0E,
+  0x8E, 0x50, 0x11, 0x4B, 0x01, 0x31, 0x9E, 0x2D, 0x22, 0xDF, 0x38, 0x72, 0x73, 0x32, 0x49, 0x82,
+  0x55, 0x7B, 0x4B, 0x33, 0x6C, 0x48, 0xC9, 0xF1, 0x3D, 0x89, 0x0C, 0x85, 0xB8, 0x38, 0x2A, 0x8D,
+  0xD0, 0x9D, 0x44, 0xA5, 0xDE, 0xC1, 0x7E, 0xAC, 0x5B, 0x04, 0xF6, 0xAF, 0x06, 0x62, 0x76, 0x78,
+  0x24,
+};
+
+// lzfse-mixed-v1
+STATIC CONST UINT8  mFixture22[] = {
+  0x62, 0x76, 0x78, 0x31, 0xDC, 0x05, 0x00, 0x00, 0x72, 0x03, 0x00, 0x00, 0xB8, 0x02, 0x00, 0x00,
+  0x6D, 0x00, 0x00, 0x00, 0xA2, 0x02, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF,
+  0xA0, 0x02, 0x59, 0x02, 0x4A, 0x02, 0x9D, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x2E, 0x00,
+  0x23, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x16, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00,
+  0x07, 0x00, 0x04, 0x00, 0x04, 0x00, 0x07, 0x00, 0x07, 0x00, 0x09, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x04, 0x00, 0x09, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x09, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x10, 0x00,
+  0x15, 0x00, 0x25, 0x00, 0x09, 0x00, 0x04, 0x00, 0x02, 0x00, 0x12, 0x00, 0x0B, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x07, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x05, 0x00, 0x07, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00,
+  0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x05, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x05, 0x00,
+  0x05, 0x00, 0x16, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x05, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00,
+  0x08, 0x00, 0x05, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0B, 0x00, 0x04, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x07, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00,
+  0x07, 0x00, 0x0A, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x05, 0x00, 0x07, 0x00,
+  0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x04, 0x00, 0xAD, 0x00, 0x0D, 0x00,
+  0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x02, 0x00, 0x0E, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x05, 0x00,
+  0x11, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x14, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x02, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00,
+  0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x07, 0x00, 0x05, 0x00, 0x02, 0x00, 0x01, 0x00,
+  0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05, 0x00, 0x01, 0x00, 0x02, 0x00,
+  0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x05, 0x00, 0x02, 0x00, 0x01, 0x00, 0x07, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05, 0x00,
+  0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x02, 0x00,
+  0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x02, 0x00,
+  0x04, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x0E, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x5A, 0x31, 0xD4, 0x11, 0x51, 0x69, 0x33,
+  0x7E, 0x99, 0x6C, 0x18, 0x7C, 0xA9, 0x04, 0xCB, 0xBA, 0x8B, 0x8B, 0xB9, 0xB5, 0xCE, 0x6F, 0xAE,
+  0xAE, 0x65, 0x77, 0x24, 0xD6, 0xD4, 0xBF, 0x2A, 0xB2, 0x32, 0x10, 0x78, 0x89, 0x37, 0xD4, 0xE9,
+  0x75, 0xB9, 0xC7, 0x3C, 0xDD, 0x14, 0xB0, 0x46, 0xF7, 0xFE, 0xCF, 0xBD, 0xB2, 0x8C, 0x14, 0x63,
+  0x21, 0xE8, 0x27, 0xCC, 0xAA, 0xFF, 0x04, 0x20, 0xB7, 0xB2, 0x3C, 0xB0, 0x52, 0x75, 0xCA, 0x65,
+  0xC9, 0x17, 0xC5, 0x67, 0x59, 0x66, 0xB5, 0x09, 0x1F, 0x1B, 0x12, 0x46, 0xC7, 0xF2, 0xA0, 0xC5,
+  0xF7, 0x56, 0x1A, 0x1F, 0x0B, 0xCF, 0x73, 0xF6, 0xF9, 0xBB, 0xC9, 0xD7, 0x6C, 0x15, 0x93, 0x24,
+  0xE6, 0x00, 0xB7, 0x13, 0x04, 0xF3, 0xCE, 0xBB, 0xAF, 0x62, 0x1A, 0x2F, 0x39, 0xA0, 0xD1, 0x46,
+  0x95, 0x5F, 0x07, 0x1C, 0x9F, 0xB1, 0xC8, 0xB3, 0x2E, 0x79, 0xEA, 0x00, 0xA5, 0xBE, 0x89, 0xE5,
+  0xFB, 0x58, 0xC5, 0xB7, 0xEE, 0xEA, 0x26, 0x1E, 0x76, 0x74, 0x30, 0x0C, 0x04, 0xDC, 0x4B, 0x5F,
+  0xA1, 0xE8, 0xB7, 0xD4, 0xBC, 0x27, 0xCD, 0x8B, 0x34, 0x4A, 0xA2, 0xF8, 0x9F, 0x09, 0xBF, 0x3F,
+  0xC4, 0x5A, 0x28, 0x02, 0x80, 0x0A, 0x33, 0x25, 0x5C, 0xFB, 0x56, 0xD0, 0x90, 0x55, 0x5F, 0xA8,
+  0x03, 0xBB, 0x29, 0x80, 0x3C, 0x66, 0x20, 0xA0, 0x69, 0xDE, 0xFA, 0x87, 0xD8, 0xAB, 0x11, 0x63,
+  0xB6, 0xAF, 0xBE, 0xD4, 0x12, 0xD9, 0xC3, 0x73, 0xEF, 0x47, 0xD0, 0x3F, 0x98, 0x75, 0x3E, 0x90,
+  0x9D, 0xB9, 0xDE, 0xCF, 0xCC, 0xFF, 0xB3, 0xD8, 0xE0, 0xC7, 0xAE, 0x78, 0x9F, 0x3D, 0xBD, 0x8A,
+  0x58, 0x92, 0xCF, 0xEC, 0x4E, 0x09, 0x76, 0xFB, 0x7F, 0x5F, 0x19, 0x80, 0x2C, 0x25, 0xB5, 0x5F,
+  0x7A, 0x31, 0x05, 0x52, 0x2D, 0xD7, 0x7D, 0x9D, 0x02, 0x34, 0x7A, 0x4B, 0xE7, 0xDA, 0xE3, 0x29,
+  0xC1, 0x63, 0x96, 0x8E, 0x1E, 0xB2, 0x9E, 0x8F, 0x65, 0x83, 0x0E, 0x20, 0xCF, 0x4B, 0x7F, 0x47,
+  0x71, 0x3D, 0x56, 0xD1, 0x36, 0xDA, 0xC8, 0xF3, 0xF2, 0x46, 0xAE, 0x1C, 0xCF, 0xC5, 0x9C, 0xD1,
+  0x1D, 0xE0, 0xB1, 0x5C, 0xDC, 0x08, 0x24, 0x5D, 0x0B, 0x9C, 0x69, 0x51, 0x77, 0x6C, 0x86, 0xC7,
+  0x8F, 0x5B, 0xB2, 0xA0, 0x32, 0xFD, 0x66, 0xE5, 0xF6, 0xB4, 0x5A, 0xC1, 0x52, 0x59, 0xF3, 0x3C,
+  0xA2, 0x1F, 0x32, 0xE5, 0x02, 0xE5, 0x78, 0xA6, 0x77, 0x3B, 0x42, 0x9F, 0x06, 0x88, 0xF5, 0x9C,
+  0x34, 0xA9, 0xB9, 0x1E, 0x20, 0x40, 0x05, 0xBC, 0x4F, 0xB7, 0xF7, 0xE7, 0xAD, 0x18, 0xF3, 0x69,
+  0x48, 0xD7, 0xFC, 0x10, 0xA9, 0x2D, 0xED, 0xB6, 0x9D, 0x41, 0xF9, 0x5F, 0xC2, 0x24, 0x2A, 0x20,
+  0x56, 0xBD, 0x44, 0xE5, 0x4A, 0x8F, 0x91, 0x42, 0xC3, 0x02, 0x60, 0xB2, 0x28, 0x7A, 0x81, 0x74,
+  0x04, 0xD4, 0xCB, 0x7A, 0x9A, 0xCE, 0x33, 0xBB, 0x78, 0xF6, 0x21, 0x56, 0xC2, 0x23, 0x57, 0x8F,
+  0xB7, 0x46, 0xAC, 0xD0, 0x72, 0x05, 0x2D, 0x07, 0xC8, 0xD0, 0x3F, 0x30, 0x27, 0x1A, 0x6B, 0xF7,
+  0x74, 0x78, 0x86, 0x65, 0x7D, 0x18, 0x09, 0xCE, 0xCD, 0xF1, 0x61, 0xB7, 0xC9, 0xB3, 0xFD, 0x9B,
+  0x8E, 0x6E, 0x85, 0x58, 0xD8, 0xC9, 0xA4, 0x8D, 0x11, 0xD2, 0x72, 0x3C, 0x05, 0x03, 0xD5, 0xD9,
+  0xB5, 0x42, 0x4E, 0xD7, 0x66, 0xDE, 0x25, 0x59, 0xF3, 0x9D, 0xB8, 0x49, 0x58, 0x6E, 0x35, 0x45,
+  0x33, 0xD4, 0x2E, 0x28, 0x0A, 0x5A, 0xD0, 0xDF, 0x17, 0x13, 0x0D, 0x77, 0x7C, 0xD5, 0xBE, 0x49,
+  0xEC, 0xBC, 0x18, 0xA6, 0x89, 0x51, 0x8B, 0xC2, 0x6A, 0x75, 0xF2, 0xDE, 0xF0, 0x0D, 0xFA, 0x20,
+  0x7D, 0x0E, 0xC1, 0x38, 0x60, 0x97, 0x5E, 0x40, 0x16, 0x8A, 0x24, 0x4C, 0x17, 0xFA, 0x5F, 0x41,
+  0x0B, 0xD5, 0x2D, 0x63, 0xDC, 0x0F, 0x63, 0x4B, 0x4C, 0x34, 0x3A, 0x15, 0xCC, 0x29, 0x3F, 0x2E,
+  0xB0, 0x95, 0x91, 0xC8, 0x9C, 0xEB, 0x05, 0x1A, 0x06, 0x86, 0xA0, 0x64, 0xFA, 0xF1, 0xA9, 0xE3,
+  0xFA, 0xA5, 0xA4, 0xFA, 0xAF, 0x20, 0xC6, 0x2B, 0x65, 0x97, 0x53, 0xA9, 0xB9, 0xAD, 0x55, 0x98,
+  0xE1, 0xFD, 0x03, 0x7C, 0x01, 0xA2, 0x80, 0x5D, 0x42, 0x4A, 0x32, 0xB6, 0x90, 0xDF, 0x86, 0xBB,
+  0x0B, 0x75, 0xA5, 0x20, 0x3A, 0x6D, 0x54, 0x80, 0xE1, 0x3E, 0x24, 0x0E, 0x65, 0x44, 0xD4, 0xA4,
+  0x21, 0xE3, 0x00, 0x25, 0x9B, 0x8C, 0xD9, 0x20, 0xA6, 0xF5, 0x46, 0xE3, 0x45, 0x3F, 0x01, 0x00,
+  0x90, 0x7E, 0xDD, 0x49, 0x01, 0x5D, 0x13, 0xE8, 0x22, 0x4D, 0x19, 0x54, 0xDD, 0xCE, 0xBA, 0xBC,
+  0xAE, 0x76, 0xBE, 0x43, 0x97, 0x11, 0xD9, 0x7A, 0xF0, 0xA1, 0x49, 0x4B, 0x32, 0x8A, 0x94, 0xB1,
+  0x27, 0x09, 0x57, 0x45, 0x0B, 0x01, 0xF2, 0xC9, 0x7B, 0xFA, 0xF7, 0xC5, 0xCA, 0xA8, 0x9A, 0x39,
+  0x52, 0x44, 0x72, 0x39, 0x3A, 0x01, 0x00, 0x00, 0xE8, 0x00, 0x02, 0x68, 0xBA, 0xF0, 0x83, 0x02,
+  0x07, 0x84, 0x86, 0xC1, 0x25, 0x91, 0x56, 0x4F, 0xF9, 0x36, 0xB6, 0x7B, 0x1B, 0xE2, 0x76, 0x21,
+  0x50, 0xE7, 0x6F, 0x33, 0x4C, 0xFC, 0x29, 0x0D, 0x08, 0x67, 0x05, 0x50, 0x19, 0xAC, 0xAE, 0x5F,
+  0x04, 0x69, 0x87, 0x5A, 0xD4, 0x0E, 0x54, 0x30, 0xE6, 0x6A, 0x54, 0x83, 0x62, 0x81, 0x78, 0x91,
+  0xDB, 0x6A, 0x73, 0xAE, 0x6D, 0xDB, 0xEC, 0x40, 0x8D, 0xD2, 0x5C, 0xAD, 0x90, 0x9B, 0xF5, 0xF4,
+  0x89, 0x4E, 0x61, 0x07, 0x5D, 0xE8, 0xCD, 0x7A, 0x0B, 0x15, 0x19, 0xDE, 0x7D, 0x44, 0x48, 0x09,
+  0x2F, 0x26, 0x69, 0x46, 0x9C, 0x89, 0x51, 0x9A, 0x32, 0x55, 0x21, 0xAF, 0xC6, 0x25, 0x3C, 0x4B,
+  0xB4, 0x78, 0x90, 0x78, 0x62, 0x98, 0x14, 0x72, 0xA8, 0x44, 0x7C, 0xF5, 0x86, 0x81, 0x65, 0xC8,
+  0x55, 0x8B, 0xED, 0x11, 0xBD, 0xD5, 0x7B, 0xC9, 0x31, 0x04, 0x51, 0x0B, 0x4F, 0xC4, 0xC2, 0x48,
+  0x55, 0x63, 0xCA, 0xCE, 0x46, 0x6C, 0x92, 0xB2, 0x00, 0x8E, 0xA5, 0x06, 0x9C, 0x98, 0xC0, 0x2D,
+  0x3D, 0xDC, 0x74, 0x3E, 0xFF, 0x8A, 0x46, 0xBF, 0x5B, 0xF5, 0x39, 0xDF, 0x92, 0xE4, 0x63, 0xC3,
+  0xE6, 0x88, 0x83, 0x61, 0xFD, 0x74, 0x2B, 0x52, 0x25, 0x3B, 0x59, 0x62, 0x14, 0xE4, 0x1E, 0xE3,
+  0xED, 0x04, 0x40, 0x55, 0xE3, 0xFE, 0xD4, 0xBE, 0x49, 0x52, 0xF2, 0xF0, 0xBD, 0x75, 0x4F, 0xDE,
+  0x10, 0xB0, 0xFF, 0x68, 0xE3, 0x23, 0x62, 0x76, 0x78, 0x31, 0xF4, 0x01, 0x00, 0x00, 0x50, 0x01,
+  0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x1B, 0x01, 0x00, 0x00, 0x35, 0x00,
+  0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x1E, 0x01, 0x9F, 0x00, 0x0B, 0x02, 0x79, 0x02, 0xFB, 0xFF,
+  0xFF, 0xFF, 0x3D, 0x00, 0x28, 0x00, 0x35, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x0B, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x02, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x12, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x00, 0x38, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x03, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x0D, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0A, 0x00, 0x03, 0x00,
+  0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x0D, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x0D, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0D, 0x00, 0x06, 0x00,
+  0x0A, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x06, 0x00,
+  0x0A, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00,
+  0x0A, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0D, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x03, 0x03,
+  0xB8, 0x68, 0xC3, 0xFB, 0x98, 0x13, 0xC3, 0xF8, 0x47, 0x68, 0xCA, 0x41, 0xCD, 0x9C, 0xFA, 0x0E,
+  0x14, 0xF4, 0xDE, 0x3B, 0xEF, 0x4C, 0xB2, 0x7C, 0x23, 0xEA, 0xCF, 0x29, 0x38, 0x09, 0xC4, 0x51,
+  0xB2, 0xA3, 0x69, 0x9D, 0x31, 0x8C, 0xB9, 0x37, 0xAB, 0x16, 0x4B, 0x29, 0xC2, 0x8C, 0x18, 0x07,
+  0x97, 0xD3, 0xDD, 0x25, 0x6B, 0x44, 0x9C, 0x80, 0x36, 0xA8, 0x12, 0xB4, 0x1E, 0x47, 0x6A, 0xCA,
+  0x22, 0xED, 0x66, 0x3B, 0x7A, 0x03, 0x7F, 0x43, 0x5D, 0x11, 0x10, 0x8F, 0xAE, 0xB5, 0xA3, 0x72,
+  0x94, 0xC3, 0xDE, 0xF1, 0xB2, 0x28, 0x40, 0x43, 0x76, 0xE9, 0x90, 0x42, 0x59, 0xCF, 0xC2, 0x64,
+  0x3E, 0x5C, 0xDF, 0x70, 0x2D, 0x18, 0x59, 0xAE, 0x68, 0x1F, 0x4D, 0x44, 0xBB, 0x46, 0x3D, 0xD3,
+  0x30, 0x87, 0xA7, 0x43, 0xAA, 0x84, 0x4D, 0xC9, 0x22, 0x69, 0x3F, 0xF9, 0xB7, 0x1D, 0x7E, 0x8D,
+  0xC6, 0x34, 0x73, 0x69, 0x44, 0xA9, 0xB0, 0x71, 0xB2, 0x81, 0xA6, 0x38, 0x66, 0x2A, 0xC7, 0x65,
+  0x73, 0x1B, 0x7E, 0x5B, 0xC7, 0xF4, 0x31, 0x15, 0xEC, 0x25, 0x51, 0x59, 0xA1, 0x18, 0x85, 0x13,
+  0xD8, 0xF1, 0x4D, 0x88, 0x04, 0x4C, 0x9F, 0xF2, 0xEA, 0xB6, 0x42, 0x4F, 0x21, 0xBE, 0xB4, 0x27,
+  0x5E, 0xBC, 0x15, 0xB5, 0xD6, 0xEA, 0x8A, 0x83, 0xB1, 0x72, 0xA9, 0xFB, 0xF1, 0xF4, 0xDD, 0x65,
+  0xBF, 0x44, 0xA9, 0x37, 0x0D, 0x35, 0x05, 0xC3, 0xF1, 0xF0, 0xC7, 0x71, 0x7A, 0xD9, 0x81, 0x09,
+  0xC8, 0x0C, 0x90, 0x83, 0xAD, 0xF6, 0xB8, 0xCF, 0xFA, 0xC6, 0x5B, 0x56, 0xA7, 0xB8, 0x61, 0x3B,
+  0x13, 0x70, 0xF5, 0x3C, 0x0C, 0x9A, 0x83, 0x7F, 0xCB, 0x8A, 0xF7, 0x78, 0xA8, 0x77, 0xA6, 0xA1,
+  0x5D, 0xB5, 0x91, 0xD1, 0x70, 0x07, 0x6A, 0x80, 0xDE, 0xED, 0x34, 0x3D, 0x21, 0x14, 0x98, 0x3B,
+  0x81, 0x4E, 0xF8, 0x8C, 0x29, 0x71, 0x81, 0x77, 0x73, 0x0E, 0x49, 0xB4, 0x7D, 0x91, 0xE7, 0x7A,
+  0x24, 0x98, 0x4D, 0x15, 0x1E, 0x00, 0xC0, 0x30, 0x84, 0x63, 0xAA, 0x9C, 0xE9, 0xA5, 0xF9, 0x86,
+  0x25, 0xDE, 0xAF, 0xDD, 0xCA, 0xFF, 0xF2, 0x38, 0xE8, 0x96, 0x3E, 0xD4, 0x32, 0x5E, 0x35, 0xCF,
+  0xE0, 0x9E, 0xC6, 0xBE, 0xCB, 0x7C, 0xAA, 0x89, 0x5F, 0x05, 0x1A, 0xD4, 0x91, 0x8E, 0xAE, 0x6B,
+  0x96, 0x74, 0x11, 0xA9, 0x50, 0x0C, 0x91, 0x9D, 0x8B, 0x00, 0x62, 0x76, 0x78, 0x24,
+};
+
+STATIC CONST COMPRESSION_FIXTURE  mFixtures[] = {
+  { "adc-one", FixtureFormatAdc, FixtureKindRandom, 1U, 1U, mFixture0, sizeof (mFixture0) },
+  { "adc-text", FixtureFormatAdc, FixtureKindText, 3000U, 2U, mFixture1, sizeof (mFixture1) },
+  { "adc-runs", FixtureFormatAdc, FixtureKindRuns, 4000U, 3U, mFixture2, sizeof (mFixture2) },
+  { "adc-random", FixtureFormatAdc, FixtureKindRandom, 300U, 4U, mFixture3, sizeof (mFixture3) },
+  { "adc-mixed", FixtureFormatAdc, FixtureKindMixed, 2000U, 5U, mFixture4, sizeof (mFixture4) },
+  { "bzip2-one-level9", FixtureFormatBzip2, FixtureKindRandom, 1U, 1U, mFixture5, sizeof (mFixture5) },
+  { "bzip2-text-level9", FixtureFormatBzip2, FixtureKindText, 3000U, 2U, mFixture6, sizeof (mFixture6) },
+  { "bzip2-runs-level9", FixtureFormatBzip2, FixtureKindRuns, 4000U, 3U, mFixture7, sizeof (mFixture7) },
+  { "bzip2-random-level9", FixtureFormatBzip2, FixtureKindRandom, 300U, 4U, mFixture8, sizeof (mFixture8) },
+  { "bzip2-mixed-level9", FixtureFormatBzip2, FixtureKindMixed, 2000U, 5U, mFixture9, sizeof (mFixture9) },
+  { "bzip2-text-level1", FixtureFormatBzip2, FixtureKindText, 3000U, 2U, mFixture10, sizeof (mFixture10) },
+  { "bzip2-mixed-concatenated", FixtureFormatBzip2, FixtureKindMixed, 2000U, 5U, mFixture11, sizeof (mFixture11) },
+  { "lzfse-one-v2", FixtureFormatLzfse, FixtureKindRandom, 1U, 1U, mFixture12, sizeof (mFixture12) },
+  { "lzfse-text-v2", FixtureFormatLzfse, FixtureKindText, 3000U, 2U, mFixture13, sizeof (mFixture13) },
+  { "lzfse-runs-v2", FixtureFormatLzfse, FixtureKindRuns, 4000U, 3U, mFixture14, sizeof (mFixture14) },
+  { "lzfse-random-v2", FixtureFormatLzfse, FixtureKindRandom, 300U, 4U, mFixture15, sizeof (mFixture15) },
+  { "lzfse-mixed-v2", FixtureFormatLzfse, FixtureKindMixed, 2000U, 5U, mFixture16, sizeof (mFixture16) },
+  { "lzfse-text-raw", FixtureFormatLzfse, FixtureKindText, 3000U, 2U, mFixture17, sizeof (mFixture17) },
+  { "lzfse-mixed-raw", FixtureFormatLzfse, FixtureKindMixed, 2000U, 5U, mFixture18, sizeof (mFixture18) },
+  { "lzfse-one-lzvn", FixtureFormatLzfse, FixtureKindRandom, 1U, 1U, mFixture19, sizeof (mFixture19) },
+  { "lzfse-random-lzvn", FixtureFormatLzfse, FixtureKindRandom, 300U, 4U, mFixture20, sizeof (mFixture20) },
+  { "lzfse-text-v1", FixtureFormatLzfse, FixtureKindText, 3000U, 2U, mFixture21, sizeof (mFixture21) },
+  { "lzfse-mixed-v1", FixtureFormatLzfse, FixtureKindMixed, 2000U, 5U, mFixture22, sizeof (mFixture22) },
+};
+
+#endif // TEST_COMPRESSION_FIXTURES_H
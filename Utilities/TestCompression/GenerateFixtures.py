@@ -0,0 +1,616 @@
+#!/usr/bin/env python3
+
+"""
+Generate ADC, bzip2 and LZFSE fixtures for TestCompression, and disk images
+with ADC, zlib, bzip2 and LZFSE chunks for TestDiskImage.
+
+Uncompressed data is produced by the same generator as in TestCompression.c,
+so only compressed streams are stored in Fixtures.h. ADC and LZFSE streams
+are produced by the simple encoders below, bzip2 and zlib streams by Python.
+
+With --reference, streams and disk images are additionally produced by
+Apple's reference lzfse tool and hdiutil, which must be in PATH (macOS).
+This catches misreadings of a format shared by the encoders below and the
+decoders in OcCompressionLib. Apple's tools never emit LZFSE v1 blocks, so
+these are only produced by the encoder below.
+
+Copyright (c) 2026, Acidanthera
+SPDX-License-Identifier: BSD-3-Clause
+"""
+
+import argparse
+import base64
+import bz2
+import hashlib
+import os
+import random
+import shutil
+import struct
+import subprocess
+import tempfile
+import zlib
+
+SELF_DIR = os.path.dirname(os.path.realpath(__file__))
+
+WORDS = [
+    b'apple', b'boot', b'chunk', b'disk', b'efi', b'kernel', b'image', b'block',
+    b'sector', b'volume', b'recovery', b'opencore', b'picker', b'driver', b'table', b'data'
+]
+
+KIND_TEXT = 0
+KIND_RUNS = 1
+KIND_RANDOM = 2
+KIND_MIXED = 3
+KIND_NAMES = ['FixtureKindText', 'FixtureKindRuns', 'FixtureKindRandom', 'FixtureKindMixed']
+
+
+class Random:
+    """Same LCG as FixtureRandom in TestCompression.c."""
+
+    def __init__(self, seed):
+        self.state = seed
+
+    def next(self):
+        self.state = (self.state * 1103515245 + 12345) & 0x7FFFFFFF
+        return self.state >> 16
+
+
+def fill(kind, size, seed):
+    """Same as FillFixture in TestCompression.c."""
+    rnd = Random(seed)
+    out = bytearray()
+    while len(out) < size:
+        if kind == KIND_TEXT:
+            out += WORDS[rnd.next() % len(WORDS)] + b' '
+        elif kind == KIND_RUNS:
+            out += bytes([rnd.next() % 4]) * (rnd.next() % 300 + 1)
+        elif kind == KIND_RANDOM:
+            out.append(rnd.next() & 0xFF)
+        elif rnd.next() % 4 == 0:
+            out += bytes(rnd.next() & 0xFF for _ in range(rnd.next() % 32 + 1))
+        else:
+            out += WORDS[rnd.next() % len(WORDS)] + b' '
+    return bytes(out[:size])
+
+
+def lz_parse(data, max_len, max_dist, min_len, start=0, end=None):
+    """Greedy parse of data[start:end] into (literals, match length, distance)."""
+    if end is None:
+        end = len(data)
+    table = {}
+    for i in range(max(0, start - max_dist), start):
+        table.setdefault(data[i:i + 4], []).append(i)
+    out = []
+    lit = start
+    i = start
+    while i < end:
+        best = 0
+        best_dist = 0
+        if i + min_len <= end:
+            for j in reversed(table.get(data[i:i + 4], [])[-16:]):
+                if i - j > max_dist:
+                    break
+                length = 0
+                while i + length < end and length < max_len and data[j + length] == data[i + length]:
+                    length += 1
+                if length > best:
+                    best, best_dist = length, i - j
+        if best >= min_len:
+            out.append((i - lit, best, best_dist))
+            for k in range(i, i + best):
+                table.setdefault(data[k:k + 4], []).append(k)
+            i += best
+            lit = i
+        else:
+            table.setdefault(data[i:i + 4], []).append(i)
+            i += 1
+    return out
+
+
+def adc_encode(data):
+    out = bytearray()
+    pos = 0
+
+    def literals(chunk):
+        for k in range(0, len(chunk), 128):
+            part = chunk[k:k + 128]
+            out.append(0x80 | (len(part) - 1))
+            out.extend(part)
+
+    for lit, length, dist in lz_parse(data, 67, 65536, 3):
+        literals(data[pos:pos + lit])
+        pos += lit
+        if length <= 18 and dist <= 1024:
+            out += bytes([((length - 3) << 2) | ((dist - 1) >> 8), (dist - 1) & 0xFF])
+            pos += length
+            continue
+        while length > 0:
+            part = min(length, 67)
+            if part < 4:
+                literals(data[pos:pos + part])
+            else:
+                out.append(0x40 | (part - 4))
+                out += struct.pack('>H', dist - 1)
+            pos += part
+            length -= part
+    literals(data[pos:])
+    return bytes(out)
+
+
+L_EXTRA_BITS = [0] * 16 + [2, 3, 5, 8]
+L_BASE_VALUE = list(range(16)) + [16, 20, 28, 60]
+M_EXTRA_BITS = [0] * 16 + [3, 5, 8, 11]
+M_BASE_VALUE = list(range(16)) + [16, 24, 56, 312]
+D_EXTRA_BITS = [0, 0, 0, 0] + [e for e in range(1, 16) for _ in range(4)]
+D_BASE_VALUE = [sum(1 << e for e in D_EXTRA_BITS[:i]) for i in range(len(D_EXTRA_BITS))]
+
+
+def value_symbol(value, extra_bits, base_value):
+    for symbol in range(len(base_value) - 1, -1, -1):
+        if base_value[symbol] <= value < base_value[symbol] + (1 << extra_bits[symbol]):
+            return symbol
+    raise ValueError(value)
+
+
+def normalize(counts, states):
+    total = sum(counts)
+    if total == 0:
+        return [0] * len(counts)
+    freq = [max(1, c * states // total) if c else 0 for c in counts]
+    while sum(freq) > states:
+        freq[max(range(len(freq)), key=lambda k: freq[k])] -= 1
+    #
+    # The decoder must accept tables not using all states.
+    #
+    if random.random() < 0.8:
+        freq[max(range(len(freq)), key=lambda k: freq[k])] += states - sum(freq)
+    return freq
+
+
+def decoder_table(freq, states):
+    table = []
+    for symbol, count in enumerate(freq):
+        if count == 0:
+            continue
+        k = states.bit_length() - count.bit_length()
+        j0 = ((2 * states) >> k) - count
+        for j in range(count):
+            if j < j0:
+                table.append((symbol, k, ((count + j) << k) - states))
+            else:
+                table.append((symbol, k - 1, (j - j0) << (k - 1)))
+    return table
+
+
+def fse_encode(symbols, freq, states):
+    """Return initial decoder state and (bits, count) in decoding order."""
+    by_symbol = {}
+    for state, (symbol, k, delta) in enumerate(decoder_table(freq, states)):
+        by_symbol.setdefault(symbol, []).append((state, k, delta))
+    state = 0
+    emitted = []
+    for symbol in reversed(symbols):
+        for next_state, k, delta in by_symbol[symbol]:
+            if delta <= state < delta + (1 << k):
+                emitted.append((state - delta, k))
+                state = next_state
+                break
+        else:
+            raise ValueError('no state')
+    emitted.reverse()
+    return state, emitted
+
+
+def pack_bits(items):
+    value = 0
+    total = 0
+    for bits, count in items:
+        value = (value << count) | bits
+        total += count
+    size = (total + 7) // 8
+    extra = total - 8 * size
+    if size < 8:
+        value <<= 8 * (8 - size)
+        size = 8
+    return value.to_bytes(size, 'little'), extra
+
+
+def freq_code(value):
+    if value <= 3:
+        return [(0, 2), (2, 2), (1, 3), (5, 3)][value]
+    if value <= 7:
+        return [3, 11, 19, 27][value - 4], 5
+    if value <= 23:
+        return 7 | ((value - 8) << 4), 8
+    return 15 | ((value - 24) << 4), 14
+
+
+def lzfse_block(data, start, end, version):
+    lmd = []
+    literals = bytearray()
+    pos = start
+    prev_dist = None
+
+    def push(lit, length, dist):
+        nonlocal prev_dist
+        while lit > 315:
+            lmd.append((315, 0, 0 if prev_dist is not None else 1))
+            prev_dist = prev_dist or 1
+            lit -= 315
+        lmd.append((lit, length, 0 if dist == prev_dist and random.random() < 0.9 else dist))
+        prev_dist = dist
+
+    for lit, length, dist in lz_parse(data, 2359, 262143, 4, start, end):
+        literals += data[pos:pos + lit]
+        push(lit, length, dist)
+        pos += lit + length
+    literals += data[pos:end]
+    if end > pos or not lmd:
+        push(end - pos, 0, prev_dist or 1)
+    while len(literals) % 4:
+        literals.append(0)
+
+    def counts(values, size):
+        result = [0] * size
+        for value in values:
+            result[value] += 1
+        return result
+
+    l_symbols = [value_symbol(l, L_EXTRA_BITS, L_BASE_VALUE) for l, _, _ in lmd]
+    m_symbols = [value_symbol(m, M_EXTRA_BITS, M_BASE_VALUE) for _, m, _ in lmd]
+    d_symbols = [value_symbol(d, D_EXTRA_BITS, D_BASE_VALUE) for _, _, d in lmd]
+    l_freq = normalize(counts(l_symbols, 20), 64)
+    m_freq = normalize(counts(m_symbols, 20), 64)
+    d_freq = normalize(counts(d_symbols, 64), 256)
+    lit_freq = normalize(counts(literals, 256), 1024)
+
+    lit_items = [None] * len(literals)
+    lit_states = []
+    for lane in range(4):
+        state, emitted = fse_encode(list(literals[lane::4]), lit_freq, 1024)
+        lit_states.append(state)
+        for index, item in enumerate(emitted):
+            lit_items[lane + 4 * index] = item
+    lit_payload, lit_extra = pack_bits(lit_items)
+
+    l_state, l_items = fse_encode(l_symbols, l_freq, 64)
+    m_state, m_items = fse_encode(m_symbols, m_freq, 64)
+    d_state, d_items = fse_encode(d_symbols, d_freq, 256)
+    items = []
+    for index, (lit, length, dist) in enumerate(lmd):
+        for (bits, count), value, symbol, extra_bits, base_value in (
+                (l_items[index], lit, l_symbols[index], L_EXTRA_BITS, L_BASE_VALUE),
+                (m_items[index], length, m_symbols[index], M_EXTRA_BITS, M_BASE_VALUE),
+                (d_items[index], dist, d_symbols[index], D_EXTRA_BITS, D_BASE_VALUE)):
+            items.append(((bits << extra_bits[symbol]) | (value - base_value[symbol]), count + extra_bits[symbol]))
+    lmd_payload, lmd_extra = pack_bits(items)
+
+    freqs = l_freq + m_freq + d_freq + lit_freq
+    freq_bits = 0
+    freq_count = 0
+    for value in freqs:
+        bits, count = freq_code(value)
+        freq_bits |= bits << freq_count
+        freq_count += count
+    freq_bytes = freq_bits.to_bytes((freq_count + 7) // 8, 'little')
+    if version == 1:
+        #
+        # lzfse_compressed_block_header_v1 with natural alignment of the reference implementation.
+        #
+        header = struct.pack('<7Ii4HiHHH', 0x31787662, end - start, len(lit_payload) + len(lmd_payload),
+                             len(literals), len(lmd), len(lit_payload), len(lmd_payload),
+                             lit_extra, *lit_states, lmd_extra, l_state, m_state, d_state)
+        header += struct.pack(f'<{len(freqs)}H', *freqs) + b'\x00' * 2
+        assert len(header) == 772
+        return header + lit_payload + lmd_payload
+
+    packed0 = len(literals) | (len(lit_payload) << 20) | (len(lmd) << 40) | ((lit_extra + 7) << 60)
+    packed1 = (lit_states[0] | (lit_states[1] << 10) | (lit_states[2] << 20) | (lit_states[3] << 30)
+               | (len(lmd_payload) << 40) | ((lmd_extra + 7) << 60))
+    packed2 = (32 + len(freq_bytes)) | (l_state << 32) | (m_state << 42) | (d_state << 52)
+    return (struct.pack('<IIQQQ', 0x32787662, end - start, packed0, packed1, packed2)
+            + freq_bytes + lit_payload + lmd_payload)
+
+
+def lzvn_literals(data):
+    out = bytearray()
+    for k in range(0, len(data), 271):
+        part = data[k:k + 271]
+        out += bytes([0xE0, len(part) - 16]) if len(part) >= 16 else bytes([0xE0 | len(part)])
+        out += part
+    return bytes(out + b'\x06' + b'\x00' * 7)
+
+
+def lzfse_encode(data, mode, block_sizes=(500, 900, 1500)):
+    out = bytearray()
+    if mode == 'lzvn':
+        payload = lzvn_literals(data)
+        out += struct.pack('<III', 0x6e787662, len(data), len(payload)) + payload
+    else:
+        pos = 0
+        while pos < len(data):
+            size = min(len(data) - pos, random.choice(block_sizes))
+            if mode == 'raw' and random.random() < 0.4:
+                out += struct.pack('<II', 0x2d787662, size) + data[pos:pos + size]
+            else:
+                out += lzfse_block(data, pos, pos + size, 1 if mode == 'v1' else 2)
+            pos += size
+    return bytes(out + struct.pack('<I', 0x24787662))
+
+
+DATASETS = {
+    'one': (KIND_RANDOM, 1, 1),
+    'text': (KIND_TEXT, 3000, 2),
+    'runs': (KIND_RUNS, 4000, 3),
+    'random': (KIND_RANDOM, 300, 4),
+    'mixed': (KIND_MIXED, 2000, 5),
+}
+
+FIXTURES = [
+    ('ADC', name, None) for name in DATASETS
+] + [
+    ('BZIP2', name, 'level9') for name in DATASETS
+] + [
+    ('BZIP2', 'text', 'level1'),
+    ('BZIP2', 'mixed', 'concatenated'),
+] + [
+    ('LZFSE', name, 'v2') for name in DATASETS
+] + [
+    ('LZFSE', 'text', 'raw'),
+    ('LZFSE', 'mixed', 'raw'),
+    ('LZFSE', 'one', 'lzvn'),
+    ('LZFSE', 'random', 'lzvn'),
+    ('LZFSE', 'text', 'v1'),
+    ('LZFSE', 'mixed', 'v1'),
+]
+
+REFERENCE_FIXTURES = [
+    ('LZFSE', name, 'reference') for name in DATASETS
+]
+
+
+def lzfse_reference(data):
+    with tempfile.TemporaryDirectory() as tmp:
+        src = os.path.join(tmp, 'in.bin')
+        dst = os.path.join(tmp, 'out.lzfse')
+        with open(src, 'wb') as file:
+            file.write(data)
+        subprocess.run(['lzfse', '-encode', '-i', src, '-o', dst], check=True)
+        with open(dst, 'rb') as file:
+            return file.read()
+
+
+def encode(fmt, data, variant):
+    if variant == 'reference':
+        return lzfse_reference(data)
+    if fmt == 'ADC':
+        return adc_encode(data)
+    if fmt == 'LZFSE':
+        return lzfse_encode(data, variant)
+    if variant == 'level1':
+        return bz2.compress(data, 1)
+    if variant == 'concatenated':
+        half = len(data) // 2
+        return bz2.compress(data[:half], 9) + bz2.compress(data[half:], 9)
+    return bz2.compress(data, 9)
+
+
+SECTOR_SIZE = 512
+
+CHUNK_ZERO = 0x00000000
+CHUNK_RAW = 0x00000001
+CHUNK_IGNORE = 0x00000002
+CHUNK_ADC = 0x80000004
+CHUNK_ZLIB = 0x80000005
+CHUNK_BZIP2 = 0x80000006
+CHUNK_LZFSE = 0x80000007
+CHUNK_COMMENT = 0x7FFFFFFE
+CHUNK_LAST = 0xFFFFFFFF
+
+
+def udif_checksum(crc):
+    return struct.pack('>II', 2, 32) + struct.pack('>I', crc) + b'\x00' * 124
+
+
+def compress_chunk(chunk_type, data, variant):
+    if chunk_type == CHUNK_RAW:
+        return data
+    if chunk_type == CHUNK_ADC:
+        return adc_encode(data)
+    if chunk_type == CHUNK_ZLIB:
+        return zlib.compress(data, 9)
+    if chunk_type == CHUNK_BZIP2:
+        return bz2.compress(data, 9)
+    #
+    # Disk image chunks are much smaller than the maximum LZFSE block size.
+    #
+    return lzfse_encode(data, variant, (len(data),))
+
+
+def udif_image(disk, blocks):
+    """
+    Build UDIF image of disk contents. Every block is a list of
+    (chunk type, sector count, LZFSE variant) tuples.
+    """
+    fork = bytearray()
+    entries = []
+    checksums = []
+    sector = 0
+    for index, chunks in enumerate(blocks):
+        block_start = sector
+        records = []
+        for chunk_type, count, variant in chunks:
+            data = disk[sector * SECTOR_SIZE:(sector + count) * SECTOR_SIZE]
+            offset = len(fork)
+            if chunk_type in (CHUNK_ZERO, CHUNK_IGNORE):
+                assert data == bytes(len(data))
+            elif chunk_type != CHUNK_COMMENT:
+                fork += compress_chunk(chunk_type, data, variant)
+            records.append(struct.pack('>IIQQQQ', chunk_type, 0, sector - block_start, count, offset,
+                                       len(fork) - offset))
+            sector += count
+        records.append(struct.pack('>IIQQQQ', CHUNK_LAST, 0, sector - block_start, 0, len(fork), 0))
+        crc = zlib.crc32(disk[block_start * SECTOR_SIZE:sector * SECTOR_SIZE])
+        checksums.append(crc)
+        mish = struct.pack('>IIQQQII', 0x6D697368, 1, block_start, sector - block_start, 0, 0x208, 0)
+        mish += b'\x00' * 24 + udif_checksum(crc) + struct.pack('>I', len(records)) + b''.join(records)
+        entries.append((index, mish))
+    assert sector * SECTOR_SIZE == len(disk)
+
+    plist = [
+        '<?xml version="1.0" encoding="UTF-8"?>',
+        '<!DOCTYPE plist PUBLIC "-//Apple//DTD PLIST 1.0//EN" "http://www.apple.com/DTDs/PropertyList-1.0.dtd">',
+        '<plist version="1.0">',
+        '<dict>',
+        '\t<key>resource-fork</key>',
+        '\t<dict>',
+        '\t\t<key>blkx</key>',
+        '\t\t<array>',
+    ]
+    for index, mish in entries:
+        plist += [
+            '\t\t\t<dict>',
+            '\t\t\t\t<key>Attributes</key>',
+            '\t\t\t\t<string>0x0050</string>',
+            '\t\t\t\t<key>CFName</key>',
+            f'\t\t\t\t<string>Fixture {index}</string>',
+            '\t\t\t\t<key>Data</key>',
+            '\t\t\t\t<data>',
+        ]
+        encoded = base64.b64encode(mish).decode('ascii')
+        plist += [f'\t\t\t\t{encoded[k:k + 52]}' for k in range(0, len(encoded), 52)]
+        plist += [
+            '\t\t\t\t</data>',
+            '\t\t\t\t<key>ID</key>',
+            f'\t\t\t\t<string>{index}</string>',
+            '\t\t\t\t<key>Name</key>',
+            f'\t\t\t\t<string>Fixture {index}</string>',
+            '\t\t\t</dict>',
+        ]
+    plist += ['\t\t</array>', '\t</dict>', '</dict>', '</plist>', '']
+    xml = '\n'.join(plist).encode('ascii')
+
+    trailer = struct.pack('>IIIIQQQQQII', 0x6B6F6C79, 4, 512, 1, 0, 0, len(fork), 0, 0, 1, 1)
+    trailer += hashlib.md5(disk).digest()
+    trailer += udif_checksum(zlib.crc32(fork))
+    trailer += struct.pack('>QQ', len(fork), len(xml)) + b'\x00' * 120
+    trailer += udif_checksum(zlib.crc32(b''.join(struct.pack('>I', crc) for crc in checksums)))
+    trailer += struct.pack('>IQ', 1, len(disk) // SECTOR_SIZE) + b'\x00' * 12
+    assert len(trailer) == 512
+    return bytes(fork) + xml + trailer
+
+
+def hdiutil_image(disk, image_format):
+    with tempfile.TemporaryDirectory() as tmp:
+        src = os.path.join(tmp, 'disk.img')
+        dst = os.path.join(tmp, 'disk.dmg')
+        with open(src, 'wb') as file:
+            file.write(disk)
+        subprocess.run(['hdiutil', 'convert', src, '-quiet', '-format', image_format, '-o', dst], check=True)
+        with open(dst, 'rb') as file:
+            return file.read()
+
+
+def disk_contents(sectors, seed, zero_ranges=()):
+    disk = bytearray(fill(KIND_TEXT, sectors * SECTOR_SIZE, seed))
+    for start, count in zero_ranges:
+        disk[start * SECTOR_SIZE:(start + count) * SECTOR_SIZE] = bytes(count * SECTOR_SIZE)
+    return bytes(disk)
+
+
+def disk_image_fixtures(reference):
+    fixtures = []
+    disk = disk_contents(16, 11)
+    for name, chunk_type, variant in (
+            ('udco-adc', CHUNK_ADC, None),
+            ('udbz-bzip2', CHUNK_BZIP2, None),
+            ('ulfo-lzfse', CHUNK_LZFSE, 'v2'),
+            ('ulfo-lzfse-v1', CHUNK_LZFSE, 'v1')):
+        fixtures.append((name, disk, udif_image(disk, [[(chunk_type, 8, variant), (chunk_type, 8, variant)]])))
+
+    #
+    # Every chunk type in two blocks, with chunks straddled by reads.
+    #
+    disk = disk_contents(24, 12, [(3, 2), (20, 1)])
+    fixtures.append(('mixed', disk, udif_image(disk, [
+        [(CHUNK_COMMENT, 0, None), (CHUNK_RAW, 3, None), (CHUNK_ZERO, 1, None), (CHUNK_IGNORE, 1, None),
+         (CHUNK_ADC, 3, None), (CHUNK_BZIP2, 2, None)],
+        [(CHUNK_LZFSE, 5, 'v1'), (CHUNK_LZFSE, 3, 'lzvn'), (CHUNK_ZLIB, 2, None), (CHUNK_ZERO, 1, None),
+         (CHUNK_LZFSE, 3, 'raw')],
+    ])))
+
+    if reference:
+        disk = disk_contents(16, 11)
+        for image_format in ('UDCO', 'UDZO', 'UDBZ', 'ULFO'):
+            fixtures.append((f'hdiutil-{image_format.lower()}', disk, hdiutil_image(disk, image_format)))
+
+    return fixtures
+
+
+def write_header(path, guard, title, arrays, table_type, table):
+    lines = [
+        '/** @file',
+        f'  {title}',
+        '  Generated by TestCompression/GenerateFixtures.py, do not edit.',
+        '',
+        '  Copyright (C) 2026, Acidanthera. All rights reserved.<BR>',
+        '  SPDX-License-Identifier: BSD-3-Clause',
+        '**/',
+        '',
+        f'#ifndef {guard}',
+        f'#define {guard}',
+        '',
+    ]
+    for index, (label, stream) in enumerate(arrays):
+        lines.append(f'// {label}')
+        lines.append(f'STATIC CONST UINT8  mFixture{index}[] = {{')
+        for k in range(0, len(stream), 16):
+            lines.append('  ' + ', '.join(f'0x{b:02X}' for b in stream[k:k + 16]) + ',')
+        lines.append('};')
+        lines.append('')
+    lines.append(f'STATIC CONST {table_type}  mFixtures[] = {{')
+    lines += table
+    lines += ['};', '', f'#endif // {guard}', '']
+    with open(path, 'w', encoding='ascii') as file:
+        file.write('\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate TestCompression and TestDiskImage fixtures.')
+    parser.add_argument('--reference', action='store_true',
+                        help='also produce fixtures with Apple lzfse and hdiutil tools')
+    args = parser.parse_args()
+
+    if args.reference:
+        for tool in ('lzfse', 'hdiutil'):
+            if shutil.which(tool) is None:
+                parser.error(f'{tool} is not found in PATH')
+
+    random.seed(7)
+    arrays = []
+    table = []
+    for index, (fmt, name, variant) in enumerate(FIXTURES + (REFERENCE_FIXTURES if args.reference else [])):
+        kind, size, seed = DATASETS[name]
+        stream = encode(fmt, fill(kind, size, seed), variant)
+        label = f'{fmt.lower()}-{name}' + (f'-{variant}' if variant else '')
+        arrays.append((label, stream))
+        table.append(f'  {{ "{label}", FixtureFormat{fmt.capitalize()}, {KIND_NAMES[kind]}, {size}U, {seed}U, '
+                     f'mFixture{index}, sizeof (mFixture{index}) }},')
+    write_header(os.path.join(SELF_DIR, 'Fixtures.h'), 'TEST_COMPRESSION_FIXTURES_H',
+                 'Compressed fixtures for TestCompression.', arrays, 'COMPRESSION_FIXTURE', table)
+
+    arrays = []
+    table = []
+    for index, (name, disk, image) in enumerate(disk_image_fixtures(args.reference)):
+        digest = hashlib.sha256(disk).digest()
+        arrays.append((name, image))
+        table.append(f'  {{ "{name}", mFixture{index}, sizeof (mFixture{index}), {len(disk) // SECTOR_SIZE}U, {{')
+        for k in range(0, len(digest), 16):
+            table.append('      ' + ', '.join(f'0x{b:02X}' for b in digest[k:k + 16]) + ',')
+        table.append('    } },')
+    write_header(os.path.join(SELF_DIR, '..', 'TestDiskImage', 'Fixtures.h'), 'TEST_DISK_IMAGE_FIXTURES_H',
+                 'Disk image fixtures for TestDiskImage.', arrays, 'DISK_IMAGE_FIXTURE', table)
+
+
+if __name__ == '__main__':
+    main()
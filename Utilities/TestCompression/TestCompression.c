@@ -0,0 +1,297 @@
+/** @file
+  Verify ADC, bzip2 and LZFSE decompression against generated fixtures.
+
+  Copyright (C) 2026, Acidanthera. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#include <Base.h>
+
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/OcCompressionLib.h>
+
+#include <stdlib.h>
+
+#define BIT_FLIP_ITERATIONS  200U
+
+typedef enum {
+  FixtureFormatAdc,
+  FixtureFormatBzip2,
+  FixtureFormatLzfse
+} FIXTURE_FORMAT;
+
+typedef enum {
+  FixtureKindText,
+  FixtureKindRuns,
+  FixtureKindRandom,
+  FixtureKindMixed
+} FIXTURE_KIND;
+
+typedef struct {
+  CONST CHAR8     *Name;
+  FIXTURE_FORMAT  Format;
+  FIXTURE_KIND    Kind;
+  UINT32          Size;
+  UINT32          Seed;
+  CONST UINT8     *Data;
+  UINT32          DataSize;
+} COMPRESSION_FIXTURE;
+
+typedef
+UINTN
+(*DECOMPRESS_FUNC) (
+  OUT UINT8        *Dst,
+  IN  UINTN        DstLen,
+  IN  CONST UINT8  *Src,
+  IN  UINTN        SrcLen
+  );
+
+//
+// Fixtures are generated by GenerateFixtures.py, which must be kept in sync
+// with FixtureRandom and FillFixture.
+//
+#include "Fixtures.h"
+
+STATIC CONST CHAR8  *mFixtureWords[] = {
+  "apple",  "boot",   "chunk",    "disk",     "efi",    "kernel", "image", "block",
+  "sector", "volume", "recovery", "opencore", "picker", "driver", "table", "data"
+};
+
+STATIC CONST DECOMPRESS_FUNC  mDecompress[] = {
+  [FixtureFormatAdc]   = DecompressADC,
+  [FixtureFormatBzip2] = DecompressBZIP2,
+  [FixtureFormatLzfse] = DecompressLZFSE
+};
+
+STATIC
+UINT32
+FixtureRandom (
+  IN OUT UINT32  *State
+  )
+{
+  *State = (*State * 1103515245U + 12345U) & 0x7FFFFFFFU;
+  return *State >> 16U;
+}
+
+STATIC
+VOID
+FillFixture (
+  OUT UINT8         *Buffer,
+  IN  FIXTURE_KIND  Kind,
+  IN  UINT32        Size,
+  IN  UINT32        Seed
+  )
+{
+  UINT32       State;
+  UINT32       Offset;
+  UINT32       Length;
+  UINT32       Index;
+  UINT8        Value;
+  CONST CHAR8  *Word;
+
+  State  = Seed;
+  Offset = 0;
+
+  while (Offset < Size) {
+    if (Kind == FixtureKindRuns) {
+      Value  = (UINT8)(FixtureRandom (&State) % 4);
+      Length = FixtureRandom (&State) % 300 + 1;
+      for (Index = 0; Index < Length && Offset < Size; ++Index) {
+        Buffer[Offset++] = Value;
+      }
+    } else if (Kind == FixtureKindRandom) {
+      Buffer[Offset++] = (UINT8)FixtureRandom (&State);
+    } else if ((Kind == FixtureKindMixed) && (FixtureRandom (&State) % 4 == 0)) {
+      //
+      // Evaluation order of the length and the bytes matches the generator.
+      //
+      Length = FixtureRandom (&State) % 32 + 1;
+      for (Index = 0; Index < Length; ++Index) {
+        Value = (UINT8)FixtureRandom (&State);
+        if (Offset < Size) {
+          Buffer[Offset++] = Value;
+        }
+      }
+    } else {
+      Word = mFixtureWords[FixtureRandom (&State) % ARRAY_SIZE (mFixtureWords)];
+      while (*Word != '\0' && Offset < Size) {
+        Buffer[Offset++] = *Word++;
+      }
+
+      if (Offset < Size) {
+        Buffer[Offset++] = ' ';
+      }
+    }
+  }
+}
+
+/**
+  Decompress into an exactly sized allocation, so that sanitizers catch
+  out of bounds writes.
+**/
+STATIC
+UINTN
+DecompressFixture (
+  IN  FIXTURE_FORMAT  Format,
+  IN  CONST UINT8     *Src,
+  IN  UINTN           SrcLen,
+  IN  UINTN           DstLen,
+  IN  CONST UINT8     *Expected  OPTIONAL,
+  OUT BOOLEAN         *Matches   OPTIONAL
+  )
+{
+  UINT8  *Dst;
+  UINT8  *Input;
+  UINTN  Result;
+
+  Dst   = AllocatePool (MAX (DstLen, 1));
+  Input = AllocateCopyPool (MAX (SrcLen, 1), Src);
+  if ((Dst == NULL) || (Input == NULL)) {
+    DEBUG ((DEBUG_ERROR, "Fixture allocation failure\n"));
+    abort ();
+  }
+
+  Result = mDecompress[Format](Dst, DstLen, Input, SrcLen);
+
+  if (Matches != NULL) {
+    *Matches = Result == DstLen && CompareMem (Dst, Expected, DstLen) == 0;
+  }
+
+  FreePool (Dst);
+  FreePool (Input);
+
+  return Result;
+}
+
+STATIC
+BOOLEAN
+VerifyFixture (
+  IN CONST COMPRESSION_FIXTURE  *Fixture
+  )
+{
+  UINT8    *Expected;
+  UINT8    *Corrupted;
+  UINTN    Result;
+  UINT32   Length;
+  UINT32   Iteration;
+  UINT32   Truncated;
+  BOOLEAN  Matches;
+  BOOLEAN  Success;
+
+  Expected  = AllocatePool (Fixture->Size);
+  Corrupted = AllocatePool (Fixture->DataSize);
+  if ((Expected == NULL) || (Corrupted == NULL)) {
+    DEBUG ((DEBUG_ERROR, "Fixture allocation failure\n"));
+    abort ();
+  }
+
+  FillFixture (Expected, Fixture->Kind, Fixture->Size, Fixture->Seed);
+  Success = TRUE;
+
+  Result = DecompressFixture (Fixture->Format, Fixture->Data, Fixture->DataSize, Fixture->Size, Expected, &Matches);
+  if (!Matches) {
+    DEBUG ((DEBUG_ERROR, "%a: decompressed %u of %u bytes, MISMATCH\n", Fixture->Name, (UINT32)Result, Fixture->Size));
+    Success = FALSE;
+  }
+
+  //
+  // Output not fitting in the destination must be rejected.
+  //
+  Result = DecompressFixture (Fixture->Format, Fixture->Data, Fixture->DataSize, Fixture->Size - 1, NULL, NULL);
+  if (Result != 0) {
+    DEBUG ((DEBUG_ERROR, "%a: short destination accepted with %u bytes\n", Fixture->Name, (UINT32)Result));
+    Success = FALSE;
+  }
+
+  //
+  // Truncated input must never produce the whole output.
+  //
+  Truncated = 0;
+  for (Length = 0; Length < Fixture->DataSize; ++Length) {
+    DecompressFixture (Fixture->Format, Fixture->Data, Length, Fixture->Size, Expected, &Matches);
+    if (Matches) {
+      ++Truncated;
+    }
+  }
+
+  if (Truncated > 0) {
+    DEBUG ((DEBUG_ERROR, "%a: %u truncated inputs accepted\n", Fixture->Name, Truncated));
+    Success = FALSE;
+  }
+
+  //
+  // Corrupted input may decompress to anything, but must stay in bounds.
+  //
+  for (Iteration = 0; Iteration < BIT_FLIP_ITERATIONS; ++Iteration) {
+    CopyMem (Corrupted, Fixture->Data, Fixture->DataSize);
+    Corrupted[rand () % Fixture->DataSize] ^= (UINT8)(1U << (rand () % 8));
+    Result = DecompressFixture (Fixture->Format, Corrupted, Fixture->DataSize, Fixture->Size, NULL, NULL);
+    if (Result > Fixture->Size) {
+      DEBUG ((DEBUG_ERROR, "%a: corrupted input decompressed to %u bytes\n", Fixture->Name, (UINT32)Result));
+      Success = FALSE;
+      break;
+    }
+  }
+
+  DEBUG ((
+    DEBUG_ERROR,
+    "%a: %u -> %u bytes, %a\n",
+    Fixture->Name,
+    Fixture->DataSize,
+    Fixture->Size,
+    Success ? "OK" : "FAIL"
+    ));
+
+  FreePool (Expected);
+  FreePool (Corrupted);
+
+  return Success;
+}
+
+int
+ENTRY_POINT (
+  int   argc,
+  char  *argv[]
+  )
+{
+  UINT32   Index;
+  BOOLEAN  Success;
+
+  srand (1);
+
+  Success = TRUE;
+  for (Index = 0; Index < ARRAY_SIZE (mFixtures); ++Index) {
+    if (!VerifyFixture (&mFixtures[Index])) {
+      Success = FALSE;
+    }
+  }
+
+  return Success ? 0 : -1;
+}
+
+int
+LLVMFuzzerTestOneInput (
+  const uint8_t  *Data,
+  size_t         Size
+  )
+{
+  #define  MAX_OUTPUT  65536
+
+  UINT8  *Test;
+  UINTN  Index;
+
+  Test = AllocatePool (MAX_OUTPUT);
+  if (Test == NULL) {
+    return 0;
+  }
+
+  for (Index = 0; Index < ARRAY_SIZE (mDecompress); ++Index) {
+    mDecompress[Index](Test, MAX_OUTPUT, Data, Size);
+  }
+
+  FreePool (Test);
+
+  return 0;
+}
@@ -7,15 +7,269 @@
 #include <Library/OcAppleDiskImageLib.h>
 #include <Library/OcAppleRamDiskLib.h>
 #include <Library/OcAppleKeysLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/OcCompressionLib.h>
+#include <Library/OcCryptoLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/DebugLib.h>
 
 #include <UserFile.h>
 #include <UserMemory.h>
+#include <sys/time.h>
 
 #define  NUM_EXTENTS  20
 
+//
+// Read size used by file system drivers on top of disk image block I/O.
+//
+#define  SMALL_READ_SIZE  SIZE_4KB
+
+typedef struct {
+  CONST CHAR8    *Name;
+  CONST UINT8    *Data;
+  UINT32         DataSize;
+  UINT32         SectorCount;
+  UINT8          Digest[SHA256_DIGEST_SIZE];
+} DISK_IMAGE_FIXTURE;
+
+//
+// Fixtures are generated by TestCompression/GenerateFixtures.py.
+//
+#include "Fixtures.h"
+
+STATIC
+UINT64
+UserGetTimestampUs (
+  VOID
+  )
+{
+  struct timeval  Time;
+
+  gettimeofday (&Time, NULL);
+  return Time.tv_sec * 1000000ULL + Time.tv_usec;
+}
+
+STATIC
+VOID
+UserBuildExtentTable (
+  OUT APPLE_RAM_DISK_EXTENT_TABLE  *ExtentTable,
+  IN  UINT8                        *Dmg,
+  IN  UINT32                       DmgSize
+  )
+{
+  UINT32  Index;
+
+  ExtentTable->Signature   = APPLE_RAM_DISK_EXTENT_SIGNATURE;
+  ExtentTable->Version     = APPLE_RAM_DISK_EXTENT_VERSION;
+  ExtentTable->Reserved    = 0;
+  ExtentTable->Signature2  = APPLE_RAM_DISK_EXTENT_SIGNATURE;
+  ExtentTable->ExtentCount = MIN (NUM_EXTENTS, ARRAY_SIZE (ExtentTable->Extents));
+
+  for (Index = 0; Index < ExtentTable->ExtentCount; ++Index) {
+    ExtentTable->Extents[Index].Start  = (UINTN)Dmg + (Index * (DmgSize / ExtentTable->ExtentCount));
+    ExtentTable->Extents[Index].Length = (DmgSize / ExtentTable->ExtentCount);
+  }
+
+  if (Index != 0) {
+    ExtentTable->Extents[Index - 1].Length += (DmgSize - (Index * (DmgSize / ExtentTable->ExtentCount)));
+  }
+}
+
+/**
+  Read a built-in disk image through OcAppleDiskImageRead, as a whole and
+  in reads of one and three sectors starting at every sector, and compare
+  the result against the digest of the generated disk contents.
+**/
+STATIC
+BOOLEAN
+UserVerifyFixture (
+  IN CONST DISK_IMAGE_FIXTURE  *Fixture
+  )
+{
+  BOOLEAN                      Success;
+  UINT8                        *Dmg;
+  UINT8                        *Data;
+  UINT8                        *Buffer;
+  UINT32                       DataSize;
+  UINT32                       Lba;
+  UINT32                       Count;
+  UINT32                       ReadSize;
+  UINT8                        Digest[SHA256_DIGEST_SIZE];
+  OC_APPLE_DISK_IMAGE_CONTEXT  DmgContext;
+  APPLE_RAM_DISK_EXTENT_TABLE  ExtentTable;
+
+  Success  = FALSE;
+  DataSize = Fixture->SectorCount * APPLE_DISK_IMAGE_SECTOR_SIZE;
+  Dmg      = AllocateCopyPool (Fixture->DataSize, Fixture->Data);
+  Data     = AllocatePool (DataSize);
+  Buffer   = AllocatePool (3 * APPLE_DISK_IMAGE_SECTOR_SIZE);
+  if ((Dmg == NULL) || (Data == NULL) || (Buffer == NULL)) {
+    DEBUG ((DEBUG_ERROR, "%a: allocation failure\n", Fixture->Name));
+    goto Exit;
+  }
+
+  UserBuildExtentTable (&ExtentTable, Dmg, Fixture->DataSize);
+
+  if (!OcAppleDiskImageInitializeContext (&DmgContext, &ExtentTable, Fixture->DataSize)) {
+    DEBUG ((DEBUG_ERROR, "%a: DMG context initialization error\n", Fixture->Name));
+    goto Exit;
+  }
+
+  if (DmgContext.SectorCount != Fixture->SectorCount) {
+    DEBUG ((DEBUG_ERROR, "%a: %u sectors instead of %u\n", Fixture->Name, (UINT32)DmgContext.SectorCount, Fixture->SectorCount));
+    goto ExitContext;
+  }
+
+  if (!OcAppleDiskImageRead (&DmgContext, 0, DataSize, Data)) {
+    DEBUG ((DEBUG_ERROR, "%a: DMG read error\n", Fixture->Name));
+    goto ExitContext;
+  }
+
+  Sha256 (Digest, Data, DataSize);
+  if (CompareMem (Digest, Fixture->Digest, sizeof (Digest)) != 0) {
+    DEBUG ((DEBUG_ERROR, "%a: DMG contents MISMATCH\n", Fixture->Name));
+    goto ExitContext;
+  }
+
+  for (Lba = 0; Lba < Fixture->SectorCount; ++Lba) {
+    for (Count = 1; Count <= 3; Count += 2) {
+      ReadSize = MIN (Count, Fixture->SectorCount - Lba) * APPLE_DISK_IMAGE_SECTOR_SIZE;
+      if (  !OcAppleDiskImageRead (&DmgContext, Lba, ReadSize, Buffer)
+         || (CompareMem (Buffer, Data + Lba * APPLE_DISK_IMAGE_SECTOR_SIZE, ReadSize) != 0))
+      {
+        DEBUG ((DEBUG_ERROR, "%a: DMG read of %u bytes at sector %u MISMATCH\n", Fixture->Name, ReadSize, Lba));
+        goto ExitContext;
+      }
+    }
+  }
+
+  Success = TRUE;
+
+ExitContext:
+  OcAppleDiskImageFreeContext (&DmgContext);
+
+Exit:
+  DEBUG ((DEBUG_ERROR, "%a: %a\n", Fixture->Name, Success ? "OK" : "FAIL"));
+
+  if (Dmg != NULL) {
+    FreePool (Dmg);
+  }
+
+  if (Data != NULL) {
+    FreePool (Data);
+  }
+
+  if (Buffer != NULL) {
+    FreePool (Buffer);
+  }
+
+  return Success;
+}
+
+/**
+  Read the whole disk image again in small blocks, compare the result
+  with a single large read, and report throughput and chunk cache usage.
+**/
+STATIC
+BOOLEAN
+UserBenchmarkSmallReads (
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *DmgContext,
+  IN     CONST UINT8                  *Expected,
+  IN     UINT32                       Size
+  )
+{
+  UINT8   Buffer[SMALL_READ_SIZE];
+  UINT32  Offset;
+  UINT32  ReadSize;
+  UINT64  StartTime;
+  UINT64  ReadTime;
+  UINT64  CacheHits;
+  UINT64  CacheMisses;
+
+  CacheHits   = DmgContext->CacheHits;
+  CacheMisses = DmgContext->CacheMisses;
+  StartTime   = UserGetTimestampUs ();
+
+  for (Offset = 0; Offset < Size; Offset += ReadSize) {
+    ReadSize = MIN (Size - Offset, SMALL_READ_SIZE);
+
+    if (  !OcAppleDiskImageRead (DmgContext, Offset / APPLE_DISK_IMAGE_SECTOR_SIZE, ReadSize, Buffer)
+       || (CompareMem (Buffer, Expected + Offset, ReadSize) != 0))
+    {
+      DEBUG ((DEBUG_ERROR, "DMG small read mismatch at %u\n", Offset));
+      return FALSE;
+    }
+  }
+
+  ReadTime = MAX (UserGetTimestampUs () - StartTime, 1);
+
+  DEBUG ((
+    DEBUG_ERROR,
+    "Read %u bytes in %u byte blocks in %Lu us (%Lu MB/s), %Lu cache hits, %Lu cache misses\n",
+    Size,
+    SMALL_READ_SIZE,
+    ReadTime,
+    (UINT64)Size / ReadTime,
+    DmgContext->CacheHits - CacheHits,
+    DmgContext->CacheMisses - CacheMisses
+    ));
+
+  return TRUE;
+}
+
+/**
+  Verify the disk image against its chunklist with an increasing number
+  of hashing threads and report throughput for each of them.
+**/
+STATIC
+BOOLEAN
+UserBenchmarkChunklistVerification (
+  IN OUT OC_APPLE_DISK_IMAGE_CONTEXT  *DmgContext,
+  IN OUT OC_APPLE_CHUNKLIST_CONTEXT   *ChunklistContext,
+  IN     UINT32                       Size
+  )
+{
+  BOOLEAN  Result;
+  UINTN    MaxThreads;
+  UINTN    Threads;
+  UINT64   StartTime;
+  UINT64   VerifyTime;
+
+  Sha256BatchSetParallelism (0);
+  MaxThreads = Sha256BatchParallelism ();
+  Threads    = 1;
+
+  while (TRUE) {
+    Sha256BatchSetParallelism (Threads);
+
+    StartTime  = UserGetTimestampUs ();
+    Result     = OcAppleDiskImageVerifyData (DmgContext, ChunklistContext);
+    VerifyTime = MAX (UserGetTimestampUs () - StartTime, 1);
+    if (!Result) {
+      DEBUG ((DEBUG_ERROR, "Chunklist chunk verification error with %u threads\n", (UINT32)Threads));
+      break;
+    }
+
+    DEBUG ((
+      DEBUG_ERROR,
+      "Verified %u bytes with %u threads in %Lu us (%Lu MB/s)\n",
+      Size,
+      (UINT32)Threads,
+      VerifyTime,
+      (UINT64)Size / VerifyTime
+      ));
+
+    if (Threads == MaxThreads) {
+      break;
+    }
+
+    Threads = MIN (Threads * 2, MaxThreads);
+  }
+
+  Sha256BatchSetParallelism (0);
+  return Result;
+}
+
 int
 ENTRY_POINT (
   int   argc,
@@ -33,7 +287,8 @@ ENTRY_POINT (
   BOOLEAN                      Result;
   OC_APPLE_DISK_IMAGE_CONTEXT  DmgContext;
   APPLE_RAM_DISK_EXTENT_TABLE  ExtentTable;
-  UINT32                       Index2;
+  UINT32                       Offset;
+  UINT32                       ReadSize;
   OC_APPLE_CHUNKLIST_CONTEXT   ChunklistContext;
 
   //
@@ -41,9 +296,18 @@ ENTRY_POINT (
   //
   SetPoolAllocationSizeLimit (BASE_1GB | BASE_2GB);
 
+  //
+  // Without arguments verify the built-in disk images.
+  //
   if (argc < 2) {
-    DEBUG ((DEBUG_ERROR, "Please provide a valid Disk Image path\n"));
-    return -1;
+    Result = TRUE;
+    for (Index = 0; Index < (int)ARRAY_SIZE (mFixtures); ++Index) {
+      if (!UserVerifyFixture (&mFixtures[Index])) {
+        Result = FALSE;
+      }
+    }
+
+    return Result ? 0 : -1;
   }
 
   if ((argc % 2) != 1) {
@@ -61,20 +325,7 @@ ENTRY_POINT (
       goto ContinueDmgLoop;
     }
 
-    ExtentTable.Signature   = APPLE_RAM_DISK_EXTENT_SIGNATURE;
-    ExtentTable.Version     = APPLE_RAM_DISK_EXTENT_VERSION;
-    ExtentTable.Reserved    = 0;
-    ExtentTable.Signature2  = APPLE_RAM_DISK_EXTENT_SIGNATURE;
-    ExtentTable.ExtentCount = MIN (NUM_EXTENTS, ARRAY_SIZE (ExtentTable.Extents));
-
-    for (Index2 = 0; Index2 < ExtentTable.ExtentCount; ++Index2) {
-      ExtentTable.Extents[Index2].Start  = (UINTN)Dmg + (Index2 * (DmgSize / ExtentTable.ExtentCount));
-      ExtentTable.Extents[Index2].Length = (DmgSize / ExtentTable.ExtentCount);
-    }
-
-    if (Index2 != 0) {
-      ExtentTable.Extents[Index2 - 1].Length += (DmgSize - (Index2 * (DmgSize / ExtentTable.ExtentCount)));
-    }
+    UserBuildExtentTable (&ExtentTable, Dmg, DmgSize);
 
     Result = OcAppleDiskImageInitializeContext (&DmgContext, &ExtentTable, DmgSize);
     if (!Result) {
@@ -107,6 +358,25 @@ ENTRY_POINT (
         DEBUG ((DEBUG_ERROR, "Chunklist chunk verification error\n"));
         goto ContinueDmgLoop;
       }
+
+      Result = UserBenchmarkChunklistVerification (&DmgContext, &ChunklistContext, DmgSize);
+      if (!Result) {
+        goto ContinueDmgLoop;
+      }
+
+      //
+      // Verify again in read buffer sized parts like DMG loading does.
+      //
+      OcAppleChunklistVerifyDataStart (&ChunklistContext);
+      for (Offset = 0; Result && Offset < DmgSize; Offset += ReadSize) {
+        ReadSize = MIN (DmgSize - Offset, BASE_4MB);
+        Result   = OcAppleChunklistVerifyDataUpdate (&ChunklistContext, Dmg + Offset, ReadSize);
+      }
+
+      if (!Result || !OcAppleChunklistVerifyDataFinal (&ChunklistContext)) {
+        DEBUG ((DEBUG_ERROR, "Chunklist incremental verification error\n"));
+        goto ContinueDmgLoop;
+      }
     }
 
     UncompSize = (DmgContext.SectorCount * APPLE_DISK_IMAGE_SECTOR_SIZE);
@@ -124,6 +394,11 @@ ENTRY_POINT (
 
     DEBUG ((DEBUG_ERROR, "Decompressed the entire DMG...\n"));
 
+    Result = UserBenchmarkSmallReads (&DmgContext, UncompDmg, UncompSize);
+    if (!Result) {
+      goto ContinueDmgLoop;
+    }
+
  #if 0
     UserWriteFile ("out.bin", UncompDmg, UncompSize);
  #endif
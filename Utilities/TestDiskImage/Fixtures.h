@@ -0,0 +1,1477 @@
+/** @file
+  Disk image fixtures for TestDiskImage.
+  Generated by TestCompression/GenerateFixtures.py, do not edit.
+
+  Copyright (C) 2026, Acidanthera. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-3-Clause
+**/
+
+#ifndef TEST_DISK_IMAGE_FIXTURES_H
+#define TEST_DISK_IMAGE_FIXTURES_H
+
+// udco-adc
+STATIC CONST UINT8  mFixture0[] = {
+  0x9C, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6F,
+  0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x14, 0x16,
+  0x8A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x10, 0x0B, 0x9D, 0x76,
+  0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76,
+  0x65, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x1C, 0x47, 0x10,
+  0x5E, 0x10, 0x06, 0x84, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x10, 0x22, 0x83, 0x62, 0x6F, 0x6F, 0x74,
+  0x10, 0x52, 0x28, 0x1D, 0x08, 0x17, 0x18, 0x3F, 0x24, 0x73, 0x0C, 0x6C, 0x0C, 0x05, 0x0C, 0x43,
+  0x30, 0x6C, 0x3C, 0x26, 0x10, 0x59, 0x10, 0xAD, 0x82, 0x65, 0x66, 0x69, 0x0C, 0xA4, 0x10, 0xB0,
+  0x10, 0xE4, 0x87, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x34, 0x4E, 0x10, 0xDC, 0x81,
+  0x69, 0x73, 0x14, 0x4D, 0x0C, 0x3B, 0x04, 0x0F, 0x04, 0x49, 0x10, 0x5B, 0x08, 0xAF, 0x08, 0x19,
+  0x11, 0x2C, 0x0C, 0x45, 0x2D, 0x57, 0x34, 0x2F, 0x0C, 0xEA, 0x10, 0x7F, 0x10, 0x9D, 0x0C, 0x13,
+  0x18, 0x8C, 0x10, 0x39, 0x21, 0x54, 0x20, 0xC5, 0x10, 0x0A, 0x0C, 0xF0, 0x0C, 0x38, 0x28, 0x45,
+  0x08, 0x35, 0x0C, 0x1D, 0x08, 0x0A, 0x18, 0x55, 0x08, 0xBD, 0x30, 0xF0, 0x10, 0x69, 0x10, 0x8D,
+  0x0D, 0x71, 0x30, 0x22, 0x10, 0x5C, 0x2D, 0x37, 0x0D, 0xC1, 0x04, 0x04, 0x2C, 0x7B, 0x0C, 0x24,
+  0x0C, 0x47, 0x08, 0x6F, 0x11, 0xD8, 0x08, 0x10, 0x0D, 0x49, 0x10, 0x1C, 0x21, 0x8B, 0x18, 0x70,
+  0x04, 0xDE, 0x0C, 0x74, 0x12, 0x75, 0x04, 0x60, 0x10, 0xCA, 0x30, 0x2A, 0x20, 0x62, 0x20, 0x0A,
+  0x2E, 0xBA, 0x04, 0x4E, 0x24, 0x27, 0x1E, 0x75, 0x0C, 0x89, 0x19, 0xED, 0x18, 0x08, 0x0C, 0xAD,
+  0x52, 0x00, 0x71, 0x10, 0x0F, 0x50, 0x02, 0x5C, 0x0C, 0x36, 0x08, 0x6E, 0x04, 0x63, 0x21, 0xF1,
+  0x31, 0xD8, 0x0C, 0x7D, 0x21, 0xC5, 0x10, 0x26, 0x0C, 0x71, 0x04, 0x17, 0x2C, 0xC1, 0x28, 0x5F,
+  0x18, 0xA5, 0x17, 0x73, 0x29, 0x91, 0x29, 0xCF, 0x1C, 0x2A, 0x29, 0xF3, 0x2B, 0xD2, 0x10, 0x3E,
+  0x2A, 0xB9, 0x0C, 0x9F, 0x21, 0x3E, 0x08, 0x3F, 0x10, 0x85, 0x1E, 0xED, 0x0C, 0x09, 0x1D, 0xDE,
+  0x0C, 0x3C, 0x24, 0x2B, 0x2C, 0x9B, 0x10, 0x50, 0x23, 0x49, 0x29, 0x1E, 0x10, 0x1E, 0x10, 0x13,
+  0x08, 0x46, 0x1C, 0x66, 0x27, 0xD8, 0x1C, 0x81, 0x22, 0x1F, 0x18, 0xEB, 0x31, 0x65, 0x0C, 0x22,
+  0x10, 0x5B, 0x35, 0x17, 0x23, 0x89, 0x20, 0x5A, 0x38, 0x25, 0x08, 0x48, 0x4C, 0x05, 0x18, 0x21,
+  0xA6, 0x0C, 0x90, 0x0C, 0xEB, 0x51, 0x01, 0xEA, 0x0C, 0x5C, 0x2D, 0x77, 0x08, 0xDA, 0x08, 0x1D,
+  0x0C, 0x32, 0x23, 0xB6, 0x45, 0x04, 0xA5, 0x25, 0x72, 0x0C, 0x43, 0x10, 0x11, 0x34, 0x8C, 0x10,
+  0x7C, 0x34, 0x1D, 0x44, 0x04, 0x70, 0x48, 0x05, 0x63, 0x2C, 0x06, 0x2A, 0xC7, 0x49, 0x04, 0x46,
+  0x34, 0x44, 0x2C, 0x69, 0x0C, 0x52, 0x24, 0xFF, 0x20, 0xD6, 0x34, 0x41, 0x2D, 0xA0, 0x0C, 0x72,
+  0x10, 0x3A, 0x2A, 0x39, 0x33, 0x6A, 0x4A, 0x05, 0x1C, 0x4B, 0x05, 0xE3, 0x05, 0x23, 0x11, 0xFE,
+  0x21, 0x44, 0x28, 0xF0, 0x21, 0xD2, 0x48, 0x04, 0x73, 0x34, 0xD8, 0x2D, 0x3B, 0x50, 0x00, 0xAB,
+  0x4F, 0x02, 0xD2, 0x0E, 0x9E, 0x25, 0xF2, 0x2E, 0xE4, 0x4A, 0x05, 0x51, 0x15, 0x3B, 0x1F, 0x2B,
+  0x34, 0xE4, 0x09, 0xF2, 0x51, 0x04, 0xDC, 0x23, 0x55, 0x48, 0x04, 0xDC, 0x2A, 0x0E, 0x49, 0x04,
+  0x20, 0x10, 0x30, 0x1B, 0x3A, 0x36, 0x2B, 0x31, 0x48, 0x14, 0x9B, 0x18, 0x2F, 0x1C, 0x7F, 0x04,
+  0x0D, 0x4E, 0x06, 0xB3, 0x10, 0x6C, 0x47, 0x04, 0x1E, 0x49, 0x06, 0xEF, 0x10, 0xC5, 0x46, 0x05,
+  0x75, 0x2C, 0x4F, 0x24, 0xA3, 0x49, 0x04, 0x10, 0x2B, 0x1D, 0x13, 0x0C, 0x25, 0x6B, 0x21, 0x83,
+  0x46, 0x04, 0xD7, 0x37, 0x24, 0x56, 0x03, 0xD9, 0x10, 0x4B, 0x10, 0xA4, 0x4E, 0x04, 0x2D, 0x45,
+  0x04, 0xE6, 0x1C, 0xB8, 0x15, 0xF1, 0x04, 0x15, 0x14, 0xDC, 0x04, 0x70, 0x24, 0xC2, 0x08, 0x67,
+  0x11, 0x42, 0x18, 0x4B, 0x31, 0xE2, 0x27, 0xDF, 0x2C, 0xBA, 0x0C, 0x13, 0x10, 0xF9, 0x49, 0x05,
+  0x75, 0x46, 0x04, 0xFE, 0x1C, 0xFD, 0x31, 0x4E, 0x35, 0xD7, 0x27, 0x07, 0x22, 0x69, 0x2B, 0x68,
+  0x2B, 0x7B, 0x11, 0x12, 0x20, 0xC8, 0x0C, 0x24, 0x08, 0x0A, 0x23, 0x36, 0x2D, 0x3A, 0x49, 0x06,
+  0x29, 0x44, 0x04, 0x0D, 0x29, 0x7B, 0x1C, 0xE3, 0x32, 0xD0, 0x10, 0x41, 0x22, 0xA0, 0x11, 0x62,
+  0x0C, 0x67, 0x53, 0x06, 0xA0, 0x04, 0x27, 0x52, 0x02, 0xB3, 0x4E, 0x07, 0x41, 0x26, 0xCC, 0x10,
+  0x19, 0x0C, 0x6D, 0x25, 0xB3, 0x1E, 0x24, 0x4A, 0x04, 0x0F, 0x0C, 0x5B, 0x4C, 0x04, 0x1E, 0x35,
+  0x66, 0x1D, 0x99, 0x23, 0x99, 0x26, 0x06, 0x21, 0xD9, 0x10, 0x11, 0x47, 0x06, 0xA6, 0x08, 0x1C,
+  0x4A, 0x05, 0x82, 0x0C, 0x2A, 0x29, 0x1B, 0x0C, 0x30, 0x49, 0x05, 0xA2, 0x20, 0x55, 0x18, 0x91,
+  0x21, 0xEB, 0x08, 0x5C, 0x49, 0x04, 0x06, 0x0C, 0x36, 0x0C, 0x4F, 0x05, 0x28, 0x48, 0x05, 0x02,
+  0x0C, 0x5F, 0x2F, 0x98, 0x16, 0x45, 0x19, 0xFC, 0x2D, 0xEF, 0x08, 0x12, 0x24, 0x9D, 0x2B, 0xBC,
+  0x31, 0x52, 0x0C, 0x81, 0x17, 0x3F, 0x04, 0xB9, 0x2A, 0x49, 0x22, 0x71, 0x28, 0xF6, 0x08, 0x11,
+  0x0C, 0x5D, 0x28, 0xCA, 0x29, 0x08, 0x48, 0x04, 0x20, 0x18, 0xC1, 0x49, 0x05, 0x0D, 0x18, 0x15,
+  0x28, 0xA8, 0x49, 0x04, 0xA4, 0x30, 0x3E, 0x3E, 0xBA, 0x22, 0x5A, 0x48, 0x05, 0xEA, 0x28, 0x89,
+  0x33, 0x8F, 0x13, 0x3C, 0x2E, 0x53, 0x25, 0x55, 0x2F, 0xFB, 0x49, 0x07, 0x41, 0x22, 0x4F, 0x47,
+  0x06, 0x72, 0x46, 0x05, 0x93, 0x4D, 0x05, 0xFE, 0x28, 0x3D, 0x28, 0xE7, 0x49, 0x04, 0x46, 0x13,
+  0x42, 0x04, 0x38, 0x36, 0x09, 0x10, 0x21, 0x4A, 0x06, 0xD6, 0x4F, 0x01, 0xE0, 0x10, 0x19, 0x14,
+  0x0D, 0x1C, 0xBA, 0x4A, 0x05, 0xEF, 0x50, 0x04, 0xA1, 0x3C, 0x08, 0x22, 0xCB, 0x08, 0xD7, 0x1C,
+  0x8E, 0x0C, 0x73, 0x11, 0x58, 0x46, 0x04, 0x7B, 0x10, 0xC0, 0x10, 0x63, 0x04, 0x37, 0x10, 0x88,
+  0x57, 0x04, 0x2C, 0x47, 0x04, 0x5F, 0x10, 0xA3, 0x3C, 0x45, 0x4E, 0x06, 0x00, 0x0C, 0x35, 0x2A,
+  0x25, 0x47, 0x07, 0x94, 0x33, 0x31, 0x08, 0xED, 0x0C, 0x13, 0x29, 0x2C, 0x2D, 0x54, 0x2D, 0x5B,
+  0x25, 0xBE, 0x0C, 0xDC, 0x10, 0x66, 0x27, 0xBB, 0x08, 0x9C, 0x0C, 0x52, 0x24, 0x16, 0x2B, 0x3E,
+  0x18, 0xBB, 0x0C, 0x15, 0x2A, 0x04, 0x24, 0xC5, 0x43, 0x04, 0x1E, 0x20, 0xF5, 0x15, 0xB2, 0x21,
+  0x47, 0x81, 0x64, 0x72, 0xAD, 0x69, 0x76, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20,
+  0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x63, 0x68, 0x75, 0x6E,
+  0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x6B, 0x65, 0x72,
+  0x6E, 0x65, 0x6C, 0x0C, 0x0B, 0x08, 0x04, 0x10, 0x1B, 0x80, 0x72, 0x08, 0x40, 0x08, 0x11, 0x84,
+  0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x10, 0x4B, 0x8A, 0x64, 0x61, 0x74, 0x61, 0x20, 0x76, 0x6F, 0x6C,
+  0x75, 0x6D, 0x65, 0x0C, 0x50, 0x08, 0x04, 0x10, 0x44, 0x0C, 0x22, 0x10, 0x0C, 0x10, 0x24, 0x84,
+  0x73, 0x65, 0x63, 0x74, 0x6F, 0x14, 0x89, 0x10, 0x55, 0x0C, 0x62, 0x82, 0x65, 0x66, 0x69, 0x10,
+  0x16, 0x10, 0x23, 0x10, 0x1D, 0x86, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x18, 0x16, 0x10,
+  0x4F, 0x8D, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65,
+  0x10, 0x94, 0x10, 0x32, 0x28, 0x64, 0x18, 0x28, 0x04, 0x60, 0x10, 0x19, 0x0C, 0xAA, 0x08, 0x32,
+  0x0C, 0x7C, 0x0D, 0x07, 0x18, 0x2A, 0x10, 0x47, 0x08, 0x26, 0x04, 0x36, 0x10, 0x73, 0x11, 0x39,
+  0x29, 0x12, 0x1C, 0x33, 0x09, 0x32, 0x05, 0x0F, 0x0C, 0x58, 0x29, 0x5A, 0x04, 0x16, 0x10, 0x7B,
+  0x10, 0x44, 0x18, 0xD6, 0x10, 0x0F, 0x28, 0xB3, 0x08, 0x78, 0x0C, 0x3A, 0x20, 0xAA, 0x08, 0x45,
+  0x10, 0x8A, 0x10, 0x2E, 0x0C, 0xFC, 0x10, 0x13, 0x04, 0xA9, 0x15, 0xA8, 0x04, 0x2A, 0x0C, 0x1C,
+  0x08, 0x0A, 0x08, 0x9C, 0x0C, 0x0F, 0x2D, 0x46, 0x0C, 0x6F, 0x04, 0x39, 0x08, 0x68, 0x10, 0x3E,
+  0x20, 0x49, 0x0C, 0x16, 0x04, 0x3E, 0x11, 0xC1, 0x0C, 0xD7, 0x21, 0xFE, 0x20, 0x6B, 0x0C, 0x05,
+  0x10, 0x28, 0x18, 0x54, 0x10, 0xE1, 0x38, 0x27, 0x10, 0x82, 0x0C, 0x50, 0x20, 0x34, 0x10, 0x2F,
+  0x08, 0x3F, 0x1C, 0xF8, 0x10, 0x15, 0x52, 0x01, 0xA9, 0x0C, 0x15, 0x08, 0x6D, 0x18, 0x1A, 0x10,
+  0xA2, 0x04, 0xBA, 0x18, 0x13, 0x0C, 0x4F, 0x16, 0xE4, 0x0C, 0x3B, 0x10, 0x0D, 0x10, 0x06, 0x21,
+  0x7A, 0x0C, 0xA5, 0x19, 0xA8, 0x24, 0xBA, 0x18, 0x50, 0x18, 0x08, 0x10, 0xBF, 0x0C, 0x39, 0x0C,
+  0x7A, 0x23, 0x56, 0x29, 0x7A, 0x29, 0x25, 0x0D, 0x42, 0x23, 0x5E, 0x14, 0x0B, 0x24, 0xD8, 0x25,
+  0x73, 0x34, 0xFA, 0x18, 0x0F, 0x0C, 0x6E, 0x18, 0x0E, 0x22, 0x14, 0x17, 0x50, 0x3C, 0x5E, 0x26,
+  0x98, 0x2A, 0xD6, 0x2F, 0xB5, 0x55, 0x02, 0x66, 0x29, 0x5C, 0x19, 0x29, 0x18, 0x08, 0x1F, 0xD9,
+  0x10, 0x30, 0x18, 0x19, 0x29, 0x88, 0x21, 0xE5, 0x04, 0x2B, 0x2B, 0xB1, 0x0C, 0xF4, 0x15, 0x2C,
+  0x45, 0x04, 0x96, 0x31, 0x95, 0x0D, 0x20, 0x34, 0xEB, 0x28, 0xB6, 0x0C, 0x8B, 0x22, 0x5B, 0x0C,
+  0x10, 0x4A, 0x04, 0x6C, 0x31, 0x4C, 0x13, 0x41, 0x1F, 0x14, 0x08, 0xCA, 0x28, 0xF4, 0x35, 0x8E,
+  0x44, 0x05, 0x0C, 0x1C, 0xD2, 0x13, 0xD2, 0x08, 0x10, 0x0C, 0x05, 0x3D, 0x31, 0x0C, 0x6E, 0x24,
+  0xE5, 0x27, 0x34, 0x27, 0x9A, 0x1D, 0x52, 0x35, 0xE9, 0x1E, 0xE4, 0x1E, 0xC2, 0x28, 0x57, 0x48,
+  0x04, 0xFC, 0x18, 0x79, 0x30, 0xF1, 0x08, 0x1C, 0x10, 0x2F, 0x2B, 0xF0, 0x0C, 0x1E, 0x2B, 0xAB,
+  0x0C, 0xCC, 0x28, 0x25, 0x0C, 0x12, 0x29, 0x36, 0x47, 0x04, 0x85, 0x49, 0x04, 0x73, 0x3D, 0x04,
+  0x25, 0xBE, 0x04, 0x2E, 0x24, 0xC2, 0x12, 0x9C, 0x20, 0x45, 0x2A, 0x25, 0x08, 0xB6, 0x10, 0x3B,
+  0x04, 0x0F, 0x34, 0x23, 0x09, 0x52, 0x47, 0x05, 0x5B, 0x31, 0x11, 0x2A, 0x8C, 0x04, 0x1F, 0x2A,
+  0x75, 0x11, 0x8A, 0x10, 0x1F, 0x0C, 0xCF, 0x24, 0x70, 0x24, 0x38, 0x0C, 0x1D, 0x0C, 0xAD, 0x18,
+  0xD8, 0x2A, 0xE6, 0x3F, 0x97, 0x23, 0x1F, 0x4F, 0x02, 0x76, 0x47, 0x05, 0x36, 0x04, 0x28, 0x4C,
+  0x07, 0x0E, 0x1E, 0x0F, 0x52, 0x05, 0xCA, 0x49, 0x07, 0x69, 0x0C, 0x81, 0x4A, 0x06, 0x88, 0x47,
+  0x06, 0x60, 0x19, 0x2E, 0x1F, 0x4E, 0x25, 0x71, 0x4B, 0x04, 0xFA, 0x38, 0xB6, 0x2F, 0x98, 0x18,
+  0x08, 0x0C, 0x81, 0x10, 0x43, 0x1F, 0xC1, 0x37, 0x71, 0x49, 0x05, 0x1C, 0x32, 0x95, 0x2A, 0x70,
+  0x26, 0x69, 0x20, 0x83, 0x10, 0x06, 0x0C, 0x1D, 0x25, 0x86, 0x08, 0xC2, 0x0C, 0x16, 0x3D, 0xC2,
+  0x2A, 0xC3, 0x1E, 0x2E, 0x1F, 0xB7, 0x20, 0x43, 0x0C, 0x36, 0x0C, 0x16, 0x18, 0xDD, 0x2E, 0x23,
+  0x22, 0x3C, 0x04, 0x9A, 0x10, 0x15, 0x24, 0x1C, 0x10, 0x82, 0x21, 0xFA, 0x04, 0x03, 0x26, 0xE4,
+  0x10, 0x21, 0x47, 0x04, 0xA9, 0x23, 0x42, 0x1D, 0xE8, 0x47, 0x06, 0xDE, 0x4B, 0x05, 0x55, 0x33,
+  0x5F, 0x2F, 0xEF, 0x2A, 0x02, 0x15, 0x94, 0x26, 0x2A, 0x20, 0xB7, 0x48, 0x06, 0xA2, 0x1E, 0x57,
+  0x04, 0x0D, 0x4E, 0x04, 0xFE, 0x20, 0x8E, 0x2B, 0xE6, 0x1C, 0x54, 0x28, 0xDD, 0x3D, 0xB8, 0x28,
+  0x35, 0x4A, 0x05, 0x4C, 0x4E, 0x04, 0x2A, 0x32, 0x25, 0x10, 0x3B, 0x2F, 0xD5, 0x4A, 0x05, 0xA7,
+  0x0C, 0x31, 0x3E, 0x9D, 0x22, 0x1D, 0x0C, 0xA0, 0x0C, 0x80, 0x0C, 0x11, 0x08, 0x1C, 0x2C, 0x47,
+  0x10, 0x99, 0x51, 0x01, 0x72, 0x1C, 0x54, 0x26, 0x8B, 0x43, 0x05, 0x58, 0x22, 0xBB, 0x08, 0x51,
+  0x48, 0x04, 0x87, 0x52, 0x00, 0xBF, 0x47, 0x06, 0x3C, 0x29, 0xC2, 0x2D, 0x30, 0x0C, 0x52, 0x2D,
+  0xD0, 0x3D, 0x9E, 0x08, 0x41, 0x05, 0x74, 0x2B, 0x66, 0x38, 0x94, 0x16, 0x8F, 0x49, 0x05, 0x18,
+  0x2E, 0xE2, 0x42, 0x06, 0x91, 0x08, 0x18, 0x0F, 0x41, 0x47, 0x04, 0x6C, 0x10, 0x7E, 0x37, 0x1C,
+  0x25, 0x58, 0x3A, 0xBC, 0x23, 0x86, 0x4E, 0x04, 0x4D, 0x10, 0x40, 0x0C, 0xAD, 0x2D, 0x2C, 0x28,
+  0xFE, 0x49, 0x06, 0x84, 0x04, 0xC0, 0x48, 0x04, 0x06, 0x52, 0x00, 0x8E, 0x28, 0xDB, 0x21, 0x66,
+  0x48, 0x04, 0xF1, 0x15, 0x0E, 0x4A, 0x06, 0x47, 0x0C, 0x3F, 0x11, 0x0E, 0x0C, 0x62, 0x43, 0x04,
+  0x93, 0x08, 0x3F, 0x18, 0xD4, 0x1F, 0xBA, 0x25, 0x6D, 0x24, 0x7D, 0x08, 0x2B, 0x4E, 0x06, 0xF2,
+  0x2D, 0xEE, 0x52, 0x02, 0x5B, 0x17, 0xBA, 0x04, 0x35, 0x10, 0x41, 0x49, 0x05, 0x25, 0x15, 0xAD,
+  0x26, 0x89, 0x30, 0x52, 0x49, 0x05, 0x13, 0x10, 0x2F, 0x0C, 0x19, 0x15, 0xFE, 0x04, 0x87, 0x2E,
+  0x59, 0x31, 0x51, 0x29, 0x44, 0x21, 0x34, 0x10, 0x34, 0x0C, 0x61, 0x54, 0x04, 0x2C, 0x25, 0x09,
+  0x08, 0x6A, 0x0C, 0x2E, 0x0C, 0x05, 0x2A, 0x27, 0x24, 0xC4, 0x37, 0x80, 0x25, 0x3E, 0x20, 0x81,
+  0x0C, 0x5C, 0x04, 0x09, 0x49, 0x04, 0x58, 0x4A, 0x05, 0xE2, 0x4B, 0x05, 0x3D, 0x46, 0x05, 0xBC,
+  0x34, 0xE6, 0x2D, 0xD8, 0x15, 0x7B, 0x49, 0x04, 0xBF, 0x08, 0x1E, 0x26, 0x76, 0x10, 0x98, 0x24,
+  0xEB, 0x48, 0x05, 0x50, 0x10, 0x36, 0x0C, 0xFE, 0x34, 0xCD, 0x27, 0x31, 0x2E, 0xEF, 0x29, 0xA0,
+  0x0C, 0x26, 0x2D, 0xA1, 0x13, 0x3D, 0x0C, 0x5D, 0x18, 0xEE, 0x3C, 0x3F, 0x78, 0x6D, 0x6C, 0x20,
+  0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30, 0x22, 0x20, 0x65, 0x6E,
+  0x63, 0x6F, 0x64, 0x69, 0x6E, 0x67, 0x3D, 0x22, 0x55, 0x54, 0x46, 0x2D, 0x38, 0x22, 0x3F, 0x3E,
+  0x0A, 0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x70, 0x6C, 0x69, 0x73, 0x74,
+  0x20, 0x50, 0x55, 0x42, 0x4C, 0x49, 0x43, 0x20, 0x22, 0x2D, 0x2F, 0x2F, 0x41, 0x70, 0x70, 0x6C,
+  0x65, 0x2F, 0x2F, 0x44, 0x54, 0x44, 0x20, 0x50, 0x4C, 0x49, 0x53, 0x54, 0x20, 0x31, 0x2E, 0x30,
+  0x2F, 0x2F, 0x45, 0x4E, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77,
+  0x77, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x44, 0x54, 0x44, 0x73,
+  0x2F, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4C, 0x69, 0x73, 0x74, 0x2D, 0x31, 0x2E,
+  0x30, 0x2E, 0x64, 0x74, 0x64, 0x22, 0x3E, 0x0A, 0x3C, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x76,
+  0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30, 0x22, 0x3E, 0x0A, 0x3C, 0x64,
+  0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x72, 0x65, 0x73, 0x6F, 0x75,
+  0x72, 0x63, 0x65, 0x2D, 0x66, 0x6F, 0x72, 0x6B, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09,
+  0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x62, 0x6C,
+  0x6B, 0x78, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x3C, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73,
+  0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69,
+  0x6E, 0x67, 0x3E, 0x30, 0x78, 0x30, 0x30, 0x35, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E,
+  0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x43, 0x46, 0x4E, 0x61,
+  0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74,
+  0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46, 0x69, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x30, 0x3C, 0x2F,
+  0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79,
+  0x3E, 0x44, 0x61, 0x74, 0x61, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x3C, 0x64, 0x61, 0x74, 0x61, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x62, 0x57, 0x6C, 0x7A, 0x61,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x0A,
+  0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x41, 0x41, 0x41, 0x41, 0x67,
+  0x38, 0x63, 0x6A, 0x56, 0x6A, 0x77, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x44, 0x67, 0x41, 0x41, 0x41, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x44, 0x74, 0x49, 0x41,
+  0x41, 0x41, 0x41, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x67, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x4F, 0x30, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x38, 0x62, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09,
+  0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x48, 0x65, 0x67, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x2F, 0x64, 0x61, 0x74, 0x61, 0x3E, 0x0A,
+  0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x49, 0x44, 0x3C, 0x2F, 0x6B, 0x65, 0x79,
+  0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x30, 0x3C,
+  0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65,
+  0x79, 0x3E, 0x4E, 0x61, 0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46, 0x69, 0x78, 0x74, 0x75, 0x72, 0x65,
+  0x20, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x3C,
+  0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x3C, 0x2F, 0x61, 0x72, 0x72, 0x61, 0x79,
+  0x3E, 0x0A, 0x09, 0x3C, 0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x63,
+  0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x3E, 0x0A, 0x6B, 0x6F, 0x6C, 0x79,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xE2, 0xCE, 0x30, 0x37,
+  0x09, 0x70, 0x5F, 0x5E, 0x56, 0xB5, 0x33, 0x1A, 0x2C, 0xD0, 0xC3, 0x23, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x20, 0xA3, 0x9C, 0xBF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7A, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x20, 0x01, 0x6A, 0xC6, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// udbz-bzip2
+STATIC CONST UINT8  mFixture1[] = {
+  0x42, 0x5A, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x34, 0x49, 0x6A, 0x9F, 0x00, 0x04,
+  0xA3, 0x91, 0x80, 0x40, 0x00, 0x3F, 0xEF, 0xDF, 0x20, 0x50, 0x03, 0xE0, 0x01, 0xE6, 0x1D, 0xB2,
+  0xD1, 0x40, 0xD4, 0xFD, 0x08, 0x55, 0x40, 0xD0, 0x00, 0x4A, 0x79, 0x2A, 0xA9, 0xA6, 0x4C, 0x13,
+  0x26, 0x4C, 0x24, 0xF5, 0x55, 0x46, 0x8C, 0x9A, 0x34, 0xC4, 0xC4, 0x28, 0xD1, 0x90, 0x34, 0x69,
+  0x91, 0xA0, 0x52, 0x52, 0x84, 0x4F, 0x11, 0x34, 0xF5, 0x34, 0xD3, 0xFD, 0xF5, 0xEF, 0xD1, 0xF0,
+  0xD9, 0xAC, 0x85, 0x94, 0x6B, 0xE3, 0x3F, 0x99, 0x31, 0xA3, 0x8E, 0x24, 0x68, 0x83, 0xDD, 0x9C,
+  0x73, 0xE9, 0xB1, 0xBE, 0xEE, 0x98, 0x2D, 0xC1, 0x75, 0xF3, 0xA2, 0x29, 0x65, 0x89, 0xA7, 0x84,
+  0x41, 0xBA, 0xB0, 0xD1, 0xDF, 0x77, 0x34, 0xA2, 0xAE, 0xF3, 0x8E, 0x4F, 0x72, 0x09, 0xA4, 0x3A,
+  0x59, 0x7C, 0xB1, 0xF5, 0xBE, 0xE1, 0x69, 0xCE, 0xE1, 0xAD, 0x18, 0x90, 0xF3, 0x3A, 0x2C, 0xC7,
+  0xE6, 0x9D, 0x13, 0x83, 0x58, 0x3A, 0x2A, 0x38, 0xE1, 0x36, 0x15, 0xD3, 0x1A, 0x51, 0x41, 0xA1,
+  0x95, 0xF6, 0xE4, 0x0D, 0xBD, 0x7B, 0x05, 0x26, 0xC7, 0x76, 0x41, 0x46, 0x83, 0x23, 0xF7, 0x09,
+  0x19, 0x12, 0xCB, 0xC5, 0x13, 0x3D, 0x2F, 0x6C, 0x5C, 0x7A, 0xE2, 0xC1, 0x6E, 0x66, 0x97, 0x5E,
+  0x93, 0xD1, 0xFB, 0x89, 0xCA, 0xE1, 0x2F, 0xAD, 0x7B, 0x93, 0x29, 0x6B, 0x48, 0x9C, 0x45, 0x06,
+  0xD9, 0x8A, 0xCF, 0x72, 0x97, 0x2A, 0xDE, 0xB4, 0xBE, 0x85, 0x8E, 0x14, 0x46, 0x3C, 0xC3, 0x66,
+  0xDF, 0x64, 0xD8, 0xDC, 0x63, 0x13, 0x4C, 0xF2, 0x8E, 0xC8, 0x7A, 0xF4, 0x0E, 0xAE, 0xEE, 0xBC,
+  0xC5, 0x70, 0x75, 0xF5, 0xA7, 0x8B, 0x8F, 0x2C, 0x9C, 0x28, 0x05, 0x58, 0x48, 0xB5, 0xBC, 0x15,
+  0x88, 0x60, 0xB0, 0x95, 0xAE, 0xC4, 0xD0, 0x51, 0xD9, 0x23, 0xF0, 0xCE, 0xC9, 0xE7, 0x1A, 0xC7,
+  0x93, 0x09, 0x31, 0xE4, 0x00, 0xBB, 0x5E, 0x0F, 0x5B, 0x31, 0xAB, 0x6D, 0xAF, 0x26, 0xBD, 0xAD,
+  0x63, 0xF6, 0x1E, 0x55, 0xBF, 0x6A, 0xB3, 0x1E, 0x61, 0x5E, 0xED, 0xB0, 0x7B, 0x98, 0xA9, 0xB2,
+  0xC6, 0xFB, 0x30, 0xA8, 0xD7, 0x7D, 0xB7, 0x15, 0x68, 0x5A, 0x6F, 0x6E, 0x75, 0xBA, 0xF5, 0xA5,
+  0x3E, 0x92, 0x77, 0xA8, 0xF8, 0x49, 0xFA, 0x85, 0xC4, 0x0F, 0x4A, 0x3C, 0x54, 0x7A, 0xA4, 0xF0,
+  0x91, 0xD6, 0x4A, 0xFE, 0x7C, 0x47, 0x7C, 0xF8, 0xE9, 0xB9, 0xB7, 0x39, 0xC7, 0x47, 0x47, 0x3A,
+  0x36, 0xC4, 0x52, 0x29, 0x4E, 0x96, 0x2D, 0x3B, 0x2A, 0x46, 0x28, 0x7B, 0x1A, 0x27, 0xB0, 0xC6,
+  0x4C, 0x5A, 0x7B, 0x46, 0xB4, 0xAB, 0xC9, 0xB4, 0x6D, 0x13, 0xA1, 0x6E, 0x91, 0x61, 0x87, 0x45,
+  0xBB, 0x3C, 0xD0, 0xF2, 0x8D, 0x36, 0xC1, 0x94, 0x5A, 0xE8, 0xA5, 0x73, 0x6B, 0x39, 0xCA, 0x52,
+  0x0B, 0x63, 0x80, 0xFA, 0x03, 0x8F, 0x0E, 0x0E, 0xF1, 0xEE, 0x38, 0xFA, 0xEE, 0x35, 0xEB, 0x75,
+  0x4A, 0x82, 0x19, 0x0C, 0xC1, 0xA1, 0x44, 0x45, 0x9B, 0x6C, 0xB5, 0xB6, 0x29, 0x90, 0xF1, 0x17,
+  0xCA, 0x4F, 0xED, 0x27, 0xDC, 0x5E, 0xD5, 0x1E, 0x47, 0x1C, 0x7C, 0x07, 0x07, 0xA1, 0xDC, 0x1E,
+  0x7F, 0xB7, 0xD1, 0x51, 0x15, 0xE5, 0x58, 0xA8, 0x89, 0x19, 0x19, 0x88, 0x8A, 0x45, 0xE7, 0xA9,
+  0x68, 0x96, 0xBA, 0x04, 0x52, 0x51, 0x86, 0xB7, 0x0E, 0x73, 0x97, 0x36, 0x71, 0xC6, 0x66, 0xDA,
+  0xE5, 0xCA, 0x8E, 0xD0, 0x75, 0xD1, 0xDE, 0x93, 0xEF, 0x5C, 0x81, 0x22, 0x24, 0x44, 0xC0, 0x21,
+  0x8C, 0xCB, 0x23, 0x4B, 0x6D, 0x6D, 0x99, 0xA2, 0x7A, 0x13, 0xD2, 0x4F, 0xC1, 0x3B, 0x52, 0x7B,
+  0xD2, 0x72, 0x93, 0xD2, 0x8F, 0xA1, 0x3D, 0xE1, 0x77, 0xA4, 0xFB, 0x13, 0xCD, 0x27, 0x88, 0x59,
+  0x0D, 0x49, 0xD2, 0xA3, 0xCD, 0x47, 0xF2, 0xA3, 0xA7, 0x96, 0xD9, 0xA6, 0x6D, 0x96, 0xCD, 0x32,
+  0x54, 0x6C, 0x30, 0x30, 0xD2, 0x09, 0x00, 0x8D, 0x5B, 0x2C, 0xCD, 0xA6, 0xCD, 0xB1, 0x4E, 0xA8,
+  0x7D, 0x54, 0x74, 0x94, 0x70, 0x4F, 0x92, 0x3A, 0xC2, 0xEC, 0x93, 0xA4, 0x2F, 0x71, 0x3C, 0x89,
+  0xF9, 0x49, 0xEC, 0xA3, 0xD9, 0x0E, 0xC2, 0x7E, 0xD0, 0xFF, 0x8B, 0xB9, 0x22, 0x9C, 0x28, 0x48,
+  0x1A, 0x24, 0xB5, 0x4F, 0x80, 0x42, 0x5A, 0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x61,
+  0x7C, 0x03, 0xC9, 0x00, 0x04, 0x3E, 0x91, 0x80, 0x40, 0x00, 0x3F, 0xEF, 0xDF, 0x20, 0x50, 0x03,
+  0xE0, 0x01, 0xE6, 0x1C, 0xD9, 0x99, 0x20, 0xD4, 0xF0, 0x4D, 0x55, 0x40, 0xD0, 0x00, 0x4A, 0x79,
+  0x2A, 0xA9, 0xA1, 0x82, 0x60, 0x98, 0x24, 0xF5, 0x55, 0x43, 0x4C, 0x8C, 0x4D, 0x31, 0x34, 0x28,
+  0xD1, 0x90, 0x34, 0x69, 0x91, 0xA0, 0x52, 0x92, 0x26, 0x83, 0x50, 0xC4, 0x0A, 0x3E, 0x7F, 0x4F,
+  0xAD, 0x87, 0xF3, 0x18, 0x20, 0xFF, 0x89, 0x68, 0xDE, 0x3F, 0xC7, 0x11, 0x0F, 0x90, 0x89, 0x94,
+  0x8D, 0x5D, 0xBA, 0xDD, 0xA7, 0xA9, 0x00, 0x9D, 0x2B, 0x0A, 0x85, 0xDB, 0x93, 0xB5, 0x32, 0xCF,
+  0x92, 0x2A, 0x18, 0xC2, 0x44, 0xA5, 0xCD, 0x36, 0x2E, 0xB3, 0x6B, 0x26, 0xA5, 0x68, 0x5B, 0x3D,
+  0x6B, 0x04, 0x90, 0x44, 0xE2, 0x98, 0x4A, 0x1E, 0x93, 0x44, 0x48, 0xCD, 0x39, 0x95, 0x0E, 0x62,
+  0x8C, 0x01, 0xB4, 0x01, 0x2F, 0xDC, 0xB9, 0xE7, 0x44, 0x53, 0x10, 0xB2, 0x50, 0x57, 0x2D, 0x2C,
+  0x40, 0x5E, 0x3E, 0x2D, 0x79, 0x31, 0xA0, 0xED, 0xC7, 0x67, 0xD4, 0x66, 0x41, 0x65, 0x13, 0x1E,
+  0x27, 0x96, 0xE1, 0xC4, 0x46, 0xB5, 0xEE, 0x81, 0x28, 0xA1, 0x95, 0xC7, 0x88, 0x5C, 0xDF, 0x9F,
+  0x0B, 0x70, 0x66, 0xD8, 0x1C, 0x43, 0x52, 0x90, 0x1D, 0x92, 0xD9, 0x9C, 0x71, 0x7B, 0xB2, 0xD2,
+  0x86, 0xA5, 0x6C, 0x69, 0x0B, 0x26, 0x19, 0x50, 0xE6, 0xD8, 0x8C, 0x0C, 0x98, 0xB1, 0x89, 0xB6,
+  0xB8, 0xF3, 0x25, 0xA2, 0xD7, 0x27, 0xEA, 0x73, 0x66, 0x85, 0x11, 0x2D, 0x6A, 0x6D, 0x1C, 0x95,
+  0x24, 0x5E, 0x56, 0x32, 0x9B, 0x3E, 0x46, 0x34, 0x8A, 0x2A, 0x42, 0x27, 0x5A, 0x71, 0x26, 0x93,
+  0x97, 0x63, 0xBA, 0x7B, 0x9A, 0x6B, 0x71, 0xE3, 0x6B, 0x41, 0x77, 0x4F, 0x4A, 0xEB, 0x06, 0x57,
+  0x0F, 0x98, 0xC6, 0x97, 0x49, 0x07, 0x92, 0x24, 0x70, 0x20, 0x91, 0x17, 0x97, 0x8D, 0xC9, 0x74,
+  0x12, 0x94, 0x89, 0xC8, 0x90, 0x4A, 0xC8, 0x20, 0x64, 0xB0, 0x4F, 0x12, 0x68, 0x24, 0x71, 0x0F,
+  0x21, 0x73, 0x82, 0xF5, 0x9D, 0x56, 0xD6, 0x7B, 0x8F, 0x05, 0x4F, 0x9D, 0xB6, 0x5A, 0xEB, 0x8D,
+  0x71, 0x9A, 0xCC, 0xDF, 0x7D, 0xF7, 0xD3, 0x38, 0xCD, 0x94, 0x9E, 0x44, 0xEF, 0x0B, 0xE0, 0x8E,
+  0xF0, 0xB5, 0x0A, 0xF6, 0x47, 0x24, 0xF7, 0x07, 0x6A, 0x26, 0xF1, 0x57, 0x87, 0x6C, 0xE7, 0x05,
+  0x7D, 0xE8, 0x4C, 0xEA, 0xB6, 0x6D, 0xB1, 0x6D, 0x64, 0xCF, 0x62, 0xAA, 0x24, 0xCE, 0xC2, 0xD2,
+  0x13, 0xC2, 0x86, 0xD2, 0x45, 0xC1, 0x93, 0x57, 0x67, 0x50, 0xDB, 0x1B, 0x1A, 0xB2, 0x39, 0x59,
+  0xB6, 0x1C, 0x4B, 0x56, 0x94, 0x75, 0x26, 0x45, 0xAC, 0xCA, 0x67, 0x31, 0x8D, 0x23, 0x85, 0xD7,
+  0x66, 0x49, 0x33, 0x91, 0x34, 0x3C, 0x77, 0x1F, 0x40, 0x71, 0xE1, 0xC1, 0x6E, 0x3A, 0xD6, 0xF3,
+  0xAA, 0xBD, 0x6F, 0xD4, 0xC8, 0xD0, 0x91, 0xB1, 0x89, 0x94, 0x68, 0x8D, 0x18, 0xA1, 0xAD, 0x66,
+  0xD6, 0xBE, 0xF5, 0x5B, 0xAD, 0x5A, 0xF1, 0x6A, 0xBC, 0xE1, 0x70, 0x4E, 0xC2, 0x7A, 0xA1, 0xCB,
+  0x58, 0x17, 0x8E, 0x73, 0xAD, 0x9A, 0xC6, 0xB5, 0x8D, 0x69, 0x99, 0x8B, 0xA4, 0x6B, 0x99, 0x67,
+  0xA6, 0x21, 0xAA, 0x84, 0x58, 0x52, 0xE8, 0x25, 0x58, 0xBA, 0xA2, 0x94, 0x47, 0xA2, 0xAA, 0x2B,
+  0xBB, 0x8F, 0xD7, 0x1C, 0x77, 0x8F, 0x1C, 0x77, 0xD7, 0xF5, 0x41, 0x16, 0x86, 0x26, 0x32, 0x00,
+  0x94, 0x92, 0x48, 0x40, 0x31, 0x25, 0x19, 0x30, 0x8C, 0x1A, 0xD5, 0xDE, 0xB5, 0x77, 0xAB, 0x5E,
+  0xAB, 0x57, 0x48, 0x3C, 0x49, 0x69, 0x0F, 0x44, 0x79, 0x23, 0xAD, 0x27, 0x78, 0x3F, 0x04, 0xE6,
+  0x0F, 0x14, 0x99, 0x49, 0x90, 0x6C, 0x4E, 0x61, 0x7A, 0x85, 0xB7, 0x39, 0x8C, 0xCC, 0x60, 0x8A,
+  0x4B, 0x06, 0x84, 0xCC, 0xD9, 0x20, 0x09, 0x89, 0x04, 0xCB, 0x06, 0xC4, 0x18, 0x26, 0xAA, 0xF8,
+  0xDA, 0xD7, 0x6B, 0x56, 0xF7, 0xA8, 0xB4, 0x27, 0xCD, 0x0D, 0xE9, 0x3A, 0x11, 0xB4, 0x2E, 0xA2,
+  0x72, 0x47, 0xF2, 0x1C, 0x51, 0x71, 0x49, 0xD0, 0x8F, 0xAA, 0x4F, 0xF1, 0x77, 0x24, 0x53, 0x85,
+  0x09, 0x06, 0x17, 0xC0, 0x3C, 0x90, 0x3C, 0x3F, 0x78, 0x6D, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30, 0x22, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x69,
+  0x6E, 0x67, 0x3D, 0x22, 0x55, 0x54, 0x46, 0x2D, 0x38, 0x22, 0x3F, 0x3E, 0x0A, 0x3C, 0x21, 0x44,
+  0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x50, 0x55, 0x42,
+  0x4C, 0x49, 0x43, 0x20, 0x22, 0x2D, 0x2F, 0x2F, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x2F, 0x2F, 0x44,
+  0x54, 0x44, 0x20, 0x50, 0x4C, 0x49, 0x53, 0x54, 0x20, 0x31, 0x2E, 0x30, 0x2F, 0x2F, 0x45, 0x4E,
+  0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x61, 0x70,
+  0x70, 0x6C, 0x65, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x44, 0x54, 0x44, 0x73, 0x2F, 0x50, 0x72, 0x6F,
+  0x70, 0x65, 0x72, 0x74, 0x79, 0x4C, 0x69, 0x73, 0x74, 0x2D, 0x31, 0x2E, 0x30, 0x2E, 0x64, 0x74,
+  0x64, 0x22, 0x3E, 0x0A, 0x3C, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
+  0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30, 0x22, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E,
+  0x0A, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2D,
+  0x66, 0x6F, 0x72, 0x6B, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x3C, 0x64, 0x69, 0x63,
+  0x74, 0x3E, 0x0A, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x62, 0x6C, 0x6B, 0x78, 0x3C, 0x2F,
+  0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x3C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3E, 0x0A, 0x09,
+  0x09, 0x09, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65,
+  0x79, 0x3E, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x3C, 0x2F, 0x6B, 0x65,
+  0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x30,
+  0x78, 0x30, 0x30, 0x35, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09,
+  0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x43, 0x46, 0x4E, 0x61, 0x6D, 0x65, 0x3C, 0x2F,
+  0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+  0x3E, 0x46, 0x69, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69,
+  0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x44, 0x61, 0x74,
+  0x61, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x64, 0x61, 0x74,
+  0x61, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x62, 0x57, 0x6C, 0x7A, 0x61, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x41, 0x41, 0x41, 0x41, 0x67, 0x38, 0x63, 0x6A, 0x56,
+  0x6A, 0x77, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09,
+  0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A,
+  0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x44,
+  0x67, 0x41, 0x41, 0x41, 0x42, 0x67, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x56, 0x59, 0x41, 0x41, 0x41, 0x41, 0x59,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x67,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x4A, 0x56, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x6C, 0x48, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41,
+  0x41, 0x41, 0x45, 0x70, 0x67, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A,
+  0x09, 0x09, 0x09, 0x09, 0x3C, 0x2F, 0x64, 0x61, 0x74, 0x61, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x49, 0x44, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09,
+  0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72,
+  0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x4E, 0x61,
+  0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74,
+  0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46, 0x69, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x30, 0x3C, 0x2F,
+  0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x3C, 0x2F, 0x64, 0x69, 0x63,
+  0x74, 0x3E, 0x0A, 0x09, 0x09, 0x3C, 0x2F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3E, 0x0A, 0x09, 0x3C,
+  0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x3C,
+  0x2F, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x3E, 0x0A, 0x6B, 0x6F, 0x6C, 0x79, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xE2, 0xCE, 0x30, 0x37, 0x09, 0x70, 0x5F, 0x5E,
+  0x56, 0xB5, 0x33, 0x1A, 0x2C, 0xD0, 0xC3, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20,
+  0x56, 0x4E, 0x24, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20,
+  0x01, 0x6A, 0xC6, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// ulfo-lzfse
+STATIC CONST UINT8  mFixture2[] = {
+  0x62, 0x76, 0x78, 0x32, 0x00, 0x10, 0x00, 0x00, 0x60, 0x00, 0x30, 0x03, 0x00, 0x8A, 0x01, 0x40,
+  0x38, 0x32, 0x95, 0xF4, 0xA7, 0xC6, 0x02, 0x70, 0xAD, 0x00, 0x00, 0x00, 0x3F, 0x5C, 0xF0, 0x00,
+  0x1F, 0x02, 0xAA, 0x20, 0x08, 0x00, 0x22, 0x90, 0x1E, 0x5C, 0x24, 0x9D, 0x63, 0x8E, 0x2C, 0x41,
+  0x40, 0xAD, 0x63, 0x75, 0xCF, 0xAE, 0xA3, 0x8B, 0xA3, 0x8B, 0x9B, 0xAB, 0x93, 0x9B, 0x83, 0xB3,
+  0x75, 0x75, 0x75, 0x70, 0xB3, 0x5F, 0x81, 0x8B, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+  0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x07, 0x8F, 0xC0, 0xA3, 0xF0,
+  0x08, 0x7C, 0x21, 0x27, 0x27, 0x27, 0xDF, 0x01, 0x2F, 0xC1, 0x77, 0x70, 0xFD, 0x08, 0x7C, 0x0F,
+  0x2F, 0x01, 0x8F, 0xC4, 0xF5, 0x4B, 0x70, 0xFD, 0x08, 0xC0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC,
+  0x15, 0xBE, 0x45, 0x63, 0xD5, 0x6A, 0x80, 0x2D, 0xF4, 0xA5, 0xD0, 0x86, 0x1E, 0xE7, 0x57, 0x95,
+  0xA4, 0x15, 0x68, 0x0E, 0x9E, 0x2A, 0xEB, 0x89, 0x69, 0x81, 0x64, 0x38, 0xAD, 0xD2, 0x18, 0x86,
+  0xC0, 0x13, 0x6C, 0xDD, 0x02, 0xC5, 0x46, 0x76, 0x0F, 0x64, 0x4C, 0xC2, 0xA7, 0xC0, 0x11, 0x00,
+  0x00, 0x00, 0xC0, 0x00, 0xDE, 0x0A, 0xD0, 0x17, 0x23, 0x9E, 0xDA, 0x91, 0xF8, 0x32, 0x06, 0xE8,
+  0x35, 0x8C, 0x71, 0xDF, 0xD7, 0x0E, 0xAC, 0x40, 0x42, 0xCB, 0x18, 0x20, 0x83, 0x23, 0x58, 0x24,
+  0x23, 0x88, 0x67, 0x40, 0x44, 0xF6, 0xDA, 0x34, 0xC9, 0xEC, 0x15, 0xD5, 0xBF, 0xD4, 0x16, 0x14,
+  0x8D, 0x7A, 0x21, 0x62, 0x93, 0x6D, 0x31, 0x19, 0x62, 0x43, 0xE1, 0x45, 0x91, 0x2A, 0xA4, 0x00,
+  0xF7, 0x9D, 0x26, 0x22, 0xCC, 0x46, 0xCE, 0x19, 0xBA, 0x1A, 0x57, 0x60, 0x3A, 0x0B, 0x7D, 0xB3,
+  0x7F, 0xA3, 0x60, 0xDB, 0xE3, 0xA5, 0xEC, 0xDB, 0x1F, 0x7A, 0x8F, 0x83, 0x30, 0x65, 0xA9, 0x63,
+  0xB9, 0xC4, 0xB2, 0xC2, 0x92, 0x38, 0x40, 0x83, 0x98, 0xBE, 0xDE, 0xDD, 0xA3, 0xF2, 0x61, 0xA4,
+  0x6A, 0x80, 0xB7, 0xC6, 0x00, 0x9B, 0x17, 0x9C, 0xA0, 0xFC, 0xE9, 0x9C, 0xBC, 0xDB, 0xF4, 0x95,
+  0xF6, 0x53, 0xF2, 0xD1, 0x34, 0x55, 0xD3, 0x64, 0xFA, 0x21, 0x09, 0x96, 0xC1, 0xAD, 0x04, 0xAA,
+  0xD9, 0xF5, 0x0C, 0x4A, 0x43, 0x64, 0x77, 0xD2, 0xAE, 0xEA, 0x94, 0xF6, 0xA8, 0x21, 0xBA, 0x30,
+  0xE7, 0x97, 0xA1, 0xE0, 0x13, 0xD1, 0xF2, 0xCF, 0xD0, 0x39, 0x01, 0x77, 0x94, 0x54, 0x77, 0xD0,
+  0x91, 0xFB, 0x01, 0xD8, 0x56, 0x12, 0x3A, 0x1A, 0xF6, 0x02, 0x1C, 0x52, 0x81, 0x61, 0x56, 0x00,
+  0xAD, 0x3A, 0xB5, 0xD3, 0x38, 0xC0, 0xB0, 0x07, 0x3B, 0xDC, 0x95, 0xDC, 0xAD, 0xD2, 0xD9, 0xC3,
+  0xDB, 0x2C, 0x5C, 0x3C, 0xD4, 0x3C, 0xC7, 0x57, 0x44, 0x1B, 0x19, 0x08, 0xBE, 0x29, 0xC0, 0xA9,
+  0xEA, 0xF0, 0x74, 0xE5, 0xD6, 0x46, 0xD1, 0xE9, 0x46, 0xB5, 0x22, 0xB8, 0xEF, 0x22, 0x6F, 0x4B,
+  0xF7, 0xC5, 0xFD, 0x67, 0xB0, 0xE4, 0x6C, 0x39, 0x55, 0x15, 0x21, 0x2B, 0x81, 0x7B, 0x12, 0x6E,
+  0x2E, 0x1F, 0x7E, 0xDE, 0xBB, 0x03, 0x7D, 0x1F, 0x52, 0xAD, 0x7D, 0x49, 0x00, 0x46, 0xDA, 0x8D,
+  0xDD, 0x00, 0x19, 0xC9, 0xB9, 0x8F, 0x9A, 0xB6, 0x0A, 0x73, 0x1A, 0x20, 0xAB, 0x47, 0xEB, 0x6F,
+  0xC9, 0xF5, 0x19, 0xC9, 0xC1, 0x4F, 0x66, 0x80, 0x4F, 0x07, 0x8A, 0x1B, 0x1C, 0xAF, 0xA2, 0x24,
+  0xB0, 0xD0, 0xBF, 0x36, 0x87, 0xEE, 0x67, 0x5D, 0x5D, 0x46, 0xCA, 0x84, 0x08, 0x60, 0xDE, 0x2B,
+  0x9E, 0x94, 0x42, 0x72, 0xC3, 0x22, 0xE5, 0x60, 0x1C, 0x91, 0x69, 0x91, 0x4F, 0xC5, 0x19, 0x11,
+  0x24, 0x60, 0x7A, 0x17, 0xAA, 0x38, 0x7A, 0x18, 0x46, 0xC4, 0xC1, 0x8C, 0x0B, 0x09, 0xD4, 0xA7,
+  0xE4, 0x84, 0x18, 0x07, 0x93, 0x9B, 0xB9, 0x60, 0x00, 0xF9, 0x51, 0xDB, 0x9F, 0x4A, 0x82, 0x49,
+  0xE4, 0xF0, 0xA0, 0x56, 0x58, 0x78, 0xEA, 0x77, 0xA1, 0x52, 0xC7, 0x60, 0xF6, 0x02, 0xBD, 0xAD,
+  0xEA, 0xA5, 0xE9, 0xDF, 0x1C, 0x46, 0xFB, 0xD7, 0x3C, 0x81, 0x9A, 0x08, 0xB8, 0xF5, 0x87, 0xC0,
+  0xAB, 0x5D, 0xFA, 0x2A, 0x77, 0x62, 0x3D, 0x08, 0x43, 0x29, 0x44, 0x2F, 0x21, 0x84, 0xCA, 0xFB,
+  0x46, 0x5F, 0x98, 0xA7, 0xB9, 0xA2, 0x52, 0x41, 0xB3, 0x70, 0x3B, 0x8B, 0x98, 0x7F, 0xA3, 0x8E,
+  0x9A, 0x05, 0x5F, 0x4A, 0x31, 0x67, 0xDE, 0x45, 0x68, 0x02, 0x75, 0x38, 0x62, 0x81, 0x81, 0x18,
+  0x13, 0x63, 0x47, 0xCC, 0xDD, 0x8D, 0x54, 0x49, 0x76, 0x9E, 0x8E, 0x9C, 0x82, 0x7E, 0x23, 0x5E,
+  0x28, 0xA2, 0x5F, 0xEF, 0x60, 0x80, 0x7A, 0xBB, 0x4E, 0xEF, 0xB0, 0x80, 0xA6, 0x55, 0x2C, 0x7B,
+  0x3F, 0x47, 0x3F, 0xA7, 0x30, 0xC0, 0xF4, 0x7E, 0xAA, 0x21, 0xB8, 0x24, 0xC9, 0x64, 0xE4, 0xE8,
+  0xD6, 0xDD, 0x55, 0x2C, 0x2C, 0xB1, 0x41, 0x8F, 0xF5, 0x4E, 0xB0, 0xE5, 0x0D, 0x12, 0x40, 0x7E,
+  0x8C, 0x8D, 0xAF, 0x40, 0x94, 0x93, 0x54, 0x95, 0x54, 0x30, 0x48, 0x49, 0xC3, 0x97, 0x64, 0xF0,
+  0xAE, 0x4A, 0xB8, 0xE2, 0x73, 0x88, 0xDA, 0x59, 0x5F, 0xE3, 0x2F, 0x52, 0x1E, 0x23, 0x8F, 0x39,
+  0xCD, 0x0A, 0x6D, 0x34, 0xA9, 0xF2, 0x16, 0x5F, 0x1D, 0x29, 0x7B, 0x08, 0xDC, 0x7F, 0x7C, 0x4C,
+  0x61, 0x98, 0x68, 0xDA, 0x9B, 0x7A, 0x64, 0xB0, 0x19, 0x23, 0x4F, 0x76, 0x3E, 0x7A, 0x4A, 0xC2,
+  0x3C, 0x5B, 0x7E, 0x5D, 0xDA, 0xFC, 0xC8, 0x2E, 0xC6, 0xFB, 0x95, 0x4C, 0x7D, 0x96, 0xAF, 0xC3,
+  0x51, 0xF9, 0x00, 0x31, 0x89, 0x1D, 0x27, 0xD3, 0x82, 0x9D, 0x42, 0xDE, 0xB8, 0x9B, 0x68, 0xE0,
+  0x36, 0xCB, 0x31, 0x42, 0xBC, 0xB7, 0x20, 0xBE, 0x97, 0xB6, 0x49, 0x2E, 0x3A, 0xB9, 0x9E, 0x23,
+  0xBC, 0x54, 0x36, 0xDE, 0xA9, 0x52, 0x55, 0xD3, 0x63, 0x9F, 0x2A, 0x2E, 0x3F, 0x65, 0xCE, 0x42,
+  0x1C, 0x39, 0x16, 0x44, 0x8B, 0xE0, 0x90, 0xE0, 0x37, 0xC6, 0x1F, 0xE7, 0xE6, 0x94, 0x25, 0x4E,
+  0x34, 0xE0, 0x34, 0x08, 0x04, 0x47, 0x8B, 0x38, 0x00, 0x46, 0x9A, 0x71, 0x42, 0xFD, 0x74, 0x7C,
+  0x48, 0x87, 0xB5, 0x99, 0xF0, 0x8C, 0xBC, 0xF9, 0xF1, 0xAE, 0x1E, 0x8E, 0x51, 0x46, 0x86, 0x21,
+  0xC7, 0x68, 0xB4, 0x24, 0xB1, 0x4A, 0xF6, 0x4A, 0xCF, 0xBB, 0xF6, 0x16, 0x37, 0x62, 0x16, 0x17,
+  0x0C, 0x31, 0xFC, 0x3F, 0x30, 0xF8, 0x62, 0x76, 0x78, 0x24, 0x62, 0x76, 0x78, 0x32, 0x00, 0x10,
+  0x00, 0x00, 0x5C, 0x00, 0x00, 0x03, 0x00, 0x97, 0x01, 0x30, 0xD7, 0x59, 0xEF, 0xD5, 0xD4, 0xD6,
+  0x02, 0x50, 0xAB, 0x00, 0x00, 0x00, 0x3F, 0x24, 0x70, 0x00, 0x1F, 0x82, 0x88, 0x08, 0x08, 0x02,
+  0x02, 0xD0, 0x71, 0x77, 0x91, 0x66, 0xAD, 0x59, 0x97, 0x00, 0x60, 0xB5, 0x6B, 0xF6, 0x60, 0xEF,
+  0x7D, 0x75, 0x31, 0xE7, 0xD5, 0xC9, 0xC9, 0xC1, 0x1B, 0x70, 0x73, 0x31, 0xCF, 0x6E, 0x4E, 0x6E,
+  0x4E, 0x6E, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xC0, 0x7F, 0xF0, 0x09, 0xBC, 0x0A, 0xE7, 0x1F, 0xC8, 0xCD, 0xCD, 0xCD, 0x7F,
+  0xC0, 0x7F, 0xF0, 0x1F, 0x9C, 0x7F, 0x02, 0x1F, 0xC4, 0x53, 0xC0, 0xD7, 0x70, 0xFE, 0x14, 0x9C,
+  0x7F, 0x02, 0x70, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x6D, 0x7B, 0x6E, 0xA2, 0xC0, 0xF2, 0xEF, 0x28,
+  0xA4, 0x35, 0x1C, 0x7F, 0x57, 0x03, 0x3A, 0x22, 0xFC, 0xC9, 0xD1, 0xC4, 0x3B, 0x5E, 0x15, 0xAA,
+  0xAE, 0x49, 0x08, 0x90, 0xA8, 0x9B, 0x44, 0xF2, 0x02, 0xAE, 0xC1, 0x11, 0x35, 0xD5, 0x0C, 0xC3,
+  0x60, 0xAF, 0x02, 0xF4, 0x02, 0x13, 0x80, 0x5C, 0x85, 0x0F, 0x26, 0xBC, 0x35, 0x94, 0xE5, 0x74,
+  0x24, 0x6D, 0xC7, 0x24, 0x45, 0x1B, 0xB2, 0xBD, 0xAB, 0xC4, 0xE1, 0xDD, 0xEE, 0xDC, 0x83, 0xEE,
+  0x2F, 0x31, 0x17, 0xC0, 0x64, 0xE7, 0x82, 0x15, 0x61, 0xC1, 0x9C, 0x0B, 0xBD, 0xF2, 0x7C, 0xE6,
+  0xAE, 0x69, 0xD4, 0xA3, 0x28, 0x18, 0xC6, 0xD0, 0x5A, 0x38, 0xE0, 0xC4, 0x97, 0x15, 0x0D, 0xC8,
+  0x02, 0x7F, 0x9A, 0xD3, 0xC5, 0x28, 0xE0, 0xDA, 0xF9, 0xAC, 0x73, 0x78, 0x72, 0xCC, 0xF2, 0xB0,
+  0xD7, 0x33, 0x26, 0xEC, 0xE0, 0x80, 0xBE, 0x49, 0x8F, 0x71, 0x3E, 0x4B, 0x3B, 0x2E, 0x65, 0xD7,
+  0xA8, 0x34, 0xB0, 0x08, 0xD9, 0xFD, 0xBD, 0x00, 0x07, 0xFF, 0x8C, 0xEB, 0xFB, 0x58, 0x86, 0x9D,
+  0x85, 0x99, 0xBC, 0xFE, 0x3B, 0x2C, 0xF3, 0x42, 0x11, 0x98, 0xDE, 0xB9, 0x4E, 0x3B, 0xA9, 0x98,
+  0x7E, 0x4F, 0x7E, 0xED, 0x01, 0xAC, 0x87, 0x41, 0xB8, 0xC9, 0x86, 0x05, 0xC0, 0xC5, 0x34, 0x89,
+  0x32, 0x06, 0x95, 0x18, 0x51, 0x46, 0xAB, 0x2A, 0xD5, 0xBA, 0x85, 0xD3, 0xA0, 0x0F, 0x76, 0x68,
+  0x85, 0x00, 0x7A, 0xCC, 0xC5, 0x5D, 0x36, 0x16, 0xAB, 0x86, 0x25, 0xE5, 0xDC, 0xB3, 0x23, 0x1D,
+  0x8A, 0x8C, 0x39, 0x05, 0xD6, 0x77, 0x73, 0x18, 0x0D, 0xC0, 0x48, 0xB5, 0x0A, 0xED, 0x17, 0x55,
+  0xB7, 0x8E, 0x04, 0x83, 0xE2, 0x20, 0xDB, 0xC8, 0x28, 0xD7, 0x4C, 0x03, 0xAF, 0x5D, 0x2E, 0x10,
+  0xA9, 0x32, 0xAD, 0xDB, 0x5A, 0xDE, 0x8C, 0x8D, 0xC3, 0x51, 0x6C, 0xE1, 0x4A, 0x96, 0x68, 0x24,
+  0xFA, 0x52, 0x1F, 0x63, 0xB5, 0xD3, 0xDA, 0x0B, 0xDE, 0xAA, 0xDA, 0x5E, 0xB8, 0x52, 0x14, 0xE2,
+  0x9A, 0xAD, 0x6F, 0x0A, 0x81, 0x38, 0x79, 0x5C, 0x4F, 0xCD, 0x01, 0x03, 0x28, 0x34, 0xBF, 0x71,
+  0x0D, 0x9C, 0xE6, 0xC4, 0x37, 0xBF, 0xF0, 0xB2, 0xCF, 0x0E, 0x0C, 0xF4, 0x01, 0xC9, 0xDD, 0xA6,
+  0x45, 0xF3, 0x71, 0x39, 0x5B, 0x1E, 0x1D, 0x65, 0xB9, 0xCE, 0x73, 0x7A, 0xDA, 0xD3, 0xF2, 0xF2,
+  0x03, 0x9C, 0x99, 0x58, 0x35, 0xEF, 0x83, 0x06, 0x55, 0x28, 0x4F, 0x82, 0xD8, 0x7B, 0x36, 0x41,
+  0x27, 0x2F, 0xD5, 0x4C, 0x14, 0x24, 0xAE, 0xE3, 0x10, 0x2C, 0xF3, 0xF8, 0x59, 0xE6, 0xA4, 0xCC,
+  0x0D, 0xC9, 0xB9, 0xD3, 0xEA, 0xCE, 0x1A, 0x02, 0x87, 0xA0, 0x64, 0x97, 0x08, 0x63, 0xE5, 0xD8,
+  0x6B, 0xAA, 0x5C, 0xDE, 0x21, 0xB1, 0x7F, 0xEC, 0xFF, 0xF0, 0xB6, 0x49, 0xD3, 0xD0, 0xE6, 0x95,
+  0xB2, 0x2D, 0x1A, 0xF7, 0x63, 0xB8, 0x6E, 0x58, 0x7D, 0xFE, 0x26, 0xCA, 0xE4, 0x26, 0x70, 0x51,
+  0xFD, 0xF7, 0xCE, 0x63, 0x5F, 0x97, 0x24, 0xBC, 0x9C, 0x29, 0x5C, 0xF7, 0xED, 0x28, 0x92, 0x31,
+  0x11, 0xAA, 0x59, 0xEE, 0xE9, 0x84, 0x6D, 0x8F, 0x5E, 0x0F, 0x27, 0xA1, 0x22, 0x0D, 0x6B, 0x32,
+  0x98, 0xCE, 0x0B, 0x22, 0x02, 0x4A, 0xE9, 0xD0, 0xEC, 0x6B, 0x2A, 0xA6, 0x7E, 0x09, 0x11, 0x4E,
+  0xD3, 0xC5, 0x35, 0x28, 0x24, 0x94, 0xE3, 0xDD, 0xA5, 0x78, 0x62, 0x57, 0xFC, 0x47, 0x89, 0x11,
+  0x80, 0xD5, 0x4E, 0x53, 0xEF, 0x12, 0xA4, 0x98, 0xB5, 0x98, 0xF0, 0x9B, 0x03, 0x2A, 0x38, 0xF3,
+  0xF1, 0x60, 0xDA, 0x15, 0x17, 0x41, 0xB9, 0xE4, 0xFE, 0xFC, 0xCA, 0x6D, 0x56, 0x94, 0xA7, 0x63,
+  0x57, 0x63, 0xA1, 0xC2, 0xB9, 0xF2, 0xF7, 0xF7, 0x88, 0x48, 0xA6, 0x07, 0xC8, 0x6E, 0x1F, 0x8F,
+  0x8C, 0x33, 0xC6, 0xC8, 0x88, 0x66, 0xE2, 0x40, 0x0E, 0x15, 0xBC, 0x05, 0xB3, 0xDB, 0x06, 0x0E,
+  0x50, 0x29, 0x6A, 0xF0, 0xB0, 0xB9, 0x72, 0x8C, 0x21, 0x7F, 0x6C, 0x1A, 0xD0, 0xA8, 0x6A, 0xD0,
+  0xD0, 0x94, 0x05, 0x95, 0xC6, 0x7B, 0x79, 0x38, 0x71, 0x19, 0xC2, 0x10, 0x6B, 0x0F, 0xB0, 0x4E,
+  0xFC, 0x6D, 0xB7, 0x0E, 0x0A, 0x83, 0xA8, 0xAB, 0x6B, 0x67, 0x20, 0x7C, 0x3B, 0x63, 0x42, 0x82,
+  0x9F, 0x30, 0xF8, 0x5D, 0xBD, 0x37, 0x2F, 0x1B, 0x23, 0x1C, 0x76, 0x15, 0xF9, 0x2B, 0x6D, 0x7D,
+  0xBC, 0x04, 0x47, 0x09, 0xB0, 0x9D, 0x15, 0x8D, 0x8F, 0xA2, 0x1D, 0x4C, 0xA9, 0x7E, 0x03, 0x3B,
+  0x66, 0x10, 0x38, 0xD2, 0xE7, 0xA8, 0x8D, 0xF9, 0x2F, 0xE2, 0x28, 0x26, 0x9B, 0xD8, 0x51, 0xE6,
+  0x8A, 0x23, 0xEC, 0xEE, 0x38, 0x1D, 0xD1, 0x17, 0xE4, 0xEA, 0x79, 0x22, 0xEC, 0x39, 0x23, 0x94,
+  0x98, 0x3B, 0x46, 0x0C, 0x84, 0x07, 0xA2, 0xB8, 0xDF, 0x80, 0x19, 0x7B, 0x53, 0x3D, 0x30, 0xA8,
+  0xD6, 0xEA, 0x46, 0x08, 0xB6, 0x0C, 0x72, 0x1E, 0xB4, 0xA6, 0x51, 0xCA, 0xBF, 0xD8, 0x82, 0xC0,
+  0xA1, 0xC7, 0x18, 0xAC, 0x8D, 0xBF, 0xB5, 0xEE, 0x3D, 0xE6, 0x59, 0x1D, 0x05, 0x9E, 0x64, 0xD4,
+  0xCE, 0xCD, 0x19, 0xF0, 0xCC, 0xF1, 0x13, 0xF5, 0x10, 0x55, 0xBA, 0x23, 0x90, 0xE3, 0x12, 0xF9,
+  0x07, 0x46, 0x1B, 0xC4, 0x41, 0xC1, 0xF1, 0x73, 0x33, 0x39, 0x14, 0x0F, 0xFC, 0x74, 0x57, 0x94,
+  0xB5, 0x32, 0x91, 0x42, 0xDE, 0x90, 0x73, 0x11, 0x6D, 0x58, 0xA0, 0x21, 0x39, 0xB8, 0x19, 0x80,
+  0xB9, 0x08, 0x65, 0x76, 0x62, 0x97, 0xF4, 0x4F, 0xC4, 0x0F, 0x79, 0x8E, 0x63, 0x05, 0x80, 0x80,
+  0xD2, 0x2B, 0xD8, 0x4A, 0x22, 0x70, 0x1F, 0xA3, 0x01, 0x90, 0x0A, 0x62, 0x76, 0x78, 0x24, 0x3C,
+  0x3F, 0x78, 0x6D, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E,
+  0x30, 0x22, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x69, 0x6E, 0x67, 0x3D, 0x22, 0x55, 0x54, 0x46,
+  0x2D, 0x38, 0x22, 0x3F, 0x3E, 0x0A, 0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20,
+  0x70, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x50, 0x55, 0x42, 0x4C, 0x49, 0x43, 0x20, 0x22, 0x2D, 0x2F,
+  0x2F, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x2F, 0x2F, 0x44, 0x54, 0x44, 0x20, 0x50, 0x4C, 0x49, 0x53,
+  0x54, 0x20, 0x31, 0x2E, 0x30, 0x2F, 0x2F, 0x45, 0x4E, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70,
+  0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2E, 0x63, 0x6F, 0x6D,
+  0x2F, 0x44, 0x54, 0x44, 0x73, 0x2F, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4C, 0x69,
+  0x73, 0x74, 0x2D, 0x31, 0x2E, 0x30, 0x2E, 0x64, 0x74, 0x64, 0x22, 0x3E, 0x0A, 0x3C, 0x70, 0x6C,
+  0x69, 0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30,
+  0x22, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E,
+  0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2D, 0x66, 0x6F, 0x72, 0x6B, 0x3C, 0x2F, 0x6B,
+  0x65, 0x79, 0x3E, 0x0A, 0x09, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x3C, 0x6B,
+  0x65, 0x79, 0x3E, 0x62, 0x6C, 0x6B, 0x78, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09,
+  0x3C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x3C, 0x64, 0x69, 0x63, 0x74,
+  0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x41, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x75, 0x74, 0x65, 0x73, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x30, 0x78, 0x30, 0x30, 0x35, 0x30, 0x3C, 0x2F,
+  0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79,
+  0x3E, 0x43, 0x46, 0x4E, 0x61, 0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09,
+  0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46, 0x69, 0x78, 0x74, 0x75, 0x72,
+  0x65, 0x20, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x44, 0x61, 0x74, 0x61, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E,
+  0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x64, 0x61, 0x74, 0x61, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x62, 0x57, 0x6C, 0x7A, 0x61, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49,
+  0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49,
+  0x41, 0x41, 0x41, 0x41, 0x67, 0x38, 0x63, 0x6A, 0x56, 0x6A, 0x77, 0x41, 0x41, 0x0A, 0x09, 0x09,
+  0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A,
+  0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x44, 0x67, 0x41, 0x41, 0x41, 0x42, 0x77, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x44, 0x71, 0x6F, 0x41, 0x41, 0x41, 0x41, 0x63, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x67, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41,
+  0x41, 0x4F, 0x71, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x37, 0x58, 0x2F, 0x2F,
+  0x2F, 0x2F, 0x2F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x48, 0x58, 0x77, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x2F, 0x64,
+  0x61, 0x74, 0x61, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x49, 0x44,
+  0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69,
+  0x6E, 0x67, 0x3E, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09,
+  0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x4E, 0x61, 0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65, 0x79,
+  0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46, 0x69,
+  0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E,
+  0x0A, 0x09, 0x09, 0x09, 0x3C, 0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x3C, 0x2F,
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x3E, 0x0A, 0x09, 0x3C, 0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A,
+  0x3C, 0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x3E,
+  0x0A, 0x6B, 0x6F, 0x6C, 0x79, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0xE2, 0xCE, 0x30, 0x37, 0x09, 0x70, 0x5F, 0x5E, 0x56, 0xB5, 0x33, 0x1A, 0x2C, 0xD0, 0xC3,
+  0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x1F, 0x3C, 0x20, 0x7C, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x01, 0x6A, 0xC6, 0xCD, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+};
+
+// ulfo-lzfse-v1
+STATIC CONST UINT8  mFixture3[] = {
+  0x62, 0x76, 0x78, 0x31, 0x00, 0x10, 0x00, 0x00, 0xF7, 0x02, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x8A, 0x01, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xC4, 0x02, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
+  0x38, 0x02, 0x4C, 0x01, 0x49, 0x03, 0x9F, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x1D, 0x00,
+  0x0E, 0x00, 0x39, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00,
+  0x06, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x00, 0x02, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x03, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x03, 0x00,
+  0x05, 0x00, 0x0C, 0x00, 0x09, 0x00, 0x0C, 0x00, 0x09, 0x00, 0x0B, 0x00, 0x0D, 0x00, 0x0A, 0x00,
+  0x0B, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x05, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x08, 0x00, 0x0B, 0x00,
+  0x07, 0x00, 0x22, 0x00, 0x09, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x20, 0x00, 0x40, 0x00, 0x20, 0x00, 0x9D, 0x00, 0x0A, 0x00,
+  0x0A, 0x00, 0x0A, 0x00, 0x35, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x35, 0x00, 0x15, 0x00, 0x20, 0x00,
+  0x55, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x60, 0x00, 0x15, 0x00, 0x2A, 0x00, 0x15, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x15, 0xBE, 0x45, 0x63, 0xD5, 0x6A, 0x80, 0x2D, 0xF4,
+  0xA5, 0xD0, 0x86, 0x1E, 0xE7, 0x57, 0x95, 0xA4, 0x15, 0x68, 0x0E, 0x9E, 0x2A, 0xEB, 0x89, 0x69,
+  0x81, 0x64, 0x38, 0xAD, 0xD2, 0x18, 0x86, 0xC0, 0x13, 0x6C, 0xDD, 0x02, 0xC5, 0x46, 0x76, 0x0F,
+  0x64, 0x4C, 0xC2, 0xA7, 0xC0, 0x11, 0x00, 0x0C, 0x00, 0x00, 0x83, 0x78, 0x43, 0x46, 0x5F, 0x8F,
+  0x34, 0xB5, 0x33, 0xE1, 0x6B, 0x6C, 0xC0, 0x6B, 0x08, 0xEF, 0x7E, 0x8E, 0x1B, 0x76, 0x81, 0x83,
+  0x96, 0x19, 0x3E, 0x03, 0x27, 0x58, 0x2A, 0x13, 0x8B, 0xE3, 0x31, 0x5C, 0xF2, 0xDA, 0x32, 0xC9,
+  0xEC, 0x45, 0xD5, 0x2F, 0xA9, 0x2E, 0x20, 0x1A, 0xF5, 0x72, 0xB4, 0x24, 0x93, 0x63, 0x32, 0xCE,
+  0x86, 0x4E, 0xCB, 0xE1, 0x54, 0xC6, 0x00, 0x25, 0x9D, 0x8E, 0xF5, 0x93, 0x91, 0x6F, 0x01, 0x55,
+  0x8B, 0x2B, 0x33, 0x95, 0x8B, 0xBE, 0xF1, 0xBF, 0xD7, 0xAF, 0xA0, 0x61, 0x19, 0xB3, 0xED, 0x4F,
+  0xBD, 0xEF, 0x18, 0x70, 0x59, 0xED, 0x48, 0x2E, 0xF1, 0xAC, 0x84, 0xE0, 0x0F, 0xCC, 0x38, 0xA6,
+  0xDF, 0x77, 0x77, 0x50, 0x39, 0x31, 0x52, 0x25, 0x80, 0xBB, 0xC6, 0x0C, 0x7B, 0x1D, 0x9C, 0x52,
+  0x3E, 0x77, 0x0E, 0xDF, 0xEB, 0xFB, 0x4A, 0xFE, 0x29, 0xD1, 0xE8, 0x9D, 0x9A, 0x6C, 0xF2, 0xF5,
+  0x9C, 0xC4, 0x82, 0xC1, 0xAE, 0xE4, 0xA0, 0xD1, 0xFC, 0x8A, 0x0B, 0xDB, 0x63, 0x37, 0xD2, 0x9E,
+  0xE0, 0x94, 0xE5, 0x91, 0x43, 0x6C, 0x61, 0x4E, 0xAF, 0x4A, 0xC1, 0x86, 0xA2, 0xFD, 0x1E, 0xA3,
+  0x71, 0x02, 0x4E, 0x29, 0x29, 0xE8, 0x20, 0x27, 0xD7, 0x83, 0xCF, 0x6D, 0x54, 0x64, 0xB4, 0xEB,
+  0x85, 0x3B, 0x22, 0x04, 0xFF, 0x6C, 0x30, 0x4A, 0xE1, 0xB4, 0x52, 0xE3, 0x06, 0xC1, 0x0E, 0xE4,
+  0x50, 0x59, 0x72, 0xBA, 0x3A, 0x67, 0xAF, 0xA7, 0x58, 0x78, 0x7A, 0x28, 0x7B, 0x0E, 0x59, 0x11,
+  0x61, 0x24, 0x58, 0xF8, 0xA4, 0x78, 0xA7, 0x28, 0xC5, 0xD3, 0x90, 0x4B, 0x99, 0xA3, 0x32, 0x8C,
+  0x6A, 0xB5, 0x70, 0xDF, 0x4B, 0x9E, 0x97, 0xEA, 0x8B, 0x7B, 0x4F, 0xA8, 0xC4, 0x64, 0x99, 0x6A,
+  0xCA, 0x90, 0xC5, 0x80, 0x1D, 0x12, 0x76, 0x2E, 0x9F, 0x7F, 0x3E, 0x3B, 0x73, 0x7D, 0x25, 0x63,
+  0x1A, 0xFB, 0x8A, 0x02, 0x04, 0xDA, 0x6D, 0xDC, 0xE0, 0x19, 0x89, 0xB8, 0x0F, 0x9E, 0x76, 0x0B,
+  0x31, 0x1B, 0x18, 0x41, 0x8F, 0x86, 0xBF, 0x82, 0xEB, 0x6F, 0x92, 0x01, 0x9D, 0xAC, 0x01, 0xCF,
+  0x8E, 0x83, 0xD7, 0x9D, 0xAE, 0x9A, 0x2A, 0xAC, 0xB0, 0xEF, 0xF6, 0x86, 0xEE, 0x6D, 0x3D, 0x43,
+  0x46, 0x82, 0x84, 0x06, 0x5F, 0x6F, 0x15, 0x52, 0x4A, 0xE1, 0xB9, 0xC1, 0x91, 0x32, 0x60, 0x24,
+  0x91, 0x88, 0xC8, 0xAB, 0xE2, 0x83, 0xC8, 0xD3, 0x67, 0xBD, 0x6A, 0x55, 0x8C, 0xFE, 0xBD, 0x11,
+  0x49, 0xB0, 0x70, 0x1F, 0xA1, 0xFA, 0x9A, 0x98, 0xF0, 0x12, 0x40, 0x40, 0x23, 0x1E, 0xCC, 0x81,
+  0xBF, 0xC9, 0xFB, 0xA3, 0x04, 0x9F, 0x44, 0x09, 0xCF, 0x6B, 0x05, 0x87, 0xA7, 0x74, 0x97, 0x2D,
+  0x75, 0x0C, 0x56, 0x3B, 0xD0, 0xC1, 0x6A, 0x7A, 0x9A, 0xD6, 0xCD, 0x6F, 0xB4, 0x7B, 0xCD, 0x1B,
+  0xA8, 0xE9, 0x40, 0x73, 0x6F, 0x38, 0x3C, 0xF2, 0xA5, 0xBB, 0x72, 0x4A, 0xCA, 0x07, 0x0F, 0x74,
+  0x62, 0x74, 0x12, 0x42, 0x28, 0xBE, 0xEF, 0xF5, 0x85, 0x7C, 0xFA, 0x11, 0x95, 0x49, 0x9A, 0x05,
+  0xD9, 0xC8, 0x84, 0xAC, 0x13, 0xF4, 0xDB, 0x24, 0xD0, 0x12, 0x98, 0x39, 0xFF, 0xAE, 0x43, 0x0B,
+  0xAB, 0x43, 0x13, 0x0B, 0x0F, 0xA3, 0x88, 0xB0, 0x9C, 0x11, 0x7D, 0xF3, 0x51, 0x95, 0xDA, 0x79,
+  0x70, 0x24, 0x05, 0xF4, 0x17, 0xF1, 0x41, 0xF1, 0xF8, 0x76, 0x09, 0x83, 0x55, 0xDB, 0x55, 0x7A,
+  0x87, 0x85, 0x35, 0xDD, 0x5A, 0xD9, 0x77, 0x3B, 0x78, 0x71, 0x0A, 0x04, 0xCA, 0xDE, 0xAD, 0xD6,
+  0x81, 0x09, 0x93, 0x0A, 0x8C, 0x24, 0x5D, 0x1A, 0xBB, 0x98, 0xFD, 0xC0, 0x7B, 0xEF, 0x91, 0xCA,
+  0xF9, 0xA5, 0x7A, 0x00, 0x11, 0x63, 0x85, 0xD4, 0xE8, 0x0B, 0x24, 0xF9, 0x50, 0x55, 0x25, 0xBA,
+  0x21, 0x4A, 0xD6, 0x3E, 0x24, 0x83, 0xBB, 0xA6, 0xE1, 0x6A, 0xCE, 0x3D, 0x4A, 0xC3, 0xFA, 0x1C,
+  0x7F, 0x9D, 0xF2, 0x1E, 0xF5, 0x8D, 0x19, 0xD4, 0x6B, 0xA2, 0x45, 0x15, 0x87, 0xF8, 0xE8, 0x66,
+  0xD9, 0x03, 0xE1, 0x2E, 0xD3, 0x65, 0x09, 0xC3, 0x43, 0xD3, 0xD6, 0xD2, 0x96, 0xE0, 0x65, 0x8D,
+  0x2C, 0xDF, 0xF9, 0xEB, 0x27, 0x09, 0xCB, 0x28, 0xFB, 0x71, 0x69, 0xA3, 0x9B, 0xF2, 0x40, 0x9E,
+  0xA7, 0xC2, 0xE9, 0xB1, 0x7C, 0x1F, 0x7D, 0xAA, 0x07, 0x68, 0x79, 0x6C, 0x1C, 0x4C, 0x49, 0x76,
+  0x09, 0x79, 0x60, 0x6E, 0xA0, 0x41, 0x5B, 0x2C, 0xCA, 0x00, 0xF1, 0xDE, 0x62, 0xF0, 0xCE, 0xED,
+  0x82, 0x4C, 0xF9, 0x58, 0x6D, 0x12, 0x1D, 0xEB, 0x1A, 0xED, 0x17, 0xA9, 0xA8, 0xA9, 0xB1, 0x0E,
+  0xF5, 0x78, 0x9F, 0x2A, 0x64, 0x80, 0x7E, 0x88, 0x84, 0xC9, 0x2E, 0x36, 0x02, 0x7A, 0x32, 0xF4,
+  0x01, 0x4E, 0x5C, 0xD5, 0x63, 0x84, 0x00, 0xA1, 0x50, 0x10, 0xF8, 0x41, 0xC0, 0x01, 0x2E, 0xC2,
+  0x8C, 0x13, 0xA8, 0xC3, 0x61, 0x43, 0x32, 0xAD, 0x6C, 0x3A, 0x31, 0xD2, 0xE0, 0xA6, 0x59, 0x4D,
+  0xB4, 0xC6, 0x88, 0x98, 0x46, 0x1C, 0xA1, 0x91, 0xAA, 0xC0, 0x40, 0x71, 0x47, 0x3C, 0xE7, 0xEF,
+  0x2B, 0x32, 0x01, 0x07, 0x09, 0x06, 0x98, 0xFF, 0xCD, 0x0D, 0x3E, 0x62, 0x76, 0x78, 0x24, 0x62,
+  0x76, 0x78, 0x31, 0x00, 0x10, 0x00, 0x00, 0x09, 0x03, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x97,
+  0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xD9, 0x02, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xD7,
+  0x01, 0xD6, 0x03, 0x5E, 0x01, 0x53, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x07,
+  0x00, 0x39, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x04, 0x00, 0x09, 0x00, 0x09, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x05,
+  0x00, 0x05, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x03, 0x00, 0x05, 0x00, 0x06, 0x00, 0x03, 0x00, 0x08, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x0D, 0x00, 0x09, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x08,
+  0x00, 0x1E, 0x00, 0x0B, 0x00, 0x09, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0B, 0x00, 0x0A, 0x00, 0x0B,
+  0x00, 0x0A, 0x00, 0x0B, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x37, 0x00, 0x21, 0x00, 0x42, 0x00, 0x16, 0x00, 0x99, 0x00, 0x0B, 0x00, 0x0B,
+  0x00, 0x0B, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x16, 0x00, 0x21, 0x00, 0x59,
+  0x00, 0x2C, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x16, 0x00, 0x2C, 0x00, 0x16, 0x00, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x6D, 0x7B, 0x6E, 0xA2, 0xC0, 0xF2, 0xEF, 0x28, 0xA4, 0x35,
+  0x1C, 0x7F, 0x57, 0x03, 0x3A, 0x22, 0xFC, 0xC9, 0xD1, 0xC4, 0x3B, 0x5E, 0x15, 0xAA, 0xAE, 0x49,
+  0x08, 0x90, 0xA8, 0x9B, 0x44, 0xF2, 0x02, 0xAE, 0xC1, 0x11, 0x35, 0xD5, 0x0C, 0xC3, 0x60, 0xAF,
+  0x02, 0xF4, 0x02, 0x13, 0x80, 0x5C, 0x0A, 0x5F, 0x4C, 0x08, 0x6B, 0x2A, 0x0B, 0xE9, 0xA8, 0xD9,
+  0x0E, 0x48, 0x8A, 0x33, 0xA4, 0x7B, 0xAC, 0x12, 0x80, 0xB7, 0xBA, 0x7B, 0x0F, 0xB3, 0x5F, 0xC4,
+  0x5C, 0x00, 0x63, 0x9D, 0xAB, 0x2B, 0x42, 0x82, 0xB9, 0x15, 0x7A, 0xDF, 0xF9, 0x9C, 0x5D, 0x13,
+  0xA8, 0x2F, 0x51, 0x30, 0xEC, 0xA1, 0xA9, 0x70, 0x60, 0x89, 0x17, 0x2B, 0x0E, 0x50, 0x0B, 0xFB,
+  0x73, 0x9C, 0x2E, 0x46, 0x01, 0xD4, 0xCE, 0x64, 0x35, 0x07, 0x24, 0x07, 0x2C, 0xAF, 0x7A, 0x7D,
+  0x62, 0x02, 0x0E, 0x0E, 0xE8, 0x0B, 0x69, 0x30, 0x0E, 0x67, 0x5D, 0xC7, 0x8D, 0xEC, 0x0E, 0x95,
+  0x26, 0x8B, 0x97, 0xA5, 0xDF, 0x0B, 0x70, 0x70, 0xCE, 0x38, 0xBD, 0x8F, 0x05, 0xD8, 0x4D, 0x98,
+  0xC9, 0x8B, 0xBF, 0x63, 0x32, 0x7F, 0x8A, 0xC6, 0x74, 0xCE, 0xC5, 0xB4, 0x90, 0x02, 0xD3, 0xC7,
+  0xC9, 0xA3, 0x3D, 0xD0, 0xF5, 0x14, 0x08, 0x31, 0xD9, 0xBA, 0x00, 0xAA, 0x98, 0x23, 0x51, 0xC6,
+  0xA0, 0x1C, 0x43, 0xC9, 0x88, 0x2A, 0x4A, 0xB5, 0x60, 0xE1, 0x28, 0xE8, 0x23, 0x1D, 0x2A, 0x21,
+  0x80, 0x1B, 0xB3, 0x71, 0xB7, 0x8C, 0x05, 0x55, 0xD5, 0x92, 0x7E, 0xEE, 0xDE, 0x91, 0x02, 0x45,
+  0xAE, 0x9C, 0xA2, 0xEB, 0x4B, 0x39, 0x5C, 0x06, 0x60, 0xA4, 0x5A, 0x85, 0xDE, 0x8B, 0x50, 0x97,
+  0x8F, 0x24, 0x82, 0xE2, 0x25, 0xDB, 0xC1, 0x28, 0xCB, 0xCC, 0x01, 0xAF, 0x5D, 0x6E, 0x10, 0x39,
+  0x32, 0x95, 0xDB, 0xFA, 0xDE, 0x90, 0xAD, 0xC2, 0x45, 0x6C, 0xE1, 0x97, 0x3C, 0xD1, 0x5C, 0xF4,
+  0x45, 0x3E, 0xCA, 0x6A, 0xAC, 0xB5, 0x11, 0x3C, 0x54, 0x55, 0xBD, 0x70, 0x8D, 0x28, 0x64, 0x35,
+  0x43, 0xDF, 0xB4, 0x02, 0x55, 0xF2, 0xB5, 0x9E, 0xCF, 0xF1, 0x03, 0xA8, 0x30, 0x5F, 0x71, 0x0D,
+  0x9C, 0xE6, 0xCE, 0x77, 0xBD, 0x30, 0xB2, 0x6F, 0x0E, 0x2C, 0xFA, 0x78, 0xE4, 0x0E, 0xD3, 0xA2,
+  0xF3, 0xB8, 0x3C, 0x2D, 0x2F, 0x8E, 0xF2, 0x5D, 0x27, 0x38, 0x25, 0xED, 0x63, 0xB9, 0xF8, 0x01,
+  0xCE, 0x5C, 0xEC, 0x98, 0xFB, 0x61, 0x82, 0x2A, 0x94, 0x0F, 0x41, 0xE0, 0x7D, 0x36, 0x83, 0x7E,
+  0x5E, 0x8E, 0x99, 0xF8, 0x48, 0xEC, 0xE3, 0xD0, 0x2F, 0xF7, 0x38, 0x5B, 0xE6, 0xA4, 0x90, 0x1B,
+  0x12, 0x70, 0x27, 0xD4, 0xDD, 0x34, 0x44, 0x0D, 0x41, 0xC3, 0x2E, 0xB1, 0xC6, 0x5A, 0xB1, 0xDF,
+  0x94, 0x72, 0x61, 0x87, 0x78, 0xFF, 0xC8, 0xFF, 0xB1, 0x6D, 0x33, 0xA6, 0xE1, 0xCC, 0xFB, 0xB2,
+  0xAD, 0x1B, 0x77, 0x60, 0x38, 0xDC, 0xB0, 0xF8, 0xFC, 0xDD, 0x94, 0x59, 0x4D, 0xE0, 0xE2, 0xFB,
+  0xD3, 0x9D, 0xC7, 0xBE, 0x6E, 0x48, 0xB8, 0x38, 0x53, 0xB2, 0xEE, 0xD5, 0xD1, 0x22, 0xE3, 0x44,
+  0x52, 0xFD, 0x72, 0x48, 0xA7, 0xD9, 0xF4, 0x28, 0xF4, 0x10, 0x12, 0x27, 0xD2, 0xB0, 0xC6, 0x82,
+  0xE9, 0xB9, 0xA0, 0x20, 0xA0, 0x94, 0x0B, 0xCD, 0xBE, 0xA3, 0x62, 0xEA, 0xE7, 0x10, 0xE5, 0xB4,
+  0x59, 0x2C, 0x83, 0x42, 0x42, 0x21, 0xDE, 0x2D, 0x8A, 0x67, 0x77, 0x8D, 0x7F, 0x29, 0x2D, 0x42,
+  0x61, 0x75, 0xD3, 0xAD, 0xF7, 0x08, 0x56, 0x0C, 0x59, 0x4C, 0xF8, 0x9D, 0x01, 0xB5, 0x9C, 0xEB,
+  0x78, 0x2A, 0xED, 0xBE, 0x8B, 0xC0, 0x5D, 0x92, 0x7E, 0xFE, 0xE7, 0x76, 0x29, 0x6A, 0xD3, 0x6D,
+  0x57, 0xB2, 0x40, 0xA1, 0x5D, 0xF9, 0xFB, 0x6F, 0x44, 0xF4, 0xD3, 0x43, 0x66, 0x47, 0x8F, 0x6F,
+  0xC6, 0x15, 0x63, 0x74, 0x44, 0x25, 0x71, 0x60, 0x86, 0x02, 0xBC, 0x84, 0x99, 0xDB, 0x0A, 0x0E,
+  0x74, 0xA9, 0x6A, 0x90, 0xB1, 0xB9, 0x66, 0x8C, 0x3B, 0xFF, 0xD8, 0x74, 0xA0, 0x35, 0xD5, 0xA0,
+  0xA1, 0x23, 0x4B, 0x29, 0x9D, 0xF7, 0xE4, 0x70, 0x77, 0xD9, 0x61, 0xE8, 0xDA, 0xC3, 0xAB, 0x13,
+  0x79, 0xDB, 0xA1, 0x83, 0xD6, 0x20, 0xB2, 0xEA, 0xAA, 0x19, 0xA8, 0xDF, 0xC0, 0x98, 0x21, 0xE5,
+  0x4F, 0x60, 0xFC, 0x92, 0xDE, 0x8F, 0xD7, 0x8C, 0x51, 0x0F, 0x0B, 0x15, 0xFA, 0x6B, 0x6F, 0xBD,
+  0xBE, 0x14, 0x8E, 0x22, 0x70, 0x3B, 0x2C, 0xEA, 0x8F, 0xBA, 0x1D, 0x45, 0xA9, 0xFD, 0x26, 0x3B,
+  0x64, 0x30, 0xB8, 0xA4, 0x0F, 0x51, 0x0B, 0x26, 0xBF, 0xF0, 0x51, 0x4E, 0x1E, 0xB1, 0xAD, 0xC4,
+  0x15, 0x5F, 0x18, 0xDD, 0x59, 0x3A, 0xA7, 0x27, 0x08, 0xD5, 0xC3, 0x09, 0xB1, 0x07, 0x8C, 0x60,
+  0xE2, 0xEA, 0x28, 0x51, 0x20, 0x30, 0x10, 0xC2, 0x7D, 0x0C, 0xA8, 0xB1, 0x30, 0xD5, 0xC3, 0x83,
+  0x6C, 0x3D, 0x6E, 0x84, 0x60, 0xCB, 0x38, 0x67, 0x82, 0xF2, 0xB4, 0x49, 0xF9, 0xD7, 0x5B, 0x10,
+  0x38, 0x94, 0x18, 0x83, 0x7D, 0x03, 0x6F, 0xA1, 0x1B, 0x8F, 0x79, 0xB6, 0x8E, 0x0A, 0xCF, 0x31,
+  0x72, 0x27, 0xE5, 0x14, 0xB8, 0xE6, 0xF1, 0x89, 0x7A, 0x10, 0xD5, 0xBD, 0x13, 0x90, 0xE3, 0x92,
+  0xFD, 0x1F, 0x23, 0x0E, 0xC6, 0xA0, 0xE0, 0xF8, 0xF9, 0x98, 0x34, 0x54, 0x1E, 0xEE, 0xE9, 0xAE,
+  0x2E, 0x0B, 0x65, 0x22, 0x05, 0xDF, 0x9E, 0x93, 0x11, 0xED, 0x58, 0x84, 0x21, 0x59, 0xB8, 0x1A,
+  0x84, 0xB9, 0x18, 0xCA, 0xE0, 0x04, 0x2E, 0xE9, 0x99, 0xA8, 0x9F, 0xE4, 0x21, 0x0E, 0x14, 0x00,
+  0x02, 0x7A, 0xAF, 0x00, 0x2B, 0x89, 0xC0, 0x7D, 0x8C, 0x03, 0x40, 0x2A, 0x62, 0x76, 0x78, 0x24,
+  0x3C, 0x3F, 0x78, 0x6D, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31,
+  0x2E, 0x30, 0x22, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x69, 0x6E, 0x67, 0x3D, 0x22, 0x55, 0x54,
+  0x46, 0x2D, 0x38, 0x22, 0x3F, 0x3E, 0x0A, 0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45,
+  0x20, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x50, 0x55, 0x42, 0x4C, 0x49, 0x43, 0x20, 0x22, 0x2D,
+  0x2F, 0x2F, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x2F, 0x2F, 0x44, 0x54, 0x44, 0x20, 0x50, 0x4C, 0x49,
+  0x53, 0x54, 0x20, 0x31, 0x2E, 0x30, 0x2F, 0x2F, 0x45, 0x4E, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74,
+  0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2E, 0x63, 0x6F,
+  0x6D, 0x2F, 0x44, 0x54, 0x44, 0x73, 0x2F, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4C,
+  0x69, 0x73, 0x74, 0x2D, 0x31, 0x2E, 0x30, 0x2E, 0x64, 0x74, 0x64, 0x22, 0x3E, 0x0A, 0x3C, 0x70,
+  0x6C, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E,
+  0x30, 0x22, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x3C, 0x6B, 0x65, 0x79,
+  0x3E, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2D, 0x66, 0x6F, 0x72, 0x6B, 0x3C, 0x2F,
+  0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x3C,
+  0x6B, 0x65, 0x79, 0x3E, 0x62, 0x6C, 0x6B, 0x78, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09,
+  0x09, 0x3C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x3C, 0x64, 0x69, 0x63,
+  0x74, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x41, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x30, 0x78, 0x30, 0x30, 0x35, 0x30, 0x3C,
+  0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65,
+  0x79, 0x3E, 0x43, 0x46, 0x4E, 0x61, 0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09,
+  0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46, 0x69, 0x78, 0x74, 0x75,
+  0x72, 0x65, 0x20, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09,
+  0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x44, 0x61, 0x74, 0x61, 0x3C, 0x2F, 0x6B, 0x65, 0x79,
+  0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x64, 0x61, 0x74, 0x61, 0x3E, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x62, 0x57, 0x6C, 0x7A, 0x61, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49,
+  0x49, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x49, 0x41, 0x41, 0x41, 0x41, 0x67, 0x38, 0x63, 0x6A, 0x56, 0x6A, 0x77, 0x41, 0x41, 0x0A, 0x09,
+  0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x44, 0x67, 0x41, 0x41, 0x41, 0x42, 0x77,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x46, 0x2F, 0x34, 0x41, 0x41, 0x41, 0x41, 0x63, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x67, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x43, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x41, 0x41, 0x58, 0x2F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x68, 0x48, 0x2F,
+  0x2F, 0x2F, 0x2F, 0x2F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x4D, 0x45, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x2F,
+  0x64, 0x61, 0x74, 0x61, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x49,
+  0x44, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72,
+  0x69, 0x6E, 0x67, 0x3E, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09,
+  0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x4E, 0x61, 0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65,
+  0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46,
+  0x69, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+  0x3E, 0x0A, 0x09, 0x09, 0x09, 0x3C, 0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x3C,
+  0x2F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3E, 0x0A, 0x09, 0x3C, 0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E,
+  0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x70, 0x6C, 0x69, 0x73, 0x74,
+  0x3E, 0x0A, 0x6B, 0x6F, 0x6C, 0x79, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0xE2, 0xCE, 0x30, 0x37, 0x09, 0x70, 0x5F, 0x5E, 0x56, 0xB5, 0x33, 0x1A, 0x2C, 0xD0,
+  0xC3, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0xF5, 0x1A, 0x3B, 0xBE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x01, 0x6A, 0xC6, 0xCD, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+};
+
+// mixed
+STATIC CONST UINT8  mFixture4[] = {
+  0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72,
+  0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x76, 0x6F,
+  0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72,
+  0x20, 0x65, 0x66, 0x69, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+  0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x62, 0x6F, 0x6F, 0x74,
+  0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x76, 0x6F,
+  0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20,
+  0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6F, 0x70, 0x65,
+  0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F,
+  0x72, 0x20, 0x65, 0x66, 0x69, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70,
+  0x6C, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+  0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20,
+  0x65, 0x66, 0x69, 0x20, 0x65, 0x66, 0x69, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x61, 0x70,
+  0x70, 0x6C, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76,
+  0x65, 0x72, 0x79, 0x20, 0x65, 0x66, 0x69, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x74,
+  0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+  0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72,
+  0x20, 0x65, 0x66, 0x69, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20,
+  0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x6F, 0x70, 0x65,
+  0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x72,
+  0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73,
+  0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x70, 0x69, 0x63,
+  0x6B, 0x65, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x6B, 0x65, 0x72,
+  0x6E, 0x65, 0x6C, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x76, 0x6F, 0x6C,
+  0x75, 0x6D, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x65, 0x66, 0x69, 0x20, 0x74, 0x61,
+  0x62, 0x6C, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F,
+  0x72, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x61,
+  0x70, 0x70, 0x6C, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72,
+  0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6F,
+  0x6F, 0x74, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72,
+  0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20,
+  0x62, 0x6F, 0x6F, 0x74, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65,
+  0x72, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20,
+  0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x64, 0x69, 0x73,
+  0x6B, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x72,
+  0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x62, 0x6C,
+  0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72,
+  0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x62, 0x6F, 0x6F, 0x74,
+  0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x70, 0x69,
+  0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D,
+  0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F,
+  0x72, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x72, 0x65,
+  0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x65, 0x66, 0x69, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20,
+  0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20,
+  0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x63, 0x68, 0x75,
+  0x6E, 0x6B, 0x20, 0x65, 0x66, 0x69, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6B, 0x65, 0x72,
+  0x6E, 0x65, 0x6C, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x69, 0x6D, 0x61,
+  0x67, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x65, 0x66, 0x69, 0x20, 0x70, 0x69,
+  0x63, 0x6B, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20,
+  0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x6B, 0x65,
+  0x72, 0x6E, 0x65, 0x6C, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D,
+  0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x62,
+  0x6F, 0x6F, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x65, 0x66, 0x69, 0x20, 0x69, 0x6D, 0x61,
+  0x67, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x62, 0x6C,
+  0x6F, 0x63, 0x6B, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6B, 0x65, 0x72,
+  0x6E, 0x65, 0x6C, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F,
+  0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65,
+  0x20, 0x65, 0x66, 0x69, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65,
+  0x6C, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x62, 0x6C,
+  0x6F, 0x63, 0x6B, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65,
+  0x6C, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x74,
+  0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x63, 0x6F,
+  0x76, 0x65, 0x72, 0x79, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+  0x63, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x73, 0x65,
+  0x63, 0x74, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x6B, 0x65, 0x72, 0x6E,
+  0x65, 0x6C, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20,
+  0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x6B, 0x65,
+  0x72, 0x6E, 0x65, 0x6C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C,
+  0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x6D, 0x61,
+  0x67, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20,
+  0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x20, 0x65, 0x66, 0x69, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+  0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72,
+  0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x65, 0x66,
+  0x69, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x6F, 0x70, 0x65,
+  0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x65, 0x66, 0x69,
+  0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20,
+  0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x65, 0x66, 0x69, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65,
+  0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+  0x63, 0x6F, 0x72, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65,
+  0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x62, 0x6C, 0x6F,
+  0x63, 0x6B, 0x20, 0x65, 0x66, 0x69, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x63,
+  0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x70,
+  0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x72, 0x65, 0x63,
+  0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E,
+  0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20,
+  0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65,
+  0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x70, 0x69,
+  0x63, 0x6B, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D,
+  0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x70, 0x69,
+  0xAE, 0x73, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65,
+  0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20,
+  0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72,
+  0x14, 0x2C, 0x88, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x18, 0x3E, 0x0C, 0x0C,
+  0x0C, 0x05, 0x81, 0x64, 0x69, 0x1C, 0x56, 0x18, 0x4A, 0x85, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72,
+  0x0C, 0x1B, 0x83, 0x64, 0x61, 0x74, 0x61, 0x0C, 0x04, 0x24, 0x75, 0x0C, 0x54, 0x04, 0x04, 0x84,
+  0x74, 0x61, 0x62, 0x6C, 0x65, 0x14, 0x72, 0x08, 0x27, 0x08, 0x16, 0x04, 0x87, 0x08, 0x3F, 0x0C,
+  0x2F, 0x10, 0x51, 0x18, 0x61, 0x28, 0x8F, 0x1C, 0x15, 0x04, 0x39, 0x0C, 0xC7, 0x08, 0x3B, 0x10,
+  0x55, 0x10, 0x06, 0x0C, 0x69, 0x0C, 0x85, 0x08, 0x1E, 0x08, 0x2E, 0x85, 0x6B, 0x65, 0x72, 0x6E,
+  0x65, 0x6C, 0x10, 0x35, 0x84, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x14, 0x5D, 0x10, 0x19, 0x04, 0x89,
+  0x0C, 0x3A, 0x28, 0xFE, 0x10, 0x2A, 0x0C, 0x4E, 0x04, 0x23, 0x08, 0x4D, 0x87, 0x72, 0x65, 0x63,
+  0x6F, 0x76, 0x65, 0x72, 0x79, 0x14, 0x2B, 0x1D, 0x02, 0x10, 0x4D, 0x10, 0xC8, 0x0C, 0x43, 0x0C,
+  0xDB, 0x0C, 0x05, 0x10, 0xA4, 0x04, 0x49, 0x10, 0x3B, 0x29, 0x19, 0x08, 0x61, 0x08, 0x34, 0x10,
+  0x10, 0x18, 0x69, 0x18, 0xFD, 0x2C, 0xED, 0x10, 0x9F, 0x28, 0xB3, 0x11, 0x7B, 0x0D, 0xB8, 0x31,
+  0x51, 0x25, 0x1D, 0x18, 0x5B, 0x0C, 0x2A, 0x1D, 0x01, 0x28, 0xBD, 0x3C, 0x81, 0x10, 0x73, 0x10,
+  0x06, 0x0C, 0x32, 0x34, 0x1C, 0x10, 0x90, 0x0C, 0x8A, 0x11, 0x14, 0x34, 0x23, 0x18, 0x59, 0x34,
+  0x1F, 0x1D, 0x05, 0x1D, 0xC0, 0x30, 0x04, 0x32, 0xCF, 0x0C, 0x05, 0x2D, 0x1A, 0x04, 0x45, 0x15,
+  0x8E, 0x05, 0x9A, 0x10, 0x75, 0x10, 0x12, 0x29, 0xD8, 0x39, 0x7D, 0x30, 0x5E, 0x08, 0x3F, 0x24,
+  0x69, 0x0C, 0x05, 0x25, 0x4C, 0x18, 0x31, 0x18, 0xD5, 0x0C, 0x17, 0x2B, 0x8B, 0x2E, 0x3C, 0x34,
+  0xFF, 0x17, 0x4F, 0x04, 0x6C, 0x18, 0x4E, 0x0C, 0x38, 0x24, 0x6F, 0x28, 0xEB, 0x08, 0x51, 0x2C,
+  0x31, 0x09, 0x33, 0x31, 0x95, 0x10, 0x61, 0x1E, 0xC6, 0x10, 0x6B, 0x0D, 0x9F, 0x22, 0x8D, 0x48,
+  0x04, 0x0D, 0x28, 0x34, 0x0C, 0x75, 0x29, 0x2E, 0x0C, 0x3C, 0x27, 0x02, 0x37, 0x17, 0x33, 0x36,
+  0x1C, 0xA2, 0x04, 0xB0, 0x0C, 0xA2, 0x2C, 0x18, 0x10, 0x13, 0x26, 0xBA, 0x23, 0xED, 0x23, 0xD4,
+  0x18, 0x69, 0x0C, 0x31, 0x25, 0x19, 0x11, 0xB2, 0x0C, 0x3D, 0x0C, 0x0C, 0x18, 0x2D, 0x20, 0xFA,
+  0x18, 0x13, 0x49, 0x04, 0x7A, 0x24, 0x48, 0x2A, 0x22, 0x0C, 0x05, 0x10, 0x12, 0x0C, 0x32, 0x10,
+  0x8E, 0x0C, 0x38, 0x29, 0x2C, 0x08, 0xDF, 0x35, 0xDE, 0x2E, 0x78, 0x29, 0x21, 0x25, 0x75, 0x19,
+  0x0B, 0x39, 0x9B, 0x49, 0x04, 0xAF, 0x46, 0x04, 0x72, 0x2B, 0x6A, 0x81, 0x69, 0x6D, 0x42, 0x5A,
+  0x68, 0x39, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0xF4, 0xD7, 0x89, 0xA8, 0x00, 0x00, 0x5E, 0x11,
+  0x80, 0x40, 0x00, 0x3F, 0xEF, 0xDF, 0x20, 0x30, 0x01, 0x6A, 0xDA, 0x00, 0xD3, 0x05, 0x48, 0x64,
+  0xD0, 0x62, 0x06, 0xA7, 0xE4, 0x92, 0xA3, 0x00, 0x00, 0x21, 0x52, 0x4C, 0x93, 0xCD, 0x53, 0x4F,
+  0x4D, 0x4F, 0x53, 0x4F, 0xDA, 0xEC, 0x79, 0xE3, 0x4D, 0x61, 0x16, 0x24, 0x0D, 0xAD, 0x82, 0x40,
+  0x30, 0x36, 0xB0, 0x38, 0x65, 0xB4, 0xD2, 0xB0, 0xD4, 0x3F, 0x9B, 0xB8, 0x65, 0x88, 0x47, 0x66,
+  0x58, 0xED, 0x4D, 0x89, 0x36, 0xA4, 0x29, 0x98, 0xEA, 0xCC, 0x31, 0x94, 0x72, 0xC6, 0x4F, 0xAA,
+  0x2B, 0x96, 0x65, 0x11, 0x5A, 0xF1, 0x28, 0x9C, 0x95, 0x17, 0x89, 0xA6, 0xD0, 0xB1, 0x68, 0xB1,
+  0x55, 0x46, 0xC8, 0xF2, 0x26, 0xB3, 0xB8, 0x3F, 0x61, 0xC2, 0x18, 0x54, 0x3A, 0x40, 0xC8, 0x9D,
+  0x06, 0xE8, 0xCC, 0x93, 0x5A, 0xFF, 0xE1, 0x03, 0xC0, 0xC3, 0x4A, 0xE9, 0x82, 0x75, 0x6D, 0x69,
+  0x6E, 0x91, 0x25, 0x42, 0x52, 0x85, 0x68, 0x3D, 0xAB, 0xA8, 0x3E, 0x53, 0xB0, 0xF9, 0xCC, 0x92,
+  0x51, 0x14, 0x51, 0x24, 0x3C, 0x03, 0xE8, 0x5F, 0xD1, 0x3B, 0x07, 0x61, 0x3E, 0x91, 0xF6, 0xA6,
+  0x51, 0xCE, 0xD9, 0xC5, 0x18, 0x71, 0x06, 0x29, 0x88, 0xB1, 0x18, 0xC1, 0x8A, 0x26, 0x13, 0x54,
+  0xDD, 0x3D, 0xFD, 0x1D, 0xD5, 0x14, 0x55, 0x49, 0x08, 0x61, 0x4E, 0x91, 0xF8, 0xA6, 0xA1, 0xC2,
+  0x60, 0x4E, 0x90, 0x39, 0x07, 0xC8, 0x3B, 0x87, 0x6A, 0xE4, 0x38, 0x06, 0x18, 0x34, 0x13, 0x20,
+  0xFB, 0x07, 0x3E, 0x19, 0x88, 0x99, 0x69, 0x82, 0x08, 0x98, 0x3C, 0x0F, 0x28, 0xE8, 0xA6, 0x15,
+  0xF4, 0xA7, 0x80, 0x75, 0x0D, 0x10, 0xF2, 0xAE, 0x54, 0xF8, 0x26, 0xC8, 0xEC, 0x3A, 0x83, 0xF8,
+  0x3F, 0xE2, 0xEE, 0x48, 0xA7, 0x0A, 0x12, 0x1E, 0x9A, 0xF1, 0x35, 0x00, 0x62, 0x76, 0x78, 0x31,
+  0x00, 0x0A, 0x00, 0x00, 0xF4, 0x01, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xC4, 0x01, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xCD, 0x03, 0x69, 0x02,
+  0x3D, 0x01, 0x3F, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x24, 0x00, 0x07, 0x00, 0x39, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x03, 0x00, 0x09, 0x00, 0x11, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x04, 0x00, 0x03, 0x00,
+  0x06, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0C, 0x00,
+  0x0C, 0x00, 0x0D, 0x00, 0x03, 0x00, 0x17, 0x00, 0x0F, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x13, 0x00,
+  0x07, 0x00, 0x09, 0x00, 0x05, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x0A, 0x00, 0x0E, 0x00, 0x09, 0x00,
+  0x0C, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x37, 0x00, 0x21, 0x00, 0x42, 0x00, 0x16, 0x00, 0xA3, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00,
+  0x37, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x37, 0x00, 0x16, 0x00, 0x21, 0x00, 0x59, 0x00, 0x2C, 0x00,
+  0x00, 0x00, 0x59, 0x00, 0x16, 0x00, 0x2C, 0x00, 0x16, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x45, 0x33, 0x73, 0xC8, 0x83, 0xCF, 0xA7, 0x29, 0xCB, 0x35, 0x81, 0xB6, 0x1A, 0x51,
+  0xE4, 0xF8, 0xF1, 0x52, 0x4B, 0x9D, 0xEA, 0xFC, 0xA9, 0xB5, 0xF6, 0x62, 0x8F, 0xE3, 0x14, 0x70,
+  0xC4, 0x2D, 0x52, 0x18, 0x3F, 0x46, 0x59, 0x01, 0x45, 0x9B, 0x58, 0xE2, 0x20, 0x67, 0xDD, 0x01,
+  0x17, 0xC0, 0xEA, 0x20, 0xCB, 0x69, 0x1A, 0x05, 0x87, 0xC2, 0xFA, 0x73, 0x02, 0x4C, 0xB0, 0xF8,
+  0x5A, 0xCB, 0x5D, 0x47, 0x7C, 0xC3, 0x8A, 0x91, 0xA4, 0x93, 0x89, 0xEC, 0x5C, 0x71, 0x99, 0xB8,
+  0x32, 0x1A, 0xAD, 0xFC, 0x75, 0xD0, 0x8C, 0xAF, 0x67, 0xAD, 0xAE, 0xB8, 0xEF, 0x30, 0xDB, 0x00,
+  0xE8, 0x75, 0x34, 0x12, 0x1A, 0xB8, 0x38, 0xF8, 0x77, 0x24, 0x29, 0xA3, 0x2B, 0xF6, 0xE9, 0x2E,
+  0x27, 0xC8, 0x92, 0x76, 0x5C, 0x76, 0xD5, 0x61, 0x99, 0x45, 0xDA, 0x82, 0xAA, 0x50, 0xAE, 0xFA,
+  0x05, 0xC5, 0x31, 0xB7, 0x4D, 0xFF, 0x17, 0x20, 0x98, 0x65, 0x69, 0x2E, 0x5F, 0x5D, 0xBC, 0x51,
+  0x6E, 0x27, 0x4B, 0xD3, 0x85, 0x13, 0x70, 0x0D, 0xE2, 0xDE, 0x3A, 0xA8, 0x86, 0x5E, 0x13, 0x86,
+  0x0D, 0xE0, 0x09, 0xB7, 0x44, 0xD7, 0xA0, 0x4F, 0xC9, 0xD8, 0xEE, 0x30, 0x42, 0x30, 0xC8, 0x5D,
+  0x5B, 0x2F, 0xCB, 0x33, 0x0A, 0x05, 0x83, 0xE3, 0xDA, 0x56, 0x81, 0x22, 0xD5, 0x5A, 0xD6, 0x24,
+  0x4B, 0xB1, 0xDC, 0xE7, 0x26, 0x44, 0xA6, 0x5E, 0x8E, 0xE1, 0xAD, 0x4A, 0xBC, 0xDE, 0xBC, 0x33,
+  0x83, 0xF1, 0xD6, 0xB5, 0xF7, 0xC3, 0x86, 0x10, 0x36, 0xDC, 0xD5, 0x1B, 0x17, 0x20, 0x34, 0x78,
+  0x82, 0xF0, 0x20, 0x6E, 0x68, 0xFD, 0x4A, 0xB0, 0x84, 0x07, 0x05, 0x55, 0x85, 0x80, 0x0E, 0xF9,
+  0xE9, 0x89, 0x28, 0x2C, 0x38, 0x3C, 0x9B, 0x62, 0x65, 0x2A, 0x12, 0x4D, 0xE8, 0x84, 0x0B, 0xB9,
+  0xE1, 0x34, 0x5C, 0xD0, 0xDA, 0x68, 0x0E, 0x63, 0xF3, 0xF2, 0xC1, 0xD8, 0x5D, 0x31, 0x3D, 0xC7,
+  0x82, 0x21, 0x33, 0x93, 0x45, 0xF4, 0x3C, 0xD8, 0x7D, 0x81, 0xA9, 0x2C, 0x71, 0x10, 0x12, 0x54,
+  0x82, 0xDE, 0x39, 0x29, 0xF4, 0x46, 0x8F, 0x01, 0x93, 0x52, 0x54, 0x56, 0x17, 0x71, 0xE0, 0x93,
+  0xA5, 0x32, 0xDD, 0x8F, 0xD6, 0x4D, 0x13, 0xCD, 0x5D, 0xA4, 0x65, 0x38, 0x06, 0xA5, 0x60, 0x92,
+  0xD4, 0x25, 0xB3, 0x14, 0x13, 0xE4, 0xE5, 0x5C, 0x15, 0x15, 0x27, 0xB3, 0x3D, 0x12, 0x89, 0xC0,
+  0x1D, 0x1D, 0x60, 0x37, 0x03, 0x20, 0xDE, 0x96, 0x98, 0xB4, 0xFA, 0x62, 0x63, 0xFE, 0x7D, 0x3B,
+  0x64, 0x24, 0xE0, 0x68, 0xCD, 0xB4, 0xD1, 0x52, 0xED, 0xA7, 0x2C, 0x79, 0x95, 0xBC, 0xA1, 0x56,
+  0x01, 0x28, 0x52, 0xD6, 0xCB, 0x8C, 0x86, 0x24, 0xE8, 0xD8, 0xEB, 0x4C, 0x74, 0x06, 0x17, 0xB2,
+  0x21, 0x8D, 0x0B, 0xE3, 0x3B, 0xE7, 0xDC, 0x1B, 0xD3, 0xB4, 0x8A, 0x32, 0x81, 0x08, 0x80, 0xB0,
+  0x35, 0x55, 0x21, 0x97, 0x44, 0xD3, 0xA3, 0x7D, 0xF9, 0xE4, 0x11, 0xD4, 0xF5, 0xDA, 0xDA, 0xA4,
+  0x2C, 0x5D, 0x7D, 0x60, 0x45, 0x0E, 0x52, 0x9B, 0x6F, 0x31, 0x6F, 0xE8, 0xB6, 0xA3, 0x82, 0xCB,
+  0x79, 0x6E, 0xB8, 0x29, 0x09, 0x0E, 0x8D, 0x6B, 0x60, 0xEC, 0x79, 0xF9, 0x35, 0xEF, 0xDA, 0x4A,
+  0x66, 0x7B, 0xD6, 0x74, 0x1C, 0x28, 0xDE, 0xF8, 0x9D, 0x43, 0x37, 0x1A, 0x5D, 0x63, 0xC9, 0xD0,
+  0x4C, 0xB2, 0xC0, 0x56, 0x6A, 0xDB, 0x22, 0xDA, 0x21, 0xE0, 0xB0, 0x4F, 0xBC, 0xA8, 0x99, 0x10,
+  0xF9, 0x73, 0x3B, 0xCE, 0xD8, 0x1B, 0x63, 0xFE, 0x11, 0xA4, 0xFE, 0xE1, 0xFB, 0x90, 0xCF, 0x0F,
+  0x5F, 0x94, 0x01, 0x03, 0x62, 0x76, 0x78, 0x24, 0x62, 0x76, 0x78, 0x6E, 0x00, 0x06, 0x00, 0x00,
+  0x14, 0x06, 0x00, 0x00, 0xE0, 0xFF, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x61,
+  0x70, 0x70, 0x6C, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x63,
+  0x68, 0x75, 0x6E, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F,
+  0x72, 0x20, 0x65, 0x66, 0x69, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x6B, 0x65, 0x72,
+  0x6E, 0x65, 0x6C, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72,
+  0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x64, 0x72,
+  0x69, 0x76, 0x65, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x68,
+  0x75, 0x6E, 0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x62,
+  0x6F, 0x6F, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72,
+  0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x65, 0x66, 0x69, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+  0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x69, 0x6D,
+  0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x61, 0x62,
+  0x6C, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x65, 0x66, 0x69, 0x20, 0x72, 0x65,
+  0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x6C, 0x6F,
+  0x63, 0x6B, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x64,
+  0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x62, 0x6F, 0x6F,
+  0x74, 0x20, 0x62, 0x6C, 0x6F, 0xE0, 0xFF, 0x63, 0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20,
+  0x64, 0x69, 0x73, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74,
+  0x6F, 0x72, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20,
+  0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75,
+  0x6D, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x69,
+  0x73, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x65, 0x66, 0x69, 0x20, 0x69, 0x6D,
+  0x61, 0x67, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20,
+  0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x62, 0x6F, 0x6F,
+  0x74, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72,
+  0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6B, 0x65,
+  0x72, 0x6E, 0x65, 0x6C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65,
+  0x72, 0x79, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73,
+  0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+  0x6B, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64,
+  0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+  0x63, 0x6F, 0x72, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20,
+  0x62, 0x6F, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74, 0x61,
+  0x62, 0x6C, 0x65, 0x20, 0x72, 0x65, 0xE0, 0xFF, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x76,
+  0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x63, 0x68, 0x75,
+  0x6E, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+  0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C,
+  0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20,
+  0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+  0x6B, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65,
+  0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65,
+  0x72, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x74, 0x61,
+  0x62, 0x6C, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x65, 0x66, 0x69, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72,
+  0x79, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6B, 0x65,
+  0x72, 0x6E, 0x65, 0x6C, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65,
+  0x72, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6F, 0x70, 0xE0, 0xFF, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20,
+  0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x72, 0x65,
+  0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x73, 0x65, 0x63, 0x74,
+  0x6F, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72,
+  0x79, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64,
+  0x69, 0x73, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F,
+  0x72, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x73,
+  0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65,
+  0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x62, 0x6F, 0x6F, 0x74,
+  0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x64,
+  0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B,
+  0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x64, 0x69, 0x73,
+  0x6B, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x63, 0x68, 0x75,
+  0x6E, 0x6B, 0x20, 0x65, 0x66, 0x69, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x76, 0x6F, 0x6C, 0x75,
+  0x6D, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65,
+  0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65,
+  0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x76,
+  0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x72, 0x65, 0xE0, 0xFF, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x73, 0x65,
+  0x63, 0x74, 0x6F, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x6F, 0x70,
+  0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x6F,
+  0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x69,
+  0x6D, 0x61, 0x67, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65,
+  0x6C, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20,
+  0x65, 0x66, 0x69, 0x20, 0x65, 0x66, 0x69, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x20, 0x65, 0x66, 0x69, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x20, 0x74,
+  0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x65, 0x66, 0x69, 0x20, 0x6F, 0x70,
+  0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6B, 0x65, 0x72,
+  0x6E, 0x65, 0x6C, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65,
+  0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x65, 0x66, 0x69, 0x20, 0x72,
+  0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x6F, 0x70,
+  0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+  0x63, 0x6F, 0x72, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0xE0, 0xA5, 0x6F, 0x72, 0x20, 0x65, 0x66,
+  0x69, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20,
+  0x61, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x20,
+  0x65, 0x66, 0x69, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65,
+  0x72, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x64,
+  0x69, 0x73, 0x6B, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65,
+  0x72, 0x79, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x76, 0x6F, 0x6C, 0x75, 0x6D, 0x65,
+  0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x62,
+  0x6F, 0x6F, 0x74, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x65,
+  0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x20, 0x62,
+  0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+  0x20, 0x6F, 0x70, 0x65, 0x6E, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x65,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x76, 0x78, 0x24, 0x78, 0xDA, 0x6D, 0x53,
+  0x41, 0x12, 0xC3, 0x20, 0x08, 0xFC, 0x8A, 0x5F, 0x33, 0x86, 0xB6, 0x8E, 0x69, 0xCC, 0xD8, 0xB4,
+  0x33, 0xFD, 0x7D, 0x2B, 0x6C, 0x10, 0xD2, 0x1E, 0xA2, 0x06, 0x96, 0x65, 0x11, 0xBC, 0xE4, 0xF0,
+  0xAA, 0xCB, 0xF3, 0x4E, 0x61, 0x5A, 0x6A, 0x2A, 0x61, 0x8F, 0xD3, 0x42, 0x21, 0x6E, 0xDB, 0x77,
+  0xCD, 0xF7, 0x78, 0xA5, 0x30, 0xB7, 0xFC, 0xA2, 0x16, 0x0A, 0xB5, 0x95, 0x16, 0x78, 0xEA, 0x46,
+  0x6B, 0xAA, 0x4D, 0x9D, 0x62, 0x9D, 0x6A, 0xDD, 0x71, 0xA4, 0x4B, 0x06, 0xA1, 0xAC, 0xC8, 0xD1,
+  0x28, 0xD5, 0x2F, 0xFE, 0x3D, 0x0E, 0x1D, 0xA8, 0x6C, 0x7A, 0x50, 0x37, 0xB2, 0xCE, 0x71, 0x8F,
+  0x90, 0xF3, 0xA0, 0xB4, 0xD7, 0x16, 0xD2, 0xED, 0xB9, 0x96, 0xE3, 0x47, 0x72, 0x30, 0x68, 0xCE,
+  0x8F, 0xC2, 0xA4, 0xFD, 0x13, 0x2D, 0x6A, 0x52, 0x56, 0x16, 0x2A, 0x41, 0x5B, 0x4E, 0x65, 0x54,
+  0x87, 0x4D, 0x75, 0x40, 0xB6, 0x24, 0xC3, 0x8F, 0x90, 0xFA, 0x80, 0x51, 0x2E, 0x2E, 0x04, 0x58,
+  0xB0, 0xFB, 0x4D, 0xD9, 0xA1, 0x9E, 0xF5, 0xB1, 0x78, 0xB0, 0x21, 0x98, 0xED, 0xC0, 0x68, 0x8C,
+  0x64, 0xB1, 0xD7, 0xE2, 0xF2, 0x2A, 0xEE, 0x6F, 0x5D, 0x5C, 0x37, 0xCE, 0xD2, 0x68, 0x6B, 0x11,
+  0x22, 0xB9, 0x65, 0xF1, 0xC2, 0x21, 0xA6, 0x5E, 0xE3, 0xA1, 0xCC, 0x8D, 0x44, 0x77, 0x08, 0xDE,
+  0xDB, 0x1D, 0xC7, 0x79, 0x62, 0xB8, 0x38, 0x35, 0xBA, 0x70, 0x6C, 0x2C, 0x0D, 0x23, 0xD8, 0xC1,
+  0x4E, 0x25, 0xCA, 0xFB, 0xD7, 0x51, 0xE1, 0x1A, 0x9A, 0x8D, 0xCB, 0xCC, 0x83, 0x46, 0xCA, 0x1D,
+  0x76, 0x8C, 0x6D, 0x87, 0xC5, 0x9F, 0x67, 0x97, 0x01, 0xFE, 0x7E, 0xD9, 0xE4, 0xE6, 0xB3, 0x67,
+  0xB6, 0x5D, 0xD2, 0x68, 0x04, 0x1A, 0xBF, 0x4C, 0x17, 0x53, 0xC8, 0x51, 0xD6, 0x51, 0x9B, 0x6B,
+  0xF9, 0x80, 0x99, 0x47, 0x01, 0xD2, 0xA3, 0x02, 0x7E, 0x08, 0x7D, 0xF9, 0x7D, 0x50, 0xA6, 0xED,
+  0x4C, 0xF5, 0x01, 0xAB, 0xEB, 0x7C, 0x43, 0x62, 0x76, 0x78, 0x32, 0x00, 0x06, 0x00, 0x00, 0x60,
+  0x00, 0x40, 0x03, 0x00, 0xA6, 0x00, 0x50, 0x91, 0x48, 0x37, 0xD5, 0x0B, 0x14, 0x01, 0x10, 0xAB,
+  0x00, 0x00, 0x00, 0x3F, 0xA0, 0x80, 0x00, 0x2F, 0x02, 0x28, 0xA2, 0x00, 0x00, 0x02, 0xB0, 0xD6,
+  0xE5, 0x4D, 0x97, 0x59, 0xAB, 0x0A, 0x00, 0x78, 0x02, 0x7B, 0x8E, 0x5E, 0x5C, 0xEC, 0x93, 0xE3,
+  0x93, 0x8B, 0x8B, 0xE3, 0xAB, 0xBB, 0x7D, 0x77, 0x31, 0xF7, 0xE9, 0x9C, 0x1B, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xEF, 0xE0, 0x11, 0x78, 0x14, 0x1E, 0x81, 0x87, 0xE3, 0xE4, 0xE4, 0xE4, 0x3B, 0xE0, 0x3B, 0x78,
+  0x09, 0xAE, 0x1F, 0x81, 0xEF, 0xE1, 0x25, 0xE0, 0x7B, 0xB8, 0x7E, 0x09, 0xAE, 0x1F, 0x01, 0x38,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xF5, 0x91, 0x88, 0x21, 0x40, 0x7A, 0x37, 0x86, 0xC3,
+  0x09, 0xEA, 0x4E, 0x81, 0x88, 0xC5, 0x69, 0x4D, 0xB6, 0x0B, 0xF8, 0x57, 0xCA, 0xC4, 0x78, 0x82,
+  0x2C, 0xB6, 0xB5, 0x3E, 0xAA, 0x44, 0xD7, 0x34, 0x4C, 0x2A, 0x45, 0xF3, 0x46, 0x91, 0x91, 0x8D,
+  0x73, 0x38, 0x3A, 0xF6, 0x83, 0x0E, 0x01, 0xE0, 0x83, 0x08, 0x10, 0xF2, 0x3F, 0xB5, 0x73, 0x93,
+  0x70, 0xF0, 0xAE, 0x8D, 0xA1, 0x2F, 0xD3, 0x63, 0x70, 0x48, 0x37, 0x93, 0xF7, 0x4E, 0x36, 0x3D,
+  0x50, 0xB9, 0x2A, 0xF6, 0xF5, 0xD6, 0x8A, 0x1D, 0x86, 0xE1, 0x33, 0x0C, 0x1F, 0x75, 0x26, 0x12,
+  0xCE, 0x49, 0x66, 0xAC, 0x8B, 0x38, 0xF5, 0x64, 0xDF, 0xC6, 0xB0, 0x7B, 0x5C, 0x71, 0xC9, 0xE0,
+  0x4C, 0xB6, 0x9F, 0x71, 0x00, 0xD1, 0x37, 0xED, 0x49, 0x68, 0xF6, 0x23, 0x7C, 0x19, 0xCA, 0xB7,
+  0xB3, 0x6D, 0xED, 0x0C, 0x87, 0xEA, 0x9E, 0xF2, 0xE3, 0x78, 0x47, 0xAB, 0xF5, 0x69, 0xD0, 0x3A,
+  0x43, 0x62, 0x95, 0x93, 0x93, 0xD4, 0x3B, 0xBA, 0xBB, 0xDF, 0xB3, 0xAD, 0xB0, 0x90, 0x09, 0x82,
+  0x74, 0x51, 0x31, 0xA5, 0xBB, 0x92, 0x9E, 0x9D, 0xF9, 0xA2, 0x2E, 0xE2, 0x79, 0xED, 0x0B, 0xBC,
+  0x4C, 0x77, 0x10, 0x38, 0x3E, 0x5E, 0x92, 0x02, 0x79, 0xF2, 0x17, 0x4F, 0xB9, 0xD3, 0x54, 0x80,
+  0xB0, 0x2E, 0x83, 0xE4, 0x3B, 0xC0, 0x39, 0x7D, 0x22, 0xE9, 0xB8, 0x4F, 0xB6, 0x89, 0x93, 0xA0,
+  0xA7, 0x59, 0xBC, 0x2D, 0x54, 0x77, 0x93, 0xB0, 0x1F, 0xB5, 0x9E, 0x4A, 0xEF, 0x98, 0x82, 0xB0,
+  0x1B, 0x6D, 0xC7, 0x92, 0xDF, 0x5B, 0x3C, 0x7C, 0x79, 0xE3, 0x61, 0x95, 0x8C, 0xA3, 0x1C, 0xA6,
+  0x53, 0x43, 0x2E, 0xB6, 0x10, 0x31, 0x01, 0x33, 0xCD, 0x32, 0xE8, 0x2C, 0xFC, 0x40, 0x57, 0x5F,
+  0x29, 0x8A, 0x36, 0xFB, 0x91, 0xB4, 0xE2, 0x99, 0x95, 0x5A, 0x24, 0xFD, 0xFB, 0x6A, 0x0F, 0xC6,
+  0x0F, 0x2E, 0x07, 0x1D, 0xFB, 0xAE, 0x7B, 0xB4, 0x91, 0x1C, 0x55, 0xA5, 0x36, 0xF7, 0x6E, 0x14,
+  0x61, 0x34, 0x6E, 0x8A, 0x23, 0x8C, 0xF2, 0x71, 0x33, 0x3D, 0xB3, 0xA6, 0x49, 0x56, 0x14, 0xC5,
+  0x4E, 0x40, 0x7F, 0x51, 0xBC, 0xA4, 0x72, 0x76, 0x85, 0x61, 0x04, 0x54, 0xA9, 0x22, 0x11, 0x81,
+  0xE7, 0xD4, 0xAB, 0x87, 0x79, 0x0F, 0xFF, 0x6F, 0xC3, 0x03, 0x62, 0x76, 0x78, 0x24, 0x3C, 0x3F,
+  0x78, 0x6D, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30,
+  0x22, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x69, 0x6E, 0x67, 0x3D, 0x22, 0x55, 0x54, 0x46, 0x2D,
+  0x38, 0x22, 0x3F, 0x3E, 0x0A, 0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x70,
+  0x6C, 0x69, 0x73, 0x74, 0x20, 0x50, 0x55, 0x42, 0x4C, 0x49, 0x43, 0x20, 0x22, 0x2D, 0x2F, 0x2F,
+  0x41, 0x70, 0x70, 0x6C, 0x65, 0x2F, 0x2F, 0x44, 0x54, 0x44, 0x20, 0x50, 0x4C, 0x49, 0x53, 0x54,
+  0x20, 0x31, 0x2E, 0x30, 0x2F, 0x2F, 0x45, 0x4E, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3A,
+  0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x2E, 0x63, 0x6F, 0x6D, 0x2F,
+  0x44, 0x54, 0x44, 0x73, 0x2F, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4C, 0x69, 0x73,
+  0x74, 0x2D, 0x31, 0x2E, 0x30, 0x2E, 0x64, 0x74, 0x64, 0x22, 0x3E, 0x0A, 0x3C, 0x70, 0x6C, 0x69,
+  0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30, 0x22,
+  0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x72,
+  0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2D, 0x66, 0x6F, 0x72, 0x6B, 0x3C, 0x2F, 0x6B, 0x65,
+  0x79, 0x3E, 0x0A, 0x09, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x3C, 0x6B, 0x65,
+  0x79, 0x3E, 0x62, 0x6C, 0x6B, 0x78, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x3C,
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E,
+  0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x73, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C,
+  0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x30, 0x78, 0x30, 0x30, 0x35, 0x30, 0x3C, 0x2F, 0x73,
+  0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E,
+  0x43, 0x46, 0x4E, 0x61, 0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46, 0x69, 0x78, 0x74, 0x75, 0x72, 0x65,
+  0x20, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x44, 0x61, 0x74, 0x61, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A,
+  0x09, 0x09, 0x09, 0x09, 0x3C, 0x64, 0x61, 0x74, 0x61, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x62,
+  0x57, 0x6C, 0x7A, 0x61, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4B, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x41,
+  0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x41,
+  0x41, 0x41, 0x41, 0x67, 0x47, 0x47, 0x71, 0x79, 0x45, 0x51, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09,
+  0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x48, 0x66, 0x2F, 0x2F, 0x2F, 0x2F, 0x67, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x77, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x67, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x44, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x47, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x67, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x41, 0x41, 0x41, 0x41, 0x42, 0x67, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x49, 0x41, 0x41, 0x41, 0x41, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x55, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x77, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x59,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x61, 0x36, 0x41, 0x41, 0x41, 0x41,
+  0x47, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x41, 0x0A, 0x09, 0x09,
+  0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x48, 0x72, 0x67, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x45, 0x4F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x77, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x67, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x43, 0x4C, 0x77, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x3D, 0x3D, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x2F, 0x64, 0x61, 0x74, 0x61, 0x3E, 0x0A,
+  0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x49, 0x44, 0x3C, 0x2F, 0x6B, 0x65, 0x79,
+  0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x30, 0x3C,
+  0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65,
+  0x79, 0x3E, 0x4E, 0x61, 0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46, 0x69, 0x78, 0x74, 0x75, 0x72, 0x65,
+  0x20, 0x30, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x3C,
+  0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x3C, 0x64, 0x69, 0x63, 0x74, 0x3E,
+  0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x75, 0x74, 0x65, 0x73, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C,
+  0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x30, 0x78, 0x30, 0x30, 0x35, 0x30, 0x3C, 0x2F, 0x73,
+  0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E,
+  0x43, 0x46, 0x4E, 0x61, 0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46, 0x69, 0x78, 0x74, 0x75, 0x72, 0x65,
+  0x20, 0x31, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x44, 0x61, 0x74, 0x61, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A,
+  0x09, 0x09, 0x09, 0x09, 0x3C, 0x64, 0x61, 0x74, 0x61, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x62,
+  0x57, 0x6C, 0x7A, 0x61, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x43, 0x67, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4F, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x49, 0x41,
+  0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x41,
+  0x41, 0x41, 0x41, 0x67, 0x32, 0x48, 0x65, 0x48, 0x66, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09,
+  0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09,
+  0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x47, 0x67, 0x41, 0x41, 0x41, 0x42, 0x77, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x0A, 0x09, 0x09, 0x09, 0x09, 0x43, 0x4C, 0x77, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x45, 0x2F, 0x49, 0x41, 0x41, 0x41, 0x41, 0x63, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x55, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x77, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41,
+  0x32, 0x34, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x69, 0x53, 0x41, 0x41, 0x41,
+  0x41, 0x46, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x49, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x54, 0x33, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x62, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x67, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x41, 0x41, 0x41, 0x41, 0x46, 0x50, 0x63, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x49, 0x41, 0x41, 0x41, 0x41, 0x63, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x73, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x77, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x54,
+  0x33, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x66, 0x66, 0x2F, 0x2F, 0x2F, 0x2F,
+  0x2F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x4F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09,
+  0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x57, 0x37, 0x67, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x2F, 0x64, 0x61, 0x74,
+  0x61, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x49, 0x44, 0x3C, 0x2F,
+  0x6B, 0x65, 0x79, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+  0x3E, 0x31, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09, 0x09, 0x09, 0x09,
+  0x3C, 0x6B, 0x65, 0x79, 0x3E, 0x4E, 0x61, 0x6D, 0x65, 0x3C, 0x2F, 0x6B, 0x65, 0x79, 0x3E, 0x0A,
+  0x09, 0x09, 0x09, 0x09, 0x3C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x46, 0x69, 0x78, 0x74,
+  0x75, 0x72, 0x65, 0x20, 0x31, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3E, 0x0A, 0x09,
+  0x09, 0x09, 0x3C, 0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x09, 0x09, 0x3C, 0x2F, 0x61, 0x72,
+  0x72, 0x61, 0x79, 0x3E, 0x0A, 0x09, 0x3C, 0x2F, 0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x3C, 0x2F,
+  0x64, 0x69, 0x63, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x70, 0x6C, 0x69, 0x73, 0x74, 0x3E, 0x0A, 0x6B,
+  0x6F, 0x6C, 0x79, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x98,
+  0xDA, 0x7F, 0xC1, 0xA6, 0x68, 0x42, 0x86, 0xCB, 0x90, 0x7C, 0x5B, 0x6F, 0x69, 0xE9, 0x82, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0xE4, 0xAF, 0x9B, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xEE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x17, 0x36, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+STATIC CONST DISK_IMAGE_FIXTURE  mFixtures[] = {
+  { "udco-adc", mFixture0, sizeof (mFixture0), 16U, {
+      0x09, 0xE9, 0x02, 0xD5, 0x1E, 0x69, 0xD9, 0x1C, 0x45, 0xC2, 0x66, 0xBC, 0x6C, 0xB5, 0x65, 0xA3,
+      0xAF, 0x10, 0x1D, 0xE9, 0x6C, 0x72, 0x73, 0x90, 0x01, 0x9C, 0xA4, 0xAF, 0xD4, 0xCC, 0x24, 0xAD,
+    } },
+  { "udbz-bzip2", mFixture1, sizeof (mFixture1), 16U, {
+      0x09, 0xE9, 0x02, 0xD5, 0x1E, 0x69, 0xD9, 0x1C, 0x45, 0xC2, 0x66, 0xBC, 0x6C, 0xB5, 0x65, 0xA3,
+      0xAF, 0x10, 0x1D, 0xE9, 0x6C, 0x72, 0x73, 0x90, 0x01, 0x9C, 0xA4, 0xAF, 0xD4, 0xCC, 0x24, 0xAD,
+    } },
+  { "ulfo-lzfse", mFixture2, sizeof (mFixture2), 16U, {
+      0x09, 0xE9, 0x02, 0xD5, 0x1E, 0x69, 0xD9, 0x1C, 0x45, 0xC2, 0x66, 0xBC, 0x6C, 0xB5, 0x65, 0xA3,
+      0xAF, 0x10, 0x1D, 0xE9, 0x6C, 0x72, 0x73, 0x90, 0x01, 0x9C, 0xA4, 0xAF, 0xD4, 0xCC, 0x24, 0xAD,
+    } },
+  { "ulfo-lzfse-v1", mFixture3, sizeof (mFixture3), 16U, {
+      0x09, 0xE9, 0x02, 0xD5, 0x1E, 0x69, 0xD9, 0x1C, 0x45, 0xC2, 0x66, 0xBC, 0x6C, 0xB5, 0x65, 0xA3,
+      0xAF, 0x10, 0x1D, 0xE9, 0x6C, 0x72, 0x73, 0x90, 0x01, 0x9C, 0xA4, 0xAF, 0xD4, 0xCC, 0x24, 0xAD,
+    } },
+  { "mixed", mFixture4, sizeof (mFixture4), 24U, {
+      0x2B, 0x46, 0x49, 0x50, 0xC2, 0xFB, 0xAE, 0xD1, 0xD2, 0x02, 0xA9, 0x39, 0xED, 0x84, 0xA1, 0x9C,
+      0xEE, 0x1D, 0x7B, 0x68, 0x8E, 0xA7, 0xE4, 0xEB, 0x45, 0xCD, 0x71, 0x2E, 0x74, 0xFC, 0xBC, 0xFE,
+    } },
+};
+
+#endif // TEST_DISK_IMAGE_FIXTURES_H
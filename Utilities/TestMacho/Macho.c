@@ -28,6 +28,163 @@ MACH_SECTION_64          mSect;
 MACH_SEGMENT_COMMAND_64  mSeg;
 MACH_UUID_COMMAND        mUuid;
 
+STATIC
+UINT64
+UserGetTimestampUs (
+  VOID
+  )
+{
+  struct timeval  Time;
+
+  gettimeofday (&Time, NULL);
+  return Time.tv_sec * 1000000ULL + Time.tv_usec;
+}
+
+/**
+  Look up every name and relocation address once, the way vtable patching
+  and the kernel patcher do.  Relocation results have the lowest bit set
+  when the relocation exists, as the symbol may still be NULL.
+**/
+STATIC
+VOID
+UserLookupPass (
+  IN OUT OC_MACHO_CONTEXT  *Context,
+  IN     CONST CHAR8       **Names,
+  IN     UINT32            NumNames,
+  IN     CONST UINT64      *Addresses,
+  IN     UINT32            NumAddresses,
+  OUT    UINTN             *Results
+  )
+{
+  UINT32         Index;
+  MACH_NLIST_64  *Symbol;
+  BOOLEAN        Result;
+
+  for (Index = 0; Index < NumNames; ++Index) {
+    *Results++ = (UINTN)MachoGetLocalDefinedSymbolByName64 (Context, Names[Index]);
+    *Results++ = (UINTN)MachoGetSymbolByName (Context, Names[Index]);
+  }
+
+  for (Index = 0; Index < NumAddresses; ++Index) {
+    Symbol     = NULL;
+    Result     = MachoGetSymbolByRelocationOffset64 (Context, Addresses[Index], &Symbol);
+    *Results++ = Result ? ((UINTN)Symbol | 1U) : 0;
+    Symbol     = NULL;
+    Result     = MachoGetSymbolByExternRelocationOffset64 (Context, Addresses[Index], &Symbol);
+    *Results++ = Result ? ((UINTN)Symbol | 1U) : 0;
+  }
+}
+
+/**
+  Compare symbol and relocation lookups with and without the Mach-O lookup
+  index, for every symbol name and every relocation address of the file.
+**/
+STATIC
+int
+BenchmarkMacho (
+  IN OUT VOID    *File,
+  IN     UINT32  Size,
+  IN     UINT32  Iterations
+  )
+{
+  OC_MACHO_CONTEXT      Context;
+  MACH_NLIST_64         *Symbol;
+  MACH_RELOCATION_INFO  *Relocations[2];
+  UINT32                NumRelocations[2];
+  CONST CHAR8           **Names;
+  UINT64                *Addresses;
+  UINTN                 *LinearResults;
+  UINTN                 *IndexResults;
+  UINT32                NumNames;
+  UINT32                NumAddresses;
+  UINT32                NumResults;
+  UINT32                Index;
+  UINT32                Table;
+  UINT32                Iteration;
+  UINT64                StartTime;
+  UINT64                LinearTime;
+  UINT64                IndexTime;
+
+  if (!MachoInitializeContext64 (&Context, File, Size, 0, Size)) {
+    DEBUG ((DEBUG_ERROR, "Unsupported Mach-O\n"));
+    return -1;
+  }
+
+  NumNames = 0;
+  while (MachoGetSymbolByIndex64 (&Context, NumNames) != NULL) {
+    ++NumNames;
+  }
+
+  NumRelocations[0] = 0;
+  NumRelocations[1] = 0;
+  if (Context.DySymtab != NULL) {
+    Relocations[0]    = Context.ExternRelocations;
+    NumRelocations[0] = Context.DySymtab->NumExternalRelocations;
+    Relocations[1]    = Context.LocalRelocations;
+    NumRelocations[1] = Context.DySymtab->NumOfLocalRelocations;
+  }
+
+  NumAddresses  = NumRelocations[0] + NumRelocations[1];
+  NumResults    = (NumNames + NumAddresses) * 2;
+  Names         = AllocatePool ((NumNames + 1) * sizeof (*Names));
+  Addresses     = AllocatePool ((NumAddresses + 1) * sizeof (*Addresses));
+  LinearResults = AllocatePool ((NumResults + 1) * sizeof (*LinearResults));
+  IndexResults  = AllocatePool ((NumResults + 1) * sizeof (*IndexResults));
+  if ((Names == NULL) || (Addresses == NULL) || (LinearResults == NULL) || (IndexResults == NULL)) {
+    DEBUG ((DEBUG_ERROR, "Out of memory\n"));
+    return -1;
+  }
+
+  for (Index = 0; Index < NumNames; ++Index) {
+    Symbol       = MachoGetSymbolByIndex64 (&Context, Index);
+    Names[Index] = MachoGetSymbolName64 (&Context, Symbol);
+  }
+
+  NumAddresses = 0;
+  for (Table = 0; Table < ARRAY_SIZE (Relocations); ++Table) {
+    for (Index = 0; Index < NumRelocations[Table]; ++Index) {
+      Addresses[NumAddresses++] = (UINT64)Relocations[Table][Index].Address;
+    }
+  }
+
+  StartTime = UserGetTimestampUs ();
+  for (Iteration = 0; Iteration < Iterations; ++Iteration) {
+    UserLookupPass (&Context, Names, NumNames, Addresses, NumAddresses, LinearResults);
+  }
+
+  LinearTime = UserGetTimestampUs () - StartTime;
+
+  //
+  // Index build time is included, as it happens on first lookup.
+  //
+  StartTime = UserGetTimestampUs ();
+  MachoInitializeIndex (&Context);
+  for (Iteration = 0; Iteration < Iterations; ++Iteration) {
+    UserLookupPass (&Context, Names, NumNames, Addresses, NumAddresses, IndexResults);
+  }
+
+  IndexTime = UserGetTimestampUs () - StartTime;
+  MachoFreeIndex (&Context);
+
+  DEBUG ((
+    DEBUG_WARN,
+    "BENCH: %u symbols, %u relocations, %u iterations - linear %Lu us, indexed %Lu us, results %a\n",
+    NumNames,
+    NumAddresses,
+    Iterations,
+    LinearTime,
+    IndexTime,
+    CompareMem (LinearResults, IndexResults, NumResults * sizeof (*LinearResults)) == 0 ? "match" : "DIFFER"
+    ));
+
+  FreePool (Names);
+  FreePool (Addresses);
+  FreePool (LinearResults);
+  FreePool (IndexResults);
+
+  return 0;
+}
+
 STATIC
 int
 FeedMacho (
@@ -314,12 +471,21 @@ ENTRY_POINT (
 {
   UINT32  FileSize;
   UINT8   *Buffer;
+  UINT32  Iterations;
 
   if ((Buffer = UserReadFile ((argc > 1) ? argv[1] : "kernel", &FileSize)) == NULL) {
     DEBUG ((DEBUG_ERROR, "Read fail\n"));
     return -1;
   }
 
+  //
+  // Usage: Macho <path/to/macho> bench [iterations]
+  //
+  if ((argc > 2) && (AsciiStrCmp (argv[2], "bench") == 0)) {
+    Iterations = (argc > 3) ? (UINT32)AsciiStrDecimalToUintn (argv[3]) : 1;
+    return BenchmarkMacho (Buffer, FileSize, MAX (Iterations, 1));
+  }
+
   return FeedMacho (Buffer, FileSize);
 }
 
@@ -9,10 +9,17 @@
 #include <UserFile.h>
 #include <UserGlobalVar.h>
 
+#include <sys/time.h>
+
 UINTN        mFuzzOffset;
 UINTN        mFuzzSize;
 CONST UINT8  *mFuzzPointer;
 
+CONST UINT8  *mImage;
+UINTN        mImageSize;
+UINT64       mImageReads;
+UINT64       mImageReadBytes;
+
 EFI_STATUS
 EFIAPI
 FuzzReadDisk (
@@ -38,6 +45,31 @@ FuzzReadDisk (
   return EFI_SUCCESS;
 }
 
+EFI_STATUS
+EFIAPI
+ImageReadDisk (
+  IN  EFI_DISK_IO_PROTOCOL  *This,
+  IN  UINT32                MediaId,
+  IN  UINT64                Offset,
+  IN  UINTN                 BufferSize,
+  OUT VOID                  *Buffer
+  )
+{
+  if (Buffer == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if ((Offset > mImageSize) || ((mImageSize - Offset) < BufferSize)) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  CopyMem (Buffer, mImage + Offset, BufferSize);
+  ++mImageReads;
+  mImageReadBytes += BufferSize;
+
+  return EFI_SUCCESS;
+}
+
 VOID
 FreeAll (
   IN CHAR16  *FileName,
@@ -67,6 +99,7 @@ FreeAll (
       FreePool (Instance->RootIndex->File);
     }
 
+    FreeMftCache (Instance);
     FreePool (Instance);
   }
 }
@@ -261,6 +294,125 @@ LLVMFuzzerTestOneInput (
   return 0;
 }
 
+STATIC
+UINT64
+GetTimestampUs (
+  VOID
+  )
+{
+  struct timeval  Time;
+
+  gettimeofday (&Time, NULL);
+  return Time.tv_sec * 1000000ULL + Time.tv_usec;
+}
+
+/**
+  Mount NTFS disk image, read whole file and report disk reads and throughput.
+**/
+STATIC
+INT32
+BenchmarkImage (
+  IN CONST UINT8  *Image,
+  IN UINTN        ImageSize,
+  IN CONST CHAR8  *Path
+  )
+{
+  EFI_STATUS         Status;
+  EFI_FS             *Instance;
+  EFI_FILE_PROTOCOL  *NewHandle;
+  CHAR16             *FileName;
+  VOID               *Buffer;
+  UINTN              BufferSize;
+  UINTN              Index;
+  UINT64             FileSize;
+  UINT64             StartTime;
+  UINT64             MountTime;
+  UINT64             EndTime;
+
+  mImage          = Image;
+  mImageSize      = ImageSize;
+  mImageReads     = 0;
+  mImageReadBytes = 0;
+
+  FileName = AllocateZeroPool ((AsciiStrLen (Path) + 1) * sizeof (CHAR16));
+  if (FileName == NULL) {
+    return -1;
+  }
+
+  Instance = AllocateZeroPool (sizeof (EFI_FS));
+  if (Instance == NULL) {
+    FreePool (FileName);
+    return -1;
+  }
+
+  for (Index = 0; Path[Index] != '\0'; ++Index) {
+    FileName[Index] = Path[Index] == '/' ? L'\\' : Path[Index];
+  }
+
+  Instance->DiskIo  = AllocateZeroPool (sizeof (EFI_DISK_IO_PROTOCOL));
+  Instance->BlockIo = AllocateZeroPool (sizeof (EFI_BLOCK_IO_PROTOCOL));
+  if ((Instance->DiskIo == NULL) || (Instance->BlockIo == NULL)) {
+    FreeAll (FileName, Instance);
+    return -1;
+  }
+
+  Instance->BlockIo->Media = AllocateZeroPool (sizeof (EFI_BLOCK_IO_MEDIA));
+  if (Instance->BlockIo->Media == NULL) {
+    FreeAll (FileName, Instance);
+    return -1;
+  }
+
+  Instance->DiskIo->ReadDisk = ImageReadDisk;
+
+  StartTime = GetTimestampUs ();
+
+  Status = NtfsMount (Instance);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Mount fail - %r\n", Status));
+    FreeAll (FileName, Instance);
+    return -1;
+  }
+
+  MountTime = GetTimestampUs ();
+
+  Status = FileOpen ((EFI_FILE_PROTOCOL *)Instance->RootIndex->File, &NewHandle, FileName, EFI_FILE_MODE_READ, 0);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Open %a fail - %r\n", Path, Status));
+    FreeAll (FileName, Instance);
+    return -1;
+  }
+
+  FileSize = ((EFI_NTFS_FILE *)NewHandle)->RootFile.DataAttributeSize;
+  Buffer   = AllocatePool ((UINTN)FileSize + 1);
+  if (Buffer == NULL) {
+    FileClose (NewHandle);
+    FreeAll (FileName, Instance);
+    return -1;
+  }
+
+  BufferSize = (UINTN)FileSize;
+  Status     = FileRead (NewHandle, &BufferSize, Buffer);
+  EndTime    = GetTimestampUs ();
+
+  DEBUG ((
+    DEBUG_ERROR,
+    "%a: %r, %Lu bytes, mount %Lu us, open and read %Lu us, %Lu disk reads of %Lu bytes\n",
+    Path,
+    Status,
+    (UINT64)BufferSize,
+    MountTime - StartTime,
+    EndTime - MountTime,
+    mImageReads,
+    mImageReadBytes
+    ));
+
+  FreePool (Buffer);
+  FileClose (NewHandle);
+  FreeAll (FileName, Instance);
+
+  return EFI_ERROR (Status) ? -1 : 0;
+}
+
 int
 ENTRY_POINT (
   int   argc,
@@ -269,12 +421,30 @@ ENTRY_POINT (
 {
   uint32_t  f;
   uint8_t   *b;
+  int       Index;
+  int       Result;
 
   if ((b = UserReadFile ((argc > 1) ? argv[1] : "in.bin", &f)) == NULL) {
     DEBUG ((DEBUG_ERROR, "Read fail\n"));
     return -1;
   }
 
+  //
+  // TestNtfsDxe image.bin path... benchmarks reading files from a disk image,
+  // otherwise the input is processed like fuzzing data.
+  //
+  if (argc > 2) {
+    Result = 0;
+    for (Index = 2; Index < argc; ++Index) {
+      if (BenchmarkImage (b, f, argv[Index]) != 0) {
+        Result = -1;
+      }
+    }
+
+    FreePool (b);
+    return Result;
+  }
+
   LLVMFuzzerTestOneInput (b, f);
   FreePool (b);
   return 0;
@@ -22,11 +22,24 @@
 
 #include <Library/OcConfigurationLib.h>
 #include <Library/OcMainLib.h>
+#include <Library/OcXmlLib.h>
 
 #include <UserFile.h>
+#include <UserMemory.h>
+
+#include "PrelinkedInternal.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/time.h>
 
 #define  OC_USER_FULL_PATH_MAX_SIZE  256
 
+typedef enum {
+  UserBenchmarkFormatCsv,
+  UserBenchmarkFormatJson
+} USER_BENCHMARK_FORMAT;
+
 STATIC CHAR8  mFullPath[OC_USER_FULL_PATH_MAX_SIZE] = { 0 };
 STATIC UINTN  mRootPathLen                          = 0;
 
@@ -83,6 +96,30 @@ STATIC EFI_FILE_PROTOCOL  NilFileProtocol;
 STATIC UINT8   *mPrelinked    = NULL;
 STATIC UINT32  mPrelinkedSize = 0;
 
+STATIC USER_BENCHMARK_FORMAT  mBenchmarkFormat = UserBenchmarkFormatCsv;
+
+#define  USER_PLIST_ONLY_KEXT_IDENTIFIER  "org.acidanthera.TestPlistOnly"
+
+STATIC CONST CHAR8  mPlistOnlyKextInfoPlist[] =
+  "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+  "<!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">\n"
+  "<plist version=\"1.0\">\n"
+  "<dict>\n"
+  "\t<key>CFBundleIdentifier</key>\n"
+  "\t<string>" USER_PLIST_ONLY_KEXT_IDENTIFIER "</string>\n"
+  "\t<key>CFBundleInfoDictionaryVersion</key>\n"
+  "\t<string>6.0</string>\n"
+  "\t<key>CFBundleName</key>\n"
+  "\t<string>TestPlistOnly</string>\n"
+  "\t<key>CFBundlePackageType</key>\n"
+  "\t<string>KEXT</string>\n"
+  "\t<key>CFBundleVersion</key>\n"
+  "\t<string>1.0.0</string>\n"
+  "\t<key>OSBundleRequired</key>\n"
+  "\t<string>Root</string>\n"
+  "</dict>\n"
+  "</plist>\n";
+
 //
 // TODO: Windows portability.
 //
@@ -278,6 +315,694 @@ UserOcKernelLoadAndReserveKext (
   return EFI_SUCCESS;
 }
 
+/**
+  Inject a plist-only kext into a scratch copy of prelinkedkernel
+  and resolve it by bundle identifier through the kext index.
+**/
+STATIC
+VOID
+UserTestPlistOnlyKext (
+  IN BOOLEAN      Is32Bit,
+  IN CONST UINT8  *Prelinked,
+  IN UINT32       PrelinkedSize,
+  IN UINT32       AllocSize,
+  IN UINT32       LinkedExpansion,
+  IN UINT32       ReservedExeSize
+  )
+{
+  EFI_STATUS                  Status;
+  PRELINKED_CONTEXT           Context;
+  PRELINKED_KEXT_INDEX_ENTRY  *Entry;
+  UINT8                       *Scratch;
+
+  Scratch = AllocatePool (AllocSize);
+  if (Scratch == NULL) {
+    DEBUG ((DEBUG_WARN, "[FAIL] Plist-only kext allocation failure\n"));
+    FailedToProcess = TRUE;
+    return;
+  }
+
+  CopyMem (Scratch, Prelinked, PrelinkedSize);
+
+  Status = PrelinkedContextInit (&Context, Scratch, PrelinkedSize, AllocSize, Is32Bit);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "[OK] Plist-only kext skipped, no prelinked context - %r\n", Status));
+    FreePool (Scratch);
+    return;
+  }
+
+  Status = PrelinkedInjectPrepare (&Context, LinkedExpansion, ReservedExeSize);
+  if (!EFI_ERROR (Status)) {
+    Status = PrelinkedInjectKext (
+               &Context,
+               NULL,
+               "/Library/Extensions/TestPlistOnly.kext",
+               mPlistOnlyKextInfoPlist,
+               L_STR_LEN (mPlistOnlyKextInfoPlist),
+               NULL,
+               NULL,
+               0,
+               NULL
+               );
+  }
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "[FAIL] Plist-only kext injection - %r\n", Status));
+    FailedToProcess = TRUE;
+  } else if (Context.KextIndex == NULL) {
+    DEBUG ((DEBUG_WARN, "[OK] Plist-only kext injected without kext index\n"));
+  } else {
+    Entry = InternalLookupPrelinkedKextIndex (&Context, USER_PLIST_ONLY_KEXT_IDENTIFIER);
+    if (  (Entry == NULL)
+       || (Entry->KextPlist != XmlNodeChild (Context.KextList, XmlNodeChildren (Context.KextList) - 1))
+       || (Entry->Kext != NULL))
+    {
+      DEBUG ((DEBUG_WARN, "[FAIL] Plist-only kext %a is not indexed\n", USER_PLIST_ONLY_KEXT_IDENTIFIER));
+      FailedToProcess = TRUE;
+    } else {
+      DEBUG ((DEBUG_WARN, "[OK] Plist-only kext %a is indexed\n", USER_PLIST_ONLY_KEXT_IDENTIFIER));
+    }
+  }
+
+  PrelinkedContextFree (&Context);
+  FreePool (Scratch);
+}
+
+STATIC
+UINT64
+UserGetTimestampUs (
+  VOID
+  )
+{
+  struct timeval  Time;
+
+  gettimeofday (&Time, NULL);
+  return Time.tv_sec * 1000000ULL + Time.tv_usec;
+}
+
+/**
+  Inject every configured kext into a scratch copy of prelinkedkernel
+  and report link time together with dependency symbol lookup counts.
+**/
+STATIC
+VOID
+UserBenchmarkKextLinking (
+  IN OC_GLOBAL_CONFIG  *Config,
+  IN BOOLEAN           Is32Bit,
+  IN CONST UINT8       *Prelinked,
+  IN UINT32            PrelinkedSize,
+  IN UINT32            AllocSize,
+  IN UINT32            LinkedExpansion,
+  IN UINT32            ReservedExeSize
+  )
+{
+  EFI_STATUS           Status;
+  PRELINKED_CONTEXT    Context;
+  UINT8                *Scratch;
+  UINT32               Index;
+  OC_KERNEL_ADD_ENTRY  *Kext;
+  CONST CHAR8          *BundlePath;
+  CHAR8                FullPath[OC_STORAGE_SAFE_PATH_MAX];
+  UINT64               StartTime;
+  UINT64               KextTime;
+  UINT64               TotalTime;
+  UINT32               TotalNameLookups;
+  UINT32               TotalValueLookups;
+  UINTN                PoolAllocations;
+
+  Scratch = AllocatePool (AllocSize);
+  if (Scratch == NULL) {
+    DEBUG ((DEBUG_WARN, "[FAIL] Benchmark allocation failure\n"));
+    FailedToProcess = TRUE;
+    return;
+  }
+
+  CopyMem (Scratch, Prelinked, PrelinkedSize);
+
+  PoolAllocations = mPoolAllocationsTotal;
+  StartTime       = UserGetTimestampUs ();
+  Status          = PrelinkedContextInit (&Context, Scratch, PrelinkedSize, AllocSize, Is32Bit);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "[FAIL] Benchmark context creation error %r\n", Status));
+    FailedToProcess = TRUE;
+    FreePool (Scratch);
+    return;
+  }
+
+  //
+  // Most of the time is spent parsing __PRELINK_INFO plist.
+  //
+  DEBUG ((
+    DEBUG_WARN,
+    "BENCH: Context init %Lu us, %u pool allocations\n",
+    UserGetTimestampUs () - StartTime,
+    (UINT32)(mPoolAllocationsTotal - PoolAllocations)
+    ));
+
+  Status = PrelinkedInjectPrepare (&Context, LinkedExpansion, ReservedExeSize);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "[FAIL] Benchmark inject prepare error %r\n", Status));
+    FailedToProcess = TRUE;
+    PrelinkedContextFree (&Context);
+    FreePool (Scratch);
+    return;
+  }
+
+  TotalTime         = 0;
+  TotalNameLookups  = 0;
+  TotalValueLookups = 0;
+
+  for (Index = 0; Index < Config->Kernel.Add.Count; ++Index) {
+    Kext = Config->Kernel.Add.Values[Index];
+    if (!Kext->Enabled || (Kext->PlistData == NULL)) {
+      continue;
+    }
+
+    BundlePath = OC_BLOB_GET (&Kext->BundlePath);
+    Status     = OcAsciiSafeSPrint (FullPath, sizeof (FullPath), "/Library/Extensions/%a", BundlePath);
+    if (EFI_ERROR (Status)) {
+      continue;
+    }
+
+    Context.SymbolNameLookups  = 0;
+    Context.SymbolValueLookups = 0;
+
+    StartTime = UserGetTimestampUs ();
+    Status    = PrelinkedInjectKext (
+                  &Context,
+                  NULL,
+                  FullPath,
+                  Kext->PlistData,
+                  Kext->PlistDataSize,
+                  Kext->ImageData != NULL ? OC_BLOB_GET (&Kext->ExecutablePath) : NULL,
+                  Kext->ImageData,
+                  Kext->ImageDataSize,
+                  NULL
+                  );
+    KextTime = UserGetTimestampUs () - StartTime;
+
+    TotalTime         += KextTime;
+    TotalNameLookups  += Context.SymbolNameLookups;
+    TotalValueLookups += Context.SymbolValueLookups;
+
+    DEBUG ((
+      DEBUG_WARN,
+      "BENCH: %a - %r, %Lu us, %u name lookups, %u value lookups\n",
+      BundlePath,
+      Status,
+      KextTime,
+      Context.SymbolNameLookups,
+      Context.SymbolValueLookups
+      ));
+  }
+
+  DEBUG ((
+    DEBUG_WARN,
+    "BENCH: Total link time %Lu us, %u name lookups, %u value lookups\n",
+    TotalTime,
+    TotalNameLookups,
+    TotalValueLookups
+    ));
+
+  PrelinkedContextFree (&Context);
+  FreePool (Scratch);
+}
+
+/**
+  Apply configured kernel patches to two scratch copies of the kernel,
+  one patch at a time and in a single pass, and report both timings.
+**/
+STATIC
+VOID
+UserBenchmarkKernelPatches (
+  IN OC_GLOBAL_CONFIG  *Config,
+  IN BOOLEAN           Is32Bit,
+  IN CONST UINT8       *Kernel,
+  IN UINT32            KernelSize
+  )
+{
+  EFI_STATUS             Status;
+  PATCHER_CONTEXT        SequentialPatcher;
+  PATCHER_CONTEXT        BatchPatcher;
+  UINT8                  *SequentialKernel;
+  UINT8                  *BatchKernel;
+  PATCHER_GENERIC_PATCH  *Patches;
+  EFI_STATUS             *Results;
+  OC_KERNEL_PATCH_ENTRY  *UserPatch;
+  UINT32                 PatchCount;
+  UINT32                 Index;
+  UINT64                 StartTime;
+  UINT64                 SequentialTime;
+  UINT64                 BatchTime;
+
+  if (Config->Kernel.Patch.Count == 0) {
+    return;
+  }
+
+  SequentialKernel = AllocateCopyPool (KernelSize, Kernel);
+  BatchKernel      = AllocateCopyPool (KernelSize, Kernel);
+  Patches          = AllocateZeroPool (Config->Kernel.Patch.Count * sizeof (*Patches));
+  Results          = AllocatePool (Config->Kernel.Patch.Count * sizeof (*Results));
+  if ((SequentialKernel == NULL) || (BatchKernel == NULL) || (Patches == NULL) || (Results == NULL)) {
+    DEBUG ((DEBUG_WARN, "[FAIL] Benchmark allocation failure\n"));
+    FailedToProcess = TRUE;
+    return;
+  }
+
+  PatchCount = 0;
+  for (Index = 0; Index < Config->Kernel.Patch.Count; ++Index) {
+    UserPatch = Config->Kernel.Patch.Values[Index];
+    if (  !UserPatch->Enabled
+       || (AsciiStrCmp (OC_BLOB_GET (&UserPatch->Identifier), "kernel") != 0)
+       || (UserPatch->Find.Size == 0)
+       || (UserPatch->Find.Size != UserPatch->Replace.Size))
+    {
+      continue;
+    }
+
+    Patches[PatchCount].Comment     = OC_BLOB_GET (&UserPatch->Comment);
+    Patches[PatchCount].Base        = OC_BLOB_GET (&UserPatch->Base)[0] != '\0' ? OC_BLOB_GET (&UserPatch->Base) : NULL;
+    Patches[PatchCount].Find        = OC_BLOB_GET (&UserPatch->Find);
+    Patches[PatchCount].Replace     = OC_BLOB_GET (&UserPatch->Replace);
+    Patches[PatchCount].Mask        = UserPatch->Mask.Size > 0 ? OC_BLOB_GET (&UserPatch->Mask) : NULL;
+    Patches[PatchCount].ReplaceMask = UserPatch->ReplaceMask.Size > 0 ? OC_BLOB_GET (&UserPatch->ReplaceMask) : NULL;
+    Patches[PatchCount].Size        = UserPatch->Replace.Size;
+    Patches[PatchCount].Count       = UserPatch->Count;
+    Patches[PatchCount].Skip        = UserPatch->Skip;
+    Patches[PatchCount].Limit       = UserPatch->Limit;
+    ++PatchCount;
+  }
+
+  Status = PatcherInitContextFromBuffer (&SequentialPatcher, SequentialKernel, KernelSize, Is32Bit);
+  if (!EFI_ERROR (Status)) {
+    Status = PatcherInitContextFromBuffer (&BatchPatcher, BatchKernel, KernelSize, Is32Bit);
+  }
+
+  if (!EFI_ERROR (Status)) {
+    StartTime = UserGetTimestampUs ();
+    for (Index = 0; Index < PatchCount; ++Index) {
+      PatcherApplyGenericPatch (&SequentialPatcher, &Patches[Index]);
+    }
+
+    SequentialTime = UserGetTimestampUs () - StartTime;
+
+    StartTime = UserGetTimestampUs ();
+    PatcherApplyGenericPatches (&BatchPatcher, Patches, PatchCount, Results);
+    BatchTime = UserGetTimestampUs () - StartTime;
+
+    DEBUG ((
+      DEBUG_WARN,
+      "BENCH: %u kernel patches - sequential %Lu us, single pass %Lu us, results %a\n",
+      PatchCount,
+      SequentialTime,
+      BatchTime,
+      CompareMem (SequentialKernel, BatchKernel, KernelSize) == 0 ? "match" : "DIFFER"
+      ));
+
+    if (CompareMem (SequentialKernel, BatchKernel, KernelSize) != 0) {
+      FailedToProcess = TRUE;
+    }
+  } else {
+    DEBUG ((DEBUG_WARN, "[FAIL] Benchmark patcher init failure - %r\n", Status));
+    FailedToProcess = TRUE;
+  }
+
+  FreePool (SequentialKernel);
+  FreePool (BatchKernel);
+  FreePool (Patches);
+  FreePool (Results);
+}
+
+/**
+  Print one benchmark result row in the selected format.
+  Time and allocations are reported relative to StartTime and PoolAllocations.
+**/
+STATIC
+VOID
+UserBenchmarkReport (
+  IN CONST CHAR8  *KernelName,
+  IN UINT32       Iteration,
+  IN CONST CHAR8  *Phase,
+  IN CONST CHAR8  *KextName  OPTIONAL,
+  IN EFI_STATUS   Status,
+  IN UINT64       StartTime,
+  IN UINTN        PoolAllocations,
+  IN UINT32       NameLookups,
+  IN UINT32       ValueLookups
+  )
+{
+  UINT64  Time;
+  UINT32  Allocations;
+  CHAR8   Row[512];
+
+  Time        = UserGetTimestampUs () - StartTime;
+  Allocations = (UINT32)(mPoolAllocationsTotal - PoolAllocations);
+
+  if (KextName == NULL) {
+    KextName = "";
+  }
+
+  if (mBenchmarkFormat == UserBenchmarkFormatJson) {
+    AsciiSPrint (
+      Row,
+      sizeof (Row),
+      "{\"kernel\":\"%a\",\"iteration\":%u,\"phase\":\"%a\",\"kext\":\"%a\",\"status\":\"%r\","
+      "\"time_us\":%Lu,\"allocations\":%u,\"name_lookups\":%u,\"value_lookups\":%u}\n",
+      KernelName,
+      Iteration,
+      Phase,
+      KextName,
+      Status,
+      Time,
+      Allocations,
+      NameLookups,
+      ValueLookups
+      );
+  } else {
+    AsciiSPrint (
+      Row,
+      sizeof (Row),
+      "%a,%u,%a,%a,%r,%Lu,%u,%u,%u\n",
+      KernelName,
+      Iteration,
+      Phase,
+      KextName,
+      Status,
+      Time,
+      Allocations,
+      NameLookups,
+      ValueLookups
+      );
+  }
+
+  fputs (Row, stdout);
+}
+
+/**
+  Apply either configured generic patches or configured quirks to the kernel,
+  or to prelinked kexts when Context is not NULL, so that both can be timed apart.
+**/
+STATIC
+VOID
+UserBenchmarkApplyPatches (
+  IN OC_GLOBAL_CONFIG   *Config,
+  IN OC_CPU_INFO        *CpuInfo,
+  IN UINT32             DarwinVersion,
+  IN BOOLEAN            Is32Bit,
+  IN PRELINKED_CONTEXT  *Context  OPTIONAL,
+  IN UINT8              *Kernel   OPTIONAL,
+  IN UINT32             KernelSize,
+  IN BOOLEAN            Quirks
+  )
+{
+  OC_KERNEL_QUIRKS  SavedQuirks;
+  UINT32            SavedCpuid1Data[4];
+  BOOLEAN           SavedDummyPowerManagement;
+  UINT32            SavedPatchCount;
+
+  SavedPatchCount           = Config->Kernel.Patch.Count;
+  SavedDummyPowerManagement = Config->Kernel.Emulate.DummyPowerManagement;
+  CopyMem (&SavedQuirks, &Config->Kernel.Quirks, sizeof (SavedQuirks));
+  CopyMem (SavedCpuid1Data, Config->Kernel.Emulate.Cpuid1Data, sizeof (SavedCpuid1Data));
+
+  if (Quirks) {
+    Config->Kernel.Patch.Count = 0;
+  } else {
+    ZeroMem (&Config->Kernel.Quirks, sizeof (Config->Kernel.Quirks));
+    ZeroMem (Config->Kernel.Emulate.Cpuid1Data, sizeof (Config->Kernel.Emulate.Cpuid1Data));
+    Config->Kernel.Quirks.SetApfsTrimTimeout    = -1;
+    Config->Kernel.Emulate.DummyPowerManagement = FALSE;
+  }
+
+  OcKernelApplyPatches (
+    Config,
+    CpuInfo,
+    DarwinVersion,
+    Is32Bit,
+    Context != NULL ? CacheTypePrelinked : CacheTypeNone,
+    Context,
+    Kernel,
+    KernelSize
+    );
+
+  Config->Kernel.Patch.Count                  = SavedPatchCount;
+  Config->Kernel.Emulate.DummyPowerManagement = SavedDummyPowerManagement;
+  CopyMem (&Config->Kernel.Quirks, &SavedQuirks, sizeof (SavedQuirks));
+  CopyMem (Config->Kernel.Emulate.Cpuid1Data, SavedCpuid1Data, sizeof (SavedCpuid1Data));
+}
+
+/**
+  Run one full kernel processing iteration over mPrelinked and report
+  wall time and pool allocations for every phase.
+**/
+STATIC
+VOID
+UserBenchmarkKernel (
+  IN OC_GLOBAL_CONFIG  *Config,
+  IN CONST CHAR8       *KernelName,
+  IN UINT32            Iteration,
+  IN UINT32            ReservedSize,
+  IN UINT32            LinkedExpansion,
+  IN UINT32            ReservedExeSize
+  )
+{
+  EFI_STATUS           Status;
+  PRELINKED_CONTEXT    Context;
+  OC_CPU_INFO          CpuInfo;
+  UINT8                *Kernel;
+  UINT32               KernelSize;
+  UINT32               AllocSize;
+  BOOLEAN              Is32Bit;
+  UINT32               DarwinVersion;
+  CHAR8                *PrelinkedInfo;
+  UINT32               PrelinkedInfoSize;
+  XML_DOCUMENT         *PrelinkedInfoDocument;
+  UINT32               Index;
+  OC_KERNEL_ADD_ENTRY  *Kext;
+  CONST CHAR8          *BundlePath;
+  CHAR8                FullPath[OC_STORAGE_SAFE_PATH_MAX];
+  UINT64               StartTime;
+  UINTN                PoolAllocations;
+
+  ZeroMem (&CpuInfo, sizeof (CpuInfo));
+
+  PoolAllocations = mPoolAllocationsTotal;
+  StartTime       = UserGetTimestampUs ();
+  Status          = ReadAppleKernel (
+                      &NilFileProtocol,
+                      FALSE,
+                      &Is32Bit,
+                      &Kernel,
+                      &KernelSize,
+                      &AllocSize,
+                      ReservedSize,
+                      NULL
+                      );
+  UserBenchmarkReport (KernelName, Iteration, "decompress", NULL, Status, StartTime, PoolAllocations, 0, 0);
+  if (EFI_ERROR (Status)) {
+    FailedToProcess = TRUE;
+    return;
+  }
+
+  DarwinVersion = OcKernelReadDarwinVersion (Kernel, KernelSize);
+
+  PoolAllocations = mPoolAllocationsTotal;
+  StartTime       = UserGetTimestampUs ();
+  UserBenchmarkApplyPatches (Config, &CpuInfo, DarwinVersion, Is32Bit, NULL, Kernel, KernelSize, FALSE);
+  UserBenchmarkReport (KernelName, Iteration, "kernel_patches", NULL, EFI_SUCCESS, StartTime, PoolAllocations, 0, 0);
+
+  PoolAllocations = mPoolAllocationsTotal;
+  StartTime       = UserGetTimestampUs ();
+  UserBenchmarkApplyPatches (Config, &CpuInfo, DarwinVersion, Is32Bit, NULL, Kernel, KernelSize, TRUE);
+  UserBenchmarkReport (KernelName, Iteration, "kernel_quirks", NULL, EFI_SUCCESS, StartTime, PoolAllocations, 0, 0);
+
+  PoolAllocations = mPoolAllocationsTotal;
+  StartTime       = UserGetTimestampUs ();
+  Status          = PrelinkedContextInit (&Context, Kernel, KernelSize, AllocSize, Is32Bit);
+  UserBenchmarkReport (KernelName, Iteration, "context_init", NULL, Status, StartTime, PoolAllocations, 0, 0);
+  if (EFI_ERROR (Status)) {
+    FailedToProcess = TRUE;
+    FreePool (Kernel);
+    return;
+  }
+
+  //
+  // Context init includes __PRELINK_INFO parsing, so parse an untouched copy
+  // once more to report the plist cost on its own.
+  //
+  PrelinkedInfoSize = (UINT32)(Context.Is32Bit ?
+                               Context.PrelinkedInfoSection->Section32.Size : Context.PrelinkedInfoSection->Section64.Size);
+  PrelinkedInfo     = AllocateCopyPool (
+                        PrelinkedInfoSize,
+                        &Kernel[Context.Is32Bit ? Context.PrelinkedInfoSection->Section32.Offset : Context.PrelinkedInfoSection->Section64.Offset]
+                        );
+  if (PrelinkedInfo != NULL) {
+    PoolAllocations       = mPoolAllocationsTotal;
+    StartTime             = UserGetTimestampUs ();
+    PrelinkedInfoDocument = XmlDocumentParseLazy (
+                              PrelinkedInfo,
+                              PrelinkedInfoSize,
+                              TRUE,
+                              Context.IsKernelCollection ? PRELINK_INFO_KEXT_LEVEL_KC : PRELINK_INFO_KEXT_LEVEL
+                              );
+    UserBenchmarkReport (
+      KernelName,
+      Iteration,
+      "plist_parse",
+      NULL,
+      PrelinkedInfoDocument != NULL ? EFI_SUCCESS : EFI_INVALID_PARAMETER,
+      StartTime,
+      PoolAllocations,
+      0,
+      0
+      );
+    if (PrelinkedInfoDocument != NULL) {
+      XmlDocumentFree (PrelinkedInfoDocument);
+    }
+
+    FreePool (PrelinkedInfo);
+  }
+
+  PoolAllocations = mPoolAllocationsTotal;
+  StartTime       = UserGetTimestampUs ();
+  Status          = PrelinkedInjectPrepare (&Context, LinkedExpansion, ReservedExeSize);
+  UserBenchmarkReport (KernelName, Iteration, "inject_prepare", NULL, Status, StartTime, PoolAllocations, 0, 0);
+  if (EFI_ERROR (Status)) {
+    FailedToProcess = TRUE;
+    PrelinkedContextFree (&Context);
+    FreePool (Kernel);
+    return;
+  }
+
+  //
+  // Linking and vtable patching happen within kext injection, they are
+  // accounted for by dependency symbol lookup counts.
+  //
+  for (Index = 0; Index < Config->Kernel.Add.Count; ++Index) {
+    Kext = Config->Kernel.Add.Values[Index];
+    if (!Kext->Enabled || (Kext->PlistData == NULL)) {
+      continue;
+    }
+
+    BundlePath = OC_BLOB_GET (&Kext->BundlePath);
+    Status     = OcAsciiSafeSPrint (FullPath, sizeof (FullPath), "/Library/Extensions/%a", BundlePath);
+    if (EFI_ERROR (Status)) {
+      continue;
+    }
+
+    Context.SymbolNameLookups  = 0;
+    Context.SymbolValueLookups = 0;
+
+    PoolAllocations = mPoolAllocationsTotal;
+    StartTime       = UserGetTimestampUs ();
+    Status          = PrelinkedInjectKext (
+                        &Context,
+                        NULL,
+                        FullPath,
+                        Kext->PlistData,
+                        Kext->PlistDataSize,
+                        Kext->ImageData != NULL ? OC_BLOB_GET (&Kext->ExecutablePath) : NULL,
+                        Kext->ImageData,
+                        Kext->ImageDataSize,
+                        NULL
+                        );
+    UserBenchmarkReport (
+      KernelName,
+      Iteration,
+      "inject",
+      BundlePath,
+      Status,
+      StartTime,
+      PoolAllocations,
+      Context.SymbolNameLookups,
+      Context.SymbolValueLookups
+      );
+  }
+
+  PoolAllocations = mPoolAllocationsTotal;
+  StartTime       = UserGetTimestampUs ();
+  Status          = PrelinkedInjectComplete (&Context);
+  UserBenchmarkReport (KernelName, Iteration, "inject_complete", NULL, Status, StartTime, PoolAllocations, 0, 0);
+  if (EFI_ERROR (Status)) {
+    FailedToProcess = TRUE;
+  }
+
+  PoolAllocations = mPoolAllocationsTotal;
+  StartTime       = UserGetTimestampUs ();
+  UserBenchmarkApplyPatches (Config, &CpuInfo, DarwinVersion, Is32Bit, &Context, NULL, 0, FALSE);
+  UserBenchmarkReport (KernelName, Iteration, "kext_patches", NULL, EFI_SUCCESS, StartTime, PoolAllocations, 0, 0);
+
+  PoolAllocations = mPoolAllocationsTotal;
+  StartTime       = UserGetTimestampUs ();
+  UserBenchmarkApplyPatches (Config, &CpuInfo, DarwinVersion, Is32Bit, &Context, NULL, 0, TRUE);
+  UserBenchmarkReport (KernelName, Iteration, "kext_quirks", NULL, EFI_SUCCESS, StartTime, PoolAllocations, 0, 0);
+
+  PrelinkedContextFree (&Context);
+  FreePool (Kernel);
+}
+
+/**
+  Run the given number of processing iterations over every kernel
+  in a directory and print per-phase results.
+**/
+STATIC
+VOID
+UserBenchmarkKernelDirectory (
+  IN OC_GLOBAL_CONFIG  *Config,
+  IN CONST CHAR8       *DirectoryPath,
+  IN UINT32            Iterations,
+  IN UINT32            ReservedSize,
+  IN UINT32            LinkedExpansion,
+  IN UINT32            ReservedExeSize
+  )
+{
+  EFI_STATUS     Status;
+  DIR            *Directory;
+  struct dirent  *Entry;
+  struct stat    EntryStat;
+  CHAR8          KernelPath[OC_USER_FULL_PATH_MAX_SIZE];
+  UINT32         Iteration;
+
+  Directory = opendir (DirectoryPath);
+  if (Directory == NULL) {
+    DEBUG ((DEBUG_ERROR, "Failed to open %a\n", DirectoryPath));
+    FailedToProcess = TRUE;
+    return;
+  }
+
+  if (mBenchmarkFormat == UserBenchmarkFormatCsv) {
+    fputs ("kernel,iteration,phase,kext,status,time_us,allocations,name_lookups,value_lookups\n", stdout);
+  }
+
+  while ((Entry = readdir (Directory)) != NULL) {
+    if (Entry->d_name[0] == '.') {
+      continue;
+    }
+
+    Status = OcAsciiSafeSPrint (KernelPath, sizeof (KernelPath), "%a/%a", DirectoryPath, Entry->d_name);
+    if (EFI_ERROR (Status) || (stat (KernelPath, &EntryStat) != 0) || !S_ISREG (EntryStat.st_mode)) {
+      continue;
+    }
+
+    mPrelinked = UserReadFile (KernelPath, &mPrelinkedSize);
+    if (mPrelinked == NULL) {
+      DEBUG ((DEBUG_ERROR, "Read fail %a\n", KernelPath));
+      FailedToProcess = TRUE;
+      continue;
+    }
+
+    for (Iteration = 0; Iteration < Iterations; ++Iteration) {
+      UserBenchmarkKernel (Config, Entry->d_name, Iteration, ReservedSize, LinkedExpansion, ReservedExeSize);
+    }
+
+    FreePool (mPrelinked);
+    mPrelinked     = NULL;
+    mPrelinkedSize = 0;
+  }
+
+  closedir (Directory);
+}
+
 EFI_STATUS
 OcGetFileData (
   IN  EFI_FILE_PROTOCOL  *File,
@@ -334,18 +1059,39 @@ WrapMain (
   UINT32   NewPrelinkedSize;
   UINT8    Sha384[48];
   BOOLEAN  Is32Bit;
+  BOOLEAN  Benchmark;
+  UINT32   BenchmarkIterations;
 
   OC_CPU_INFO  DummyCpuInfo;
 
   OC_KERNEL_ADD_ENTRY  *Kext;
 
   if (argc < 2) {
-    DEBUG ((DEBUG_ERROR, "Usage: %a <path/to/OC/folder/> [path/to/kernel]\n\n", argv[0]));
+    DEBUG ((DEBUG_ERROR, "Usage: %a <path/to/OC/folder/> [path/to/kernel] [bench]\n", argv[0]));
+    DEBUG ((DEBUG_ERROR, "       %a <path/to/OC/folder/> <path/to/kernels/> bench <iterations> [csv|json]\n\n", argv[0]));
     return -1;
   }
 
+  Benchmark = argc > 3 && AsciiStrCmp (argv[3], "bench") == 0;
+
+  //
+  // With iteration count the kernel path is a directory of kernels to benchmark.
+  //
+  BenchmarkIterations = 0;
+  if (Benchmark && (argc > 4)) {
+    BenchmarkIterations = (UINT32)AsciiStrDecimalToUintn (argv[4]);
+    if (BenchmarkIterations == 0) {
+      DEBUG ((DEBUG_ERROR, "Invalid iteration count %a\n", argv[4]));
+      return -1;
+    }
+
+    if ((argc > 5) && (AsciiStrCmp (argv[5], "json") == 0)) {
+      mBenchmarkFormat = UserBenchmarkFormatJson;
+    }
+  }
+
   FileName = argc > 2 ? argv[2] : "/System/Library/PrelinkedKernels/prelinkedkernel";
-  if ((mPrelinked = UserReadFile (FileName, &mPrelinkedSize)) == NULL) {
+  if ((BenchmarkIterations == 0) && ((mPrelinked = UserReadFile (FileName, &mPrelinkedSize)) == NULL)) {
     DEBUG ((DEBUG_ERROR, "Read fail %a\n", FileName));
     return -1;
   }
@@ -380,9 +1126,14 @@ WrapMain (
     DEBUG ((DEBUG_ERROR, "Serialisation returns %u %a!\n", ErrorCount, ErrorCount > 1 ? "errors" : "error"));
   }
 
-  PcdGet32 (PcdFixedDebugPrintErrorLevel) |= DEBUG_INFO;
-  PcdGet32 (PcdDebugPrintErrorLevel)      |= DEBUG_INFO;
-  PcdGet8 (PcdDebugPropertyMask)          |= DEBUG_PROPERTY_DEBUG_CODE_ENABLED;
+  //
+  // Keep benchmark output machine-readable.
+  //
+  if (BenchmarkIterations == 0) {
+    PcdGet32 (PcdFixedDebugPrintErrorLevel) |= DEBUG_INFO;
+    PcdGet32 (PcdDebugPrintErrorLevel)      |= DEBUG_INFO;
+    PcdGet8 (PcdDebugPropertyMask)          |= DEBUG_PROPERTY_DEBUG_CODE_ENABLED;
+  }
 
   mUse32BitKernel  = FALSE;
   ReservedInfoSize = PRELINK_INFO_RESERVE_SIZE;
@@ -410,12 +1161,54 @@ WrapMain (
     }
   }
 
+  //
+  // Reserve room for the plist-only kext injected by UserTestPlistOnlyKext.
+  //
+  Status = PrelinkedReserveKextSize (
+             &ReservedInfoSize,
+             &ReservedExeSize,
+             L_STR_LEN (mPlistOnlyKextInfoPlist),
+             NULL,
+             0,
+             mUse32BitKernel
+             );
+  if (EFI_ERROR (Status)) {
+    FailedToProcess = TRUE;
+    return -1;
+  }
+
   LinkedExpansion = KcGetSegmentFixupChainsSize (ReservedExeSize);
   if (LinkedExpansion == 0) {
     FailedToProcess = TRUE;
     return -1;
   }
 
+  ZeroMem (&DummyCpuInfo, sizeof (DummyCpuInfo));
+  //
+  // Disable ProvideCurrentCpuInfo patch, as there is no CpuInfo available on userspace.
+  //
+  Config.Kernel.Quirks.ProvideCurrentCpuInfo = FALSE;
+  ASSERT (Config.Kernel.Quirks.ProvideCurrentCpuInfo == FALSE);
+
+  ZeroMem (Config.Kernel.Emulate.Cpuid1Data, sizeof (Config.Kernel.Emulate.Cpuid1Data));
+  Config.Kernel.Emulate.Cpuid1Data[0] = 0x000306A9;
+  ZeroMem (Config.Kernel.Emulate.Cpuid1Mask, sizeof (Config.Kernel.Emulate.Cpuid1Mask));
+  Config.Kernel.Emulate.Cpuid1Mask[0] = 0xFFFFFFFF;
+
+  ASSERT (Config.Kernel.Force.Count == 0);
+
+  if (BenchmarkIterations > 0) {
+    UserBenchmarkKernelDirectory (
+      &Config,
+      FileName,
+      BenchmarkIterations,
+      ReservedInfoSize + ReservedExeSize + LinkedExpansion,
+      LinkedExpansion,
+      ReservedExeSize
+      );
+    return FailedToProcess ? -1 : 0;
+  }
+
   Status = ReadAppleKernel (
              &NilFileProtocol,
              FALSE,
@@ -445,19 +1238,20 @@ WrapMain (
     FailedToProcess = TRUE;
   }
 
-  ZeroMem (&DummyCpuInfo, sizeof (DummyCpuInfo));
-  //
-  // Disable ProvideCurrentCpuInfo patch, as there is no CpuInfo available on userspace.
-  //
-  Config.Kernel.Quirks.ProvideCurrentCpuInfo = FALSE;
-  ASSERT (Config.Kernel.Quirks.ProvideCurrentCpuInfo == FALSE);
-
-  ZeroMem (Config.Kernel.Emulate.Cpuid1Data, sizeof (Config.Kernel.Emulate.Cpuid1Data));
-  Config.Kernel.Emulate.Cpuid1Data[0] = 0x000306A9;
-  ZeroMem (Config.Kernel.Emulate.Cpuid1Mask, sizeof (Config.Kernel.Emulate.Cpuid1Mask));
-  Config.Kernel.Emulate.Cpuid1Mask[0] = 0xFFFFFFFF;
+  if (Benchmark) {
+    UserBenchmarkKernelPatches (&Config, Is32Bit, NewPrelinked, NewPrelinkedSize);
+    UserBenchmarkKextLinking (
+      &Config,
+      Is32Bit,
+      NewPrelinked,
+      NewPrelinkedSize,
+      AllocSize,
+      LinkedExpansion,
+      ReservedExeSize
+      );
+  }
 
-  ASSERT (Config.Kernel.Force.Count == 0);
+  UserTestPlistOnlyKext (Is32Bit, NewPrelinked, NewPrelinkedSize, AllocSize, LinkedExpansion, ReservedExeSize);
 
   //
   // Apply patches to kernel itself, and then process prelinked.
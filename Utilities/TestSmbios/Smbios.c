@@ -23,6 +23,8 @@
 #include <Library/OcMiscLib.h>
 #include <IndustryStandard/AppleSmBios.h>
 
+#include "SmbiosInternal.h"
+
 #include <sys/time.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -71,6 +73,49 @@ bool  doDump = false;
 SMBIOS_TABLE_ENTRY_POINT      gSmbios;
 SMBIOS_TABLE_3_0_ENTRY_POINT  gSmbios3;
 
+STATIC
+VOID
+CheckStructureIndex (
+  IN UINT8   *Table,
+  IN UINT32  TableSize
+  )
+{
+  EFI_STATUS                      Status;
+  OC_SMBIOS_STRUCTURE_INDEX       Index;
+  APPLE_SMBIOS_STRUCTURE_POINTER  SmbiosTable;
+  APPLE_SMBIOS_STRUCTURE_POINTER  Expected;
+  APPLE_SMBIOS_STRUCTURE_POINTER  Indexed;
+  UINT32                          Type;
+  UINT32                          TypeIndex;
+  UINT16                          Count;
+
+  SmbiosTable.Raw = Table;
+
+  Status = SmbiosBuildStructureIndex (SmbiosTable, TableSize, &Index);
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  for (Type = 0; Type <= MAX_UINT8; ++Type) {
+    Count = SmbiosGetStructureCount (SmbiosTable, TableSize, (SMBIOS_TYPE)Type);
+    if (Count != SmbiosGetIndexedStructureCount (&Index, (SMBIOS_TYPE)Type)) {
+      DEBUG ((DEBUG_ERROR, "Structure index count mismatch for type %u\n", Type));
+      abort ();
+    }
+
+    for (TypeIndex = 0; TypeIndex <= (UINT32)Count + 1 && TypeIndex <= MAX_UINT16; ++TypeIndex) {
+      Expected = SmbiosGetStructureOfType (SmbiosTable, TableSize, (SMBIOS_TYPE)Type, (UINT16)TypeIndex);
+      Indexed  = SmbiosGetIndexedStructureOfType (&Index, (SMBIOS_TYPE)Type, (UINT16)TypeIndex);
+      if (Expected.Raw != Indexed.Raw) {
+        DEBUG ((DEBUG_ERROR, "Structure index mismatch for type %u index %u\n", Type, TypeIndex));
+        abort ();
+      }
+    }
+  }
+
+  SmbiosFreeStructureIndex (&Index);
+}
+
 int
 ENTRY_POINT (
   int   argc,
@@ -88,6 +133,8 @@ ENTRY_POINT (
     return -1;
   }
 
+  CheckStructureIndex (b, f);
+
   doDump                    = true;
   gSmbios3.TableMaximumSize = f;
   gSmbios3.TableAddress     = (uintptr_t)b;
@@ -146,6 +193,8 @@ LLVMFuzzerTestOneInput (
     if (NewData) {
       CopyMem (NewData, Data, Size);
 
+      CheckStructureIndex (NewData, (UINT32)Size);
+
       gSmbios3.TableMaximumSize = Size;
       gSmbios3.TableAddress     = (uintptr_t)NewData;
       gSmbios3.EntryPointLength = sizeof (SMBIOS_TABLE_3_0_ENTRY_POINT);
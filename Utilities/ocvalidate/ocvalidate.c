@@ -60,6 +60,177 @@ CheckConfig (
   return ErrorCount;
 }
 
+/**
+  Insert Entries copies of the first entry of Section -> Patch array.
+
+  @param[in]  Config   Config contents.
+  @param[in]  Section  Root section key, e.g. <key>ACPI</key>.
+  @param[in]  Entries  Number of entries to insert.
+
+  @return  New config contents allocated from pool or NULL.
+**/
+STATIC
+CHAR8 *
+BenchmarkInflatePatches (
+  IN  CONST CHAR8  *Config,
+  IN  CONST CHAR8  *Section,
+  IN  UINT32       Entries
+  )
+{
+  CONST CHAR8  *Entry;
+  CONST CHAR8  *EntryEnd;
+  CONST CHAR8  *ArrayEnd;
+  CONST CHAR8  *NextKey;
+  UINTN        EntrySize;
+  UINTN        ConfigSize;
+  CHAR8        *NewConfig;
+  CHAR8        *Walker;
+  UINT32       Index;
+
+  Entry = AsciiStrStr (Config, Section);
+  if (Entry != NULL) {
+    Entry = AsciiStrStr (Entry, "<key>Patch</key>");
+  }
+
+  if (Entry == NULL) {
+    return NULL;
+  }
+
+  //
+  // Patch array must be non-empty, i.e. open before its first entry key.
+  //
+  NextKey = AsciiStrStr (Entry + L_STR_LEN ("<key>Patch</key>"), "<key>");
+  Entry   = AsciiStrStr (Entry, "<array>");
+  if ((Entry == NULL) || (NextKey == NULL) || (Entry > NextKey)) {
+    return NULL;
+  }
+
+  ArrayEnd = AsciiStrStr (Entry, "</array>");
+  Entry    = AsciiStrStr (Entry, "<dict>");
+  EntryEnd = Entry != NULL ? AsciiStrStr (Entry, "</dict>") : NULL;
+  if ((EntryEnd == NULL) || (ArrayEnd == NULL) || (EntryEnd > ArrayEnd)) {
+    return NULL;
+  }
+
+  EntrySize  = EntryEnd + L_STR_LEN ("</dict>") - Entry;
+  ConfigSize = AsciiStrLen (Config);
+  NewConfig  = AllocatePool (ConfigSize + EntrySize * Entries + 1);
+  if (NewConfig == NULL) {
+    return NULL;
+  }
+
+  Walker = NewConfig;
+  CopyMem (Walker, Config, Entry - Config);
+  Walker += Entry - Config;
+  for (Index = 0; Index < Entries; ++Index) {
+    CopyMem (Walker, Entry, EntrySize);
+    Walker += EntrySize;
+  }
+
+  CopyMem (Walker, Entry, ConfigSize - (Entry - Config) + 1);
+  return NewConfig;
+}
+
+/**
+  Measure config parsing time with many ACPI and Kernel patches.
+
+  @param[in]  ConfigFileName  Config with at least one ACPI and Kernel patch.
+  @param[in]  Entries         Number of patches to add to each section.
+  @param[in]  Iterations      Number of times to parse the config.
+
+  @return  0 on success.
+**/
+STATIC
+int
+BenchmarkConfig (
+  IN  CONST CHAR8  *ConfigFileName,
+  IN  UINT32       Entries,
+  IN  UINT32       Iterations
+  )
+{
+  UINT8             *ConfigFileBuffer;
+  UINT32            ConfigFileSize;
+  CHAR8             *AcpiConfig;
+  CHAR8             *Config;
+  CHAR8             *ParseBuffer;
+  UINT32            ConfigSize;
+  UINT32            Index;
+  UINT32            ErrorCount;
+  INT64             StartTime;
+  INT64             XmlTime;
+  INT64             ConfigTime;
+  XML_DOCUMENT      *Document;
+  OC_GLOBAL_CONFIG  OcConfig;
+  EFI_STATUS        Status;
+
+  ConfigFileBuffer = UserReadFile (ConfigFileName, &ConfigFileSize);
+  if (ConfigFileBuffer == NULL) {
+    DEBUG ((DEBUG_ERROR, "Failed to read %a\n", ConfigFileName));
+    return -1;
+  }
+
+  AcpiConfig = BenchmarkInflatePatches ((CHAR8 *)ConfigFileBuffer, "<key>ACPI</key>", Entries);
+  FreePool (ConfigFileBuffer);
+  Config = AcpiConfig != NULL ? BenchmarkInflatePatches (AcpiConfig, "<key>Kernel</key>", Entries) : NULL;
+  if (AcpiConfig != NULL) {
+    FreePool (AcpiConfig);
+  }
+
+  if (Config == NULL) {
+    DEBUG ((DEBUG_ERROR, "%a needs ACPI and Kernel patches to replicate\n", ConfigFileName));
+    return -1;
+  }
+
+  ConfigSize  = (UINT32)AsciiStrLen (Config);
+  ParseBuffer = AllocatePool (ConfigSize + 1);
+  if (ParseBuffer == NULL) {
+    FreePool (Config);
+    return -1;
+  }
+
+  //
+  // Plist parsing modifies the buffer, so parse a fresh copy every time.
+  //
+  StartTime = GetCurrentTimestamp ();
+  for (Index = 0; Index < Iterations; ++Index) {
+    CopyMem (ParseBuffer, Config, ConfigSize + 1);
+    Document = XmlDocumentParse (ParseBuffer, ConfigSize, FALSE);
+    if (Document != NULL) {
+      XmlDocumentFree (Document);
+    }
+  }
+
+  XmlTime = GetCurrentTimestamp () - StartTime;
+
+  ErrorCount = 0;
+  StartTime  = GetCurrentTimestamp ();
+  for (Index = 0; Index < Iterations; ++Index) {
+    CopyMem (ParseBuffer, Config, ConfigSize + 1);
+    Status = OcConfigurationInit (&OcConfig, ParseBuffer, ConfigSize, &ErrorCount);
+    if (!EFI_ERROR (Status)) {
+      OcConfigurationFree (&OcConfig);
+    }
+  }
+
+  ConfigTime = GetCurrentTimestamp () - StartTime;
+
+  DEBUG ((
+    DEBUG_ERROR,
+    "BENCH: %u bytes with %u extra ACPI and Kernel patches, %u iterations - config %Ld ms, of which plist %Ld ms, schema %Ld ms, %u errors\n",
+    ConfigSize,
+    Entries,
+    Iterations,
+    ConfigTime,
+    XmlTime,
+    ConfigTime - XmlTime,
+    ErrorCount
+    ));
+
+  FreePool (ParseBuffer);
+  FreePool (Config);
+  return 0;
+}
+
 int
 ENTRY_POINT (
   int   argc,
@@ -69,6 +240,9 @@ ENTRY_POINT (
   UINT8             *ConfigFileBuffer;
   UINT32            ConfigFileSize;
   CONST CHAR8       *ConfigFileName;
+  CONST CHAR8       *BinaryFileName;
+  VOID              *BinaryFileBuffer;
+  UINT32            BinaryFileSize;
   INT64             ExecTimeStart;
   OC_GLOBAL_CONFIG  Config;
   EFI_STATUS        Status;
@@ -85,14 +259,27 @@ ENTRY_POINT (
 
   DEBUG ((DEBUG_ERROR, "\nNOTE: This version of ocvalidate is only compatible with OpenCore version %a!\n\n", OPEN_CORE_VERSION));
 
+  //
+  // Benchmark parsing: ocvalidate --bench <path/to/config.plist> [entries] [iterations]
+  //
+  if ((argc >= 3) && (AsciiStrCmp (argv[1], "--bench") == 0)) {
+    return BenchmarkConfig (
+             argv[2],
+             argc > 3 ? (UINT32)AsciiStrDecimalToUintn (argv[3]) : 2000,
+             argc > 4 ? (UINT32)AsciiStrDecimalToUintn (argv[4]) : 10
+             );
+  }
+
   //
   // Print usage.
   //
-  if (argc != 2) {
-    DEBUG ((DEBUG_ERROR, "Usage: %a <path/to/config.plist>\n\n", argv[0]));
+  if ((argc != 2) && (argc != 3)) {
+    DEBUG ((DEBUG_ERROR, "Usage: %a <path/to/config.plist> [path/to/config.bin]\n\n", argv[0]));
     return -1;
   }
 
+  BinaryFileName = argc == 3 ? argv[2] : NULL;
+
   //
   // Read config file (Only one single config is supported).
   //
@@ -127,6 +314,28 @@ ENTRY_POINT (
   DEBUG ((DEBUG_ERROR, "\n"));
   ErrorCount += CheckConfig (&Config);
 
+  //
+  // Compile validated config only, parsing modified the original buffer.
+  //
+  if ((BinaryFileName != NULL) && (ErrorCount == 0)) {
+    FreePool (ConfigFileBuffer);
+    ConfigFileBuffer = UserReadFile (ConfigFileName, &ConfigFileSize);
+    if (ConfigFileBuffer == NULL) {
+      DEBUG ((DEBUG_ERROR, "Failed to read %a\n", ConfigFileName));
+      return -1;
+    }
+
+    Status = OcConfigurationSerialize (&Config, ConfigFileBuffer, ConfigFileSize, &BinaryFileBuffer, &BinaryFileSize);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "Failed to compile %a - %r\n", ConfigFileName, Status));
+      return -1;
+    }
+
+    UserWriteFile (BinaryFileName, BinaryFileBuffer, BinaryFileSize);
+    FreePool (BinaryFileBuffer);
+    DEBUG ((DEBUG_ERROR, "Compiled %a into %a of %u bytes.\n", ConfigFileName, BinaryFileName, BinaryFileSize));
+  }
+
   OcConfigurationFree (&Config);
   FreePool (ConfigFileBuffer);
 
@@ -147,6 +356,10 @@ ENTRY_POINT (
       ErrorCount > 1 ? "issues" : "issue"
       ));
 
+    if (BinaryFileName != NULL) {
+      DEBUG ((DEBUG_ERROR, "Not compiling %a with issues.\n", ConfigFileName));
+    }
+
     return EXIT_FAILURE;
   }
 